@@ -28,15 +28,41 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 #include "hlhdf_debug.h"
 #include "hlhdf_alloc.h"
 #include "hlhdf_defines_private.h"
+#include "hlhdf_stats_private.h"
+#include "hlhdf_filter_private.h"
 #include <string.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 /*For internal use*/
-static int errorReportingOn=1;
-static void *edata;
-static herr_t (*errorFunction)(hid_t estack, void *client_data);
+/**
+ * The HDF5 error reporting state, see @ref hlhdf_getErrorState.
+ */
+typedef struct HL_ErrorReportingState {
+  int initialized; /**< if the error handler has been installed for the calling thread */
+  int errorReportingOn; /**< if error reporting is enabled */
+  void* edata; /**< the client data of the error handler when reporting is disabled */
+  herr_t (*errorFunction)(hid_t estack, void *client_data); /**< the error handler when reporting is disabled */
+} HL_ErrorReportingState;
+
+/** The error reporting state of the calling thread, used when HDF5 is thread-safe */
+static HLHDF_THREAD_LOCAL HL_ErrorReportingState threadErrorState = {0, 1, NULL, NULL};
+
+/** The error reporting state of the process, used when HDF5 not is thread-safe */
+static HL_ErrorReportingState processErrorState = {0, 1, NULL, NULL};
+
+/** If new threads should start with error reporting enabled or not, see @ref HL_setDebugMode */
+static int errorReportingDefault = 0;
 
-static int initialized = 0;
+static pthread_once_t initializeOnce = PTHREAD_ONCE_INIT;
+
+static pthread_once_t hdf5LockOnce = PTHREAD_ONCE_INIT;
+
+/** Serializes the HDF5 calls when HDF5 not has been built thread-safe */
+static pthread_mutex_t hdf5Lock;
+
+/** If the HDF5 library has been built thread-safe */
+static int hdf5Threadsafe = 0;
 
 /** Flag toggling the debugging */
 static int _debug_hdf;
@@ -63,9 +89,13 @@ static const char HLHDF_HBOOL_STR[]    = "hbool";     /**< 'hbool' */
 static const char HLHDF_STRING_STR[]   = "string";    /**< 'string' */
 static const char HLHDF_COMPOUND_STR[] = "compound";  /**< 'compound' */
 static const char HLHDF_ARRAY_STR[]    = "array";     /**< 'array' */
+static const char HLHDF_HALF_STR[]     = "half";      /**< 'half' */
+static const char HLHDF_BFLOAT16_STR[] = "bfloat16";  /**< 'bfloat16' */
 
 static char HLHDF_HDF5_VERSION_STRING[64];      /**< keeps the version string */
 
+static pthread_once_t versionOnce = PTHREAD_ONCE_INIT;
+
 static const char* VALID_FORMAT_SPECIFIERS[] = {
   HLHDF_UNDEFINED_STR,
   HLHDF_CHAR_STR,
@@ -89,21 +119,297 @@ static const char* VALID_FORMAT_SPECIFIERS[] = {
   HLHDF_STRING_STR,
   HLHDF_COMPOUND_STR,
   HLHDF_ARRAY_STR,
+  HLHDF_HALF_STR,
+  HLHDF_BFLOAT16_STR,
   NULL,
 };
 
+/**
+ * The size of the native type for each format specifier, indexed by
+ * @ref HL_FormatSpecifier. Formats without a native type have size 0.
+ */
+static const size_t NATIVE_FORMAT_SIZES[HLHDF_END_OF_SPECIFIERS] = {
+  0,                      /* HLHDF_UNDEFINED */
+  sizeof(char),           /* HLHDF_CHAR */
+  sizeof(signed char),    /* HLHDF_SCHAR */
+  sizeof(unsigned char),  /* HLHDF_UCHAR */
+  sizeof(short),          /* HLHDF_SHORT */
+  sizeof(unsigned short), /* HLHDF_USHORT */
+  sizeof(int),            /* HLHDF_INT */
+  sizeof(unsigned int),   /* HLHDF_UINT */
+  sizeof(long),           /* HLHDF_LONG */
+  sizeof(unsigned long),  /* HLHDF_ULONG */
+  sizeof(long long),      /* HLHDF_LLONG */
+  sizeof(unsigned long long), /* HLHDF_ULLONG */
+  sizeof(float),          /* HLHDF_FLOAT */
+  sizeof(double),         /* HLHDF_DOUBLE */
+  sizeof(long double),    /* HLHDF_LDOUBLE */
+  sizeof(hsize_t),        /* HLHDF_HSIZE */
+  sizeof(hssize_t),       /* HLHDF_HSSIZE */
+  sizeof(herr_t),         /* HLHDF_HERR */
+  sizeof(hbool_t),        /* HLHDF_HBOOL */
+  0,                      /* HLHDF_STRING */
+  0,                      /* HLHDF_COMPOUND */
+  0,                      /* HLHDF_ARRAY */
+  sizeof(unsigned short), /* HLHDF_HALF */
+  sizeof(unsigned short)  /* HLHDF_BFLOAT16 */
+};
+
+static pthread_once_t nativeTypesOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * The native type for each format specifier, indexed by @ref HL_FormatSpecifier.
+ * These are created once and shared by everyone translating a format, see
+ * @ref HL_translateFormatSpecifierToType.
+ */
+static hid_t sharedNativeTypes[HLHDF_END_OF_SPECIFIERS];
+
+/*@{ Private functions */
+#ifdef HLHDF_MEMORY_DEBUG
+static void hlhdf_dump_memory_information(void)
+{
+  hlhdf_alloc_dump_heap();
+  hlhdf_alloc_print_statistics();
+}
+#endif
+
+/**
+ * Creates the recursive mutex used as HDF5 lock.
+ */
+static void hlhdf_createHdf5Lock(void)
+{
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&hdf5Lock, &attr);
+  pthread_mutexattr_destroy(&attr);
+}
+
+/**
+ * A thread that held the lock at the fork does not exist in the child, and the
+ * forking thread has a new thread id there, so the lock is recreated. There is no
+ * prepare handler that takes the lock, since that would call into HDF5 from every
+ * fork of the process and block it while any thread is using HDF5.
+ * @ref HLNodeList_readMany stops the threads of the library and holds the lock
+ * itself when it forks.
+ */
+static void hlhdf_afterForkInChild(void)
+{
+  hlhdf_createHdf5Lock();
+}
+
+/**
+ * Creates the lock used for serializing the HDF5 calls.
+ */
+static void hlhdf_initializeHdf5Lock(void)
+{
+  hbool_t threadsafe = 0;
+  if (H5is_library_threadsafe(&threadsafe) >= 0 && threadsafe) {
+    hdf5Threadsafe = 1;
+  }
+  hlhdf_createHdf5Lock();
+  if (pthread_atfork(NULL, NULL, hlhdf_afterForkInChild) != 0) {
+    HL_ERROR0("Could not register fork handler for the HDF5 lock");
+  }
+}
+
+/**
+ * Returns the error reporting state that matches the automatic error handler of HDF5.
+ * A thread-safe HDF5 keeps the handler per thread, otherwise there is one handler for
+ * the whole process and the state is shared by all threads. Must be called with the
+ * HDF5 lock held.
+ * @return the error reporting state
+ */
+static HL_ErrorReportingState* hlhdf_getErrorState(void)
+{
+  return hdf5Threadsafe ? &threadErrorState : &processErrorState;
+}
+
+/**
+ * Disables the error reporting. Must be called with the HDF5 lock held.
+ */
+static void hlhdf_disableErrorReporting(void)
+{
+  HL_ErrorReportingState* errorState = hlhdf_getErrorState();
+  if (errorState->errorReportingOn == 1) {
+    H5Eget_auto2(H5E_DEFAULT, &errorState->errorFunction, &errorState->edata);
+    H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+    errorState->errorReportingOn = 0;
+  }
+}
+
+/**
+ * Installs the HLHDF error handler the first time HDF5 is accessed
+ * from a thread, or from the process when HDF5 not is thread-safe.
+ * Must be called with the HDF5 lock held.
+ */
+static void hlhdf_initializeErrorReporting(void)
+{
+  HL_ErrorReportingState* errorState = hlhdf_getErrorState();
+  if (errorState->initialized == 0) {
+    errorState->initialized = 1;
+    errorState->errorReportingOn = 1;
+    H5Eset_auto2(H5E_DEFAULT, HL_hdf5_debug_function, NULL); /* Force logging to always goto HLHDFs handler */
+    if (errorReportingDefault == 0) {
+      hlhdf_disableErrorReporting();
+    }
+  }
+}
+
+/**
+ * Initializes the process wide state, called once from @ref HL_init.
+ */
+static void hlhdf_initialize(void)
+{
+  _debug_hdf = 0;
+  HL_InitializeDebugger();
+  HL_enableHdf5ErrorReporting();
+  HLFilterPrivate_register();
+#ifdef HLHDF_MEMORY_DEBUG
+  if (atexit(hlhdf_dump_memory_information) != 0) {
+    HL_printf("Could not set atexit function");
+  }
+#endif
+}
+/**
+ * The layout of a 16 bit floating point format, see @ref hlhdf_createFloat16Type.
+ */
+typedef struct HL_Float16Layout {
+  HL_FormatSpecifier specifier; /**< the format */
+  size_t epos;                  /**< the position of the exponent */
+  size_t esize;                 /**< the number of bits in the exponent */
+  size_t msize;                 /**< the number of bits in the mantissa */
+  size_t ebias;                 /**< the exponent bias */
+} HL_Float16Layout;
+
+/**
+ * The 16 bit floating point formats. Both have the sign in bit 15 and the mantissa
+ * starting at bit 0.
+ */
+static const HL_Float16Layout FLOAT16_LAYOUTS[] = {
+  {HLHDF_HALF, 10, 5, 10, 15},
+  {HLHDF_BFLOAT16, 7, 8, 7, 127}
+};
+
+/**
+ * Creates the native HDF5 type of a 16 bit floating point format.
+ * @param[in] layout the layout of the format
+ * @return the type or -1 on failure
+ */
+static hid_t hlhdf_createFloat16Type(const HL_Float16Layout* layout)
+{
+  hid_t type = H5Tcopy(H5T_NATIVE_FLOAT);
+  if (type < 0 ||
+      H5Tset_fields(type, 15, layout->epos, layout->esize, 0, layout->msize) < 0 ||
+      H5Tset_size(type, 2) < 0 ||
+      H5Tset_ebias(type, layout->ebias) < 0) {
+    HL_ERROR1("Failed to create the %s type", VALID_FORMAT_SPECIFIERS[layout->specifier]);
+    HL_H5T_CLOSE(type);
+  }
+  return type;
+}
+
+/**
+ * Returns the layout of the 16 bit floating point format that a type has, regardless
+ * of the byte order.
+ * @param[in] type the type
+ * @return the layout or NULL if the type is not a 16 bit floating point format
+ */
+static const HL_Float16Layout* hlhdf_findFloat16Layout(hid_t type)
+{
+  size_t spos = 0, epos = 0, esize = 0, mpos = 0, msize = 0;
+  size_t i;
+  if (H5Tget_class(type) != H5T_FLOAT || H5Tget_size(type) != 2 || H5Tget_precision(type) != 16 ||
+      H5Tget_fields(type, &spos, &epos, &esize, &mpos, &msize) < 0 || spos != 15 || mpos != 0) {
+    return NULL;
+  }
+  for (i = 0; i < sizeof(FLOAT16_LAYOUTS) / sizeof(FLOAT16_LAYOUTS[0]); i++) {
+    if (epos == FLOAT16_LAYOUTS[i].epos && esize == FLOAT16_LAYOUTS[i].esize &&
+        msize == FLOAT16_LAYOUTS[i].msize && H5Tget_ebias(type) == FLOAT16_LAYOUTS[i].ebias) {
+      return &FLOAT16_LAYOUTS[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Creates the shared native types, called once from @ref HL_translateFormatSpecifierToType.
+ */
+static void hlhdf_createSharedNativeTypes(void)
+{
+  int i;
+  HL_lockHdf5();
+  for (i = 0; i < HLHDF_END_OF_SPECIFIERS; i++) {
+    sharedNativeTypes[i] = -1;
+  }
+  sharedNativeTypes[HLHDF_CHAR] = H5Tcopy(H5T_NATIVE_CHAR);
+  sharedNativeTypes[HLHDF_SCHAR] = H5Tcopy(H5T_NATIVE_SCHAR);
+  sharedNativeTypes[HLHDF_UCHAR] = H5Tcopy(H5T_NATIVE_UCHAR);
+  sharedNativeTypes[HLHDF_SHORT] = H5Tcopy(H5T_NATIVE_SHORT);
+  sharedNativeTypes[HLHDF_USHORT] = H5Tcopy(H5T_NATIVE_USHORT);
+  sharedNativeTypes[HLHDF_INT] = H5Tcopy(H5T_NATIVE_INT);
+  sharedNativeTypes[HLHDF_UINT] = H5Tcopy(H5T_NATIVE_UINT);
+  sharedNativeTypes[HLHDF_LONG] = H5Tcopy(H5T_NATIVE_LONG);
+  sharedNativeTypes[HLHDF_ULONG] = H5Tcopy(H5T_NATIVE_ULONG);
+  sharedNativeTypes[HLHDF_LLONG] = H5Tcopy(H5T_NATIVE_LLONG);
+  sharedNativeTypes[HLHDF_ULLONG] = H5Tcopy(H5T_NATIVE_ULLONG);
+  sharedNativeTypes[HLHDF_FLOAT] = H5Tcopy(H5T_NATIVE_FLOAT);
+  sharedNativeTypes[HLHDF_DOUBLE] = H5Tcopy(H5T_NATIVE_DOUBLE);
+  sharedNativeTypes[HLHDF_LDOUBLE] = H5Tcopy(H5T_NATIVE_LDOUBLE);
+  sharedNativeTypes[HLHDF_HSIZE] = H5Tcopy(H5T_NATIVE_HSIZE);
+  sharedNativeTypes[HLHDF_HSSIZE] = H5Tcopy(H5T_NATIVE_HSSIZE);
+  sharedNativeTypes[HLHDF_HERR] = H5Tcopy(H5T_NATIVE_HERR);
+  sharedNativeTypes[HLHDF_HBOOL] = H5Tcopy(H5T_NATIVE_HBOOL);
+  sharedNativeTypes[HLHDF_HALF] = hlhdf_createFloat16Type(&FLOAT16_LAYOUTS[0]);
+  sharedNativeTypes[HLHDF_BFLOAT16] = hlhdf_createFloat16Type(&FLOAT16_LAYOUTS[1]);
+  HL_unlockHdf5();
+}
+
+/**
+ * Formats the version string returned by @ref HL_getHDF5Version.
+ */
+static void hlhdf_formatHdf5Version(void)
+{
+  if (strcmp("", H5_VERS_SUBRELEASE)==0) {
+    snprintf(HLHDF_HDF5_VERSION_STRING, 64, "%d.%d.%d", H5_VERS_MAJOR, H5_VERS_MINOR, H5_VERS_RELEASE);
+  } else {
+    snprintf(HLHDF_HDF5_VERSION_STRING, 64, "%d.%d.%d-%s", H5_VERS_MAJOR, H5_VERS_MINOR, H5_VERS_RELEASE, H5_VERS_SUBRELEASE);
+  }
+}
+/*@} End of Private functions */
+
 /*@{ Interface functions */
+void HL_lockHdf5(void)
+{
+  pthread_once(&hdf5LockOnce, hlhdf_initializeHdf5Lock);
+  if (!hdf5Threadsafe) {
+    pthread_mutex_lock(&hdf5Lock);
+  }
+  hlhdf_initializeErrorReporting();
+}
+
+void HL_unlockHdf5(void)
+{
+  if (!hdf5Threadsafe) {
+    pthread_mutex_unlock(&hdf5Lock);
+  }
+}
+
+int HL_isHdf5Threadsafe(void)
+{
+  pthread_once(&hdf5LockOnce, hlhdf_initializeHdf5Lock);
+  return hdf5Threadsafe;
+}
+
 /************************************************
  * disableErrorReporting
  ***********************************************/
 void HL_disableErrorReporting(void)
 {
   /*Disable error reporting*/
-  if (errorReportingOn == 1) {
-    H5Eget_auto2(H5E_DEFAULT, &errorFunction, &edata);
-    H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
-    errorReportingOn = 0;
-  }
+  HL_lockHdf5();
+  hlhdf_disableErrorReporting();
+  HL_unlockHdf5();
 }
 
 /************************************************
@@ -111,43 +417,45 @@ void HL_disableErrorReporting(void)
  ***********************************************/
 void HL_enableErrorReporting(void)
 {
-  if (errorReportingOn == 0) {
-    H5Eset_auto2(H5E_DEFAULT, errorFunction, edata);
-    errorReportingOn = 1;
+  HL_ErrorReportingState* errorState = NULL;
+  HL_lockHdf5();
+  errorState = hlhdf_getErrorState();
+  if (errorState->errorReportingOn == 0) {
+    H5Eset_auto2(H5E_DEFAULT, errorState->errorFunction, errorState->edata);
+    errorState->errorReportingOn = 1;
   }
+  HL_unlockHdf5();
 }
 
 int HL_isErrorReportingEnabled(void)
 {
-  return errorReportingOn;
+  int result = 0;
+  HL_lockHdf5();
+  result = hlhdf_getErrorState()->errorReportingOn;
+  HL_unlockHdf5();
+  return result;
 }
 
-#ifdef HLHDF_MEMORY_DEBUG
-static void hlhdf_dump_memory_information(void)
+void HL_inheritErrorReporting(int errorReporting)
 {
-  hlhdf_alloc_dump_heap();
-  hlhdf_alloc_print_statistics();
+  if (!HL_isHdf5Threadsafe()) {
+    return;
+  }
+  if (errorReporting) {
+    HL_enableErrorReporting();
+  } else {
+    HL_disableErrorReporting();
+  }
 }
-#endif
 
 /************************************************
  * initHlHdf
  ***********************************************/
 void HL_init(void)
 {
-  if (initialized == 0) {
-    initialized = 1;
-    _debug_hdf = 0;
-    H5Eset_auto2(H5E_DEFAULT, HL_hdf5_debug_function, NULL); /* Force logging to always goto HLHDFs handler */
-    HL_InitializeDebugger();
-    HL_enableHdf5ErrorReporting();
-    HL_disableErrorReporting();
-#ifdef HLHDF_MEMORY_DEBUG
-    if (atexit(hlhdf_dump_memory_information) != 0) {
-      HL_printf("Could not set atexit function");
-    }
-#endif
-  }
+  pthread_once(&initializeOnce, hlhdf_initialize);
+  HL_lockHdf5();
+  HL_unlockHdf5();
 }
 
 /************************************************
@@ -158,16 +466,19 @@ void HL_setDebugMode(int flag)
   if (flag == 0) {
     /*Don't debug anything*/
     _debug_hdf = 0;
+    errorReportingDefault = 0;
     HL_setDebugLevel(HLHDF_SILENT);
     HL_disableErrorReporting();
   } else if (flag == 1) {
     /*Only debug HLHDF stuff*/
     _debug_hdf = 1;
+    errorReportingDefault = 0;
     HL_setDebugLevel(HLHDF_DEBUG);
     HL_disableErrorReporting();
   } else {
     /*Debug everything*/
     _debug_hdf = 1;
+    errorReportingDefault = 1;
     HL_setDebugLevel(HLHDF_DEBUG);
     HL_enableErrorReporting();
   }
@@ -178,8 +489,11 @@ void HL_setDebugMode(int flag)
  ***********************************************/
 int HL_isHDF5File(const char* filename)
 {
-  htri_t checkValue = H5Fis_hdf5(filename);
+  htri_t checkValue = -1;
   HL_DEBUG0("isHdf5File");
+  HL_lockHdf5();
+  checkValue = H5Fis_hdf5(filename);
+  HL_unlockHdf5();
   if (checkValue > 0)
     return TRUE;
   else
@@ -200,8 +514,10 @@ HL_FileCreationProperty* HLFileCreationProperty_new(void)
     return NULL;
   }
 
+  HL_lockHdf5();
   if ((theHid = H5Pcreate(H5P_FILE_CREATE)) < 0) {
     HL_ERROR0("Failure when creating the property list");
+    HL_unlockHdf5();
     HLHDF_FREE(retv);
     return NULL;
   }
@@ -244,10 +560,12 @@ HL_FileCreationProperty* HLFileCreationProperty_new(void)
     goto fail;
   }
   HL_H5P_CLOSE(theHid);
+  HL_unlockHdf5();
 
   return retv;
 fail:
   HL_H5P_CLOSE(theHid);
+  HL_unlockHdf5();
   HLFileCreationProperty_free(retv);
   return NULL;
 }
@@ -269,17 +587,21 @@ void HLFileCreationProperty_free(HL_FileCreationProperty* prop)
  **********************************************************/
 int HL_sizeOfFormat(const char* format)
 {
-  hid_t tmpType;
-  int size = -1;
+  HL_FormatSpecifier specifier = HL_getFormatSpecifier(format);
   HL_DEBUG0("ENTER: whatSizeIsHdfFormat");
-  tmpType = HL_translateFormatStringToDatatype(format);
-  if (tmpType < 0) {
+  if (NATIVE_FORMAT_SIZES[specifier] == 0) {
     HL_ERROR1("There is no type called %s",format);
     return -1;
   }
-  size = H5Tget_size(tmpType);
-  H5Tclose(tmpType);
-  return size;
+  return (int)NATIVE_FORMAT_SIZES[specifier];
+}
+
+size_t HL_sizeOfFormatSpecifier(HL_FormatSpecifier specifier)
+{
+  if (specifier <= HLHDF_UNDEFINED || specifier >= HLHDF_END_OF_SPECIFIERS) {
+    return 0;
+  }
+  return NATIVE_FORMAT_SIZES[specifier];
 }
 
 /**********************************************************
@@ -287,28 +609,69 @@ int HL_sizeOfFormat(const char* format)
  **********************************************************/
 int HL_isFormatSupported(const char* format)
 {
-  hid_t tmpHid = -1;
-  int retv = 1;
   HL_DEBUG0("ENTER: isFormatSupported");
-  if ((tmpHid = HL_translateFormatStringToDatatype(format)) < 0) {
-    retv = 0;
-  }
-  HL_H5T_CLOSE(tmpHid);
-  return retv;
+  return (NATIVE_FORMAT_SIZES[HL_getFormatSpecifier(format)] != 0);
 }
 
+/**
+ * Returns specifier if format is the name of specifier, otherwise HLHDF_UNDEFINED.
+ */
+#define HLHDF_MATCH_FORMAT(format, specifier) \
+  if (strcmp(format, VALID_FORMAT_SPECIFIERS[specifier]) == 0) return specifier
+
 HL_FormatSpecifier HL_getFormatSpecifier(const char* format)
 {
-  int i = 0;
   if (format == NULL) {
     HL_ERROR0("format NULL");
     return HLHDF_UNDEFINED;
   }
 
-  for ( i = HLHDF_UNDEFINED; i < HLHDF_END_OF_SPECIFIERS; i++) {
-    if (strcmp(format, VALID_FORMAT_SPECIFIERS[i]) == 0) {
-      return i;
-    }
+  switch (format[0]) {
+  case 'a':
+    HLHDF_MATCH_FORMAT(format, HLHDF_ARRAY);
+    break;
+  case 'b':
+    HLHDF_MATCH_FORMAT(format, HLHDF_BFLOAT16);
+    break;
+  case 'c':
+    HLHDF_MATCH_FORMAT(format, HLHDF_CHAR);
+    HLHDF_MATCH_FORMAT(format, HLHDF_COMPOUND);
+    break;
+  case 'd':
+    HLHDF_MATCH_FORMAT(format, HLHDF_DOUBLE);
+    break;
+  case 'f':
+    HLHDF_MATCH_FORMAT(format, HLHDF_FLOAT);
+    break;
+  case 'h':
+    HLHDF_MATCH_FORMAT(format, HLHDF_HSIZE);
+    HLHDF_MATCH_FORMAT(format, HLHDF_HSSIZE);
+    HLHDF_MATCH_FORMAT(format, HLHDF_HERR);
+    HLHDF_MATCH_FORMAT(format, HLHDF_HBOOL);
+    HLHDF_MATCH_FORMAT(format, HLHDF_HALF);
+    break;
+  case 'i':
+    HLHDF_MATCH_FORMAT(format, HLHDF_INT);
+    break;
+  case 'l':
+    HLHDF_MATCH_FORMAT(format, HLHDF_LONG);
+    HLHDF_MATCH_FORMAT(format, HLHDF_LLONG);
+    HLHDF_MATCH_FORMAT(format, HLHDF_LDOUBLE);
+    break;
+  case 's':
+    HLHDF_MATCH_FORMAT(format, HLHDF_SCHAR);
+    HLHDF_MATCH_FORMAT(format, HLHDF_SHORT);
+    HLHDF_MATCH_FORMAT(format, HLHDF_STRING);
+    break;
+  case 'u':
+    HLHDF_MATCH_FORMAT(format, HLHDF_UCHAR);
+    HLHDF_MATCH_FORMAT(format, HLHDF_USHORT);
+    HLHDF_MATCH_FORMAT(format, HLHDF_UINT);
+    HLHDF_MATCH_FORMAT(format, HLHDF_ULONG);
+    HLHDF_MATCH_FORMAT(format, HLHDF_ULLONG);
+    break;
+  default:
+    break;
   }
 
   return HLHDF_UNDEFINED;
@@ -323,11 +686,7 @@ const char* HL_getFormatSpecifierString(HL_FormatSpecifier specifier)
 }
 
 const char* HL_getHDF5Version(void) {
-  if (strcmp("", H5_VERS_SUBRELEASE)==0) {
-    snprintf(HLHDF_HDF5_VERSION_STRING, 64, "%d.%d.%d", H5_VERS_MAJOR, H5_VERS_MINOR, H5_VERS_RELEASE);
-  } else {
-    snprintf(HLHDF_HDF5_VERSION_STRING, 64, "%d.%d.%d-%s", H5_VERS_MAJOR, H5_VERS_MINOR, H5_VERS_RELEASE, H5_VERS_SUBRELEASE);
-  }
+  pthread_once(&versionOnce, hlhdf_formatHdf5Version);
   return HLHDF_HDF5_VERSION_STRING;
 }
 
@@ -365,6 +724,10 @@ HL_Compression* HLCompression_clone(HL_Compression* inv)
   retv->level = inv->level;
   retv->szlib_mask = inv->szlib_mask;
   retv->szlib_px_per_block = inv->szlib_px_per_block;
+  retv->summary_tile_size = inv->summary_tile_size;
+  retv->keep_bits = inv->keep_bits;
+  retv->keep_digits = inv->keep_digits;
+  retv->predictor = inv->predictor;
 fail:
   HL_SPEWDEBUG0("EXIT: dupHL_Compression");
   return retv;
@@ -384,6 +747,10 @@ void HLCompression_init(HL_Compression* inv, HL_CompressionType aType)
   inv->level = 6;
   inv->szlib_mask = H5_SZIP_ALLOW_K13_OPTION_MASK | H5_SZIP_EC_OPTION_MASK;
   inv->szlib_px_per_block = 16;
+  inv->summary_tile_size = 0;
+  inv->keep_bits = 0;
+  inv->keep_digits = 0;
+  inv->predictor = PT_NONE;
 }
 
 /**********************************************************
@@ -405,6 +772,8 @@ void HLCompression_free(HL_Compression* inv)
 hid_t openHlHdfFile(const char* filename, const char* how)
 {
   unsigned flags = H5F_ACC_RDWR;
+  hid_t fileId = -1;
+  double starttime = 0.0;
   HL_DEBUG2("ENTER: openHlHdfFile(%s,%s)", filename, how);
 
   if (strcmp(how, "r") == 0) {
@@ -416,7 +785,12 @@ hid_t openHlHdfFile(const char* filename, const char* how)
     return (hid_t) -1;
   }
   HL_DEBUG0("EXIT: openHlHdfFile");
-  return H5Fopen(filename, flags, H5P_DEFAULT);
+  starttime = HLStats_getTime();
+  fileId = H5Fopen(filename, flags, H5P_DEFAULT);
+  if (fileId >= 0) {
+    HLStats_fileOpened(starttime);
+  }
+  return fileId;
 }
 
 /************************************************
@@ -428,6 +802,7 @@ hid_t createHlHdfFile(const char* filename,
   hid_t propId = -1;
   hid_t fileId = -1;
   hid_t fileaccesspropertyId = -1;
+  double starttime = HLStats_getTime();
 
   HL_DEBUG0("ENTER: createHlHdfFile");
   if (property == NULL) {
@@ -478,21 +853,164 @@ hid_t createHlHdfFile(const char* filename,
       fileId = H5Fcreate(filename, H5F_ACC_TRUNC, propId, fileaccesspropertyId);
     } else {
       fileId = H5Fcreate(filename, H5F_ACC_TRUNC, propId, H5P_DEFAULT);
-      return fileId;
     }
   }
 
 done:
+  if (fileId >= 0) {
+    HLStats_fileOpened(starttime);
+  }
   HL_H5P_CLOSE(propId);
   HL_H5P_CLOSE(fileaccesspropertyId);
   HL_DEBUG0("EXIT: createHlHdfFile");
   return fileId;
 }
 
-/************************************************
- * getFixedType
- ***********************************************/
-hid_t getFixedType(hid_t type)
+/*@{ Native type cache */
+/**
+ * Max number of file types that are remembered by the native type cache.
+ */
+#define HLHDF_FIXED_TYPE_CACHE_SIZE 64
+
+/**
+ * A file type together with the native type that it was translated into.
+ */
+typedef struct HL_FixedTypeEntry {
+  hid_t filetype;      /**< a transient copy of the file type */
+  hid_t nativetype;    /**< the native type */
+  H5T_class_t tclass;  /**< the class of the file type, used for quick rejection */
+  size_t size;         /**< the size of the file type, used for quick rejection */
+} HL_FixedTypeEntry;
+
+/** The remembered file types */
+static HL_FixedTypeEntry fixedTypeCache[HLHDF_FIXED_TYPE_CACHE_SIZE];
+
+/** Number of used entries in @ref fixedTypeCache */
+static int fixedTypeCacheCount = 0;
+
+/** Next entry to replace when @ref fixedTypeCache is full */
+static int fixedTypeCacheNext = 0;
+
+/** Protects @ref fixedTypeCache */
+static pthread_mutex_t fixedTypeCacheLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Returns if the translation of the file type can be shared. Variable length
+ * types and references refers to the file they were read from so they are always
+ * translated.
+ * @param[in] type the file type
+ * @return 1 if the translation can be cached, otherwise 0
+ */
+static int hlhdf_isCacheableType(hid_t type)
+{
+  int result = 0;
+  switch (H5Tget_class(type)) {
+  case H5T_INTEGER:
+  case H5T_FLOAT:
+    result = 1;
+    break;
+  case H5T_STRING:
+    result = (H5Tis_variable_str(type) == 0);
+    break;
+  case H5T_COMPOUND: {
+    int nmembs = H5Tget_nmembers(type), i;
+    result = (nmembs > 0);
+    for (i = 0; result && i < nmembs; i++) {
+      hid_t mtype = H5Tget_member_type(type, i);
+      result = (mtype >= 0 && hlhdf_isCacheableType(mtype));
+      HL_H5T_CLOSE(mtype);
+    }
+    break;
+  }
+  case H5T_ARRAY: {
+    hid_t stype = H5Tget_super(type);
+    result = (stype >= 0 && hlhdf_isCacheableType(stype));
+    HL_H5T_CLOSE(stype);
+    break;
+  }
+  default:
+    break;
+  }
+  return result;
+}
+
+/**
+ * Looks up the native type for a file type that has been translated before.
+ * @param[in] type the file type
+ * @param[in] tclass the class of the file type
+ * @param[in] size the size of the file type
+ * @return a new reference to the shared native type or -1 if it has not been translated before
+ */
+static hid_t hlhdf_lookupFixedType(hid_t type, H5T_class_t tclass, size_t size)
+{
+  hid_t result = -1;
+  int i;
+  pthread_mutex_lock(&fixedTypeCacheLock);
+  for (i = 0; i < fixedTypeCacheCount; i++) {
+    HL_FixedTypeEntry* entry = &fixedTypeCache[i];
+    if (entry->tclass == tclass && entry->size == size && H5Tequal(entry->filetype, type) > 0) {
+      if (H5Iinc_ref(entry->nativetype) >= 0) {
+        result = entry->nativetype;
+      }
+      break;
+    }
+  }
+  pthread_mutex_unlock(&fixedTypeCacheLock);
+  return result;
+}
+
+/**
+ * Remembers the native type that a file type has been translated into. When the
+ * cache is full the oldest entry is replaced.
+ * @param[in] type the file type
+ * @param[in] tclass the class of the file type
+ * @param[in] size the size of the file type
+ * @param[in] mtype the native type, the cache keeps its own reference
+ */
+static void hlhdf_storeFixedType(hid_t type, H5T_class_t tclass, size_t size, hid_t mtype)
+{
+  HL_FixedTypeEntry* entry = NULL;
+  hid_t filetype = -1;
+  int i;
+
+  if ((filetype = H5Tcopy(type)) < 0) {
+    return;
+  }
+  pthread_mutex_lock(&fixedTypeCacheLock);
+  for (i = 0; i < fixedTypeCacheCount; i++) {
+    if (fixedTypeCache[i].tclass == tclass && fixedTypeCache[i].size == size &&
+        H5Tequal(fixedTypeCache[i].filetype, type) > 0) {
+      goto done; /* Another thread got here first */
+    }
+  }
+  if (H5Iinc_ref(mtype) < 0) {
+    goto done;
+  }
+  if (fixedTypeCacheCount < HLHDF_FIXED_TYPE_CACHE_SIZE) {
+    entry = &fixedTypeCache[fixedTypeCacheCount++];
+  } else {
+    entry = &fixedTypeCache[fixedTypeCacheNext];
+    fixedTypeCacheNext = (fixedTypeCacheNext + 1) % HLHDF_FIXED_TYPE_CACHE_SIZE;
+    HL_H5T_CLOSE(entry->filetype);
+    HL_H5T_CLOSE(entry->nativetype);
+  }
+  entry->filetype = filetype;
+  entry->nativetype = mtype;
+  entry->tclass = tclass;
+  entry->size = size;
+  filetype = -1;
+done:
+  pthread_mutex_unlock(&fixedTypeCacheLock);
+  HL_H5T_CLOSE(filetype);
+}
+/*@} End of Native type cache */
+
+/**
+ * Translates a file type into a native type without consulting the native type cache.
+ * @param[in] type the file type
+ * @return the native type or <0 on failure
+ */
+static hid_t hlhdf_createFixedType(hid_t type)
 {
   size_t size;
   hid_t mtype = -1;
@@ -505,7 +1023,8 @@ hid_t getFixedType(hid_t type)
   hid_t f_memb = -1;
   hid_t member_type;
   hid_t tmpt = -1;
-  HL_SPEWDEBUG0("ENTER: getFixedType, version > 1.4");
+  const HL_Float16Layout* layout = NULL;
+  HL_SPEWDEBUG0("ENTER: hlhdf_createFixedType");
 
   size = H5Tget_size(type);
 
@@ -526,7 +1045,9 @@ hid_t getFixedType(hid_t type)
     break;
   case H5T_FLOAT:
     HL_SPEWDEBUG0("This is of type H5T_FLOAT");
-    if (size <= sizeof(float))
+    if ((layout = hlhdf_findFloat16Layout(type)) != NULL)
+      mtype = hlhdf_createFloat16Type(layout);
+    else if (size <= sizeof(float))
       mtype = H5Tcopy(H5T_NATIVE_FLOAT);
     else if (size <= sizeof(double))
       mtype = H5Tcopy(H5T_NATIVE_DOUBLE);
@@ -698,73 +1219,39 @@ done:
   return mtype;
 }
 
+/************************************************
+ * getFixedType
+ ***********************************************/
+hid_t getFixedType(hid_t type)
+{
+  hid_t mtype = -1;
+  H5T_class_t tclass = H5Tget_class(type);
+  size_t size = H5Tget_size(type);
+
+  if ((mtype = hlhdf_lookupFixedType(type, tclass, size)) >= 0) {
+    return mtype; /* Only cacheable types are ever found */
+  }
+  mtype = hlhdf_createFixedType(type);
+  if (mtype >= 0 && hlhdf_isCacheableType(type)) {
+    hlhdf_storeFixedType(type, tclass, size, mtype);
+  }
+  return mtype;
+}
+
 hid_t HL_translateFormatSpecifierToType(HL_FormatSpecifier specifier)
 {
   hid_t retv = -1;
-  if (specifier <= HLHDF_UNDEFINED || specifier == HLHDF_STRING ||
-      specifier == HLHDF_COMPOUND || specifier == HLHDF_ARRAY) {
-    HL_ERROR0("Can not translate format=%d into a hdf5 datatype");
+  if (specifier <= HLHDF_UNDEFINED || specifier >= HLHDF_END_OF_SPECIFIERS ||
+      NATIVE_FORMAT_SIZES[specifier] == 0) {
+    HL_ERROR1("Can not translate format=%d into a hdf5 datatype", specifier);
     return -1;
   }
-  switch (specifier) {
-  case   HLHDF_CHAR:
-    retv = H5Tcopy(H5T_NATIVE_CHAR);
-    break;
-  case HLHDF_SCHAR:
-    retv = H5Tcopy(H5T_NATIVE_SCHAR);
-    break;
-  case HLHDF_UCHAR:
-    retv = H5Tcopy(H5T_NATIVE_UCHAR);
-    break;
-  case HLHDF_SHORT:
-    retv = H5Tcopy(H5T_NATIVE_SHORT);
-    break;
-  case HLHDF_USHORT:
-    retv = H5Tcopy(H5T_NATIVE_USHORT);
-    break;
-  case HLHDF_INT:
-    retv = H5Tcopy(H5T_NATIVE_INT);
-    break;
-  case HLHDF_UINT:
-    retv = H5Tcopy(H5T_NATIVE_UINT);
-    break;
-  case HLHDF_LONG:
-    retv = H5Tcopy(H5T_NATIVE_LONG);
-    break;
-  case HLHDF_ULONG:
-    retv = H5Tcopy(H5T_NATIVE_ULONG);
-    break;
-  case HLHDF_LLONG:
-    retv = H5Tcopy(H5T_NATIVE_LLONG);
-    break;
-  case HLHDF_ULLONG:
-    retv = H5Tcopy(H5T_NATIVE_ULLONG);
-    break;
-  case HLHDF_FLOAT:
-    retv = H5Tcopy(H5T_NATIVE_FLOAT);
-    break;
-  case HLHDF_DOUBLE:
-    retv = H5Tcopy(H5T_NATIVE_DOUBLE);
-    break;
-  case HLHDF_LDOUBLE:
-    retv = H5Tcopy(H5T_NATIVE_LDOUBLE);
-    break;
-  case HLHDF_HSIZE:
-    retv = H5Tcopy(H5T_NATIVE_HSIZE);
-    break;
-  case HLHDF_HSSIZE:
-    retv = H5Tcopy(H5T_NATIVE_HSSIZE);
-    break;
-  case HLHDF_HERR:
-    retv = H5Tcopy(H5T_NATIVE_HERR);
-    break;
-  case HLHDF_HBOOL:
-    retv = H5Tcopy(H5T_NATIVE_HBOOL);
-    break;
-  case HLHDF_END_OF_SPECIFIERS:
-  default:
-    break;
+  pthread_once(&nativeTypesOnce, hlhdf_createSharedNativeTypes);
+  HL_lockHdf5();
+  if (sharedNativeTypes[specifier] >= 0 && H5Iinc_ref(sharedNativeTypes[specifier]) >= 0) {
+    retv = sharedNativeTypes[specifier];
   }
+  HL_unlockHdf5();
   if (retv == -1) {
     HL_ERROR1("Could not determine hdf5 datatype from %d",specifier);
   }
@@ -897,6 +1384,7 @@ char* getTypeNameString(hid_t type)
  ***********************************************/
 HL_FormatSpecifier HL_getFormatSpecifierFromType(hid_t type)
 {
+  const HL_Float16Layout* layout = NULL;
   HL_SPEWDEBUG0("ENTER: getFormatNameString");
 
   if (H5Tget_class(type) == H5T_STRING) {
@@ -939,6 +1427,9 @@ HL_FormatSpecifier HL_getFormatSpecifierFromType(hid_t type)
     return HLHDF_HERR;
   else if (H5Tequal(type, H5T_NATIVE_HBOOL))
     return HLHDF_HBOOL;
+  else if ((layout = hlhdf_findFloat16Layout(type)) != NULL &&
+           H5Tget_order(type) == H5Tget_order(H5T_NATIVE_FLOAT))
+    return layout->specifier;
   else if (H5Tget_class(type) == H5T_COMPOUND)
     return HLHDF_COMPOUND;
   else if (H5Tget_class(type) == H5T_ARRAY)
@@ -1116,11 +1607,13 @@ int openGroupOrDataset(hid_t file_id, const char* name, hid_t* lid, HL_Type* typ
       HL_ERROR1("Node '%s' could not be opened", name);
       goto fail;
     }
+    HL_STATS_OBJECT_OPENED(*lid);
   } else {
     if ((*lid = H5Gopen(file_id, "/", H5P_DEFAULT)) < 0) {
       HL_ERROR0("Could not open root group");
       goto fail;
     }
+    HL_STATS_OBJECT_OPENED(*lid);
     *type = GROUP_ID;
   }
   status = 1;
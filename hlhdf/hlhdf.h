@@ -32,6 +32,7 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 #include "hlhdf_read.h"
 #include "hlhdf_write.h"
 #include "hlhdf_compound.h"
+#include "hlhdf_async.h"
 
 /**
  * Define for FALSE unless it already has been defined.
@@ -56,31 +57,63 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
  */
 
 /**
- * Disables error reporting.
+ * Disables error reporting for the calling thread. When HDF5 not is thread-safe,
+ * see @ref HL_isHdf5Threadsafe, HDF5 has one error handler for the whole process
+ * and the error reporting is changed for all threads.
  * @ingroup hlhdf_c_apis
  */
 void HL_disableErrorReporting(void);
 
 /**
- * Enables error reporting
+ * Enables error reporting for the calling thread. When HDF5 not is thread-safe,
+ * see @ref HL_isHdf5Threadsafe, HDF5 has one error handler for the whole process
+ * and the error reporting is changed for all threads.
  * @ingroup hlhdf_c_apis
  */
 void HL_enableErrorReporting(void);
 
 
 /**
- * Returns if error reporting is enabled or not.
+ * Returns if error reporting is enabled or not for the calling thread, or for the
+ * process when HDF5 not is thread-safe.
  * @ingroup hlhdf_c_apis
  */
 int HL_isErrorReportingEnabled(void);
 
 /**
- * Initializes the HLHDF handler functions.
+ * Initializes the HLHDF handler functions and registers the HDF5 filters of HLHDF,
+ * see @ref HLHDF_DELTA_FILTER.
  * <b>This always needs to be done before doing anything else when using HLHDF.</b>
  * @ingroup hlhdf_c_apis
  */
 void HL_init(void);
 
+/**
+ * Acquires the lock that serializes all calls into the HDF5 library. The lock
+ * is only taken when HDF5 not has been built thread-safe, otherwise this
+ * function only makes sure that the HLHDF error handler has been installed for
+ * the calling thread. The lock is recursive and every call must be matched by
+ * a call to @ref HL_unlockHdf5.
+ * All HLHDF functions that access HDF5 takes this lock internally, it is only
+ * needed when calling HDF5 directly from a threaded application.
+ * @ingroup hlhdf_c_apis
+ */
+void HL_lockHdf5(void);
+
+/**
+ * Releases the lock acquired with @ref HL_lockHdf5.
+ * @ingroup hlhdf_c_apis
+ */
+void HL_unlockHdf5(void);
+
+/**
+ * Returns if the HDF5 library has been built thread-safe or not. If not,
+ * all HDF5 access are serialized with @ref HL_lockHdf5.
+ * @ingroup hlhdf_c_apis
+ * @return TRUE if HDF5 is thread-safe, otherwise FALSE
+ */
+int HL_isHdf5Threadsafe(void);
+
 /**
  * Toggles the debug mode for HLHDF. Possible values of flag are:
  * <ul>
@@ -88,6 +121,8 @@ void HL_init(void);
  *   <li>1 = Debug only the HLHDF library</li>
  *   <li>2 = Debug both HLHDF and HDF5 library</li>
  * </ul>
+ * The debug level is process wide while the HDF5 error reporting is changed for the
+ * calling thread. Threads that access HDF5 the first time afterwards will use the same mode.
  * @ingroup hlhdf_c_apis
  * @param[in] flag the level of debugging
  */
@@ -186,4 +221,27 @@ void HLCompression_init(HL_Compression* inv,HL_CompressionType type);
  */
 void HLCompression_free(HL_Compression* inv);
 
+/**
+ * Returns the allocation and I/O statistics that has been collected by the
+ * calling thread since start or since the last call to @ref HL_resetStatistics.
+ * The counters are always active and cheap enough to be left on in production.
+ * Only what is done on the calling thread is counted, so I/O made by the asynchronous
+ * I/O thread, the prefetch threads and the workers of @ref HLNodeList_readMany is not
+ * included. Memory that is released by another thread than the one that allocated it
+ * is not tracked either, it stays in currentBytes of the allocating thread and is never
+ * subtracted below zero from the releasing thread.
+ * @ingroup hlhdf_c_apis
+ * @param[out] stats the structure to be filled in
+ * @return 1 on success, otherwise 0 (if stats is NULL)
+ */
+int HL_getStatistics(HL_Statistics* stats);
+
+/**
+ * Resets the statistics for the calling thread. Since memory allocated before
+ * the reset still is in use, currentBytes and peakBytes are kept at the number
+ * of bytes currently allocated.
+ * @ingroup hlhdf_c_apis
+ */
+void HL_resetStatistics(void);
+
 #endif
@@ -25,8 +25,23 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "hlhdf_alloc.h"
 #include "hlhdf_debug.h"
+#include "hlhdf_stats_private.h"
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+/**
+ * @brief Size of a block allocated with malloc
+ */
+#define HLHDF_BLOCK_SIZE(ptr, sz) malloc_usable_size(ptr)
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#define HLHDF_BLOCK_SIZE(ptr, sz) malloc_size(ptr)
+#else
+/* The block size can not be determined, use the requested size and let released blocks count as 0 bytes */
+#define HLHDF_BLOCK_SIZE(ptr, sz) (sz)
+#endif
 
 /**
  * Keeps track on one allocation.
@@ -49,6 +64,11 @@ typedef struct HlhdfHeap_t {
 
 static HlhdfHeap_t* hlhdf_heap = NULL;
 
+/**
+ * Protects the heap list and the counters since allocations are done from several threads.
+ */
+static pthread_mutex_t hlhdf_heap_lock = PTHREAD_MUTEX_INITIALIZER;
+
 static size_t number_of_allocations = 0;
 static size_t number_of_failed_allocations = 0;
 static size_t number_of_frees = 0;
@@ -183,12 +203,13 @@ static void hlhdf_alloc_releaseMemory(const char* filename, int lineno, HlhdfHea
   }
 }
 
-void* hlhdf_alloc_malloc(const char* filename, int lineno, size_t sz)
+static void* hlhdf_alloc_locked_malloc(const char* filename, int lineno, size_t sz)
 {
   HlhdfHeapEntry_t* entry = hlhdf_alloc_addHeapEntry(filename, lineno, sz);
   if (entry != NULL) {
     number_of_allocations++;
     total_heap_usage += sz;
+    HLStats_allocated(sz);
     return entry->b;
   } else {
     number_of_failed_allocations++;
@@ -197,13 +218,14 @@ void* hlhdf_alloc_malloc(const char* filename, int lineno, size_t sz)
   }
 }
 
-void* hlhdf_alloc_calloc(const char* filename, int lineno, size_t npts, size_t sz)
+static void* hlhdf_alloc_locked_calloc(const char* filename, int lineno, size_t npts, size_t sz)
 {
   HlhdfHeapEntry_t* entry = hlhdf_alloc_addHeapEntry(filename, lineno, npts*sz);
   if (entry != NULL) {
     if (entry->b != NULL) {
       total_heap_usage += npts*sz;
       number_of_allocations++;
+      HLStats_allocated(npts*sz);
       memset(entry->b, 0, npts*sz);
     } else {
       number_of_failed_allocations++;
@@ -217,12 +239,12 @@ void* hlhdf_alloc_calloc(const char* filename, int lineno, size_t npts, size_t s
   }
 }
 
-void* hlhdf_alloc_realloc(const char* filename, int lineno, void* ptr, size_t sz)
+static void* hlhdf_alloc_locked_realloc(const char* filename, int lineno, void* ptr, size_t sz)
 {
   HlhdfHeapEntry_t* entry = NULL;
   size_t oldsz = 0;
   if (ptr == NULL) {
-    return hlhdf_alloc_malloc(filename, lineno, sz);
+    return hlhdf_alloc_locked_malloc(filename, lineno, sz);
   }
   entry = hlhdf_alloc_findPointer(ptr);
   if (entry == NULL) {
@@ -236,6 +258,8 @@ void* hlhdf_alloc_realloc(const char* filename, int lineno, void* ptr, size_t sz
     HL_printf("HLHDF_MEMORY_CHECK: Failed to reallocate memory at %s:%d\n",filename,lineno);
   } else {
     number_of_reallocations++;
+    HLStats_released(oldsz);
+    HLStats_allocated(sz);
     if (sz > oldsz) {
       total_heap_usage += (sz - oldsz);
     } else {
@@ -245,7 +269,7 @@ void* hlhdf_alloc_realloc(const char* filename, int lineno, void* ptr, size_t sz
   return entry->b;
 }
 
-char* hlhdf_alloc_strdup(const char* filename, int lineno, const char* str)
+static char* hlhdf_alloc_locked_strdup(const char* filename, int lineno, const char* str)
 {
   size_t len = 0;
   HlhdfHeapEntry_t* entry = NULL;
@@ -260,6 +284,7 @@ char* hlhdf_alloc_strdup(const char* filename, int lineno, const char* str)
     if (entry->b != NULL) {
       total_heap_usage += len;
       number_of_strdup++;
+      HLStats_allocated(len);
       memcpy(entry->b, str, len);
     } else {
       number_of_failed_strdup++;
@@ -272,7 +297,7 @@ char* hlhdf_alloc_strdup(const char* filename, int lineno, const char* str)
   }
 }
 
-void hlhdf_alloc_free(const char* filename, int lineno, void* ptr)
+static void hlhdf_alloc_locked_free(const char* filename, int lineno, void* ptr)
 {
   HlhdfHeap_t* heapptr = hlhdf_heap;
   if (heapptr == NULL) {
@@ -289,6 +314,7 @@ void hlhdf_alloc_free(const char* filename, int lineno, void* ptr)
     if (heapptr->entry != NULL && heapptr->entry->b == ptr) {
       number_of_frees++;
       total_freed_heap_usage += heapptr->entry->sz;
+      HLStats_released(heapptr->entry->sz);
       hlhdf_alloc_releaseMemory(filename, lineno, heapptr);
       return;
     }
@@ -298,13 +324,103 @@ void hlhdf_alloc_free(const char* filename, int lineno, void* ptr)
   HL_printf("HLHDF_MEMORY_CHECK: Atempting to free something that not has been allocated: %s:%d\n", filename, lineno);
 }
 
+void* hlhdf_alloc_malloc(const char* filename, int lineno, size_t sz)
+{
+  void* result = NULL;
+  pthread_mutex_lock(&hlhdf_heap_lock);
+  result = hlhdf_alloc_locked_malloc(filename, lineno, sz);
+  pthread_mutex_unlock(&hlhdf_heap_lock);
+  return result;
+}
+
+void* hlhdf_alloc_calloc(const char* filename, int lineno, size_t npts, size_t sz)
+{
+  void* result = NULL;
+  pthread_mutex_lock(&hlhdf_heap_lock);
+  result = hlhdf_alloc_locked_calloc(filename, lineno, npts, sz);
+  pthread_mutex_unlock(&hlhdf_heap_lock);
+  return result;
+}
+
+void* hlhdf_alloc_realloc(const char* filename, int lineno, void* ptr, size_t sz)
+{
+  void* result = NULL;
+  pthread_mutex_lock(&hlhdf_heap_lock);
+  result = hlhdf_alloc_locked_realloc(filename, lineno, ptr, sz);
+  pthread_mutex_unlock(&hlhdf_heap_lock);
+  return result;
+}
+
+char* hlhdf_alloc_strdup(const char* filename, int lineno, const char* str)
+{
+  char* result = NULL;
+  pthread_mutex_lock(&hlhdf_heap_lock);
+  result = hlhdf_alloc_locked_strdup(filename, lineno, str);
+  pthread_mutex_unlock(&hlhdf_heap_lock);
+  return result;
+}
+
+void hlhdf_alloc_free(const char* filename, int lineno, void* ptr)
+{
+  pthread_mutex_lock(&hlhdf_heap_lock);
+  hlhdf_alloc_locked_free(filename, lineno, ptr);
+  pthread_mutex_unlock(&hlhdf_heap_lock);
+}
+
+void* hlhdf_alloc_stat_malloc(size_t sz)
+{
+  void* result = malloc(sz);
+  if (result != NULL) {
+    HLStats_allocated(HLHDF_BLOCK_SIZE(result, sz));
+  }
+  return result;
+}
+
+void* hlhdf_alloc_stat_calloc(size_t npts, size_t sz)
+{
+  void* result = calloc(npts, sz);
+  if (result != NULL) {
+    HLStats_allocated(HLHDF_BLOCK_SIZE(result, npts * sz));
+  }
+  return result;
+}
+
+void* hlhdf_alloc_stat_realloc(void* ptr, size_t sz)
+{
+  size_t oldsz = (ptr != NULL) ? HLHDF_BLOCK_SIZE(ptr, 0) : 0;
+  void* result = realloc(ptr, sz);
+  if (result != NULL) {
+    if (ptr != NULL) {
+      HLStats_released(oldsz);
+    }
+    HLStats_allocated(HLHDF_BLOCK_SIZE(result, sz));
+  }
+  return result;
+}
+
+char* hlhdf_alloc_stat_strdup(const char* str)
+{
+  char* result = strdup(str);
+  if (result != NULL) {
+    HLStats_allocated(HLHDF_BLOCK_SIZE(result, strlen(result) + 1));
+  }
+  return result;
+}
+
+void hlhdf_alloc_stat_free(void* ptr)
+{
+  if (ptr != NULL) {
+    HLStats_released(HLHDF_BLOCK_SIZE(ptr, 0));
+    free(ptr);
+  }
+}
+
 void hlhdf_alloc_dump_heap(void)
 {
-  HlhdfHeap_t* heapptr = hlhdf_heap;
+  HlhdfHeap_t* heapptr = NULL;
   int msgPrinted = 0;
-  if (heapptr == NULL) {
-    return;
-  }
+  pthread_mutex_lock(&hlhdf_heap_lock);
+  heapptr = hlhdf_heap;
   while (heapptr != NULL) {
     if (heapptr->entry != NULL) {
       if (!msgPrinted) {
@@ -315,13 +431,18 @@ void hlhdf_alloc_dump_heap(void)
     }
     heapptr = heapptr->next;
   }
+  pthread_mutex_unlock(&hlhdf_heap_lock);
 }
 
 void hlhdf_alloc_print_statistics(void)
 {
-  size_t totalNumberOfAllocations = number_of_allocations + number_of_strdup;
+  size_t totalNumberOfAllocations = 0;
   int maxNbrOfAllocs = 0;
-  HlhdfHeap_t* heapptr = hlhdf_heap;
+  HlhdfHeap_t* heapptr = NULL;
+
+  pthread_mutex_lock(&hlhdf_heap_lock);
+  totalNumberOfAllocations = number_of_allocations + number_of_strdup;
+  heapptr = hlhdf_heap;
 
   while (heapptr != NULL) {
     maxNbrOfAllocs++;
@@ -347,4 +468,5 @@ void hlhdf_alloc_print_statistics(void)
     HL_printf("Number of failed frees           : %ld\n", number_of_failed_frees);
   if (number_of_failed_strdup > 0)
     HL_printf("Number of failed strdup          : %ld\n", number_of_failed_strdup);
+  pthread_mutex_unlock(&hlhdf_heap_lock);
 }
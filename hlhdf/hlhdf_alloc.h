@@ -70,6 +70,38 @@ char* hlhdf_alloc_strdup(const char* filename, int lineno, const char* str);
  */
 void hlhdf_alloc_free(const char* filename, int lineno, void* ptr);
 
+/**
+ * Same as malloc but registers the allocation in the statistics.
+ * @param[in] sz the number of bytes to be allocated
+ */
+void* hlhdf_alloc_stat_malloc(size_t sz);
+
+/**
+ * Same as calloc but registers the allocation in the statistics.
+ * @param[in] npts number of points
+ * @param[in] sz the number of bytes to be allocated
+ */
+void* hlhdf_alloc_stat_calloc(size_t npts, size_t sz);
+
+/**
+ * Same as realloc but registers the allocation in the statistics.
+ * @param[in] ptr the original pointer
+ * @param[in] sz the number of bytes to be allocated
+ */
+void* hlhdf_alloc_stat_realloc(void* ptr, size_t sz);
+
+/**
+ * Same as strdup but registers the allocation in the statistics.
+ * @param[in] str the string to be duplicated
+ */
+char* hlhdf_alloc_stat_strdup(const char* str);
+
+/**
+ * Same as free but registers the release in the statistics.
+ * @param[in] ptr the pointer that should be freed
+ */
+void hlhdf_alloc_stat_free(void* ptr);
+
 /**
  * Dumps all blocks that not has been released.
  */
@@ -110,27 +142,27 @@ void hlhdf_alloc_print_statistics(void);
 /**
  * @brief malloc
  */
-#define HLHDF_MALLOC(sz) malloc(sz)
+#define HLHDF_MALLOC(sz) hlhdf_alloc_stat_malloc(sz)
 
 /**
  * @brief calloc
  */
-#define HLHDF_CALLOC(npts,sz) calloc(npts, sz)
+#define HLHDF_CALLOC(npts,sz) hlhdf_alloc_stat_calloc(npts, sz)
 
 /**
  * @brief realloc
  */
-#define HLHDF_REALLOC(ptr, sz) realloc(ptr, sz)
+#define HLHDF_REALLOC(ptr, sz) hlhdf_alloc_stat_realloc(ptr, sz)
 
 /**
  * @brief strdup
  */
-#define HLHDF_STRDUP(x) strdup(x)
+#define HLHDF_STRDUP(x) hlhdf_alloc_stat_strdup(x)
 
 /**
  * @brief Frees the pointer if != NULL
  */
-#define HLHDF_FREE(x) if (x != NULL) {free(x);x=NULL;}
+#define HLHDF_FREE(x) if (x != NULL) {hlhdf_alloc_stat_free(x);x=NULL;}
 
 #endif
 
@@ -0,0 +1,451 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * Asynchronous fetch, write and update of nodelists.
+ * @file
+ */
+#include "hlhdf.h"
+#include "hlhdf_alloc.h"
+#include "hlhdf_debug.h"
+#include "hlhdf_private.h"
+#include <string.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+/*@{ Typedefs */
+
+/**
+ * The kind of operation.
+ */
+typedef enum AsyncOperationType {
+  ASYNC_FETCH=0, /**< HLNodeList_fetchMarkedNodes */
+  ASYNC_WRITE,   /**< HLNodeList_write */
+  ASYNC_UPDATE   /**< HLNodeList_update */
+} AsyncOperationType;
+
+/**
+ * An asynchronous operation.
+ */
+struct _HL_AsyncOperation {
+  AsyncOperationType type;           /**< the kind of operation */
+  HL_NodeList* nodelist;             /**< the nodelist */
+  HL_FileCreationProperty* property; /**< copy of the file creation property, may be NULL */
+  HL_Compression* compression;       /**< copy of the compression, may be NULL */
+  HL_AsyncCallback callback;         /**< the callback, may be NULL */
+  void* userdata;                    /**< the user data passed to the callback */
+  int errorReporting;                /**< error reporting of the thread that started the operation */
+  HL_AsyncStatus status;             /**< the status */
+  int finished;                      /**< set when the final callback has been called */
+  int detached;                      /**< set when freed before finished */
+  struct _HL_AsyncOperation* next;   /**< next operation in the queue */
+};
+
+/*@} End of Typedefs */
+
+/*@{ Private variables */
+
+/**
+ * Protects the queue and the status of all operations.
+ */
+static pthread_mutex_t asyncLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Signalled when an operation has been queued.
+ */
+static pthread_cond_t asyncQueued = PTHREAD_COND_INITIALIZER;
+
+/**
+ * Signalled when an operation has finished.
+ */
+static pthread_cond_t asyncFinished = PTHREAD_COND_INITIALIZER;
+
+/**
+ * First operation in the queue.
+ */
+static HL_AsyncOperation* asyncQueueHead = NULL;
+
+/**
+ * Last operation in the queue.
+ */
+static HL_AsyncOperation* asyncQueueTail = NULL;
+
+/**
+ * The operation the I/O thread is running, NULL if none.
+ */
+static HL_AsyncOperation* asyncRunning = NULL;
+
+/**
+ * If the I/O thread has been started.
+ */
+static int asyncThreadStarted = 0;
+
+/**
+ * The I/O thread, valid if asyncThreadStarted is set.
+ */
+static pthread_t asyncThread;
+
+/**
+ * Number of callers that have suspended the I/O thread, see @ref HLAsyncPrivate_suspend.
+ */
+static int asyncSuspended = 0;
+
+/**
+ * Registers the fork handlers once.
+ */
+static pthread_once_t asyncForkOnce = PTHREAD_ONCE_INIT;
+
+/*@} End of Private variables */
+
+/*@{ Private functions */
+
+/**
+ * Releases all resources held by the operation.
+ * @param[in] op the operation
+ */
+static void HLAsyncOperation_destroy(HL_AsyncOperation* op)
+{
+  if (op != NULL) {
+    HLFileCreationProperty_free(op->property);
+    HLCompression_free(op->compression);
+    HLHDF_FREE(op);
+  }
+}
+
+/**
+ * Holds the queue lock over the fork so that the child gets a consistent queue.
+ */
+static void HLAsync_prepareFork(void)
+{
+  pthread_mutex_lock(&asyncLock);
+}
+
+static void HLAsync_afterForkInParent(void)
+{
+  pthread_mutex_unlock(&asyncLock);
+}
+
+/**
+ * The I/O thread does not exist in the child. The lock and conditions are
+ * reinitialized and the operations inherited from the parent, queued or running,
+ * are failed so that nobody waits for them in the child. Their callbacks are not
+ * called since they belong to the parent. The next operation in the child starts
+ * a new I/O thread.
+ */
+static void HLAsync_afterForkInChild(void)
+{
+  HL_AsyncOperation* op = asyncQueueHead;
+  pthread_mutex_init(&asyncLock, NULL);
+  pthread_cond_init(&asyncQueued, NULL);
+  pthread_cond_init(&asyncFinished, NULL);
+  if (asyncRunning != NULL) {
+    asyncRunning->next = op;
+    op = asyncRunning;
+  }
+  while (op != NULL) {
+    HL_AsyncOperation* next = op->next;
+    op->next = NULL;
+    op->status = HL_ASYNC_FAILED;
+    op->finished = 1;
+    if (op->detached) {
+      HLAsyncOperation_destroy(op);
+    }
+    op = next;
+  }
+  asyncQueueHead = asyncQueueTail = asyncRunning = NULL;
+  asyncThreadStarted = 0;
+  asyncSuspended = 0;
+}
+
+static void HLAsync_registerForkHandlers(void)
+{
+  pthread_atfork(HLAsync_prepareFork, HLAsync_afterForkInParent, HLAsync_afterForkInChild);
+}
+
+/**
+ * Runs the operation. The HDF5 lock is not held around the operation since the
+ * operation takes it itself, after it has waited for any prefetch of the nodelist
+ * that needs the lock to finish.
+ * @param[in] op the operation
+ * @return 1 on success, otherwise 0
+ */
+static int HLAsyncOperation_run(HL_AsyncOperation* op)
+{
+  int result = 0;
+  HL_inheritErrorReporting(op->errorReporting);
+  switch (op->type) {
+  case ASYNC_FETCH:
+    result = HLNodeList_fetchMarkedNodes(op->nodelist);
+    break;
+  case ASYNC_WRITE:
+    result = HLNodeList_write(op->nodelist, op->property, op->compression);
+    break;
+  case ASYNC_UPDATE:
+    result = HLNodeList_update(op->nodelist, op->compression);
+    break;
+  default:
+    HL_ERROR1("Unknown asynchronous operation %d", op->type);
+    break;
+  }
+  /* Nothing on this thread will report a left over error stack, clear it so that
+   * it does not outlive the operation and get in the way when HDF5 is closed. */
+  HL_lockHdf5();
+  H5Eclear2(H5E_DEFAULT);
+  HL_unlockHdf5();
+  return result;
+}
+
+/**
+ * The I/O thread. Runs the queued operations one at a time, in order.
+ * @param[in] arg not used
+ * @return never returns
+ */
+static void* HLAsync_thread(void* arg)
+{
+  for (;;) {
+    HL_AsyncOperation* op = NULL;
+    HL_AsyncStatus status = HL_ASYNC_CANCELLED;
+    int detached = 0;
+
+    pthread_mutex_lock(&asyncLock);
+    while (asyncQueueHead == NULL || asyncSuspended > 0) {
+      pthread_cond_wait(&asyncQueued, &asyncLock);
+    }
+    op = asyncQueueHead;
+    asyncQueueHead = op->next;
+    if (asyncQueueHead == NULL) {
+      asyncQueueTail = NULL;
+    }
+    op->next = NULL;
+    asyncRunning = op;
+    if (op->status == HL_ASYNC_PENDING) {
+      op->status = HL_ASYNC_RUNNING;
+    }
+    status = op->status;
+    pthread_mutex_unlock(&asyncLock);
+
+    if (status == HL_ASYNC_RUNNING) {
+      if (op->callback != NULL && !op->callback(op, HL_ASYNC_RUNNING, op->userdata)) {
+        status = HL_ASYNC_CANCELLED;
+      } else {
+        status = HLAsyncOperation_run(op) ? HL_ASYNC_DONE : HL_ASYNC_FAILED;
+      }
+      pthread_mutex_lock(&asyncLock);
+      op->status = status;
+      pthread_mutex_unlock(&asyncLock);
+    }
+
+    if (op->callback != NULL) {
+      op->callback(op, status, op->userdata);
+    }
+
+    pthread_mutex_lock(&asyncLock);
+    op->finished = 1;
+    detached = op->detached;
+    asyncRunning = NULL;
+    pthread_cond_broadcast(&asyncFinished);
+    pthread_mutex_unlock(&asyncLock);
+
+    if (detached) {
+      HLAsyncOperation_destroy(op);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Queues the operation and starts the I/O thread if it not is running. On failure the
+ * operation is destroyed.
+ * @param[in] op the operation
+ * @return the operation or NULL on failure
+ */
+static HL_AsyncOperation* HLAsync_submit(HL_AsyncOperation* op)
+{
+  pthread_once(&asyncForkOnce, HLAsync_registerForkHandlers);
+  pthread_mutex_lock(&asyncLock);
+  if (!asyncThreadStarted) {
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if (pthread_create(&asyncThread, &attr, HLAsync_thread, NULL) != 0) {
+      pthread_attr_destroy(&attr);
+      pthread_mutex_unlock(&asyncLock);
+      HL_ERROR0("Failed to start I/O thread");
+      HLAsyncOperation_destroy(op);
+      return NULL;
+    }
+    pthread_attr_destroy(&attr);
+    asyncThreadStarted = 1;
+  }
+  if (asyncQueueTail != NULL) {
+    asyncQueueTail->next = op;
+  } else {
+    asyncQueueHead = op;
+  }
+  asyncQueueTail = op;
+  pthread_cond_signal(&asyncQueued);
+  pthread_mutex_unlock(&asyncLock);
+  return op;
+}
+
+/**
+ * Creates an operation.
+ * @param[in] type the kind of operation
+ * @param[in] nodelist the nodelist
+ * @param[in] property the file creation property, may be NULL
+ * @param[in] compr the compression, may be NULL
+ * @param[in] callback the callback, may be NULL
+ * @param[in] userdata the user data
+ * @return the operation or NULL on failure
+ */
+static HL_AsyncOperation* HLAsyncOperation_new(AsyncOperationType type, HL_NodeList* nodelist,
+  HL_FileCreationProperty* property, HL_Compression* compr, HL_AsyncCallback callback, void* userdata)
+{
+  HL_AsyncOperation* retv = NULL;
+
+  if (nodelist == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return NULL;
+  }
+  if ((retv = HLHDF_MALLOC(sizeof(HL_AsyncOperation))) == NULL) {
+    HL_ERROR0("Failed to allocate memory for asynchronous operation");
+    return NULL;
+  }
+  memset(retv, 0, sizeof(HL_AsyncOperation));
+  retv->type = type;
+  retv->nodelist = nodelist;
+  retv->callback = callback;
+  retv->userdata = userdata;
+  retv->errorReporting = HL_isErrorReportingEnabled();
+  retv->status = HL_ASYNC_PENDING;
+
+  if (property != NULL) {
+    if ((retv->property = HLHDF_MALLOC(sizeof(HL_FileCreationProperty))) == NULL) {
+      HL_ERROR0("Failed to copy file creation property");
+      goto fail;
+    }
+    memcpy(retv->property, property, sizeof(HL_FileCreationProperty));
+  }
+  if (compr != NULL && (retv->compression = HLCompression_clone(compr)) == NULL) {
+    HL_ERROR0("Failed to copy compression");
+    goto fail;
+  }
+  return retv;
+fail:
+  HLAsyncOperation_destroy(retv);
+  return NULL;
+}
+
+void HLAsyncPrivate_suspend(void)
+{
+  pthread_mutex_lock(&asyncLock);
+  asyncSuspended++;
+  /* Called from a callback, the operation is the caller itself */
+  if (!asyncThreadStarted || !pthread_equal(pthread_self(), asyncThread)) {
+    while (asyncRunning != NULL) {
+      pthread_cond_wait(&asyncFinished, &asyncLock);
+    }
+  }
+  pthread_mutex_unlock(&asyncLock);
+}
+
+void HLAsyncPrivate_resume(void)
+{
+  pthread_mutex_lock(&asyncLock);
+  asyncSuspended--;
+  pthread_cond_broadcast(&asyncQueued);
+  pthread_mutex_unlock(&asyncLock);
+}
+/*@} End of Private functions */
+
+/*@{ Interface functions */
+HL_AsyncOperation* HLNodeList_fetchMarkedNodesAsync(HL_NodeList* nodelist, HL_AsyncCallback callback, void* userdata)
+{
+  HL_AsyncOperation* op = HLAsyncOperation_new(ASYNC_FETCH, nodelist, NULL, NULL, callback, userdata);
+  return (op != NULL) ? HLAsync_submit(op) : NULL;
+}
+
+HL_AsyncOperation* HLNodeList_writeAsync(HL_NodeList* nodelist, HL_FileCreationProperty* property,
+  HL_Compression* compr, HL_AsyncCallback callback, void* userdata)
+{
+  HL_AsyncOperation* op = HLAsyncOperation_new(ASYNC_WRITE, nodelist, property, compr, callback, userdata);
+  return (op != NULL) ? HLAsync_submit(op) : NULL;
+}
+
+HL_AsyncOperation* HLNodeList_updateAsync(HL_NodeList* nodelist, HL_Compression* compr,
+  HL_AsyncCallback callback, void* userdata)
+{
+  HL_AsyncOperation* op = HLAsyncOperation_new(ASYNC_UPDATE, nodelist, NULL, compr, callback, userdata);
+  return (op != NULL) ? HLAsync_submit(op) : NULL;
+}
+
+HL_AsyncStatus HLAsyncOperation_poll(HL_AsyncOperation* op)
+{
+  HL_AsyncStatus status = HL_ASYNC_PENDING;
+  HL_ASSERT((op != NULL), "HLAsyncOperation_poll called with op == NULL");
+  pthread_mutex_lock(&asyncLock);
+  status = op->status;
+  pthread_mutex_unlock(&asyncLock);
+  return status;
+}
+
+HL_AsyncStatus HLAsyncOperation_wait(HL_AsyncOperation* op)
+{
+  HL_AsyncStatus status = HL_ASYNC_PENDING;
+  HL_ASSERT((op != NULL), "HLAsyncOperation_wait called with op == NULL");
+  pthread_mutex_lock(&asyncLock);
+  while (!op->finished) {
+    pthread_cond_wait(&asyncFinished, &asyncLock);
+  }
+  status = op->status;
+  pthread_mutex_unlock(&asyncLock);
+  return status;
+}
+
+int HLAsyncOperation_cancel(HL_AsyncOperation* op)
+{
+  int result = 0;
+  HL_ASSERT((op != NULL), "HLAsyncOperation_cancel called with op == NULL");
+  pthread_mutex_lock(&asyncLock);
+  if (op->status == HL_ASYNC_PENDING) {
+    op->status = HL_ASYNC_CANCELLED;
+    result = 1;
+  }
+  pthread_mutex_unlock(&asyncLock);
+  return result;
+}
+
+void HLAsyncOperation_free(HL_AsyncOperation* op)
+{
+  int finished = 0;
+  if (op == NULL) {
+    return;
+  }
+  pthread_mutex_lock(&asyncLock);
+  if (op->status == HL_ASYNC_PENDING) {
+    op->status = HL_ASYNC_CANCELLED;
+  }
+  finished = op->finished;
+  op->detached = 1;
+  pthread_mutex_unlock(&asyncLock);
+  if (finished) {
+    HLAsyncOperation_destroy(op);
+  }
+}
+/*@} End of Interface functions */
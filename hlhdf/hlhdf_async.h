@@ -0,0 +1,102 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * Asynchronous fetch, write and update of nodelists. The operations are queued
+ * and performed in order by an internal I/O thread. The nodelist may not be used
+ * by the caller until the operation has finished. In a child process created with
+ * fork, the operations inherited from the parent have failed without their callbacks
+ * being called, and new operations are performed by a new I/O thread.
+ * @file
+ */
+#ifndef HLHDF_ASYNC_H
+#define HLHDF_ASYNC_H
+#include "hlhdf_types.h"
+
+/**
+ * Asynchronous variant of @ref HLNodeList_fetchMarkedNodes.
+ * @ingroup hlhdf_c_apis
+ * @param[in] nodelist the node list
+ * @param[in] callback called on the I/O thread when the status changes, may be NULL
+ * @param[in] userdata passed on to the callback
+ * @return the operation or NULL on failure. Release with @ref HLAsyncOperation_free.
+ */
+HL_AsyncOperation* HLNodeList_fetchMarkedNodesAsync(HL_NodeList* nodelist, HL_AsyncCallback callback, void* userdata);
+
+/**
+ * Asynchronous variant of @ref HLNodeList_write. The property and compression are
+ * copied so they may be released directly after the call.
+ * @ingroup hlhdf_c_apis
+ * @param[in] nodelist the node list
+ * @param[in] property the file creation property, may be NULL
+ * @param[in] compr the compression, may be NULL
+ * @param[in] callback called on the I/O thread when the status changes, may be NULL
+ * @param[in] userdata passed on to the callback
+ * @return the operation or NULL on failure. Release with @ref HLAsyncOperation_free.
+ */
+HL_AsyncOperation* HLNodeList_writeAsync(HL_NodeList* nodelist, HL_FileCreationProperty* property,
+  HL_Compression* compr, HL_AsyncCallback callback, void* userdata);
+
+/**
+ * Asynchronous variant of @ref HLNodeList_update. The compression is copied so it may
+ * be released directly after the call.
+ * @ingroup hlhdf_c_apis
+ * @param[in] nodelist the node list
+ * @param[in] compr the compression, may be NULL
+ * @param[in] callback called on the I/O thread when the status changes, may be NULL
+ * @param[in] userdata passed on to the callback
+ * @return the operation or NULL on failure. Release with @ref HLAsyncOperation_free.
+ */
+HL_AsyncOperation* HLNodeList_updateAsync(HL_NodeList* nodelist, HL_Compression* compr,
+  HL_AsyncCallback callback, void* userdata);
+
+/**
+ * Returns the current status of the operation without blocking.
+ * @ingroup hlhdf_c_apis
+ * @param[in] op the operation
+ * @return the status
+ */
+HL_AsyncStatus HLAsyncOperation_poll(HL_AsyncOperation* op);
+
+/**
+ * Waits until the operation has finished, including the final call to the callback.
+ * @ingroup hlhdf_c_apis
+ * @param[in] op the operation
+ * @return the final status, HL_ASYNC_DONE, HL_ASYNC_FAILED or HL_ASYNC_CANCELLED
+ */
+HL_AsyncStatus HLAsyncOperation_wait(HL_AsyncOperation* op);
+
+/**
+ * Cancels the operation if it not has been started yet. An operation that is running
+ * can not be cancelled since that would leave the file in an undefined state.
+ * @ingroup hlhdf_c_apis
+ * @param[in] op the operation
+ * @return 1 if the operation was cancelled, otherwise 0
+ */
+int HLAsyncOperation_cancel(HL_AsyncOperation* op);
+
+/**
+ * Releases the operation. If it not has finished, it is cancelled if possible and
+ * released by the I/O thread when it has finished, so this function never blocks.
+ * @ingroup hlhdf_c_apis
+ * @param[in] op the operation, may be NULL
+ */
+void HLAsyncOperation_free(HL_AsyncOperation* op);
+
+#endif /* HLHDF_ASYNC_H */
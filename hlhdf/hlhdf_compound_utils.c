@@ -39,7 +39,9 @@ hid_t createCompoundType(size_t size)
   hid_t retv = -1;
   HL_SPEWDEBUG0("ENTER: createCompoundType");
 
+  HL_lockHdf5();
   retv =  H5Tcreate(H5T_COMPOUND, size);
+  HL_unlockHdf5();
 
   HL_SPEWDEBUG0("EXIT: createCompoundType");
   return retv;
@@ -51,7 +53,9 @@ herr_t addAttributeToCompoundType(hid_t loc_id, const char* name,
   herr_t retv = -1;
   HL_SPEWDEBUG0("ENTER: addAttributeToCompoundType");
 
+  HL_lockHdf5();
   retv = H5Tinsert(loc_id, name, offset, type_id);
+  HL_unlockHdf5();
 
   HL_SPEWDEBUG0("EXIT: addAttributeToCompoundType");
   return retv;
@@ -61,8 +65,10 @@ herr_t addAttributeToCompoundType_fmt(hid_t loc_id, const char* name,
   size_t offset, const char* fmt)
 {
   herr_t status = -1;
-  hid_t type_id = HL_translateFormatStringToDatatype(fmt);
+  hid_t type_id = -1;
   HL_SPEWDEBUG0("ENTER: addAttributeToCompoundType_fmt");
+  HL_lockHdf5();
+  type_id = HL_translateFormatStringToDatatype(fmt);
   if (type_id < 0) {
     goto fail;
   }
@@ -70,6 +76,7 @@ herr_t addAttributeToCompoundType_fmt(hid_t loc_id, const char* name,
 
 fail:
   HL_H5T_CLOSE(type_id);
+  HL_unlockHdf5();
   HL_SPEWDEBUG0("EXIT: addAttributeToCompoundType_fmt");
   return status;
 }
@@ -92,11 +99,13 @@ herr_t addArrayToCompoundType(hid_t loc_id, const char* name, size_t offset,
     dims_hsize_t[i] = dims[i];
   }
 
+  HL_lockHdf5();
   array_type = H5Tarray_create(type_id, ndims, dims_hsize_t);
   status = H5Tinsert(loc_id, name, offset, array_type);
+  HL_H5T_CLOSE(array_type);
+  HL_unlockHdf5();
 
 fail:
-  HL_H5T_CLOSE(array_type);
   HLHDF_FREE(dims_hsize_t);
   HL_SPEWDEBUG0("EXIT: addArrayToCompoundType");
   return status;
@@ -108,6 +117,7 @@ herr_t addArrayToCompoundType_fmt(hid_t loc_id, const char* name,
   hid_t type_id = -1;
   herr_t status = -1;
   HL_SPEWDEBUG0("ENTER: addArrayToCompoundType_fmt");
+  HL_lockHdf5();
   type_id = HL_translateFormatStringToDatatype(fmt);
   if (type_id < 0) {
     goto fail;
@@ -117,6 +127,7 @@ herr_t addArrayToCompoundType_fmt(hid_t loc_id, const char* name,
 
 fail:
   HL_H5T_CLOSE(type_id);
+  HL_unlockHdf5();
   HL_SPEWDEBUG0("EXIT: addArrayToCompoundType_fmt");
   return status;
 }
@@ -0,0 +1,936 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * Conversion and statistics kernels for the numeric formats.
+ *
+ * There is one kernel per pair of formats, each a plain loop over restrict
+ * qualified arrays that the compiler vectorizes. With GCC on x86 the kernels
+ * are compiled a second time for AVX2 and picked at runtime when the CPU
+ * supports it, otherwise the baseline (SSE2 on x86_64) kernels are used.
+ * The 16 bit floating point formats are converted through float, with the
+ * F16C instructions in the AVX2 kernels.
+ * @file
+ */
+#include "hlhdf.h"
+#include "hlhdf_private.h"
+#include "hlhdf_convert_private.h"
+#include "hlhdf_debug.h"
+#include <string.h>
+#include <limits.h>
+#include <float.h>
+#include <stdint.h>
+#include <math.h>
+#include <pthread.h>
+
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+/**
+ * If the kernels should be compiled for AVX2 as well
+ */
+#define HLHDF_AVX2_KERNELS
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+/* The kernels never look at the floating point exception flags. Without this, comparisons
+ * of floating point values are not if-converted since they might trap, which prevents
+ * the loops from being vectorized. */
+#pragma GCC optimize("no-trapping-math")
+#endif
+
+#if defined(__GNUC__)
+#define HLHDF_RESTRICT __restrict__
+#else
+#define HLHDF_RESTRICT
+#endif
+
+/*@{ Value conversions */
+/**
+ * Converts floating point v into an integer type, saturating at the limits
+ * and translating NaN into 0.
+ */
+#define HLHDF_CLAMP_REAL(v, dtype, dmin, dmax) \
+  return ((v) != (v)) ? (dtype)0 : ((v) <= (dmin)) ? (dtype)(dmin) : ((v) >= (dmax)) ? (dtype)(dmax) : (dtype)(v)
+
+/**
+ * Defines the conversions into an integer type from the signed integer (I),
+ * unsigned integer (U), float (f), double (d) and long double (l) classes.
+ */
+#define HLHDF_INTEGER_CONVERTERS(dname, dtype, dmin, dmax) \
+  static inline dtype hlconv_##dname##_I(long long v) { \
+    return (v < (long long)(dmin)) ? (dtype)(dmin) : \
+           (v > 0 && (unsigned long long)v > (unsigned long long)(dmax)) ? (dtype)(dmax) : (dtype)v; \
+  } \
+  static inline dtype hlconv_##dname##_U(unsigned long long v) { \
+    return (v > (unsigned long long)(dmax)) ? (dtype)(dmax) : (dtype)v; \
+  } \
+  static inline dtype hlconv_##dname##_f(float v) { HLHDF_CLAMP_REAL(v, dtype, dmin, dmax); } \
+  static inline dtype hlconv_##dname##_d(double v) { HLHDF_CLAMP_REAL(v, dtype, dmin, dmax); } \
+  static inline dtype hlconv_##dname##_l(long double v) { HLHDF_CLAMP_REAL(v, dtype, dmin, dmax); }
+
+/**
+ * Defines the conversions into a floating point type, see @ref HLHDF_INTEGER_CONVERTERS.
+ */
+#define HLHDF_REAL_CONVERTERS(dname, dtype) \
+  static inline dtype hlconv_##dname##_I(long long v) { return (dtype)v; } \
+  static inline dtype hlconv_##dname##_U(unsigned long long v) { return (dtype)v; } \
+  static inline dtype hlconv_##dname##_f(float v) { return (dtype)v; } \
+  static inline dtype hlconv_##dname##_d(double v) { return (dtype)v; } \
+  static inline dtype hlconv_##dname##_l(long double v) { return (dtype)v; }
+
+/**
+ * Defines the conversions into a boolean type, see @ref HLHDF_INTEGER_CONVERTERS.
+ */
+#define HLHDF_BOOL_CONVERTERS(dname, dtype) \
+  static inline dtype hlconv_##dname##_I(long long v) { return (dtype)(v != 0); } \
+  static inline dtype hlconv_##dname##_U(unsigned long long v) { return (dtype)(v != 0); } \
+  static inline dtype hlconv_##dname##_f(float v) { return (dtype)(v != 0); } \
+  static inline dtype hlconv_##dname##_d(double v) { return (dtype)(v != 0); } \
+  static inline dtype hlconv_##dname##_l(long double v) { return (dtype)(v != 0); }
+
+HLHDF_INTEGER_CONVERTERS(char, char, CHAR_MIN, CHAR_MAX)
+HLHDF_INTEGER_CONVERTERS(schar, signed char, SCHAR_MIN, SCHAR_MAX)
+HLHDF_INTEGER_CONVERTERS(uchar, unsigned char, 0, UCHAR_MAX)
+HLHDF_INTEGER_CONVERTERS(short, short, SHRT_MIN, SHRT_MAX)
+HLHDF_INTEGER_CONVERTERS(ushort, unsigned short, 0, USHRT_MAX)
+HLHDF_INTEGER_CONVERTERS(int, int, INT_MIN, INT_MAX)
+HLHDF_INTEGER_CONVERTERS(uint, unsigned int, 0, UINT_MAX)
+HLHDF_INTEGER_CONVERTERS(long, long, LONG_MIN, LONG_MAX)
+HLHDF_INTEGER_CONVERTERS(ulong, unsigned long, 0, ULONG_MAX)
+HLHDF_INTEGER_CONVERTERS(llong, long long, LLONG_MIN, LLONG_MAX)
+HLHDF_INTEGER_CONVERTERS(ullong, unsigned long long, 0, ULLONG_MAX)
+HLHDF_REAL_CONVERTERS(float, float)
+HLHDF_REAL_CONVERTERS(double, double)
+HLHDF_REAL_CONVERTERS(ldouble, long double)
+/* hsize_t and hssize_t are 64 bit integers in HDF5 1.8 and later */
+HLHDF_INTEGER_CONVERTERS(hsize, hsize_t, 0, ULLONG_MAX)
+HLHDF_INTEGER_CONVERTERS(hssize, hssize_t, LLONG_MIN, LLONG_MAX)
+HLHDF_INTEGER_CONVERTERS(herr, herr_t, INT_MIN, INT_MAX)
+HLHDF_BOOL_CONVERTERS(hbool, hbool_t)
+
+/**
+ * Type punning between the bits of a float and the float.
+ */
+typedef union {
+  unsigned int u;
+  float f;
+} HL_FloatBits;
+
+/**
+ * Converts a half precision bit pattern into a float. Subnormals become normal floats by
+ * the multiplication and infinity and NaN get the maximum exponent.
+ */
+static inline float hlconv_unpack_half(unsigned short h)
+{
+  const HL_FloatBits magic = { (254U - 15U) << 23 };
+  const HL_FloatBits infnan = { (127U + 16U) << 23 };
+  HL_FloatBits o;
+  o.u = (unsigned int)(h & 0x7fffU) << 13;
+  o.f *= magic.f;
+  o.u |= (o.f >= infnan.f) ? (255U << 23) : 0U;
+  o.u |= (unsigned int)(h & 0x8000U) << 16;
+  return o.f;
+}
+
+/**
+ * Converts a float into a half precision bit pattern, rounding to nearest even. Values
+ * too large become infinity and NaN becomes a quiet NaN. Written as selects only.
+ */
+static inline unsigned short hlconv_pack_half(float f)
+{
+  const HL_FloatBits denormMagic = { ((127U - 15U) + (23U - 10U) + 1U) << 23 };
+  HL_FloatBits v, d;
+  unsigned int sign, special, subnormal, normal;
+  v.f = f;
+  sign = v.u & 0x80000000U;
+  v.u ^= sign;
+  special = (v.u > (255U << 23)) ? 0x7e00U : 0x7c00U;
+  d.f = v.f + denormMagic.f;
+  subnormal = d.u - denormMagic.u;
+  normal = (v.u - (112U << 23) + 0xfffU + ((v.u >> 13) & 1U)) >> 13;
+  return (unsigned short)(((v.u >= ((127U + 16U) << 23)) ? special : (v.u < (113U << 23)) ? subnormal : normal) |
+                          (sign >> 16));
+}
+
+/**
+ * Converts a bfloat16 bit pattern into a float.
+ */
+static inline float hlconv_unpack_bfloat16(unsigned short b)
+{
+  HL_FloatBits o;
+  o.u = (unsigned int)b << 16;
+  return o.f;
+}
+
+/**
+ * Converts a float into a bfloat16 bit pattern, rounding to nearest even. NaN stays a
+ * quiet NaN.
+ */
+static inline unsigned short hlconv_pack_bfloat16(float f)
+{
+  HL_FloatBits v;
+  unsigned int rounded, quiet;
+  v.f = f;
+  rounded = (v.u + 0x7fffU + ((v.u >> 16) & 1U)) >> 16;
+  quiet = (v.u >> 16) | 0x40U;
+  return (unsigned short)(((v.u & 0x7fffffffU) > 0x7f800000U) ? quiet : rounded);
+}
+/*@} End of Value conversions */
+
+/*@{ Kernels */
+#if CHAR_MIN < 0
+#define HLHDF_CHAR_CLASS I
+#else
+#define HLHDF_CHAR_CLASS U
+#endif
+
+/**
+ * Calls X(p, name, type, class, specifier) for each numeric format.
+ */
+#define HLHDF_SOURCE_FORMATS(X, p) \
+  X(p, char, char, HLHDF_CHAR_CLASS, HLHDF_CHAR) \
+  X(p, schar, signed char, I, HLHDF_SCHAR) \
+  X(p, uchar, unsigned char, U, HLHDF_UCHAR) \
+  X(p, short, short, I, HLHDF_SHORT) \
+  X(p, ushort, unsigned short, U, HLHDF_USHORT) \
+  X(p, int, int, I, HLHDF_INT) \
+  X(p, uint, unsigned int, U, HLHDF_UINT) \
+  X(p, long, long, I, HLHDF_LONG) \
+  X(p, ulong, unsigned long, U, HLHDF_ULONG) \
+  X(p, llong, long long, I, HLHDF_LLONG) \
+  X(p, ullong, unsigned long long, U, HLHDF_ULLONG) \
+  X(p, float, float, f, HLHDF_FLOAT) \
+  X(p, double, double, d, HLHDF_DOUBLE) \
+  X(p, ldouble, long double, l, HLHDF_LDOUBLE) \
+  X(p, hsize, hsize_t, U, HLHDF_HSIZE) \
+  X(p, hssize, hssize_t, I, HLHDF_HSSIZE) \
+  X(p, herr, herr_t, I, HLHDF_HERR) \
+  X(p, hbool, hbool_t, U, HLHDF_HBOOL)
+
+/**
+ * Calls X(p, sname, stype, sclass, sspec, name, type, specifier) for each numeric format.
+ * The same list as @ref HLHDF_SOURCE_FORMATS but a macro can not expand itself.
+ */
+#define HLHDF_TARGET_FORMATS(X, p, sname, stype, sclass, sspec) \
+  X(p, sname, stype, sclass, sspec, char, char, HLHDF_CHAR) \
+  X(p, sname, stype, sclass, sspec, schar, signed char, HLHDF_SCHAR) \
+  X(p, sname, stype, sclass, sspec, uchar, unsigned char, HLHDF_UCHAR) \
+  X(p, sname, stype, sclass, sspec, short, short, HLHDF_SHORT) \
+  X(p, sname, stype, sclass, sspec, ushort, unsigned short, HLHDF_USHORT) \
+  X(p, sname, stype, sclass, sspec, int, int, HLHDF_INT) \
+  X(p, sname, stype, sclass, sspec, uint, unsigned int, HLHDF_UINT) \
+  X(p, sname, stype, sclass, sspec, long, long, HLHDF_LONG) \
+  X(p, sname, stype, sclass, sspec, ulong, unsigned long, HLHDF_ULONG) \
+  X(p, sname, stype, sclass, sspec, llong, long long, HLHDF_LLONG) \
+  X(p, sname, stype, sclass, sspec, ullong, unsigned long long, HLHDF_ULLONG) \
+  X(p, sname, stype, sclass, sspec, float, float, HLHDF_FLOAT) \
+  X(p, sname, stype, sclass, sspec, double, double, HLHDF_DOUBLE) \
+  X(p, sname, stype, sclass, sspec, ldouble, long double, HLHDF_LDOUBLE) \
+  X(p, sname, stype, sclass, sspec, hsize, hsize_t, HLHDF_HSIZE) \
+  X(p, sname, stype, sclass, sspec, hssize, hssize_t, HLHDF_HSSIZE) \
+  X(p, sname, stype, sclass, sspec, herr, herr_t, HLHDF_HERR) \
+  X(p, sname, stype, sclass, sspec, hbool, hbool_t, HLHDF_HBOOL)
+
+#define HLHDF_CONVERTER(dname, sclass) HLHDF_CONVERTER_(dname, sclass)
+#define HLHDF_CONVERTER_(dname, sclass) hlconv_##dname##_##sclass
+
+/**
+ * Defines the kernel p_sname_to_dname.
+ */
+#define HLHDF_CONVERT_KERNEL(p, sname, stype, sclass, sspec, dname, dtype, dspec) \
+  static void p##_##sname##_to_##dname(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, size_t n) \
+  { \
+    const stype* HLHDF_RESTRICT src = (const stype*)in; \
+    dtype* HLHDF_RESTRICT dst = (dtype*)out; \
+    size_t i; \
+    for (i = 0; i < n; i++) { \
+      dst[i] = HLHDF_CONVERTER(dname, sclass)(src[i]); \
+    } \
+  }
+
+#define HLHDF_KERNELS_FROM(p, sname, stype, sclass, sspec) \
+  HLHDF_TARGET_FORMATS(HLHDF_CONVERT_KERNEL, p, sname, stype, sclass, sspec)
+
+#define HLHDF_KERNEL_ENTRY(p, sname, stype, sclass, sspec, dname, dtype, dspec) \
+  [sspec][dspec] = p##_##sname##_to_##dname,
+
+#define HLHDF_KERNEL_ENTRIES_FROM(p, sname, stype, sclass, sspec) \
+  HLHDF_TARGET_FORMATS(HLHDF_KERNEL_ENTRY, p, sname, stype, sclass, sspec)
+
+/**
+ * Calls X(p, name, specifier) for each 16 bit floating point format.
+ */
+#define HLHDF_FLOAT16_FORMATS(X, p) \
+  X(p, half, HLHDF_HALF) \
+  X(p, bfloat16, HLHDF_BFLOAT16)
+
+/**
+ * Calls X(p, sname, stype, sspec, name, specifier) for each 16 bit floating point format.
+ * The same list as @ref HLHDF_FLOAT16_FORMATS.
+ */
+#define HLHDF_FLOAT16_TARGETS(X, p, sname, stype, sspec) \
+  X(p, sname, stype, sspec, half, HLHDF_HALF) \
+  X(p, sname, stype, sspec, bfloat16, HLHDF_BFLOAT16)
+
+/**
+ * Number of values at a time that are converted through float to or from a
+ * 16 bit floating point format.
+ */
+#define HLHDF_FLOAT16_BLOCK 256
+
+/**
+ * Defines p_unpack_name and p_pack_name, converting between a 16 bit floating point
+ * format and float.
+ */
+#define HLHDF_FLOAT16_PACKERS(p, name, spec) \
+  static void p##_unpack_##name(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, size_t n) \
+  { \
+    const unsigned short* HLHDF_RESTRICT src = (const unsigned short*)in; \
+    float* HLHDF_RESTRICT dst = (float*)out; \
+    size_t i; \
+    for (i = 0; i < n; i++) { \
+      dst[i] = hlconv_unpack_##name(src[i]); \
+    } \
+  } \
+  static void p##_pack_##name(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, size_t n) \
+  { \
+    const float* HLHDF_RESTRICT src = (const float*)in; \
+    unsigned short* HLHDF_RESTRICT dst = (unsigned short*)out; \
+    size_t i; \
+    for (i = 0; i < n; i++) { \
+      dst[i] = hlconv_pack_##name(src[i]); \
+    } \
+  }
+
+/**
+ * Defines the kernel p_sname_to_dname from a 16 bit floating point format, unpacking
+ * blocks into float and converting them from float.
+ */
+#define HLHDF_FROM_FLOAT16_KERNEL(p, sname, stype, sclass, sspec, dname, dtype, dspec) \
+  static void p##_##sname##_to_##dname(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, size_t n) \
+  { \
+    const stype* src = (const stype*)in; \
+    dtype* dst = (dtype*)out; \
+    float tmp[HLHDF_FLOAT16_BLOCK]; \
+    size_t i, m; \
+    for (i = 0; i < n; i += m) { \
+      m = (n - i < HLHDF_FLOAT16_BLOCK) ? n - i : HLHDF_FLOAT16_BLOCK; \
+      if (dspec == HLHDF_FLOAT) { \
+        p##_unpack_##sname(src + i, dst + i, m); \
+      } else { \
+        p##_unpack_##sname(src + i, tmp, m); \
+        p##_float_to_##dname(tmp, dst + i, m); \
+      } \
+    } \
+  }
+
+/**
+ * Defines the kernel p_sname_to_dname into a 16 bit floating point format, converting
+ * blocks into float and packing them.
+ */
+#define HLHDF_TO_FLOAT16_KERNEL(p, sname, stype, sspec, dname, dspec) \
+  static void p##_##sname##_to_##dname(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, size_t n) \
+  { \
+    const stype* src = (const stype*)in; \
+    unsigned short* dst = (unsigned short*)out; \
+    float tmp[HLHDF_FLOAT16_BLOCK]; \
+    size_t i, m; \
+    for (i = 0; i < n; i += m) { \
+      m = (n - i < HLHDF_FLOAT16_BLOCK) ? n - i : HLHDF_FLOAT16_BLOCK; \
+      if (sspec == HLHDF_FLOAT) { \
+        p##_pack_##dname(src + i, dst + i, m); \
+      } else { \
+        p##_##sname##_to_float(src + i, tmp, m); \
+        p##_pack_##dname(tmp, dst + i, m); \
+      } \
+    } \
+  }
+
+/**
+ * Defines the kernel p_sname_to_dname between two 16 bit floating point formats.
+ */
+#define HLHDF_FLOAT16_PAIR_KERNEL(p, sname, stype, sspec, dname, dspec) \
+  static void p##_##sname##_to_##dname(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, size_t n) \
+  { \
+    const stype* src = (const stype*)in; \
+    unsigned short* dst = (unsigned short*)out; \
+    float tmp[HLHDF_FLOAT16_BLOCK]; \
+    size_t i, m; \
+    for (i = 0; i < n; i += m) { \
+      m = (n - i < HLHDF_FLOAT16_BLOCK) ? n - i : HLHDF_FLOAT16_BLOCK; \
+      if (sspec == dspec) { \
+        memcpy(dst + i, src + i, m * sizeof(unsigned short)); \
+      } else { \
+        p##_unpack_##sname(src + i, tmp, m); \
+        p##_pack_##dname(tmp, dst + i, m); \
+      } \
+    } \
+  }
+
+#define HLHDF_FLOAT16_ENTRY(p, sname, stype, sspec, dname, dspec) \
+  [sspec][dspec] = p##_##sname##_to_##dname,
+
+#define HLHDF_TO_FLOAT16_KERNELS_FROM(p, sname, stype, sclass, sspec) \
+  HLHDF_FLOAT16_TARGETS(HLHDF_TO_FLOAT16_KERNEL, p, sname, stype, sspec)
+
+#define HLHDF_TO_FLOAT16_ENTRIES_FROM(p, sname, stype, sclass, sspec) \
+  HLHDF_FLOAT16_TARGETS(HLHDF_FLOAT16_ENTRY, p, sname, stype, sspec)
+
+#define HLHDF_FLOAT16_KERNELS_FROM(p, sname, sspec) \
+  HLHDF_TARGET_FORMATS(HLHDF_FROM_FLOAT16_KERNEL, p, sname, unsigned short, h, sspec) \
+  HLHDF_FLOAT16_TARGETS(HLHDF_FLOAT16_PAIR_KERNEL, p, sname, unsigned short, sspec)
+
+#define HLHDF_FLOAT16_ENTRIES_FROM(p, sname, sspec) \
+  HLHDF_TARGET_FORMATS(HLHDF_KERNEL_ENTRY, p, sname, unsigned short, h, sspec) \
+  HLHDF_FLOAT16_TARGETS(HLHDF_FLOAT16_ENTRY, p, sname, unsigned short, sspec)
+
+/**
+ * Defines the decoding kernel p_decode_sname_to_dname. The loop is written as selects
+ * only so that the compiler unswitches it on hasNodata and hasUndetect and vectorizes it.
+ */
+#define HLHDF_DECODE_KERNEL(p, sname, stype, sclass, sspec, dname, dtype) \
+  static void p##_decode_##sname##_to_##dname(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, \
+    size_t n, const HL_DecodeParameters* params) \
+  { \
+    const stype* HLHDF_RESTRICT src = (const stype*)in; \
+    dtype* HLHDF_RESTRICT dst = (dtype*)out; \
+    const dtype gain = (dtype)params->gain, offset = (dtype)params->offset; \
+    const dtype nodataValue = (dtype)params->nodataValue, undetectValue = (dtype)params->undetectValue; \
+    const stype nodata = hlconv_##sname##_d(params->nodata); \
+    const stype undetect = hlconv_##sname##_d(params->undetect); \
+    const int hasNodata = params->hasNodata && (double)nodata == params->nodata; \
+    const int hasUndetect = params->hasUndetect && (double)undetect == params->undetect; \
+    size_t i; \
+    for (i = 0; i < n; i++) { \
+      const stype q = src[i]; \
+      const dtype v = (dtype)q * gain + offset; \
+      const dtype nv = (q == nodata) ? nodataValue : v; \
+      const dtype a = hasNodata ? nv : v; \
+      const dtype uv = (q == undetect) ? undetectValue : a; \
+      dst[i] = hasUndetect ? uv : a; \
+    } \
+  }
+
+#define HLHDF_DECODE_KERNELS_FROM(p, sname, stype, sclass, sspec) \
+  HLHDF_DECODE_KERNEL(p, sname, stype, sclass, sspec, float, float) \
+  HLHDF_DECODE_KERNEL(p, sname, stype, sclass, sspec, double, double)
+
+#define HLHDF_DECODE_ENTRIES_FROM(p, sname, stype, sclass, sspec) \
+  [sspec][0] = p##_decode_##sname##_to_float, \
+  [sspec][1] = p##_decode_##sname##_to_double,
+
+/**
+ * Calls X(p, name, type, specifier, sumtype, min, max) for each numeric format, where
+ * sumtype is the type the values are summed in and min and max are the limits of type.
+ * 64 bit integers are summed as doubles since they could overflow any integer type.
+ */
+#define HLHDF_STATISTICS_FORMATS(X, p) \
+  X(p, char, char, HLHDF_CHAR, long long, CHAR_MIN, CHAR_MAX) \
+  X(p, schar, signed char, HLHDF_SCHAR, long long, SCHAR_MIN, SCHAR_MAX) \
+  X(p, uchar, unsigned char, HLHDF_UCHAR, unsigned long long, 0, UCHAR_MAX) \
+  X(p, short, short, HLHDF_SHORT, long long, SHRT_MIN, SHRT_MAX) \
+  X(p, ushort, unsigned short, HLHDF_USHORT, unsigned long long, 0, USHRT_MAX) \
+  X(p, int, int, HLHDF_INT, long long, INT_MIN, INT_MAX) \
+  X(p, uint, unsigned int, HLHDF_UINT, unsigned long long, 0, UINT_MAX) \
+  X(p, long, long, HLHDF_LONG, double, LONG_MIN, LONG_MAX) \
+  X(p, ulong, unsigned long, HLHDF_ULONG, double, 0, ULONG_MAX) \
+  X(p, llong, long long, HLHDF_LLONG, double, LLONG_MIN, LLONG_MAX) \
+  X(p, ullong, unsigned long long, HLHDF_ULLONG, double, 0, ULLONG_MAX) \
+  X(p, float, float, HLHDF_FLOAT, double, -HUGE_VALF, HUGE_VALF) \
+  X(p, double, double, HLHDF_DOUBLE, double, -HUGE_VAL, HUGE_VAL) \
+  X(p, ldouble, long double, HLHDF_LDOUBLE, long double, -HUGE_VALL, HUGE_VALL) \
+  X(p, hsize, hsize_t, HLHDF_HSIZE, double, 0, ULLONG_MAX) \
+  X(p, hssize, hssize_t, HLHDF_HSSIZE, double, LLONG_MIN, LLONG_MAX) \
+  X(p, herr, herr_t, HLHDF_HERR, long long, INT_MIN, INT_MAX) \
+  X(p, hbool, hbool_t, HLHDF_HBOOL, unsigned long long, 0, 1)
+
+/**
+ * Number of lanes the statistics are accumulated in, enough for a 256 bit vector of chars.
+ */
+#define HLHDF_STATISTICS_LANES 32
+
+/**
+ * Adds the value q to lane j of the statistics accumulated in the kernel.
+ */
+#define HLHDF_STATISTICS_STEP(stype, atype, smin, smax, value, j) \
+  { \
+    const stype q = (value); \
+    const int nd = (q == nodata) ? hasNodata : 0; \
+    const int ud0 = (q == undetect) ? hasUndetect : 0; \
+    const int ud = nd ? 0 : ud0; \
+    const int ok0 = (q == q) ? 1 : 0; \
+    const int ok1 = nd ? 0 : ok0; \
+    const int ok = ud ? 0 : ok1; \
+    const stype lo = ok ? q : (stype)(smax); \
+    const stype hi = ok ? q : (stype)(smin); \
+    nnodata[j] += nd; \
+    nundetect[j] += ud; \
+    nvalid[j] += ok; \
+    sum[j] += ok ? (atype)q : (atype)0; \
+    mn[j] = (lo < mn[j]) ? lo : mn[j]; \
+    mx[j] = (hi > mx[j]) ? hi : mx[j]; \
+  }
+
+/**
+ * Defines the statistics kernel p_statistics_sname. The values are accumulated in
+ * HLHDF_STATISTICS_LANES independent lanes with selects only, so that the inner loop is
+ * vectorized, and the lanes are combined at the end. The histogram can not be vectorized
+ * and is counted in a second pass while the values still are in the cache.
+ */
+#define HLHDF_STATISTICS_KERNEL(p, sname, stype, sspec, atype, smin, smax) \
+  static void p##_statistics_##sname(const void* HLHDF_RESTRICT in, size_t n, \
+    const HL_StatisticsParameters* params, HL_DataStatistics* HLHDF_RESTRICT stats) \
+  { \
+    const stype* HLHDF_RESTRICT src = (const stype*)in; \
+    const stype nodata = hlconv_##sname##_d(params->nodata); \
+    const stype undetect = hlconv_##sname##_d(params->undetect); \
+    const int hasNodata = params->hasNodata && (double)nodata == params->nodata; \
+    const int hasUndetect = params->hasUndetect && (double)undetect == params->undetect; \
+    stype mn[HLHDF_STATISTICS_LANES], mx[HLHDF_STATISTICS_LANES]; \
+    atype sum[HLHDF_STATISTICS_LANES]; \
+    int nnodata[HLHDF_STATISTICS_LANES], nundetect[HLHDF_STATISTICS_LANES], nvalid[HLHDF_STATISTICS_LANES]; \
+    unsigned long long totalValid = 0; \
+    size_t i = 0; \
+    int j; \
+    for (j = 0; j < HLHDF_STATISTICS_LANES; j++) { \
+      mn[j] = (stype)(smax); \
+      mx[j] = (stype)(smin); \
+      sum[j] = 0; \
+      nnodata[j] = nundetect[j] = nvalid[j] = 0; \
+    } \
+    for (i = 0; i + HLHDF_STATISTICS_LANES <= n; i += HLHDF_STATISTICS_LANES) { \
+      for (j = 0; j < HLHDF_STATISTICS_LANES; j++) { \
+        HLHDF_STATISTICS_STEP(stype, atype, smin, smax, src[i + j], j) \
+      } \
+    } \
+    for (j = 0; i + j < n; j++) { \
+      HLHDF_STATISTICS_STEP(stype, atype, smin, smax, src[i + j], j) \
+    } \
+    for (j = 0; j < HLHDF_STATISTICS_LANES; j++) { \
+      stats->nodataCount += nnodata[j]; \
+      stats->undetectCount += nundetect[j]; \
+      stats->sum += (double)sum[j]; \
+      totalValid += nvalid[j]; \
+      if (nvalid[j] > 0) { \
+        stats->min = ((double)mn[j] < stats->min) ? (double)mn[j] : stats->min; \
+        stats->max = ((double)mx[j] > stats->max) ? (double)mx[j] : stats->max; \
+      } \
+    } \
+    stats->count += n; \
+    stats->validCount += totalValid; \
+    if (totalValid > 0 && stats->nbins > 0) { \
+      const double low = stats->histogramLow, high = stats->histogramHigh; \
+      const double scale = stats->nbins / (high - low); \
+      for (i = 0; i < n; i++) { \
+        const stype q = src[i]; \
+        const double v = (double)q; \
+        if (q == q && !(hasNodata && q == nodata) && !(hasUndetect && q == undetect) && v >= low && v <= high) { \
+          int bin = (int)((v - low) * scale); \
+          stats->histogram[(bin < stats->nbins) ? bin : stats->nbins - 1]++; \
+        } \
+      } \
+    } \
+  }
+
+#define HLHDF_STATISTICS_ENTRY(p, sname, stype, sspec, atype, smin, smax) \
+  [sspec] = p##_statistics_##sname,
+
+/**
+ * The formats that can be rounded, see @ref HLHDF_ROUND_KERNEL. utype is an unsigned
+ * integer of the same size and mbits the number of explicit mantissa bits.
+ */
+#define HLHDF_ROUND_FORMATS(X, p) \
+  X(p, float, uint32_t, HLHDF_FLOAT, FLT_MANT_DIG - 1) \
+  X(p, double, uint64_t, HLHDF_DOUBLE, DBL_MANT_DIG - 1)
+
+/**
+ * Defines the kernel p_round_sname that keeps keepBits bits of the mantissa and rounds
+ * the rest to nearest even on the bit pattern. A value that is rounded up past the
+ * largest mantissa carries into the exponent, which is the correct result. NaN and
+ * infinity, which have all exponent bits set, are copied as they are.
+ */
+#define HLHDF_ROUND_KERNEL(p, sname, utype, sspec, mbits) \
+  static void p##_round_##sname(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, size_t n, int keepBits) \
+  { \
+    const utype* HLHDF_RESTRICT src = (const utype*)in; \
+    utype* HLHDF_RESTRICT dst = (utype*)out; \
+    const int shift = (mbits) - ((keepBits > 0) ? keepBits : 0); \
+    const utype exponent = ((~(utype)0) >> 1) & ~((((utype)1) << (mbits)) - 1); \
+    utype mask, half; \
+    size_t i; \
+    if (shift <= 0) { \
+      memcpy(out, in, n * sizeof(utype)); \
+      return; \
+    } \
+    mask = ~((((utype)1) << shift) - 1); \
+    half = (((utype)1) << (shift - 1)) - 1; \
+    for (i = 0; i < n; i++) { \
+      const utype u = src[i]; \
+      const utype r = (u + half + ((u >> shift) & 1)) & mask; \
+      dst[i] = ((u & exponent) == exponent) ? u : r; \
+    } \
+  }
+
+#define HLHDF_ROUND_ENTRY(p, sname, utype, sspec, mbits) \
+  [sspec] = p##_round_##sname,
+
+/**
+ * The value sizes of the delta predictor, see @ref HLHDF_DELTA_KERNEL. The kernel
+ * tables are indexed by the base 2 logarithm of the size in bytes.
+ */
+#define HLHDF_DELTA_SIZES(X, p) \
+  X(p, 8, uint8_t, 0) \
+  X(p, 16, uint16_t, 1) \
+  X(p, 32, uint32_t, 2) \
+  X(p, 64, uint64_t, 3)
+
+/**
+ * Number of values that the delta kernels copy at a time.
+ */
+#define HLHDF_DELTA_BLOCK 256
+
+/**
+ * Defines the kernel p_delta_bits that replaces each value with the difference to the
+ * previous value, the first value is kept. Each block is copied before it is changed so
+ * that there is no dependency between the iterations. The differences wrap around,
+ * which makes them exact for signed values as well.
+ */
+#define HLHDF_DELTA_KERNEL(p, bits, utype, index) \
+  static void p##_delta_##bits(void* data, size_t n) \
+  { \
+    utype* HLHDF_RESTRICT x = (utype*)data; \
+    utype tmp[HLHDF_DELTA_BLOCK + 1]; \
+    utype prev = 0; \
+    size_t i = 0, j = 0, m = 0; \
+    for (i = 0; i < n; i += m) { \
+      m = (n - i < HLHDF_DELTA_BLOCK) ? n - i : HLHDF_DELTA_BLOCK; \
+      tmp[0] = prev; \
+      memcpy(tmp + 1, x + i, m * sizeof(utype)); \
+      for (j = 0; j < m; j++) { \
+        x[i + j] = (utype)(tmp[j + 1] - tmp[j]); \
+      } \
+      prev = tmp[m]; \
+    } \
+  }
+
+/**
+ * Defines the kernel p_prefix_sum_bits that inverts p_delta_bits by replacing each
+ * value with the sum of it and all values before it.
+ */
+#define HLHDF_PREFIX_SUM_KERNEL(p, bits, utype, index) \
+  static void p##_prefix_sum_##bits(void* data, size_t n) \
+  { \
+    utype* x = (utype*)data; \
+    utype sum = 0; \
+    size_t i = 0; \
+    for (i = 0; i < n; i++) { \
+      x[i] = sum = (utype)(sum + x[i]); \
+    } \
+  }
+
+#define HLHDF_DELTA_ENTRY(p, bits, utype, index) \
+  [index] = p##_delta_##bits,
+
+#define HLHDF_PREFIX_SUM_ENTRY(p, bits, utype, index) \
+  [index] = p##_prefix_sum_##bits,
+
+/**
+ * Defines all kernels prefixed with p, the table p_kernels indexed by source and
+ * target format, the table p_decoders indexed by source format and 0 for
+ * float or 1 for double, the tables p_statistics and p_rounders indexed by source format
+ * and the tables p_deltas and p_prefix_sums, see @ref HLHDF_DELTA_SIZES.
+ * The packers of the 16 bit floating point formats, see @ref HLHDF_FLOAT16_PACKERS,
+ * and the prefix sum kernels must have been defined before. The 16 bit floating point
+ * formats can not be decoded and have no statistics.
+ */
+#define HLHDF_DEFINE_KERNELS(p) \
+  HLHDF_SOURCE_FORMATS(HLHDF_KERNELS_FROM, p) \
+  HLHDF_SOURCE_FORMATS(HLHDF_TO_FLOAT16_KERNELS_FROM, p) \
+  HLHDF_FLOAT16_FORMATS(HLHDF_FLOAT16_KERNELS_FROM, p) \
+  static const HL_ConvertKernel p##_kernels[HLHDF_END_OF_SPECIFIERS][HLHDF_END_OF_SPECIFIERS] = { \
+    HLHDF_SOURCE_FORMATS(HLHDF_KERNEL_ENTRIES_FROM, p) \
+    HLHDF_SOURCE_FORMATS(HLHDF_TO_FLOAT16_ENTRIES_FROM, p) \
+    HLHDF_FLOAT16_FORMATS(HLHDF_FLOAT16_ENTRIES_FROM, p) \
+  }; \
+  HLHDF_SOURCE_FORMATS(HLHDF_DECODE_KERNELS_FROM, p) \
+  static const HL_DecodeKernel p##_decoders[HLHDF_END_OF_SPECIFIERS][2] = { \
+    HLHDF_SOURCE_FORMATS(HLHDF_DECODE_ENTRIES_FROM, p) \
+  }; \
+  HLHDF_STATISTICS_FORMATS(HLHDF_STATISTICS_KERNEL, p) \
+  static const HL_StatisticsKernel p##_statistics[HLHDF_END_OF_SPECIFIERS] = { \
+    HLHDF_STATISTICS_FORMATS(HLHDF_STATISTICS_ENTRY, p) \
+  }; \
+  HLHDF_ROUND_FORMATS(HLHDF_ROUND_KERNEL, p) \
+  static const HL_RoundKernel p##_rounders[HLHDF_END_OF_SPECIFIERS] = { \
+    HLHDF_ROUND_FORMATS(HLHDF_ROUND_ENTRY, p) \
+  }; \
+  HLHDF_DELTA_SIZES(HLHDF_DELTA_KERNEL, p) \
+  static const HL_DeltaKernel p##_deltas[4] = { \
+    HLHDF_DELTA_SIZES(HLHDF_DELTA_ENTRY, p) \
+  }; \
+  static const HL_DeltaKernel p##_prefix_sums[4] = { \
+    HLHDF_DELTA_SIZES(HLHDF_PREFIX_SUM_ENTRY, p) \
+  };
+
+HLHDF_FLOAT16_FORMATS(HLHDF_FLOAT16_PACKERS, generic)
+HLHDF_DELTA_SIZES(HLHDF_PREFIX_SUM_KERNEL, generic)
+HLHDF_DEFINE_KERNELS(generic)
+
+#ifdef HLHDF_AVX2_KERNELS
+#pragma GCC push_options
+#pragma GCC target("avx2,f16c")
+/**
+ * Converts half precision values into floats with F16C.
+ */
+static void avx2_unpack_half(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, size_t n)
+{
+  const unsigned short* HLHDF_RESTRICT src = (const unsigned short*)in;
+  float* HLHDF_RESTRICT dst = (float*)out;
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+  }
+  for (; i < n; i++) {
+    dst[i] = hlconv_unpack_half(src[i]);
+  }
+}
+
+/**
+ * Converts floats into half precision values with F16C, rounding to nearest even.
+ */
+static void avx2_pack_half(const void* HLHDF_RESTRICT in, void* HLHDF_RESTRICT out, size_t n)
+{
+  const float* HLHDF_RESTRICT src = (const float*)in;
+  unsigned short* HLHDF_RESTRICT dst = (unsigned short*)out;
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+  }
+  for (; i < n; i++) {
+    dst[i] = hlconv_pack_half(src[i]);
+  }
+}
+
+/**
+ * Defines avx2_prefix_sum_bits that computes the running sum 16 bytes at a time. The
+ * sums within a vector are formed by adding the vector shifted 1, 2, 4 and 8 values,
+ * then the last sum of the previous vector is broadcast and added.
+ */
+#define HLHDF_AVX2_PREFIX_SUM_KERNEL(p, bits, utype, index) \
+  static void p##_prefix_sum_##bits(void* data, size_t n) \
+  { \
+    utype* x = (utype*)data; \
+    const size_t lanes = 16 / sizeof(utype); \
+    unsigned char lastLane[16]; \
+    __m128i last, carry = _mm_setzero_si128(); \
+    utype sum = 0; \
+    size_t i = 0; \
+    for (i = 0; i < 16; i++) { \
+      lastLane[i] = (unsigned char)(16 - sizeof(utype) + i % sizeof(utype)); \
+    } \
+    last = _mm_loadu_si128((const __m128i*)lastLane); \
+    for (i = 0; i + lanes <= n; i += lanes) { \
+      __m128i v = _mm_loadu_si128((const __m128i*)(x + i)); \
+      v = _mm_add_epi##bits(v, _mm_slli_si128(v, sizeof(utype))); \
+      if (lanes > 2) { \
+        v = _mm_add_epi##bits(v, _mm_slli_si128(v, 2 * sizeof(utype))); \
+      } \
+      if (lanes > 4) { \
+        v = _mm_add_epi##bits(v, _mm_slli_si128(v, 4 * sizeof(utype))); \
+      } \
+      if (lanes > 8) { \
+        v = _mm_add_epi##bits(v, _mm_slli_si128(v, 8 * sizeof(utype))); \
+      } \
+      v = _mm_add_epi##bits(v, carry); \
+      _mm_storeu_si128((__m128i*)(x + i), v); \
+      carry = _mm_shuffle_epi8(v, last); \
+    } \
+    sum = (i > 0) ? x[i - 1] : 0; \
+    for (; i < n; i++) { \
+      x[i] = sum = (utype)(sum + x[i]); \
+    } \
+  }
+
+HLHDF_FLOAT16_PACKERS(avx2, bfloat16, HLHDF_BFLOAT16)
+HLHDF_DELTA_SIZES(HLHDF_AVX2_PREFIX_SUM_KERNEL, avx2)
+HLHDF_DEFINE_KERNELS(avx2)
+#pragma GCC pop_options
+#endif
+/*@} End of Kernels */
+
+/*@{ Static functions */
+static pthread_once_t kernelsOnce = PTHREAD_ONCE_INIT;
+
+/** The kernel table to use on this CPU */
+static const HL_ConvertKernel (*kernels)[HLHDF_END_OF_SPECIFIERS] = generic_kernels;
+
+/** The decoder table to use on this CPU */
+static const HL_DecodeKernel (*decoders)[2] = generic_decoders;
+
+/** The statistics kernel table to use on this CPU */
+static const HL_StatisticsKernel* statistics = generic_statistics;
+
+/** The rounding kernel table to use on this CPU */
+static const HL_RoundKernel* rounders = generic_rounders;
+
+/** The delta kernel tables to use on this CPU */
+static const HL_DeltaKernel* deltas = generic_deltas;
+static const HL_DeltaKernel* prefixSums = generic_prefix_sums;
+
+#define HLHDF_MANTISSA_BITS_ENTRY(p, sname, utype, sspec, mbits) \
+  [sspec] = mbits,
+
+/** The number of explicit mantissa bits of the formats that can be rounded */
+static const int mantissaBits[HLHDF_END_OF_SPECIFIERS] = {
+  HLHDF_ROUND_FORMATS(HLHDF_MANTISSA_BITS_ENTRY, unused)
+};
+
+/**
+ * Picks the kernel table for the CPU, called once.
+ */
+static void HLConvert_selectKernels(void)
+{
+#ifdef HLHDF_AVX2_KERNELS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+    kernels = avx2_kernels;
+    decoders = avx2_decoders;
+    statistics = avx2_statistics;
+    rounders = avx2_rounders;
+    deltas = avx2_deltas;
+    prefixSums = avx2_prefix_sums;
+  }
+#endif
+}
+/*@} End of Static functions */
+
+/*@{ Private functions */
+HL_ConvertKernel HLConvertPrivate_getKernel(HL_FormatSpecifier source, HL_FormatSpecifier target)
+{
+  if (source <= HLHDF_UNDEFINED || source >= HLHDF_END_OF_SPECIFIERS ||
+      target <= HLHDF_UNDEFINED || target >= HLHDF_END_OF_SPECIFIERS) {
+    return NULL;
+  }
+  pthread_once(&kernelsOnce, HLConvert_selectKernels);
+  return kernels[source][target];
+}
+
+HL_DecodeKernel HLConvertPrivate_getDecodeKernel(HL_FormatSpecifier source, HL_FormatSpecifier target)
+{
+  if (source <= HLHDF_UNDEFINED || source >= HLHDF_END_OF_SPECIFIERS ||
+      (target != HLHDF_FLOAT && target != HLHDF_DOUBLE)) {
+    return NULL;
+  }
+  pthread_once(&kernelsOnce, HLConvert_selectKernels);
+  return decoders[source][(target == HLHDF_FLOAT) ? 0 : 1];
+}
+
+HL_StatisticsKernel HLConvertPrivate_getStatisticsKernel(HL_FormatSpecifier source)
+{
+  if (source <= HLHDF_UNDEFINED || source >= HLHDF_END_OF_SPECIFIERS) {
+    return NULL;
+  }
+  pthread_once(&kernelsOnce, HLConvert_selectKernels);
+  return statistics[source];
+}
+
+HL_RoundKernel HLConvertPrivate_getRoundKernel(HL_FormatSpecifier source, int* mbits)
+{
+  if (source <= HLHDF_UNDEFINED || source >= HLHDF_END_OF_SPECIFIERS) {
+    return NULL;
+  }
+  pthread_once(&kernelsOnce, HLConvert_selectKernels);
+  if (mbits != NULL) {
+    *mbits = mantissaBits[source];
+  }
+  return rounders[source];
+}
+
+HL_DeltaKernel HLConvertPrivate_getDeltaKernel(size_t size, int inverse)
+{
+  int index = 0;
+  switch (size) {
+  case 1: index = 0; break;
+  case 2: index = 1; break;
+  case 4: index = 2; break;
+  case 8: index = 3; break;
+  default:
+    return NULL;
+  }
+  pthread_once(&kernelsOnce, HLConvert_selectKernels);
+  return inverse ? prefixSums[index] : deltas[index];
+}
+
+void HLConvertPrivate_initStatistics(HL_DataStatistics* stats, int nbins, double low, double high)
+{
+  memset(stats, 0, sizeof(HL_DataStatistics));
+  stats->min = HUGE_VAL;
+  stats->max = -HUGE_VAL;
+  if (nbins > 0 && high > low) {
+    stats->nbins = (nbins < HLHDF_MAX_HISTOGRAM_BINS) ? nbins : HLHDF_MAX_HISTOGRAM_BINS;
+    stats->histogramLow = low;
+    stats->histogramHigh = high;
+  }
+}
+
+void HLConvertPrivate_mergeStatistics(HL_DataStatistics* stats, const HL_DataStatistics* other)
+{
+  int i;
+  stats->count += other->count;
+  stats->validCount += other->validCount;
+  stats->nodataCount += other->nodataCount;
+  stats->undetectCount += other->undetectCount;
+  stats->sum += other->sum;
+  if (other->min < stats->min) {
+    stats->min = other->min;
+  }
+  if (other->max > stats->max) {
+    stats->max = other->max;
+  }
+  for (i = 0; i < stats->nbins && i < other->nbins; i++) {
+    stats->histogram[i] += other->histogram[i];
+  }
+}
+
+void HLConvertPrivate_finishStatistics(HL_DataStatistics* stats)
+{
+  if (stats->validCount > 0) {
+    stats->mean = stats->sum / (double)stats->validCount;
+  } else {
+    stats->min = stats->max = stats->mean = NAN;
+  }
+}
+
+int HLConvertPrivate_convert(HL_FormatSpecifier source, const void* in,
+  HL_FormatSpecifier target, void* out, size_t n)
+{
+  HL_ConvertKernel kernel = HLConvertPrivate_getKernel(source, target);
+  if (kernel == NULL) {
+    HL_ERROR2("Can not convert from %s to %s",
+      HL_getFormatSpecifierString(source), HL_getFormatSpecifierString(target));
+    return 0;
+  }
+  if (source == target) {
+    memmove(out, in, n * HL_sizeOfFormatSpecifier(source));
+  } else {
+    kernel(in, out, n);
+  }
+  return 1;
+}
+/*@} End of Private functions */
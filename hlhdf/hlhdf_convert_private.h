@@ -0,0 +1,166 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * Private functions for converting arrays of values between the numeric formats
+ * and for computing statistics of them.
+ * @file
+ */
+#ifndef HLHDF_CONVERT_PRIVATE_H
+#define HLHDF_CONVERT_PRIVATE_H
+#include "hlhdf_types.h"
+#include <stdlib.h>
+
+/**
+ * Converts n values from in to out.
+ */
+typedef void (*HL_ConvertKernel)(const void* in, void* out, size_t n);
+
+/**
+ * How quantized values are decoded into physical values, see @ref HL_DecodeKernel.
+ */
+typedef struct HL_DecodeParameters {
+  double gain;          /**< the physical value is gain * q + offset */
+  double offset;        /**< the physical value is gain * q + offset */
+  int hasNodata;        /**< if nodata should be recognized */
+  double nodata;        /**< the quantized value for no data */
+  double nodataValue;   /**< the decoded value for no data */
+  int hasUndetect;      /**< if undetect should be recognized */
+  double undetect;      /**< the quantized value for undetected */
+  double undetectValue; /**< the decoded value for undetected */
+} HL_DecodeParameters;
+
+/**
+ * Decodes n quantized values from in to out.
+ */
+typedef void (*HL_DecodeKernel)(const void* in, void* out, size_t n, const HL_DecodeParameters* params);
+
+/**
+ * The values that are not valid when computing @ref HL_DataStatistics.
+ */
+typedef struct HL_StatisticsParameters {
+  int hasNodata;        /**< if nodata should be recognized */
+  double nodata;        /**< the value for no data */
+  int hasUndetect;      /**< if undetect should be recognized */
+  double undetect;      /**< the value for undetected */
+} HL_StatisticsParameters;
+
+/**
+ * Adds n values from in to the statistics.
+ */
+typedef void (*HL_StatisticsKernel)(const void* in, size_t n, const HL_StatisticsParameters* params,
+  HL_DataStatistics* stats);
+
+/**
+ * Rounds n floating point values from in to out so that only keepBits bits of the
+ * mantissa remain, see @ref HLConvertPrivate_getRoundKernel. in and out may not overlap.
+ */
+typedef void (*HL_RoundKernel)(const void* in, void* out, size_t n, int keepBits);
+
+/**
+ * Applies or inverts the delta predictor on n integer values in place, see
+ * @ref HLConvertPrivate_getDeltaKernel.
+ */
+typedef void (*HL_DeltaKernel)(void* data, size_t n);
+
+/**
+ * Returns the kernel converting between two numeric formats. When the CPU supports
+ * it, a kernel compiled for a wider vector instruction set is returned.
+ * Integer targets are saturated and NaN becomes 0, in the same way as HDF5 converts.
+ * @param[in] source the format of the values to convert
+ * @param[in] target the format to convert into
+ * @return the kernel or NULL if any of the formats is not numeric
+ */
+HL_ConvertKernel HLConvertPrivate_getKernel(HL_FormatSpecifier source, HL_FormatSpecifier target);
+
+/**
+ * Returns the kernel decoding quantized values into physical values, see
+ * @ref HL_DecodeParameters. A nodata or undetect value that not can be represented
+ * in the source format never matches.
+ * @param[in] source the numeric format of the quantized values
+ * @param[in] target the format of the physical values, HLHDF_FLOAT or HLHDF_DOUBLE
+ * @return the kernel or NULL if the formats are not supported
+ */
+HL_DecodeKernel HLConvertPrivate_getDecodeKernel(HL_FormatSpecifier source, HL_FormatSpecifier target);
+
+/**
+ * Returns the kernel adding values to @ref HL_DataStatistics. The statistics must have
+ * been initialized with @ref HLConvertPrivate_initStatistics.
+ * @param[in] source the numeric format of the values
+ * @return the kernel or NULL if the format is not numeric
+ */
+HL_StatisticsKernel HLConvertPrivate_getStatisticsKernel(HL_FormatSpecifier source);
+
+/**
+ * Returns the kernel rounding the mantissa of floating point values to nearest even,
+ * so that the trailing bits become zero and compress better. NaN and infinity are
+ * not changed.
+ * @param[in] source the format of the values
+ * @param[out] mbits receives the number of explicit mantissa bits of the format, may be NULL
+ * @return the kernel or NULL if the format not is HLHDF_FLOAT or HLHDF_DOUBLE
+ */
+HL_RoundKernel HLConvertPrivate_getRoundKernel(HL_FormatSpecifier source, int* mbits);
+
+/**
+ * Returns the kernel of the delta predictor. The predictor replaces each value with
+ * the difference to the previous value, the inverse replaces each value with the sum
+ * of it and all values before it. The arithmetic wraps around so that the inverse is
+ * exact for both signed and unsigned integers.
+ * @param[in] size the size of the integers in bytes, 1, 2, 4 or 8
+ * @param[in] inverse 0 for the kernel that applies the predictor, otherwise the inverse
+ * @return the kernel or NULL if the size is not supported
+ */
+HL_DeltaKernel HLConvertPrivate_getDeltaKernel(size_t size, int inverse);
+
+/**
+ * Initializes the statistics before any values have been added.
+ * @param[in] stats the statistics
+ * @param[in] nbins the number of histogram bins, 0 for no histogram
+ * @param[in] low the lower limit of the histogram
+ * @param[in] high the upper limit of the histogram
+ */
+void HLConvertPrivate_initStatistics(HL_DataStatistics* stats, int nbins, double low, double high);
+
+/**
+ * Adds statistics that have been computed separately, the histograms must have the
+ * same limits. Neither of the statistics may have been finished.
+ * @param[in] stats the statistics to add to
+ * @param[in] other the statistics to add
+ */
+void HLConvertPrivate_mergeStatistics(HL_DataStatistics* stats, const HL_DataStatistics* other);
+
+/**
+ * Computes the mean when all values have been added.
+ * @param[in] stats the statistics
+ */
+void HLConvertPrivate_finishStatistics(HL_DataStatistics* stats);
+
+/**
+ * Converts n values between two numeric formats, see @ref HLConvertPrivate_getKernel.
+ * @param[in] source the format of in
+ * @param[in] in the values to convert
+ * @param[in] target the format of out
+ * @param[out] out receives the converted values, may not overlap in unless source equals target
+ * @param[in] n the number of values
+ * @return 1 on success, 0 if any of the formats is not numeric
+ */
+int HLConvertPrivate_convert(HL_FormatSpecifier source, const void* in,
+  HL_FormatSpecifier target, void* out, size_t n);
+
+#endif /* HLHDF_CONVERT_PRIVATE_H */
@@ -24,75 +24,190 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 #include <string.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 hlhdf_debug_struct hlhdfDbg;
-static int initialized = 0;
+static pthread_once_t initializeOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * Max length of a message in the asynchronous debug sink.
+ */
+#define ASYNC_MESSAGE_LENGTH 512
+
+/**
+ * One message in the asynchronous debug sink.
+ */
+typedef struct {
+  char* filename; /**< the filename, always a string literal when using the debug macros */
+  int lineno; /**< the line number */
+  HL_Debug lvl; /**< the debug level */
+  time_t logtime; /**< when the message was reported */
+  char msg[ASYNC_MESSAGE_LENGTH]; /**< the formatted message */
+} AsyncDebugMessage;
+
+/**
+ * The asynchronous debug sink. The messages are stored in a ring buffer
+ * and written by a background thread.
+ */
+static struct {
+  pthread_mutex_t lock; /**< protects the ring buffer */
+  pthread_cond_t cond; /**< signaled when a message has been added or the sink is stopped */
+  pthread_t thread; /**< the writer thread */
+  int enabled; /**< if the sink is enabled */
+  int stopping; /**< set when the writer thread should terminate */
+  AsyncDebugMessage* messages; /**< the ring buffer */
+  size_t capacity; /**< number of slots in the ring buffer */
+  size_t head; /**< index of the oldest message */
+  size_t count; /**< number of messages in the ring buffer */
+  unsigned long dropped; /**< number of messages dropped because the buffer was full */
+  void (*target)(char* filename, int lineno, HL_Debug lvl, const char* fmt, ...); /**< where the messages should be written */
+} asyncSink = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER};
+
+static pthread_once_t asyncSinkForkOnce = PTHREAD_ONCE_INIT;
 
 /*@{ Private functions */
-static void setLogTime(char* strtime, int len)
+static void asyncSinkPrepareFork(void)
 {
-  time_t cur_time;
-  struct tm* tu_time;
+  pthread_mutex_lock(&asyncSink.lock);
+}
 
-  time(&cur_time);
-  tu_time = gmtime(&cur_time);
-  strftime(strtime, len, "%Y/%m/%d %H:%M:%S", tu_time);
+static void asyncSinkAfterForkInParent(void)
+{
+  pthread_mutex_unlock(&asyncSink.lock);
 }
 
-static void HL_DefaultDebugFunction(char* filename, int lineno, HL_Debug lvl,
-  const char* fmt, ...)
+/**
+ * The writer thread does not exist in the child so the child reports
+ * its messages directly to the target function instead.
+ */
+static void asyncSinkAfterForkInChild(void)
+{
+  pthread_mutex_init(&asyncSink.lock, NULL);
+  pthread_cond_init(&asyncSink.cond, NULL);
+  if (asyncSink.enabled) {
+    hlhdfDbg.dbgfun = asyncSink.target;
+    asyncSink.enabled = 0;
+    asyncSink.count = 0;
+  }
+}
+
+static void registerAsyncSinkForkHandlers(void)
+{
+  pthread_atfork(asyncSinkPrepareFork, asyncSinkAfterForkInParent, asyncSinkAfterForkInChild);
+}
+
+static void setLogTime(time_t cur_time, char* strtime, int len)
+{
+  struct tm tu_time;
+  gmtime_r(&cur_time, &tu_time);
+  strftime(strtime, len, "%Y/%m/%d %H:%M:%S", &tu_time);
+}
+
+static const char* getDebugTypeName(HL_Debug lvl)
+{
+  switch (lvl) {
+  case HLHDF_SPEWDEBUG:
+    return "SDEBUG";
+  case HLHDF_DEBUG:
+    return "DEBUG";
+  case HLHDF_DEPRECATED:
+    return "DEPRECATED";
+  case HLHDF_INFO:
+    return "INFO";
+  case HLHDF_WARNING:
+    return "WARNING";
+  case HLHDF_ERROR:
+    return "ERROR";
+  case HLHDF_CRITICAL:
+    return "CRITICAL";
+  default:
+    return "UNKNOWN";
+  }
+}
+
+static void writeDebugMessage(time_t logtime, char* filename, int lineno, HL_Debug lvl, const char* msg)
 {
-  char msgbuff[512];
-  char dbgtype[20];
   char strtime[24];
   char infobuff[120];
+  setLogTime(logtime, strtime, 24);
+  snprintf(infobuff, 120, "%20s : %11s", strtime, getDebugTypeName(lvl));
+#ifndef NO_HLHDF_PRINTF
+  fprintf(stderr, "%s : %s (%s:%d)\n", infobuff, msg, filename, lineno);
+#endif
+}
 
+static void HL_DefaultDebugFunction(char* filename, int lineno, HL_Debug lvl,
+  const char* fmt, ...)
+{
+  char msgbuff[512];
   va_list alist;
+
+  if (hlhdfDbg.dbgLevel == HLHDF_SILENT || lvl < hlhdfDbg.dbgLevel) {
+    return;
+  }
+
   va_start(alist,fmt);
+  vsnprintf(msgbuff, 512, fmt, alist);
+  va_end(alist);
+  writeDebugMessage(time(NULL), filename, lineno, lvl, msgbuff);
+}
+
+static void HL_AsyncDebugFunction(char* filename, int lineno, HL_Debug lvl,
+  const char* fmt, ...)
+{
+  char msgbuff[ASYNC_MESSAGE_LENGTH];
+  va_list alist;
 
-  if (hlhdfDbg.dbgLevel == HLHDF_SILENT) {
+  if (hlhdfDbg.dbgLevel == HLHDF_SILENT || lvl < hlhdfDbg.dbgLevel) {
     return;
   }
 
-  setLogTime(strtime, 24);
-
-  strcpy(dbgtype, "");
-
-  if (lvl >= hlhdfDbg.dbgLevel) {
-    switch (lvl) {
-    case HLHDF_SPEWDEBUG:
-      snprintf(dbgtype, 20, "SDEBUG");
-      break;
-    case HLHDF_DEBUG:
-      snprintf(dbgtype, 20, "DEBUG");
-      break;
-    case HLHDF_DEPRECATED:
-      snprintf(dbgtype, 20, "DEPRECATED");
-      break;
-    case HLHDF_INFO:
-      snprintf(dbgtype, 20, "INFO");
-      break;
-    case HLHDF_WARNING:
-      snprintf(dbgtype, 20, "WARNING");
-      break;
-    case HLHDF_ERROR:
-      snprintf(dbgtype, 20, "ERROR");
-      break;
-    case HLHDF_CRITICAL:
-      snprintf(dbgtype, 20, "CRITICAL");
-      break;
-    default:
-      snprintf(dbgtype, 20, "UNKNOWN");
-      break;
-    }
+  va_start(alist,fmt);
+  vsnprintf(msgbuff, ASYNC_MESSAGE_LENGTH, fmt, alist);
+  va_end(alist);
+
+  pthread_mutex_lock(&asyncSink.lock);
+  if (asyncSink.count == asyncSink.capacity) {
+    asyncSink.dropped++;
   } else {
-    return;
+    AsyncDebugMessage* m = &asyncSink.messages[(asyncSink.head + asyncSink.count) % asyncSink.capacity];
+    m->filename = filename;
+    m->lineno = lineno;
+    m->lvl = lvl;
+    m->logtime = time(NULL);
+    strcpy(m->msg, msgbuff);
+    asyncSink.count++;
+    pthread_cond_signal(&asyncSink.cond);
   }
-  snprintf(infobuff, 120, "%20s : %11s", strtime, dbgtype);
-  vsnprintf(msgbuff, 512, fmt, alist);
-#ifndef NO_HLHDF_PRINTF
-  fprintf(stderr, "%s : %s (%s:%d)\n", infobuff, msgbuff, filename, lineno);
-#endif
+  pthread_mutex_unlock(&asyncSink.lock);
+}
+
+static void* asyncDebugWriter(void* arg)
+{
+  AsyncDebugMessage m;
+  void (*target)(char* filename, int lineno, HL_Debug lvl, const char* fmt, ...) = NULL;
+  pthread_mutex_lock(&asyncSink.lock);
+  while (!asyncSink.stopping || asyncSink.count > 0) {
+    if (asyncSink.count == 0) {
+      pthread_cond_wait(&asyncSink.cond, &asyncSink.lock);
+      continue;
+    }
+    memcpy(&m, &asyncSink.messages[asyncSink.head], sizeof(AsyncDebugMessage));
+    asyncSink.head = (asyncSink.head + 1) % asyncSink.capacity;
+    asyncSink.count--;
+    target = asyncSink.target;
+    pthread_mutex_unlock(&asyncSink.lock);
+
+    if (target == HL_DefaultDebugFunction) {
+      writeDebugMessage(m.logtime, m.filename, m.lineno, m.lvl, m.msg);
+    } else if (target != NULL) {
+      target(m.filename, m.lineno, m.lvl, "%s", m.msg);
+    }
+
+    pthread_mutex_lock(&asyncSink.lock);
+  }
+  pthread_mutex_unlock(&asyncSink.lock);
+  return NULL;
 }
 
 static void HL_DefaultHdf5ErrorFunction(unsigned n, const H5E_error_t* rowmsg)
@@ -129,15 +244,20 @@ void HL_printf(const char* fmt, ...)
 #endif
 }
 
+/**
+ * Initializes the debugger structure, called once.
+ */
+static void initializeDebugger(void)
+{
+  hlhdfDbg.dbgLevel = HLHDF_SILENT;
+  hlhdfDbg.dbgfun = HL_DefaultDebugFunction;
+  hlhdfDbg.hdf5showerror = 1;
+  hlhdfDbg.hdf5fun = HL_DefaultHdf5ErrorFunction;
+}
+
 void HL_InitializeDebugger(void)
 {
-  if (initialized == 0) {
-    initialized = 1;
-    hlhdfDbg.dbgLevel = HLHDF_SILENT;
-    hlhdfDbg.dbgfun = HL_DefaultDebugFunction;
-    hlhdfDbg.hdf5showerror = 1;
-    hlhdfDbg.hdf5fun = HL_DefaultHdf5ErrorFunction;
-  }
+  pthread_once(&initializeOnce, initializeDebugger);
 }
 
 void HL_setDebugLevel(HL_Debug lvl)
@@ -148,7 +268,81 @@ void HL_setDebugLevel(HL_Debug lvl)
 void HL_setDebugFunction(void(*dbgfun)(char* filename, int lineno,
   HL_Debug lvl, const char* fmt, ...))
 {
-  hlhdfDbg.dbgfun = dbgfun;
+  pthread_mutex_lock(&asyncSink.lock);
+  if (asyncSink.enabled) {
+    asyncSink.target = dbgfun;
+  } else {
+    hlhdfDbg.dbgfun = dbgfun;
+  }
+  pthread_mutex_unlock(&asyncSink.lock);
+}
+
+int HL_enableAsyncDebugSink(size_t capacity)
+{
+  AsyncDebugMessage* messages = NULL;
+  int status = 0;
+
+  if (capacity == 0) {
+    return 0;
+  }
+  pthread_once(&asyncSinkForkOnce, registerAsyncSinkForkHandlers);
+  pthread_mutex_lock(&asyncSink.lock);
+  if (asyncSink.enabled) {
+    status = 1;
+    goto done;
+  }
+  if ((messages = malloc(sizeof(AsyncDebugMessage) * capacity)) == NULL) {
+    goto done;
+  }
+  asyncSink.messages = messages;
+  asyncSink.capacity = capacity;
+  asyncSink.head = 0;
+  asyncSink.count = 0;
+  asyncSink.dropped = 0;
+  asyncSink.stopping = 0;
+  asyncSink.target = hlhdfDbg.dbgfun;
+  if (pthread_create(&asyncSink.thread, NULL, asyncDebugWriter, NULL) != 0) {
+    free(messages);
+    asyncSink.messages = NULL;
+    goto done;
+  }
+  asyncSink.enabled = 1;
+  hlhdfDbg.dbgfun = HL_AsyncDebugFunction;
+  status = 1;
+done:
+  pthread_mutex_unlock(&asyncSink.lock);
+  return status;
+}
+
+void HL_disableAsyncDebugSink(void)
+{
+  pthread_mutex_lock(&asyncSink.lock);
+  if (!asyncSink.enabled) {
+    pthread_mutex_unlock(&asyncSink.lock);
+    return;
+  }
+  hlhdfDbg.dbgfun = asyncSink.target;
+  asyncSink.stopping = 1;
+  pthread_cond_signal(&asyncSink.cond);
+  pthread_mutex_unlock(&asyncSink.lock);
+
+  pthread_join(asyncSink.thread, NULL);
+
+  pthread_mutex_lock(&asyncSink.lock);
+  free(asyncSink.messages);
+  asyncSink.messages = NULL;
+  asyncSink.capacity = 0;
+  asyncSink.enabled = 0;
+  pthread_mutex_unlock(&asyncSink.lock);
+}
+
+unsigned long HL_getDroppedDebugMessages(void)
+{
+  unsigned long result = 0;
+  pthread_mutex_lock(&asyncSink.lock);
+  result = asyncSink.dropped;
+  pthread_mutex_unlock(&asyncSink.lock);
+  return result;
 }
 
 void HL_disableHdf5ErrorReporting(void)
@@ -28,6 +28,7 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 #define HLHDF_DEBUG_H
 
 #include <H5Epublic.h>
+#include <stddef.h>
 
 /**
  * Debug levels. The levels are defined so that if HLHDF_INFO debug level is turned on,
@@ -56,7 +57,13 @@ typedef struct {
 } hlhdf_debug_struct;
 
 /**
- * The main structure used for routing errors and debug printouts.
+ * The main structure used for routing errors and debug printouts. This is process
+ * wide configuration that is shared by all threads, it is normally only set up
+ * once at startup. It is deliberately not kept per thread: the threads started by
+ * the library, like the asynchronous I/O, prefetch and debug sink threads, must log
+ * with the level and debug function that the application has configured, which
+ * they would not get from a per thread copy. Configure it before any other thread
+ * uses the library since the fields are read without locking.
  */
 extern hlhdf_debug_struct hlhdfDbg;
 
@@ -82,11 +89,38 @@ void HL_setDebugLevel(HL_Debug lvl);
 
 /**
  * Sets the debug function where the debug printouts should be routed.
+ * Note that the debug macros will filter out messages with a level below the
+ * current debug level before the function is called.
  * @ingroup hlhdf_c_apis
  * @param[in] dbgfun The debug function.
  */
 void HL_setDebugFunction(void (*dbgfun)(char* filename, int lineno, HL_Debug lvl, const char* fmt, ...));
 
+/**
+ * Routes the debug printouts through a ring buffer that is emptied by a background
+ * thread into the current debug function. The reporting thread will only have to
+ * format the message, if the buffer is full the message is dropped.
+ * @ingroup hlhdf_c_apis
+ * @param[in] capacity the number of messages that the ring buffer can hold
+ * @return 1 on success (or if already enabled), otherwise 0
+ */
+int HL_enableAsyncDebugSink(size_t capacity);
+
+/**
+ * Writes all pending messages, stops the background thread and restores the
+ * debug function. Must not be called while other threads are reporting messages.
+ * @ingroup hlhdf_c_apis
+ */
+void HL_disableAsyncDebugSink(void);
+
+/**
+ * Returns the number of messages that has been dropped by the asynchronous debug
+ * sink since it was enabled.
+ * @ingroup hlhdf_c_apis
+ * @return the number of dropped messages
+ */
+unsigned long HL_getDroppedDebugMessages(void);
+
 /**
  * Sets the HDF5 error reporting function.
  * @ingroup hlhdf_c_apis
@@ -118,117 +152,131 @@ herr_t HL_hdf5_debug_function(hid_t estack, void *inv);
  * @defgroup DebugMacros Macros for debugging and error reporting that is used in HLHDF.
  */
 /*@{*/
+/**
+ * Evaluates to true if messages with level lvl will be reported. It is cheap enough
+ * to be used for guarding expensive debug code in hot paths.
+ */
+#define HL_isDebugLevelEnabled(lvl) ((lvl) >= hlhdfDbg.dbgLevel)
+
+/**
+ * Calls the debug function with the parenthesized argument list args if lvl
+ * is enabled. Neither the debug function nor the arguments are evaluated when
+ * the level is filtered out.
+ */
+#define HL_DBG_LOG(lvl, args) \
+do { if (HL_isDebugLevelEnabled(lvl)) { hlhdfDbg.dbgfun args; } } while (0)
+
 #ifdef DEBUG_HLHDF
 /**
  * Spewdebug macro taking one text string.
  */
 #define HL_SPEWDEBUG0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg)
+HL_DBG_LOG(HLHDF_SPEWDEBUG,(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg))
 
 /**
  * Spewdebug macro taking one text string and one formatter argument.
  */
 #define HL_SPEWDEBUG1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg,arg1)
+HL_DBG_LOG(HLHDF_SPEWDEBUG,(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg,arg1))
 
 #define HL_SPEWDEBUG2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_SPEWDEBUG,(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg,arg1,arg2))
 
 #define HL_SPEWDEBUG3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_SPEWDEBUG,(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg,arg1,arg2,arg3))
 
 #define HL_SPEWDEBUG4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_SPEWDEBUG,(__FILE__,__LINE__,HLHDF_SPEWDEBUG,msg,arg1,arg2,arg3,arg4))
 
 #define HL_DEBUG0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEBUG,msg)
+HL_DBG_LOG(HLHDF_DEBUG,(__FILE__,__LINE__,HLHDF_DEBUG,msg))
 
 #define HL_DEBUG1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEBUG,msg,arg1)
+HL_DBG_LOG(HLHDF_DEBUG,(__FILE__,__LINE__,HLHDF_DEBUG,msg,arg1))
 
 #define HL_DEBUG2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEBUG,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_DEBUG,(__FILE__,__LINE__,HLHDF_DEBUG,msg,arg1,arg2))
 
 #define HL_DEBUG3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEBUG,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_DEBUG,(__FILE__,__LINE__,HLHDF_DEBUG,msg,arg1,arg2,arg3))
 
 #define HL_DEBUG4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEBUG,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_DEBUG,(__FILE__,__LINE__,HLHDF_DEBUG,msg,arg1,arg2,arg3,arg4))
 
 #define HL_DEPRECATED0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEPRECATED,msg)
+HL_DBG_LOG(HLHDF_DEPRECATED,(__FILE__,__LINE__,HLHDF_DEPRECATED,msg))
 
 #define HL_DEPRECATED1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEPRECATED,msg,arg1)
+HL_DBG_LOG(HLHDF_DEPRECATED,(__FILE__,__LINE__,HLHDF_DEPRECATED,msg,arg1))
 
 #define HL_DEPRECATED2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEPRECATED,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_DEPRECATED,(__FILE__,__LINE__,HLHDF_DEPRECATED,msg,arg1,arg2))
 
 #define HL_DEPRECATED3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEPRECATED,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_DEPRECATED,(__FILE__,__LINE__,HLHDF_DEPRECATED,msg,arg1,arg2,arg3))
 
 #define HL_DEPRECATED4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_DEPRECATED,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_DEPRECATED,(__FILE__,__LINE__,HLHDF_DEPRECATED,msg,arg1,arg2,arg3,arg4))
 
 #define HL_INFO0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg))
 
 #define HL_INFO1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg,arg1)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg,arg1))
 
 #define HL_INFO2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2))
 
 #define HL_INFO3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2,arg3))
 
 #define HL_INFO4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2,arg3,arg4))
 
 #define HL_WARNING0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg))
 
 #define HL_WARNING1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1))
 
 #define HL_WARNING2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2))
 
 #define HL_WARNING3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2,arg3))
 
 #define HL_WARNING4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2,arg3,arg4))
 
 #define HL_ERROR0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg))
 
 #define HL_ERROR1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1))
 
 #define HL_ERROR2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2))
 
 #define HL_ERROR3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2,arg3))
 
 #define HL_ERROR4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2,arg3,arg4))
 
 #define HL_CRITICAL0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg))
 
 #define HL_CRITICAL1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1))
 
 #define HL_CRITICAL2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2))
 
 #define HL_CRITICAL3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2,arg3))
 
 #define HL_CRITICAL4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2,arg3,arg4))
 
 #define HL_ASSERT(expr, msg) \
 if(!expr) { \
@@ -285,83 +333,83 @@ abort(); \
 
 /** Info macro taking one text string.*/
 #define HL_INFO0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg))
 
 /** Info macro taking one text string and one argument.*/
 #define HL_INFO1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg,arg1)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg,arg1))
 
 /** Info macro taking one text string and two arguments.*/
 #define HL_INFO2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2))
 
 /** Info macro taking one text string and three arguments.*/
 #define HL_INFO3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2,arg3))
 
 /** Info macro taking one text string and four arguments.*/
 #define HL_INFO4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_INFO,(__FILE__,__LINE__,HLHDF_INFO,msg,arg1,arg2,arg3,arg4))
 
 /** Warning macro taking one text string.*/
 #define HL_WARNING0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg))
 
 /** Warning macro taking one text string and one argument.*/
 #define HL_WARNING1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1))
 
 /** Warning macro taking one text string and two arguments.*/
 #define HL_WARNING2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2))
 
 /** Warning macro taking one text string and three arguments.*/
 #define HL_WARNING3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2,arg3))
 
 /** Warning macro taking one text string and four arguments.*/
 #define HL_WARNING4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_WARNING,(__FILE__,__LINE__,HLHDF_WARNING,msg,arg1,arg2,arg3,arg4))
 
 /** Error macro taking one text string.*/
 #define HL_ERROR0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg))
 
 /** Error macro taking one text string and one argument.*/
 #define HL_ERROR1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1))
 
 /** Error macro taking one text string and two arguments.*/
 #define HL_ERROR2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2))
 
 /** Error macro taking one text string and three arguments.*/
 #define HL_ERROR3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2,arg3))
 
 /** Error macro taking one text string and four arguments.*/
 #define HL_ERROR4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_ERROR,(__FILE__,__LINE__,HLHDF_ERROR,msg,arg1,arg2,arg3,arg4))
 
 /** Critical macro taking one text string.*/
 #define HL_CRITICAL0(msg) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg))
 
 /** Critical macro taking one text string and one argument.*/
 #define HL_CRITICAL1(msg,arg1) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1))
 
 /** Critical macro taking one text string and two arguments.*/
 #define HL_CRITICAL2(msg,arg1,arg2) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2))
 
 /** Critical macro taking one text string and three arguments.*/
 #define HL_CRITICAL3(msg,arg1,arg2,arg3) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2,arg3)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2,arg3))
 
 /** Critical macro taking one text string and four arguments.*/
 #define HL_CRITICAL4(msg,arg1,arg2,arg3,arg4) \
-hlhdfDbg.dbgfun(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2,arg3,arg4)
+HL_DBG_LOG(HLHDF_CRITICAL,(__FILE__,__LINE__,HLHDF_CRITICAL,msg,arg1,arg2,arg3,arg4))
 
 #ifdef NO_HLHDF_ABORT
 
@@ -77,5 +77,61 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
  */
 #define DEFAULT_SIZE_NODELIST 20
 
+/**
+ * Prefix of the hidden attributes in which the statistics of a dataset are stored,
+ * see HL_Compression#summary_tile_size, and in which it is recorded how the dataset
+ * was written. Only the attributes named below are hidden when a nodelist is read,
+ * other attributes with this prefix are read as usual.
+ */
+#define HLHDF_SUMMARY_PREFIX "_hlhdf_"
+
+/**
+ * @{ Names of the hidden statistics attributes.
+ */
+#define HLHDF_SUMMARY_VALID_COUNT HLHDF_SUMMARY_PREFIX "valid_count"
+#define HLHDF_SUMMARY_NODATA_COUNT HLHDF_SUMMARY_PREFIX "nodata_count"
+#define HLHDF_SUMMARY_UNDETECT_COUNT HLHDF_SUMMARY_PREFIX "undetect_count"
+#define HLHDF_SUMMARY_MIN HLHDF_SUMMARY_PREFIX "min"
+#define HLHDF_SUMMARY_MAX HLHDF_SUMMARY_PREFIX "max"
+#define HLHDF_SUMMARY_SUM HLHDF_SUMMARY_PREFIX "sum"
+#define HLHDF_SUMMARY_TILE_SIZE HLHDF_SUMMARY_PREFIX "tile_size"
+#define HLHDF_SUMMARY_TILE_MIN HLHDF_SUMMARY_PREFIX "tile_min"
+#define HLHDF_SUMMARY_TILE_MAX HLHDF_SUMMARY_PREFIX "tile_max"
+/** @} */
+
+/**
+ * Name of the hidden attribute with the number of mantissa bits that were kept when
+ * a dataset was written, see HL_Compression#keep_bits.
+ */
+#define HLHDF_KEEP_BITS_ATTRIBUTE HLHDF_SUMMARY_PREFIX "keep_bits"
+
+/**
+ * @brief Storage class for variables that should have one instance per thread.
+ */
+#if defined(__GNUC__)
+#define HLHDF_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define HLHDF_THREAD_LOCAL _Thread_local
+#else
+#define HLHDF_THREAD_LOCAL
+#endif
+
+/**
+ * Atomic increment/decrement of reference counters, both returns the new value.
+ * Falls back to plain arithmetic when the compiler lacks the builtins.
+ * Load and store are used for flags that are read without holding a lock.
+ */
+#if defined(__GNUC__)
+#define HLHDF_ATOMIC_INCREMENT(x) __atomic_add_fetch(&(x), 1, __ATOMIC_RELAXED)
+#define HLHDF_ATOMIC_DECREMENT(x) __atomic_sub_fetch(&(x), 1, __ATOMIC_ACQ_REL)
+#define HLHDF_ATOMIC_LOAD(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define HLHDF_ATOMIC_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define HLHDF_ATOMIC_INCREMENT(x) (++(x))
+#define HLHDF_ATOMIC_DECREMENT(x) (--(x))
+#define HLHDF_ATOMIC_LOAD(x) (x)
+#define HLHDF_ATOMIC_STORE(x, v) ((x) = (v))
+#endif
+
 
 #endif
@@ -0,0 +1,191 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * The HDF5 filters that HLHDF implements.
+ * @file
+ */
+#include "hlhdf.h"
+#include "hlhdf_debug.h"
+#include "hlhdf_filter_private.h"
+#include "hlhdf_convert_private.h"
+#include <string.h>
+
+/*@{ Private definitions */
+/**
+ * Number of client data values of the delta filter: the size of the values,
+ * the number of values in a row and 1 if the values are big endian.
+ */
+#define HLHDF_DELTA_FILTER_NVALUES 3
+/*@} End of Private definitions */
+
+/*@{ Private functions */
+/**
+ * Reverses the bytes of n values of size bytes each.
+ * @param[in] data the values
+ * @param[in] n the number of values
+ * @param[in] size the size of each value
+ */
+static void HLFilter_swapBytes(unsigned char* data, size_t n, size_t size)
+{
+  size_t i = 0, j = 0;
+  for (i = 0; i < n; i++, data += size) {
+    for (j = 0; j < size / 2; j++) {
+      unsigned char tmp = data[j];
+      data[j] = data[size - 1 - j];
+      data[size - 1 - j] = tmp;
+    }
+  }
+}
+
+/**
+ * Returns if this machine is big endian.
+ * @return 1 if big endian, otherwise 0
+ */
+static int HLFilter_isBigEndian(void)
+{
+  const unsigned short probe = 1;
+  return *((const unsigned char*)&probe) == 0;
+}
+
+/**
+ * The delta filter only applies to integers of the sizes that there are kernels for.
+ * @param[in] dcpl the dataset creation property list
+ * @param[in] type the type of the dataset
+ * @param[in] space the dataspace of the dataset
+ * @return 1 if the filter can be applied, 0 if not and < 0 on failure
+ */
+static htri_t HLFilter_deltaCanApply(hid_t dcpl, hid_t type, hid_t space)
+{
+  if (H5Tget_class(type) != H5T_INTEGER) {
+    return 0;
+  }
+  return (HLConvertPrivate_getDeltaKernel(H5Tget_size(type), 0) != NULL) ? 1 : 0;
+}
+
+/**
+ * Stores the size and byte order of the values and the length of the rows of the chunks
+ * in the client data of the delta filter.
+ * @param[in] dcpl the dataset creation property list
+ * @param[in] type the type of the dataset
+ * @param[in] space the dataspace of the dataset
+ * @return >= 0 on success, otherwise failure
+ */
+static herr_t HLFilter_deltaSetLocal(hid_t dcpl, hid_t type, hid_t space)
+{
+  hsize_t chunk[H5S_MAX_RANK];
+  unsigned int values[HLHDF_DELTA_FILTER_NVALUES];
+  unsigned int flags = 0;
+  size_t nvalues = HLHDF_DELTA_FILTER_NVALUES;
+  int ndims = 0;
+
+  if ((ndims = H5Pget_chunk(dcpl, H5S_MAX_RANK, chunk)) <= 0 ||
+      H5Pget_filter_by_id2(dcpl, HLHDF_DELTA_FILTER, &flags, &nvalues, values, 0, NULL, NULL) < 0) {
+    return -1;
+  }
+  values[0] = (unsigned int)H5Tget_size(type);
+  values[1] = (unsigned int)chunk[ndims - 1];
+  values[2] = (H5Tget_order(type) == H5T_ORDER_BE) ? 1 : 0;
+  return H5Pmodify_filter(dcpl, HLHDF_DELTA_FILTER, flags, HLHDF_DELTA_FILTER_NVALUES, values);
+}
+
+/**
+ * Applies or inverts the delta predictor on each row of a chunk. The values are
+ * swapped into the byte order of this machine while the kernel runs so that files
+ * are read correctly regardless of where they were written.
+ * @param[in] flags H5Z_FLAG_REVERSE when the chunk is read
+ * @param[in] cd_nelmts the number of client data values
+ * @param[in] cd_values the client data values, see @ref HLHDF_DELTA_FILTER_NVALUES
+ * @param[in] nbytes the number of bytes in the chunk
+ * @param[in,out] buf_size the size of the buffer
+ * @param[in,out] buf the chunk, changed in place
+ * @return the number of bytes in the chunk or 0 on failure
+ */
+static size_t HLFilter_delta(unsigned int flags, size_t cd_nelmts, const unsigned int cd_values[],
+  size_t nbytes, size_t* buf_size, void** buf)
+{
+  HL_DeltaKernel kernel = NULL;
+  unsigned char* data = (unsigned char*)*buf;
+  size_t size = 0, rowLength = 0, n = 0, i = 0;
+  int swap = 0;
+
+  if (cd_nelmts < HLHDF_DELTA_FILTER_NVALUES) {
+    HL_ERROR0("The delta filter is missing its parameters");
+    return 0;
+  }
+  size = cd_values[0];
+  rowLength = cd_values[1];
+  swap = (cd_values[2] != 0) != HLFilter_isBigEndian();
+  if (rowLength == 0 || (kernel = HLConvertPrivate_getDeltaKernel(size, (flags & H5Z_FLAG_REVERSE) != 0)) == NULL) {
+    HL_ERROR2("The delta filter does not support values of size %u in rows of %u", cd_values[0], cd_values[1]);
+    return 0;
+  }
+  n = nbytes / size;
+  if (swap) {
+    HLFilter_swapBytes(data, n, size);
+  }
+  for (i = 0; i < n; i += rowLength) {
+    kernel(data + i * size, (n - i < rowLength) ? n - i : rowLength);
+  }
+  if (swap) {
+    HLFilter_swapBytes(data, n, size);
+  }
+  return nbytes;
+}
+
+/**
+ * The delta filter, see @ref HL_PredictorType#PT_DELTA.
+ */
+static const H5Z_class2_t HLFilter_deltaClass = {
+  H5Z_CLASS_T_VERS,
+  (H5Z_filter_t)HLHDF_DELTA_FILTER,
+  1, /* encoder present */
+  1, /* decoder present */
+  "hlhdf delta predictor",
+  HLFilter_deltaCanApply,
+  HLFilter_deltaSetLocal,
+  HLFilter_delta
+};
+
+int HLFilterPrivate_register(void)
+{
+  if (H5Zregister(&HLFilter_deltaClass) < 0) {
+    HL_ERROR0("Failed to register the delta filter");
+    return 0;
+  }
+  return 1;
+}
+
+int HLFilterPrivate_addPredictor(hid_t props, hid_t type_id, HL_PredictorType predictor)
+{
+  if (predictor != PT_DELTA || H5Tget_class(type_id) != H5T_INTEGER ||
+      HLConvertPrivate_getDeltaKernel(H5Tget_size(type_id), 0) == NULL) {
+    return 0;
+  }
+  if (H5Pset_filter(props, HLHDF_DELTA_FILTER, H5Z_FLAG_MANDATORY, 0, NULL) < 0) {
+    HL_ERROR0("Failed to add the delta filter");
+    return -1;
+  }
+  return 1;
+}
+const H5Z_class2_t* HLFilterPrivate_getDeltaClass(void)
+{
+  return &HLFilter_deltaClass;
+}
+/*@} End of Private functions */
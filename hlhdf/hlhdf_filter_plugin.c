@@ -0,0 +1,40 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * The HDF5 plugin entry points of the delta filter, see @ref HLHDF_DELTA_FILTER.
+ * This file is built into the filter plugin and not into the library, so that
+ * applications linking with HLHDF do not export the entry points.
+ * @file
+ */
+#include "hlhdf.h"
+#include "hlhdf_filter_private.h"
+#include <H5PLextern.h>
+
+/*@{ Interface functions */
+H5PL_type_t H5PLget_plugin_type(void)
+{
+  return H5PL_TYPE_FILTER;
+}
+
+const void* H5PLget_plugin_info(void)
+{
+  return HLFilterPrivate_getDeltaClass();
+}
+/*@} End of Interface functions */
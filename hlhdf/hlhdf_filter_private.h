@@ -0,0 +1,51 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * Private functions for the HDF5 filters that HLHDF implements.
+ * @file
+ */
+#ifndef HLHDF_FILTER_PRIVATE_H
+#define HLHDF_FILTER_PRIVATE_H
+#include "hlhdf_types.h"
+
+/**
+ * Registers the filters with HDF5 so that datasets can be written and read with them,
+ * see @ref HLHDF_DELTA_FILTER.
+ * @return 1 on success, otherwise 0
+ */
+int HLFilterPrivate_register(void);
+
+/**
+ * Adds the filter of a predictor to the filter pipeline of a dataset creation property
+ * list. It must be added before any compression filter.
+ * @param[in] props the dataset creation property list, must have a chunked layout
+ * @param[in] type_id the type of the dataset
+ * @param[in] predictor the predictor
+ * @return 1 if the filter was added, 0 if the predictor does not apply to the type and -1 on failure
+ */
+int HLFilterPrivate_addPredictor(hid_t props, hid_t type_id, HL_PredictorType predictor);
+
+/**
+ * Returns the filter class of the delta filter, used by the filter plugin.
+ * @return the filter class
+ */
+const H5Z_class2_t* HLFilterPrivate_getDeltaClass(void);
+
+#endif /* HLHDF_FILTER_PRIVATE_H */
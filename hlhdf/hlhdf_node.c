@@ -28,11 +28,33 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 #include "hlhdf_private.h"
 #include "hlhdf_defines_private.h"
 #include "hlhdf_node_private.h"
+#include "hlhdf_convert_private.h"
 #include "hlhdf_debug.h"
 #include <string.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 /*@{ Structs */
+/**
+ * A reference counted data buffer. Copies of a node shares the same buffer
+ * and the buffer is released when the last node referring to it is freed.
+ */
+struct _HL_NodeBuffer {
+  int refcount;               /**< Number of nodes referring to this buffer */
+  unsigned char* data;        /**< The data */
+  void* owner;                /**< The owner of data, passed to freefn */
+  void (*freefn)(void*);      /**< Function used for releasing owner, if NULL, data is released with HLHDF_FREE */
+};
+
+/**
+ * Prefetch state of a node, see @ref HLNodeList_prefetch.
+ */
+typedef enum HL_NodePrefetch {
+  PREFETCH_NONE=0, /**< Not prefetched */
+  PREFETCH_RUNNING, /**< The data is being read by the prefetch thread */
+  PREFETCH_DONE    /**< The data has been prefetched but not yet claimed by a fetch */
+} HL_NodePrefetch;
+
 /**
  * Represents a HDF5 object/attribute/reference/...
  * @ingroup hlhdf_c_apis
@@ -44,6 +66,8 @@ struct _HL_Node {
    hsize_t* dims;              /**< The dimension size */
    unsigned char* data;        /**< The data in fixed-type format */
    unsigned char* rawdata;     /**< Unconverted data, exactly as read from the file */
+   HL_NodeBuffer* dataBuffer;  /**< The buffer owning data, might be shared with other nodes */
+   HL_NodeBuffer* rawdataBuffer; /**< The buffer owning rawdata, might be shared with other nodes */
    HL_FormatSpecifier format;  /**< @ref ValidFormatSpecifiers "Format specifier" */
    hid_t typeId;               /**< HDF5 type identifier */
    size_t dSize;               /**< Size for data (fixed type) */
@@ -54,12 +78,60 @@ struct _HL_Node {
    int fetched;                /**< 0 if the data has not been fetched from disk, otherwise 0 */
    HL_CompoundTypeDescription* compoundDescription; /**< The compound type description if this is a TYPE node*/
    HL_Compression* compression; /**< Compression settings for this node */
+   int prefetch;               /**< The @ref HL_NodePrefetch state */
+   HL_FileSession* fileSession; /**< The file to load the data from on first access, may be NULL */
+   HL_DataCache* cache;        /**< The cache accounting for the data, may be NULL */
+   struct _HL_Node* cachePrev; /**< Previous (more recently used) node in the cache */
+   struct _HL_Node* cacheNext; /**< Next (less recently used) node in the cache */
+   size_t cachedSize;          /**< Number of bytes accounted in the cache, 0 if not in the cache */
+   HL_DataStatistics* statistics; /**< Statistics computed when the data was fetched, may be NULL */
+};
+
+/**
+ * Keeps track of the dataset payloads in a nodelist and evicts the least
+ * recently used ones when the budget is exceeded, see @ref HLNodeList_setDataBudget.
+ */
+struct _HL_DataCache {
+  pthread_mutex_t lock; /**< protects the cache and the cache fields of the nodes */
+  size_t budget;        /**< the budget in bytes */
+  size_t used;          /**< the number of bytes in the cache */
+  HL_Node* first;       /**< the most recently used node */
+  HL_Node* last;        /**< the least recently used node */
 };
 
 /*@{ End of Structs */
 
+/*@{ Private variables */
+/**
+ * Protects the prefetch state of all nodes.
+ */
+static pthread_mutex_t prefetchLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Signalled when a node has been prefetched.
+ */
+static pthread_cond_t prefetchDone = PTHREAD_COND_INITIALIZER;
+/*@} End of Private variables */
+
 /*@{ Static functions */
 
+/**
+ * Waits until the node no longer is being prefetched. Must not be called
+ * with the HDF5 lock held since the prefetch thread needs it.
+ * @param[in] node the node
+ */
+static void HLNode_waitForPrefetch(HL_Node* node)
+{
+  if (HLHDF_ATOMIC_LOAD(node->prefetch) != PREFETCH_RUNNING) {
+    return;
+  }
+  pthread_mutex_lock(&prefetchLock);
+  while (node->prefetch == PREFETCH_RUNNING) {
+    pthread_cond_wait(&prefetchDone, &prefetchLock);
+  }
+  pthread_mutex_unlock(&prefetchLock);
+}
+
 static HL_Node* newHL_NodeWithType(const char* name, HL_Type type)
 {
   HL_Node* retv = NULL;
@@ -86,6 +158,398 @@ static hid_t HLNode_createStringType(size_t length)
   return type;
 }
 
+/**
+ * Creates the type id that should be used for a value set with
+ * HLNode_setScalarValue or HLNode_setArrayValue.
+ * @param[in] format the format specifier
+ * @param[in] fmt the format name
+ * @param[in] sz the size of one value
+ * @param[in] typid the type id provided by the user, -1 if it should be derived from fmt
+ * @return the type id or a negative value on failure
+ */
+static hid_t HLNode_createValueType(HL_FormatSpecifier format, const char* fmt, size_t sz, hid_t typid)
+{
+  hid_t type = -1;
+  HL_lockHdf5();
+  if (format == HLHDF_STRING && typid < 0) {
+    type = HLNode_createStringType(sz);
+    if (type < 0) {
+      HL_ERROR0("Failed to create string type\n");
+    }
+  } else if (format == HLHDF_COMPOUND && typid < 0) {
+    HL_ERROR0("Atempting to set compound data with no type id");
+  } else {
+    if (typid < 0) {
+      type = HL_translateFormatStringToDatatype(fmt);
+    } else {
+      type = H5Tcopy(typid);
+    }
+  }
+  HL_unlockHdf5();
+  return type;
+}
+
+/**
+ * Closes the type id and sets it to -1.
+ * @param[in,out] type the type id to close
+ */
+static void HLNode_closeType(hid_t* type)
+{
+  if (*type >= 0) {
+    HL_lockHdf5();
+    HL_H5T_CLOSE(*type);
+    HL_unlockHdf5();
+  }
+}
+
+/**
+ * Creates a buffer with reference count 1 that takes over the ownership of data.
+ * If the buffer not can be created, data will be released.
+ * @param[in] data the data, may be NULL
+ * @param[in] owner the owner of data that is passed to freefn
+ * @param[in] freefn the function used for releasing owner, NULL if data should be released with HLHDF_FREE
+ * @return the buffer or NULL if data was NULL or memory not could be allocated
+ */
+static HL_NodeBuffer* HLNodeBuffer_new(unsigned char* data, void* owner, void (*freefn)(void*))
+{
+  HL_NodeBuffer* retv = NULL;
+  if (data == NULL) {
+    return NULL;
+  }
+  retv = (HL_NodeBuffer*)HLHDF_MALLOC(sizeof(HL_NodeBuffer));
+  if (retv == NULL) {
+    HL_ERROR0("Failed to allocate node buffer");
+    if (freefn != NULL) {
+      freefn(owner);
+    } else {
+      HLHDF_FREE(data);
+    }
+    return NULL;
+  }
+  retv->refcount = 1;
+  retv->data = data;
+  retv->owner = owner;
+  retv->freefn = freefn;
+  return retv;
+}
+
+/**
+ * Adds a reference to the buffer.
+ * @param[in] buffer the buffer, may be NULL
+ * @return the buffer
+ */
+static HL_NodeBuffer* HLNodeBuffer_ref(HL_NodeBuffer* buffer)
+{
+  if (buffer != NULL) {
+    HLHDF_ATOMIC_INCREMENT(buffer->refcount);
+  }
+  return buffer;
+}
+
+/**
+ * Removes a reference from the buffer and releases it when no references
+ * remains. The pointer is set to NULL.
+ * @param[in,out] buffer the buffer, may point to NULL
+ */
+static void HLNodeBuffer_release(HL_NodeBuffer** buffer)
+{
+  HL_NodeBuffer* b = *buffer;
+  *buffer = NULL;
+  if (b != NULL && HLHDF_ATOMIC_DECREMENT(b->refcount) == 0) {
+    if (b->freefn != NULL) {
+      b->freefn(b->owner);
+    } else {
+      HLHDF_FREE(b->data);
+    }
+    HLHDF_FREE(b);
+  }
+}
+
+/**
+ * Replaces the data buffer of the node. The node takes over the reference
+ * to buffer and releases the previous one.
+ * @param[in] node the node
+ * @param[in] buffer the new buffer, may be NULL
+ */
+static void HLNode_setDataBuffer(HL_Node* node, HL_NodeBuffer* buffer)
+{
+  HLNodeBuffer_release(&node->dataBuffer);
+  node->dataBuffer = buffer;
+  node->data = (buffer != NULL) ? buffer->data : NULL;
+}
+
+/**
+ * Free function for borrowed buffers, the data is owned by the caller.
+ * @param[in] owner not used
+ */
+static void HLNodeBuffer_borrowed(void* owner)
+{
+}
+
+/**
+ * Returns if the buffer is borrowed from the caller.
+ * @param[in] buffer the buffer, may be NULL
+ * @return 1 if the buffer is borrowed, otherwise 0
+ */
+static int HLNodeBuffer_isBorrowed(HL_NodeBuffer* buffer)
+{
+  return (buffer != NULL && buffer->freefn == HLNodeBuffer_borrowed);
+}
+
+/**
+ * Calculates the number of points from the dimensions.
+ * @param[in] ndims the rank
+ * @param[in] dims the dimensions
+ * @return the number of points
+ */
+static size_t HLNode_getNumberOfPointsFromDims(int ndims, hsize_t* dims)
+{
+  size_t npts = 1;
+  int i = 0;
+  for (i = 0; i < ndims; i++) {
+    npts *= dims[i];
+  }
+  return npts;
+}
+
+/**
+ * Creates a private copy of the node data.
+ * @param[in] node the node
+ * @return a new buffer with the duplicated data or NULL on failure
+ */
+static HL_NodeBuffer* HLNode_duplicateData(HL_Node* node)
+{
+  size_t sz = (size_t)HLNode_getNumberOfPoints(node) * node->dSize;
+  unsigned char* data = (unsigned char*)HLHDF_MALLOC(sz > 0 ? sz : 1);
+  if (data == NULL) {
+    HL_ERROR0("Failed to allocate memory when duplicating data");
+    return NULL;
+  }
+  memcpy(data, node->data, sz);
+  return HLNodeBuffer_new(data, NULL, NULL);
+}
+
+/**
+ * Forgets that the node has been prefetched, used when the prefetched data is dropped
+ * so that a later fetch does not claim it.
+ * @param[in] node the node
+ */
+static void HLNode_forgetPrefetch(HL_Node* node)
+{
+  pthread_mutex_lock(&prefetchLock);
+  if (node->prefetch == PREFETCH_DONE) {
+    HLHDF_ATOMIC_STORE(node->prefetch, PREFETCH_NONE);
+  }
+  pthread_mutex_unlock(&prefetchLock);
+}
+
+/**
+ * Unlinks the node from the cache. Must be called with the cache lock held.
+ * @param[in] cache the cache
+ * @param[in] node the node
+ */
+static void HLDataCache_unlink(HL_DataCache* cache, HL_Node* node)
+{
+  if (node->cachedSize == 0) {
+    return;
+  }
+  if (node->cachePrev != NULL) {
+    node->cachePrev->cacheNext = node->cacheNext;
+  } else {
+    cache->first = node->cacheNext;
+  }
+  if (node->cacheNext != NULL) {
+    node->cacheNext->cachePrev = node->cachePrev;
+  } else {
+    cache->last = node->cachePrev;
+  }
+  cache->used -= node->cachedSize;
+  node->cachePrev = node->cacheNext = NULL;
+  node->cachedSize = 0;
+}
+
+/**
+ * Puts the node first in the cache. Must be called with the cache lock held.
+ * @param[in] cache the cache
+ * @param[in] node the node, must not be in the cache
+ * @param[in] size the number of bytes to account for, must be > 0
+ */
+static void HLDataCache_pushFirst(HL_DataCache* cache, HL_Node* node, size_t size)
+{
+  node->cachePrev = NULL;
+  node->cacheNext = cache->first;
+  if (cache->first != NULL) {
+    cache->first->cachePrev = node;
+  } else {
+    cache->last = node;
+  }
+  cache->first = node;
+  node->cachedSize = size;
+  cache->used += size;
+}
+
+/**
+ * Evicts the least recently used payloads until the cache is within its budget.
+ * Only clean nodes that can be loaded again from their file session are evicted.
+ * Must be called with the cache lock held.
+ * @param[in] cache the cache
+ * @param[in] keep a node that must not be evicted, may be NULL
+ */
+static void HLDataCache_evict(HL_DataCache* cache, HL_Node* keep)
+{
+  HL_Node* node = cache->last;
+  while (cache->used > cache->budget && node != NULL) {
+    HL_Node* prev = node->cachePrev;
+    if (node != keep && node->mark == NMARK_ORIGINAL && node->fileSession != NULL &&
+        HLHDF_ATOMIC_LOAD(node->prefetch) != PREFETCH_RUNNING) {
+      HLDataCache_unlink(cache, node);
+      HLNode_setDataBuffer(node, NULL);
+      node->fetched = 0;
+      HLNode_forgetPrefetch(node);
+    }
+    node = prev;
+  }
+}
+
+/**
+ * Accounts for the data of the node in its cache, or removes it from the cache if
+ * the node has no clean dataset payload.
+ * @param[in] node the node
+ */
+static void HLNode_updateCache(HL_Node* node)
+{
+  HL_DataCache* cache = node->cache;
+  if (cache != NULL) {
+    size_t size = 0;
+    if (node->type == DATASET_ID && node->data != NULL) {
+      size = HLNode_getNumberOfPointsFromDims(node->ndims, node->dims) * node->dSize;
+    }
+    pthread_mutex_lock(&cache->lock);
+    HLDataCache_unlink(cache, node);
+    if (size > 0) {
+      HLDataCache_pushFirst(cache, node, size);
+    }
+    pthread_mutex_unlock(&cache->lock);
+  }
+}
+
+/**
+ * Removes the node from its cache.
+ * @param[in] node the node
+ */
+static void HLNode_removeFromCache(HL_Node* node)
+{
+  HL_DataCache* cache = node->cache;
+  if (cache != NULL) {
+    pthread_mutex_lock(&cache->lock);
+    HLDataCache_unlink(cache, node);
+    pthread_mutex_unlock(&cache->lock);
+  }
+}
+
+/**
+ * Marks the node as most recently used and evicts other nodes if the cache
+ * is over its budget.
+ * @param[in] node the node
+ */
+static void HLNode_touchCache(HL_Node* node)
+{
+  HL_DataCache* cache = node->cache;
+  if (cache != NULL) {
+    pthread_mutex_lock(&cache->lock);
+    if (node->cachedSize > 0 && cache->first != node) {
+      size_t size = node->cachedSize;
+      HLDataCache_unlink(cache, node);
+      HLDataCache_pushFirst(cache, node, size);
+    }
+    HLDataCache_evict(cache, node);
+    pthread_mutex_unlock(&cache->lock);
+  }
+}
+
+/**
+ * Prepares the node for access to its data. Loads the data from the file session
+ * if it not has been fetched, see @ref HLNodeList_setLazyLoading, and marks the node
+ * as most recently used in its cache. Waits if the node is being prefetched or
+ * loaded by another thread.
+ * @param[in] node the node
+ */
+static void HLNode_accessData(HL_Node* node)
+{
+  HLNode_waitForPrefetch(node);
+  if (node->fileSession != NULL && !node->fetched && node->data == NULL &&
+      (node->type == ATTRIBUTE_ID || node->type == DATASET_ID || node->type == REFERENCE_ID) &&
+      (node->mark == NMARK_ORIGINAL || node->mark == NMARK_SELECT || node->mark == NMARK_SELECTMETA)) {
+    if (HLNodePrivate_beginPrefetch(node)) {
+      HLFileSessionPrivate_fetch(node->fileSession, node);
+      HLNodePrivate_endPrefetch(node, 0); /* Nothing for a fetch to claim, the data is already in use */
+    } else {
+      HLNode_waitForPrefetch(node);
+    }
+  }
+  HLNode_touchCache(node);
+}
+
+/**
+ * Sets the value of the node from a buffer, used by the set, adopt and borrow functions.
+ * The reference to buffer is always taken over and released on failure.
+ * @param[in] node the node
+ * @param[in] sz the size of the type
+ * @param[in] ndims the rank, 0 for a scalar value
+ * @param[in] dims the dimensions, NULL for a scalar value
+ * @param[in] buffer the buffer, NULL means that the buffer not could be created
+ * @param[in] fmt the format specifier
+ * @param[in] typid the custom type or -1
+ * @return 1 on success, otherwise 0
+ */
+static int HLNode_setValueBuffer(HL_Node* node, size_t sz, int ndims, hsize_t* dims,
+  HL_NodeBuffer* buffer, const char* fmt, hid_t typid)
+{
+  HL_FormatSpecifier format = HLHDF_UNDEFINED;
+  hid_t tmptypeid = -1;
+  int status = 0;
+
+  if (buffer == NULL) {
+    goto fail;
+  }
+  HLNode_waitForPrefetch(node);
+
+  format = HL_getFormatSpecifier(fmt);
+  if (format == HLHDF_UNDEFINED || format == HLHDF_ARRAY) {
+    HL_ERROR0("When setting a node value, fmt has to be reckognized");
+    goto fail;
+  }
+
+  tmptypeid = HLNode_createValueType(format, fmt, sz, typid);
+  if (tmptypeid < 0 && (format == HLHDF_STRING || format == HLHDF_COMPOUND)) {
+    goto fail;
+  }
+
+  if (ndims > 0 && !HLNode_setDimensions(node, ndims, dims)) {
+    HL_ERROR0("Failed to set dimensions");
+    goto fail;
+  }
+
+  HLNode_closeType(&node->typeId);
+  HLNode_setDataBuffer(node, buffer);
+  HLNode_removeFromCache(node);
+  buffer = NULL;
+  node->format = format;
+  node->dSize = sz;
+  node->typeId = tmptypeid;
+  tmptypeid = -1;
+  node->dataType = (ndims > 0) ? HL_ARRAY : HL_SIMPLE;
+  HLNodePrivate_setStatistics(node, NULL);
+
+  if (node->mark != NMARK_CREATED)
+    node->mark = NMARK_CHANGED;
+
+  status = 1;
+fail:
+  HLNodeBuffer_release(&buffer);
+  HLNode_closeType(&tmptypeid);
+  return status;
+}
 
 /*@} End of Static functions */
 
@@ -93,16 +557,26 @@ static hid_t HLNode_createStringType(size_t length)
 void HLNodePrivate_setData(HL_Node* node, size_t datasize, unsigned char* data)
 {
   HL_ASSERT((node != NULL), "node was NULL");
-  HLHDF_FREE(node->data);
-  node->data = data;
+  HLNode_setDataBuffer(node, HLNodeBuffer_new(data, NULL, NULL));
+  node->dSize = datasize;
+  HLNode_updateCache(node);
+}
+
+void HLNodePrivate_setExternalData(HL_Node* node, size_t datasize, unsigned char* data,
+  void* owner, void (*releasefn)(void*))
+{
+  HL_ASSERT((node != NULL), "node was NULL");
+  HLNode_setDataBuffer(node, HLNodeBuffer_new(data, owner, (releasefn != NULL) ? releasefn : HLNodeBuffer_borrowed));
   node->dSize = datasize;
+  HLNode_updateCache(node);
 }
 
 void HLNodePrivate_setRawdata(HL_Node* node, size_t datasize, unsigned char* data)
 {
   HL_ASSERT((node != NULL), "node was NULL");
-  HLHDF_FREE(node->rawdata);
-  node->rawdata = data;
+  HLNodeBuffer_release(&node->rawdataBuffer);
+  node->rawdataBuffer = HLNodeBuffer_new(data, NULL, NULL);
+  node->rawdata = (node->rawdataBuffer != NULL) ? node->rawdataBuffer->data : NULL;
   node->rdSize = datasize;
 }
 
@@ -111,7 +585,9 @@ int HLNodePrivate_setTypeIdAndDeriveFormat(HL_Node* node, hid_t type)
   hid_t tcopy = -1;
   HL_FormatSpecifier format = HLHDF_UNDEFINED;
   HL_ASSERT((node != NULL), "node was NULL");
-  tcopy = H5Tcopy(type);
+  if (H5Iinc_ref(type) >= 0) {
+    tcopy = type;
+  }
   format = HL_getFormatSpecifierFromType(type);
 
   if (tcopy < 0 || format == HLHDF_UNDEFINED) {
@@ -173,6 +649,182 @@ hid_t HLNodePrivate_getTypeId(HL_Node* node)
   HL_ASSERT((node != NULL), "HLNodePrivate_getDims called with node == NULL");
   return node->typeId;
 }
+
+int HLNodePrivate_beginPrefetch(HL_Node* node)
+{
+  int result = 0;
+  HL_ASSERT((node != NULL), "node was NULL");
+  pthread_mutex_lock(&prefetchLock);
+  if (node->prefetch != PREFETCH_RUNNING) {
+    HLHDF_ATOMIC_STORE(node->prefetch, PREFETCH_RUNNING);
+    result = 1;
+  }
+  pthread_mutex_unlock(&prefetchLock);
+  return result;
+}
+
+void HLNodePrivate_endPrefetch(HL_Node* node, int fetched)
+{
+  HL_ASSERT((node != NULL), "node was NULL");
+  pthread_mutex_lock(&prefetchLock);
+  HLHDF_ATOMIC_STORE(node->prefetch, fetched ? PREFETCH_DONE : PREFETCH_NONE);
+  pthread_cond_broadcast(&prefetchDone);
+  pthread_mutex_unlock(&prefetchLock);
+}
+
+void HLNodePrivate_waitForPrefetch(HL_Node* node)
+{
+  HL_ASSERT((node != NULL), "node was NULL");
+  HLNode_waitForPrefetch(node);
+}
+
+int HLNodePrivate_claimPrefetched(HL_Node* node)
+{
+  int result = 0;
+  HL_ASSERT((node != NULL), "node was NULL");
+  HLNode_waitForPrefetch(node);
+  pthread_mutex_lock(&prefetchLock);
+  if (node->prefetch == PREFETCH_DONE) {
+    HLHDF_ATOMIC_STORE(node->prefetch, PREFETCH_NONE);
+    result = 1;
+  }
+  pthread_mutex_unlock(&prefetchLock);
+  return result;
+}
+
+void HLNodePrivate_setFileSession(HL_Node* node, HL_FileSession* session)
+{
+  HL_ASSERT((node != NULL), "node was NULL");
+  HLFileSessionPrivate_release(&node->fileSession);
+  node->fileSession = HLFileSessionPrivate_ref(session);
+}
+
+HL_DataCache* HLDataCachePrivate_new(size_t budget)
+{
+  HL_DataCache* retv = HLHDF_MALLOC(sizeof(HL_DataCache));
+  if (retv == NULL) {
+    HL_ERROR0("Failed to allocate memory for data cache");
+    return NULL;
+  }
+  if (pthread_mutex_init(&retv->lock, NULL) != 0) {
+    HL_ERROR0("Failed to initialize data cache lock");
+    HLHDF_FREE(retv);
+    return NULL;
+  }
+  retv->budget = budget;
+  retv->used = 0;
+  retv->first = NULL;
+  retv->last = NULL;
+  return retv;
+}
+
+void HLDataCachePrivate_free(HL_DataCache* cache)
+{
+  if (cache != NULL) {
+    HL_ASSERT((cache->first == NULL), "Data cache freed while nodes still refers to it");
+    pthread_mutex_destroy(&cache->lock);
+    HLHDF_FREE(cache);
+  }
+}
+
+void HLDataCachePrivate_setBudget(HL_DataCache* cache, size_t budget)
+{
+  HL_ASSERT((cache != NULL), "cache was NULL");
+  pthread_mutex_lock(&cache->lock);
+  cache->budget = budget;
+  HLDataCache_evict(cache, NULL);
+  pthread_mutex_unlock(&cache->lock);
+}
+
+void HLDataCachePrivate_evict(HL_DataCache* cache, HL_Node* keep)
+{
+  HL_ASSERT((cache != NULL), "cache was NULL");
+  pthread_mutex_lock(&cache->lock);
+  HLDataCache_evict(cache, keep);
+  pthread_mutex_unlock(&cache->lock);
+}
+
+size_t HLDataCachePrivate_getBudget(HL_DataCache* cache)
+{
+  HL_ASSERT((cache != NULL), "cache was NULL");
+  return cache->budget;
+}
+
+size_t HLDataCachePrivate_getUsed(HL_DataCache* cache)
+{
+  size_t used = 0;
+  HL_ASSERT((cache != NULL), "cache was NULL");
+  pthread_mutex_lock(&cache->lock);
+  used = cache->used;
+  pthread_mutex_unlock(&cache->lock);
+  return used;
+}
+
+void HLNodePrivate_setDataCache(HL_Node* node, HL_DataCache* cache)
+{
+  HL_ASSERT((node != NULL), "node was NULL");
+  HLNode_waitForPrefetch(node);
+  HLNode_removeFromCache(node);
+  node->cache = cache;
+  if (node->mark == NMARK_ORIGINAL && node->fetched) {
+    HLNode_updateCache(node);
+  }
+}
+
+void HLNodePrivate_releaseBorrowedData(HL_Node* node)
+{
+  HL_ASSERT((node != NULL), "HLNodePrivate_releaseBorrowedData called with node == NULL");
+  if (HLNodeBuffer_isBorrowed(node->dataBuffer)) {
+    HLNode_setDataBuffer(node, NULL);
+  }
+}
+
+HL_NodeBuffer* HLNodePrivate_refDataBuffer(HL_Node* node, int raw)
+{
+  HL_ASSERT((node != NULL), "HLNodePrivate_refDataBuffer called with node == NULL");
+  HLNode_accessData(node);
+  if (raw) {
+    return HLNodeBuffer_ref(node->rawdataBuffer);
+  }
+  /* Borrowed data is only guaranteed to be valid until the node is written */
+  if (HLNodeBuffer_isBorrowed(node->dataBuffer)) {
+    return HLNode_duplicateData(node);
+  }
+  return HLNodeBuffer_ref(node->dataBuffer);
+}
+
+unsigned char* HLNodePrivate_getBufferData(HL_NodeBuffer* buffer)
+{
+  HL_ASSERT((buffer != NULL), "HLNodePrivate_getBufferData called with buffer == NULL");
+  return buffer->data;
+}
+
+int HLNodePrivate_isBufferShared(HL_NodeBuffer* buffer)
+{
+  HL_ASSERT((buffer != NULL), "HLNodePrivate_isBufferShared called with buffer == NULL");
+  return HLHDF_ATOMIC_LOAD(buffer->refcount) > 1;
+}
+
+void HLNodePrivate_releaseBuffer(HL_NodeBuffer* buffer)
+{
+  HLNodeBuffer_release(&buffer);
+}
+
+int HLNodePrivate_setStatistics(HL_Node* node, const HL_DataStatistics* stats)
+{
+  HL_ASSERT((node != NULL), "HLNodePrivate_setStatistics called with node == NULL");
+  if (stats == NULL) {
+    HLHDF_FREE(node->statistics);
+    return 1;
+  }
+  if (node->statistics == NULL &&
+      (node->statistics = (HL_DataStatistics*)HLHDF_MALLOC(sizeof(HL_DataStatistics))) == NULL) {
+    HL_ERROR0("Failed to allocate memory for statistics");
+    return 0;
+  }
+  memcpy(node->statistics, stats, sizeof(HL_DataStatistics));
+  return 1;
+}
 /*@} End of Private functions */
 
 /*@{ Interface functions */
@@ -196,6 +848,8 @@ HL_Node* HLNode_new(const char* name)
   retv->dims = NULL;
   retv->data = NULL;
   retv->rawdata = NULL;
+  retv->dataBuffer = NULL;
+  retv->rawdataBuffer = NULL;
   retv->typeId = -1;
   retv->dSize = 0;
   retv->rdSize = 0;
@@ -205,6 +859,13 @@ HL_Node* HLNode_new(const char* name)
   retv->fetched = 0;
   retv->compoundDescription = NULL;
   retv->compression = NULL;
+  retv->prefetch = PREFETCH_NONE;
+  retv->fileSession = NULL;
+  retv->cache = NULL;
+  retv->cachePrev = NULL;
+  retv->cacheNext = NULL;
+  retv->cachedSize = 0;
+  retv->statistics = NULL;
 
   if (retv->name == NULL) {
     HL_ERROR0("Could not allocate memory when creating node");
@@ -221,6 +882,9 @@ void HLNode_free(HL_Node* node)
   if (!node)
     return;
 
+  HLNode_waitForPrefetch(node);
+  HLNode_removeFromCache(node);
+  HL_lockHdf5();
   if (node->typeId >= 0) {
     int enableReporting = HL_isErrorReportingEnabled();
     HL_disableErrorReporting();
@@ -231,13 +895,16 @@ void HLNode_free(HL_Node* node)
   }
 
   HLNodePrivate_setHdfID(node, -1);
+  HL_unlockHdf5();
 
   HLHDF_FREE(node->name);
   HLHDF_FREE(node->dims);
-  HLHDF_FREE(node->data);
-  HLHDF_FREE(node->rawdata);
+  HLNodeBuffer_release(&node->dataBuffer);
+  HLNodeBuffer_release(&node->rawdataBuffer);
   freeHL_CompoundTypeDescription(node->compoundDescription);
   HLCompression_free(node->compression);
+  HLFileSessionPrivate_release(&node->fileSession);
+  HLHDF_FREE(node->statistics);
   HLHDF_FREE(node);
 }
 
@@ -268,12 +935,12 @@ HL_Node* HLNode_newReference(const char* name)
 
 HL_Node* HLNode_copy(HL_Node* node)
 {
-  hsize_t npts;
   HL_Node* retv = NULL;
   HL_SPEWDEBUG0("ENTER: HLNode_copy");
   if (!node)
     return NULL;
 
+  HLNode_waitForPrefetch(node);
   retv = HLNode_new(node->name);
   if (retv == NULL) {
     goto fail;
@@ -284,17 +951,22 @@ HL_Node* HLNode_copy(HL_Node* node)
   retv->type = node->type;
   retv->dSize = node->dSize;
   retv->rdSize = node->rdSize;
-  if(!HLNode_setDimensions(retv, node->ndims, node->dims)) {
-    goto fail;
-  }
-  npts = HLNode_getNumberOfPoints(retv);
 
-  retv->data = (unsigned char*)HLHDF_MALLOC(npts*retv->dSize);
-  memcpy(retv->data,node->data,npts*retv->dSize);
+  /* The payloads are shared with the original node and only replaced when a new value is set.
+   * Borrowed data is only guaranteed to be valid until the original node is written
+   * so it has to be duplicated. */
+  if (HLNodeBuffer_isBorrowed(node->dataBuffer)) {
+    if ((retv->dataBuffer = HLNode_duplicateData(node)) == NULL) {
+      goto fail;
+    }
+  } else {
+    retv->dataBuffer = HLNodeBuffer_ref(node->dataBuffer);
+  }
+  retv->data = (retv->dataBuffer != NULL) ? retv->dataBuffer->data : NULL;
 
   if(node->rawdata!=NULL) {
-    retv->rawdata = (unsigned char*)HLHDF_MALLOC(npts*retv->rdSize);
-    memcpy(retv->rawdata,node->rawdata,npts*retv->rdSize);
+    retv->rawdataBuffer = HLNodeBuffer_ref(node->rawdataBuffer);
+    retv->rawdata = node->rawdata;
   } else {
     retv->rdSize = 0;
     retv->rawdata = NULL;
@@ -302,150 +974,99 @@ HL_Node* HLNode_copy(HL_Node* node)
   retv->format = node->format;
 
   if(node->typeId>=0) {
-    retv->typeId=H5Tcopy(node->typeId);
+    HL_lockHdf5();
+    if (H5Iinc_ref(node->typeId) >= 0) {
+      retv->typeId = node->typeId; /* Type ids are never modified so the copy can share it */
+    }
+    HL_unlockHdf5();
   }
   retv->dataType=node->dataType;
   retv->hdfId=-1; //node->hdfId;
   retv->mark=node->mark;
 
   retv->compoundDescription=copyHL_CompoundTypeDescription(node->compoundDescription);
+  retv->fileSession = HLFileSessionPrivate_ref(node->fileSession);
+  if (!HLNodePrivate_setStatistics(retv, node->statistics)) {
+    goto fail;
+  }
 
-fail:
   return retv;
+fail:
+  HLNode_free(retv);
+  return NULL;
 }
 
 int HLNode_setScalarValue(HL_Node* node, size_t sz, unsigned char* value,
   const char* fmt, hid_t typid)
 {
   unsigned char* data = NULL;
-  hid_t tmptypeid = -1;
-  HL_FormatSpecifier format = HLHDF_UNDEFINED;
-  int status = 0;
 
   HL_ASSERT((node != NULL), "HLNode_setScalarValue called with node == NULL");
   HL_SPEWDEBUG0("ENTER: HLNode_setScalarValue");
 
-  format = HL_getFormatSpecifier(fmt);
-  if (format == HLHDF_UNDEFINED || format == HLHDF_ARRAY) {
-    HL_ERROR0("When setting a node value, fmt has to be reckognized");
-    goto fail;
-  }
-
   if ((data = (unsigned char*) HLHDF_MALLOC(sz))==NULL) {
     HL_ERROR0("Failed to allocate memory");
-    goto fail;
+    return 0;
   }
   memcpy(data, value, sz);
 
-  if (format == HLHDF_STRING && typid < 0) {
-    tmptypeid = HLNode_createStringType(sz);
-    if (tmptypeid < 0) {
-      HL_ERROR0("Failed to create string type\n");
-      goto fail;
-    }
-  } else if (format == HLHDF_COMPOUND && typid < 0) {
-    HL_ERROR0("Atempting to set compound data with no type id");
-    goto fail;
-  } else {
-    if (typid < 0) {
-      tmptypeid = HL_translateFormatStringToDatatype(fmt);
-    } else {
-      tmptypeid = H5Tcopy(typid);
-    }
-  }
-
-  HLHDF_FREE(node->data);
-  HL_H5T_CLOSE(node->typeId);
-  node->data = data;
-  node->format = format;
-  node->dSize = sz;
-  node->typeId = tmptypeid;
-  data = NULL;
-  tmptypeid = -1;
-  node->dataType = HL_SIMPLE;
-  if (node->mark != NMARK_CREATED)
-    node->mark = NMARK_CHANGED;
+  return HLNode_setValueBuffer(node, sz, 0, NULL, HLNodeBuffer_new(data, NULL, NULL), fmt, typid);
+}
 
-  status = 1;
-fail:
-  HLHDF_FREE(data);
-  HL_H5T_CLOSE(tmptypeid);
-  return status;
+int HLNode_adoptScalarValue(HL_Node* node, size_t sz, unsigned char* value,
+  void (*freefn)(void*), const char* fmt, hid_t typid)
+{
+  HL_ASSERT((node != NULL), "HLNode_adoptScalarValue called with node == NULL");
+  HL_ASSERT((value != NULL), "HLNode_adoptScalarValue called with value == NULL");
+  return HLNode_setValueBuffer(node, sz, 0, NULL, HLNodeBuffer_new(value, value, freefn), fmt, typid);
 }
 
 int HLNode_setArrayValue(HL_Node* node, size_t sz, int ndims, hsize_t* dims,
   unsigned char* value, const char* fmt, hid_t typid)
 {
-  int i;
   size_t npts = 0;
   unsigned char* data = NULL;
-  HL_FormatSpecifier format = HLHDF_UNDEFINED;
-  hid_t tmptypeid = -1;
-  int status = 0;
 
   HL_ASSERT((node != NULL), "HLNode_setArrayValue called with node == NULL");
   HL_ASSERT((ndims>0 && dims!=NULL), "HLNode_setArrayValue called with inconsistant ndims and dims");
 
   HL_SPEWDEBUG0("ENTER: setHL_NodeArrayValue");
 
-  format = HL_getFormatSpecifier(fmt);
-  if (format == HLHDF_UNDEFINED || format == HLHDF_ARRAY) {
-    HL_ERROR0("When setting a node value, fmt has to be reckognized");
-    goto fail;
-  }
-
-  npts = 1;
-  for (i = 0; i < ndims; i++) {
-    npts *= dims[i];
-  }
-
+  npts = HLNode_getNumberOfPointsFromDims(ndims, dims);
   if ((data = (unsigned char*) HLHDF_MALLOC(npts * sz)) == NULL) {
     HL_ERROR0("Failed to allocate memory when setting value");
-    goto fail;
+    return 0;
   }
   memcpy(data, value, npts * sz);
 
-  if (format == HLHDF_STRING && typid < 0) {
-    tmptypeid = HLNode_createStringType(sz);
-    if (tmptypeid < 0) {
-      HL_ERROR0("Failed to create string type\n");
-      goto fail;
-    }
-  } else if (format == HLHDF_COMPOUND && typid < 0) {
-    HL_ERROR0("Atempting to set compound data with no type id");
-    goto fail;
-  } else {
-    if (typid < 0) {
-      tmptypeid = HL_translateFormatStringToDatatype(fmt);
-    } else {
-      tmptypeid = H5Tcopy(typid);
-    }
-  }
-
-  if (!HLNode_setDimensions(node, ndims, dims)) {
-    HL_ERROR0("Failed to set dimensions");
-    goto fail;
-  }
-
-  HLHDF_FREE(node->data);
-  HL_H5T_CLOSE(node->typeId);
-  node->data = data;
-  node->format = format;
-  node->dSize = sz;
-  node->typeId = tmptypeid;
-  data = NULL;
-  tmptypeid = -1;
+  return HLNode_setValueBuffer(node, sz, ndims, dims, HLNodeBuffer_new(data, NULL, NULL), fmt, typid);
+}
 
-  node->dataType = HL_ARRAY;
+int HLNode_adoptArrayValue(HL_Node* node, size_t sz, int ndims, hsize_t* dims,
+  unsigned char* value, void (*freefn)(void*), const char* fmt, hid_t typid)
+{
+  HL_ASSERT((node != NULL), "HLNode_adoptArrayValue called with node == NULL");
+  HL_ASSERT((ndims>0 && dims!=NULL), "HLNode_adoptArrayValue called with inconsistant ndims and dims");
+  HL_ASSERT((value != NULL), "HLNode_adoptArrayValue called with value == NULL");
+  return HLNode_setValueBuffer(node, sz, ndims, dims, HLNodeBuffer_new(value, value, freefn), fmt, typid);
+}
 
-  if (node->mark != NMARK_CREATED)
-    node->mark = NMARK_CHANGED;
+int HLNode_setExternalArrayValue(HL_Node* node, size_t sz, int ndims, hsize_t* dims,
+  unsigned char* value, void* owner, void (*releasefn)(void*), const char* fmt, hid_t typid)
+{
+  HL_ASSERT((node != NULL), "HLNode_setExternalArrayValue called with node == NULL");
+  HL_ASSERT((ndims>0 && dims!=NULL), "HLNode_setExternalArrayValue called with inconsistant ndims and dims");
+  HL_ASSERT((value != NULL && releasefn != NULL), "HLNode_setExternalArrayValue called with value == NULL or releasefn == NULL");
+  return HLNode_setValueBuffer(node, sz, ndims, dims, HLNodeBuffer_new(value, owner, releasefn), fmt, typid);
+}
 
-  status = 1;
-fail:
-  HLHDF_FREE(data);
-  HL_H5T_CLOSE(tmptypeid);
-  return status;
+int HLNode_borrowArrayValue(HL_Node* node, size_t sz, int ndims, hsize_t* dims,
+  unsigned char* value, const char* fmt, hid_t typid)
+{
+  HL_ASSERT((node != NULL), "HLNode_borrowArrayValue called with node == NULL");
+  HL_ASSERT((ndims>0 && dims!=NULL), "HLNode_borrowArrayValue called with inconsistant ndims and dims");
+  HL_ASSERT((value != NULL), "HLNode_borrowArrayValue called with value == NULL");
+  return HLNode_setValueBuffer(node, sz, ndims, dims, HLNodeBuffer_new(value, NULL, HLNodeBuffer_borrowed), fmt, typid);
 }
 
 const char* HLNode_getName(HL_Node* node)
@@ -457,24 +1078,121 @@ const char* HLNode_getName(HL_Node* node)
 unsigned char* HLNode_getData(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_getData called with node == NULL");
+  HLNode_accessData(node);
+  return node->data;
+}
+
+int HLNode_getDataAs(HL_Node* node, HL_FormatSpecifier target, void* out)
+{
+  unsigned char* data = NULL;
+  HL_ASSERT((node != NULL), "HLNode_getDataAs called with node == NULL");
+  if (out == NULL) {
+    HL_ERROR0("HLNode_getDataAs called with out == NULL");
+    return 0;
+  }
+  if ((data = HLNode_getData(node)) == NULL) {
+    HL_ERROR1("Node %s has no data", node->name);
+    return 0;
+  }
+  if (HL_sizeOfFormatSpecifier(node->format) != node->dSize) {
+    HL_ERROR1("Node %s does not have native numeric data", node->name);
+    return 0;
+  }
+  return HLConvertPrivate_convert(node->format, data, target, out,
+                                  (size_t)HLNode_getNumberOfPoints(node));
+}
+
+int HLNode_convertData(HL_Node* node, HL_FormatSpecifier target)
+{
+  size_t sz = HL_sizeOfFormatSpecifier(target);
+  size_t npts = 0;
+  unsigned char* data = NULL;
+  HL_NodeBuffer* buffer = NULL;
+  HL_ASSERT((node != NULL), "HLNode_convertData called with node == NULL");
+
+  if (sz == 0) {
+    HL_ERROR1("Can not convert into format %d", target);
+    return 0;
+  }
+  npts = (size_t)HLNode_getNumberOfPoints(node);
+  if ((data = HLHDF_MALLOC(npts * sz)) == NULL) {
+    HL_ERROR0("Failed to allocate memory for converted data");
+    return 0;
+  }
+  if (!HLNode_getDataAs(node, target, data)) {
+    HLHDF_FREE(data);
+    return 0;
+  }
+  if ((buffer = HLNodeBuffer_new(data, NULL, NULL)) == NULL) {
+    return 0; /* data has been released by HLNodeBuffer_new */
+  }
+  return HLNode_setValueBuffer(node, sz, node->ndims, node->dims, buffer, HL_getFormatSpecifierString(target), -1);
+}
+
+unsigned char* HLNode_getWritableData(HL_Node* node)
+{
+  HL_ASSERT((node != NULL), "HLNode_getWritableData called with node == NULL");
+  HLNode_accessData(node);
+  HLNode_removeFromCache(node); /* Modified data must not be evicted */
+  HLNodePrivate_setStatistics(node, NULL);
+  if (node->dataBuffer != NULL &&
+      (HLHDF_ATOMIC_LOAD(node->dataBuffer->refcount) > 1 || HLNodeBuffer_isBorrowed(node->dataBuffer))) {
+    HL_NodeBuffer* buffer = HLNode_duplicateData(node);
+    if (buffer == NULL) {
+      return NULL;
+    }
+    HLNode_setDataBuffer(node, buffer);
+  }
   return node->data;
 }
 
+int HLNode_releaseData(HL_Node* node)
+{
+  HL_ASSERT((node != NULL), "HLNode_releaseData called with node == NULL");
+  HLNode_waitForPrefetch(node);
+  if (node->mark == NMARK_CREATED || node->mark == NMARK_CHANGED) {
+    HL_ERROR1("Can not release data of '%s' since it has not been written", node->name);
+    return 0;
+  }
+  HLNode_removeFromCache(node);
+  HLNode_setDataBuffer(node, NULL);
+  HLNodeBuffer_release(&node->rawdataBuffer);
+  node->rawdata = NULL;
+  node->rdSize = 0;
+  node->fetched = 0;
+  HLNode_forgetPrefetch(node);
+  return 1;
+}
+
+int HLNode_getStatistics(HL_Node* node, HL_DataStatistics* stats)
+{
+  HL_ASSERT((node != NULL), "HLNode_getStatistics called with node == NULL");
+  HLNode_waitForPrefetch(node);
+  if (node->statistics == NULL || stats == NULL) {
+    return 0;
+  }
+  memcpy(stats, node->statistics, sizeof(HL_DataStatistics));
+  return 1;
+}
+
 size_t HLNode_getDataSize(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_getDataSize called with node == NULL");
+  HLNode_accessData(node);
   return node->dSize;
 }
 
 unsigned char* HLNode_getRawdata(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_getRawdata called with node == NULL");
+  HLNode_accessData(node);
   return node->rawdata;
 }
 
 size_t HLNode_getRawdataSize(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_getRawdataSize called with node == NULL");
+  HLNode_accessData(node);
   return node->rdSize;
 }
 
@@ -504,6 +1222,7 @@ HL_NodeMark HLNode_getMark(HL_Node* node)
 int HLNode_fetched(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_fetched called with node == NULL");
+  HLNode_waitForPrefetch(node);
   return node->fetched;
 }
 
@@ -522,12 +1241,14 @@ HL_Type HLNode_getType(HL_Node* node)
 const char* HLNode_getFormatName(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_getFormatName called with node == NULL");
+  HLNode_waitForPrefetch(node);
   return HL_getFormatSpecifierString(node->format);
 }
 
 HL_FormatSpecifier HLNode_getFormat(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_getFormat called with node == NULL");
+  HLNode_waitForPrefetch(node);
   return node->format;
 }
 
@@ -543,7 +1264,6 @@ HL_DataType HLNode_getDataType(HL_Node* node)
   return node->dataType;
 }
 
-
 int HLNode_setDimensions(HL_Node* node, int ndims, hsize_t* dims)
 {
   hsize_t* tmpdims = NULL;
@@ -573,6 +1293,7 @@ fail:
 void HLNode_getDimensions(HL_Node* node, int* ndims, hsize_t** dims)
 {
   HL_ASSERT((node != NULL), "HLNode_getDimensions called with node == NULL");
+  HLNode_waitForPrefetch(node);
 
   if (ndims != NULL && dims != NULL) {
     *ndims = 0;
@@ -594,12 +1315,14 @@ void HLNode_getDimensions(HL_Node* node, int* ndims, hsize_t** dims)
 int HLNode_getRank(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_getRank called with node == NULL");
+  HLNode_waitForPrefetch(node);
   return node->ndims;
 }
 
 hsize_t HLNode_getDimension(HL_Node* node, int index)
 {
   HL_ASSERT((node != NULL), "HLNode_getDimension called with node == NULL");
+  HLNode_waitForPrefetch(node);
   if (index < 0 || index >= node->ndims || node->dims == NULL) {
     return 0;
   }
@@ -609,6 +1332,7 @@ hsize_t HLNode_getDimension(HL_Node* node, int index)
 hsize_t HLNode_getNumberOfPoints(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_getNumberOfPoints called with node == NULL");
+  HLNode_waitForPrefetch(node);
   if (node->ndims == 0) {
     return 1;
   }
@@ -633,6 +1357,7 @@ void HLNode_setCompoundDescription(HL_Node* node, HL_CompoundTypeDescription* de
 HL_CompoundTypeDescription* HLNode_getCompoundDescription(HL_Node* node)
 {
   HL_ASSERT((node != NULL), "HLNode_getCompoundDescription called with node == NULL");
+  HLNode_waitForPrefetch(node);
   return node->compoundDescription;
 }
 
@@ -652,6 +1377,8 @@ void HLNode_setCompression(HL_Node* node, HL_Compression* compression)
 int HLNode_commitType(HL_Node* node, hid_t thid)
 {
   HL_ASSERT((node != NULL), "HLNode_commitType called with node == NULL");
+  HL_lockHdf5();
   HLNodePrivate_setHdfID(node, H5Tcopy(thid));
+  HL_unlockHdf5();
   return 1;
 }
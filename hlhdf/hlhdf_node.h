@@ -83,7 +83,8 @@ HL_Node* HLNode_newDatatype(const char* name);
 HL_Node* HLNode_newReference(const char* name);
 
 /**
- * Copies an HL_Node.
+ * Copies an HL_Node. The data and rawdata are not duplicated, instead the copy shares
+ * them with the original node until a new value is set or @ref HLNode_getWritableData is called.
  * @ingroup hlhdf_c_apis
  * @param[in] node the node that should be copied
  * @return the allocated node on success, otherwise NULL.
@@ -102,6 +103,21 @@ HL_Node* HLNode_copy(HL_Node* node);
  */
 int HLNode_setScalarValue(HL_Node* node,size_t sz,unsigned char* value,const char* fmt,hid_t typid);
 
+/**
+ * Sets a scalar value in the specified node without copying it. The node takes over
+ * the ownership of value and releases it with freefn when it no longer is used.
+ * @ingroup hlhdf_c_apis
+ * @param[in] node the node that should get its value set.
+ * @param[in] sz the size of the data
+ * @param[in] value the data (<b>responsibility taken over, also on failure</b>)
+ * @param[in] freefn the function releasing value, if NULL, value must have been allocated with HLHDF_MALLOC
+ * @param[in] fmt the format specifier, @see ref ValidFormatSpecifiers "here" for valid formats.
+ * @param[in] typid if a custom made type should be used for writing the data, otherwise use -1.
+ * @return 1 if everything was ok, otherwise 0
+ */
+int HLNode_adoptScalarValue(HL_Node* node,size_t sz,unsigned char* value,void (*freefn)(void*),
+  const char* fmt,hid_t typid);
+
 /**
  * Sets an array value in the specified node.
  * @ingroup hlhdf_c_apis
@@ -117,6 +133,65 @@ int HLNode_setScalarValue(HL_Node* node,size_t sz,unsigned char* value,const cha
 int HLNode_setArrayValue(HL_Node* node,size_t sz,int ndims,hsize_t* dims,unsigned char* value,
       const char* fmt,hid_t typid);
 
+/**
+ * Sets an array value in the specified node without copying it. The node takes over
+ * the ownership of value and releases it with freefn when it no longer is used. Copies
+ * of the node shares the same data.
+ * @ingroup hlhdf_c_apis
+ * @param[in] node the node that should get its value set
+ * @param[in] sz the size of the type
+ * @param[in] ndims the rank
+ * @param[in] dims the dimension
+ * @param[in] value the data buffer (<b>responsibility taken over, also on failure</b>)
+ * @param[in] freefn the function releasing value, if NULL, value must have been allocated with HLHDF_MALLOC
+ * @param[in] fmt the format specifier, @see ref ValidFormatSpecifiers "here" for valid formats.
+ * @param[in] typid if a custom made type should be used for writing the data, otherwise use -1.
+ * @return 1 if everything was ok, otherwise 0
+ */
+int HLNode_adoptArrayValue(HL_Node* node,size_t sz,int ndims,hsize_t* dims,unsigned char* value,
+  void (*freefn)(void*),const char* fmt,hid_t typid);
+
+/**
+ * Sets an array value in the specified node that refers to memory owned by another object,
+ * for example a buffer provided by a scripting language. The data is not copied and
+ * releasefn is called with owner when no node refers to the data any longer. Copies of the
+ * node shares the same data.
+ * @ingroup hlhdf_c_apis
+ * @param[in] node the node that should get its value set
+ * @param[in] sz the size of the type
+ * @param[in] ndims the rank
+ * @param[in] dims the dimension
+ * @param[in] value the data buffer
+ * @param[in] owner the owner of value that is passed to releasefn
+ * @param[in] releasefn the function releasing owner (<b>called also on failure</b>), may not be NULL
+ * @param[in] fmt the format specifier, @see ref ValidFormatSpecifiers "here" for valid formats.
+ * @param[in] typid if a custom made type should be used for writing the data, otherwise use -1.
+ * @return 1 if everything was ok, otherwise 0
+ */
+int HLNode_setExternalArrayValue(HL_Node* node,size_t sz,int ndims,hsize_t* dims,unsigned char* value,
+  void* owner,void (*releasefn)(void*),const char* fmt,hid_t typid);
+
+/**
+ * Sets an array value in the specified node that refers to the callers buffer without
+ * copying it. The buffer must be kept valid until the nodelist containing the node has
+ * been written with @ref HLNodeList_write or @ref HLNodeList_update or until the node
+ * has been freed. The node releases the buffer when the write returns, also if the
+ * write failed, so after a write attempt the node no longer refers to the buffer and
+ * has no data and the value has to be set again before the node can be written.
+ * Copies of the node gets their own copy of the data.
+ * @ingroup hlhdf_c_apis
+ * @param[in] node the node that should get its value set
+ * @param[in] sz the size of the type
+ * @param[in] ndims the rank
+ * @param[in] dims the dimension
+ * @param[in] value the data buffer (<b>still owned by the caller</b>)
+ * @param[in] fmt the format specifier, @see ref ValidFormatSpecifiers "here" for valid formats.
+ * @param[in] typid if a custom made type should be used for writing the data, otherwise use -1.
+ * @return 1 if everything was ok, otherwise 0
+ */
+int HLNode_borrowArrayValue(HL_Node* node,size_t sz,int ndims,hsize_t* dims,unsigned char* value,
+  const char* fmt,hid_t typid);
+
 /**
  * Returns the node name.
  * @param[in] node the node
@@ -125,12 +200,65 @@ int HLNode_setArrayValue(HL_Node* node,size_t sz,int ndims,hsize_t* dims,unsigne
 const char* HLNode_getName(HL_Node* node);
 
 /**
- * Returns the internal data pointer for this node.
+ * Returns the internal data pointer for this node. Copies created with @ref HLNode_copy
+ * shares the same data so the returned data must be treated as read-only, use
+ * @ref HLNode_getWritableData if the data should be modified in place.
  * @param[in] node the node
  * @return the internal data (<b>Do not release and be careful so that the node does not change when holding the data pointer.</b>).
  */
 unsigned char* HLNode_getData(HL_Node* node);
 
+/**
+ * Returns the internal data pointer for this node for modification in place. If the
+ * data is shared with other nodes, the data is first duplicated so that the other nodes
+ * are unaffected.
+ * @param[in] node the node
+ * @return the internal data or NULL if node has no data or the data not could be duplicated
+ * (<b>Do not release and be careful so that the node does not change when holding the data pointer.</b>).
+ */
+unsigned char* HLNode_getWritableData(HL_Node* node);
+
+/**
+ * Converts the data of the node into another numeric format. Integer formats
+ * are saturated and NaN becomes 0 in the same way as when HDF5 converts
+ * the data during a read.
+ * @param[in] node the node
+ * @param[in] target the format to convert into, must be a numeric format
+ * @param[out] out receives the converted data, must be able to hold the number of
+ * points (see @ref HLNode_getNumberOfPoints) times the size of target
+ * @return 1 on success, 0 if the node has no data or any of the formats is not numeric
+ */
+int HLNode_getDataAs(HL_Node* node, HL_FormatSpecifier target, void* out);
+
+/**
+ * Converts the data of the node into another numeric format in place, see
+ * @ref HLNode_getDataAs. The node gets the new format and is marked as changed.
+ * @param[in] node the node
+ * @param[in] target the format to convert into, must be a numeric format
+ * @return 1 on success, otherwise 0
+ */
+int HLNode_convertData(HL_Node* node, HL_FormatSpecifier target);
+
+/**
+ * Releases the data of the node but keeps the metadata, like dimensions and format.
+ * The node is marked as not fetched so the data can be fetched again, or is loaded on the
+ * next access if lazy loading is turned on, see @ref HLNodeList_setLazyLoading.
+ * Copies of the node keep their own reference to the data.
+ * @param[in] node the node
+ * @return 1 on success, 0 if the node has been created or changed and not yet written
+ */
+int HLNode_releaseData(HL_Node* node);
+
+/**
+ * Returns the statistics of the data that were computed when the dataset was fetched,
+ * see @ref HLNodeList_setComputeStatistics. The statistics are removed when the data
+ * is changed.
+ * @param[in] node the node
+ * @param[out] stats the structure to be filled in
+ * @return 1 if the node has statistics, otherwise 0
+ */
+int HLNode_getStatistics(HL_Node* node, HL_DataStatistics* stats);
+
 /**
  * Returns the type size for the data format.
  * @param[in] node the node
@@ -25,6 +25,12 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
  */
 #ifndef HLHDF_NODE_PRIVATE_H
 #define HLHDF_NODE_PRIVATE_H
+#include "hlhdf_private.h"
+
+/**
+ * Keeps the dataset payloads of a nodelist within a byte budget.
+ */
+typedef struct _HL_DataCache HL_DataCache;
 
 /**
  * Sets data and datasize in the node. When this function has been called,
@@ -45,8 +51,20 @@ void HLNodePrivate_setData(HL_Node* node, size_t datasize, unsigned char* data);
 void HLNodePrivate_setRawdata(HL_Node* node, size_t datasize, unsigned char* data);
 
 /**
- * Copies the typid and sets it in the node and also atempts to derive
- * the format name.
+ * Sets data that is owned by someone else in the node, see @ref HLNode_setExternalArrayValue.
+ * @param[in] node the node (MAY NOT BE NULL)
+ * @param[in] datasize the size of the data type as get by H5Tget_size.
+ * @param[in] data the data
+ * @param[in] owner passed to releasefn when data no longer is used
+ * @param[in] releasefn the release function, if NULL the data is never released
+ */
+void HLNodePrivate_setExternalData(HL_Node* node, size_t datasize, unsigned char* data,
+  void* owner, void (*releasefn)(void*));
+
+/**
+ * Sets the typid in the node and also atempts to derive the format name. The node
+ * takes a new reference to typid so it must be a transient type that is not modified
+ * afterwards.
  * @param[in] node the node
  * @param[in] typid the type identifier
  * @return 1 on success, otherwise 0.
@@ -81,4 +99,149 @@ const hsize_t* HLNodePrivate_getDims(HL_Node* node);
  */
 hid_t HLNodePrivate_getTypeId(HL_Node* node);
 
+/**
+ * Marks the node as being prefetched, see @ref HLNodeList_prefetch. Until
+ * @ref HLNodePrivate_endPrefetch has been called, the accessors of the node's
+ * data and description will wait.
+ * @param[in] node the node
+ * @return 1 if the node was marked, 0 if it already is being prefetched
+ */
+int HLNodePrivate_beginPrefetch(HL_Node* node);
+
+/**
+ * Ends the prefetch of the node and wakes up everyone waiting for it.
+ * @param[in] node the node
+ * @param[in] fetched if the data was fetched successfully and can be claimed with
+ * @ref HLNodePrivate_claimPrefetched
+ */
+void HLNodePrivate_endPrefetch(HL_Node* node, int fetched);
+
+/**
+ * Waits until the node no longer is being prefetched. Must not be called with the
+ * HDF5 lock held.
+ * @param[in] node the node
+ */
+void HLNodePrivate_waitForPrefetch(HL_Node* node);
+
+/**
+ * Waits until the node no longer is being prefetched and claims the prefetched data so
+ * that a fetch does not have to read it again.
+ * Must not be called with the HDF5 lock held.
+ * @param[in] node the node
+ * @return 1 if the node has been prefetched successfully since the last claim, otherwise 0
+ */
+int HLNodePrivate_claimPrefetched(HL_Node* node);
+
+/**
+ * Sets the file session used for loading the data on first access, see
+ * @ref HLNodeList_setLazyLoading.
+ * @param[in] node the node
+ * @param[in] session the session, a reference is added. NULL to stop loading on demand.
+ */
+void HLNodePrivate_setFileSession(HL_Node* node, HL_FileSession* session);
+
+/**
+ * Creates a cache that keeps the dataset payloads of a nodelist within a budget,
+ * see @ref HLNodeList_setDataBudget.
+ * @param[in] budget the budget in bytes
+ * @return the cache or NULL on failure
+ */
+HL_DataCache* HLDataCachePrivate_new(size_t budget);
+
+/**
+ * Frees the cache. All nodes must have been removed from it first.
+ * @param[in] cache the cache, may be NULL
+ */
+void HLDataCachePrivate_free(HL_DataCache* cache);
+
+/**
+ * Sets the budget and evicts payloads until the cache is within it.
+ * @param[in] cache the cache
+ * @param[in] budget the budget in bytes
+ */
+void HLDataCachePrivate_setBudget(HL_DataCache* cache, size_t budget);
+
+/**
+ * Evicts payloads until the cache is within its budget.
+ * @param[in] cache the cache
+ * @param[in] keep a node that must not be evicted, may be NULL
+ */
+void HLDataCachePrivate_evict(HL_DataCache* cache, HL_Node* keep);
+
+/**
+ * Returns the budget of the cache.
+ * @param[in] cache the cache
+ * @return the budget in bytes
+ */
+size_t HLDataCachePrivate_getBudget(HL_DataCache* cache);
+
+/**
+ * Returns the number of bytes of dataset payloads currently accounted in the cache.
+ * @param[in] cache the cache
+ * @return the number of bytes
+ */
+size_t HLDataCachePrivate_getUsed(HL_DataCache* cache);
+
+/**
+ * Sets the cache that accounts for the node's data. A fetched and unmodified node is
+ * added to the cache immediately.
+ * @param[in] node the node
+ * @param[in] cache the cache, NULL to remove the node from its cache
+ */
+void HLNodePrivate_setDataCache(HL_Node* node, HL_DataCache* cache);
+
+/**
+ * Releases the data if it has been set with @ref HLNode_borrowArrayValue. Called
+ * when a write of the node returns, whether it succeeded or not, since the borrowed
+ * data only is guaranteed to be valid until then.
+ * @param[in] node the node
+ */
+void HLNodePrivate_releaseBorrowedData(HL_Node* node);
+
+/**
+ * Sets the statistics of the node's data, see @ref HLNode_getStatistics. The statistics
+ * are removed when the data is changed.
+ * @param[in] node the node
+ * @param[in] stats the statistics, copied. NULL to remove the statistics.
+ * @return 1 on success, otherwise 0
+ */
+int HLNodePrivate_setStatistics(HL_Node* node, const HL_DataStatistics* stats);
+
+/**
+ * A reference counted data buffer, copies of a node share the same buffer.
+ */
+typedef struct _HL_NodeBuffer HL_NodeBuffer;
+
+/**
+ * Returns a new reference to the buffer holding the data of the node, so that the
+ * data can be used after the node has got a new value or has been freed without
+ * copying it. Borrowed data is duplicated since it only is valid until the node has
+ * been written.
+ * @param[in] node the node
+ * @param[in] raw if the rawdata buffer should be returned instead of the data buffer
+ * @return the buffer or NULL if the node has no such data. Release with @ref HLNodePrivate_releaseBuffer.
+ */
+HL_NodeBuffer* HLNodePrivate_refDataBuffer(HL_Node* node, int raw);
+
+/**
+ * Returns the data of the buffer.
+ * @param[in] buffer the buffer
+ * @return the data
+ */
+unsigned char* HLNodePrivate_getBufferData(HL_NodeBuffer* buffer);
+
+/**
+ * Returns if anyone else refers to the buffer, e.g. a node. A buffer that not is
+ * shared can be modified without affecting anyone else.
+ * @param[in] buffer the buffer
+ * @return 1 if the buffer is shared, otherwise 0
+ */
+int HLNodePrivate_isBufferShared(HL_NodeBuffer* buffer);
+
+/**
+ * Releases a reference returned by @ref HLNodePrivate_refDataBuffer.
+ * @param[in] buffer the buffer, may be NULL
+ */
+void HLNodePrivate_releaseBuffer(HL_NodeBuffer* buffer);
+
 #endif /* HLHDF_NODE_PRIVATE_H */
@@ -28,6 +28,9 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 #include "hlhdf_defines_private.h"
 #include "hlhdf_debug.h"
 #include "hlhdf_node.h"
+#include "hlhdf_private.h"
+#include "hlhdf_node_private.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -41,10 +44,75 @@ struct  _HL_NodeList {
    int nNodes;         /**< Number of nodes */
    int nAllocNodes;    /**< Number of allocated nodes */
    HL_Node** nodes;    /**< The list of nodes (max size is nNodes - 1) */
+   HL_FileSession* fileSession; /**< The file used for lazy loading, NULL if not lazy */
+   HL_DataCache* cache; /**< Keeps the dataset payloads within the budget, NULL if no budget */
+   int statistics;      /**< If statistics should be computed when datasets are fetched */
+   int histogramBins;   /**< Number of bins in the histogram of the statistics */
+   double histogramLow; /**< Lower limit of the histogram */
+   double histogramHigh; /**< Upper limit of the histogram */
 };
 
 /*@{ End of Structs */
 
+/*@{ Private functions */
+void HLNodeListPrivate_waitForPrefetch(HL_NodeList* nodelist)
+{
+  int i;
+  if (nodelist != NULL) {
+    for (i = 0; i < nodelist->nNodes; i++) {
+      HLNodePrivate_waitForPrefetch(nodelist->nodes[i]);
+    }
+  }
+}
+
+void HLNodeListPrivate_closeFileSession(HL_NodeList* nodelist)
+{
+  if (nodelist != NULL) {
+    HLFileSessionPrivate_close(nodelist->fileSession);
+  }
+}
+
+void HLNodeListPrivate_applyDataBudget(HL_NodeList* nodelist, HL_Node* keep)
+{
+  if (nodelist != NULL && nodelist->cache != NULL) {
+    HLDataCachePrivate_evict(nodelist->cache, keep);
+  }
+}
+
+int HLNodeListPrivate_getStatisticsOptions(HL_NodeList* nodelist, int* nbins, double* low, double* high)
+{
+  if (nodelist == NULL || !nodelist->statistics) {
+    return 0;
+  }
+  *nbins = nodelist->histogramBins;
+  *low = nodelist->histogramLow;
+  *high = nodelist->histogramHigh;
+  return 1;
+}
+
+HL_Node* HLNodeListPrivate_findWhatAttribute(HL_NodeList* nodelist, const char* name, const char* attribute)
+{
+  char path[1024];
+  size_t len = strlen(name);
+  HL_Node* node = NULL;
+
+  while (len > 0) {
+    while (len > 0 && name[len - 1] != '/') {
+      len--;
+    }
+    if (len == 0) {
+      break;
+    }
+    len--; /* The separator */
+    snprintf(path, sizeof(path), "%.*s/what/%s", (int)len, name, attribute);
+    if ((node = HLNodeList_getNodeByName(nodelist, path)) != NULL && HLNode_getType(node) == ATTRIBUTE_ID) {
+      return node;
+    }
+  }
+  return NULL;
+}
+/*@} End of Private functions */
+
 /*@{ Interface functions */
 HL_NodeList* HLNodeList_new(void)
 {
@@ -56,6 +124,12 @@ HL_NodeList* HLNodeList_new(void)
     return NULL;
   }
   retv->filename = NULL;
+  retv->fileSession = NULL;
+  retv->cache = NULL;
+  retv->statistics = 0;
+  retv->histogramBins = 0;
+  retv->histogramLow = 0.0;
+  retv->histogramHigh = 0.0;
 
   if (!(retv->nodes = (HL_Node**) HLHDF_MALLOC(sizeof(HL_Node*) * DEFAULT_SIZE_NODELIST))) {
     HL_ERROR0("Failed to allocate memory for HL_NodeList");
@@ -83,6 +157,8 @@ void HLNodeList_free(HL_NodeList* nodelist)
     }
     HLHDF_FREE(nodelist->nodes);
   }
+  HLFileSessionPrivate_release(&nodelist->fileSession);
+  HLDataCachePrivate_free(nodelist->cache);
   HLHDF_FREE(nodelist->filename);
   HLHDF_FREE(nodelist);
   HL_SPEWDEBUG0("EXIT: HLNodeList_free");
@@ -111,6 +187,117 @@ fail:
   return status;
 }
 
+int HLNodeList_setLazyLoading(HL_NodeList* nodelist, int lazy)
+{
+  HL_FileSession* session = NULL;
+  int i;
+
+  if (nodelist == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return 0;
+  }
+  if (lazy && nodelist->fileSession == NULL) {
+    if (nodelist->filename == NULL) {
+      HL_ERROR0("Lazy loading requires a nodelist read from file");
+      return 0;
+    }
+    if ((session = HLFileSessionPrivate_new(nodelist->filename)) == NULL) {
+      return 0;
+    }
+  } else if (lazy) {
+    return 1;
+  }
+  HLNodeListPrivate_waitForPrefetch(nodelist);
+  for (i = 0; i < nodelist->nNodes; i++) {
+    HLNodePrivate_setFileSession(nodelist->nodes[i], session);
+  }
+  HLFileSessionPrivate_release(&nodelist->fileSession);
+  nodelist->fileSession = session;
+  return 1;
+}
+
+int HLNodeList_isLazyLoading(HL_NodeList* nodelist)
+{
+  return (nodelist != NULL && nodelist->fileSession != NULL);
+}
+
+int HLNodeList_setDataBudget(HL_NodeList* nodelist, size_t budget)
+{
+  HL_DataCache* cache = NULL;
+  int i;
+
+  if (nodelist == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return 0;
+  }
+  if (budget > 0 && nodelist->cache != NULL) {
+    HLDataCachePrivate_setBudget(nodelist->cache, budget);
+    return 1;
+  }
+  if (budget > 0 && (cache = HLDataCachePrivate_new(budget)) == NULL) {
+    return 0;
+  }
+  HLNodeListPrivate_waitForPrefetch(nodelist);
+  for (i = 0; i < nodelist->nNodes; i++) {
+    if (HLNode_getType(nodelist->nodes[i]) == DATASET_ID) {
+      HLNodePrivate_setDataCache(nodelist->nodes[i], cache);
+    }
+  }
+  HLDataCachePrivate_free(nodelist->cache);
+  nodelist->cache = cache;
+  if (cache != NULL) {
+    HLDataCachePrivate_evict(cache, NULL);
+  }
+  return 1;
+}
+
+size_t HLNodeList_getDataBudget(HL_NodeList* nodelist)
+{
+  if (nodelist == NULL || nodelist->cache == NULL) {
+    return 0;
+  }
+  return HLDataCachePrivate_getBudget(nodelist->cache);
+}
+
+size_t HLNodeList_getCachedDataSize(HL_NodeList* nodelist)
+{
+  if (nodelist == NULL || nodelist->cache == NULL) {
+    return 0;
+  }
+  return HLDataCachePrivate_getUsed(nodelist->cache);
+}
+
+int HLNodeList_setComputeStatistics(HL_NodeList* nodelist, int compute)
+{
+  if (nodelist == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return 0;
+  }
+  nodelist->statistics = compute ? 1 : 0;
+  return 1;
+}
+
+int HLNodeList_isComputingStatistics(HL_NodeList* nodelist)
+{
+  return (nodelist != NULL && nodelist->statistics);
+}
+
+int HLNodeList_setStatisticsHistogram(HL_NodeList* nodelist, int nbins, double low, double high)
+{
+  if (nodelist == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return 0;
+  }
+  if (nbins < 0 || nbins > HLHDF_MAX_HISTOGRAM_BINS || (nbins > 0 && !(high > low))) {
+    HL_ERROR3("Invalid histogram with %d bins between %g and %g", nbins, low, high);
+    return 0;
+  }
+  nodelist->histogramBins = nbins;
+  nodelist->histogramLow = low;
+  nodelist->histogramHigh = high;
+  return 1;
+}
+
 char* HLNodeList_getFileName(HL_NodeList* nodelist)
 {
   char* retv = NULL;
@@ -49,6 +49,87 @@ void HLNodeList_free(HL_NodeList* nodelist);
  */
 int HLNodeList_setFileName(HL_NodeList* nodelist, const char* filename);
 
+/**
+ * Turns lazy loading on or off. When on, the data of an attribute or dataset that has
+ * not been fetched is loaded from the file the nodelist was read from the first time
+ * it is accessed with @ref HLNode_getData, @ref HLNode_getDataSize or the other data
+ * accessors. The file is opened once and kept open until lazy loading is turned off or
+ * the nodelist and all copies of its nodes have been freed. Only nodes that are in the
+ * nodelist when this function is called are loaded lazily.
+ * @param[in] nodelist - the nodelist, must have been read from a file
+ * @param[in] lazy - 1 to turn lazy loading on, 0 to turn it off
+ * @return 1 on success, otherwise 0
+ */
+int HLNodeList_setLazyLoading(HL_NodeList* nodelist, int lazy);
+
+/**
+ * Returns if lazy loading is turned on, see @ref HLNodeList_setLazyLoading.
+ * @param[in] nodelist - the nodelist
+ * @return 1 if lazy loading is on, otherwise 0
+ */
+int HLNodeList_isLazyLoading(HL_NodeList* nodelist);
+
+/**
+ * Sets a budget for the memory used by dataset payloads in the nodelist. When the
+ * payloads of fetched and unmodified datasets exceed the budget, the least recently
+ * accessed ones are released, keeping their metadata. Only datasets that can be loaded
+ * again on access are released, so the budget only has effect together with
+ * @ref HLNodeList_setLazyLoading. The budget is applied when data is fetched or accessed
+ * through the nodelist, so a data pointer from @ref HLNode_getData is only valid until
+ * the next access. Copies of nodes keep their own reference to the data.
+ * @param[in] nodelist - the nodelist
+ * @param[in] budget - the budget in bytes, 0 means no budget
+ * @return 1 on success, otherwise 0
+ */
+int HLNodeList_setDataBudget(HL_NodeList* nodelist, size_t budget);
+
+/**
+ * Returns the budget for dataset payloads, see @ref HLNodeList_setDataBudget.
+ * @param[in] nodelist - the nodelist
+ * @return the budget in bytes, 0 if there is no budget
+ */
+size_t HLNodeList_getDataBudget(HL_NodeList* nodelist);
+
+/**
+ * Returns the number of bytes of dataset payloads accounted against the budget,
+ * see @ref HLNodeList_setDataBudget.
+ * @param[in] nodelist - the nodelist
+ * @return the number of bytes, 0 if there is no budget
+ */
+size_t HLNodeList_getCachedDataSize(HL_NodeList* nodelist);
+
+/**
+ * Turns computing of statistics on or off. When on, @ref HLNodeList_fetchMarkedNodes and
+ * @ref HLNodeList_fetchNode read numeric datasets in blocks and add each block to the
+ * statistics of the dataset as soon as it has been read, so that no second pass over the
+ * data is needed. The nodata and undetect values are taken from the ODIM what-attributes
+ * of the dataset in the same way as for @ref HLNodeList_fetchDecoded. The statistics are
+ * returned by @ref HLNode_getStatistics. Datasets that already have been prefetched with
+ * @ref HLNodeList_prefetch or are loaded lazily get no statistics.
+ * @param[in] nodelist - the nodelist
+ * @param[in] compute - 1 to compute statistics, 0 to not compute them
+ * @return 1 on success, otherwise 0
+ */
+int HLNodeList_setComputeStatistics(HL_NodeList* nodelist, int compute);
+
+/**
+ * Returns if statistics are computed, see @ref HLNodeList_setComputeStatistics.
+ * @param[in] nodelist - the nodelist
+ * @return 1 if statistics are computed, otherwise 0
+ */
+int HLNodeList_isComputingStatistics(HL_NodeList* nodelist);
+
+/**
+ * Sets the histogram of the statistics, see @ref HLNodeList_setComputeStatistics.
+ * The range is divided into nbins bins of equal width. By default there is no histogram.
+ * @param[in] nodelist - the nodelist
+ * @param[in] nbins - the number of bins, at most @ref HLHDF_MAX_HISTOGRAM_BINS. 0 for no histogram.
+ * @param[in] low - the lower limit of the first bin
+ * @param[in] high - the upper limit of the last bin, must be greater than low
+ * @return 1 on success, otherwise 0
+ */
+int HLNodeList_setStatisticsHistogram(HL_NodeList* nodelist, int nbins, double low, double high);
+
 /**
  * Returns the filename of this nodelist.
  * @param[in] nodelist - the nodelist
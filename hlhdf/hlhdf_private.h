@@ -46,14 +46,40 @@ hid_t createHlHdfFile(const char* filename, HL_FileCreationProperty* property);
 
 /**
  * Translates a HDF5 type identifier into a native type identifier. This identifier
- * is used within the HLHDF library.
+ * is used within the HLHDF library. Translations of fixed size types are cached
+ * so the same native type identifier is shared between all callers translating
+ * equal file types, the returned type must therefore not be modified.
  * @param[in] type the type that should be translated
  * @return a reference to the native type identifier, <0 on failure. Remember to call H5Tclose on the returned type.
  */
 hid_t getFixedType(hid_t type);
 
 /**
- * Returns a native data type from the format specifier.
+ * Returns the size of the native type of a numeric format specifier.
+ * @param[in] specifier the format specifier
+ * @return the size in bytes or 0 if specifier not is a numeric format
+ */
+size_t HL_sizeOfFormatSpecifier(HL_FormatSpecifier specifier);
+
+/**
+ * Lets a thread started by the library report HDF5 errors like the thread that
+ * gave it the work. When HDF5 not is thread-safe the error reporting is shared
+ * by the whole process and is left untouched, otherwise a thread that works in
+ * the background would turn it on or off for every thread.
+ * @param[in] errorReporting the value of @ref HL_isErrorReportingEnabled in the thread that gave the work
+ */
+void HL_inheritErrorReporting(int errorReporting);
+
+/**
+ * Returns the native data type for a format specifier. The type is created once
+ * and then shared so it must not be modified.
+ * @param[in] specifier the format specifier
+ * @return a new reference to the shared type or <0 on failure. Remember to call H5Tclose on the returned type.
+ */
+hid_t HL_translateFormatSpecifierToType(HL_FormatSpecifier specifier);
+
+/**
+ * Returns a native data type from the format specifier, see @ref HL_translateFormatSpecifierToType.
  * @param[in] dataType Format specifier. See @ref ValidFormatSpecifiers "here" for valid format specifiers.
  * @return the reference to the type or <0 on failure.
  */
@@ -123,4 +149,113 @@ int extractParentChildName(HL_Node* node, char** parent, char** child);
  */
 int openGroupOrDataset(hid_t file_id, const char* name, hid_t* lid, HL_Type* type);
 
+/**
+ * A file that is kept open for loading nodes on demand, see @ref HLNodeList_setLazyLoading.
+ * Shared between the nodelist and its nodes and released when the last reference is gone.
+ */
+typedef struct _HL_FileSession HL_FileSession;
+
+/**
+ * Creates a file session for the file. The file is not opened until it is needed.
+ * @param[in] filename the name of the file
+ * @return the session with one reference or NULL on failure
+ */
+HL_FileSession* HLFileSessionPrivate_new(const char* filename);
+
+/**
+ * Adds a reference to the session.
+ * @param[in] session the session, may be NULL
+ * @return the session
+ */
+HL_FileSession* HLFileSessionPrivate_ref(HL_FileSession* session);
+
+/**
+ * Removes a reference from the session and closes the file when no references remains.
+ * The pointer is set to NULL.
+ * @param[in,out] session the session, may point to NULL
+ */
+void HLFileSessionPrivate_release(HL_FileSession** session);
+
+/**
+ * Closes the file if it is open. It will be opened again the next time a node is loaded.
+ * @param[in] session the session, may be NULL
+ */
+void HLFileSessionPrivate_close(HL_FileSession* session);
+
+/**
+ * Fills the node with data from the file of the session.
+ * @param[in] session the session
+ * @param[in] node the node
+ * @return 1 on success, otherwise 0
+ */
+int HLFileSessionPrivate_fetch(HL_FileSession* session, HL_Node* node);
+
+/**
+ * Waits until none of the nodes in the nodelist is being prefetched, see
+ * @ref HLNodeList_prefetch. Must be called before the HDF5 lock is taken by
+ * functions that access the data of all nodes.
+ * @param[in] nodelist the nodelist
+ */
+void HLNodeListPrivate_waitForPrefetch(HL_NodeList* nodelist);
+
+/**
+ * Closes the file held open for lazy loading, if any. Called before the file is
+ * written so that the file not is open twice.
+ * @param[in] nodelist the nodelist
+ */
+void HLNodeListPrivate_closeFileSession(HL_NodeList* nodelist);
+
+/**
+ * Evicts dataset payloads until the nodelist is within its data budget, see
+ * @ref HLNodeList_setDataBudget. Called after data has been fetched.
+ * @param[in] nodelist the nodelist
+ * @param[in] keep a node that must not be evicted, may be NULL
+ */
+void HLNodeListPrivate_applyDataBudget(HL_NodeList* nodelist, HL_Node* keep);
+
+/**
+ * Returns if statistics should be computed when datasets are fetched and how,
+ * see @ref HLNodeList_setComputeStatistics.
+ * @param[in] nodelist the nodelist
+ * @param[out] nbins the number of histogram bins
+ * @param[out] low the lower limit of the histogram
+ * @param[out] high the upper limit of the histogram
+ * @return 1 if statistics should be computed, otherwise 0
+ */
+int HLNodeListPrivate_getStatisticsOptions(HL_NodeList* nodelist, int* nbins, double* low, double* high);
+
+/**
+ * Locates the ODIM what-attribute that applies to a node, i.e. the attribute in the
+ * nearest what-group among the ancestors of the node.
+ * @param[in] nodelist the nodelist
+ * @param[in] name the name of the node
+ * @param[in] attribute the name of the attribute, e.g. nodata
+ * @return the attribute node or NULL if there is none
+ */
+HL_Node* HLNodeListPrivate_findWhatAttribute(HL_NodeList* nodelist, const char* name, const char* attribute);
+
+/**
+ * Keeps the prefetch threads from starting and waits until the running ones have
+ * finished, so that the process can be forked without a thread being inside HDF5.
+ * Every call must be matched by a call to @ref HLNodeListPrivate_resumePrefetch.
+ */
+void HLNodeListPrivate_suspendPrefetch(void);
+
+/**
+ * Lets the prefetch threads start again, see @ref HLNodeListPrivate_suspendPrefetch.
+ */
+void HLNodeListPrivate_resumePrefetch(void);
+
+/**
+ * Keeps the asynchronous I/O thread from starting new operations and waits until the
+ * running operation has finished, so that the process can be forked without the thread
+ * being inside HDF5. Every call must be matched by a call to @ref HLAsyncPrivate_resume.
+ */
+void HLAsyncPrivate_suspend(void);
+
+/**
+ * Lets the asynchronous I/O thread continue, see @ref HLAsyncPrivate_suspend.
+ */
+void HLAsyncPrivate_resume(void);
+
 #endif /* HLHDF_PRIVATE_H_ */
@@ -29,8 +29,11 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 #include "hlhdf_debug.h"
 #include "hlhdf_defines_private.h"
 #include "hlhdf_node_private.h"
+#include "hlhdf_stats_private.h"
+#include "hlhdf_convert_private.h"
 #include <string.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 /*@{ Typedefs */
 
@@ -58,8 +61,80 @@ typedef struct VisitorStruct {
   HL_NodeList* nodelist; /**< the nodelist where to add nodes */
 } VisitorStruct;
 
+/**
+ * A caller provided destination for dataset data, see @ref HLNodeList_fetchNodeInto.
+ */
+typedef struct ReadTarget {
+  const char* format;        /**< the format to convert to, NULL for native type */
+  unsigned char* buffer;     /**< the buffer, set to NULL when handed over to the node */
+  size_t size;               /**< the size of the buffer in bytes */
+  void* owner;               /**< the owner of the buffer */
+  void (*releasefn)(void*);  /**< the release function */
+} ReadTarget;
+
+/**
+ * The nodes that are read by a prefetch thread, see @ref HLNodeList_prefetch.
+ */
+typedef struct PrefetchJob {
+  char* filename;      /**< the file to read from */
+  int errorReporting;  /**< error reporting of the thread that started the prefetch */
+  int nnodes;          /**< number of nodes */
+  HL_Node** nodes;     /**< the nodes, all marked with @ref HLNodePrivate_beginPrefetch */
+} PrefetchJob;
+
+/**
+ * A file kept open for loading nodes on demand.
+ */
+struct _HL_FileSession {
+  int refcount;    /**< number of references */
+  char* filename;  /**< the name of the file */
+  hid_t file_id;   /**< the file, -1 when not open. Protected by the HDF5 lock */
+};
+
+/**
+ * How the statistics of a dataset are computed while it is read, see
+ * @ref HLNodeList_setComputeStatistics.
+ */
+typedef struct StatisticsRequest {
+  HL_StatisticsParameters params; /**< the values that are not valid */
+  int nbins;                      /**< number of bins in the histogram */
+  double low;                     /**< lower limit of the histogram */
+  double high;                    /**< upper limit of the histogram */
+  HL_StatisticsKernel kernel;     /**< the kernel, set when the dataset is read */
+  HL_DataStatistics stats;        /**< the statistics, computed when the dataset is read */
+} StatisticsRequest;
+
 /*@} End of Typedefs */
 
+/*@{ Private variables */
+
+/**
+ * Protects prefetchRunning and prefetchSuspended.
+ */
+static pthread_mutex_t prefetchLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Signalled when a prefetch thread has finished or prefetching has been resumed.
+ */
+static pthread_cond_t prefetchChanged = PTHREAD_COND_INITIALIZER;
+
+/**
+ * Number of running prefetch threads.
+ */
+static int prefetchRunning = 0;
+
+/**
+ * Number of callers that have suspended prefetching, see @ref HLNodeListPrivate_suspendPrefetch.
+ */
+static int prefetchSuspended = 0;
+
+/**
+ * Registers the fork handler once.
+ */
+static pthread_once_t prefetchForkOnce = PTHREAD_ONCE_INIT;
+
+/*@} End of Private variables */
+
 /*@{ Private functions */
 static HL_CompoundTypeDescription* buildTypeDescriptionFromTypeHid(hid_t type_id)
 {
@@ -187,6 +262,7 @@ static herr_t refGroupLocationIterator(hid_t gid, const char* name,
   switch (statbuf.type) {
   case H5G_GROUP:
     if ((obj = H5Gopen(gid, name, H5P_DEFAULT)) >= 0) {
+      HL_STATS_OBJECT_OPENED(obj);
       snprintf(tmp2, 1024, "%s/%s", lookup->tmp_name, name);
       strcpy(lookup->tmp_name, tmp2);
       if (checkIfReferenceMatch(lookup->file_id, lookup->tmp_name, lookup->ref) == 1) {
@@ -200,6 +276,7 @@ static herr_t refGroupLocationIterator(hid_t gid, const char* name,
     break;
   case H5G_DATASET:
     if ((obj = H5Dopen(gid, name, H5P_DEFAULT)) >= 0) {
+      HL_STATS_OBJECT_OPENED(obj);
       snprintf(tmp2, 1024, "%s/%s", lookup->tmp_name, name);
       strcpy(lookup->tmp_name, tmp2);
       if (checkIfReferenceMatch(lookup->file_id, lookup->tmp_name, lookup->ref)
@@ -250,6 +327,7 @@ static char* locateNameForReference(hid_t file_id, hobj_ref_t* ref)
     HL_ERROR0("Failed to open root group");
     goto fail;
   }
+  HL_STATS_OBJECT_OPENED(gid);
 
   H5Giterate(file_id, ".", NULL, refGroupLocationIterator, &lookup);
   HL_H5G_CLOSE(gid);
@@ -269,13 +347,16 @@ static int hlhdf_read_readVariableString(hid_t obj, hid_t type, hsize_t npoints,
   hid_t space = H5Dget_space (obj);
   hsize_t     dims[1] = {1};
   char* rdata = NULL;
+  double starttime = 0.0;
 
   int ndims = H5Sget_simple_extent_dims (space, dims, NULL);
   if (ndims <= 0) { /** SCALAR */
+    starttime = HLStats_getTime();
     if (H5Aread(obj, type, &rdata) < 0) {
       HL_ERROR0("Failed to read string");
       goto fail;
     }
+    HLStats_attributeRead(starttime, (rdata != NULL) ? strlen(rdata) : 0);
     *dataptr = (unsigned char*)HLHDF_STRDUP(rdata);
     *dSize = strlen((const char*)*dataptr);
   } else {
@@ -298,6 +379,7 @@ static int hlhdf_read_readAttributeData(hid_t obj, hid_t type, hsize_t npoints,
   size_t* dSize, unsigned char** dataptr)
 {
   int status = 0;
+  double starttime = 0.0;
   if (dSize == NULL || dataptr == NULL) {
     HL_ERROR0("Inparameters NULL");
     return 0;
@@ -314,10 +396,12 @@ static int hlhdf_read_readAttributeData(hid_t obj, hid_t type, hsize_t npoints,
       HL_ERROR0("Could not allocate memory for attribute data");
       goto fail;
     }
+    starttime = HLStats_getTime();
     if (H5Aread(obj, type, *dataptr) < 0) {
       HL_ERROR0("Could not read attribute data\n");
       goto fail;
     }
+    HLStats_attributeRead(starttime, (*dSize) * npoints);
   }
 
   // If string has been stored with bad nullterm, fix it.
@@ -441,6 +525,7 @@ static int fillAttributeNode(hid_t file_id, HL_Node* node)
   if ((obj = H5Aopen_name(loc_id, child)) < 0) {
     goto fail;
   }
+  HL_STATS_OBJECT_OPENED(obj);
 
   if ((type = H5Aget_type(obj)) < 0) {
     HL_ERROR0("Could not get attribute type");
@@ -537,6 +622,7 @@ static int fillReferenceNode(hid_t file_id, HL_Node* node)
   char* refername = NULL;
   int status = 0;
   hid_t strtype = -1;
+  double starttime = 0.0;
 
   HL_DEBUG0("ENTER: fillReferenceNode");
   if (!extractParentChildName(node, &parent, &child)) {
@@ -552,10 +638,13 @@ static int fillReferenceNode(hid_t file_id, HL_Node* node)
   if ((obj = H5Aopen_name(loc_id, child)) < 0) {
     goto fail;
   }
+  HL_STATS_OBJECT_OPENED(obj);
+  starttime = HLStats_getTime();
   if (H5Aread(obj, H5T_STD_REF_OBJ, &ref) < 0) {
     HL_ERROR0("Could not read reference\n");
     goto fail;
   }
+  HLStats_attributeRead(starttime, sizeof(hobj_ref_t));
 
   if (!(refername = locateNameForReference(file_id, &ref))) {
     HL_INFO2("WARNING: Could not locate name of object referenced by: %s/%s"
@@ -588,23 +677,227 @@ fail:
   return status;
 }
 
+/**
+ * Locates an ODIM what-attribute for a dataset through the nodelist. The attribute
+ * is first looked for in the what-group next to the dataset, e.g. /dataset1/data1/what
+ * for /dataset1/data1/data, and then in the what-groups of the ancestors.
+ * @param[in] nodelist the nodelist
+ * @param[in] file_id the opened file, used if the attribute has not been fetched
+ * @param[in] name the name of the dataset
+ * @param[in] attribute the name of the attribute, e.g. gain
+ * @param[out] value the value of the attribute
+ * @return 1 if found, 0 if not found and -1 on failure
+ */
+static int hlhdf_read_getWhatAttribute(HL_NodeList* nodelist, hid_t file_id, const char* name,
+  const char* attribute, double* value)
+{
+  HL_Node* node = HLNodeListPrivate_findWhatAttribute(nodelist, name, attribute);
+  if (node == NULL) {
+    return 0;
+  }
+  if (!HLNode_fetched(node) && HLNode_getMark(node) != NMARK_CREATED && HLNode_getMark(node) != NMARK_CHANGED &&
+      !fillAttributeNode(file_id, node)) {
+    HL_ERROR2("Failed to fetch attribute '%s' of '%s'", attribute, name);
+    return -1;
+  }
+  if (!HLNode_getDataAs(node, HLHDF_DOUBLE, value)) {
+    HL_ERROR2("Attribute '%s' of '%s' is not numeric", attribute, name);
+    return -1;
+  }
+  return 1;
+}
+
+/**
+ * Number of values that are read at a time when the values are processed while they
+ * are read. Small enough for a block to still be in the cache when it is processed.
+ */
+#define HLHDF_READ_BLOCK_SIZE 65536
+
+/**
+ * Called by @ref hlhdf_read_readBlocks for each block that has been read.
+ * @param[in] ctx the context passed to hlhdf_read_readBlocks
+ * @param[in] values the values that were read
+ * @param[in] first the index of the first value in the dataset
+ * @param[in] n the number of values
+ */
+typedef void (*ReadBlockCallback)(void* ctx, unsigned char* values, hsize_t first, hsize_t n);
+
+/**
+ * Opens a dataset that is going to be read in blocks of rows. HLHDF writes a
+ * dataset as one chunk, which is larger than the default chunk cache, so without
+ * a larger cache every block would decompress the whole chunk again. The chunk
+ * cache is therefore made large enough to hold all chunks that a row of chunks
+ * covers.
+ * @param[in] file_id the file
+ * @param[in] name the name of the dataset
+ * @return the dataset on success, otherwise -1
+ */
+static hid_t hlhdf_read_openBlockDataset(hid_t file_id, const char* name)
+{
+  hid_t obj = -1, dcpl = -1, dapl = -1, type = -1, space = -1;
+  hsize_t chunk[H5S_MAX_RANK], dims[H5S_MAX_RANK];
+  size_t nbytes = 0, nslots = 0, cachesize = 0;
+  double w0 = 0.0;
+  int ndims = 0, i = 0;
+
+  if ((obj = H5Dopen(file_id, name, H5P_DEFAULT)) < 0) {
+    return -1;
+  }
+  if ((dcpl = H5Dget_create_plist(obj)) < 0 || H5Pget_layout(dcpl) != H5D_CHUNKED ||
+      (ndims = H5Pget_chunk(dcpl, H5S_MAX_RANK, chunk)) <= 0 ||
+      (type = H5Dget_type(obj)) < 0 || (space = H5Dget_space(obj)) < 0 ||
+      H5Sget_simple_extent_dims(space, dims, NULL) != ndims) {
+    goto done; /* Not chunked, the default access is fine */
+  }
+  nbytes = H5Tget_size(type) * chunk[0];
+  for (i = 1; i < ndims; i++) {
+    nbytes *= ((dims[i] + chunk[i] - 1) / chunk[i]) * chunk[i];
+  }
+  if ((dapl = H5Dget_access_plist(obj)) < 0 || H5Pget_chunk_cache(dapl, &nslots, &cachesize, &w0) < 0) {
+    goto done;
+  }
+  if (nbytes > cachesize) {
+    if (H5Pset_chunk_cache(dapl, nslots, nbytes, w0) < 0) {
+      goto done;
+    }
+    HL_H5D_CLOSE(obj);
+    obj = H5Dopen(file_id, name, dapl);
+  }
+done:
+  HL_H5P_CLOSE(dapl);
+  HL_H5P_CLOSE(dcpl);
+  HL_H5T_CLOSE(type);
+  HL_H5S_CLOSE(space);
+  return obj;
+}
+
+/**
+ * Reads the dataset in blocks of rows and calls callback for each block while it
+ * still is in the cache.
+ * @param[in] obj the dataset, opened with @ref hlhdf_read_openBlockDataset
+ * @param[in] mtype the memory type to read as
+ * @param[in] ndims the rank of the dataset
+ * @param[in] dims the dimensions of the dataset
+ * @param[in] buffer if NULL, each block is read into the same temporary buffer, otherwise
+ * each block is read into its place in buffer, which must hold the whole dataset
+ * @param[in] callback the function processing the blocks
+ * @param[in] ctx passed to callback
+ * @return 1 on success, otherwise 0
+ */
+static int hlhdf_read_readBlocks(hid_t obj, hid_t mtype, int ndims, hsize_t* dims, unsigned char* buffer,
+  ReadBlockCallback callback, void* ctx)
+{
+  hid_t f_space = -1, m_space = -1;
+  hsize_t* start = NULL;
+  hsize_t* count = NULL;
+  hsize_t rowsize = 1, nrows = 1, row = 0, blockrows = 1;
+  size_t esize = H5Tget_size(mtype);
+  unsigned char* block = NULL;
+  int i = 0, status = 0;
+
+  if ((f_space = H5Dget_space(obj)) < 0) {
+    HL_ERROR0("Failed to get space of dataset");
+    goto fail;
+  }
+  if (ndims > 0) {
+    nrows = dims[0];
+    for (i = 1; i < ndims; i++) {
+      rowsize *= dims[i];
+    }
+    start = HLHDF_CALLOC(ndims, sizeof(hsize_t));
+    count = HLHDF_MALLOC(sizeof(hsize_t) * ndims);
+    if (start == NULL || count == NULL) {
+      HL_ERROR0("Failed to allocate memory for hyperslab");
+      goto fail;
+    }
+    memcpy(count, dims, sizeof(hsize_t) * ndims);
+  }
+  if (rowsize == 0 || nrows == 0) {
+    status = 1; /* Nothing to read */
+    goto fail;
+  }
+  blockrows = (rowsize < HLHDF_READ_BLOCK_SIZE) ? HLHDF_READ_BLOCK_SIZE / rowsize : 1;
+  if (blockrows > nrows) {
+    blockrows = nrows;
+  }
+  if (buffer == NULL && (block = HLHDF_MALLOC(blockrows * rowsize * esize)) == NULL) {
+    HL_ERROR0("Failed to allocate memory for reading");
+    goto fail;
+  }
+  for (row = 0; row < nrows; row += blockrows) {
+    unsigned char* values = (buffer != NULL) ? buffer + row * rowsize * esize : block;
+    hsize_t nvalues = 0;
+    if (ndims > 0) {
+      start[0] = row;
+      count[0] = (nrows - row < blockrows) ? nrows - row : blockrows;
+      if (H5Sselect_hyperslab(f_space, H5S_SELECT_SET, start, NULL, count, NULL) < 0) {
+        HL_ERROR0("Failed to select hyperslab");
+        goto fail;
+      }
+      nvalues = count[0] * rowsize;
+    } else {
+      nvalues = 1;
+    }
+    if ((m_space = H5Screate_simple(1, &nvalues, NULL)) < 0 ||
+        H5Dread(obj, mtype, m_space, f_space, H5P_DEFAULT, values) < 0) {
+      HL_ERROR0("Failed to read dataset");
+      goto fail;
+    }
+    HL_H5S_CLOSE(m_space);
+    callback(ctx, values, row * rowsize, nvalues);
+  }
+
+  status = 1;
+fail:
+  HL_H5S_CLOSE(m_space);
+  HL_H5S_CLOSE(f_space);
+  HLHDF_FREE(block);
+  HLHDF_FREE(start);
+  HLHDF_FREE(count);
+  return status;
+}
+
+/**
+ * Adds a block that has been read to the statistics, see @ref ReadBlockCallback.
+ */
+static void hlhdf_read_addBlockToStatistics(void* ctx, unsigned char* values, hsize_t first, hsize_t n)
+{
+  StatisticsRequest* request = (StatisticsRequest*)ctx;
+  request->kernel(values, (size_t)n, &request->params, &request->stats);
+}
+
 /**
  * Fills a dataset node
+ * @param[in] file_id the file
+ * @param[in] node the node
+ * @param[in] target if not NULL, the data is read into the buffer of the target
+ * instead of into allocated memory
+ * @param[in] statistics if not NULL, the statistics of numeric data are computed while
+ * it is read and set in the node
+ * @return 1 on success, otherwise 0
  */
-static int fillDatasetNode(hid_t file_id, HL_Node* node)
+static int fillDatasetNodeInto(hid_t file_id, HL_Node* node, ReadTarget* target, StatisticsRequest* statistics)
 {
   hid_t obj = -1;
   hid_t type = -1;
   H5G_stat_t statbuf;
   hid_t f_space = -1;
   hid_t mtype = -1;
+  hsize_t* all_dims = NULL;
+  int ndims = 0;
   int status = 0;
 
   HL_DEBUG0("ENTER: fillDatasetNode");
 
-  if ((obj = H5Dopen(file_id, HLNode_getName(node), H5P_DEFAULT)) < 0) {
+  if (statistics != NULL) {
+    obj = hlhdf_read_openBlockDataset(file_id, HLNode_getName(node));
+  } else {
+    obj = H5Dopen(file_id, HLNode_getName(node), H5P_DEFAULT);
+  }
+  if (obj < 0) {
     goto fail;
   }
+  HL_STATS_OBJECT_OPENED(obj);
 
   /* What datatype was this dataset stored as? */
   if ((type = H5Dget_type(obj)) < 0) {
@@ -614,9 +907,7 @@ static int fillDatasetNode(hid_t file_id, HL_Node* node)
 
   /* What size does the type have? */
   if ((f_space = H5Dget_space(obj)) > 0) { /*Get the space description for the dataset */
-    hsize_t* all_dims = NULL;
     hsize_t npoints;
-    int ndims;
 
     if (!hlhdf_read_getSpaceDimensions(f_space, &ndims, &npoints, &all_dims)) {
       HL_ERROR0("Could not read space dimensions");
@@ -624,14 +915,20 @@ static int fillDatasetNode(hid_t file_id, HL_Node* node)
     } else {
       if (!HLNode_setDimensions(node, ndims, all_dims)) {
         HL_ERROR0("Failed to set node dimensions");
-        HLHDF_FREE(all_dims);
         goto fail;
       }
-      HLHDF_FREE(all_dims);
     }
 
     /* Translate the type into a native dataspace */
-    mtype = getFixedType(type);
+    if (target != NULL && target->format != NULL) {
+      mtype = HL_translateFormatStringToDatatype(target->format);
+    } else {
+      mtype = getFixedType(type);
+    }
+    if (mtype < 0) {
+      HL_ERROR0("Failed to get memory type for dataset");
+      goto fail;
+    }
 
     if (H5Tget_class(mtype) == H5T_COMPOUND) {
       HL_CompoundTypeDescription* descr = buildTypeDescriptionFromTypeHid(mtype);
@@ -661,25 +958,62 @@ static int fillDatasetNode(hid_t file_id, HL_Node* node)
       HL_H5T_CLOSE(type);
       HL_H5S_CLOSE(f_space);
       HL_H5T_CLOSE(mtype);
+      HLHDF_FREE(all_dims);
       return 1;
     }
 
     if (H5Sis_simple(f_space) >= 0) { /*Only allow simple dataspace, nothing else supported by HDF5 anyway */
       unsigned char* dataptr = NULL;
       size_t dSize = H5Tget_size(mtype);
-      dataptr = (unsigned char*) HLHDF_MALLOC(dSize * npoints);
+      double starttime = 0.0;
+      if (target != NULL) {
+        if (target->size != dSize * npoints) {
+          HL_ERROR3("Buffer size %lu does not match dataset size %lu for '%s'",
+                    (unsigned long)target->size, (unsigned long)(dSize * npoints), HLNode_getName(node));
+          goto fail;
+        }
+        dataptr = target->buffer;
+      } else {
+        dataptr = (unsigned char*) HLHDF_MALLOC(dSize * npoints);
+      }
       if (dataptr == NULL) {
         HL_ERROR0("Failed to allocate memory for dataset arrray");
         goto fail;
       }
+      if (statistics != NULL) {
+        HL_FormatSpecifier format = HL_getFormatSpecifierFromType(mtype);
+        statistics->kernel = HLConvertPrivate_getStatisticsKernel(format);
+        if (HL_sizeOfFormatSpecifier(format) != dSize) {
+          statistics->kernel = NULL;
+        }
+      }
       H5Sselect_all(f_space);
-      if (H5Dread(obj, mtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, dataptr) < 0) {
+      starttime = HLStats_getTime();
+      if (statistics != NULL && statistics->kernel != NULL) {
+        /* The statistics of each block are computed while it still is in the cache */
+        HLConvertPrivate_initStatistics(&statistics->stats, statistics->nbins, statistics->low, statistics->high);
+        if (!hlhdf_read_readBlocks(obj, mtype, ndims, all_dims, dataptr, hlhdf_read_addBlockToStatistics, statistics)) {
+          if (target == NULL) {
+            HLHDF_FREE(dataptr);
+          }
+          goto fail;
+        }
+        HLConvertPrivate_finishStatistics(&statistics->stats);
+      } else if (H5Dread(obj, mtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, dataptr) < 0) {
         HL_ERROR0("Failed to read dataset");
-        HLHDF_FREE(dataptr);
+        if (target == NULL) {
+          HLHDF_FREE(dataptr);
+        }
         goto fail;
       }
+      HLStats_datasetRead(starttime, dSize * npoints);
 
-      HLNodePrivate_setData(node, dSize, dataptr);
+      if (target != NULL) {
+        HLNodePrivate_setExternalData(node, dSize, dataptr, target->owner, target->releasefn);
+        target->buffer = NULL;
+      } else {
+        HLNodePrivate_setData(node, dSize, dataptr);
+      }
     } else {
       HL_ERROR0("Dataspace for dataset was not simple, this is not supported");
       goto fail;
@@ -689,6 +1023,10 @@ static int fillDatasetNode(hid_t file_id, HL_Node* node)
     goto fail;
   }
 
+  if (statistics != NULL && statistics->kernel != NULL && !HLNodePrivate_setStatistics(node, &statistics->stats)) {
+    goto fail;
+  }
+
   /* Mark the node as original */
   HLNode_setMark(node, NMARK_ORIGINAL);
   HLNode_setFetched(node, 1);
@@ -699,9 +1037,18 @@ fail:
   HL_H5T_CLOSE(type);
   HL_H5S_CLOSE(f_space);
   HL_H5T_CLOSE(mtype);
+  HLHDF_FREE(all_dims);
   return status;
 }
 
+/**
+ * Fills a dataset node
+ */
+static int fillDatasetNode(hid_t file_id, HL_Node* node)
+{
+  return fillDatasetNodeInto(file_id, node, NULL, NULL);
+}
+
 /**
  * Fills a group node
  */
@@ -712,6 +1059,7 @@ static int fillGroupNode(hid_t file_id, HL_Node* node)
   if ((obj = H5Gopen(file_id, HLNode_getName(node), H5P_DEFAULT)) < 0) {
     return 0;
   }
+  HL_STATS_OBJECT_OPENED(obj);
 
   HLNode_setMark(node, NMARK_ORIGINAL);
   HLNode_setFetched(node, 1);
@@ -733,6 +1081,7 @@ static int fillTypeNode(hid_t file_id, HL_Node* node)
     HL_ERROR1("Failed to open %s ", HLNode_getName(node));
     return 0;
   }
+  HL_STATS_OBJECT_OPENED(obj);
   H5Gget_objinfo(obj, ".", TRUE, &statbuf);
 
   if (!(typelist = buildTypeDescriptionFromTypeHid(obj))) {
@@ -782,6 +1131,173 @@ static int fillNodeWithData(hid_t file_id, HL_Node* node)
   return 0;
 }
 
+/**
+ * Fills the node with the appropriate data and, for a dataset, computes its
+ * statistics if the nodelist has been asked to, see @ref HLNodeList_setComputeStatistics.
+ */
+static int fillNodeWithDataAndStatistics(HL_NodeList* nodelist, hid_t file_id, HL_Node* node)
+{
+  StatisticsRequest request;
+  int found = 0;
+
+  if (HLNode_getType(node) != DATASET_ID || HLNode_getMark(node) == NMARK_SELECTMETA ||
+      !HLNodeListPrivate_getStatisticsOptions(nodelist, &request.nbins, &request.low, &request.high)) {
+    return fillNodeWithData(file_id, node);
+  }
+  memset(&request.params, 0, sizeof(HL_StatisticsParameters));
+  if ((found = hlhdf_read_getWhatAttribute(nodelist, file_id, HLNode_getName(node), "nodata", &request.params.nodata)) < 0) {
+    return 0;
+  }
+  request.params.hasNodata = found;
+  if ((found = hlhdf_read_getWhatAttribute(nodelist, file_id, HLNode_getName(node), "undetect", &request.params.undetect)) < 0) {
+    return 0;
+  }
+  request.params.hasUndetect = found;
+  return fillDatasetNodeInto(file_id, node, NULL, &request);
+}
+
+/**
+ * Releases the job. Nodes that still are marked as being prefetched are released as well.
+ * @param[in] job the job
+ * @param[in] first the index of the first node that still is marked
+ */
+static void hlhdf_read_freePrefetchJob(PrefetchJob* job, int first)
+{
+  int i;
+  if (job != NULL) {
+    for (i = first; i < job->nnodes; i++) {
+      HLNodePrivate_endPrefetch(job->nodes[i], 0);
+    }
+    HLHDF_FREE(job->filename);
+    HLHDF_FREE(job->nodes);
+    HLHDF_FREE(job);
+  }
+}
+
+/**
+ * The prefetch threads do not exist in the child, so the child starts without any.
+ */
+static void hlhdf_read_prefetchAfterForkInChild(void)
+{
+  pthread_mutex_init(&prefetchLock, NULL);
+  pthread_cond_init(&prefetchChanged, NULL);
+  prefetchRunning = 0;
+  prefetchSuspended = 0;
+}
+
+static void hlhdf_read_registerPrefetchForkHandler(void)
+{
+  pthread_atfork(NULL, NULL, hlhdf_read_prefetchAfterForkInChild);
+}
+
+/**
+ * Counts a prefetch thread that is about to start, waits while prefetching is suspended.
+ */
+static void hlhdf_read_beginPrefetchThread(void)
+{
+  pthread_once(&prefetchForkOnce, hlhdf_read_registerPrefetchForkHandler);
+  pthread_mutex_lock(&prefetchLock);
+  while (prefetchSuspended > 0) {
+    pthread_cond_wait(&prefetchChanged, &prefetchLock);
+  }
+  prefetchRunning++;
+  pthread_mutex_unlock(&prefetchLock);
+}
+
+/**
+ * Counts a prefetch thread that has finished or never could be started.
+ */
+static void hlhdf_read_endPrefetchThread(void)
+{
+  pthread_mutex_lock(&prefetchLock);
+  prefetchRunning--;
+  pthread_cond_broadcast(&prefetchChanged);
+  pthread_mutex_unlock(&prefetchLock);
+}
+
+/**
+ * The prefetch thread. Reads the nodes one at a time and wakes up anyone waiting
+ * for a node as soon as it has been read. The HDF5 lock is released between the
+ * nodes so that other threads can access HDF5 in the meantime. The file is closed
+ * before the last node is released, so that anyone that has waited for the prefetch
+ * can open the file for writing.
+ * @param[in] arg the @ref PrefetchJob
+ * @return NULL
+ */
+static void* hlhdf_read_prefetchThread(void* arg)
+{
+  PrefetchJob* job = (PrefetchJob*)arg;
+  hid_t file_id = -1;
+  int i = 0;
+
+  HL_inheritErrorReporting(job->errorReporting);
+
+  HL_lockHdf5();
+  if ((file_id = openHlHdfFile(job->filename, "r")) < 0) {
+    HL_ERROR1("Could not open file '%s' when prefetching data", job->filename);
+  }
+  HL_unlockHdf5();
+
+  for (i = 0; file_id >= 0 && i < job->nnodes; i++) {
+    int fetched = 0;
+    HL_lockHdf5();
+    if (!(fetched = fillNodeWithData(file_id, job->nodes[i]))) {
+      HL_ERROR1("Error occured when trying to prefetch node '%s'", HLNode_getName(job->nodes[i]));
+    }
+    if (i == job->nnodes - 1) {
+      HL_H5F_CLOSE(file_id);
+    }
+    HL_unlockHdf5();
+    HLNodePrivate_endPrefetch(job->nodes[i], fetched);
+  }
+
+  HL_lockHdf5();
+  HL_H5F_CLOSE(file_id);
+  H5Eclear2(H5E_DEFAULT);
+  HL_unlockHdf5();
+
+  hlhdf_read_freePrefetchJob(job, i);
+  hlhdf_read_endPrefetchThread();
+  return NULL;
+}
+
+/**
+ * The attributes that HLHDF writes for its own use and that are not read into
+ * the nodelist, see @ref HLNodeList_fetchStoredStatistics.
+ */
+static const char* HIDDEN_ATTRIBUTES[] = {
+  HLHDF_SUMMARY_VALID_COUNT,
+  HLHDF_SUMMARY_NODATA_COUNT,
+  HLHDF_SUMMARY_UNDETECT_COUNT,
+  HLHDF_SUMMARY_MIN,
+  HLHDF_SUMMARY_MAX,
+  HLHDF_SUMMARY_SUM,
+  HLHDF_SUMMARY_TILE_SIZE,
+  HLHDF_SUMMARY_TILE_MIN,
+  HLHDF_SUMMARY_TILE_MAX,
+  HLHDF_KEEP_BITS_ATTRIBUTE,
+  NULL
+};
+
+/**
+ * Returns if the attribute is one of the @ref HIDDEN_ATTRIBUTES.
+ * @param[in] name the name of the attribute
+ * @return 1 if the attribute is hidden, otherwise 0
+ */
+static int hlhdf_read_isHiddenAttribute(const char* name)
+{
+  int i = 0;
+  if (strncmp(name, HLHDF_SUMMARY_PREFIX, strlen(HLHDF_SUMMARY_PREFIX)) != 0) {
+    return 0;
+  }
+  for (i = 0; HIDDEN_ATTRIBUTES[i] != NULL; i++) {
+    if (strcmp(name, HIDDEN_ATTRIBUTES[i]) == 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
 /**
  * Creates an absolute path from <b>root</b> and <b>name</b> parts.
  * @param[in] root - the root path
@@ -852,11 +1368,15 @@ static herr_t hlhdf_node_attribute_visitor(hid_t location_id, const char *name,
 {
   VisitorStruct* vsp = (VisitorStruct*)op_data;
   herr_t status = -1;
-  char* path = hlhdf_read_createPath(vsp->path, name);
+  char* path = NULL;
   hid_t attrid = -1;
   hid_t typeid = -1;
 
-  if (path == NULL) {
+  if (hlhdf_read_isHiddenAttribute(name)) {
+    return 0;
+  }
+
+  if ((path = hlhdf_read_createPath(vsp->path, name)) == NULL) {
     HL_ERROR0("Could not create path");
     goto fail;
   }
@@ -865,6 +1385,7 @@ static herr_t hlhdf_node_attribute_visitor(hid_t location_id, const char *name,
     HL_ERROR1("Could not open attribute: %s", name);
     goto fail;
   }
+  HL_STATS_OBJECT_OPENED(attrid);
 
   if ((typeid = H5Aget_type(attrid)) < 0) {
     HL_ERROR1("Could not get type for %s", name);
@@ -945,6 +1466,94 @@ fail:
   return status;
 }
 
+HL_FileSession* HLFileSessionPrivate_new(const char* filename)
+{
+  HL_FileSession* retv = NULL;
+  if (filename == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return NULL;
+  }
+  if ((retv = HLHDF_MALLOC(sizeof(HL_FileSession))) == NULL) {
+    HL_ERROR0("Failed to allocate memory for file session");
+    return NULL;
+  }
+  retv->refcount = 1;
+  retv->file_id = -1;
+  if ((retv->filename = HLHDF_STRDUP(filename)) == NULL) {
+    HL_ERROR0("Failed to allocate memory for file session");
+    HLHDF_FREE(retv);
+  }
+  return retv;
+}
+
+HL_FileSession* HLFileSessionPrivate_ref(HL_FileSession* session)
+{
+  if (session != NULL) {
+    HLHDF_ATOMIC_INCREMENT(session->refcount);
+  }
+  return session;
+}
+
+void HLFileSessionPrivate_release(HL_FileSession** session)
+{
+  HL_FileSession* s = *session;
+  *session = NULL;
+  if (s != NULL && HLHDF_ATOMIC_DECREMENT(s->refcount) == 0) {
+    HLFileSessionPrivate_close(s);
+    HLHDF_FREE(s->filename);
+    HLHDF_FREE(s);
+  }
+}
+
+void HLFileSessionPrivate_close(HL_FileSession* session)
+{
+  if (session != NULL) {
+    HL_lockHdf5();
+    HL_H5F_CLOSE(session->file_id);
+    HL_unlockHdf5();
+  }
+}
+
+int HLFileSessionPrivate_fetch(HL_FileSession* session, HL_Node* node)
+{
+  int result = 0;
+  HL_ASSERT((session != NULL), "session was NULL");
+  HL_lockHdf5();
+  if (session->file_id < 0 && (session->file_id = openHlHdfFile(session->filename, "r")) < 0) {
+    HL_ERROR1("Could not open file '%s' when loading data", session->filename);
+    goto fail;
+  }
+  if (HLNode_getMark(node) == NMARK_SELECTMETA) {
+    HLNode_setMark(node, NMARK_SELECT);
+  }
+  if (!fillNodeWithData(session->file_id, node)) {
+    HL_ERROR1("Error occured when trying to load node '%s'", HLNode_getName(node));
+    goto fail;
+  }
+  result = 1;
+fail:
+  HL_unlockHdf5();
+  return result;
+}
+
+void HLNodeListPrivate_suspendPrefetch(void)
+{
+  pthread_mutex_lock(&prefetchLock);
+  prefetchSuspended++;
+  while (prefetchRunning > 0) {
+    pthread_cond_wait(&prefetchChanged, &prefetchLock);
+  }
+  pthread_mutex_unlock(&prefetchLock);
+}
+
+void HLNodeListPrivate_resumePrefetch(void)
+{
+  pthread_mutex_lock(&prefetchLock);
+  prefetchSuspended--;
+  pthread_cond_broadcast(&prefetchChanged);
+  pthread_mutex_unlock(&prefetchLock);
+}
+
 /*@} End of Private functions */
 
 /*@{ Interface functions */
@@ -956,6 +1565,7 @@ HL_NodeList* HLNodeList_readFrom(const char* filename, const char* fromPath)
   H5O_info_t objectInfo;
 
   HL_DEBUG0("ENTER: readHL_NodeListFrom");
+  HL_lockHdf5();
 
   if (fromPath == NULL) {
     HL_ERROR0("fromPath == NULL");
@@ -997,6 +1607,7 @@ HL_NodeList* HLNodeList_readFrom(const char* filename, const char* fromPath)
 
   HL_H5F_CLOSE(file_id);
   HL_H5G_CLOSE(gid);
+  HL_unlockHdf5();
   HL_DEBUG0("EXIT: readHL_NodeListFrom ");
   return retv;
 
@@ -1004,6 +1615,7 @@ fail:
   HL_H5F_CLOSE(file_id);
   HL_H5G_CLOSE(gid);
   HLNodeList_free(retv);
+  HL_unlockHdf5();
   HL_DEBUG0("EXIT: readHL_NodeListFrom with Error");
   return NULL;
 }
@@ -1152,6 +1764,20 @@ int HLNodeList_fetchMarkedNodes(HL_NodeList* nodelist)
   int result = 0;
 
   HL_DEBUG0("ENTER: fetchMarkedNodes");
+  if (nodelist != NULL) {
+    /* Marked nodes that already have been prefetched don't have to be read again */
+    HLNodeListPrivate_waitForPrefetch(nodelist);
+    nNodes = HLNodeList_getNumberOfNodes(nodelist);
+    for (i = 0; i < nNodes; i++) {
+      HL_Node* node = HLNodeList_getNodeByIndex(nodelist, i);
+      if ((HLNode_getMark(node) == NMARK_SELECT || HLNode_getMark(node) == NMARK_SELECTMETA) &&
+          HLNodePrivate_claimPrefetched(node)) {
+        HLNode_setMark(node, NMARK_ORIGINAL);
+      }
+    }
+  }
+
+  HL_lockHdf5();
   if (nodelist == NULL) {
     HL_ERROR0("Inparameters NULL");
     goto fail;
@@ -1184,7 +1810,7 @@ int HLNodeList_fetchMarkedNodes(HL_NodeList* nodelist)
       goto fail;
     }
     if (HLNode_getMark(node) == NMARK_SELECT || HLNode_getMark(node) == NMARK_SELECTMETA) {
-      if (!fillNodeWithData(file_id, node)) {
+      if (!fillNodeWithDataAndStatistics(nodelist, file_id, node)) {
         HL_ERROR1("Error occured when trying to fill node '%s'",HLNode_getName(node));
         goto fail;
       }
@@ -1195,6 +1821,8 @@ fail:
   HL_H5F_CLOSE(file_id);
   HL_H5G_CLOSE(gid);
   HLHDF_FREE(filename);
+  HL_unlockHdf5();
+  HLNodeListPrivate_applyDataBudget(nodelist, NULL);
   HL_DEBUG1("EXIT: fetchMarkedNodes with status = %d", result);
   return result;
 }
@@ -1210,6 +1838,14 @@ HL_Node* HLNodeList_fetchNode(HL_NodeList* nodelist, const char* name)
   char* filename = NULL;
 
   HL_DEBUG0("ENTER: fetchNode");
+  /* If the node has been prefetched it only has to be waited for */
+  if (nodelist != NULL && name != NULL && (foundnode = HLNodeList_getNodeByName(nodelist, name)) != NULL &&
+      HLNodePrivate_claimPrefetched(foundnode)) {
+    HL_DEBUG0("EXIT: fetchNode");
+    return foundnode;
+  }
+
+  HL_lockHdf5();
   if (name == NULL || nodelist == NULL) {
     HL_ERROR0("Inparameters NULL");
     goto fail;
@@ -1229,7 +1865,7 @@ HL_Node* HLNodeList_fetchNode(HL_NodeList* nodelist, const char* name)
     goto fail;
   }
 
-  if (!fillNodeWithData(file_id, foundnode)) {
+  if (!fillNodeWithDataAndStatistics(nodelist, file_id, foundnode)) {
     HL_ERROR1("Error occured when trying to fill node '%s'", name);
     goto fail;
   }
@@ -1238,9 +1874,542 @@ HL_Node* HLNodeList_fetchNode(HL_NodeList* nodelist, const char* name)
 fail:
   HL_H5F_CLOSE(file_id);
   HLHDF_FREE(filename);
+  HL_unlockHdf5();
+  HLNodeListPrivate_applyDataBudget(nodelist, result);
   HL_DEBUG0("EXIT: fetchNode");
   return result;
 }
+
+/* ---------------------------------------
+ * FETCH_NODE_INTO
+ * --------------------------------------- */
+HL_Node* HLNodeList_fetchNodeInto(HL_NodeList* nodelist, const char* name, const char* format,
+  unsigned char* buffer, size_t size, void* owner, void (*releasefn)(void*))
+{
+  hid_t file_id = -1;
+  HL_Node* result = NULL;
+  HL_Node* foundnode = NULL;
+  char* filename = NULL;
+  ReadTarget target;
+
+  HL_DEBUG0("ENTER: fetchNodeInto");
+  target.format = format;
+  target.buffer = buffer;
+  target.size = size;
+  target.owner = owner;
+  target.releasefn = releasefn;
+
+  /* A pending prefetch of the node must be finished before it is read again */
+  if (nodelist != NULL && name != NULL && (foundnode = HLNodeList_getNodeByName(nodelist, name)) != NULL) {
+    HLNodePrivate_claimPrefetched(foundnode);
+  }
+
+  HL_lockHdf5();
+  if (name == NULL || nodelist == NULL || buffer == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    goto fail;
+  }
+  if ((filename = HLNodeList_getFileName(nodelist)) == NULL) {
+    HL_ERROR0("Could not get filename from nodelist");
+    goto fail;
+  }
+
+  if ((foundnode = HLNodeList_getNodeByName(nodelist, name)) == NULL) {
+    HL_ERROR1("No node: '%s' found", name);
+    goto fail;
+  }
+  if (HLNode_getType(foundnode) != DATASET_ID) {
+    HL_ERROR1("Node '%s' is not a dataset", name);
+    goto fail;
+  }
+
+  if ((file_id = openHlHdfFile(filename, "r")) < 0) {
+    HL_ERROR1("Could not open file '%s' when fetching data",filename);
+    goto fail;
+  }
+
+  if (!fillDatasetNodeInto(file_id, foundnode, &target, NULL)) {
+    HL_ERROR1("Error occured when trying to fill node '%s'", name);
+    goto fail;
+  }
+
+  result = foundnode;
+fail:
+  HL_H5F_CLOSE(file_id);
+  HLHDF_FREE(filename);
+  HL_unlockHdf5();
+  if (target.buffer != NULL && target.releasefn != NULL) {
+    target.releasefn(target.owner);
+  }
+  HL_DEBUG0("EXIT: fetchNodeInto");
+  return result;
+}
+/* ---------------------------------------
+ * FETCH DECODED
+ * --------------------------------------- */
+/**
+ * The decoding of a dataset, see @ref hlhdf_read_decodeBlock.
+ */
+typedef struct DecodeRequest {
+  HL_DecodeKernel kernel;             /**< the decoding kernel */
+  const HL_DecodeParameters* params;  /**< the decoding parameters */
+  unsigned char* buffer;              /**< the decoded values */
+  size_t tsize;                       /**< the size of a decoded value */
+} DecodeRequest;
+
+/**
+ * Decodes a block that has been read into its place in the decoded buffer,
+ * see @ref ReadBlockCallback.
+ */
+static void hlhdf_read_decodeBlock(void* ctx, unsigned char* values, hsize_t first, hsize_t n)
+{
+  DecodeRequest* request = (DecodeRequest*)ctx;
+  request->kernel(values, request->buffer + first * request->tsize, (size_t)n, request->params);
+}
+
+/**
+ * Reads the dataset in blocks and decodes each block while it still is in the cache.
+ * @param[in] obj the dataset
+ * @param[in] format HLHDF_FLOAT or HLHDF_DOUBLE
+ * @param[in] params the decoding parameters
+ * @param[in] ndims the rank of the dataset
+ * @param[in] dims the dimensions of the dataset
+ * @param[out] buffer the decoded values
+ * @return 1 on success, otherwise 0
+ */
+static int hlhdf_read_decodeDataset(hid_t obj, HL_FormatSpecifier format, const HL_DecodeParameters* params,
+  int ndims, hsize_t* dims, unsigned char* buffer)
+{
+  hid_t type = -1, mtype = -1;
+  hsize_t npoints = 1;
+  DecodeRequest request;
+  double starttime = 0.0;
+  int i = 0, status = 0;
+
+  if ((type = H5Dget_type(obj)) < 0 || (mtype = getFixedType(type)) < 0) {
+    HL_ERROR0("Failed to get type of dataset");
+    goto fail;
+  }
+  request.kernel = HLConvertPrivate_getDecodeKernel(HL_getFormatSpecifierFromType(mtype), format);
+  request.params = params;
+  request.buffer = buffer;
+  request.tsize = HL_sizeOfFormatSpecifier(format);
+  if (request.kernel == NULL ||
+      HL_sizeOfFormatSpecifier(HL_getFormatSpecifierFromType(mtype)) != H5Tget_size(mtype)) {
+    HL_ERROR0("Only numeric datasets can be decoded");
+    goto fail;
+  }
+  for (i = 0; i < ndims; i++) {
+    npoints *= dims[i];
+  }
+
+  starttime = HLStats_getTime();
+  if (!hlhdf_read_readBlocks(obj, mtype, ndims, dims, NULL, hlhdf_read_decodeBlock, &request)) {
+    goto fail;
+  }
+  HLStats_datasetRead(starttime, H5Tget_size(mtype) * npoints);
+
+  status = 1;
+fail:
+  HL_H5T_CLOSE(mtype);
+  HL_H5T_CLOSE(type);
+  return status;
+}
+
+HL_Node* HLNodeList_fetchDecoded(HL_NodeList* nodelist, const char* name, HL_FormatSpecifier format,
+  double nodataValue, double undetectValue)
+{
+  hid_t file_id = -1;
+  hid_t obj = -1;
+  hid_t f_space = -1;
+  HL_Node* foundnode = NULL;
+  HL_Node* result = NULL;
+  HL_DecodeParameters params;
+  char* filename = NULL;
+  unsigned char* buffer = NULL;
+  hsize_t* dims = NULL;
+  hsize_t npoints = 0;
+  int ndims = 0;
+  size_t tsize = HL_sizeOfFormatSpecifier(format);
+  int status = 0;
+
+  HL_DEBUG0("ENTER: fetchDecoded");
+  if (nodelist == NULL || name == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return NULL;
+  }
+  if (format != HLHDF_FLOAT && format != HLHDF_DOUBLE) {
+    HL_ERROR0("Can only decode into float or double");
+    return NULL;
+  }
+  HLNodeListPrivate_waitForPrefetch(nodelist);
+
+  HL_lockHdf5();
+  if ((foundnode = HLNodeList_getNodeByName(nodelist, name)) == NULL || HLNode_getType(foundnode) != DATASET_ID) {
+    HL_ERROR1("No dataset: '%s' found", name);
+    goto fail;
+  }
+  if ((filename = HLNodeList_getFileName(nodelist)) == NULL) {
+    HL_ERROR0("Could not get filename from nodelist");
+    goto fail;
+  }
+  if ((file_id = openHlHdfFile(filename, "r")) < 0) {
+    HL_ERROR1("Could not open file '%s' when fetching data", filename);
+    goto fail;
+  }
+
+  memset(&params, 0, sizeof(HL_DecodeParameters));
+  params.gain = 1.0;
+  params.nodataValue = nodataValue;
+  params.undetectValue = undetectValue;
+  if (hlhdf_read_getWhatAttribute(nodelist, file_id, name, "gain", &params.gain) < 0 ||
+      hlhdf_read_getWhatAttribute(nodelist, file_id, name, "offset", &params.offset) < 0 ||
+      (params.hasNodata = hlhdf_read_getWhatAttribute(nodelist, file_id, name, "nodata", &params.nodata)) < 0 ||
+      (params.hasUndetect = hlhdf_read_getWhatAttribute(nodelist, file_id, name, "undetect", &params.undetect)) < 0) {
+    goto fail;
+  }
+
+  if ((obj = hlhdf_read_openBlockDataset(file_id, name)) < 0) {
+    HL_ERROR1("Could not open dataset '%s'", name);
+    goto fail;
+  }
+  HL_STATS_OBJECT_OPENED(obj);
+  if ((f_space = H5Dget_space(obj)) < 0 || !hlhdf_read_getSpaceDimensions(f_space, &ndims, &npoints, &dims)) {
+    HL_ERROR0("Could not read space dimensions");
+    goto fail;
+  }
+  if ((buffer = HLHDF_MALLOC(tsize * (npoints > 0 ? npoints : 1))) == NULL) {
+    HL_ERROR0("Failed to allocate memory for decoded data");
+    goto fail;
+  }
+  if (!hlhdf_read_decodeDataset(obj, format, &params, ndims, dims, buffer)) {
+    HL_ERROR1("Failed to decode '%s'", name);
+    goto fail;
+  }
+
+  if ((result = HLNode_newDataset(name)) == NULL) {
+    goto fail;
+  }
+  if (ndims > 0) {
+    status = HLNode_adoptArrayValue(result, tsize, ndims, dims, buffer, NULL, HL_getFormatSpecifierString(format), -1);
+  } else {
+    status = HLNode_adoptScalarValue(result, tsize, buffer, NULL, HL_getFormatSpecifierString(format), -1);
+  }
+  buffer = NULL; /* Taken over also on failure */
+  if (!status) {
+    HLNode_free(result);
+    result = NULL;
+  }
+fail:
+  HL_H5S_CLOSE(f_space);
+  HL_H5D_CLOSE(obj);
+  HL_H5F_CLOSE(file_id);
+  HL_unlockHdf5();
+  HLHDF_FREE(filename);
+  HLHDF_FREE(buffer);
+  HLHDF_FREE(dims);
+  HL_DEBUG0("EXIT: fetchDecoded");
+  return result;
+}
+
+/* ---------------------------------------
+ * STORED STATISTICS
+ * --------------------------------------- */
+/**
+ * Opens a dataset in the file of the nodelist so that its stored statistics can be read.
+ * The caller must hold the HDF5 lock.
+ * @param[in] nodelist the nodelist
+ * @param[in] name the name of the dataset
+ * @param[out] file_id the opened file, must be closed by the caller also on failure
+ * @return the dataset or < 0 on failure
+ */
+static hid_t hlhdf_read_openSummarizedDataset(HL_NodeList* nodelist, const char* name, hid_t* file_id)
+{
+  char* filename = NULL;
+  hid_t obj = -1;
+
+  if ((filename = HLNodeList_getFileName(nodelist)) == NULL) {
+    HL_ERROR0("Could not get filename from nodelist");
+    goto fail;
+  }
+  if ((*file_id = openHlHdfFile(filename, "r")) < 0) {
+    HL_ERROR1("Could not open file '%s' when reading statistics", filename);
+    goto fail;
+  }
+  if ((obj = H5Dopen(*file_id, name, H5P_DEFAULT)) < 0) {
+    HL_ERROR1("Could not open dataset '%s'", name);
+    goto fail;
+  }
+  HL_STATS_OBJECT_OPENED(obj);
+fail:
+  HLHDF_FREE(filename);
+  return obj;
+}
+
+/**
+ * Reads a hidden statistics attribute of a dataset.
+ * @param[in] obj the dataset
+ * @param[in] name the name of the attribute
+ * @param[in] mtype the memory type to read the attribute as
+ * @param[out] buf receives the values, if NULL a buffer is allocated
+ * @param[out] npoints the number of values in the attribute, may be NULL
+ * @return buf, the allocated buffer or NULL if the attribute is missing or not could be read
+ */
+static void* hlhdf_read_readSummaryAttribute(hid_t obj, const char* name, hid_t mtype, void* buf, hsize_t* npoints)
+{
+  hid_t attr = -1;
+  hid_t space = -1;
+  void* result = NULL;
+  hssize_t n = 0;
+
+  if (H5Aexists(obj, name) <= 0) {
+    return NULL;
+  }
+  if ((attr = H5Aopen(obj, name, H5P_DEFAULT)) < 0) {
+    HL_ERROR1("Could not open attribute: %s", name);
+    goto fail;
+  }
+  HL_STATS_OBJECT_OPENED(attr);
+  if ((space = H5Aget_space(attr)) < 0 || (n = H5Sget_simple_extent_npoints(space)) < 0) {
+    HL_ERROR1("Could not get the size of attribute: %s", name);
+    goto fail;
+  }
+  if ((result = buf) == NULL && (result = HLHDF_MALLOC(H5Tget_size(mtype) * (n > 0 ? n : 1))) == NULL) {
+    HL_ERROR1("Failed to allocate memory for attribute: %s", name);
+    goto fail;
+  }
+  if (H5Aread(attr, mtype, result) < 0) {
+    HL_ERROR1("Could not read attribute: %s", name);
+    if (result != buf) {
+      HLHDF_FREE(result);
+    }
+    result = NULL;
+    goto fail;
+  }
+  if (npoints != NULL) {
+    *npoints = (hsize_t)n;
+  }
+fail:
+  HL_H5S_CLOSE(space);
+  HL_H5A_CLOSE(attr);
+  return result;
+}
+
+int HLNodeList_fetchStoredStatistics(HL_NodeList* nodelist, const char* name, HL_DataStatistics* stats)
+{
+  hid_t file_id = -1;
+  hid_t obj = -1;
+  hid_t f_space = -1;
+  hssize_t npoints = 0;
+  int status = 0;
+
+  HL_DEBUG0("ENTER: fetchStoredStatistics");
+  if (nodelist == NULL || name == NULL || stats == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return 0;
+  }
+  HLConvertPrivate_initStatistics(stats, 0, 0.0, 0.0);
+  HLNodeListPrivate_waitForPrefetch(nodelist);
+
+  HL_lockHdf5();
+  if ((obj = hlhdf_read_openSummarizedDataset(nodelist, name, &file_id)) < 0) {
+    goto fail;
+  }
+  if ((f_space = H5Dget_space(obj)) < 0 || (npoints = H5Sget_simple_extent_npoints(f_space)) < 0) {
+    HL_ERROR1("Could not get the size of dataset '%s'", name);
+    goto fail;
+  }
+  stats->count = (unsigned long long)npoints;
+  if (hlhdf_read_readSummaryAttribute(obj, HLHDF_SUMMARY_VALID_COUNT, H5T_NATIVE_ULLONG, &stats->validCount, NULL) == NULL ||
+      hlhdf_read_readSummaryAttribute(obj, HLHDF_SUMMARY_NODATA_COUNT, H5T_NATIVE_ULLONG, &stats->nodataCount, NULL) == NULL ||
+      hlhdf_read_readSummaryAttribute(obj, HLHDF_SUMMARY_UNDETECT_COUNT, H5T_NATIVE_ULLONG, &stats->undetectCount, NULL) == NULL ||
+      hlhdf_read_readSummaryAttribute(obj, HLHDF_SUMMARY_MIN, H5T_NATIVE_DOUBLE, &stats->min, NULL) == NULL ||
+      hlhdf_read_readSummaryAttribute(obj, HLHDF_SUMMARY_MAX, H5T_NATIVE_DOUBLE, &stats->max, NULL) == NULL ||
+      hlhdf_read_readSummaryAttribute(obj, HLHDF_SUMMARY_SUM, H5T_NATIVE_DOUBLE, &stats->sum, NULL) == NULL) {
+    HL_DEBUG1("No statistics stored for '%s'", name);
+    goto fail;
+  }
+  HLConvertPrivate_finishStatistics(stats);
+  status = 1;
+fail:
+  HL_H5S_CLOSE(f_space);
+  HL_H5D_CLOSE(obj);
+  HL_H5F_CLOSE(file_id);
+  HL_unlockHdf5();
+  HL_DEBUG0("EXIT: fetchStoredStatistics");
+  return status;
+}
+
+int HLNodeList_mayContainValues(HL_NodeList* nodelist, const char* name, int rank,
+  const hsize_t* start, const hsize_t* count, double low, double high)
+{
+  hid_t file_id = -1;
+  hid_t obj = -1;
+  hid_t f_space = -1;
+  hsize_t* dims = NULL;
+  hsize_t npoints = 0, ntiles = 0, ny = 0, nx = 0;
+  hsize_t rows = 1, cols = 1, r0 = 0, rn = 1, c0 = 0, cn = 1, ty = 0, tx = 0;
+  double* tileMin = NULL;
+  double* tileMax = NULL;
+  int* tileSize = NULL;
+  int ndims = 0, i = 0;
+  int result = -1;
+
+  HL_DEBUG0("ENTER: mayContainValues");
+  if (nodelist == NULL || name == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return -1;
+  }
+  HLNodeListPrivate_waitForPrefetch(nodelist);
+
+  HL_lockHdf5();
+  if ((obj = hlhdf_read_openSummarizedDataset(nodelist, name, &file_id)) < 0) {
+    goto fail;
+  }
+  if ((f_space = H5Dget_space(obj)) < 0 || !hlhdf_read_getSpaceDimensions(f_space, &ndims, &npoints, &dims)) {
+    HL_ERROR0("Could not read space dimensions");
+    goto fail;
+  }
+  if (start != NULL && count != NULL && rank != ndims) {
+    HL_ERROR1("Region does not have the rank of '%s'", name);
+    goto fail;
+  }
+  for (i = 0; start != NULL && count != NULL && i < ndims; i++) {
+    if (start[i] + count[i] > dims[i]) {
+      HL_ERROR1("Region is outside of '%s'", name);
+      goto fail;
+    }
+  }
+  if (ndims >= 2) {
+    rows = rn = dims[0];
+    cols = cn = dims[1];
+    if (start != NULL && count != NULL) {
+      r0 = start[0]; rn = count[0];
+      c0 = start[1]; cn = count[1];
+    }
+  } else if (ndims == 1) {
+    cols = cn = dims[0];
+    if (start != NULL && count != NULL) {
+      c0 = start[0]; cn = count[0];
+    }
+  }
+  if (npoints == 0 || rn == 0 || cn == 0) {
+    result = 0;
+    goto fail;
+  }
+
+  if ((tileSize = hlhdf_read_readSummaryAttribute(obj, HLHDF_SUMMARY_TILE_SIZE, H5T_NATIVE_INT, NULL, &ntiles)) == NULL) {
+    HL_DEBUG1("No tile summary stored for '%s'", name);
+    result = 1;
+    goto fail;
+  }
+  if (ntiles != 2 || tileSize[0] <= 0 || tileSize[1] <= 0 ||
+      (tileMin = hlhdf_read_readSummaryAttribute(obj, HLHDF_SUMMARY_TILE_MIN, H5T_NATIVE_DOUBLE, NULL, &ntiles)) == NULL ||
+      (tileMax = hlhdf_read_readSummaryAttribute(obj, HLHDF_SUMMARY_TILE_MAX, H5T_NATIVE_DOUBLE, NULL, NULL)) == NULL) {
+    HL_ERROR1("Invalid tile summary stored for '%s'", name);
+    goto fail;
+  }
+  ny = (rows + tileSize[0] - 1) / tileSize[0];
+  nx = (cols + tileSize[1] - 1) / tileSize[1];
+  if (ny * nx != ntiles) {
+    HL_ERROR1("Tile summary of '%s' does not match the dataset", name);
+    goto fail;
+  }
+
+  result = 0;
+  for (ty = r0 / tileSize[0]; result == 0 && ty <= (r0 + rn - 1) / tileSize[0]; ty++) {
+    for (tx = c0 / tileSize[1]; tx <= (c0 + cn - 1) / tileSize[1]; tx++) {
+      /* Tiles without valid values have NaN limits and never match */
+      if (tileMax[ty * nx + tx] >= low && tileMin[ty * nx + tx] <= high) {
+        result = 1;
+        break;
+      }
+    }
+  }
+fail:
+  HL_H5S_CLOSE(f_space);
+  HL_H5D_CLOSE(obj);
+  HL_H5F_CLOSE(file_id);
+  HL_unlockHdf5();
+  HLHDF_FREE(dims);
+  HLHDF_FREE(tileMin);
+  HLHDF_FREE(tileMax);
+  HLHDF_FREE(tileSize);
+  HL_DEBUG1("EXIT: mayContainValues with result = %d", result);
+  return result;
+}
+
+/* ---------------------------------------
+ * PREFETCH
+ * --------------------------------------- */
+int HLNodeList_prefetch(HL_NodeList* nodelist, const char** names, int n)
+{
+  PrefetchJob* job = NULL;
+  pthread_t thread;
+  pthread_attr_t attr;
+  int i = 0, started = 0;
+  int status = 0;
+
+  HL_DEBUG0("ENTER: prefetch");
+  if (nodelist == NULL || (names == NULL && n > 0) || n < 0) {
+    HL_ERROR0("Inparameters NULL");
+    return 0;
+  }
+  if ((job = HLHDF_MALLOC(sizeof(PrefetchJob))) == NULL) {
+    HL_ERROR0("Failed to allocate memory for prefetch");
+    return 0;
+  }
+  memset(job, 0, sizeof(PrefetchJob));
+  job->errorReporting = HL_isErrorReportingEnabled();
+
+  if ((job->filename = HLNodeList_getFileName(nodelist)) == NULL) {
+    HL_ERROR0("Could not get filename from nodelist");
+    goto fail;
+  }
+  if (n > 0 && (job->nodes = HLHDF_MALLOC(sizeof(HL_Node*) * n)) == NULL) {
+    HL_ERROR0("Failed to allocate memory for prefetch");
+    goto fail;
+  }
+  for (i = 0; i < n; i++) {
+    HL_Node* node = HLNodeList_getNodeByName(nodelist, names[i]);
+    if (node == NULL) {
+      HL_ERROR1("No node: '%s' found", names[i]);
+      goto fail;
+    }
+    /* Nodes that not are in the file, already have data or are being prefetched are left as they are */
+    if (HLNode_getMark(node) == NMARK_CREATED || HLNode_getMark(node) == NMARK_CHANGED ||
+        (HLNode_getMark(node) == NMARK_ORIGINAL && HLNode_fetched(node))) {
+      continue;
+    }
+    if (HLNodePrivate_beginPrefetch(node)) {
+      HLNode_setMark(node, NMARK_SELECT);
+      job->nodes[job->nnodes++] = node;
+    }
+  }
+
+  if (job->nnodes == 0) {
+    status = 1;
+    goto fail;
+  }
+
+  hlhdf_read_beginPrefetchThread();
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+  started = (pthread_create(&thread, &attr, hlhdf_read_prefetchThread, job) == 0);
+  pthread_attr_destroy(&attr);
+  if (!started) {
+    hlhdf_read_endPrefetchThread();
+    HL_ERROR0("Failed to start prefetch thread");
+    goto fail;
+  }
+  job = NULL; /* The thread takes over the job */
+  status = 1;
+fail:
+  hlhdf_read_freePrefetchJob(job, 0);
+  HL_DEBUG1("EXIT: prefetch with status = %d", status);
+  return status;
+}
+
 /*@} End of Interface functions */
 
 
@@ -118,4 +118,124 @@ int HLNodeList_fetchMarkedNodes(HL_NodeList* nodelist);
  */
 HL_Node* HLNodeList_fetchNode(HL_NodeList* nodelist, const char* name);
 
+/**
+ * Fetches a dataset directly into a buffer provided by the caller instead of into
+ * memory allocated by HLHDF. The node will afterwards refer to the buffer in the same
+ * way as after @ref HLNode_setExternalArrayValue.
+ * @ingroup hlhdf_c_apis
+ * @param[in] nodelist the node list
+ * @param[in] name the name of the dataset that should be fetched
+ * @param[in] format the @ref ValidFormatSpecifiers "format" the data should be converted to when
+ * read, if NULL the native type of the dataset is used.
+ * @param[in] buffer the buffer to read into, must be exactly size bytes
+ * @param[in] size the size of buffer in bytes, must be number of points * size of type
+ * @param[in] owner passed to releasefn
+ * @param[in] releasefn called with owner when the node no longer refers to the buffer and also
+ * if the fetch fails. May be NULL if the caller guarantees that the buffer outlives the node.
+ * @return the found node or NULL on failure.
+ */
+HL_Node* HLNodeList_fetchNodeInto(HL_NodeList* nodelist, const char* name, const char* format,
+  unsigned char* buffer, size_t size, void* owner, void (*releasefn)(void*));
+
+/**
+ * Fetches a quantized ODIM dataset and decodes it into physical values, i.e.
+ * gain * value + offset. The gain, offset, nodata and undetect attributes are looked up
+ * in the what-group next to the dataset and then in the what-groups of its ancestors,
+ * e.g. /dataset1/data1/what/gain and /dataset1/what/gain for /dataset1/data1/data.
+ * A missing gain is 1 and a missing offset is 0. The dataset is read and decoded in
+ * blocks so the quantized values are only passed over once.
+ * The node in the nodelist is not changed, the decoded values are returned in a new node.
+ * @ingroup hlhdf_c_apis
+ * @param[in] nodelist the node list
+ * @param[in] name the name of the dataset
+ * @param[in] format HLHDF_FLOAT or HLHDF_DOUBLE
+ * @param[in] nodataValue the value that nodata should be decoded into, e.g. NAN
+ * @param[in] undetectValue the value that undetect should be decoded into, e.g. NAN
+ * @return a new dataset node with the decoded values that should be released with
+ * @ref HLNode_free or NULL on failure
+ */
+HL_Node* HLNodeList_fetchDecoded(HL_NodeList* nodelist, const char* name, HL_FormatSpecifier format,
+  double nodataValue, double undetectValue);
+
+/**
+ * Returns the statistics that were stored when the dataset was written, see
+ * HL_Compression#summary_tile_size. Only the stored attributes are read, not the dataset.
+ * The statistics have no histogram.
+ * @ingroup hlhdf_c_apis
+ * @param[in] nodelist the node list
+ * @param[in] name the name of the dataset
+ * @param[out] stats receives the statistics
+ * @return 1 if statistics are stored for the dataset, otherwise 0
+ */
+int HLNodeList_fetchStoredStatistics(HL_NodeList* nodelist, const char* name, HL_DataStatistics* stats);
+
+/**
+ * Checks if a region of a dataset may contain valid values within [low, high] by using the
+ * tile summary that was stored when the dataset was written, see HL_Compression#summary_tile_size.
+ * Only the stored attributes are read, not the dataset. The answer is conservative: the
+ * region may contain values if any of the tiles it overlaps has values within the limits.
+ * The tiles span the first two dimensions, or the first dimension of a one-dimensional dataset.
+ * @ingroup hlhdf_c_apis
+ * @param[in] nodelist the node list
+ * @param[in] name the name of the dataset
+ * @param[in] rank the number of values in start and count, must be the rank of the dataset
+ * @param[in] start the first index of the region in each dimension, NULL for the whole dataset
+ * @param[in] count the size of the region in each dimension, NULL for the whole dataset
+ * @param[in] low the lower limit
+ * @param[in] high the upper limit
+ * @return 0 if the region certainly not contains any such values, 1 if it may (also when no
+ * summary is stored) and -1 on failure
+ */
+int HLNodeList_mayContainValues(HL_NodeList* nodelist, const char* name, int rank,
+  const hsize_t* start, const hsize_t* count, double low, double high);
+
+/**
+ * Starts fetching the listed nodes on a background thread and returns immediately.
+ * Each node is available as soon as it has been read: @ref HLNodeList_fetchNode,
+ * @ref HLNodeList_fetchMarkedNodes and the functions accessing the node's data, like
+ * @ref HLNode_getData, wait for the prefetch of that node to finish instead of reading
+ * it again. This way the reading and decompression of the next dataset can overlap with
+ * the processing of the previous one.
+ * Nodes that already have been fetched or that have not been read from the file are
+ * ignored. If the prefetch of a node fails, the node is left unfetched.
+ * The caller must not hold the HDF5 lock, see @ref HL_lockHdf5, when accessing a node that
+ * is being prefetched.
+ * @ingroup hlhdf_c_apis
+ * @param[in] nodelist the node list
+ * @param[in] names the fully qualified names of the nodes to prefetch
+ * @param[in] n the number of names
+ * @return 1 if the prefetch was started, 0 if the thread not could be started or if any of the names not could be found
+ */
+int HLNodeList_prefetch(HL_NodeList* nodelist, const char** names, int n);
+
+/**
+ * Reads several files at once by handing them out to a pool of forked worker
+ * processes. Each worker reads the file, calls selection and fetches the selected
+ * nodes. The fetched nodelist is passed back through shared memory and the callback
+ * is called in the calling process, in the order the files are completed.
+ * The dataset data is not copied out of the shared memory, the nodes refer directly
+ * into a private mapping of it which is released together with the last node using it.
+ * The asynchronous I/O thread and the prefetch threads are suspended while a worker
+ * is forked. Other threads of the application must not be calling HDF5 while this
+ * function is running, since a worker that is forked in the middle of such a call
+ * inherits HDF5 in an undefined state. A thread-safe HDF5 serializes its calls with
+ * an internal lock that HLHDF can not take, so the worker may inherit that lock held
+ * and hang. Use a timeout when this can not be ruled out.
+ * @ingroup hlhdf_c_apis
+ * @param[in] filenames the files to read
+ * @param[in] n the number of files
+ * @param[in] selection the function used for selecting nodes, e.g. @ref HLNodeList_selectAllNodes (default if NULL)
+ * or @ref HLNodeList_selectMetadataNodes
+ * @param[in] nworkers the number of worker processes, if <= 0 the number of online processors is used
+ * @param[in] timeout the number of seconds a worker may spend on one file. A worker that has
+ * not finished in time is killed, the file is reported as failed and a new worker takes
+ * over the remaining files. A worker that crashes on a file is replaced in the same way.
+ * If <= 0, there is no timeout.
+ * @param[in] callback called for each file (MAY NOT BE NULL)
+ * @param[in] userdata passed on to the callback
+ * @return the number of files that was read successfully, -1 on invalid arguments
+ */
+int HLNodeList_readMany(const char** filenames, int n, int (*selection)(HL_NodeList*), int nworkers,
+                        double timeout, HL_ReadManyCallback callback, void* userdata);
+
 #endif
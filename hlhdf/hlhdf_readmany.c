@@ -0,0 +1,1153 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * Reading of several files at once with a pool of worker processes.
+ * @file
+ */
+#include "hlhdf.h"
+#include "hlhdf_alloc.h"
+#include "hlhdf_debug.h"
+#include "hlhdf_defines_private.h"
+#include "hlhdf_node_private.h"
+#include "hlhdf_private.h"
+#include "hlhdf_stats_private.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+/**
+ * Identifies a serialized nodelist.
+ */
+#define SERIALIZED_NODELIST_MAGIC 0x484c4e4c
+
+/**
+ * The dataset payloads are aligned to this many bytes in the serialized nodelist
+ * so that the data can be used directly from the mapping.
+ */
+#define SERIALIZED_PAYLOAD_ALIGNMENT 16
+
+/**
+ * The result that a worker sends back for each file.
+ */
+typedef struct {
+  int index;       /**< index of the file in the filenames array */
+  int status;      /**< 1 if the file was read, otherwise 0 */
+  size_t size;     /**< size of the serialized nodelist */
+  char path[256];  /**< the shared memory file containing the serialized nodelist */
+} ReadManyResult;
+
+/**
+ * A worker process.
+ */
+typedef struct {
+  pid_t pid;      /**< the process id, -1 if the worker not is running */
+  int fd;         /**< the socket used for communicating with the worker */
+  int index;      /**< the file the worker currently is reading, -1 if idle */
+  double started; /**< when the worker was given the file */
+} ReadManyWorker;
+
+/**
+ * Used when serializing a nodelist. When buf is NULL only the size is calculated.
+ */
+typedef struct {
+  unsigned char* buf; /**< the buffer */
+  size_t pos;         /**< the current position */
+} Serializer;
+
+/**
+ * A mapped shared memory file. The dataset payloads refer directly into the
+ * mapping which is unmapped when the last node using it has been released.
+ */
+typedef struct {
+  unsigned char* mem; /**< the mapped memory */
+  size_t size;        /**< the size of the mapping */
+  int refcount;       /**< number of users of the mapping */
+} SharedMapping;
+
+/**
+ * Used when deserializing a nodelist.
+ */
+typedef struct {
+  const unsigned char* buf; /**< the buffer */
+  size_t size;              /**< the size of the buffer */
+  size_t pos;               /**< the current position */
+  SharedMapping* mapping;   /**< the mapping buf belongs to */
+} Deserializer;
+
+/*@{ Private functions */
+static void serializer_put(Serializer* s, const void* data, size_t n)
+{
+  if (s->buf != NULL && n > 0) {
+    memcpy(s->buf + s->pos, data, n);
+  }
+  s->pos += n;
+}
+
+/**
+ * Pads the buffer with zeros so that the position becomes a multiple of
+ * SERIALIZED_PAYLOAD_ALIGNMENT.
+ */
+static void serializer_align(Serializer* s)
+{
+  size_t n = (SERIALIZED_PAYLOAD_ALIGNMENT - s->pos % SERIALIZED_PAYLOAD_ALIGNMENT) % SERIALIZED_PAYLOAD_ALIGNMENT;
+  if (s->buf != NULL && n > 0) {
+    memset(s->buf + s->pos, 0, n);
+  }
+  s->pos += n;
+}
+
+static void serializer_putInt(Serializer* s, int v)
+{
+  serializer_put(s, &v, sizeof(int));
+}
+
+static void serializer_putUInt(Serializer* s, unsigned int v)
+{
+  serializer_put(s, &v, sizeof(unsigned int));
+}
+
+static void serializer_putSize(Serializer* s, size_t v)
+{
+  serializer_put(s, &v, sizeof(size_t));
+}
+
+static void serializer_putULong(Serializer* s, unsigned long v)
+{
+  serializer_put(s, &v, sizeof(unsigned long));
+}
+
+/**
+ * Writes the length of the string including the terminator followed by the string.
+ */
+static void serializer_putString(Serializer* s, const char* str)
+{
+  serializer_putSize(s, strlen(str) + 1);
+  serializer_put(s, str, strlen(str) + 1);
+}
+
+static int deserializer_get(Deserializer* d, void* data, size_t n)
+{
+  if (n > d->size - d->pos) {
+    HL_ERROR0("Serialized nodelist is truncated");
+    return 0;
+  }
+  memcpy(data, d->buf + d->pos, n);
+  d->pos += n;
+  return 1;
+}
+
+static int deserializer_getInt(Deserializer* d, int* v)
+{
+  return deserializer_get(d, v, sizeof(int));
+}
+
+static int deserializer_getUInt(Deserializer* d, unsigned int* v)
+{
+  return deserializer_get(d, v, sizeof(unsigned int));
+}
+
+static int deserializer_getSize(Deserializer* d, size_t* v)
+{
+  return deserializer_get(d, v, sizeof(size_t));
+}
+
+static int deserializer_getULong(Deserializer* d, unsigned long* v)
+{
+  return deserializer_get(d, v, sizeof(unsigned long));
+}
+
+/**
+ * Reads a string written with serializer_putString into str, which has room for n characters.
+ */
+static int deserializer_getString(Deserializer* d, char* str, size_t n)
+{
+  size_t len = 0;
+  if (!deserializer_getSize(d, &len) || len == 0 || len > n || !deserializer_get(d, str, len) || str[len - 1] != '\0') {
+    HL_ERROR0("Failed to deserialize string");
+    return 0;
+  }
+  return 1;
+}
+
+/**
+ * Steps past the padding written by serializer_align.
+ */
+static int deserializer_align(Deserializer* d)
+{
+  size_t n = (SERIALIZED_PAYLOAD_ALIGNMENT - d->pos % SERIALIZED_PAYLOAD_ALIGNMENT) % SERIALIZED_PAYLOAD_ALIGNMENT;
+  if (n > d->size - d->pos) {
+    HL_ERROR0("Serialized nodelist is truncated");
+    return 0;
+  }
+  d->pos += n;
+  return 1;
+}
+
+/**
+ * Returns a pointer to the next n bytes in the buffer and steps past them.
+ */
+static const unsigned char* deserializer_skip(Deserializer* d, size_t n)
+{
+  const unsigned char* result = NULL;
+  if (n > d->size - d->pos) {
+    HL_ERROR0("Serialized nodelist is truncated");
+    return NULL;
+  }
+  result = d->buf + d->pos;
+  d->pos += n;
+  return result;
+}
+
+/**
+ * Writes the compound type description field by field, the structures are not
+ * written as they are so that padding and pointers never end up in the buffer.
+ * @param[in] s the serializer
+ * @param[in] descr the description
+ */
+static void serializeCompoundDescription(Serializer* s, HL_CompoundTypeDescription* descr)
+{
+  int i = 0, j = 0;
+  serializer_putString(s, descr->hltypename);
+  serializer_putULong(s, descr->objno[0]);
+  serializer_putULong(s, descr->objno[1]);
+  serializer_putSize(s, descr->size);
+  serializer_putInt(s, descr->nAttrs);
+  for (i = 0; i < descr->nAttrs; i++) {
+    HL_CompoundTypeAttribute* attr = descr->attrs[i];
+    serializer_putString(s, attr->attrname);
+    serializer_putSize(s, attr->offset);
+    serializer_putSize(s, attr->size);
+    serializer_putString(s, attr->format);
+    serializer_putInt(s, attr->ndims);
+    for (j = 0; j < attr->ndims; j++) {
+      serializer_putSize(s, attr->dims[j]);
+    }
+  }
+}
+
+/**
+ * Writes the compression field by field.
+ * @param[in] s the serializer
+ * @param[in] compression the compression
+ */
+static void serializeCompression(Serializer* s, HL_Compression* compression)
+{
+  serializer_putInt(s, (int)compression->type);
+  serializer_putInt(s, compression->level);
+  serializer_putUInt(s, compression->szlib_mask);
+  serializer_putUInt(s, compression->szlib_px_per_block);
+  serializer_putInt(s, compression->summary_tile_size);
+  serializer_putInt(s, compression->keep_bits);
+  serializer_putInt(s, compression->keep_digits);
+  serializer_putInt(s, (int)compression->predictor);
+}
+
+/**
+ * Writes one node to the serializer.
+ * @param[in] s the serializer
+ * @param[in] node the node
+ * @return 1 on success, otherwise 0
+ */
+static int serializeNode(Serializer* s, HL_Node* node)
+{
+  int ndims = HLNode_getRank(node);
+  hsize_t npts = HLNode_getNumberOfPoints(node);
+  const char* name = HLNode_getName(node);
+  hid_t typeId = HLNodePrivate_getTypeId(node);
+  HL_CompoundTypeDescription* descr = HLNode_getCompoundDescription(node);
+  HL_Compression* compression = HLNode_getCompression(node);
+  size_t typeSize = 0;
+
+  serializer_putInt(s, (int)HLNode_getType(node));
+  serializer_putString(s, name);
+
+  serializer_putInt(s, ndims);
+  serializer_put(s, HLNodePrivate_getDims(node), sizeof(hsize_t) * ndims);
+
+  serializer_putInt(s, (int)HLNode_getDataType(node));
+  serializer_putInt(s, (int)HLNode_getMark(node));
+  serializer_putInt(s, HLNode_fetched(node));
+
+  serializer_putSize(s, HLNode_getDataSize(node));
+  if (HLNode_getData(node) != NULL) {
+    serializer_putSize(s, npts * HLNode_getDataSize(node));
+    serializer_align(s);
+    serializer_put(s, HLNode_getData(node), npts * HLNode_getDataSize(node));
+  } else {
+    serializer_putSize(s, 0);
+  }
+
+  serializer_putSize(s, HLNode_getRawdataSize(node));
+  if (HLNode_getRawdata(node) != NULL) {
+    serializer_putSize(s, npts * HLNode_getRawdataSize(node));
+    serializer_put(s, HLNode_getRawdata(node), npts * HLNode_getRawdataSize(node));
+  } else {
+    serializer_putSize(s, 0);
+  }
+
+  if (typeId >= 0) {
+    if (H5Tencode(typeId, NULL, &typeSize) < 0) {
+      HL_ERROR1("Could not encode type for node %s", name);
+      return 0;
+    }
+    serializer_putSize(s, typeSize);
+    if (s->buf != NULL && H5Tencode(typeId, s->buf + s->pos, &typeSize) < 0) {
+      HL_ERROR1("Could not encode type for node %s", name);
+      return 0;
+    }
+    s->pos += typeSize;
+  } else {
+    serializer_putSize(s, 0);
+  }
+
+  serializer_putInt(s, descr != NULL);
+  if (descr != NULL) {
+    serializeCompoundDescription(s, descr);
+  }
+
+  serializer_putInt(s, compression != NULL);
+  if (compression != NULL) {
+    serializeCompression(s, compression);
+  }
+
+  return 1;
+}
+
+/**
+ * Writes the nodelist to the serializer.
+ * @param[in] s the serializer
+ * @param[in] nodelist the nodelist
+ * @return 1 on success, otherwise 0
+ */
+static int serializeNodelist(Serializer* s, HL_NodeList* nodelist)
+{
+  int i = 0;
+  int nNodes = HLNodeList_getNumberOfNodes(nodelist);
+  serializer_putInt(s, SERIALIZED_NODELIST_MAGIC);
+  serializer_putInt(s, nNodes);
+  for (i = 0; i < nNodes; i++) {
+    if (!serializeNode(s, HLNodeList_getNodeByIndex(nodelist, i))) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * Creates a node of the specified type.
+ */
+static HL_Node* createNodeWithType(HL_Type type, const char* name)
+{
+  switch (type) {
+  case ATTRIBUTE_ID:
+    return HLNode_newAttribute(name);
+  case GROUP_ID:
+    return HLNode_newGroup(name);
+  case DATASET_ID:
+    return HLNode_newDataset(name);
+  case TYPE_ID:
+    return HLNode_newDatatype(name);
+  case REFERENCE_ID:
+    return HLNode_newReference(name);
+  default:
+    return HLNode_new(name);
+  }
+}
+
+/**
+ * Removes a reference from the mapping and unmaps it when no references remains.
+ * Used as release function for the node data that refers into the mapping.
+ * @param[in] owner the mapping
+ */
+static void releaseSharedMapping(void* owner)
+{
+  SharedMapping* mapping = (SharedMapping*)owner;
+  if (mapping != NULL && HLHDF_ATOMIC_DECREMENT(mapping->refcount) == 0) {
+    munmap(mapping->mem, mapping->size);
+    HLHDF_FREE(mapping);
+  }
+}
+
+/**
+ * Reads the dataset payload and sets it as data in the node. When the
+ * deserializer is reading from a mapping, the node refers directly into
+ * the mapping instead of getting a copy of the data.
+ * @param[in] d the deserializer
+ * @param[in] node the node
+ * @param[in] dSize the size of the data type
+ * @param[in] n the number of bytes
+ * @return 1 on success, otherwise 0
+ */
+static int deserializeData(Deserializer* d, HL_Node* node, size_t dSize, size_t n)
+{
+  const unsigned char* ptr = NULL;
+  unsigned char* data = NULL;
+  if (n == 0) {
+    HLNodePrivate_setData(node, dSize, NULL);
+    return 1;
+  }
+  if (!deserializer_align(d) || (ptr = deserializer_skip(d, n)) == NULL) {
+    return 0;
+  }
+  if (d->mapping != NULL) {
+    HLHDF_ATOMIC_INCREMENT(d->mapping->refcount);
+    HLNodePrivate_setExternalData(node, dSize, (unsigned char*)ptr, d->mapping, releaseSharedMapping);
+    return 1;
+  }
+  if ((data = (unsigned char*)HLHDF_MALLOC(n)) == NULL) {
+    HL_ERROR0("Failed to allocate memory for node data");
+    return 0;
+  }
+  memcpy(data, ptr, n);
+  HLNodePrivate_setData(node, dSize, data);
+  return 1;
+}
+
+/**
+ * Reads the content of the serialized data into a newly allocated buffer.
+ * @param[in] d the deserializer
+ * @param[in] n the number of bytes
+ * @param[out] data the allocated buffer, NULL if n is 0
+ * @return 1 on success, otherwise 0
+ */
+static int deserializeBuffer(Deserializer* d, size_t n, unsigned char** data)
+{
+  const unsigned char* ptr = NULL;
+  *data = NULL;
+  if (n == 0) {
+    return 1;
+  }
+  if ((ptr = deserializer_skip(d, n)) == NULL) {
+    return 0;
+  }
+  if ((*data = (unsigned char*)HLHDF_MALLOC(n)) == NULL) {
+    HL_ERROR0("Failed to allocate memory for node data");
+    return 0;
+  }
+  memcpy(*data, ptr, n);
+  return 1;
+}
+
+/**
+ * Reads a compound type description written by serializeCompoundDescription.
+ * @param[in] d the deserializer
+ * @return the description on success, otherwise NULL
+ */
+static HL_CompoundTypeDescription* deserializeCompoundDescription(Deserializer* d)
+{
+  HL_CompoundTypeDescription* descr = NULL;
+  HL_CompoundTypeAttribute* attr = NULL;
+  int nAttrs = 0, i = 0, j = 0;
+
+  if ((descr = newHL_CompoundTypeDescription()) == NULL) {
+    return NULL;
+  }
+  if (!deserializer_getString(d, descr->hltypename, sizeof(descr->hltypename)) ||
+      !deserializer_getULong(d, &descr->objno[0]) || !deserializer_getULong(d, &descr->objno[1]) ||
+      !deserializer_getSize(d, &descr->size) || !deserializer_getInt(d, &nAttrs) || nAttrs < 0) {
+    goto fail;
+  }
+  for (i = 0; i < nAttrs; i++) {
+    if ((attr = (HL_CompoundTypeAttribute*)HLHDF_MALLOC(sizeof(HL_CompoundTypeAttribute))) == NULL) {
+      goto fail;
+    }
+    memset(attr, 0, sizeof(HL_CompoundTypeAttribute));
+    if (!deserializer_getString(d, attr->attrname, sizeof(attr->attrname)) ||
+        !deserializer_getSize(d, &attr->offset) || !deserializer_getSize(d, &attr->size) ||
+        !deserializer_getString(d, attr->format, sizeof(attr->format)) ||
+        !deserializer_getInt(d, &attr->ndims) || attr->ndims < 0 || attr->ndims > 4) {
+      goto fail;
+    }
+    for (j = 0; j < attr->ndims; j++) {
+      if (!deserializer_getSize(d, &attr->dims[j])) {
+        goto fail;
+      }
+    }
+    if (!addHL_CompoundTypeAttribute(descr, attr)) {
+      goto fail;
+    }
+    attr = NULL;
+  }
+  return descr;
+fail:
+  HLHDF_FREE(attr);
+  freeHL_CompoundTypeDescription(descr);
+  return NULL;
+}
+
+/**
+ * Reads a compression written by serializeCompression.
+ * @param[in] d the deserializer
+ * @return the compression on success, otherwise NULL
+ */
+static HL_Compression* deserializeCompression(Deserializer* d)
+{
+  HL_Compression* compression = NULL;
+  int type = 0, predictor = 0;
+
+  if ((compression = HLCompression_new(CT_NONE)) == NULL) {
+    return NULL;
+  }
+  if (!deserializer_getInt(d, &type) || !deserializer_getInt(d, &compression->level) ||
+      !deserializer_getUInt(d, &compression->szlib_mask) ||
+      !deserializer_getUInt(d, &compression->szlib_px_per_block) ||
+      !deserializer_getInt(d, &compression->summary_tile_size) ||
+      !deserializer_getInt(d, &compression->keep_bits) ||
+      !deserializer_getInt(d, &compression->keep_digits) ||
+      !deserializer_getInt(d, &predictor)) {
+    HLCompression_free(compression);
+    return NULL;
+  }
+  compression->type = (HL_CompressionType)type;
+  compression->predictor = (HL_PredictorType)predictor;
+  return compression;
+}
+
+/**
+ * Reads one node from the deserializer.
+ * @param[in] d the deserializer
+ * @return the node on success, otherwise NULL
+ */
+static HL_Node* deserializeNode(Deserializer* d)
+{
+  HL_Node* node = NULL;
+  int type = 0, ndims = 0, dataType = 0, mark = 0, fetched = 0, hasDescr = 0, hasCompression = 0;
+  size_t namelen = 0, dSize = 0, datalen = 0, rdSize = 0, rawlen = 0, typeSize = 0;
+  const char* name = NULL;
+  const unsigned char* typeBuffer = NULL;
+  hsize_t dims[32];
+  unsigned char* data = NULL;
+  hid_t typeId = -1;
+  HL_CompoundTypeDescription* descr = NULL;
+  HL_Compression* compression = NULL;
+
+  if (!deserializer_getInt(d, &type) || !deserializer_getSize(d, &namelen) ||
+      (name = (const char*)deserializer_skip(d, namelen)) == NULL || namelen == 0 || name[namelen - 1] != '\0') {
+    HL_ERROR0("Failed to deserialize node name");
+    goto fail;
+  }
+  if ((node = createNodeWithType((HL_Type)type, name)) == NULL) {
+    HL_ERROR1("Failed to create node %s", name);
+    goto fail;
+  }
+
+  if (!deserializer_getInt(d, &ndims) || ndims < 0 || ndims > 32 ||
+      !deserializer_get(d, dims, sizeof(hsize_t) * ndims) ||
+      !HLNode_setDimensions(node, ndims, dims)) {
+    HL_ERROR1("Failed to deserialize dimensions for %s", name);
+    goto fail;
+  }
+
+  if (!deserializer_getInt(d, &dataType) || !deserializer_getInt(d, &mark) || !deserializer_getInt(d, &fetched)) {
+    goto fail;
+  }
+  HLNode_setDataType(node, (HL_DataType)dataType);
+  HLNode_setMark(node, (HL_NodeMark)mark);
+  HLNode_setFetched(node, fetched);
+
+  if (!deserializer_getSize(d, &dSize) || !deserializer_getSize(d, &datalen) || !deserializeData(d, node, dSize, datalen)) {
+    HL_ERROR1("Failed to deserialize data for %s", name);
+    goto fail;
+  }
+
+  if (!deserializer_getSize(d, &rdSize) || !deserializer_getSize(d, &rawlen) || !deserializeBuffer(d, rawlen, &data)) {
+    HL_ERROR1("Failed to deserialize rawdata for %s", name);
+    goto fail;
+  }
+  HLNodePrivate_setRawdata(node, rdSize, data);
+  data = NULL;
+
+  if (!deserializer_getSize(d, &typeSize)) {
+    goto fail;
+  }
+  if (typeSize > 0) {
+    int typeOk = 0;
+    if ((typeBuffer = deserializer_skip(d, typeSize)) == NULL) {
+      goto fail;
+    }
+    HL_lockHdf5();
+    if ((typeId = H5Tdecode(typeBuffer)) >= 0) {
+      typeOk = HLNodePrivate_setTypeIdAndDeriveFormat(node, typeId);
+    }
+    HL_H5T_CLOSE(typeId);
+    HL_unlockHdf5();
+    if (!typeOk) {
+      HL_ERROR1("Failed to decode type for %s", name);
+      goto fail;
+    }
+  }
+
+  if (!deserializer_getInt(d, &hasDescr)) {
+    goto fail;
+  }
+  if (hasDescr) {
+    if ((descr = deserializeCompoundDescription(d)) == NULL) {
+      HL_ERROR1("Failed to deserialize compound type description for %s", name);
+      goto fail;
+    }
+    HLNode_setCompoundDescription(node, descr);
+  }
+
+  if (!deserializer_getInt(d, &hasCompression)) {
+    goto fail;
+  }
+  if (hasCompression) {
+    if ((compression = deserializeCompression(d)) == NULL) {
+      HL_ERROR1("Failed to deserialize compression for %s", name);
+      goto fail;
+    }
+    HLNode_setCompression(node, compression);
+  }
+
+  return node;
+fail:
+  HLNode_free(node);
+  return NULL;
+}
+
+/**
+ * Creates a nodelist from a serialized buffer.
+ * @param[in] buf the buffer
+ * @param[in] size the size of the buffer
+ * @param[in] mapping the mapping buf belongs to, if NULL the data is copied
+ * @param[in] filename the name of the file that was read
+ * @return the nodelist on success, otherwise NULL
+ */
+static HL_NodeList* deserializeNodelist(const unsigned char* buf, size_t size, SharedMapping* mapping, const char* filename)
+{
+  Deserializer d;
+  HL_NodeList* nodelist = NULL;
+  int magic = 0, nNodes = 0, i = 0;
+
+  d.buf = buf;
+  d.size = size;
+  d.pos = 0;
+  d.mapping = mapping;
+
+  if (!deserializer_getInt(&d, &magic) || magic != SERIALIZED_NODELIST_MAGIC || !deserializer_getInt(&d, &nNodes)) {
+    HL_ERROR1("Not a serialized nodelist for %s", filename);
+    goto fail;
+  }
+  if ((nodelist = HLNodeList_new()) == NULL || !HLNodeList_setFileName(nodelist, filename)) {
+    HL_ERROR0("Failed to create nodelist");
+    goto fail;
+  }
+  for (i = 0; i < nNodes; i++) {
+    HL_Node* node = deserializeNode(&d);
+    if (node == NULL || !HLNodeList_addNode(nodelist, node)) {
+      HL_ERROR1("Failed to deserialize node in %s", filename);
+      HLNode_free(node);
+      goto fail;
+    }
+  }
+  return nodelist;
+fail:
+  HLNodeList_free(nodelist);
+  return NULL;
+}
+
+/**
+ * Returns the directory where the shared memory files are created.
+ */
+static const char* getSharedMemoryDirectory(void)
+{
+  struct stat st;
+  const char* tmpdir = NULL;
+  if (stat("/dev/shm", &st) == 0 && S_ISDIR(st.st_mode) && access("/dev/shm", W_OK) == 0) {
+    return "/dev/shm";
+  }
+  tmpdir = getenv("TMPDIR");
+  if (tmpdir != NULL && strlen(tmpdir) < 200) {
+    return tmpdir;
+  }
+  return "/tmp";
+}
+
+static int readFully(int fd, void* buf, size_t n)
+{
+  size_t pos = 0;
+  while (pos < n) {
+    ssize_t r = recv(fd, (char*)buf + pos, n - pos, 0);
+    if (r < 0 && errno == EINTR) {
+      continue;
+    }
+    if (r <= 0) {
+      return 0;
+    }
+    pos += r;
+  }
+  return 1;
+}
+
+static int writeFully(int fd, const void* buf, size_t n)
+{
+  size_t pos = 0;
+  while (pos < n) {
+    ssize_t r = send(fd, (const char*)buf + pos, n - pos, MSG_NOSIGNAL);
+    if (r < 0 && errno == EINTR) {
+      continue;
+    }
+    if (r <= 0) {
+      return 0;
+    }
+    pos += r;
+  }
+  return 1;
+}
+
+/**
+ * Reads, selects and fetches the file and writes the serialized nodelist to a shared memory file.
+ * @param[in] filename the file to read
+ * @param[in] selection the selection function
+ * @param[in,out] result the result, size and path will be set on success
+ * @return 1 on success, otherwise 0
+ */
+static int readToSharedMemory(const char* filename, int (*selection)(HL_NodeList*), ReadManyResult* result)
+{
+  HL_NodeList* nodelist = NULL;
+  Serializer s;
+  unsigned char* mem = MAP_FAILED;
+  int fd = -1;
+  int status = 0;
+
+  if ((nodelist = HLNodeList_read(filename)) == NULL) {
+    HL_ERROR1("Failed to read %s", filename);
+    goto fail;
+  }
+  if (!selection(nodelist) || !HLNodeList_fetchMarkedNodes(nodelist)) {
+    HL_ERROR1("Failed to fetch %s", filename);
+    goto fail;
+  }
+
+  s.buf = NULL;
+  s.pos = 0;
+  HL_lockHdf5();
+  status = serializeNodelist(&s, nodelist);
+  HL_unlockHdf5();
+  if (!status) {
+    goto fail;
+  }
+  status = 0;
+  result->size = s.pos;
+
+  snprintf(result->path, sizeof(result->path), "%s/hlhdf-%ld-XXXXXX", getSharedMemoryDirectory(), (long)getpid());
+  if ((fd = mkstemp(result->path)) < 0) {
+    HL_ERROR1("Failed to create shared memory file %s", result->path);
+    goto fail;
+  }
+  if (ftruncate(fd, (off_t)result->size) < 0 ||
+      (mem = mmap(NULL, result->size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+    HL_ERROR1("Failed to map shared memory file %s", result->path);
+    unlink(result->path);
+    goto fail;
+  }
+  s.buf = mem;
+  s.pos = 0;
+  HL_lockHdf5();
+  status = serializeNodelist(&s, nodelist);
+  HL_unlockHdf5();
+  if (!status) {
+    unlink(result->path);
+  }
+fail:
+  if (mem != MAP_FAILED) {
+    munmap(mem, result->size);
+  }
+  if (fd >= 0) {
+    close(fd);
+  }
+  HLNodeList_free(nodelist);
+  return status;
+}
+
+/**
+ * The worker loop. Reads file indexes from the socket until it is closed and
+ * sends back a @ref ReadManyResult for each file.
+ */
+static void readManyWorker(int fd, const char** filenames, int (*selection)(HL_NodeList*))
+{
+  int index = 0;
+  while (readFully(fd, &index, sizeof(int)) && index >= 0) {
+    ReadManyResult result;
+    memset(&result, 0, sizeof(ReadManyResult));
+    result.index = index;
+    result.status = readToSharedMemory(filenames[index], selection, &result);
+    if (!writeFully(fd, &result, sizeof(ReadManyResult))) {
+      if (result.status) {
+        unlink(result.path);
+      }
+      break;
+    }
+  }
+  close(fd);
+}
+
+/**
+ * Maps the shared memory file and creates the nodelist from it. The file is removed.
+ * The dataset payloads are not copied, the nodes refer into the mapping which is
+ * kept until the last of them has been released. The mapping is private so writing
+ * to the data only affects this process.
+ */
+static HL_NodeList* readFromSharedMemory(ReadManyResult* result, const char* filename)
+{
+  HL_NodeList* nodelist = NULL;
+  SharedMapping* mapping = NULL;
+  unsigned char* mem = MAP_FAILED;
+  int fd = -1;
+
+  if ((fd = open(result->path, O_RDONLY)) < 0) {
+    HL_ERROR1("Failed to open shared memory file %s", result->path);
+    goto fail;
+  }
+  unlink(result->path);
+  if ((mem = mmap(NULL, result->size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+    HL_ERROR1("Failed to map shared memory file %s", result->path);
+    goto fail;
+  }
+  if ((mapping = (SharedMapping*)HLHDF_MALLOC(sizeof(SharedMapping))) == NULL) {
+    HL_ERROR0("Failed to allocate memory for shared mapping");
+    munmap(mem, result->size);
+    goto fail;
+  }
+  mapping->mem = mem;
+  mapping->size = result->size;
+  mapping->refcount = 1;
+  nodelist = deserializeNodelist(mem, result->size, mapping, filename);
+  releaseSharedMapping(mapping);
+fail:
+  if (fd >= 0) {
+    close(fd);
+  } else {
+    unlink(result->path);
+  }
+  return nodelist;
+}
+
+/**
+ * Removes the shared memory files that a worker that has been killed might have left behind.
+ * @param[in] pid the process id of the worker
+ */
+static void removeWorkerFiles(pid_t pid)
+{
+  const char* dirname = getSharedMemoryDirectory();
+  char prefix[64];
+  char path[512];
+  DIR* dir = NULL;
+  struct dirent* entry = NULL;
+
+  snprintf(prefix, sizeof(prefix), "hlhdf-%ld-", (long)pid);
+  if ((dir = opendir(dirname)) == NULL) {
+    return;
+  }
+  while ((entry = readdir(dir)) != NULL) {
+    if (strncmp(entry->d_name, prefix, strlen(prefix)) == 0) {
+      snprintf(path, sizeof(path), "%s/%s", dirname, entry->d_name);
+      unlink(path);
+    }
+  }
+  closedir(dir);
+}
+
+/**
+ * Starts a worker process. The asynchronous I/O thread and the prefetch threads are
+ * suspended and the HDF5 lock is held while forking, so that the worker not inherits
+ * HDF5 in the middle of a call made by one of them.
+ * @param[in] workers all workers
+ * @param[in] nworkers the number of workers
+ * @param[in] index the index of the worker to start
+ * @param[in] filenames the files
+ * @param[in] selection the selection function
+ * @return 1 on success, otherwise 0
+ */
+static int startWorker(ReadManyWorker* workers, int nworkers, int index, const char** filenames,
+  int (*selection)(HL_NodeList*))
+{
+  int fds[2];
+  int i = 0;
+  pid_t pid = -1;
+
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+    HL_ERROR0("Failed to create socket pair for worker");
+    return 0;
+  }
+
+  HLAsyncPrivate_suspend();
+  HLNodeListPrivate_suspendPrefetch();
+  HL_lockHdf5();
+  pid = fork();
+  if (pid != 0) {
+    HL_unlockHdf5();
+    HLNodeListPrivate_resumePrefetch();
+    HLAsyncPrivate_resume();
+  }
+
+  if (pid < 0) {
+    HL_ERROR0("Failed to fork worker");
+    close(fds[0]);
+    close(fds[1]);
+    return 0;
+  } else if (pid == 0) {
+    close(fds[0]);
+    for (i = 0; i < nworkers; i++) {
+      if (workers[i].fd >= 0) {
+        close(workers[i].fd);
+      }
+    }
+    readManyWorker(fds[1], filenames, selection);
+    _exit(0);
+  }
+  close(fds[1]);
+  workers[index].pid = pid;
+  workers[index].fd = fds[0];
+  workers[index].index = -1;
+  return 1;
+}
+
+/**
+ * Stops a worker by closing the socket and waiting for the process to terminate.
+ * @param[in] worker the worker
+ * @param[in] killWorker if the worker should be killed first, the files it might have
+ * left behind are removed
+ */
+static void stopWorker(ReadManyWorker* worker, int killWorker)
+{
+  if (killWorker && worker->pid > 0) {
+    kill(worker->pid, SIGKILL);
+  }
+  if (worker->fd >= 0) {
+    close(worker->fd);
+    worker->fd = -1;
+  }
+  if (worker->pid > 0) {
+    while (waitpid(worker->pid, NULL, 0) < 0 && errno == EINTR);
+    if (killWorker) {
+      removeWorkerFiles(worker->pid);
+    }
+    worker->pid = -1;
+  }
+}
+
+/**
+ * Stops a worker and starts a new one in its place, so that a file that crashes or
+ * hangs a worker not shrinks the pool for the remaining files.
+ * @param[in] workers all workers
+ * @param[in] nworkers the number of workers
+ * @param[in] index the index of the worker to restart
+ * @param[in] filenames the files
+ * @param[in] selection the selection function
+ * @param[in] killWorker if the worker should be killed, see @ref stopWorker
+ * @param[in] start if a new worker should be started, e.g. only if there are files left
+ * @return 1 if a new worker was started, otherwise 0
+ */
+static int restartWorker(ReadManyWorker* workers, int nworkers, int index, const char** filenames,
+  int (*selection)(HL_NodeList*), int killWorker, int start)
+{
+  stopWorker(&workers[index], killWorker);
+  workers[index].index = -1;
+  return start && startWorker(workers, nworkers, index, filenames, selection);
+}
+
+/**
+ * Returns the poll timeout until the first busy worker has exceeded the timeout.
+ * @param[in] workers the workers
+ * @param[in] nworkers the number of workers
+ * @param[in] timeout the timeout in seconds for reading one file, <= 0 for none
+ * @return the poll timeout in milliseconds, -1 for none
+ */
+static int getPollTimeout(ReadManyWorker* workers, int nworkers, double timeout)
+{
+  double now = HLStats_getTime(), first = -1.0;
+  int i = 0;
+  if (timeout <= 0.0) {
+    return -1;
+  }
+  for (i = 0; i < nworkers; i++) {
+    if (workers[i].fd >= 0 && workers[i].index >= 0) {
+      double left = workers[i].started + timeout - now;
+      if (first < 0.0 || left < first) {
+        first = (left > 0.0) ? left : 0.0;
+      }
+    }
+  }
+  return (first < 0.0) ? -1 : (int)(first * 1000.0) + 1;
+}
+/*@} End of Private functions */
+
+/*@{ Interface functions */
+int HLNodeList_readMany(const char** filenames, int n, int (*selection)(HL_NodeList*), int nworkers,
+                        double timeout, HL_ReadManyCallback callback, void* userdata)
+{
+  ReadManyWorker* workers = NULL;
+  struct pollfd* pfds = NULL;
+  int nextFile = 0, completed = 0, successful = 0;
+  int nrunning = 0, nidleRestarts = 0, i = 0;
+
+  HL_DEBUG0("ENTER: HLNodeList_readMany");
+  if (filenames == NULL || n < 0 || callback == NULL) {
+    HL_ERROR0("Inparameters NULL");
+    return -1;
+  }
+  if (n == 0) {
+    return 0;
+  }
+  if (selection == NULL) {
+    selection = HLNodeList_selectAllNodes;
+  }
+  if (nworkers <= 0) {
+    long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    nworkers = (ncpus > 0) ? (int)ncpus : 1;
+  }
+  if (nworkers > n) {
+    nworkers = n;
+  }
+
+  workers = (ReadManyWorker*)HLHDF_MALLOC(sizeof(ReadManyWorker) * nworkers);
+  pfds = (struct pollfd*)HLHDF_MALLOC(sizeof(struct pollfd) * nworkers);
+  if (workers == NULL || pfds == NULL) {
+    HL_ERROR0("Failed to allocate memory for workers");
+    HLHDF_FREE(workers);
+    HLHDF_FREE(pfds);
+    return -1;
+  }
+  for (i = 0; i < nworkers; i++) {
+    workers[i].pid = -1;
+    workers[i].fd = -1;
+    workers[i].index = -1;
+  }
+
+  for (i = 0; i < nworkers; i++) {
+    if (!startWorker(workers, nworkers, i, filenames, selection)) {
+      break;
+    }
+    nrunning++;
+  }
+
+  while (completed < n) {
+    int npfds = 0;
+
+    /* Hand out files to idle workers */
+    for (i = 0; i < nworkers; i++) {
+      if (workers[i].fd >= 0 && workers[i].index < 0 && nextFile < n) {
+        if (writeFully(workers[i].fd, &nextFile, sizeof(int))) {
+          workers[i].index = nextFile++;
+          workers[i].started = HLStats_getTime();
+        } else if (!restartWorker(workers, nworkers, i, filenames, selection, 0, nidleRestarts++ < n)) {
+          /* The worker died while idle, there is no file to blame so the restarts are limited */
+          nrunning--;
+        }
+      }
+    }
+
+    if (nrunning <= 0) {
+      HL_ERROR0("No worker processes left");
+      break;
+    }
+
+    for (i = 0; i < nworkers; i++) {
+      if (workers[i].fd >= 0 && workers[i].index >= 0) {
+        pfds[npfds].fd = workers[i].fd;
+        pfds[npfds].events = POLLIN;
+        pfds[npfds].revents = 0;
+        npfds++;
+      }
+    }
+    if (npfds == 0) {
+      continue; /* Only idle workers that were restarted, hand out files to them first */
+    }
+    if (poll(pfds, npfds, getPollTimeout(workers, nworkers, timeout)) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      HL_ERROR0("Failed to wait for worker processes");
+      break;
+    }
+
+    for (i = 0; i < nworkers; i++) {
+      int j = 0;
+      ReadManyResult result;
+      HL_NodeList* nodelist = NULL;
+      int index = workers[i].index;
+
+      if (workers[i].fd < 0 || index < 0) {
+        continue;
+      }
+      for (j = 0; j < npfds && pfds[j].fd != workers[i].fd; j++);
+      if (j == npfds || pfds[j].revents == 0) {
+        if (timeout > 0.0 && HLStats_getTime() - workers[i].started >= timeout) {
+          /* The worker is hung, it is replaced by a new one for the remaining files */
+          HL_ERROR2("Worker process did not read %s within %g seconds, killing it", filenames[index], timeout);
+          if (!restartWorker(workers, nworkers, i, filenames, selection, 1, nextFile < n)) {
+            nrunning--;
+          }
+          completed++;
+          callback(index, filenames[index], NULL, userdata);
+        }
+        continue;
+      }
+
+      if (!readFully(workers[i].fd, &result, sizeof(ReadManyResult)) || result.index != index) {
+        /* The worker crashed, it is replaced by a new one for the remaining files */
+        HL_ERROR1("Worker process terminated while reading %s", filenames[index]);
+        if (!restartWorker(workers, nworkers, i, filenames, selection, 1, nextFile < n)) {
+          nrunning--;
+        }
+      } else if (result.status) {
+        nodelist = readFromSharedMemory(&result, filenames[index]);
+      }
+      workers[i].index = -1;
+      if (nodelist != NULL) {
+        successful++;
+      }
+      completed++;
+      callback(index, filenames[index], nodelist, userdata);
+    }
+  }
+
+  /* Report files that never could be read because the workers were lost */
+  for (i = 0; i < nworkers; i++) {
+    if (workers[i].index >= 0) {
+      callback(workers[i].index, filenames[workers[i].index], NULL, userdata);
+    }
+    stopWorker(&workers[i], workers[i].index >= 0);
+  }
+  for (; nextFile < n; nextFile++) {
+    callback(nextFile, filenames[nextFile], NULL, userdata);
+  }
+  HLHDF_FREE(workers);
+  HLHDF_FREE(pfds);
+  HL_DEBUG1("EXIT: HLNodeList_readMany with %d successful reads", successful);
+  return successful;
+}
+/*@} End of Interface functions */
@@ -0,0 +1,117 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * Allocation and I/O statistics.
+ * @file
+ */
+#include "hlhdf.h"
+#include "hlhdf_stats_private.h"
+#include <string.h>
+#include <time.h>
+
+HLHDF_THREAD_LOCAL HL_Statistics hlhdfStats;
+
+/*@{ Private functions */
+double HLStats_getTime(void)
+{
+#if defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+  }
+#endif
+  return (double)clock() / (double)CLOCKS_PER_SEC;
+}
+
+void HLStats_allocated(size_t sz)
+{
+  hlhdfStats.allocations++;
+  hlhdfStats.bytesAllocated += sz;
+  hlhdfStats.currentBytes += sz;
+  if (hlhdfStats.currentBytes > hlhdfStats.peakBytes) {
+    hlhdfStats.peakBytes = hlhdfStats.currentBytes;
+  }
+}
+
+void HLStats_released(size_t sz)
+{
+  hlhdfStats.frees++;
+  /* Memory might have been allocated by another thread, which is not tracked, or before a reset */
+  if (sz > hlhdfStats.currentBytes) {
+    hlhdfStats.currentBytes = 0;
+  } else {
+    hlhdfStats.currentBytes -= sz;
+  }
+}
+
+void HLStats_fileOpened(double starttime)
+{
+  hlhdfStats.filesOpened++;
+  hlhdfStats.fileOpenTime += HLStats_getTime() - starttime;
+}
+
+void HLStats_datasetRead(double starttime, size_t nbytes)
+{
+  hlhdfStats.datasetReads++;
+  hlhdfStats.bytesRead += nbytes;
+  hlhdfStats.datasetReadTime += HLStats_getTime() - starttime;
+}
+
+void HLStats_attributeRead(double starttime, size_t nbytes)
+{
+  hlhdfStats.attributeReads++;
+  hlhdfStats.bytesRead += nbytes;
+  hlhdfStats.attributeReadTime += HLStats_getTime() - starttime;
+}
+
+void HLStats_datasetWritten(double starttime, size_t nbytes)
+{
+  hlhdfStats.datasetWrites++;
+  hlhdfStats.bytesWritten += nbytes;
+  hlhdfStats.datasetWriteTime += HLStats_getTime() - starttime;
+}
+
+void HLStats_attributeWritten(double starttime, size_t nbytes)
+{
+  hlhdfStats.attributeWrites++;
+  hlhdfStats.bytesWritten += nbytes;
+  hlhdfStats.attributeWriteTime += HLStats_getTime() - starttime;
+}
+
+/*@} End of Private functions */
+
+/*@{ Interface functions */
+int HL_getStatistics(HL_Statistics* stats)
+{
+  if (stats == NULL) {
+    return 0;
+  }
+  memcpy(stats, &hlhdfStats, sizeof(HL_Statistics));
+  return 1;
+}
+
+void HL_resetStatistics(void)
+{
+  unsigned long long currentBytes = hlhdfStats.currentBytes;
+  memset(&hlhdfStats, 0, sizeof(HL_Statistics));
+  hlhdfStats.currentBytes = currentBytes;
+  hlhdfStats.peakBytes = currentBytes;
+}
+/*@} End of Interface functions */
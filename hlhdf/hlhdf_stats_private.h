@@ -0,0 +1,93 @@
+/* --------------------------------------------------------------------
+Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+
+This file is part of HLHDF.
+
+HLHDF is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+HLHDF is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+------------------------------------------------------------------------*/
+
+/**
+ * Private functions for collecting the allocation and I/O statistics
+ * returned by @ref HL_getStatistics.
+ * @file
+ */
+#ifndef HLHDF_STATS_PRIVATE_H
+#define HLHDF_STATS_PRIVATE_H
+#include "hlhdf_types.h"
+#include "hlhdf_defines_private.h"
+#include <stdlib.h>
+
+/**
+ * The statistics for the current thread.
+ */
+extern HLHDF_THREAD_LOCAL HL_Statistics hlhdfStats;
+
+/**
+ * Returns a monotonic time stamp in seconds, only useful for measuring elapsed time.
+ * @return the time stamp
+ */
+double HLStats_getTime(void);
+
+/**
+ * Registers a successful allocation.
+ * @param[in] sz the number of allocated bytes
+ */
+void HLStats_allocated(size_t sz);
+
+/**
+ * Registers that an allocated block has been released.
+ * @param[in] sz the number of released bytes
+ */
+void HLStats_released(size_t sz);
+
+/**
+ * Registers that a file has been opened or created.
+ * @param[in] starttime the time stamp taken before the file was opened
+ */
+void HLStats_fileOpened(double starttime);
+
+/**
+ * Registers a call to H5Dread.
+ * @param[in] starttime the time stamp taken before the read
+ * @param[in] nbytes the number of bytes read
+ */
+void HLStats_datasetRead(double starttime, size_t nbytes);
+
+/**
+ * Registers a call to H5Aread.
+ * @param[in] starttime the time stamp taken before the read
+ * @param[in] nbytes the number of bytes read
+ */
+void HLStats_attributeRead(double starttime, size_t nbytes);
+
+/**
+ * Registers a call to H5Dwrite.
+ * @param[in] starttime the time stamp taken before the write
+ * @param[in] nbytes the number of bytes written
+ */
+void HLStats_datasetWritten(double starttime, size_t nbytes);
+
+/**
+ * Registers a call to H5Awrite.
+ * @param[in] starttime the time stamp taken before the write
+ * @param[in] nbytes the number of bytes written
+ */
+void HLStats_attributeWritten(double starttime, size_t nbytes);
+
+/**
+ * @brief Counts the object identifier x if it is a valid identifier.
+ */
+#define HL_STATS_OBJECT_OPENED(x) if ((x) >= 0) {hlhdfStats.objectsOpened++;}
+
+#endif /* HLHDF_STATS_PRIVATE_H */
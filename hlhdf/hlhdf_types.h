@@ -60,7 +60,14 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
  *  <li>'hbool'</li>
  *  <li>'string'</li>
  *  <li>'compound'</li>
+ *  <li>'half'</li>
+ *  <li>'bfloat16'</li>
  * </ul>
+ *
+ * 'half' (IEEE 754 binary16) and 'bfloat16' (the upper half of a float) are stored in memory
+ * as unsigned 16 bit words holding the bit pattern of the value, since C has no portable
+ * type for them. They are written to the files as HDF5 floating point types with the
+ * same layout.
  */
 /*@{*/
 /**
@@ -90,6 +97,8 @@ typedef enum HL_FormatSpecifier {
   HLHDF_STRING,         /**< 'string' */
   HLHDF_COMPOUND,       /**< 'compound' */
   HLHDF_ARRAY,          /**< 'array' This is only something that will be read but is not possible to write */
+  HLHDF_HALF,           /**< 'half' */
+  HLHDF_BFLOAT16,       /**< 'bfloat16' */
   HLHDF_END_OF_SPECIFIERS
 } HL_FormatSpecifier;
 
@@ -105,6 +114,35 @@ typedef enum HL_CompressionType {
   CT_SZLIB   /**< SZLIB compression */
 } HL_CompressionType;
 
+/**
+ * Predictors that can be applied before the compression, see HL_Compression#predictor.
+ * @ingroup hlhdf_c_apis
+ */
+typedef enum HL_PredictorType {
+  PT_NONE=0, /**< No predictor */
+  PT_DELTA   /**< Each value is replaced with the difference to the previous value along the last dimension */
+} HL_PredictorType;
+
+/**
+ * The filter id that the delta filter uses until The HDF Group has assigned it a
+ * registered id, the registration is pending. The id is in the range 32768-65535
+ * that HDF5 reserves for filters that not are registered, so another application
+ * may use the same id for a different filter. Files written with the delta
+ * predictor can be read by HLHDF and by any HDF5 application that loads HLHDF as
+ * its filter plugin, see @ref HLHDF_DELTA_FILTER.
+ * @ingroup hlhdf_c_apis
+ */
+#define HLHDF_DELTA_FILTER_UNREGISTERED_ID 32790
+
+/**
+ * The id of the HDF5 filter that implements @ref HL_PredictorType#PT_DELTA. The filter
+ * is registered by @ref HL_init. For other HDF5 applications the filter is also built
+ * as the HDF5 filter plugin libh5hlhdfdelta.so, which is installed in lib/plugin. They
+ * can read the files by adding that directory to HDF5_PLUGIN_PATH.
+ * @ingroup hlhdf_c_apis
+ */
+#define HLHDF_DELTA_FILTER HLHDF_DELTA_FILTER_UNREGISTERED_ID
+
 /**
  * See hdf5 documentation for H5Pget_version for purpose
  * @ingroup hlhdf_c_apis
@@ -213,8 +251,104 @@ typedef struct {
     * The more pixel values vary, the smaller this number should be.
     */
    unsigned int szlib_px_per_block;
+
+   /**
+    * If > 0, the statistics of numeric datasets are stored in hidden attributes when
+    * they are written together with the min and max of each tile of summary_tile_size
+    * x summary_tile_size values. They can be used without reading the data, see
+    * @ref HLNodeList_fetchStoredStatistics and @ref HLNodeList_mayContainValues.
+    * The tiles are enlarged when a dataset would get more than
+    * @ref HLHDF_MAX_SUMMARY_TILES tiles. 0 (default) stores no statistics.
+    */
+   int summary_tile_size;
+
+   /**
+    * If > 0, float and double datasets are written with only keep_bits bits of the
+    * mantissa, the rest of the mantissa is rounded to nearest even and set to zero
+    * so that the values compress better. This is lossy, the relative error is at
+    * most 2^-(keep_bits+1). The number of kept bits is stored in a hidden attribute
+    * of the dataset. 0 (default) writes the values as they are.
+    */
+   int keep_bits;
+
+   /**
+    * As keep_bits but specified as the number of significant decimal digits to keep,
+    * only used when keep_bits is 0. 0 (default) writes the values as they are.
+    */
+   int keep_digits;
+
+   /**
+    * The predictor to apply to integer datasets before they are compressed. With
+    * @ref HL_PredictorType#PT_DELTA, each row of the dataset is stored as the differences
+    * between neighbouring values, which compress better when the values are smooth
+    * along the last dimension, like the range bins of polar scans. The predictor is a
+    * filter in the dataset so it is inverted when the dataset is read. Other datasets
+    * are written without the predictor. Default is @ref HL_PredictorType#PT_NONE.
+    */
+   HL_PredictorType predictor;
 } HL_Compression;
 
+/**
+ * Allocation and I/O counters collected by the library, see @ref HL_getStatistics.
+ * The counters are kept per thread and only include what the thread itself has done,
+ * see @ref HL_getStatistics. Times are in seconds.
+ * @ingroup hlhdf_c_apis
+ */
+typedef struct {
+   unsigned long long allocations;    /**< Number of successful allocations (malloc, calloc, realloc and strdup) */
+   unsigned long long frees;          /**< Number of released blocks */
+   unsigned long long bytesAllocated; /**< Total number of bytes allocated */
+   unsigned long long currentBytes;   /**< Number of bytes currently allocated */
+   unsigned long long peakBytes;      /**< Highest value that currentBytes has reached */
+   unsigned long long filesOpened;    /**< Number of opened or created files */
+   unsigned long long objectsOpened;  /**< Number of opened groups, datasets, attributes and named types */
+   unsigned long long datasetReads;   /**< Number of H5Dread calls */
+   unsigned long long attributeReads; /**< Number of H5Aread calls */
+   unsigned long long datasetWrites;  /**< Number of H5Dwrite calls */
+   unsigned long long attributeWrites;/**< Number of H5Awrite calls */
+   unsigned long long bytesRead;      /**< Number of bytes delivered by H5Dread and H5Aread */
+   unsigned long long bytesWritten;   /**< Number of bytes handed to H5Dwrite and H5Awrite */
+   double fileOpenTime;               /**< Time spent opening and creating files */
+   double datasetReadTime;            /**< Time spent in H5Dread */
+   double attributeReadTime;          /**< Time spent in H5Aread */
+   double datasetWriteTime;           /**< Time spent in H5Dwrite */
+   double attributeWriteTime;         /**< Time spent in H5Awrite */
+} HL_Statistics;
+
+/**
+ * Maximum number of bins in the histogram of @ref HL_DataStatistics.
+ * @ingroup hlhdf_c_apis
+ */
+#define HLHDF_MAX_HISTOGRAM_BINS 256
+
+/**
+ * The maximum number of tiles summarized for a dataset, see @ref HL_Compression.
+ * @ingroup hlhdf_c_apis
+ */
+#define HLHDF_MAX_SUMMARY_TILES 4096
+
+/**
+ * Statistics of the values in a dataset, computed while the dataset is fetched,
+ * see @ref HLNodeList_setComputeStatistics. The statistics are of the stored values,
+ * i.e. before any gain and offset has been applied. A value is valid unless it is
+ * NaN or the ODIM nodata or undetect value of the dataset.
+ * @ingroup hlhdf_c_apis
+ */
+typedef struct {
+   unsigned long long count;          /**< Number of values */
+   unsigned long long validCount;     /**< Number of valid values */
+   unsigned long long nodataCount;    /**< Number of values equal to nodata */
+   unsigned long long undetectCount;  /**< Number of values equal to undetect */
+   double min;                        /**< Smallest valid value, NaN if there are none */
+   double max;                        /**< Largest valid value, NaN if there are none */
+   double sum;                        /**< Sum of the valid values */
+   double mean;                       /**< Mean of the valid values, NaN if there are none */
+   int nbins;                         /**< Number of bins in the histogram, 0 if there is no histogram */
+   double histogramLow;               /**< Lower limit of the first bin */
+   double histogramHigh;              /**< Upper limit of the last bin, included in the last bin */
+   unsigned long long histogram[HLHDF_MAX_HISTOGRAM_BINS]; /**< Number of valid values within each bin */
+} HL_DataStatistics;
+
 /**
  * This is an enumeration variable designed to identify the type of a given node.
  * @ingroup hlhdf_c_apis
@@ -294,4 +428,47 @@ typedef struct _HL_Node HL_Node;
  */
 typedef struct _HL_NodeList HL_NodeList;
 
+/**
+ * Called by @ref HLNodeList_readMany for each file that has been read.
+ * The callback takes over the responsibility for the nodelist.
+ * @ingroup hlhdf_c_apis
+ * @param[in] index the index of the file in the list of filenames
+ * @param[in] filename the name of the file
+ * @param[in] nodelist the read and fetched nodelist, NULL if the file could not be read
+ * @param[in] userdata the user data provided to @ref HLNodeList_readMany
+ */
+typedef void (*HL_ReadManyCallback)(int index, const char* filename, HL_NodeList* nodelist, void* userdata);
+
+/**
+ * The status of an asynchronous operation, see @ref HLNodeList_fetchMarkedNodesAsync.
+ * @ingroup hlhdf_c_apis
+ */
+typedef enum HL_AsyncStatus {
+  HL_ASYNC_PENDING=0, /**< The operation is waiting for the I/O thread */
+  HL_ASYNC_RUNNING,   /**< The operation is running */
+  HL_ASYNC_DONE,      /**< The operation has finished successfully */
+  HL_ASYNC_FAILED,    /**< The operation has failed */
+  HL_ASYNC_CANCELLED  /**< The operation was cancelled before it started */
+} HL_AsyncStatus;
+
+/**
+ * A handle to an operation running on the HLHDF I/O thread.
+ * @ingroup hlhdf_c_apis
+ */
+typedef struct _HL_AsyncOperation HL_AsyncOperation;
+
+/**
+ * Called on the I/O thread when an asynchronous operation changes status. It is
+ * called with HL_ASYNC_RUNNING just before the operation starts and the return value
+ * decides if the operation should run (non zero) or be cancelled (0). Then it is
+ * called once more with the final status. The callback may not wait for the operation
+ * but it may free it in the final call.
+ * @ingroup hlhdf_c_apis
+ * @param[in] op the operation
+ * @param[in] status the new status
+ * @param[in] userdata the user data provided when the operation was started
+ * @return only used for HL_ASYNC_RUNNING, 0 if the operation should be cancelled
+ */
+typedef int (*HL_AsyncCallback)(HL_AsyncOperation* op, HL_AsyncStatus status, void* userdata);
+
 #endif
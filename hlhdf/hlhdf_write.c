@@ -29,10 +29,36 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 #include "hlhdf_debug.h"
 #include "hlhdf_private.h"
 #include "hlhdf_defines_private.h"
+#include "hlhdf_stats_private.h"
+#include "hlhdf_convert_private.h"
+#include "hlhdf_filter_private.h"
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 /*@{ Private functions */
+/**
+ * Releases borrowed data from the nodes that the write attempted to write, see
+ * @ref HLNode_borrowArrayValue. Called when the write returns, also when it failed.
+ * @param[in] nodelist the nodelist that has been written, may be NULL
+ * @param[in] onlyOriginal if only nodes marked as NMARK_ORIGINAL has been written
+ */
+static void releaseBorrowedData(HL_NodeList* nodelist, int onlyOriginal)
+{
+  int i = 0;
+  int nNodes = 0;
+  if (nodelist == NULL) {
+    return;
+  }
+  nNodes = HLNodeList_getNumberOfNodes(nodelist);
+  for (i = 0; i < nNodes; i++) {
+    HL_Node* node = HLNodeList_getNodeByIndex(nodelist, i);
+    if (node != NULL && (!onlyOriginal || HLNode_getMark(node) == NMARK_ORIGINAL)) {
+      HLNodePrivate_releaseBorrowedData(node);
+    }
+  }
+}
+
 /**
  * Turns a self defined type into a named type, i.e. gives it a name.
  * @param[in] loc_id  In what group or file, this type this should be placed.
@@ -63,6 +89,7 @@ static herr_t createReference(hid_t loc_id, hid_t file_id, const char* name,
   hid_t attr_type = -1;
   hobj_ref_t ref;
   herr_t status = -1;
+  double starttime = 0.0;
   HL_DEBUG0("ENTER: createReference");
   if ((aid = H5Screate(H5S_SCALAR)) < 0) {
     HL_ERROR0("Failed to create scalar data space");
@@ -89,10 +116,12 @@ static herr_t createReference(hid_t loc_id, hid_t file_id, const char* name,
     goto fail;
   }
 
+  starttime = HLStats_getTime();
   if (H5Awrite(attr_id, attr_type, &ref) < 0) {
     HL_ERROR0("Failed to write scalar data to file");
     goto fail;
   }
+  HLStats_attributeWritten(starttime, sizeof(hobj_ref_t));
 
   status = 0;
 
@@ -117,6 +146,7 @@ static herr_t writeScalarDataAttribute(hid_t loc_id, hid_t type_id,
   hid_t aid = -1;
   hid_t attr_id = -1;
   herr_t status = -1;
+  double starttime = 0.0;
   HL_SPEWDEBUG0("ENTER: writeScalarDataAttribute");
   if ((aid = H5Screate(H5S_SCALAR)) < 0) {
     HL_ERROR0("Failed to create scalar data space");
@@ -128,10 +158,12 @@ static herr_t writeScalarDataAttribute(hid_t loc_id, hid_t type_id,
     goto fail;
   }
 
+  starttime = HLStats_getTime();
   if (H5Awrite(attr_id, type_id, buf) < 0) {
     HL_ERROR0("Failed to write scalar data to file");
     goto fail;
   }
+  HLStats_attributeWritten(starttime, H5Tget_size(type_id));
 
   status = 0;
 fail:
@@ -156,6 +188,7 @@ static herr_t writeSimpleDataAttribute(hid_t loc_id, hid_t type_id, const char*
   hid_t attr_id = -1;
   hid_t dataspace = -1;
   herr_t status = -1;
+  double starttime = 0.0;
 
   HL_DEBUG0("ENTER: writeSimpleDataAttribute");
   if ((dataspace = H5Screate_simple(ndims, dims, NULL)) < 0) {
@@ -169,10 +202,12 @@ static herr_t writeSimpleDataAttribute(hid_t loc_id, hid_t type_id, const char*
     goto fail;
   }
 
+  starttime = HLStats_getTime();
   if (H5Awrite(attr_id, type_id, buf) < 0) {
     HL_ERROR0("Failed to write simple data attribute to file");
     goto fail;
   }
+  HLStats_attributeWritten(starttime, H5Tget_size(type_id) * (size_t)H5Sget_simple_extent_npoints(dataspace));
   status = 0;
 
 fail:
@@ -197,6 +232,7 @@ static hid_t createSimpleDataset(hid_t loc_id, hid_t type_id, const char* name,
   hid_t dataset = -1;
   hid_t dataspace = -1;
   hid_t props = -1;
+  int compressed = 0;
 
   HL_SPEWDEBUG0("ENTER: createSimpleDataset");
 
@@ -205,8 +241,10 @@ static hid_t createSimpleDataset(hid_t loc_id, hid_t type_id, const char* name,
     goto done;
   }
 
-  if (compress != NULL &&
-      (compress->type == CT_SZLIB || (compress->type = CT_ZLIB && (compress->level > 0 && compress->level <= 9)))) {
+  compressed = (compress != NULL &&
+      (compress->type == CT_SZLIB || (compress->type == CT_ZLIB && (compress->level > 0 && compress->level <= 9))));
+
+  if (compressed || (compress != NULL && compress->predictor != PT_NONE)) {
     if ((props = H5Pcreate(H5P_DATASET_CREATE)) < 0) {
       HL_ERROR0("Failed to create the compression property");
       goto done;
@@ -216,12 +254,16 @@ static hid_t createSimpleDataset(hid_t loc_id, hid_t type_id, const char* name,
       HL_ERROR0("Failed to set chunk size");
       goto done;
     }
-    if (compress->type == CT_ZLIB) {
+    /* The predictor must come before the compression in the filter pipeline */
+    if (HLFilterPrivate_addPredictor(props, type_id, compress->predictor) < 0) {
+      goto done;
+    }
+    if (compressed && compress->type == CT_ZLIB) {
       if (H5Pset_deflate(props, compress->level) < 0) {
         HL_ERROR1("Failed to set z compression to level %d", compress->level);
         goto done;
       }
-    } else {
+    } else if (compressed) {
       if (H5Pset_szip(props, compress->szlib_mask, compress->szlib_px_per_block) < 0) {
         HL_ERROR2("Failed to set the szip compression, mask=%d, px_per_block=%d",
                   compress->szlib_mask, compress->szlib_px_per_block);
@@ -243,10 +285,12 @@ static hid_t createSimpleDataset(hid_t loc_id, hid_t type_id, const char* name,
   }
 
   if (buf != NULL) {
+    double starttime = HLStats_getTime();
     if (H5Dwrite(dataset, type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) {
       HL_ERROR0("Failed to write dataset");
       goto done;
     }
+    HLStats_datasetWritten(starttime, H5Tget_size(type_id) * (size_t)H5Sget_simple_extent_npoints(dataspace));
   }
 
 done:
@@ -256,6 +300,221 @@ done:
   return dataset;
 }
 
+/**
+ * Returns the value of an ODIM what-attribute that applies to a dataset, see
+ * @ref HLNodeListPrivate_findWhatAttribute.
+ * @param[in] nodelist the nodelist
+ * @param[in] node the dataset
+ * @param[in] attribute the name of the attribute
+ * @param[out] value the value of the attribute
+ * @return 1 if found, otherwise 0
+ */
+static int getWhatAttribute(HL_NodeList* nodelist, HL_Node* node, const char* attribute, double* value)
+{
+  HL_Node* attr = HLNodeListPrivate_findWhatAttribute(nodelist, HLNode_getName(node), attribute);
+  if (attr == NULL || HLNode_getData(attr) == NULL) {
+    return 0;
+  }
+  return HLNode_getDataAs(attr, HLHDF_DOUBLE, value);
+}
+
+/**
+ * Computes the statistics of a dataset and stores them in hidden attributes of the
+ * dataset together with the min and max of each tile, see HL_Compression#summary_tile_size.
+ * The tiles span the two first dimensions, or the first dimension of a one-dimensional
+ * dataset. Values that equal the nodata or undetect what-attributes are not valid.
+ * Datasets that not are numeric are ignored.
+ * @param[in] nodelist the nodelist that is written
+ * @param[in] dataset the written dataset
+ * @param[in] node the node of the dataset
+ * @param[in] data the values that were written if they differ from the data of the node, otherwise NULL
+ * @param[in] compress the compression used when writing the dataset
+ * @return 1 on success, otherwise 0
+ */
+static int writeDatasetSummary(HL_NodeList* nodelist, hid_t dataset, HL_Node* node,
+  unsigned char* data, HL_Compression* compress)
+{
+  HL_StatisticsKernel kernel = NULL;
+  HL_StatisticsParameters params;
+  HL_DataStatistics total, tile;
+  const hsize_t* dims = HLNodePrivate_getDims(node);
+  int ndims = HLNode_getRank(node);
+  size_t esize = HLNode_getDataSize(node);
+  hsize_t rows = 1, cols = 1, inner = 1;
+  hsize_t ny = 0, nx = 0, ty = 0, tx = 0, y = 0, x0 = 0, x1 = 0;
+  hsize_t tileDims[2];
+  hsize_t sizeDims = 2;
+  int tileSize[2];
+  double* tileMin = NULL;
+  double* tileMax = NULL;
+  int d = 0;
+  int status = 0;
+
+  if (compress == NULL || compress->summary_tile_size <= 0 ||
+      HL_sizeOfFormatSpecifier(HLNode_getFormat(node)) != esize ||
+      (kernel = HLConvertPrivate_getStatisticsKernel(HLNode_getFormat(node))) == NULL ||
+      HLNode_getNumberOfPoints(node) == 0 ||
+      (data == NULL && (data = HLNode_getData(node)) == NULL)) {
+    return 1;
+  }
+
+  if (ndims >= 2) {
+    rows = dims[0];
+    cols = dims[1];
+    d = 2;
+  } else if (ndims == 1) {
+    cols = dims[0];
+    d = 1;
+  }
+  for (; d < ndims; d++) {
+    inner *= dims[d];
+  }
+  tileSize[0] = (ndims >= 2) ? compress->summary_tile_size : 1;
+  tileSize[1] = compress->summary_tile_size;
+  while (1) {
+    ny = (rows + tileSize[0] - 1) / tileSize[0];
+    nx = (cols + tileSize[1] - 1) / tileSize[1];
+    if (ny * nx <= HLHDF_MAX_SUMMARY_TILES) {
+      break;
+    }
+    if (ndims >= 2) {
+      tileSize[0] *= 2;
+    }
+    tileSize[1] *= 2;
+  }
+
+  memset(&params, 0, sizeof(HL_StatisticsParameters));
+  params.hasNodata = getWhatAttribute(nodelist, node, "nodata", &params.nodata);
+  params.hasUndetect = getWhatAttribute(nodelist, node, "undetect", &params.undetect);
+
+  tileMin = (double*)HLHDF_MALLOC(sizeof(double) * ny * nx);
+  tileMax = (double*)HLHDF_MALLOC(sizeof(double) * ny * nx);
+  if (tileMin == NULL || tileMax == NULL) {
+    HL_ERROR0("Failed to allocate memory for the tile summary");
+    goto fail;
+  }
+
+  HLConvertPrivate_initStatistics(&total, 0, 0.0, 0.0);
+  for (ty = 0; ty < ny; ty++) {
+    for (tx = 0; tx < nx; tx++) {
+      x0 = tx * tileSize[1];
+      x1 = (x0 + tileSize[1] < cols) ? x0 + tileSize[1] : cols;
+      HLConvertPrivate_initStatistics(&tile, 0, 0.0, 0.0);
+      for (y = ty * tileSize[0]; y < rows && y < (ty + 1) * tileSize[0]; y++) {
+        kernel(data + (size_t)((y * cols + x0) * inner) * esize, (size_t)((x1 - x0) * inner), &params, &tile);
+      }
+      tileMin[ty * nx + tx] = (tile.validCount > 0) ? tile.min : NAN;
+      tileMax[ty * nx + tx] = (tile.validCount > 0) ? tile.max : NAN;
+      HLConvertPrivate_mergeStatistics(&total, &tile);
+    }
+  }
+  HLConvertPrivate_finishStatistics(&total);
+
+  tileDims[0] = ny;
+  tileDims[1] = nx;
+  if (writeScalarDataAttribute(dataset, H5T_NATIVE_ULLONG, HLHDF_SUMMARY_VALID_COUNT, &total.validCount) < 0 ||
+      writeScalarDataAttribute(dataset, H5T_NATIVE_ULLONG, HLHDF_SUMMARY_NODATA_COUNT, &total.nodataCount) < 0 ||
+      writeScalarDataAttribute(dataset, H5T_NATIVE_ULLONG, HLHDF_SUMMARY_UNDETECT_COUNT, &total.undetectCount) < 0 ||
+      writeScalarDataAttribute(dataset, H5T_NATIVE_DOUBLE, HLHDF_SUMMARY_MIN, &total.min) < 0 ||
+      writeScalarDataAttribute(dataset, H5T_NATIVE_DOUBLE, HLHDF_SUMMARY_MAX, &total.max) < 0 ||
+      writeScalarDataAttribute(dataset, H5T_NATIVE_DOUBLE, HLHDF_SUMMARY_SUM, &total.sum) < 0 ||
+      writeSimpleDataAttribute(dataset, H5T_NATIVE_INT, HLHDF_SUMMARY_TILE_SIZE, 1, &sizeDims, tileSize) < 0 ||
+      writeSimpleDataAttribute(dataset, H5T_NATIVE_DOUBLE, HLHDF_SUMMARY_TILE_MIN, 2, tileDims, tileMin) < 0 ||
+      writeSimpleDataAttribute(dataset, H5T_NATIVE_DOUBLE, HLHDF_SUMMARY_TILE_MAX, 2, tileDims, tileMax) < 0) {
+    HL_ERROR1("Failed to write the statistics of %s", HLNode_getName(node));
+    goto fail;
+  }
+
+  status = 1;
+fail:
+  HLHDF_FREE(tileMin);
+  HLHDF_FREE(tileMax);
+  return status;
+}
+
+/**
+ * Returns the number of mantissa bits to keep when a dataset is written, see
+ * HL_Compression#keep_bits and HL_Compression#keep_digits.
+ * @param[in] node the node of the dataset
+ * @param[in] compress the compression used when writing the dataset
+ * @param[out] kernel receives the kernel that rounds the values
+ * @return the number of bits or -1 if the values should be written as they are
+ */
+static int getKeepBits(HL_Node* node, HL_Compression* compress, HL_RoundKernel* kernel)
+{
+  int keepBits = 0;
+  int mbits = 0;
+  if (compress == NULL) {
+    return -1;
+  }
+  if (compress->keep_bits > 0) {
+    keepBits = compress->keep_bits;
+  } else if (compress->keep_digits > 0) {
+    keepBits = (int)ceil(compress->keep_digits * log2(10.0));
+  }
+  if (keepBits <= 0 ||
+      HL_sizeOfFormatSpecifier(HLNode_getFormat(node)) != HLNode_getDataSize(node) ||
+      (*kernel = HLConvertPrivate_getRoundKernel(HLNode_getFormat(node), &mbits)) == NULL ||
+      keepBits >= mbits) {
+    return -1;
+  }
+  return keepBits;
+}
+
+/**
+ * Creates and writes the dataset of a node followed by the hidden attributes that
+ * describe it. If the compression says so, the values are rounded before they are
+ * handed to HDF5 and its filter pipeline, the data of the node is not changed.
+ * @param[in] nodelist the nodelist that is written
+ * @param[in] loc_id the group the dataset should be created in
+ * @param[in] node the node of the dataset
+ * @param[in] name the name of the dataset in the group
+ * @param[in] compress the compression that should be used, may be NULL
+ * @return the dataset on success, otherwise < 0
+ */
+static hid_t createNodeDataset(HL_NodeList* nodelist, hid_t loc_id, HL_Node* node,
+  const char* name, HL_Compression* compress)
+{
+  HL_RoundKernel kernel = NULL;
+  unsigned char* rounded = NULL;
+  hid_t dataset = -1;
+  int keepBits = getKeepBits(node, compress, &kernel);
+  size_t npoints = (size_t)HLNode_getNumberOfPoints(node);
+
+  if (keepBits >= 0 && HLNode_getData(node) != NULL) {
+    if ((rounded = (unsigned char*)HLHDF_MALLOC(npoints * HLNode_getDataSize(node))) == NULL) {
+      HL_ERROR1("Failed to allocate memory for rounding %s", HLNode_getName(node));
+      goto fail;
+    }
+    kernel(HLNode_getData(node), rounded, npoints, keepBits);
+  }
+
+  dataset = createSimpleDataset(loc_id,
+                                HLNodePrivate_getTypeId(node),
+                                name,
+                                HLNode_getRank(node),
+                                HLNodePrivate_getDims(node),
+                                (rounded != NULL) ? rounded : HLNode_getData(node),
+                                compress);
+  if (dataset < 0) {
+    goto fail;
+  }
+  if (rounded != NULL &&
+      writeScalarDataAttribute(dataset, H5T_NATIVE_INT, HLHDF_KEEP_BITS_ATTRIBUTE, &keepBits) < 0) {
+    HL_ERROR1("Failed to write the number of kept bits of %s", HLNode_getName(node));
+    HL_H5D_CLOSE(dataset);
+    goto fail;
+  }
+  if (!writeDatasetSummary(nodelist, dataset, node, rounded, compress)) {
+    HL_H5D_CLOSE(dataset);
+    goto fail;
+  }
+
+fail:
+  HLHDF_FREE(rounded);
+  return dataset;
+}
+
 /**
  * Writes a HDF5 attribute.
  * @brief Writes a HDF5 attribute
@@ -343,6 +602,7 @@ static int doWriteHdf5Group(hid_t rootGrp, HL_Node* parentNode, char* parentName
 /**
  * Writes a HDF5 data set.
  * @brief Writes a HDF5 data set.
+ * @param[in] nodelist - The nodelist that is written
  * @param[in] rootGrp - The root group of the file
  * @param[in] parentNode - The parent node to the dataset that should be written
  * @param[in] parentName - The name of the parent node
@@ -351,7 +611,7 @@ static int doWriteHdf5Group(hid_t rootGrp, HL_Node* parentNode, char* parentName
  * @param[in] compression - the compression to be used
  * @return 1 upon success, otherwise failure.
  */
-static int doWriteHdf5Dataset(hid_t rootGrp, HL_Node* parentNode, char* parentName,
+static int doWriteHdf5Dataset(HL_NodeList* nodelist, hid_t rootGrp, HL_Node* parentNode, char* parentName,
   HL_Node* childNode, char* childName, HL_Compression* compression)
 {
   hid_t tmpLocId = -1;
@@ -368,13 +628,7 @@ static int doWriteHdf5Dataset(hid_t rootGrp, HL_Node* parentNode, char* parentNa
     tmpLocId = HLNodePrivate_getHdfID(parentNode);
   }
 
-  hdfid = createSimpleDataset(tmpLocId,
-                              HLNodePrivate_getTypeId(childNode),
-                              childName,
-                              HLNode_getRank(childNode),
-                              HLNodePrivate_getDims(childNode),
-                              HLNode_getData(childNode),
-                              compression);
+  hdfid = createNodeDataset(nodelist, tmpLocId, childNode, childName, compression);
   if (hdfid < 0) {
     HL_ERROR1("Failed to create dataset %s",HLNode_getName(childNode));
     return 0;
@@ -532,12 +786,14 @@ static int doAppendHdf5Group(hid_t file_id, HL_Node* parentNode, char* parentNam
                 childName);
       goto fail;
     }
+    HL_STATS_OBJECT_OPENED(loc_id);
   } else {
     if ((loc_id = H5Gopen(file_id, parentName, H5P_DEFAULT)) < 0) {
       HL_ERROR1("Could not open group '%s' when creating new group.\n",
                 parentName);
       goto fail;
     }
+    HL_STATS_OBJECT_OPENED(loc_id);
   }
 
   if ((new_id = H5Gcreate(loc_id, childName, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
@@ -555,6 +811,7 @@ fail:
 /**
  * Appends a new group node to the structure. The parentNode can only
  * be of type GROUP.
+ * @param[in] nodelist The nodelist that is updated.
  * @param[in] file_id The file reference.
  * @param[in] parentNode The parent node of the dataset to be written.
  * @param[in] parentName The name of the parent node.
@@ -563,7 +820,7 @@ fail:
  * @param[in] compression The compression level that is wanted.
  * @return 1 upon success, otherwise 0.
  */
-static int doAppendHdf5Dataset(hid_t file_id, HL_Node* parentNode, char* parentName,
+static int doAppendHdf5Dataset(HL_NodeList* nodelist, hid_t file_id, HL_Node* parentNode, char* parentName,
   HL_Node* childNode, char* childName, HL_Compression* compression)
 {
   hid_t loc_id = -1;
@@ -580,21 +837,17 @@ static int doAppendHdf5Dataset(hid_t file_id, HL_Node* parentNode, char* parentN
                 childName);
       goto fail;
     }
+    HL_STATS_OBJECT_OPENED(loc_id);
   } else {
     if ((loc_id = H5Gopen(file_id, parentName, H5P_DEFAULT)) < 0) {
       HL_ERROR1("Could not open group '%s' when creating new dataset.\n",
                 parentName);
       goto fail;
     }
+    HL_STATS_OBJECT_OPENED(loc_id);
   }
 
-  new_id = createSimpleDataset(loc_id,
-                               HLNodePrivate_getTypeId(childNode),
-                               childName,
-                               HLNode_getRank(childNode),
-                               HLNodePrivate_getDims(childNode),
-                               HLNode_getData(childNode),
-                               compression);
+  new_id = createNodeDataset(nodelist, loc_id, childNode, childName, compression);
   if (new_id < 0) {
     HL_ERROR1("Failed to create dataset %s\n", HLNode_getName(childNode));
     goto fail;
@@ -657,6 +910,9 @@ int HLNodeList_write(HL_NodeList* nodelist, HL_FileCreationProperty* property,
   int nNodes = 0;
 
   HL_DEBUG0("ENTER: writeHL_NodeList");
+  HLNodeListPrivate_waitForPrefetch(nodelist);
+  HLNodeListPrivate_closeFileSession(nodelist);
+  HL_lockHdf5();
 
   if (nodelist == NULL) {
     HL_ERROR0("Inparameters NULL");
@@ -677,6 +933,7 @@ int HLNodeList_write(HL_NodeList* nodelist, HL_FileCreationProperty* property,
     HL_DEBUG0("Failed to open root group");
     goto fail;
   }
+  HL_STATS_OBJECT_OPENED(gid);
 
   if ((nNodes = HLNodeList_getNumberOfNodes(nodelist)) < 0) {
     HL_ERROR0("Failed to get number of nodes");
@@ -717,12 +974,12 @@ int HLNodeList_write(HL_NodeList* nodelist, HL_FileCreationProperty* property,
     }
     case DATASET_ID: {
       if (compression != NULL) {
-        if (!doWriteHdf5Dataset(gid, parentNode, parentName,
+        if (!doWriteHdf5Dataset(nodelist, gid, parentNode, parentName,
                                 node, childName, compression)) {
           goto fail;
         }
       } else {
-        if (!doWriteHdf5Dataset(gid, parentNode, parentName,
+        if (!doWriteHdf5Dataset(nodelist, gid, parentNode, parentName,
                                 node, childName,
                                 HLNode_getCompression(node))) {
           goto fail;
@@ -751,11 +1008,13 @@ int HLNodeList_write(HL_NodeList* nodelist, HL_FileCreationProperty* property,
   H5Fflush(file_id, H5F_SCOPE_LOCAL);
   status = 1;
 fail:
+  releaseBorrowedData(nodelist, 0);
   HLHDF_FREE(parentName);
   HLHDF_FREE(childName);
   HL_H5G_CLOSE(gid);
   HL_H5F_CLOSE(file_id);
   HLHDF_FREE(filename);
+  HL_unlockHdf5();
   HL_DEBUG1("EXIT: writeHL_NodeList with status %d", status);
 
   return status;
@@ -774,6 +1033,9 @@ int HLNodeList_update(HL_NodeList* nodelist, HL_Compression* compression)
   int nNodes = 0;
 
   HL_DEBUG0("ENTER: updateHL_NodeList");
+  HLNodeListPrivate_waitForPrefetch(nodelist);
+  HLNodeListPrivate_closeFileSession(nodelist);
+  HL_lockHdf5();
 
   if (nodelist == NULL) {
     HL_ERROR0("Inparameters NULL");
@@ -794,6 +1056,7 @@ int HLNodeList_update(HL_NodeList* nodelist, HL_Compression* compression)
     HL_ERROR0("Failed to open root group\n");
     goto fail;
   }
+  HL_STATS_OBJECT_OPENED(gid);
 
   if ((nNodes = HLNodeList_getNumberOfNodes(nodelist)) < 0) {
     HL_ERROR0("Failed to get number of nodes");
@@ -835,12 +1098,12 @@ int HLNodeList_update(HL_NodeList* nodelist, HL_Compression* compression)
       }
       case DATASET_ID: {
         if (compression != NULL) {
-          if (!doAppendHdf5Dataset(file_id, parentNode, parentName,
+          if (!doAppendHdf5Dataset(nodelist, file_id, parentNode, parentName,
                                    node, childName, compression)) {
             goto fail;
           }
         } else {
-          if (!doAppendHdf5Dataset(file_id, parentNode, parentName,
+          if (!doAppendHdf5Dataset(nodelist, file_id, parentNode, parentName,
                                    node, childName,
                                    HLNode_getCompression(node))) {
             goto fail;
@@ -868,14 +1131,15 @@ int HLNodeList_update(HL_NodeList* nodelist, HL_Compression* compression)
       }
     }
   }
-
   status = 1;
 fail:
+  releaseBorrowedData(nodelist, 1);
   HLHDF_FREE(parentName);
   HLHDF_FREE(childName);
   HL_H5G_CLOSE(gid);
   HL_H5F_CLOSE(file_id);
   HLHDF_FREE(filename);
+  HL_unlockHdf5();
   HL_DEBUG1("EXIT: updateHL_NodeList with status = %d", status);
   return status;
 }
@@ -32,11 +32,13 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 #include "pyhlhdf_common.h"  /* this includes arrayobject.h */
 #include "hlhdf.h"
 #include "hlhdf_alloc.h"
+#include "hlhdf_compound_utils.h"
 #include "hlhdf_private.h"
 #include "hlhdf_node_private.h"
 #include "hlhdf_debug.h"
 #include "hlhdf_defines_private.h"
 #include "structmember.h"
+#include <pthread.h>
 
 /**
  * @defgroup pyhl_api PyHL Python-API Reference Manual
@@ -75,6 +77,7 @@ static PyObject *ErrorObject;
 typedef struct {
    PyObject_HEAD /*Always have to be on top*/
    HL_NodeList* nodelist; /**< the node list */
+   int busy; /**< set while the nodelist is used without holding the GIL */
 } PyhlNodelist;
 
 /**
@@ -121,9 +124,49 @@ static PyTypeObject PyhlFileCreationProperty_Type;
  */
 static PyTypeObject PyhlCompression_Type;
 
+/**
+ * Owner of a buffer set with HLNode_setExternalArrayValue.
+ */
+typedef struct _PyhlBufferOwner {
+  Py_buffer view; /**< the buffer view */
+  struct _PyhlBufferOwner* next; /**< next pending release */
+} PyhlBufferOwner;
+
+/**
+ * Buffers that have been released by a thread not holding the GIL. They are
+ * released as soon as a pyhl function holding the GIL has the chance.
+ */
+static PyhlBufferOwner* pendingBufferReleases = NULL;
+
+/**
+ * Protects pendingBufferReleases.
+ */
+static pthread_mutex_t pendingBufferReleasesLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Releases the GIL while doing I/O on a nodelist. The nodelist is marked as busy so that
+ * other threads not can modify it in the meantime.
+ */
+#define PYHL_BEGIN_NODELIST_IO(pynodelist) \
+  (pynodelist)->busy = 1; \
+  Py_BEGIN_ALLOW_THREADS
+
+/**
+ * Reacquires the GIL after @ref PYHL_BEGIN_NODELIST_IO.
+ */
+#define PYHL_END_NODELIST_IO(pynodelist) \
+  Py_END_ALLOW_THREADS \
+  (pynodelist)->busy = 0; \
+  _pyhl_release_pending_buffers();
+
 /**
  * Checks if the object is a Pyhl (nodelist) type
  */
+/**
+ * The default number of seconds a worker of read_nodelists may spend on one file.
+ */
+#define PYHL_READ_NODELISTS_TIMEOUT 60.0
+
 #define PyhlNodelist_Check(op) (Py_TYPE(op) == &PyhlNodelist_Type) //((op)->ob_type == &PyhlNodelist_Type)
 
 /**
@@ -195,6 +238,48 @@ static void _dealloc_pyhlcompression(PyhlCompression* val)
   PyObject_Del(val);
 }
 
+/**
+ * Releases a buffer that has been set in a node with HLNode_setExternalArrayValue.
+ * When called from a thread not holding the GIL, for example when a node is freed
+ * during I/O, the release is postponed since waiting for the GIL might deadlock.
+ * @param[in] owner the PyhlBufferOwner, may be NULL
+ */
+static void _pyhl_release_buffer(void* owner)
+{
+  PyhlBufferOwner* bufferOwner = (PyhlBufferOwner*)owner;
+  if (bufferOwner == NULL) {
+    return;
+  }
+  if (!PyGILState_Check()) {
+    pthread_mutex_lock(&pendingBufferReleasesLock);
+    bufferOwner->next = pendingBufferReleases;
+    pendingBufferReleases = bufferOwner;
+    pthread_mutex_unlock(&pendingBufferReleasesLock);
+  } else {
+    PyBuffer_Release(&bufferOwner->view);
+    HLHDF_FREE(bufferOwner);
+  }
+}
+
+/**
+ * Releases the buffers that has been postponed by _pyhl_release_buffer. Must be called
+ * while holding the GIL.
+ */
+static void _pyhl_release_pending_buffers(void)
+{
+  PyhlBufferOwner* pending = NULL;
+  pthread_mutex_lock(&pendingBufferReleasesLock);
+  pending = pendingBufferReleases;
+  pendingBufferReleases = NULL;
+  pthread_mutex_unlock(&pendingBufferReleasesLock);
+  while (pending != NULL) {
+    PyhlBufferOwner* next = pending->next;
+    PyBuffer_Release(&pending->view);
+    HLHDF_FREE(pending);
+    pending = next;
+  }
+}
+
 /**
  * Creates a new instance of the nodelist.
  * @param[in] self this instance.
@@ -208,6 +293,7 @@ static PyObject* _pyhl_new_nodelist(PyObject* self, PyObject* args)
   if (!retv)
     return NULL;
 
+  retv->busy = 0;
   if (!(retv->nodelist = HLNodeList_new())) {
     setException(PyExc_MemoryError,"Failed to create HL NodeList\n");
     _dealloc(retv);
@@ -339,11 +425,13 @@ static PyObject* _pyhl_read_nodelist(PyObject* self, PyObject* args)
   if (!PyArg_ParseTuple(args, "s|s", &filename, &frompath))
     return NULL;
 
+  Py_BEGIN_ALLOW_THREADS
   if (!frompath) {
     nodelist = HLNodeList_read(filename);
   } else {
     nodelist = HLNodeList_readFrom(filename, frompath);
   }
+  Py_END_ALLOW_THREADS
 
   if (!nodelist) {
     char errmsg[256];
@@ -371,6 +459,85 @@ fail:
   return NULL;
 }
 
+/**
+ * Stores the nodelists read by HLNodeList_readMany in the array passed as userdata.
+ */
+static void _pyhl_read_nodelists_callback(int index, const char* filename, HL_NodeList* nodelist, void* userdata)
+{
+  HL_NodeList** nodelists = (HL_NodeList**)userdata;
+  nodelists[index] = nodelist;
+}
+
+static PyObject* _pyhl_read_nodelists(PyObject* self, PyObject* args)
+{
+  PyObject* inobj = NULL;
+  PyObject* seq = NULL;
+  PyObject* result = NULL;
+  const char** filenames = NULL;
+  HL_NodeList** nodelists = NULL;
+  int nworkers = 0;
+  double timeout = PYHL_READ_NODELISTS_TIMEOUT;
+  Py_ssize_t n = 0, i = 0;
+
+  if (!PyArg_ParseTuple(args, "O|id", &inobj, &nworkers, &timeout))
+    return NULL;
+
+  if ((seq = PySequence_Fast(inobj, "filenames must be a sequence of strings")) == NULL) {
+    return NULL;
+  }
+  n = PySequence_Fast_GET_SIZE(seq);
+  filenames = (const char**)HLHDF_MALLOC(sizeof(const char*) * (n + 1));
+  nodelists = (HL_NodeList**)HLHDF_CALLOC(n + 1, sizeof(HL_NodeList*));
+  if (filenames == NULL || nodelists == NULL) {
+    setException(PyExc_MemoryError, "Could not allocate memory for filenames");
+    goto fail;
+  }
+  for (i = 0; i < n; i++) {
+    PyObject* item = PySequence_Fast_GET_ITEM(seq, i);
+    if (!PyString_Check(item) || (filenames[i] = PyString_AsString(item)) == NULL) {
+      setException(PyExc_TypeError, "filenames must be a sequence of strings");
+      goto fail;
+    }
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  HLNodeList_readMany(filenames, (int)n, HLNodeList_selectAllNodes, nworkers, timeout, _pyhl_read_nodelists_callback, nodelists);
+  Py_END_ALLOW_THREADS
+
+  if ((result = PyList_New(n)) == NULL) {
+    goto fail;
+  }
+  for (i = 0; i < n; i++) {
+    PyhlNodelist* pynodelist = NULL;
+    if (nodelists[i] == NULL) {
+      Py_INCREF(Py_None);
+      PyList_SET_ITEM(result, i, Py_None);
+      continue;
+    }
+    if (!(pynodelist = (PyhlNodelist*) _pyhl_new_nodelist(NULL, NULL))) {
+      setException(PyExc_MemoryError,"Could not allocate nodelist instance");
+      Py_DECREF(result);
+      result = NULL;
+      goto fail;
+    }
+    HLNodeList_free(pynodelist->nodelist);
+    pynodelist->nodelist = nodelists[i];
+    nodelists[i] = NULL;
+    PyList_SET_ITEM(result, i, (PyObject*)pynodelist);
+  }
+
+fail:
+  if (nodelists != NULL) {
+    for (i = 0; i < n; i++) {
+      HLNodeList_free(nodelists[i]);
+    }
+  }
+  HLHDF_FREE(filenames);
+  HLHDF_FREE(nodelists);
+  Py_DECREF(seq);
+  return result;
+}
+
 static PyObject* _pyhl_is_file_hdf5(PyObject* self, PyObject* args)
 {
   char* filename;
@@ -422,6 +589,46 @@ static PyObject* _pyhl_get_hdf5version(PyObject* self, PyObject* args)
   }
 }
 
+static PyObject* _pyhl_get_statistics(PyObject* self, PyObject* args)
+{
+  HL_Statistics stats;
+  if (!PyArg_ParseTuple(args, "")) {
+    return NULL;
+  }
+  if (!HL_getStatistics(&stats)) {
+    setException(PyExc_RuntimeError, "Could not get statistics");
+    return NULL;
+  }
+  return Py_BuildValue("{s:K,s:K,s:K,s:K,s:K,s:K,s:K,s:K,s:K,s:K,s:K,s:K,s:K,s:d,s:d,s:d,s:d,s:d}",
+    "allocations", stats.allocations,
+    "frees", stats.frees,
+    "bytes_allocated", stats.bytesAllocated,
+    "current_bytes", stats.currentBytes,
+    "peak_bytes", stats.peakBytes,
+    "files_opened", stats.filesOpened,
+    "objects_opened", stats.objectsOpened,
+    "dataset_reads", stats.datasetReads,
+    "attribute_reads", stats.attributeReads,
+    "dataset_writes", stats.datasetWrites,
+    "attribute_writes", stats.attributeWrites,
+    "bytes_read", stats.bytesRead,
+    "bytes_written", stats.bytesWritten,
+    "file_open_time", stats.fileOpenTime,
+    "dataset_read_time", stats.datasetReadTime,
+    "attribute_read_time", stats.attributeReadTime,
+    "dataset_write_time", stats.datasetWriteTime,
+    "attribute_write_time", stats.attributeWriteTime);
+}
+
+static PyObject* _pyhl_reset_statistics(PyObject* self, PyObject* args)
+{
+  if (!PyArg_ParseTuple(args, "")) {
+    return NULL;
+  }
+  HL_resetStatistics();
+  Py_RETURN_NONE;
+}
+
 /* PyhlNodelist member methods */
 static PyObject* _pyhl_add_node(PyhlNodelist* self, PyObject* args)
 {
@@ -451,50 +658,69 @@ static PyObject* _pyhl_add_node(PyhlNodelist* self, PyObject* args)
   return Py_None;
 }
 
-static PyObject* _pyhl_write(PyhlNodelist* self, PyObject* args)
+/**
+ * Parses the arguments to write, write(filename[,zlib compression level(int)][,file creation property]).
+ * @param[in] args the arguments
+ * @param[out] filename the filename
+ * @param[out] doCompress the compression level, -1 if no compression
+ * @param[out] props the file creation property, NULL if not specified
+ * @return 1 on success, 0 on failure with the exception set
+ */
+static int _pyhl_parse_write_arguments(PyObject* args, char** filename, int* doCompress, PyObject** props)
 {
-  char* filename;
   PyObject* obj1 = NULL;
   PyObject* obj2 = NULL;
 
-  int doCompress = -1;
-  PyObject* props = NULL;
-  HL_Compression* theCompression = NULL;
-
-  if (!PyArg_ParseTuple(args, "s|OO", &filename, &obj1, &obj2))
-    return NULL;
+  *doCompress = -1;
+  *props = NULL;
+  if (!PyArg_ParseTuple(args, "s|OO", filename, &obj1, &obj2))
+    return 0;
 
   if (obj1 != NULL) {
     if (PyInt_Check(obj1)) {
-      doCompress = PyInt_AsLong(obj1);
+      *doCompress = PyInt_AsLong(obj1);
     } else if (PyhlFileCreationProperty_Check(obj1)) {
-      props = obj1;
+      *props = obj1;
     } else {
       setException(PyExc_AttributeError,"write method should be called with write(filename[,zlib compression level(int)][,file creation property])");
-      return NULL;
+      return 0;
     }
   }
   if (obj2 != NULL) {
     if (PyInt_Check(obj2)) {
-      if (doCompress != -1) {
+      if (*doCompress != -1) {
         setException(PyExc_AttributeError,"it is not meaningful or possible to call write with both second and third argument as integers, format is: "
             "write(filename[,zlib compression level(int)][,file creation property])");
-        return NULL;
+        return 0;
       }
-      doCompress = PyInt_AsLong(obj2);
+      *doCompress = PyInt_AsLong(obj2);
     } else if (PyhlFileCreationProperty_Check(obj2)) {
-      if (props != NULL) {
+      if (*props != NULL) {
         setException(PyExc_AttributeError,"it is not meaningful or possible to call write with both second and third argument as FileCreationProperty instances"
             ", format is: write(filename[,zlib compression level(int)][,file creation property])");
-        return NULL;
+        return 0;
       }
-      props = obj2;
+      *props = obj2;
     } else {
       setException(PyExc_AttributeError,"write method should be called with write(filename[,zlib compression level(int)][,file creation property])");
-      return NULL;
+      return 0;
     }
   }
 
+  return 1;
+}
+
+static PyObject* _pyhl_write(PyhlNodelist* self, PyObject* args)
+{
+  char* filename;
+  int doCompress = -1;
+  int written = 0;
+  PyObject* props = NULL;
+  HL_Compression* theCompression = NULL;
+
+  if (!_pyhl_parse_write_arguments(args, &filename, &doCompress, &props))
+    return NULL;
+
   if (!HLNodeList_setFileName(self->nodelist,filename)) {
     setException(PyExc_IOError, "Could not set filename for nodelist");
     return NULL;
@@ -505,9 +731,12 @@ static PyObject* _pyhl_write(PyhlNodelist* self, PyObject* args)
     theCompression->level = doCompress;
   }
 
-  if (!HLNodeList_write(self->nodelist,
-                        (props != NULL) ? ((PyhlFileCreationProperty*) props)->props : NULL,
-                        theCompression)) {
+  PYHL_BEGIN_NODELIST_IO(self)
+  written = HLNodeList_write(self->nodelist,
+                             (props != NULL) ? ((PyhlFileCreationProperty*) props)->props : NULL,
+                             theCompression);
+  PYHL_END_NODELIST_IO(self)
+  if (!written) {
     setException(PyExc_IOError,"Could not write hdf file");
     if (theCompression) {
       HLCompression_free(theCompression);
@@ -526,13 +755,17 @@ static PyObject* _pyhl_write(PyhlNodelist* self, PyObject* args)
 static PyObject* _pyhl_update(PyhlNodelist* self, PyObject* args)
 {
   int doCompress = 6;
+  int updated = 0;
   HL_Compression compression;
 
   if (!PyArg_ParseTuple(args, "|i", &doCompress))
     return NULL;
   HLCompression_init(&compression, CT_ZLIB);
   compression.level = doCompress;
-  if (!HLNodeList_update(self->nodelist, &compression)) {
+  PYHL_BEGIN_NODELIST_IO(self)
+  updated = HLNodeList_update(self->nodelist, &compression);
+  PYHL_END_NODELIST_IO(self)
+  if (!updated) {
     setException(PyExc_IOError,"Could not update file");
     return NULL;
   }
@@ -540,6 +773,226 @@ static PyObject* _pyhl_update(PyhlNodelist* self, PyObject* args)
   return Py_None;
 }
 
+/**
+ * Keeps the nodelist and the future alive while an asynchronous operation is running.
+ */
+typedef struct {
+  PyhlNodelist* nodelist; /**< the nodelist */
+  PyObject* future;       /**< the concurrent.futures.Future */
+  HL_AsyncOperation* op;  /**< the operation */
+  int released;           /**< set when the nodelist no longer is busy */
+} PyhlAsyncContext;
+
+/**
+ * Marks the nodelist as no longer busy.
+ * @param[in] ctx the context
+ */
+static void _pyhl_async_release_nodelist(PyhlAsyncContext* ctx)
+{
+  if (!ctx->released) {
+    ctx->released = 1;
+    ctx->nodelist->busy = 0;
+    _pyhl_release_pending_buffers();
+  }
+}
+
+/**
+ * Called on the HLHDF I/O thread when an asynchronous operation changes status. Completes
+ * the future and releases the nodelist when the operation has finished.
+ */
+static int _pyhl_async_callback(HL_AsyncOperation* op, HL_AsyncStatus status, void* userdata)
+{
+  PyhlAsyncContext* ctx = (PyhlAsyncContext*)userdata;
+  PyGILState_STATE gstate = PyGILState_Ensure();
+  PyObject* result = NULL;
+  int retv = 0;
+
+  if (status == HL_ASYNC_RUNNING) {
+    /* Lets the future decide, it might have been cancelled in the meantime */
+    if ((result = PyObject_CallMethod(ctx->future, "set_running_or_notify_cancel", NULL)) != NULL) {
+      retv = PyObject_IsTrue(result);
+    }
+  } else {
+    int cancelledByFuture = ctx->released;
+    _pyhl_async_release_nodelist(ctx);
+    if (status == HL_ASYNC_DONE) {
+      result = PyObject_CallMethod(ctx->future, "set_result", "O", Py_None);
+    } else if (status == HL_ASYNC_FAILED) {
+      PyObject* exc = PyObject_CallFunction(PyExc_IOError, "s", "Asynchronous operation failed");
+      if (exc != NULL) {
+        result = PyObject_CallMethod(ctx->future, "set_exception", "O", exc);
+        Py_DECREF(exc);
+      }
+    } else if (!cancelledByFuture) {
+      result = PyObject_CallMethod(ctx->future, "cancel", NULL);
+    } else {
+      result = Py_None;
+      Py_INCREF(result);
+    }
+    HLAsyncOperation_free(op);
+    Py_DECREF(ctx->future);
+    Py_DECREF(ctx->nodelist);
+    HLHDF_FREE(ctx);
+  }
+  if (result == NULL) {
+    PyErr_WriteUnraisable(Py_None);
+  }
+  Py_XDECREF(result);
+  PyGILState_Release(gstate);
+  return retv;
+}
+
+/**
+ * Added as done callback to the future. If the future has been cancelled, the operation
+ * will never touch the nodelist so it is released directly instead of when the I/O thread
+ * reaches the operation. The context is alive since the final operation callback always
+ * completes the future before releasing it.
+ */
+static PyObject* _pyhl_async_future_done(PyObject* capsule, PyObject* future)
+{
+  PyhlAsyncContext* ctx = (PyhlAsyncContext*)PyCapsule_GetPointer(capsule, NULL);
+  PyObject* cancelled = NULL;
+  if (ctx == NULL || (cancelled = PyObject_CallMethod(future, "cancelled", NULL)) == NULL) {
+    return NULL;
+  }
+  if (PyObject_IsTrue(cancelled) && !ctx->released) {
+    HLAsyncOperation_cancel(ctx->op);
+    _pyhl_async_release_nodelist(ctx);
+  }
+  Py_DECREF(cancelled);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+/**
+ * Method definition for @ref _pyhl_async_future_done.
+ */
+static PyMethodDef _pyhl_async_future_done_def = {"_pyhl_async_future_done", (PyCFunction)_pyhl_async_future_done, METH_O, NULL};
+
+/**
+ * The kind of asynchronous nodelist operation.
+ */
+typedef enum {
+  PYHL_ASYNC_FETCH, /**< fetch */
+  PYHL_ASYNC_WRITE, /**< write */
+  PYHL_ASYNC_UPDATE /**< update */
+} PyhlAsyncType;
+
+/**
+ * Starts an asynchronous operation on the nodelist. The nodelist is busy until the
+ * operation has finished.
+ * @param[in] self the nodelist
+ * @param[in] type the kind of operation
+ * @param[in] props the file creation property, may be NULL
+ * @param[in] compr the compression, may be NULL
+ * @return a concurrent.futures.Future or NULL on failure
+ */
+static PyObject* _pyhl_start_async(PyhlNodelist* self, PyhlAsyncType type, HL_FileCreationProperty* props, HL_Compression* compr)
+{
+  PyObject* module = NULL;
+  PyObject* future = NULL;
+  PyObject* capsule = NULL;
+  PyObject* donefn = NULL;
+  PyObject* result = NULL;
+  PyhlAsyncContext* ctx = NULL;
+  HL_AsyncOperation* op = NULL;
+
+  if ((module = PyImport_ImportModule("concurrent.futures")) == NULL) {
+    return NULL;
+  }
+  future = PyObject_CallMethod(module, "Future", NULL);
+  Py_DECREF(module);
+  if (future == NULL) {
+    return NULL;
+  }
+  if ((ctx = HLHDF_MALLOC(sizeof(PyhlAsyncContext))) == NULL) {
+    Py_DECREF(future);
+    raiseException(PyExc_MemoryError, "Could not allocate asynchronous context");
+  }
+  Py_INCREF(self);
+  Py_INCREF(future);
+  ctx->nodelist = self;
+  ctx->future = future;
+  ctx->op = NULL;
+  ctx->released = 0;
+
+  /* The callback can not run before the GIL is released */
+  self->busy = 1;
+  if (type == PYHL_ASYNC_FETCH) {
+    op = HLNodeList_fetchMarkedNodesAsync(self->nodelist, _pyhl_async_callback, ctx);
+  } else if (type == PYHL_ASYNC_WRITE) {
+    op = HLNodeList_writeAsync(self->nodelist, props, compr, _pyhl_async_callback, ctx);
+  } else {
+    op = HLNodeList_updateAsync(self->nodelist, compr, _pyhl_async_callback, ctx);
+  }
+  if (op == NULL) {
+    self->busy = 0;
+    Py_DECREF(ctx->future);
+    Py_DECREF(ctx->nodelist);
+    HLHDF_FREE(ctx);
+    Py_DECREF(future);
+    raiseException(PyExc_IOError, "Could not start asynchronous operation");
+  }
+  ctx->op = op;
+
+  if ((capsule = PyCapsule_New(ctx, NULL, NULL)) != NULL &&
+      (donefn = PyCFunction_New(&_pyhl_async_future_done_def, capsule)) != NULL) {
+    result = PyObject_CallMethod(future, "add_done_callback", "O", donefn);
+  }
+  Py_XDECREF(capsule);
+  Py_XDECREF(donefn);
+  if (result == NULL) {
+    /* The operation has been started so the future has to be returned anyway */
+    PyErr_WriteUnraisable(future);
+  }
+  Py_XDECREF(result);
+  return future;
+}
+
+static PyObject* _pyhl_fetch_async(PyhlNodelist* self, PyObject* args)
+{
+  if (!PyArg_ParseTuple(args, ""))
+    return NULL;
+  return _pyhl_start_async(self, PYHL_ASYNC_FETCH, NULL, NULL);
+}
+
+static PyObject* _pyhl_write_async(PyhlNodelist* self, PyObject* args)
+{
+  char* filename;
+  int doCompress = -1;
+  PyObject* props = NULL;
+  PyObject* retv = NULL;
+  HL_Compression* theCompression = NULL;
+
+  if (!_pyhl_parse_write_arguments(args, &filename, &doCompress, &props))
+    return NULL;
+
+  if (!HLNodeList_setFileName(self->nodelist,filename)) {
+    raiseException(PyExc_IOError, "Could not set filename for nodelist");
+  }
+  if (doCompress != -1) {
+    theCompression = HLCompression_new(CT_ZLIB);
+    theCompression->level = doCompress;
+  }
+  retv = _pyhl_start_async(self, PYHL_ASYNC_WRITE,
+                           (props != NULL) ? ((PyhlFileCreationProperty*) props)->props : NULL,
+                           theCompression);
+  HLCompression_free(theCompression);
+  return retv;
+}
+
+static PyObject* _pyhl_update_async(PyhlNodelist* self, PyObject* args)
+{
+  int doCompress = 6;
+  HL_Compression compression;
+
+  if (!PyArg_ParseTuple(args, "|i", &doCompress))
+    return NULL;
+  HLCompression_init(&compression, CT_ZLIB);
+  compression.level = doCompress;
+  return _pyhl_start_async(self, PYHL_ASYNC_UPDATE, NULL, &compression);
+}
+
 static PyObject* _pyhl_get_node_names(PyhlNodelist* self, PyObject* args)
 {
   PyObject* retv = NULL;
@@ -613,6 +1066,73 @@ static PyObject* _pyhl_select_all(PyhlNodelist* self, PyObject* args)
   return Py_None;
 }
 
+static PyObject* _pyhl_set_lazy_loading(PyhlNodelist* self, PyObject* args)
+{
+  PyObject* lazy = NULL;
+  if (!PyArg_ParseTuple(args, "O", &lazy)) {
+    return NULL;
+  }
+  if (!HLNodeList_setLazyLoading(self->nodelist, PyObject_IsTrue(lazy))) {
+    raiseException(PyExc_IOError, "Could not change lazy loading, has the nodelist been read from a file?");
+  }
+  Py_RETURN_NONE;
+}
+
+static PyObject* _pyhl_set_data_budget(PyhlNodelist* self, PyObject* args)
+{
+  Py_ssize_t budget = 0;
+  if (!PyArg_ParseTuple(args, "n", &budget)) {
+    return NULL;
+  }
+  if (budget < 0) {
+    raiseException(PyExc_ValueError, "budget must be >= 0");
+  }
+  if (!HLNodeList_setDataBudget(self->nodelist, (size_t)budget)) {
+    raiseException(PyExc_MemoryError, "Could not set data budget");
+  }
+  Py_RETURN_NONE;
+}
+
+static PyObject* _pyhl_set_compute_statistics(PyhlNodelist* self, PyObject* args)
+{
+  PyObject* compute = NULL;
+  int nbins = 0;
+  double low = 0.0, high = 0.0;
+  if (!PyArg_ParseTuple(args, "O|idd", &compute, &nbins, &low, &high)) {
+    return NULL;
+  }
+  if (!HLNodeList_setStatisticsHistogram(self->nodelist, nbins, low, high)) {
+    raiseException(PyExc_ValueError, "Invalid histogram, nbins must be between 0 and 256 and high greater than low");
+  }
+  HLNodeList_setComputeStatistics(self->nodelist, PyObject_IsTrue(compute));
+  Py_RETURN_NONE;
+}
+
+static PyObject* _pyhl_cached_data_size(PyhlNodelist* self, PyObject* args)
+{
+  return PyLong_FromSize_t(HLNodeList_getCachedDataSize(self->nodelist));
+}
+
+static PyObject* _pyhl_release_data(PyhlNodelist* self, PyObject* args)
+{
+  char* nodename = NULL;
+  HL_Node* node = NULL;
+  char errbuf[256];
+
+  if (!PyArg_ParseTuple(args, "s", &nodename)) {
+    return NULL;
+  }
+  if ((node = HLNodeList_getNodeByName(self->nodelist, nodename)) == NULL) {
+    snprintf(errbuf, sizeof(errbuf), "No node called '%s'", nodename);
+    raiseException(PyExc_AttributeError, errbuf);
+  }
+  if (!HLNode_releaseData(node)) {
+    snprintf(errbuf, sizeof(errbuf), "Could not release data of '%s', it has not been written", nodename);
+    raiseException(PyExc_ValueError, errbuf);
+  }
+  Py_RETURN_NONE;
+}
+
 static PyObject* _pyhl_select_metadata(PyhlNodelist* self, PyObject* args)
 {
   HLNodeList_selectMetadataNodes(self->nodelist);
@@ -672,7 +1192,11 @@ fail:
 
 static PyObject* _pyhl_fetch(PyhlNodelist* self, PyObject* args)
 {
-  if (!HLNodeList_fetchMarkedNodes(self->nodelist)) {
+  int fetched = 0;
+  PYHL_BEGIN_NODELIST_IO(self)
+  fetched = HLNodeList_fetchMarkedNodes(self->nodelist);
+  PYHL_END_NODELIST_IO(self)
+  if (!fetched) {
     setException(PyExc_IOError,"Could not fetch selected nodes");
     goto fail;
   }
@@ -693,7 +1217,10 @@ static PyObject* _pyhl_fetch_node(PyhlNodelist* self, PyObject* args)
   if (!PyArg_ParseTuple(args, "s", &nodename))
     return NULL;
 
-  if (!(node = HLNodeList_fetchNode(self->nodelist, nodename))) {
+  PYHL_BEGIN_NODELIST_IO(self)
+  node = HLNodeList_fetchNode(self->nodelist, nodename);
+  PYHL_END_NODELIST_IO(self)
+  if (node == NULL) {
     sprintf(errbuf, "Could not fetch node '%s'", nodename);
     setException(PyExc_IOError,errbuf);
     goto fail;
@@ -751,6 +1278,12 @@ static PyObject* _pyhl_get_node(PyhlNodelist* self, PyObject* args)
 
   HLNode_free(retv->node);
 
+  if (HLNodeList_isLazyLoading(self->nodelist)) {
+    /* Load the node in the nodelist so that it only is read once */
+    PYHL_BEGIN_NODELIST_IO(self)
+    HLNode_getData(node);
+    PYHL_END_NODELIST_IO(self)
+  }
   retv->node = HLNode_copy(node);
 
   Py_XDECREF(myArgs);
@@ -763,6 +1296,47 @@ fail:
 }
 
 /* PyhlNode member methods */
+/**
+ * Type information about a node or format. The information is extracted while holding
+ * the HDF5 lock since other threads might be using HDF5 without holding the GIL.
+ */
+typedef struct {
+  H5T_class_t typeClass; /**< the type class */
+  size_t size;           /**< the size of the type */
+  int isVariableString;  /**< if the type is a variable length string */
+  int committed;         /**< if the type is committed (named) */
+} PyhlTypeInfo;
+
+/**
+ * Gets the type information for either a type or a format.
+ * @param[in] type the type identifier, if < 0, format is used instead
+ * @param[in] format the format name
+ * @param[out] info the type information
+ * @return 1 on success, 0 if the type not could be determined
+ */
+static int _pyhl_get_type_info(hid_t type, const char* format, PyhlTypeInfo* info)
+{
+  hid_t tmpHid = -1;
+  int status = 0;
+
+  HL_lockHdf5();
+  if (type >= 0) {
+    tmpHid = H5Tcopy(type);
+  } else if (format != NULL && HL_isFormatSupported(format)) {
+    tmpHid = HL_translateFormatStringToDatatype(format);
+  }
+  if (tmpHid >= 0) {
+    info->typeClass = H5Tget_class(tmpHid);
+    info->size = H5Tget_size(tmpHid);
+    info->isVariableString = (H5Tis_variable_str(tmpHid) > 0);
+    info->committed = (type >= 0 && H5Tcommitted(type) > 0);
+    status = 1;
+  }
+  HL_H5T_CLOSE(tmpHid);
+  HL_unlockHdf5();
+  return status;
+}
+
 static PyObject* _pyhl_node_set_scalar_value(PyhlNode* self, PyObject* args)
 {
   int itemSize;
@@ -770,7 +1344,8 @@ static PyObject* _pyhl_node_set_scalar_value(PyhlNode* self, PyObject* args)
   PyObject* data;
   long hid_long = -1;
   hid_t lhid = -1;
-  hid_t tmpHid = -1;
+  int isSimple = 0;
+  PyhlTypeInfo info;
   int chkVal = 0;
 
   if (!PyArg_ParseTuple(args, "iOsl", &itemSize, &data, &hltypename, &hid_long))
@@ -783,19 +1358,19 @@ static PyObject* _pyhl_node_set_scalar_value(PyhlNode* self, PyObject* args)
     return NULL;
   }
 
-  if (strcmp(hltypename, "string") != 0 && strcmp(hltypename, "compound") != 0
-      && (tmpHid = HL_translateFormatStringToDatatype(hltypename)) == -1) {
+  isSimple = (strcmp(hltypename, "string") != 0 && strcmp(hltypename, "compound") != 0);
+  if (isSimple && !_pyhl_get_type_info(-1, hltypename, &info)) {
     char errmsg[256];
     sprintf(errmsg, "No datatype called '%s'.", hltypename);
     setException(PyExc_AttributeError,errmsg);
     return NULL;
   }
 
-  if (tmpHid != -1) {
+  if (isSimple) {
     /* Well, ordinary attribute, just make sure the space is enough */
-    size_t typeSize = H5Tget_size(tmpHid);
+    size_t typeSize = info.size;
     chkVal = 0;
-    switch (H5Tget_class(tmpHid)) {
+    switch (info.typeClass) {
     case H5T_INTEGER: {
       if (typeSize <= sizeof(char)) {
         char mData = (char) PyInt_AsLong(data);
@@ -825,7 +1400,14 @@ static PyObject* _pyhl_node_set_scalar_value(PyhlNode* self, PyObject* args)
       break;
     }
     case H5T_FLOAT: {
-      if (typeSize <= sizeof(float)) {
+      if (strcmp(hltypename, "half") == 0 || strcmp(hltypename, "bfloat16") == 0) {
+        double mData = (double) PyFloat_AsDouble(data);
+        chkVal = HLNode_setScalarValue(self->node, sizeof(mData),
+                                       (unsigned char*) &mData, "double", -1);
+        if (chkVal) {
+          chkVal = HLNode_convertData(self->node, HL_getFormatSpecifier(hltypename));
+        }
+      } else if (typeSize <= sizeof(float)) {
         float mData = (float) PyFloat_AsDouble(data);
         chkVal = HLNode_setScalarValue(self->node, sizeof(mData),
                                        (unsigned char*) &mData, hltypename, -1);
@@ -842,13 +1424,11 @@ static PyObject* _pyhl_node_set_scalar_value(PyhlNode* self, PyObject* args)
       char errmsg[256];
       sprintf(errmsg,
               "_pyhl_node_set_scalar_value Could not handle type in switch,"
-                "type=%d\n", (int) H5Tget_class(tmpHid));
+                "type=%d\n", (int) info.typeClass);
       setException(PyExc_TypeError,errmsg);
       goto fail;
     }
     }
-    H5Tclose(tmpHid);
-    tmpHid = -1;
     if (!chkVal) {
       setException(PyExc_TypeError,"Could not set scalar value");
       goto fail;
@@ -878,15 +1458,9 @@ static PyObject* _pyhl_node_set_scalar_value(PyhlNode* self, PyObject* args)
     }
   }
 
-  if (tmpHid >= 0)
-    H5Tclose(tmpHid);
-
   Py_INCREF(Py_None);
   return Py_None;
 fail:
-  if (tmpHid >= 0)
-    H5Tclose(tmpHid);
-
   return NULL;
 }
 
@@ -898,11 +1472,12 @@ static PyObject* _pyhl_node_set_array_value(PyhlNode* self, PyObject* args)
   char* hltypename;
   int itemSize = 0;
   int n = 0;
-  hsize_t dims[4];
+  hsize_t dims[H5S_MAX_RANK];
   int i;
   int ndim;
   PyObject* pyo = NULL;
-  size_t tmpSize;
+  PyhlBufferOwner* owner = NULL;
+  int tmpSize = 0;
 
   if (!PyArg_ParseTuple(args, "iOOsi", &itemSize, &pydims, &data, &hltypename, &lhid))
     return NULL;
@@ -911,49 +1486,80 @@ static PyObject* _pyhl_node_set_array_value(PyhlNode* self, PyObject* args)
     return NULL;
   }
 
-  if (PyObject_Length(pydims) > 4) {
-    setException(PyExc_ValueError,"Not more than 4 dimensions are allowed");
+  if (pydims != Py_None && PyObject_Length(pydims) > H5S_MAX_RANK) {
+    setException(PyExc_ValueError,"Not more than 32 dimensions are allowed");
     goto fail;
   }
 
-  if (PyArray_Check(data) && HL_isFormatSupported(hltypename)) {
-    /*Ahh plain array*/
-    if (PyObject_Length(pydims) != ((PyArrayObject*) data)->nd) {
-      setException(PyExc_ValueError,"Rank of Array != no of dims");
+  if (PyObject_CheckBuffer(data) && HL_isFormatSupported(hltypename)) {
+    /* Any object supporting the buffer protocol, the node will refer to the buffer instead of copying it */
+    size_t npts = 1;
+    int untyped = 0;
+    if (!(owner = HLHDF_MALLOC(sizeof(PyhlBufferOwner)))) {
+      setException(PyExc_MemoryError,"Could not allocate buffer view");
       goto fail;
     }
-    ndim = PyObject_Length(pydims);
-    for (i = 0; i < ndim; i++) { /*Extract dimensions*/
-      if (!(pyo = PySequence_GetItem(pydims, i))) {
-        setException(PyExc_AttributeError,"Could not get list item");
+    if (PyObject_GetBuffer(data, &owner->view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+      /* Not contiguous, let numpy create a contiguous copy */
+      PyObject* contiguous = NULL;
+      PyErr_Clear();
+      if (!(contiguous = PyArray_FromAny(data, NULL, 0, 0, NPY_ARRAY_C_CONTIGUOUS, NULL)) ||
+          PyObject_GetBuffer(contiguous, &owner->view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        Py_XDECREF(contiguous);
+        HLHDF_FREE(owner);
+        setException(PyExc_TypeError,"Could not get a contiguous buffer from data");
         goto fail;
       }
-      dims[i] = PyInt_AsLong(pyo);
-      Py_XDECREF(pyo);
-      pyo=NULL;
-      if(dims[i]!=((PyArrayObject*)data)->dimensions[i]) {
-        setException(PyExc_AttributeError,"Array dimensions != list dimensions");
-        goto fail;
+      Py_DECREF(contiguous);
+    }
+    /* Plain byte buffers (bytes, bytearray, memoryview of bytes) carry no type, numpy arrays always do */
+    untyped = !PyArray_Check(data) && (owner->view.format == NULL || strcmp(owner->view.format, "B") == 0);
+    ndim = (pydims == Py_None) ? owner->view.ndim : PyObject_Length(pydims);
+    if (ndim < 1 || ndim > H5S_MAX_RANK) {
+      setException(PyExc_ValueError,"Rank of array must be between 1 and 32");
+      goto fail;
+    }
+    if (pydims == Py_None) {
+      for (i = 0; i < ndim; i++) {
+        dims[i] = (hsize_t)owner->view.shape[i];
+      }
+    } else {
+      for (i = 0; i < ndim; i++) { /*Extract dimensions*/
+        if (!(pyo = PySequence_GetItem(pydims, i))) {
+          setException(PyExc_AttributeError,"Could not get list item");
+          goto fail;
+        }
+        dims[i] = PyInt_AsLong(pyo);
+        Py_XDECREF(pyo);
+        pyo=NULL;
       }
     }
+    for (i = 0; i < ndim; i++) {
+      npts *= dims[i];
+    }
     if((tmpSize = HL_sizeOfFormat(hltypename))<0) {
       setException(PyExc_ValueError,"Could not determine size");
       goto fail;
     }
-    if(tmpSize!=((PyArrayObject*)data)->descr->elsize) {
+    if(!untyped && tmpSize!=owner->view.itemsize) {
       setException(PyExc_ValueError,"Type sizes are different between format and array");
       goto fail;
     }
-    if(!HLNode_setArrayValue(self->node,tmpSize,ndim,dims,(unsigned char*)((PyArrayObject*)data)->data,
-            hltypename,-1)) {
+    if (npts * tmpSize != owner->view.len) {
+      setException(PyExc_AttributeError,"Array dimensions != list dimensions");
+      goto fail;
+    }
+    if(!HLNode_setExternalArrayValue(self->node,tmpSize,ndim,dims,(unsigned char*)owner->view.buf,
+            owner,_pyhl_release_buffer,hltypename,-1)) {
+      owner = NULL; /* Released by HLNode_setExternalArrayValue */
       setException(PyExc_AttributeError,"Could not set array data");
       goto fail;
     }
+    owner = NULL;
   } else if(PyList_Check(data) && (strcmp(hltypename,"string")==0 || HL_isFormatSupported(hltypename))) {
     /* Okie, list of something */
     int maxstrlen=0;
     char* tmpData=NULL;
-    hid_t strtype=-1;
 
     if(PyObject_Length(pydims)!=1) {
       setException(PyExc_ValueError,"When using lists, the only allowed rank is 1.");
@@ -994,16 +1600,10 @@ static PyObject* _pyhl_node_set_array_value(PyhlNode* self, PyObject* args)
         tmpstr = PyString_AsString(pyo);
         memcpy(&tmpData[i*itemSize],tmpstr,strlen(tmpstr));
       }
-      if ((strtype = H5Tcopy(H5T_C_S1))<0) {
-        setException(PyExc_MemoryError,"Could not create a string type");
-        HLHDF_FREE(tmpData);
-        goto fail;
-      }
-      H5Tset_size(strtype, itemSize);
       dims[0]=n;
-      if(!(HLNode_setArrayValue(self->node,itemSize,1,dims,(unsigned char*)tmpData,hltypename,strtype))) {
+      /* The string type with size itemSize is created by the node */
+      if(!(HLNode_setArrayValue(self->node,itemSize,1,dims,(unsigned char*)tmpData,hltypename,-1))) {
         setException(PyExc_AttributeError,"Could not set array data");
-        H5Tclose(strtype);
         HLHDF_FREE(tmpData);
         goto fail;
       }
@@ -1111,6 +1711,7 @@ fail:
   if(pyo) {
     Py_XDECREF(pyo);
   }
+  _pyhl_release_buffer(owner);
   return NULL;
 }
 
@@ -1175,60 +1776,148 @@ static PyObject* _pyhl_node_format(PyhlNode* self, PyObject* args)
   return PyString_FromString(HLNode_getFormatName(self->node));
 }
 
-static PyObject* _pyhl_node_data(PyhlNode* self, PyObject* args)
+/**
+ * Releases the node buffer that keeps the data of an array returned by
+ * _pyhl_wrap_buffer alive.
+ */
+static void _pyhl_node_data_capsule_destructor(PyObject* capsule)
 {
+  HLNodePrivate_releaseBuffer((HL_NodeBuffer*)PyCapsule_GetPointer(capsule, "_pyhl.nodedata"));
+}
+
+/**
+ * Creates a numpy array of the data in a node buffer. Unless a copy is requested, the
+ * array refers directly to the buffer and keeps the reference to it as base object so
+ * that it stays valid after the node has got a new value or has been freed. Such an array
+ * is read-only if the buffer is shared with a node, since it otherwise would modify the node.
+ * @param[in] buffer the buffer (<b>reference stolen</b>)
+ * @param[in] descr the numpy type of one item (<b>reference stolen</b>)
+ * @param[in] rank the rank of the array
+ * @param[in] dims the dimensions of the array
+ * @param[in] copy if the array should get a copy of the data
+ * @return the array or NULL on failure
+ */
+static PyObject* _pyhl_wrap_buffer(HL_NodeBuffer* buffer, PyArray_Descr* descr, int rank, npy_intp* dims, int copy)
+{
+  PyObject* capsule = NULL;
+  PyObject* view = NULL;
   PyObject* retv = NULL;
-  hid_t tmpHid = -1;
+  unsigned char* data = HLNodePrivate_getBufferData(buffer);
+  int flags = (copy || HLNodePrivate_isBufferShared(buffer)) ? NPY_ARRAY_CARRAY_RO : NPY_ARRAY_CARRAY;
+
+  if ((view = PyArray_NewFromDescr(&PyArray_Type, descr, rank, dims, NULL, data, flags, NULL)) == NULL) {
+    HLNodePrivate_releaseBuffer(buffer);
+    return NULL;
+  }
+  if (copy) {
+    retv = PyArray_NewCopy((PyArrayObject*)view, NPY_CORDER);
+    Py_DECREF(view);
+    HLNodePrivate_releaseBuffer(buffer);
+    return retv;
+  }
+  if ((capsule = PyCapsule_New(buffer, "_pyhl.nodedata", _pyhl_node_data_capsule_destructor)) == NULL) {
+    Py_DECREF(view);
+    HLNodePrivate_releaseBuffer(buffer);
+    return NULL;
+  }
+  if (PyArray_SetBaseObject((PyArrayObject*)view, capsule) < 0) { /* Steals capsule */
+    Py_DECREF(view);
+    return NULL;
+  }
+  return view;
+}
+
+/**
+ * Creates a numpy array of the (raw)data of the node, see @ref _pyhl_wrap_buffer.
+ * @param[in] node the node
+ * @param[in] descr the numpy type of one item (<b>reference stolen</b>)
+ * @param[in] raw if rawdata should be used instead of data
+ * @param[in] copy if the array should get a copy of the data instead of referring to it
+ * @return the array or NULL on failure
+ */
+static PyObject* _pyhl_node_wrap_data(HL_Node* node, PyArray_Descr* descr, int raw, int copy)
+{
+  HL_NodeBuffer* buffer = NULL;
+  npy_intp dims[NPY_MAXDIMS];
+  int i = 0, rank = HLNode_getRank(node);
+
+  if (descr == NULL) {
+    return NULL;
+  }
+  if (rank > NPY_MAXDIMS) {
+    Py_DECREF(descr);
+    raiseException(PyExc_TypeError, "Too many dimensions for a numpy array");
+  }
+  if ((buffer = HLNodePrivate_refDataBuffer(node, raw)) == NULL) {
+    Py_DECREF(descr);
+    raiseException(PyExc_AttributeError, "Node has no data");
+  }
+  for (i = 0; i < rank; i++) {
+    dims[i] = (npy_intp)HLNode_getDimension(node, i);
+  }
+  return _pyhl_wrap_buffer(buffer, descr, rank, dims, copy);
+}
+
+/**
+ * Returns the data of a node in fixed format (native) as a python object.
+ * @param[in] node the node
+ * @return the python object or NULL on failure
+ */
+static PyObject* _pyhl_node_get_value(HL_Node* node, int copy)
+{
+  PyObject* retv = NULL;
+  PyhlTypeInfo info;
   size_t typeSize;
   char errbuf[256];
   npy_intp* dims = NULL;
   int i;
   size_t npts;
 
-  if (HLNodePrivate_getTypeId(self->node) >= 0) {
-    tmpHid = H5Tcopy(HLNodePrivate_getTypeId(self->node));
-  } else if (HL_isFormatSupported(HLNode_getFormatName(self->node))) {
-    tmpHid = HL_translateFormatStringToDatatype(HLNode_getFormatName(self->node));
-  } else {
+  if (!_pyhl_get_type_info(HLNodePrivate_getTypeId(node), HLNode_getFormatName(node), &info)) {
     setException(PyExc_AttributeError,"Strange type, can't handle");
     return NULL;
   }
 
-  typeSize = H5Tget_size(tmpHid);
-  if (HLNode_getRank(self->node) == 0) { /*Scalar*/
-    switch (H5Tget_class(tmpHid)) {
+  typeSize = info.size;
+  if (HLNode_getRank(node) == 0) { /*Scalar*/
+    switch (info.typeClass) {
     case H5T_INTEGER: {
       if (typeSize <= sizeof(char)) {
         char v;
-        memcpy(&v, HLNode_getData(self->node), typeSize);
+        memcpy(&v, HLNode_getData(node), typeSize);
         retv = PyInt_FromLong((long) v);
       } else if (typeSize <= sizeof(short)) {
         short v;
-        memcpy(&v, HLNode_getData(self->node), typeSize);
+        memcpy(&v, HLNode_getData(node), typeSize);
         retv = PyInt_FromLong((long) v);
       } else if (typeSize <= sizeof(int)) {
         int v;
-        memcpy(&v, HLNode_getData(self->node), typeSize);
+        memcpy(&v, HLNode_getData(node), typeSize);
         retv = PyInt_FromLong((long) v);
       } else if (typeSize <= sizeof(long)) {
         long v;
-        memcpy(&v, HLNode_getData(self->node), typeSize);
+        memcpy(&v, HLNode_getData(node), typeSize);
         retv = PyInt_FromLong((long) v);
       } else {
         long long v;
-        memcpy(&v, HLNode_getData(self->node), typeSize);
+        memcpy(&v, HLNode_getData(node), typeSize);
         retv = PyLong_FromLongLong(v);
       }
       break;
     }
     case H5T_FLOAT: {
-      if (typeSize <= sizeof(float)) {
+      if (HLNode_getFormat(node) == HLHDF_HALF || HLNode_getFormat(node) == HLHDF_BFLOAT16) {
+        double v;
+        if (HLNode_getDataAs(node, HLHDF_DOUBLE, &v)) {
+          retv = PyFloat_FromDouble(v);
+        }
+      } else if (typeSize <= sizeof(float)) {
         float v;
-        memcpy(&v, HLNode_getData(self->node), typeSize);
+        memcpy(&v, HLNode_getData(node), typeSize);
         retv = PyFloat_FromDouble((double) v);
       } else if (typeSize <= sizeof(double)) {
         double v;
-        memcpy(&v, HLNode_getData(self->node), typeSize);
+        memcpy(&v, HLNode_getData(node), typeSize);
         retv = PyFloat_FromDouble(v);
       } else {
         fprintf(stderr, "Whoaa, greater float than double not supported\n");
@@ -1236,73 +1925,62 @@ static PyObject* _pyhl_node_data(PyhlNode* self, PyObject* args)
       break;
     }
     case H5T_COMPOUND: {
-      retv = PyByteArray_FromStringAndSize((char*)HLNode_getData(self->node), typeSize);
+      retv = PyByteArray_FromStringAndSize((char*)HLNode_getData(node), typeSize);
       break;
     }
     case H5T_STRING: {
-      char* d = (char*)HLNode_getData(self->node);
-      if (H5Tis_variable_str(tmpHid)) { /* You can't trust typeSize when variable length. The size will always be size of pointer */
+      char* d = (char*)HLNode_getData(node);
+      if (info.isVariableString) { /* You can't trust typeSize when variable length. The size will always be size of pointer */
         typeSize = strlen(d);
       }
       if (d[typeSize-1] == '\0') {
-        retv = PyHlhdf_StringOrUnicode_FromASCII((char*)HLNode_getData(self->node), typeSize - 1);
+        retv = PyHlhdf_StringOrUnicode_FromASCII((char*)HLNode_getData(node), typeSize - 1);
       } else {
-        retv = PyHlhdf_StringOrUnicode_FromASCII((char*)HLNode_getData(self->node), typeSize);
+        retv = PyHlhdf_StringOrUnicode_FromASCII((char*)HLNode_getData(node), typeSize);
       }
       break;
     }
     default: {
-      sprintf(errbuf, "Unrecognized class %d", (int) H5Tget_class(tmpHid));
+      sprintf(errbuf, "Unrecognized class %d", (int) info.typeClass);
       setException(PyExc_TypeError,errbuf);
       break;
     }
     }
   } else { /*Simple*/
-    if (!(dims = HLHDF_MALLOC(sizeof(npy_intp) * HLNode_getRank(self->node)))) {
+    if (!(dims = HLHDF_MALLOC(sizeof(npy_intp) * HLNode_getRank(node)))) {
       setException(PyExc_MemoryError,"Could not allocate dims");
       goto fail;
     }
-    switch (H5Tget_class(tmpHid)) {
+    switch (info.typeClass) {
     case H5T_INTEGER:
     case H5T_FLOAT: {
-      int iformat = pyarraytypeFromHdfType(HLNode_getFormatName(self->node));
-      int nbytes;
+      int iformat = pyarraytypeFromHdfType(HLNode_getFormatName(node));
       if (iformat == -1) {
-        sprintf(errbuf, "Unrecognized datatype %s", HLNode_getFormatName(self->node));
+        sprintf(errbuf, "Unrecognized datatype %s", HLNode_getFormatName(node));
         setException(PyExc_TypeError,errbuf);
         goto fail;
       }
-      for (i = 0; i < HLNode_getRank(self->node); i++)
-        dims[i] = (npy_intp) HLNode_getDimension(self->node, i);
-
-      retv = PyArray_SimpleNew(HLNode_getRank(self->node), dims, iformat);
-      if (!retv) {
-        setException(PyExc_MemoryError,"Could not create array");
+      if (!(retv = _pyhl_node_wrap_data(node, PyArray_DescrFromType(iformat), 0, copy))) {
         goto fail;
       }
-      nbytes = (int)HLNode_getNumberOfPoints(self->node);
-      nbytes *= ((PyArrayObject*) retv)->descr->elsize;
-
-      memcpy(((PyArrayObject*) retv)->data, (unsigned char*) HLNode_getData(self->node),
-             nbytes);
       break;
     }
     case H5T_COMPOUND: {
-      npts = (size_t)HLNode_getNumberOfPoints(self->node);
+      npts = (size_t)HLNode_getNumberOfPoints(node);
       npts *= typeSize;
-      retv = PyByteArray_FromStringAndSize((char*) HLNode_getData(self->node), npts);
+      retv = PyByteArray_FromStringAndSize((char*) HLNode_getData(node), npts);
       break;
     }
     case H5T_STRING: {
-      if (HLNode_getRank(self->node) != 1) {
+      if (HLNode_getRank(node) != 1) {
         /* Don't know how to represent a multi-dim array of strings */
-        npts = (size_t)HLNode_getNumberOfPoints(self->node);
+        npts = (size_t)HLNode_getNumberOfPoints(node);
         npts *= typeSize;
-        retv = PyString_FromStringAndSize((char*) HLNode_getData(self->node), npts - 1);
+        retv = PyString_FromStringAndSize((char*) HLNode_getData(node), npts - 1);
       } else {
-        const unsigned char* data = HLNode_getData(self->node);
+        const unsigned char* data = HLNode_getData(node);
         retv = PyList_New(0);
-        for (i = 0; retv && i < HLNode_getDimension(self->node, 0); i++) {
+        for (i = 0; retv && i < HLNode_getDimension(node, 0); i++) {
           PyObject* pyo =
               PyString_FromStringAndSize((char*) (&data[i * typeSize]), typeSize - 1);
           if (!pyo) {
@@ -1319,7 +1997,7 @@ static PyObject* _pyhl_node_data(PyhlNode* self, PyObject* args)
       break;
     }
     default: {
-      sprintf(errbuf,"Unrecognized class %d",(int)H5Tget_class(tmpHid));
+      sprintf(errbuf,"Unrecognized class %d",(int)info.typeClass);
       setException(PyExc_TypeError,errbuf);
       break;
     }
@@ -1327,35 +2005,46 @@ static PyObject* _pyhl_node_data(PyhlNode* self, PyObject* args)
   }
 
   HLHDF_FREE(dims);
-  HL_H5T_CLOSE(tmpHid);
   return retv;
 fail:
   Py_XDECREF(retv);
   HLHDF_FREE(dims);
-  HL_H5T_CLOSE(tmpHid);
   return NULL;
 }
 
-static PyObject* _pyhl_node_rawdata(PyhlNode* self, PyObject* args)
+/**
+ * Keywords of the methods returning the data of a node.
+ */
+static char* _pyhl_node_data_kwlist[] = {"copy", NULL};
+
+static PyObject* _pyhl_node_data(PyhlNode* self, PyObject* args, PyObject* kwds)
+{
+  int copy = 1;
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "|i", _pyhl_node_data_kwlist, &copy)) {
+    return NULL;
+  }
+  return _pyhl_node_get_value(self->node, copy);
+}
+
+static PyObject* _pyhl_node_rawdata(PyhlNode* self, PyObject* args, PyObject* kwds)
 {
   PyObject* retv = NULL;
-  hid_t tmpHid = -1;
+  PyhlTypeInfo info;
   size_t typeSize;
   char errbuf[256];
   npy_intp* dims = NULL;
-  int i;
+  int i, copy = 1;
   size_t npts;
 
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "|i", _pyhl_node_data_kwlist, &copy)) {
+    return NULL;
+  }
   if (HLNode_getRawdata(self->node) == NULL) {
     setException(PyExc_AttributeError,"Rawdata has not been read for this node");
     return NULL;
   }
 
-  if (HLNodePrivate_getTypeId(self->node) >= 0) {
-    tmpHid = H5Tcopy(HLNodePrivate_getTypeId(self->node));
-  } else if (HL_isFormatSupported(HLNode_getFormatName(self->node))) {
-    tmpHid = HL_translateFormatStringToDatatype(HLNode_getFormatName(self->node));
-  } else {
+  if (!_pyhl_get_type_info(HLNodePrivate_getTypeId(self->node), HLNode_getFormatName(self->node), &info)) {
     setException(PyExc_AttributeError,"Strange type, can't handle");
     return NULL;
   }
@@ -1363,7 +2052,7 @@ static PyObject* _pyhl_node_rawdata(PyhlNode* self, PyObject* args)
   typeSize = HLNode_getRawdataSize(self->node); /* Using raw type */
 
   if (HLNode_getRank(self->node) == 0) { /*Scalar*/
-    switch (H5Tget_class(tmpHid)) {
+    switch (info.typeClass) {
     case H5T_INTEGER: {
       if (typeSize <= sizeof(char)) {
         char v;
@@ -1389,7 +2078,12 @@ static PyObject* _pyhl_node_rawdata(PyhlNode* self, PyObject* args)
       break;
     }
     case H5T_FLOAT: {
-      if (typeSize <= sizeof(float)) {
+      if (HLNode_getFormat(self->node) == HLHDF_HALF || HLNode_getFormat(self->node) == HLHDF_BFLOAT16) {
+        double v;
+        if (HLNode_getDataAs(self->node, HLHDF_DOUBLE, &v)) {
+          retv = PyFloat_FromDouble(v);
+        }
+      } else if (typeSize <= sizeof(float)) {
         float v;
         memcpy(&v, HLNode_getRawdata(self->node), typeSize);
         retv = PyFloat_FromDouble((double) v);
@@ -1411,7 +2105,7 @@ static PyObject* _pyhl_node_rawdata(PyhlNode* self, PyObject* args)
       break;
     }
     default: {
-      sprintf(errbuf, "Unrecognized class %d", (int) H5Tget_class(tmpHid));
+      sprintf(errbuf, "Unrecognized class %d", (int) info.typeClass);
       setException(PyExc_TypeError,errbuf);
       break;
     }
@@ -1421,28 +2115,18 @@ static PyObject* _pyhl_node_rawdata(PyhlNode* self, PyObject* args)
       setException(PyExc_MemoryError,"Could not allocate dims");
       goto fail;
     }
-    switch (H5Tget_class(tmpHid)) {
+    switch (info.typeClass) {
     case H5T_INTEGER:
     case H5T_FLOAT: {
       int iformat = pyarraytypeFromHdfType(HLNode_getFormatName(self->node));
-      int nbytes;
       if (iformat == -1) {
         sprintf(errbuf, "Unrecognized datatype %s", HLNode_getFormatName(self->node));
         setException(PyExc_TypeError,errbuf);
         goto fail;
       }
-      for (i = 0; i < HLNode_getRank(self->node); i++)
-        dims[i] = (npy_intp) HLNode_getDimension(self->node,i);
-
-      retv = PyArray_SimpleNew(HLNode_getRank(self->node), dims, iformat);
-      if (!retv) {
-        setException(PyExc_MemoryError,"Could not create array");
+      if (!(retv = _pyhl_node_wrap_data(self->node, PyArray_DescrFromType(iformat), 1, copy))) {
         goto fail;
       }
-      nbytes = (int)HLNode_getNumberOfPoints(self->node);
-      nbytes *= ((PyArrayObject*) retv)->descr->elsize;
-      memcpy(((PyArrayObject*) retv)->data,
-             HLNode_getRawdata(self->node), nbytes);
       break;
     }
     case H5T_COMPOUND: {
@@ -1479,24 +2163,110 @@ static PyObject* _pyhl_node_rawdata(PyhlNode* self, PyObject* args)
       break;
     }
     default: {
-      sprintf(errbuf,"Unrecognized class %d",(int)H5Tget_class(tmpHid));
+      sprintf(errbuf,"Unrecognized class %d",(int)info.typeClass);
       setException(PyExc_TypeError,errbuf);
       break;
     }
     }
   }
   HLHDF_FREE(dims);
-  if(tmpHid>=0)
-    H5Tclose(tmpHid);
   return retv;
 fail:
   Py_XDECREF(retv);
   HLHDF_FREE(dims);
-  if(tmpHid>=0)
-    H5Tclose(tmpHid);
   return NULL;
 }
 
+static PyObject* _pyhl_node_data_as(PyhlNode* self, PyObject* args)
+{
+  char* format = NULL;
+  PyObject* retv = NULL;
+  npy_intp dims[NPY_MAXDIMS];
+  int i = 0, rank = 0, iformat = -1;
+
+  if (!PyArg_ParseTuple(args, "s", &format)) {
+    return NULL;
+  }
+  if (!HL_isFormatSupported(format) || (iformat = pyarraytypeFromHdfType(format)) == -1) {
+    raiseException(PyExc_TypeError, "Unsupported format");
+  }
+  if (HLNode_getData(self->node) == NULL) {
+    raiseException(PyExc_AttributeError, "Node has no data");
+  }
+  rank = HLNode_getRank(self->node);
+  if (rank > NPY_MAXDIMS) {
+    raiseException(PyExc_TypeError, "Too many dimensions for a numpy array");
+  }
+  for (i = 0; i < rank; i++) {
+    dims[i] = (npy_intp)HLNode_getDimension(self->node, i);
+  }
+  if ((retv = PyArray_SimpleNew(rank, dims, iformat)) == NULL) {
+    return NULL;
+  }
+  if (!HLNode_getDataAs(self->node, HL_getFormatSpecifier(format), PyArray_DATA((PyArrayObject*)retv))) {
+    Py_DECREF(retv);
+    raiseException(PyExc_TypeError, "Could not convert the data of the node");
+  }
+  return retv;
+}
+
+/**
+ * Creates a dictionary from statistics, see node.statistics().
+ * @param[in] stats the statistics
+ * @return the dictionary or NULL on failure
+ */
+static PyObject* _pyhl_statistics_to_dict(const HL_DataStatistics* stats)
+{
+  PyObject* histogram = NULL;
+  PyObject* retv = NULL;
+  int i = 0;
+
+  if ((histogram = PyList_New(stats->nbins)) == NULL) {
+    return NULL;
+  }
+  for (i = 0; i < stats->nbins; i++) {
+    PyList_SET_ITEM(histogram, i, PyLong_FromUnsignedLongLong(stats->histogram[i]));
+  }
+  retv = Py_BuildValue("{s:K,s:K,s:K,s:K,s:d,s:d,s:d,s:d,s:O}",
+    "count", stats->count,
+    "valid_count", stats->validCount,
+    "nodata_count", stats->nodataCount,
+    "undetect_count", stats->undetectCount,
+    "min", stats->min,
+    "max", stats->max,
+    "sum", stats->sum,
+    "mean", stats->mean,
+    "histogram", histogram);
+  Py_DECREF(histogram);
+  return retv;
+}
+
+static PyObject* _pyhl_node_statistics(PyhlNode* self, PyObject* args)
+{
+  HL_DataStatistics stats;
+
+  if (!HLNode_getStatistics(self->node, &stats)) {
+    Py_RETURN_NONE;
+  }
+  return _pyhl_statistics_to_dict(&stats);
+}
+
+static PyObject* _pyhl_node_convert_data(PyhlNode* self, PyObject* args)
+{
+  char* format = NULL;
+
+  if (!PyArg_ParseTuple(args, "s", &format)) {
+    return NULL;
+  }
+  if (!HL_isFormatSupported(format)) {
+    raiseException(PyExc_TypeError, "Unsupported format");
+  }
+  if (!HLNode_convertData(self->node, HL_getFormatSpecifier(format))) {
+    raiseException(PyExc_TypeError, "Could not convert the data of the node");
+  }
+  Py_RETURN_NONE;
+}
+
 static PyObject* getPythonObjectFromNode(HL_CompoundTypeAttribute* descr,
   const unsigned char* data, int idx)
 {
@@ -1574,114 +2344,844 @@ static PyObject* getPythonObjectFromNode(HL_CompoundTypeAttribute* descr,
   return pyo;
 }
 
-static PyObject* _pyhl_node_get_compound_data(PyhlNode* self, PyObject* args)
+static PyObject* _pyhl_node_get_compound_data(PyhlNode* self, PyObject* args)
+{
+  PyhlTypeInfo info;
+  PyObject* retv = NULL;
+  PyObject *pyo = NULL, *pyo2 = NULL;
+  int i, j;
+  const unsigned char* data;
+  HL_CompoundTypeDescription* descr;
+
+  if (!_pyhl_get_type_info(HLNodePrivate_getTypeId(self->node), HLNode_getFormatName(self->node), &info)) {
+    setException(PyExc_AttributeError,"Strange type, can't handle");
+    return NULL;
+  }
+
+  if (info.typeClass != H5T_COMPOUND) {
+    setException(PyExc_AttributeError,"Only supposed to be used with composite nodes");
+    goto fail;
+  }
+
+  if (HLNode_getRank(self->node) == 0 || (HLNode_getRank(self->node) == 1 && HLNode_getDimension(self->node,0) == 1)) { /*Scalar*/
+    if (!HLNode_getCompoundDescription(self->node)) {
+      setException(PyExc_AttributeError,"Node does not have a compound description");
+      goto fail;
+    }
+    if (!(retv = PyDict_New())) {
+      setException(PyExc_MemoryError,"Could not allocate dicionary\n");
+      goto fail;
+    }
+    data = HLNode_getData(self->node);
+    descr = HLNode_getCompoundDescription(self->node);
+    for (i = 0; i < descr->nAttrs; i++) {
+      pyo = NULL;
+      if (descr->attrs[i]->ndims == 0 || (descr->attrs[i]->ndims == 1 && descr->attrs[i]->dims[0] == 1)) {
+        if (!(pyo = getPythonObjectFromNode(descr->attrs[i], data, 0))) {
+          goto fail;
+        }
+      } else {
+        int ndim = 1;
+        if (!(pyo = PyList_New(0))) {
+          goto fail;
+        }
+        for (j = 0; j < descr->attrs[i]->ndims; j++) {
+          ndim *= descr->attrs[i]->dims[j];
+        }
+        for (j = 0; j < ndim; j++) {
+          if (!(pyo2 = getPythonObjectFromNode(descr->attrs[i], data, j))) {
+            goto fail;
+          }
+          PyList_Append(pyo, pyo2);
+          Py_XDECREF(pyo2);
+          pyo2 = NULL;
+        }
+      }
+
+      if(PyDict_SetItemString(retv,descr->attrs[i]->attrname,pyo)!=0) {
+        goto fail;
+      }
+      Py_XDECREF(pyo);
+      pyo = NULL;
+    }
+  } else {
+    setException(PyExc_AttributeError,"Method does not support arrays of compound objects yet.");
+    goto fail;
+  }
+  Py_XDECREF(pyo);
+  Py_XDECREF(pyo2);
+  return retv;
+fail:
+  Py_XDECREF(retv);
+  Py_XDECREF(pyo);
+  Py_XDECREF(pyo2);
+  return NULL;
+}
+
+static PyObject* _pyhl_node_get_compound_type(PyhlNode* self, PyObject* args)
+{
+  PyObject* retv = NULL;
+  PyhlTypeInfo info;
+
+  if (HLNodePrivate_getTypeId(self->node) < 0 ||
+      !_pyhl_get_type_info(HLNodePrivate_getTypeId(self->node), NULL, &info) ||
+      info.typeClass != H5T_COMPOUND) {
+    setException(PyExc_AttributeError, "This is not a compound type");
+    goto fail;
+  }
+
+  if (info.committed) {
+    if (HLNode_getCompoundDescription(self->node) == NULL) {
+      setException(PyExc_AttributeError,"Node does not have a compound description");
+      goto fail;
+    }
+    retv = PyString_FromString(HLNode_getCompoundDescription(self->node)->hltypename);
+  } else {
+    Py_INCREF(Py_None);
+    retv = Py_None; // So that we can return retv
+  }
+
+fail:
+  return retv;
+}
+
+/**
+ * Creates the numpy type string for a member in a compound type, e.g. "=i4" or "S10".
+ * @param[in] attr the compound member
+ * @param[out] buf the type string
+ * @param[in] buflen the length of buf
+ * @return 1 on success, 0 if the format not is supported
+ */
+static int _pyhl_compound_member_dtype(HL_CompoundTypeAttribute* attr, char* buf, size_t buflen)
+{
+  const char* fmt = attr->format;
+  char kind = 0;
+  if (strcmp(fmt, "string") == 0 || strcmp(fmt, "char") == 0) {
+    snprintf(buf, buflen, "S%lu", (unsigned long)attr->size);
+    return 1;
+  } else if (strcmp(fmt, "schar") == 0 || strcmp(fmt, "short") == 0 || strcmp(fmt, "int") == 0 ||
+             strcmp(fmt, "long") == 0 || strcmp(fmt, "llong") == 0 || strcmp(fmt, "hssize") == 0 ||
+             strcmp(fmt, "herr") == 0) {
+    kind = 'i';
+  } else if (strcmp(fmt, "uchar") == 0 || strcmp(fmt, "ushort") == 0 || strcmp(fmt, "uint") == 0 ||
+             strcmp(fmt, "ulong") == 0 || strcmp(fmt, "ullong") == 0 || strcmp(fmt, "hsize") == 0 ||
+             strcmp(fmt, "hbool") == 0) {
+    kind = 'u';
+  } else if (strcmp(fmt, "float") == 0 || strcmp(fmt, "double") == 0 || strcmp(fmt, "ldouble") == 0 ||
+             strcmp(fmt, "half") == 0) {
+    kind = 'f';
+  } else {
+    return 0;
+  }
+  snprintf(buf, buflen, "=%c%lu", kind, (unsigned long)attr->size);
+  return 1;
+}
+
+/**
+ * Creates a numpy structured type from a compound type description.
+ * @param[in] descr the compound type description
+ * @param[in] itemsize the size of one item
+ * @return the numpy type or NULL on failure
+ */
+static PyArray_Descr* _pyhl_compound_description_to_dtype(HL_CompoundTypeDescription* descr, size_t itemsize)
+{
+  PyObject *dict = NULL, *names = NULL, *formats = NULL, *offsets = NULL, *pyo = NULL;
+  PyArray_Descr* retv = NULL;
+  char typestr[32];
+  int i = 0, j = 0;
+
+  names = PyList_New(0);
+  formats = PyList_New(0);
+  offsets = PyList_New(0);
+  dict = PyDict_New();
+  if (names == NULL || formats == NULL || offsets == NULL || dict == NULL) {
+    goto fail;
+  }
+  for (i = 0; i < descr->nAttrs; i++) {
+    HL_CompoundTypeAttribute* attr = descr->attrs[i];
+    if (!_pyhl_compound_member_dtype(attr, typestr, sizeof(typestr))) {
+      char errmsg[300];
+      sprintf(errmsg, "Unsupported compound member type '%s'", attr->format);
+      setException(PyExc_TypeError, errmsg);
+      goto fail;
+    }
+    if (attr->ndims == 0 || (attr->ndims == 1 && attr->dims[0] == 1)) {
+      pyo = PyString_FromString(typestr);
+    } else {
+      PyObject* shape = PyTuple_New(attr->ndims);
+      for (j = 0; shape != NULL && j < attr->ndims; j++) {
+        PyTuple_SET_ITEM(shape, j, PyInt_FromLong((long)attr->dims[j]));
+      }
+      pyo = (shape != NULL) ? Py_BuildValue("(sN)", typestr, shape) : NULL;
+    }
+    if (pyo == NULL || PyList_Append(formats, pyo) < 0) {
+      goto fail;
+    }
+    Py_DECREF(pyo);
+    if ((pyo = PyString_FromString(attr->attrname)) == NULL || PyList_Append(names, pyo) < 0) {
+      goto fail;
+    }
+    Py_DECREF(pyo);
+    if ((pyo = PyInt_FromLong((long)attr->offset)) == NULL || PyList_Append(offsets, pyo) < 0) {
+      goto fail;
+    }
+    Py_DECREF(pyo);
+    pyo = NULL;
+  }
+  if ((pyo = PyInt_FromLong((long)itemsize)) == NULL ||
+      PyDict_SetItemString(dict, "names", names) < 0 ||
+      PyDict_SetItemString(dict, "formats", formats) < 0 ||
+      PyDict_SetItemString(dict, "offsets", offsets) < 0 ||
+      PyDict_SetItemString(dict, "itemsize", pyo) < 0) {
+    goto fail;
+  }
+  if (!PyArray_DescrConverter(dict, &retv)) {
+    retv = NULL;
+  }
+fail:
+  Py_XDECREF(pyo);
+  Py_XDECREF(names);
+  Py_XDECREF(formats);
+  Py_XDECREF(offsets);
+  Py_XDECREF(dict);
+  return retv;
+}
+
+static PyObject* _pyhl_node_get_compound_array(PyhlNode* self, PyObject* args, PyObject* kwds)
+{
+  HL_CompoundTypeDescription* descr = NULL;
+  PyhlTypeInfo info;
+  int copy = 1;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "|i", _pyhl_node_data_kwlist, &copy)) {
+    return NULL;
+  }
+  if (!self->node) {
+    setException(PyExc_AttributeError,"The responsibility of the node has been dropped, probably by doing a addNode");
+    return NULL;
+  }
+  if (!_pyhl_get_type_info(HLNodePrivate_getTypeId(self->node), HLNode_getFormatName(self->node), &info) ||
+      info.typeClass != H5T_COMPOUND) {
+    raiseException(PyExc_AttributeError, "Only supposed to be used with composite nodes");
+  }
+  if ((descr = HLNode_getCompoundDescription(self->node)) == NULL) {
+    raiseException(PyExc_AttributeError, "Node does not have a compound description");
+  }
+  return _pyhl_node_wrap_data(self->node, _pyhl_compound_description_to_dtype(descr, HLNode_getDataSize(self->node)), 0, copy);
+}
+
+/**
+ * Translates a numpy type to a HLHDF format specifier.
+ * @param[in] dtype the numpy type
+ * @return the format or NULL if not supported
+ */
+static const char* _pyhl_dtype_to_format(PyArray_Descr* dtype)
+{
+  if (dtype->byteorder == '>' || (dtype->byteorder == '<' && dtype->elsize > 1 && !PyArray_ISNBO('<'))) {
+    return NULL;
+  }
+  switch (dtype->kind) {
+  case 'b':
+    return (dtype->elsize == 1) ? "uchar" : NULL;
+  case 'i':
+    return (dtype->elsize == 1) ? "schar" : (dtype->elsize == 2) ? "short" : (dtype->elsize == 4) ? "int" : (dtype->elsize == 8) ? "llong" : NULL;
+  case 'u':
+    return (dtype->elsize == 1) ? "uchar" : (dtype->elsize == 2) ? "ushort" : (dtype->elsize == 4) ? "uint" : (dtype->elsize == 8) ? "ullong" : NULL;
+  case 'f':
+    return (dtype->elsize == 2) ? "half" : (dtype->elsize == 4) ? "float" : (dtype->elsize == 8) ? "double" : (dtype->elsize == sizeof(long double)) ? "ldouble" : NULL;
+  case 'S':
+    return "string";
+  default:
+    return NULL;
+  }
+}
+
+/**
+ * Creates a HDF5 compound type and the corresponding compound description from a
+ * numpy structured type.
+ * @param[in] dtype the numpy type
+ * @param[out] outdescr the compound description
+ * @return the compound type or -1 on failure
+ */
+static hid_t _pyhl_dtype_to_compound_type(PyArray_Descr* dtype, HL_CompoundTypeDescription** outdescr)
+{
+  HL_CompoundTypeDescription* descr = NULL;
+  hid_t type = -1;
+  Py_ssize_t i = 0, nfields = 0;
+  char errmsg[300];
+
+  if (dtype->names == NULL || (nfields = PyTuple_Size(dtype->names)) <= 0) {
+    setException(PyExc_TypeError, "Compound data must be a structured array");
+    return -1;
+  }
+  if ((descr = newHL_CompoundTypeDescription()) == NULL || (type = createCompoundType(dtype->elsize)) < 0) {
+    setException(PyExc_MemoryError, "Could not create compound type");
+    goto fail;
+  }
+  descr->size = dtype->elsize;
+  for (i = 0; i < nfields; i++) {
+    PyObject* name = PyTuple_GET_ITEM(dtype->names, i);
+    PyObject* field = PyDict_GetItem(dtype->fields, name);
+    PyArray_Descr* fdtype = NULL;
+    PyArray_Descr* base = NULL;
+    const char* fmt = NULL;
+    const char* fname = PyString_AsString(name);
+    size_t offset = 0, dims[4] = {1, 1, 1, 1};
+    int ndims = 0, j = 0;
+    herr_t status = -1;
+    HL_CompoundTypeAttribute* attr = NULL;
+
+    if (field == NULL || fname == NULL || !PyArg_ParseTuple(field, "On|O", &fdtype, &offset, &name)) {
+      goto fail;
+    }
+    base = fdtype;
+    if (fdtype->subarray != NULL) {
+      PyObject* shape = fdtype->subarray->shape;
+      base = fdtype->subarray->base;
+      ndims = PyTuple_Check(shape) ? (int)PyTuple_Size(shape) : 1;
+      if (ndims > 4) {
+        setException(PyExc_TypeError, "Compound members may have at most 4 dimensions");
+        goto fail;
+      }
+      for (j = 0; j < ndims; j++) {
+        dims[j] = (size_t)PyInt_AsLong(PyTuple_Check(shape) ? PyTuple_GET_ITEM(shape, j) : shape);
+      }
+    }
+    if ((fmt = _pyhl_dtype_to_format(base)) == NULL) {
+      sprintf(errmsg, "Unsupported type for compound member '%s'", fname);
+      setException(PyExc_TypeError, errmsg);
+      goto fail;
+    }
+    if (strcmp(fmt, "string") == 0) {
+      hid_t strtype = -1;
+      HL_lockHdf5();
+      if ((strtype = H5Tcopy(H5T_C_S1)) >= 0 && H5Tset_size(strtype, base->elsize) >= 0) {
+        status = (ndims > 0) ? addArrayToCompoundType(type, fname, offset, ndims, dims, strtype)
+                             : addAttributeToCompoundType(type, fname, offset, strtype);
+      }
+      HL_H5T_CLOSE(strtype);
+      HL_unlockHdf5();
+    } else if (ndims > 0) {
+      status = addArrayToCompoundType_fmt(type, fname, offset, ndims, dims, fmt);
+    } else {
+      status = addAttributeToCompoundType_fmt(type, fname, offset, fmt);
+    }
+    if (status < 0 ||
+        (attr = newHL_CompoundTypeAttribute((char*)fname, offset, fmt, base->elsize, ndims, dims)) == NULL) {
+      sprintf(errmsg, "Could not add compound member '%s'", fname);
+      setException(PyExc_TypeError, errmsg);
+      goto fail;
+    }
+    if (!addHL_CompoundTypeAttribute(descr, attr)) {
+      freeHL_CompoundTypeAttribute(attr);
+      setException(PyExc_MemoryError, "Could not add compound member to description");
+      goto fail;
+    }
+  }
+  *outdescr = descr;
+  return type;
+fail:
+  freeHL_CompoundTypeDescription(descr);
+  if (type >= 0) {
+    HL_lockHdf5();
+    HL_H5T_CLOSE(type);
+    HL_unlockHdf5();
+  }
+  return -1;
+}
+
+static PyObject* _pyhl_node_set_compound_array_value(PyhlNode* self, PyObject* args)
+{
+  PyObject* data = NULL;
+  PyArrayObject* array = NULL;
+  PyhlBufferOwner* owner = NULL;
+  HL_CompoundTypeDescription* descr = NULL;
+  hid_t type = -1;
+  hsize_t dims[H5S_MAX_RANK];
+  int i = 0, ndim = 0, status = 0;
+
+  if (!PyArg_ParseTuple(args, "O", &data)) {
+    return NULL;
+  }
+  if (!self->node) {
+    raiseException(PyExc_AttributeError,"The responsibility of the node has been dropped, probably by doing a addNode");
+  }
+  if ((array = (PyArrayObject*)PyArray_FROM_OF(data, NPY_ARRAY_C_CONTIGUOUS)) == NULL) {
+    return NULL;
+  }
+  if (PyArray_DESCR(array)->names == NULL) {
+    Py_DECREF(array);
+    raiseException(PyExc_TypeError, "Compound data must be a structured array");
+  }
+  if ((ndim = PyArray_NDIM(array)) > H5S_MAX_RANK) {
+    setException(PyExc_ValueError, "Not more than 32 dimensions are allowed");
+    goto fail;
+  }
+  if ((type = _pyhl_dtype_to_compound_type(PyArray_DESCR(array), &descr)) < 0) {
+    goto fail;
+  }
+  if (ndim == 0) {
+    status = HLNode_setScalarValue(self->node, PyArray_ITEMSIZE(array), (unsigned char*)PyArray_DATA(array), "compound", type);
+  } else {
+    for (i = 0; i < ndim; i++) {
+      dims[i] = (hsize_t)PyArray_DIM(array, i);
+    }
+    if (!(owner = HLHDF_MALLOC(sizeof(PyhlBufferOwner)))) {
+      setException(PyExc_MemoryError, "Could not allocate buffer view");
+      goto fail;
+    }
+    if (PyObject_GetBuffer((PyObject*)array, &owner->view, PyBUF_C_CONTIGUOUS) < 0) {
+      HLHDF_FREE(owner);
+      goto fail;
+    }
+    status = HLNode_setExternalArrayValue(self->node, PyArray_ITEMSIZE(array), ndim, dims, (unsigned char*)owner->view.buf,
+                                          owner, _pyhl_release_buffer, "compound", type);
+  }
+  if (!status) {
+    setException(PyExc_AttributeError, "Could not set compound data");
+    goto fail;
+  }
+  HLNode_setCompoundDescription(self->node, descr);
+  descr = NULL;
+fail:
+  freeHL_CompoundTypeDescription(descr);
+  if (type >= 0) {
+    HL_lockHdf5();
+    HL_H5T_CLOSE(type);
+    HL_unlockHdf5();
+  }
+  Py_XDECREF(array);
+  if (!status) {
+    return NULL;
+  }
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+/* PyhlNodelist bulk access */
+/**
+ * Returns the values of all nodes of the specified type whose name starts with prefix.
+ * Nodes that have not been fetched are fetched in one go before the values are decoded.
+ * @param[in] self the nodelist
+ * @param[in] args (prefix=None)
+ * @param[in] type ATTRIBUTE_ID or DATASET_ID
+ * @return a dictionary with {name: value} or NULL on failure
+ */
+static PyObject* _pyhl_get_node_values(PyhlNodelist* self, PyObject* args, HL_Type type)
+{
+  PyObject* retv = NULL;
+  PyObject* pyo = NULL;
+  HL_NodeMark* marks = NULL;
+  char* prefix = NULL;
+  size_t prefixlen = 0;
+  int i = 0, nNodes = 0, nSelected = 0, fetched = 1;
+
+  if (!PyArg_ParseTuple(args, "|z", &prefix)) {
+    return NULL;
+  }
+  prefixlen = (prefix != NULL) ? strlen(prefix) : 0;
+
+  if ((nNodes = HLNodeList_getNumberOfNodes(self->nodelist)) < 0) {
+    raiseException(PyExc_IOError, "Could not read number of nodes");
+  }
+  if (nNodes > 0 && (marks = HLHDF_MALLOC(sizeof(HL_NodeMark) * nNodes)) == NULL) {
+    raiseException(PyExc_MemoryError, "Could not allocate node marks");
+  }
+  /* Only the requested nodes are fetched, other nodes that are marked for fetching
+     are unmarked during the fetch and get their marks back afterwards */
+  for (i = 0; i < nNodes; i++) {
+    HL_Node* node = HLNodeList_getNodeByIndex(self->nodelist, i);
+    HL_NodeMark mark = HLNode_getMark(node);
+    marks[i] = NMARK_UNDEFINED;
+    if (HLNode_getType(node) == type && !HLNode_fetched(node) &&
+        (mark == NMARK_ORIGINAL || mark == NMARK_SELECT || mark == NMARK_SELECTMETA) &&
+        strncmp(HLNode_getName(node), prefix != NULL ? prefix : "", prefixlen) == 0) {
+      HLNode_setMark(node, NMARK_SELECT);
+      nSelected++;
+    } else if (mark == NMARK_SELECT || mark == NMARK_SELECTMETA) {
+      marks[i] = mark;
+      HLNode_setMark(node, NMARK_ORIGINAL);
+    }
+  }
+  if (nSelected > 0) {
+    PYHL_BEGIN_NODELIST_IO(self)
+    fetched = HLNodeList_fetchMarkedNodes(self->nodelist);
+    PYHL_END_NODELIST_IO(self)
+  }
+  for (i = 0; i < nNodes; i++) {
+    if (marks[i] != NMARK_UNDEFINED) {
+      HLNode_setMark(HLNodeList_getNodeByIndex(self->nodelist, i), marks[i]);
+    }
+  }
+  HLHDF_FREE(marks);
+  if (!fetched) {
+    raiseException(PyExc_IOError, "Could not fetch nodes");
+  }
+
+  if (!(retv = PyDict_New())) {
+    raiseException(PyExc_MemoryError, "Could not allocate dictionary");
+  }
+  for (i = 0; i < nNodes; i++) {
+    HL_Node* node = HLNodeList_getNodeByIndex(self->nodelist, i);
+    if (HLNode_getType(node) != type || HLNode_getData(node) == NULL ||
+        strncmp(HLNode_getName(node), prefix != NULL ? prefix : "", prefixlen) != 0) {
+      continue;
+    }
+    if ((pyo = _pyhl_node_get_value(node, 1)) == NULL) {
+      goto fail;
+    }
+    if (PyDict_SetItemString(retv, HLNode_getName(node), pyo) == -1) {
+      setException(PyExc_AttributeError,"Failed to set dictionary item");
+      goto fail;
+    }
+    Py_DECREF(pyo);
+    pyo = NULL;
+  }
+  return retv;
+fail:
+  Py_XDECREF(pyo);
+  Py_XDECREF(retv);
+  return NULL;
+}
+
+static PyObject* _pyhl_get_attributes(PyhlNodelist* self, PyObject* args)
+{
+  return _pyhl_get_node_values(self, args, ATTRIBUTE_ID);
+}
+
+static PyObject* _pyhl_get_datasets(PyhlNodelist* self, PyObject* args)
 {
-  hid_t tmpHid = -1;
+  return _pyhl_get_node_values(self, args, DATASET_ID);
+}
+
+/**
+ * A dataset that should be read into an array provided by the caller.
+ */
+typedef struct {
+  const char* name;        /**< the dataset name */
+  const char* format;      /**< the format of the array */
+  PyhlBufferOwner* owner;  /**< the buffer view of the array */
+} PyhlFetchTarget;
+
+static PyObject* _pyhl_fetch_arrays(PyhlNodelist* self, PyObject* args)
+{
+  PyObject* names = NULL;
+  PyObject* out = NULL;
+  PyObject* seq = NULL;
   PyObject* retv = NULL;
-  PyObject *pyo = NULL, *pyo2 = NULL;
-  int i, j;
-  const unsigned char* data;
-  HL_CompoundTypeDescription* descr;
+  PyObject* pyo = NULL;
+  PyhlFetchTarget* targets = NULL;
+  Py_ssize_t i = 0, n = 0, ntargets = 0, nSelected = 0;
+  const char* failedName = NULL;
+  int fetched = 1;
+  char errbuf[512];
 
-  if (HLNodePrivate_getTypeId(self->node) >= 0) {
-    tmpHid = H5Tcopy(HLNodePrivate_getTypeId(self->node));
-  } else if (HL_isFormatSupported(HLNode_getFormatName(self->node))) {
-    tmpHid = HL_translateFormatStringToDatatype(HLNode_getFormatName(self->node));
-  } else {
-    setException(PyExc_AttributeError,"Strange type, can't handle");
+  if (!PyArg_ParseTuple(args, "O|O", &names, &out)) {
     return NULL;
   }
-
-  if (H5Tget_class(tmpHid) != H5T_COMPOUND) {
-    setException(PyExc_AttributeError,"Only supposed to be used with composite nodes");
+  if (out == Py_None) {
+    out = NULL;
+  }
+  if (out != NULL && !PyDict_Check(out)) {
+    raiseException(PyExc_TypeError, "out must be a dictionary {name: array}");
+  }
+  if ((seq = PySequence_Fast(names, "names must be a sequence of node names")) == NULL) {
+    return NULL;
+  }
+  n = PySequence_Fast_GET_SIZE(seq);
+  if (n > 0 && (targets = HLHDF_MALLOC(sizeof(PyhlFetchTarget) * n)) == NULL) {
+    setException(PyExc_MemoryError, "Could not allocate fetch targets");
     goto fail;
   }
 
-  if (HLNode_getRank(self->node) == 0 || (HLNode_getRank(self->node) == 1 && HLNode_getDimension(self->node,0) == 1)) { /*Scalar*/
-    if (!HLNode_getCompoundDescription(self->node)) {
-      setException(PyExc_AttributeError,"Node does not have a compound description");
+  /* Datasets with an out array are read directly into it, the rest are selected and fetched in one go */
+  for (i = 0; i < n; i++) {
+    PyObject* name = PySequence_Fast_GET_ITEM(seq, i);
+    PyObject* array = NULL;
+    const char* cname = PyString_AsString(name);
+    HL_Node* node = NULL;
+    if (cname == NULL) {
       goto fail;
     }
-    if (!(retv = PyDict_New())) {
-      setException(PyExc_MemoryError,"Could not allocate dicionary\n");
+    if ((node = HLNodeList_getNodeByName(self->nodelist, cname)) == NULL || HLNode_getType(node) != DATASET_ID) {
+      snprintf(errbuf, sizeof(errbuf), "No dataset called '%s'", cname);
+      setException(PyExc_AttributeError, errbuf);
       goto fail;
     }
-    data = HLNode_getData(self->node);
-    descr = HLNode_getCompoundDescription(self->node);
-    for (i = 0; i < descr->nAttrs; i++) {
-      pyo = NULL;
-      if (descr->attrs[i]->ndims == 0 || (descr->attrs[i]->ndims == 1 && descr->attrs[i]->dims[0] == 1)) {
-        if (!(pyo = getPythonObjectFromNode(descr->attrs[i], data, 0))) {
-          goto fail;
-        }
-      } else {
-        int ndim = 1;
-        if (!(pyo = PyList_New(0))) {
-          goto fail;
-        }
-        for (j = 0; j < descr->attrs[i]->ndims; j++) {
-          ndim *= descr->attrs[i]->dims[j];
-        }
-        for (j = 0; j < ndim; j++) {
-          if (!(pyo2 = getPythonObjectFromNode(descr->attrs[i], data, j))) {
-            goto fail;
-          }
-          PyList_Append(pyo, pyo2);
-          Py_XDECREF(pyo2);
-          pyo2 = NULL;
-        }
+    if (out != NULL && (array = PyDict_GetItem(out, name)) != NULL) {
+      PyhlFetchTarget* target = &targets[ntargets];
+      if (!PyArray_Check(array) || (target->format = _pyhl_dtype_to_format(PyArray_DESCR((PyArrayObject*)array))) == NULL ||
+          strcmp(target->format, "string") == 0) {
+        snprintf(errbuf, sizeof(errbuf), "out array for '%s' must be a numeric numpy array in native byte order", cname);
+        setException(PyExc_TypeError, errbuf);
+        goto fail;
       }
-
-      if(PyDict_SetItemString(retv,descr->attrs[i]->attrname,pyo)!=0) {
+      if (!(target->owner = HLHDF_MALLOC(sizeof(PyhlBufferOwner)))) {
+        setException(PyExc_MemoryError, "Could not allocate buffer view");
         goto fail;
       }
-      Py_XDECREF(pyo);
-      pyo = NULL;
+      if (PyObject_GetBuffer(array, &target->owner->view, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) < 0) {
+        HLHDF_FREE(target->owner);
+        goto fail;
+      }
+      target->name = cname;
+      ntargets++;
+    } else {
+      HLNode_setMark(node, NMARK_SELECT);
+      nSelected++;
+    }
+  }
+
+  PYHL_BEGIN_NODELIST_IO(self)
+  if (nSelected > 0) {
+    fetched = HLNodeList_fetchMarkedNodes(self->nodelist);
+  }
+  for (i = 0; fetched && i < ntargets; i++) {
+    PyhlFetchTarget* target = &targets[i];
+    PyhlBufferOwner* owner = target->owner;
+    target->owner = NULL; /* Released by the node or on failure */
+    if (HLNodeList_fetchNodeInto(self->nodelist, target->name, target->format, (unsigned char*)owner->view.buf,
+                                 (size_t)owner->view.len, owner, _pyhl_release_buffer) == NULL) {
+      failedName = target->name;
+      fetched = 0;
+    }
+  }
+  PYHL_END_NODELIST_IO(self)
+
+  if (!fetched) {
+    if (failedName != NULL) {
+      snprintf(errbuf, sizeof(errbuf), "Could not fetch '%s' into out array, does the size match?", failedName);
+      setException(PyExc_IOError, errbuf);
+    } else {
+      setException(PyExc_IOError, "Could not fetch selected nodes");
     }
-  } else {
-    setException(PyExc_AttributeError,"Method does not support arrays of compound objects yet.");
     goto fail;
   }
-  Py_XDECREF(pyo);
-  Py_XDECREF(pyo2);
-  HL_H5T_CLOSE(tmpHid);
+
+  if (!(retv = PyDict_New())) {
+    setException(PyExc_MemoryError, "Could not allocate dictionary");
+    goto fail;
+  }
+  for (i = 0; i < n; i++) {
+    PyObject* name = PySequence_Fast_GET_ITEM(seq, i);
+    if (out != NULL && (pyo = PyDict_GetItem(out, name)) != NULL) {
+      Py_INCREF(pyo);
+    } else if ((pyo = _pyhl_node_get_value(HLNodeList_getNodeByName(self->nodelist, PyString_AsString(name)), 1)) == NULL) {
+      goto fail;
+    }
+    if (PyDict_SetItem(retv, name, pyo) < 0) {
+      goto fail;
+    }
+    Py_DECREF(pyo);
+    pyo = NULL;
+  }
+  HLHDF_FREE(targets);
+  Py_DECREF(seq);
   return retv;
 fail:
-  Py_XDECREF(retv);
+  for (i = 0; targets != NULL && i < ntargets; i++) {
+    if (targets[i].owner != NULL) {
+      _pyhl_release_buffer(targets[i].owner);
+    }
+  }
+  HLHDF_FREE(targets);
   Py_XDECREF(pyo);
-  Py_XDECREF(pyo2);
-  HL_H5T_CLOSE(tmpHid);
+  Py_XDECREF(retv);
+  Py_XDECREF(seq);
   return NULL;
 }
 
-static PyObject* _pyhl_node_get_compound_type(PyhlNode* self, PyObject* args)
+static PyObject* _pyhl_fetch_decoded(PyhlNodelist* self, PyObject* args)
 {
-  PyObject* retv = NULL;
+  char* nodename = NULL;
+  char* format = "double";
+  double nodata = Py_NAN, undetect = Py_NAN;
+  HL_FormatSpecifier specifier = HLHDF_UNDEFINED;
+  HL_Node* node = NULL;
+  HL_NodeBuffer* buffer = NULL;
+  npy_intp dims[NPY_MAXDIMS];
+  int i = 0, rank = 0;
+  char errbuf[256];
 
-  if (HLNodePrivate_getTypeId(self->node) < 0 ||
-      H5Tget_class(HLNodePrivate_getTypeId(self->node)) != H5T_COMPOUND) {
-    setException(PyExc_AttributeError, "This is not a compound type");
-    goto fail;
+  if (!PyArg_ParseTuple(args, "s|sdd", &nodename, &format, &nodata, &undetect)) {
+    return NULL;
+  }
+  specifier = HL_getFormatSpecifier(format);
+  if (specifier != HLHDF_FLOAT && specifier != HLHDF_DOUBLE) {
+    raiseException(PyExc_TypeError, "format must be 'float' or 'double'");
+  }
+  if ((node = HLNodeList_getNodeByName(self->nodelist, nodename)) == NULL || HLNode_getType(node) != DATASET_ID) {
+    snprintf(errbuf, sizeof(errbuf), "No dataset called '%s'", nodename);
+    raiseException(PyExc_AttributeError, errbuf);
   }
 
-  if (H5Tcommitted(HLNodePrivate_getTypeId(self->node)) > 0) {
-    if (HLNode_getCompoundDescription(self->node) == NULL) {
-      setException(PyExc_AttributeError,"Node does not have a compound description");
-      goto fail;
+  PYHL_BEGIN_NODELIST_IO(self)
+  node = HLNodeList_fetchDecoded(self->nodelist, nodename, specifier, nodata, undetect);
+  PYHL_END_NODELIST_IO(self)
+
+  if (node == NULL) {
+    snprintf(errbuf, sizeof(errbuf), "Could not decode '%s'", nodename);
+    raiseException(PyExc_IOError, errbuf);
+  }
+  /* Nobody else refers to the decoded data so the array can be writable without copying it */
+  if ((buffer = HLNodePrivate_refDataBuffer(node, 0)) == NULL) {
+    HLNode_free(node);
+    raiseException(PyExc_IOError, "Decoded dataset has no data");
+  }
+  rank = HLNode_getRank(node);
+  for (i = 0; i < rank && i < NPY_MAXDIMS; i++) {
+    dims[i] = (npy_intp)HLNode_getDimension(node, i);
+  }
+  HLNode_free(node);
+  return _pyhl_wrap_buffer(buffer, PyArray_DescrFromType(pyarraytypeFromHdfType(format)), rank, dims, 0);
+}
+
+static PyObject* _pyhl_fetch_stored_statistics(PyhlNodelist* self, PyObject* args)
+{
+  char* nodename = NULL;
+  HL_DataStatistics stats;
+  int found = 0;
+
+  if (!PyArg_ParseTuple(args, "s", &nodename)) {
+    return NULL;
+  }
+
+  PYHL_BEGIN_NODELIST_IO(self)
+  found = HLNodeList_fetchStoredStatistics(self->nodelist, nodename, &stats);
+  PYHL_END_NODELIST_IO(self)
+
+  if (!found) {
+    Py_RETURN_NONE;
+  }
+  return _pyhl_statistics_to_dict(&stats);
+}
+
+/**
+ * Converts a region given as a sequence of integers, see may_contain_values().
+ * @param[in] obj the sequence or None
+ * @param[out] region the region
+ * @param[out] n the number of dimensions in the region
+ * @return 1 on success, 0 on failure with the exception set
+ */
+static int _pyhl_region_from_object(PyObject* obj, hsize_t region[H5S_MAX_RANK], int* n)
+{
+  PyObject* seq = NULL;
+  Py_ssize_t i = 0;
+
+  if ((seq = PySequence_Fast(obj, "region must be a sequence of integers")) == NULL) {
+    return 0;
+  }
+  if (PySequence_Fast_GET_SIZE(seq) > H5S_MAX_RANK) {
+    Py_DECREF(seq);
+    setException(PyExc_ValueError, "region has too many dimensions");
+    return 0;
+  }
+  *n = (int)PySequence_Fast_GET_SIZE(seq);
+  for (i = 0; i < *n; i++) {
+    long long v = PyLong_AsLongLong(PySequence_Fast_GET_ITEM(seq, i));
+    if (v < 0) {
+      Py_DECREF(seq);
+      if (!PyErr_Occurred()) {
+        setException(PyExc_ValueError, "region may not be negative");
+      }
+      return 0;
     }
-    retv = PyString_FromString(HLNode_getCompoundDescription(self->node)->hltypename);
-  } else {
-    Py_INCREF(Py_None);
-    retv = Py_None; // So that we can return retv
+    region[i] = (hsize_t)v;
+  }
+  Py_DECREF(seq);
+  return 1;
+}
+
+static PyObject* _pyhl_may_contain_values(PyhlNodelist* self, PyObject* args)
+{
+  char* nodename = NULL;
+  double low = 0.0, high = 0.0;
+  PyObject* pystart = Py_None;
+  PyObject* pycount = Py_None;
+  hsize_t start[H5S_MAX_RANK], count[H5S_MAX_RANK];
+  int nstart = 0, ncount = 0, result = 0;
+  HL_Node* node = NULL;
+  char errbuf[256];
+
+  if (!PyArg_ParseTuple(args, "sdd|OO", &nodename, &low, &high, &pystart, &pycount)) {
+    return NULL;
+  }
+  if ((pystart == Py_None) != (pycount == Py_None)) {
+    raiseException(PyExc_ValueError, "start and count must be given together");
+  }
+  if (pystart != Py_None) {
+    if (!_pyhl_region_from_object(pystart, start, &nstart) || !_pyhl_region_from_object(pycount, count, &ncount)) {
+      return NULL;
+    }
+  }
+  if ((node = HLNodeList_getNodeByName(self->nodelist, nodename)) == NULL || HLNode_getType(node) != DATASET_ID) {
+    snprintf(errbuf, sizeof(errbuf), "No dataset called '%s'", nodename);
+    raiseException(PyExc_AttributeError, errbuf);
   }
+  if (nstart != ncount) {
+    raiseException(PyExc_ValueError, "start and count must have the same length");
+  }
+
+  PYHL_BEGIN_NODELIST_IO(self)
+  result = HLNodeList_mayContainValues(self->nodelist, nodename, nstart,
+    (pystart != Py_None) ? start : NULL, (pycount != Py_None) ? count : NULL, low, high);
+  PYHL_END_NODELIST_IO(self)
+
+  if (result < 0) {
+    snprintf(errbuf, sizeof(errbuf), "Could not check the values of '%s'", nodename);
+    raiseException(PyExc_IOError, errbuf);
+  }
+  return PyBool_FromLong(result);
+}
+
+static PyObject* _pyhl_prefetch(PyhlNodelist* self, PyObject* args)
+{
+  PyObject* names = NULL;
+  PyObject* seq = NULL;
+  const char** cnames = NULL;
+  Py_ssize_t i = 0, n = 0;
+  char errbuf[512];
 
+  if (!PyArg_ParseTuple(args, "O", &names)) {
+    return NULL;
+  }
+  if ((seq = PySequence_Fast(names, "names must be a sequence of node names")) == NULL) {
+    return NULL;
+  }
+  n = PySequence_Fast_GET_SIZE(seq);
+  if (n > 0 && (cnames = HLHDF_MALLOC(sizeof(const char*) * n)) == NULL) {
+    setException(PyExc_MemoryError, "Could not allocate names");
+    goto fail;
+  }
+  for (i = 0; i < n; i++) {
+    if ((cnames[i] = PyString_AsString(PySequence_Fast_GET_ITEM(seq, i))) == NULL) {
+      goto fail;
+    }
+    if (!HLNodeList_hasNodeByName(self->nodelist, cnames[i])) {
+      snprintf(errbuf, sizeof(errbuf), "No node called '%s'", cnames[i]);
+      setException(PyExc_AttributeError, errbuf);
+      goto fail;
+    }
+  }
+  if (!HLNodeList_prefetch(self->nodelist, cnames, (int)n)) {
+    setException(PyExc_IOError, "Could not start prefetch");
+    goto fail;
+  }
+  HLHDF_FREE(cnames);
+  Py_DECREF(seq);
+  Py_RETURN_NONE;
 fail:
-  return retv;
+  HLHDF_FREE(cnames);
+  Py_XDECREF(seq);
+  return NULL;
 }
 
 /**
  * @addtogroup pyhl_api
  * \section _pyhl_nodelist_interfaces _pyhl nodelist interfaces
+ * The functions write, update, fetch and fetchNode as well as read_nodelist releases the
+ * GIL while doing I/O so other Python threads can run in the meantime. A nodelist can not be
+ * used by other threads while it is doing I/O, RuntimeError is raised if that is attempted.
 \verbatim
 Function: addNode(node)
   Adds the provided node to the node list
@@ -1703,6 +3203,19 @@ Parameters:
 Returns:
   N/A.
 
+Function: write_async(filename, compression=None)
+  Same as write but the file is written by the HLHDF I/O thread. The nodelist can not be
+  used until the operation has finished.
+Returns:
+  A concurrent.futures.Future, the result is None or IOError if the write failed.
+  Cancelling the future only succeeds as long as the write not has been started.
+  Use asyncio.wrap_future() to await it in asyncio.
+
+Function: update_async(compression=None)
+  Same as update but asynchronous, see write_async.
+Returns:
+  A concurrent.futures.Future.
+
 Function: getNodeNames()
 Returns:
   A list of all node names that exists in the nodelist.
@@ -1712,6 +3225,50 @@ Function: selectAll()
 Returns:
   N/A.
 
+Function: set_lazy_loading(lazy)
+  Turns lazy loading on or off. When on, attributes and datasets that not have been
+  fetched are read from the file when they are accessed with getNode, so that only
+  the nodes that are used are read.
+Parameters:
+  lazy - True to turn lazy loading on, False to turn it off
+Returns:
+  N/A.
+
+Function: set_data_budget(budget)
+  Sets a budget in bytes for the memory used by fetched datasets in the nodelist. When
+  exceeded, the least recently accessed unmodified datasets are released and loaded
+  again when accessed. Only has effect together with set_lazy_loading(True).
+Parameters:
+  budget - the budget in bytes, 0 means no budget
+Returns:
+  N/A.
+
+Function: set_compute_statistics(compute, nbins=0, low=0.0, high=0.0)
+  Turns computing of statistics on or off. When on, fetch() and fetchNode() compute
+  the statistics of each numeric dataset block by block while it is read, see
+  node.statistics(). Values equal to the ODIM nodata and undetect attributes of the
+  dataset are not valid.
+Parameters:
+  compute - True to compute statistics, False to not compute them
+  nbins   - the number of histogram bins between low and high, at most 256. 0 for no histogram.
+  low     - the lower limit of the histogram
+  high    - the upper limit of the histogram
+Returns:
+  N/A.
+
+Function: cached_data_size()
+  Returns the number of bytes of dataset data accounted against the budget.
+Returns:
+  the number of bytes
+
+Function: release_data(name)
+  Releases the data of the node but keeps its metadata. The data can be fetched again
+  or is loaded on the next access if lazy loading is on.
+Parameters:
+  name - the name of the node
+Returns:
+  N/A.
+
 Function: selectMetadata()
   Marks all nodes (except the actual dataset) for data reading when executing fetch()
 Returns:
@@ -1736,6 +3293,11 @@ Function: fetch()
 Returns:
   N/A.
 
+Function: fetch_async()
+  Same as fetch but asynchronous, see write_async.
+Returns:
+  A concurrent.futures.Future.
+
 Function: HLNodeList_fetchNode()
   Reads the data for the specified node and returns it.
 Returns:
@@ -1748,6 +3310,84 @@ Parameters:
 Returns:
   The read node.
 
+Function: attributes(prefix=None)
+  Returns the values of all attributes in the nodelist, optionally only the ones whose
+  name starts with prefix. Attributes that not have been fetched are fetched first,
+  other nodes that have been selected are left selected and are not fetched.
+  The values are the same as returned by node.data().
+Parameters:
+  prefix - if specified, only attributes whose name starts with prefix are returned.
+Returns:
+  a dictionary {name: value}
+
+Function: datasets(prefix=None)
+  Same as attributes but for datasets.
+Parameters:
+  prefix - if specified, only datasets whose name starts with prefix are returned.
+Returns:
+  a dictionary {name: value}
+
+Function: fetch_arrays(names, out=None)
+  Fetches the specified datasets and returns their data. The datasets are fetched in one
+  go without holding the GIL and the data is not copied on the way to Python.
+Parameters:
+  names - a list of dataset names.
+  out - an optional dictionary {name: array} with preallocated, writable and C-contiguous
+        numpy arrays. The data is read directly into these arrays and converted to the
+        type of the array if needed. The array must have the same number of items as
+        the dataset. The node keeps a writable buffer view of the array as its data,
+        so the node and the array share memory: changes made through one of them are
+        seen by the other, and the array must not be resized while the node holds the
+        view. The view, and with it the reference to the array, is released when the
+        data of the node is replaced or released and when the nodelist is freed.
+Returns:
+  a dictionary {name: array}. For names in out, it is the array in out.
+
+Function: fetch_decoded(name, format="double", nodata=nan, undetect=nan)
+  Fetches a quantized ODIM dataset and decodes it into physical values, gain * value + offset.
+  The gain, offset, nodata and undetect attributes are taken from the what-group next to
+  the dataset or from the what-groups of its ancestors. The node in the nodelist is not
+  changed.
+Parameters:
+  name - the name of the dataset, e.g. /dataset1/data1/data
+  format - 'float' or 'double'
+  nodata - the value that nodata is decoded into
+  undetect - the value that undetect is decoded into
+Returns:
+  the decoded values as a read-only numpy array
+
+Function: fetch_stored_statistics(name)
+  Returns the statistics that were stored when the dataset was written with a compression
+  object that has summary_tile_size set. Only the stored attributes are read, not the dataset.
+Parameters:
+  name - the name of the dataset
+Returns:
+  a dictionary like node.statistics() but without histogram or None if no statistics are stored
+
+Function: may_contain_values(name, low, high, start=None, count=None)
+  Checks if a region of a dataset may contain valid values within [low, high] by using the
+  tile summary that was stored when the dataset was written, see summary_tile_size. The
+  dataset is not read. The answer is conservative, True is also returned if no summary is
+  stored.
+Parameters:
+  name - the name of the dataset
+  low - the lower limit
+  high - the upper limit
+  start - the first index of the region in each dimension, None for the whole dataset
+  count - the size of the region in each dimension, None for the whole dataset
+Returns:
+  False if the region certainly not contains any such values, otherwise True
+
+Function: prefetch(names)
+  Starts fetching the specified nodes on a background thread and returns immediately.
+  Accessing the data of a node that is being prefetched waits for that node only, so
+  reading the next dataset can overlap with processing the previous one. fetch and
+  fetchNode do not read prefetched nodes again.
+Parameters:
+  names - a list of node names.
+Returns:
+  None
+
 \endverbatim
 */
 static struct PyMethodDef methods[] =
@@ -1755,16 +3395,31 @@ static struct PyMethodDef methods[] =
   { "addNode", (PyCFunction) _pyhl_add_node, 1 },
   { "write", (PyCFunction) _pyhl_write, 1 },
   { "update", (PyCFunction) _pyhl_update, 1 },
+  { "write_async", (PyCFunction) _pyhl_write_async, 1 },
+  { "update_async", (PyCFunction) _pyhl_update_async, 1 },
   { "getNodeNames", (PyCFunction) _pyhl_get_node_names, 1 },
   { "selectAll", (PyCFunction) _pyhl_select_all, 1 },
+  { "set_lazy_loading", (PyCFunction) _pyhl_set_lazy_loading, 1 },
+  { "set_data_budget", (PyCFunction) _pyhl_set_data_budget, 1 },
+  { "set_compute_statistics", (PyCFunction) _pyhl_set_compute_statistics, 1 },
+  { "cached_data_size", (PyCFunction) _pyhl_cached_data_size, 1 },
+  { "release_data", (PyCFunction) _pyhl_release_data, 1 },
   { "selectMetadata", (PyCFunction) _pyhl_select_metadata, 1 },
   { "selectAllMetadata", (PyCFunction) _pyhl_select_all_metadata, 1 },
   { "selectOnlyDatasets", (PyCFunction) _pyhl_select_only_datasets, 1 },
   { "selectNode", (PyCFunction) _pyhl_select_node, 1 },
   { "deselectNode", (PyCFunction) _pyhl_deselect_node, 1 },
   { "fetch", (PyCFunction) _pyhl_fetch, 1 },
+  { "fetch_async", (PyCFunction) _pyhl_fetch_async, 1 },
   { "fetchNode", (PyCFunction) _pyhl_fetch_node, 1 },
   { "getNode", (PyCFunction) _pyhl_get_node, 1 },
+  { "attributes", (PyCFunction) _pyhl_get_attributes, 1 },
+  { "datasets", (PyCFunction) _pyhl_get_datasets, 1 },
+  { "fetch_arrays", (PyCFunction) _pyhl_fetch_arrays, 1 },
+  { "fetch_decoded", (PyCFunction) _pyhl_fetch_decoded, 1 },
+  { "fetch_stored_statistics", (PyCFunction) _pyhl_fetch_stored_statistics, 1 },
+  { "may_contain_values", (PyCFunction) _pyhl_may_contain_values, 1 },
+  { "prefetch", (PyCFunction) _pyhl_prefetch, 1 },
   { NULL, NULL } /* sentinel */
 };
 
@@ -1794,13 +3449,30 @@ Function: setArrayValue(itemsize, dims, data, format, hid)
 Parameters:
   itemsize - specifies the size of the value in bytes. It is not nessecary to specify unless
              a compound type is set. So, usually it is just to set it to -1.
-  dims - is a list of dimensions of the data.
-  data - is the data to be set in the node.
+  dims - is a list of dimensions of the data. May be None if data has a shape.
+  data - is the data to be set in the node. Any object supporting the buffer protocol
+         (numpy array, memoryview, bytes, ...) or a list.
   format - is the HL-HDF string representation of the datatype.
   hid - is the hid_t reference to the datatype, is not nessecary to
         specify unless a compound type is set. Usually, just set it to -1.
 
   NOTE: If the data to be set is of compound type, then the data should be of string type.
+  NOTE: Contiguous buffers are not copied, instead the node keeps a reference to data so
+        changes to data before writing will be written. Other buffers are copied into
+        a contiguous array first. The dimensions only need to match the number of items.
+
+Returns:
+  N/A.
+
+Function: setCompoundArrayValue(data)
+  Sets a compound value from a numpy structured array (or a numpy.void scalar).
+  The compound type is created from the fields of the array, supported field types
+  are integers, floats, booleans, byte strings and sub arrays of up to 4 dimensions
+  of those in native byte order.
+Parameters:
+  data - the structured array. 0-dimensional arrays are set as a scalar value.
+
+  NOTE: Contiguous arrays are not copied, same as for setArrayValue.
 
 Returns:
   N/A.
@@ -1833,24 +3505,61 @@ Function: format()
 Returns:
   the format specifier
 
-Function: data()
+Function: data(copy=True)
   Returns the data in fixed format (native).
   NOTE: If the data is of compound type, the data will be returned as a string.
+  NOTE: Numeric arrays are copies of the data of the node. With copy=False, the
+        array refers directly to the data of the node without copying it instead.
+        Such an array is read-only and stays valid after the node has got a new value.
+Args:
+  copy: if numeric arrays should be copied, default True
 Returns:
   the data in native format.
 
-Function: rawdata()
+Function: rawdata(copy=True)
   Returns the raw data (as read without conversion to native format).
   NOTE: If the data is of compound type, the data will be returned as a string.
+  NOTE: Numeric arrays are copied unless copy=False, same as for data().
 Returns:
   the data in raw format.
 
+Function: data_as(format)
+  Returns the data converted into another numeric format as a new numpy array,
+  for example node.data_as("float") for a uchar dataset. Integer formats are
+  saturated and NaN becomes 0.
+Args:
+  format: the format to convert into, e.g. 'float' or 'double'
+Returns:
+  the converted data
+
+Function: convert_data(format)
+  Converts the data of the node into another numeric format in place, the node
+  gets the new format and is marked as changed.
+Args:
+  format: the format to convert into, e.g. 'float' or 'double'
+
+Function: statistics()
+  Returns the statistics that were computed when the dataset was fetched, see
+  nodelist.set_compute_statistics(). The statistics are of the stored values and
+  are removed when the data is changed.
+Returns:
+  a dictionary with count, valid_count, nodata_count, undetect_count, min, max, sum,
+  mean and histogram (a list of counts) or None if there are no statistics
+
 Function: compound_data()
   Returns a dictionary with all attributes in the compund attribute, it only
   works if the node instance is a compound attribute.
 Returns:
   the compound data as a dictionary
 
+Function: compound_array(copy=True)
+  Returns the compound data as a numpy structured array with the same shape as the
+  node (a 0-dimensional array for scalars). The field names and offsets are taken from
+  the compound type. As for data(), the array is a copy unless copy=False, in which
+  case it refers directly to the data of the node and is read-only.
+Returns:
+  the compound data as a numpy structured array
+
 \endverbatim
  */
 static struct PyMethodDef node_methods[] =
@@ -1864,9 +3573,14 @@ static struct PyMethodDef node_methods[] =
   { "type", (PyCFunction) _pyhl_node_type, 1 },
   { "dims", (PyCFunction) _pyhl_node_dims, 1 },
   { "format", (PyCFunction) _pyhl_node_format, 1 },
-  { "data", (PyCFunction) _pyhl_node_data, 1 },
-  { "rawdata", (PyCFunction) _pyhl_node_rawdata, 1 },
+  { "data", (PyCFunction) _pyhl_node_data, METH_VARARGS|METH_KEYWORDS },
+  { "rawdata", (PyCFunction) _pyhl_node_rawdata, METH_VARARGS|METH_KEYWORDS },
+  { "data_as", (PyCFunction) _pyhl_node_data_as, 1 },
+  { "convert_data", (PyCFunction) _pyhl_node_convert_data, 1 },
+  { "statistics", (PyCFunction) _pyhl_node_statistics, 1 },
   { "compound_data", (PyCFunction) _pyhl_node_get_compound_data, 1 },
+  { "compound_array", (PyCFunction) _pyhl_node_get_compound_array, METH_VARARGS|METH_KEYWORDS },
+  { "setCompoundArrayValue", (PyCFunction) _pyhl_node_set_compound_array_value, 1 },
   { "compound_type", (PyCFunction) _pyhl_node_get_compound_type, 1 },
   { NULL, NULL } /* sentinel */
 };
@@ -1929,6 +3643,25 @@ static struct PyMemberDef filecreationproperty_members[] =
  *
  * \li <b>szlib_px_per_block</b>: The block size must be even, with typical values
  * being 8,10,16 and 32. The more pixel values vary, the smaller this number should be.
+ *
+ * Regardless of the compression type, there is also
+ *
+ * \li <b>summary_tile_size</b>: If > 0, the statistics of numeric datasets are stored
+ * when they are written together with the min and max of each tile of
+ * summary_tile_size x summary_tile_size values, see nodelist.fetch_stored_statistics()
+ * and nodelist.may_contain_values(). 0 (default) stores no statistics.
+ *
+ * \li <b>keep_bits</b>: If > 0, float and double datasets are written with only keep_bits
+ * bits of the mantissa, the rest is rounded to nearest even and set to zero so that the
+ * values compress better. This is lossy. 0 (default) writes the values as they are.
+ *
+ * \li <b>keep_digits</b>: As keep_bits but specified as the number of significant decimal
+ * digits, only used when keep_bits is 0.
+ *
+ * \li <b>predictor</b>: PREDICTOR_DELTA stores each row of integer datasets as the
+ * differences between neighbouring values, which compress better when the values are
+ * smooth along the last dimension. It is inverted when the dataset is read.
+ * PREDICTOR_NONE (default) writes the values as they are.
  */
 static struct PyMemberDef compression_members[] =
 {
@@ -1936,6 +3669,10 @@ static struct PyMemberDef compression_members[] =
   { "level", 0 },
   { "szlib_mask", 0 },
   { "szlib_px_per_block", 0 },
+  { "summary_tile_size", 0 },
+  { "keep_bits", 0 },
+  { "keep_digits", 0 },
+  { "predictor", 0 },
   { "H5_SZIP_CHIP_OPTION_MASK", 0 },
   { "H5_SZIP_ALLOW_K13_OPTION_MASK", 0 },
   { "H5_SZIP_EC_OPTION_MASK", 0 },
@@ -1955,6 +3692,10 @@ static PyObject* _getattro(PyhlNodelist* self, PyObject* name)
     return PyInt_FromLong(TYPE_ID);
   if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "REFERENCE_ID") == 0)
     return PyInt_FromLong(REFERENCE_ID);
+  if (self->busy) {
+    /* Another thread is doing I/O on the nodelist without holding the GIL */
+    raiseException(PyExc_RuntimeError, "The nodelist is in use by another thread");
+  }
 
   return PyObject_GenericGetAttr((PyObject*)self, name);
 }
@@ -2069,6 +3810,14 @@ static PyObject* _getattr_compressiono(PyhlCompression* self, PyObject* name)
     return PyInt_FromLong(self->compr->szlib_mask);
   } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "szlib_px_per_block") == 0) {
     return PyInt_FromLong(self->compr->szlib_px_per_block);
+  } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "summary_tile_size") == 0) {
+    return PyInt_FromLong(self->compr->summary_tile_size);
+  } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "keep_bits") == 0) {
+    return PyInt_FromLong(self->compr->keep_bits);
+  } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "keep_digits") == 0) {
+    return PyInt_FromLong(self->compr->keep_digits);
+  } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "predictor") == 0) {
+    return PyInt_FromLong(self->compr->predictor);
   } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "H5_SZIP_CHIP_OPTION_MASK") == 0) {
     return PyInt_FromLong(H5_SZIP_CHIP_OPTION_MASK);
   } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "H5_SZIP_ALLOW_K13_OPTION_MASK") == 0) {
@@ -2150,6 +3899,45 @@ static int _setattr_compressiono(PyhlCompression* self, PyObject* name,
     self->compr->szlib_px_per_block = tmpv;
     Py_INCREF(Py_None);
     return 0;
+  } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "summary_tile_size") == 0) {
+    long tmpv = PyInt_AsLong(val);
+    if (tmpv == -1 && PyErr_Occurred()) {
+      return -1;
+    }
+    if (tmpv < 0 || tmpv > INT_MAX) {
+      setException(PyExc_AttributeError,"summary_tile_size must be 0 or a positive integer");
+      return -1;
+    }
+    self->compr->summary_tile_size = (int)tmpv;
+    return 0;
+  } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "keep_bits") == 0 ||
+             PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "keep_digits") == 0) {
+    long tmpv = PyInt_AsLong(val);
+    if (tmpv == -1 && PyErr_Occurred()) {
+      return -1;
+    }
+    if (tmpv < 0 || tmpv > INT_MAX) {
+      sprintf(errmsg, "%s must be 0 or a positive integer", PY_ATTRO_NAME_TO_STRING(name));
+      setException(PyExc_AttributeError,errmsg);
+      return -1;
+    }
+    if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "keep_bits") == 0) {
+      self->compr->keep_bits = (int)tmpv;
+    } else {
+      self->compr->keep_digits = (int)tmpv;
+    }
+    return 0;
+  } else if (PY_COMPARE_ATTRO_NAME_WITH_STRING(name, "predictor") == 0) {
+    long tmpv = PyInt_AsLong(val);
+    if (tmpv == -1 && PyErr_Occurred()) {
+      return -1;
+    }
+    if (tmpv != PT_NONE && tmpv != PT_DELTA) {
+      setException(PyExc_AttributeError,"predictor must be PREDICTOR_NONE or PREDICTOR_DELTA");
+      return -1;
+    }
+    self->compr->predictor = (HL_PredictorType)tmpv;
+    return 0;
   }
 
   sprintf(errmsg,
@@ -2370,6 +4158,20 @@ hierarchy.
 Returns:
   the read nodelist.
 
+Function: read_nodelists(filenames, nworkers=0, timeout=60.0)
+Reads and fetches all nodes in several files at once using a pool of
+worker processes. If nworkers is 0, one worker per processor is used.
+A worker that spends more than timeout seconds on a file is killed and
+the file is returned as None, 0.0 means no timeout.
+The workers are forked from the calling process. No other thread may use
+HDF5, e.g. through pyhl or h5py, while read_nodelists is running. A worker
+forked while another thread is inside HDF5 can inherit the internal lock
+of HDF5 held and hang until the timeout kills it, which is why the
+timeout is not disabled by default.
+Returns:
+  a list with one fetched nodelist per filename, None for the files that
+  could not be read.
+
 Function: is_file_hdf5(filename)
 Returns 1 or 0 depending on if the specified filename is a HDF5
 file or not.
@@ -2385,6 +4187,24 @@ Returns:
 Function: show_hlhdferrors(enable)
 Turns HL-HDF error reporting on or off. If enable == 1, then
 HL-HDF error reporting is turned on (in debugging mode). Otherwise it is turned off.
+Returns:
+  N/A.
+
+Function: get_statistics()
+Returns the allocation and I/O statistics collected by the calling thread
+since start or since the last call to reset_statistics(). I/O done by the
+background threads of fetch_async() and prefetch() and by the workers of
+read_nodelists() is not included, neither is memory that is released by
+another thread than the one that allocated it.
+Returns:
+  a dictionary with the counters (allocations, frees, bytes_allocated,
+  current_bytes, peak_bytes, files_opened, objects_opened, dataset_reads,
+  attribute_reads, dataset_writes, attribute_writes, bytes_read, bytes_written)
+  and the times in seconds (file_open_time, dataset_read_time,
+  attribute_read_time, dataset_write_time, attribute_write_time).
+
+Function: reset_statistics()
+Resets the statistics for the calling thread.
 Returns:
   N/A.
 \endverbatim
@@ -2396,10 +4216,13 @@ static PyMethodDef functions[] = {
   {"filecreationproperty",(PyCFunction)_pyhl_new_filecreationproperty,1},
   {"compression",(PyCFunction)_pyhl_new_compression,1},
   {"read_nodelist",(PyCFunction)_pyhl_read_nodelist,1},
+  {"read_nodelists",(PyCFunction)_pyhl_read_nodelists,1},
   {"is_file_hdf5",(PyCFunction)_pyhl_is_file_hdf5,1},
   {"show_hdf5errors",(PyCFunction)_pyhl_show_hdf5errors,1},
   {"show_hlhdferrors",(PyCFunction)_pyhl_show_hlhdferrors,1},
   {"get_hdf5version", (PyCFunction)_pyhl_get_hdf5version,1},
+  {"get_statistics", (PyCFunction)_pyhl_get_statistics,1},
+  {"reset_statistics", (PyCFunction)_pyhl_reset_statistics,1},
   {NULL,NULL} /*Sentinel*/
 };
 
@@ -2461,6 +4284,14 @@ MOD_INIT(_pyhl)
   PyDict_SetItemString(dictionary,"COMPRESSION_SZLIB",tmp);
   Py_XDECREF(tmp);
 
+  tmp = PyInt_FromLong(PT_NONE);
+  PyDict_SetItemString(dictionary,"PREDICTOR_NONE",tmp);
+  Py_XDECREF(tmp);
+
+  tmp = PyInt_FromLong(PT_DELTA);
+  PyDict_SetItemString(dictionary,"PREDICTOR_DELTA",tmp);
+  Py_XDECREF(tmp);
+
   import_array(); /*To make sure I get access to Numeric*/
   /*Always have to do this*/
   HL_init();
@@ -0,0 +1,4290 @@
+	.file	"pyhlcompat.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/pyhlhdf" "pyhlcompat.c"
+	.p2align 4
+	.globl	PyHlhdfAPI_CompareWithASCIIString
+	.type	PyHlhdfAPI_CompareWithASCIIString, @function
+PyHlhdfAPI_CompareWithASCIIString:
+.LVL0:
+.LFB84:
+	.file 1 "pyhlcompat.c"
+	.loc 1 30 1 view -0
+	.cfi_startproc
+	.loc 1 31 3 view .LVU1
+	.loc 1 32 3 view .LVU2
+.LBB31:
+.LBI31:
+	.file 2 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+	.loc 2 132 29 view .LVU3
+.LBB32:
+	.loc 2 133 5 view .LVU4
+	.loc 2 133 5 is_stmt 0 view .LVU5
+.LBE32:
+.LBE31:
+.LBB33:
+.LBI33:
+	.loc 2 763 1 is_stmt 1 view .LVU6
+.LBB34:
+	.loc 2 765 5 view .LVU7
+	.loc 2 770 5 view .LVU8
+	.loc 2 772 5 view .LVU9
+	.loc 2 770 11 is_stmt 0 view .LVU10
+	movq	8(%rdi), %rax
+.LBE34:
+.LBE33:
+	.loc 1 32 6 view .LVU11
+	testb	$16, 171(%rax)
+	je	.L2
+	.loc 1 30 1 view .LVU12
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rsi, %rbx
+	.loc 1 43 5 is_stmt 1 view .LVU13
+	.loc 1 43 14 is_stmt 0 view .LVU14
+	call	PyUnicode_AsUTF8@PLT
+.LVL1:
+	.loc 1 43 14 view .LVU15
+	movq	%rbx, %rsi
+	.loc 1 46 1 view .LVU16
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL2:
+	.loc 1 43 14 view .LVU17
+	movq	%rax, %rdi
+	jmp	strcmp@PLT
+.LVL3:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 45 3 is_stmt 1 view .LVU18
+	.loc 1 46 1 is_stmt 0 view .LVU19
+	movl	$-1, %eax
+	ret
+	.cfi_endproc
+.LFE84:
+	.size	PyHlhdfAPI_CompareWithASCIIString, .-PyHlhdfAPI_CompareWithASCIIString
+	.p2align 4
+	.globl	PyHlhdf_StringOrUnicode_FromASCII
+	.type	PyHlhdf_StringOrUnicode_FromASCII, @function
+PyHlhdf_StringOrUnicode_FromASCII:
+.LVL4:
+.LFB85:
+	.loc 1 49 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 51 3 view .LVU21
+	.loc 1 49 1 is_stmt 0 view .LVU22
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+.LVL5:
+	.loc 1 52 3 is_stmt 1 view .LVU23
+	.loc 1 53 3 view .LVU24
+	.loc 1 49 1 is_stmt 0 view .LVU25
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	.loc 1 53 13 view .LVU26
+	movl	$127, %esi
+.LVL6:
+	.loc 1 49 1 view .LVU27
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 53 13 view .LVU28
+	movq	%rbp, %rdi
+.LVL7:
+	.loc 1 53 13 view .LVU29
+	call	PyUnicode_New@PLT
+.LVL8:
+	movq	%rax, %rbx
+.LVL9:
+	.loc 1 54 3 is_stmt 1 view .LVU30
+	.loc 1 54 6 is_stmt 0 view .LVU31
+	testq	%rax, %rax
+	je	.L7
+	.loc 1 57 3 is_stmt 1 view .LVU32
+.LVL10:
+.LBB35:
+.LBI35:
+	.file 3 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+	.loc 3 336 21 view .LVU33
+.LBB36:
+	.loc 3 337 5 view .LVU34
+.LBB37:
+.LBI37:
+	.loc 3 288 28 view .LVU35
+.LBB38:
+	.loc 3 289 5 view .LVU36
+	.loc 3 289 45 is_stmt 0 view .LVU37
+	movzbl	32(%rax), %eax
+.LVL11:
+	.loc 3 289 45 view .LVU38
+.LBE38:
+.LBE37:
+	.loc 3 337 8 view .LVU39
+	testb	$32, %al
+	jne	.L16
+	.loc 3 340 5 is_stmt 1 view .LVU40
+.LVL12:
+.LBB39:
+.LBI39:
+	.loc 3 328 21 view .LVU41
+.LBB40:
+	.loc 3 329 5 view .LVU42
+	.loc 3 330 4 view .LVU43
+	.loc 3 331 5 view .LVU44
+	.loc 3 331 10 is_stmt 0 view .LVU45
+	movq	72(%rbx), %rdi
+.LVL13:
+	.loc 3 332 4 is_stmt 1 view .LVU46
+	.loc 3 333 5 view .LVU47
+.L11:
+	.loc 3 333 5 is_stmt 0 view .LVU48
+.LBE40:
+.LBE39:
+.LBE36:
+.LBE35:
+	.loc 1 57 3 view .LVU49
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	call	memcpy@PLT
+.LVL14:
+	.loc 1 58 3 is_stmt 1 view .LVU50
+.L7:
+	.loc 1 62 1 is_stmt 0 view .LVU51
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL15:
+	.loc 1 62 1 view .LVU52
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL16:
+	.loc 1 62 1 view .LVU53
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL17:
+	.loc 1 62 1 view .LVU54
+	ret
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.cfi_restore_state
+.LBB46:
+.LBB45:
+	.loc 3 338 9 is_stmt 1 view .LVU55
+.LBB41:
+.LBI41:
+	.loc 3 321 21 view .LVU56
+.LBB42:
+	.loc 3 322 5 view .LVU57
+.LBB43:
+.LBI43:
+	.loc 3 278 28 view .LVU58
+.LBB44:
+	.loc 3 279 4 view .LVU59
+	.loc 3 280 5 view .LVU60
+	.loc 3 280 5 is_stmt 0 view .LVU61
+.LBE44:
+.LBE43:
+	.loc 3 323 17 view .LVU62
+	leaq	48(%rbx), %rdx
+	leaq	72(%rbx), %rdi
+	testb	$64, %al
+	cmovne	%rdx, %rdi
+	jmp	.L11
+.LBE42:
+.LBE41:
+.LBE45:
+.LBE46:
+	.cfi_endproc
+.LFE85:
+	.size	PyHlhdf_StringOrUnicode_FromASCII, .-PyHlhdf_StringOrUnicode_FromASCII
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h"
+	.file 9 "/root/.pyenv/versions/3.11.7/include/python3.11/pytypedefs.h"
+	.file 10 "/root/.pyenv/versions/3.11.7/include/python3.11/methodobject.h"
+	.file 11 "/root/.pyenv/versions/3.11.7/include/python3.11/descrobject.h"
+	.file 12 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+	.file 13 "/root/.pyenv/versions/3.11.7/include/python3.11/pybuffer.h"
+	.file 14 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1325
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF242
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL17
+	.quad	0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.long	.LASF2
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x36
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x15
+	.long	.LASF3
+	.byte	0x4
+	.value	0x149
+	.byte	0xd
+	.long	0x4a
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF5
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x4
+	.long	0x72
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xf
+	.long	0x6b
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF9
+	.uleb128 0xf
+	.long	0x77
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF11
+	.uleb128 0x3
+	.long	.LASF12
+	.byte	0x5
+	.byte	0x26
+	.byte	0x17
+	.long	0x77
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF13
+	.uleb128 0x3
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x28
+	.byte	0x1c
+	.long	0x5f
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x16
+	.long	0x83
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x5
+	.byte	0xc2
+	.byte	0x12
+	.long	0x51
+	.uleb128 0x4
+	.long	0x6b
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x6c
+	.byte	0x13
+	.long	0xbe
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x4
+	.long	0xe7
+	.uleb128 0x23
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x7
+	.byte	0x18
+	.byte	0x13
+	.long	0x91
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x7
+	.byte	0x19
+	.byte	0x14
+	.long	0xa4
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x14
+	.long	0xb0
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x8
+	.byte	0x83
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x8
+	.byte	0x91
+	.byte	0x14
+	.long	0x10c
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF24
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF25
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x9
+	.byte	0xe
+	.byte	0x1c
+	.long	0x13e
+	.uleb128 0x10
+	.long	.LASF26
+	.byte	0x20
+	.byte	0xa
+	.byte	0x36
+	.long	0x17f
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0xa
+	.byte	0x37
+	.byte	0x11
+	.long	0x66
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0xa
+	.byte	0x38
+	.byte	0x11
+	.long	0xe81
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0xa
+	.byte	0x39
+	.byte	0x9
+	.long	0x4a
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0xa
+	.byte	0x3b
+	.byte	0x11
+	.long	0x66
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x9
+	.byte	0xf
+	.byte	0x1c
+	.long	0x18b
+	.uleb128 0x10
+	.long	.LASF31
+	.byte	0x28
+	.byte	0xb
+	.byte	0xb
+	.long	0x1d9
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0xb
+	.byte	0xc
+	.byte	0x11
+	.long	0x66
+	.byte	0
+	.uleb128 0xa
+	.string	"get"
+	.byte	0xb
+	.byte	0xd
+	.byte	0xc
+	.long	0xea6
+	.byte	0x8
+	.uleb128 0xa
+	.string	"set"
+	.byte	0xb
+	.byte	0xe
+	.byte	0xc
+	.long	0xeb2
+	.byte	0x10
+	.uleb128 0xa
+	.string	"doc"
+	.byte	0xb
+	.byte	0xf
+	.byte	0x11
+	.long	0x66
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0xb
+	.byte	0x10
+	.byte	0xb
+	.long	0xbc
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x9
+	.byte	0x10
+	.byte	0x1c
+	.long	0x1e5
+	.uleb128 0x24
+	.long	.LASF34
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x9
+	.byte	0x12
+	.byte	0x18
+	.long	0x1f6
+	.uleb128 0x10
+	.long	.LASF36
+	.byte	0x10
+	.byte	0x2
+	.byte	0x64
+	.long	0x21d
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x2
+	.byte	0x66
+	.byte	0x10
+	.long	0x10c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x2
+	.byte	0x67
+	.byte	0x13
+	.long	0x569
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x14
+	.byte	0x1c
+	.long	0x229
+	.uleb128 0x25
+	.long	.LASF40
+	.value	0x198
+	.byte	0xc
+	.byte	0x94
+	.byte	0x8
+	.long	0x4b5
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0xc
+	.byte	0x95
+	.byte	0x11
+	.long	0x592
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0xc
+	.byte	0x96
+	.byte	0x11
+	.long	0x66
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0xc
+	.byte	0x97
+	.byte	0x10
+	.long	0x10c
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0xc
+	.byte	0x97
+	.byte	0x1e
+	.long	0x10c
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0xc
+	.byte	0x9b
+	.byte	0x10
+	.long	0x756
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0xc
+	.byte	0x9c
+	.byte	0x10
+	.long	0x10c
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0xc
+	.byte	0x9d
+	.byte	0x11
+	.long	0x772
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0xc
+	.byte	0x9e
+	.byte	0x11
+	.long	0x7a3
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0xc
+	.byte	0x9f
+	.byte	0x15
+	.long	0xcd6
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0xc
+	.byte	0xa1
+	.byte	0xe
+	.long	0x7d9
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0xc
+	.byte	0xa5
+	.byte	0x16
+	.long	0xcdb
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0xc
+	.byte	0xa6
+	.byte	0x18
+	.long	0xce0
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0xc
+	.byte	0xa7
+	.byte	0x17
+	.long	0xce5
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0xc
+	.byte	0xab
+	.byte	0xe
+	.long	0x7e5
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0xc
+	.byte	0xac
+	.byte	0x11
+	.long	0x5e3
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0xc
+	.byte	0xad
+	.byte	0xe
+	.long	0x7d9
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0xc
+	.byte	0xae
+	.byte	0x12
+	.long	0x797
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0xc
+	.byte	0xaf
+	.byte	0x12
+	.long	0x7cd
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0xc
+	.byte	0xb2
+	.byte	0x14
+	.long	0xcea
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0xc
+	.byte	0xb5
+	.byte	0x13
+	.long	0x36
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0xc
+	.byte	0xb7
+	.byte	0x11
+	.long	0x66
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xc
+	.byte	0xbb
+	.byte	0x12
+	.long	0x710
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xc
+	.byte	0xbe
+	.byte	0xd
+	.long	0x60d
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0xc
+	.byte	0xc2
+	.byte	0x11
+	.long	0x805
+	.byte	0xc8
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0xc
+	.byte	0xc5
+	.byte	0x10
+	.long	0x10c
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0xc
+	.byte	0xc8
+	.byte	0x11
+	.long	0x82f
+	.byte	0xd8
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0xc
+	.byte	0xc9
+	.byte	0x12
+	.long	0x83b
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0xc
+	.byte	0xcc
+	.byte	0x12
+	.long	0xcef
+	.byte	0xe8
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0xc
+	.byte	0xcd
+	.byte	0x12
+	.long	0xcf4
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0xc
+	.byte	0xce
+	.byte	0x12
+	.long	0xcf9
+	.byte	0xf8
+	.uleb128 0x5
+	.long	.LASF71
+	.byte	0xd0
+	.byte	0x13
+	.long	0x569
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF72
+	.byte	0xd1
+	.byte	0xf
+	.long	0x54e
+	.value	0x108
+	.uleb128 0x5
+	.long	.LASF73
+	.byte	0xd2
+	.byte	0x12
+	.long	0x847
+	.value	0x110
+	.uleb128 0x5
+	.long	.LASF74
+	.byte	0xd3
+	.byte	0x12
+	.long	0x853
+	.value	0x118
+	.uleb128 0x5
+	.long	.LASF75
+	.byte	0xd4
+	.byte	0x10
+	.long	0x10c
+	.value	0x120
+	.uleb128 0x5
+	.long	.LASF76
+	.byte	0xd5
+	.byte	0xe
+	.long	0x85f
+	.value	0x128
+	.uleb128 0x5
+	.long	.LASF77
+	.byte	0xd6
+	.byte	0xf
+	.long	0x895
+	.value	0x130
+	.uleb128 0x5
+	.long	.LASF78
+	.byte	0xd7
+	.byte	0xd
+	.long	0x86b
+	.value	0x138
+	.uleb128 0x5
+	.long	.LASF79
+	.byte	0xd8
+	.byte	0xe
+	.long	0x73a
+	.value	0x140
+	.uleb128 0x5
+	.long	.LASF80
+	.byte	0xd9
+	.byte	0xd
+	.long	0x60d
+	.value	0x148
+	.uleb128 0x5
+	.long	.LASF81
+	.byte	0xda
+	.byte	0xf
+	.long	0x54e
+	.value	0x150
+	.uleb128 0x5
+	.long	.LASF82
+	.byte	0xdb
+	.byte	0xf
+	.long	0x54e
+	.value	0x158
+	.uleb128 0x5
+	.long	.LASF83
+	.byte	0xdc
+	.byte	0xf
+	.long	0x54e
+	.value	0x160
+	.uleb128 0x5
+	.long	.LASF84
+	.byte	0xdd
+	.byte	0xf
+	.long	0x54e
+	.value	0x168
+	.uleb128 0x5
+	.long	.LASF85
+	.byte	0xde
+	.byte	0xf
+	.long	0x54e
+	.value	0x170
+	.uleb128 0x5
+	.long	.LASF86
+	.byte	0xdf
+	.byte	0x10
+	.long	0x756
+	.value	0x178
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0xe2
+	.byte	0x12
+	.long	0x83
+	.value	0x180
+	.uleb128 0x5
+	.long	.LASF88
+	.byte	0xe4
+	.byte	0x10
+	.long	0x756
+	.value	0x188
+	.uleb128 0x5
+	.long	.LASF89
+	.byte	0xe5
+	.byte	0x14
+	.long	0x939
+	.value	0x190
+	.byte	0
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0xd
+	.byte	0x14
+	.byte	0x9
+	.long	0x54e
+	.uleb128 0xa
+	.string	"buf"
+	.byte	0xd
+	.byte	0x15
+	.byte	0xb
+	.long	0xbc
+	.byte	0
+	.uleb128 0xa
+	.string	"obj"
+	.byte	0xd
+	.byte	0x16
+	.byte	0xf
+	.long	0x54e
+	.byte	0x8
+	.uleb128 0xa
+	.string	"len"
+	.byte	0xd
+	.byte	0x17
+	.byte	0x10
+	.long	0x10c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0xd
+	.byte	0x18
+	.byte	0x10
+	.long	0x10c
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x9
+	.long	0x4a
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0xd
+	.byte	0x1b
+	.byte	0x9
+	.long	0x4a
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0xd
+	.byte	0x1c
+	.byte	0xb
+	.long	0xca
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xd
+	.byte	0x1d
+	.byte	0x11
+	.long	0x558
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x11
+	.long	0x558
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0xd
+	.byte	0x1f
+	.byte	0x11
+	.long	0x558
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0xd
+	.byte	0x20
+	.byte	0xb
+	.long	0xbc
+	.byte	0x48
+	.byte	0
+	.uleb128 0x4
+	.long	0x1ea
+	.uleb128 0xf
+	.long	0x54e
+	.uleb128 0x4
+	.long	0x10c
+	.uleb128 0x3
+	.long	.LASF98
+	.byte	0xd
+	.byte	0x21
+	.byte	0x3
+	.long	0x4b5
+	.uleb128 0x4
+	.long	0x21d
+	.uleb128 0x8
+	.byte	0x18
+	.byte	0x2
+	.byte	0x6d
+	.byte	0x9
+	.long	0x592
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x2
+	.byte	0x6e
+	.byte	0xe
+	.long	0x1ea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0x2
+	.byte	0x6f
+	.byte	0x10
+	.long	0x10c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF100
+	.byte	0x2
+	.byte	0x70
+	.byte	0x3
+	.long	0x56e
+	.uleb128 0x3
+	.long	.LASF101
+	.byte	0x2
+	.byte	0xc4
+	.byte	0x16
+	.long	0x5aa
+	.uleb128 0x4
+	.long	0x5af
+	.uleb128 0x6
+	.long	0x54e
+	.long	0x5be
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF102
+	.byte	0x2
+	.byte	0xc5
+	.byte	0x16
+	.long	0x5ca
+	.uleb128 0x4
+	.long	0x5cf
+	.uleb128 0x6
+	.long	0x54e
+	.long	0x5e3
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF103
+	.byte	0x2
+	.byte	0xc6
+	.byte	0x16
+	.long	0x5ef
+	.uleb128 0x4
+	.long	0x5f4
+	.uleb128 0x6
+	.long	0x54e
+	.long	0x60d
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF104
+	.byte	0x2
+	.byte	0xc7
+	.byte	0xf
+	.long	0x619
+	.uleb128 0x4
+	.long	0x61e
+	.uleb128 0x6
+	.long	0x4a
+	.long	0x62d
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF105
+	.byte	0x2
+	.byte	0xc8
+	.byte	0x16
+	.long	0x639
+	.uleb128 0x4
+	.long	0x63e
+	.uleb128 0x6
+	.long	0x10c
+	.long	0x64d
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF106
+	.byte	0x2
+	.byte	0xc9
+	.byte	0x15
+	.long	0x659
+	.uleb128 0x4
+	.long	0x65e
+	.uleb128 0x6
+	.long	0x54e
+	.long	0x672
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x10c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF107
+	.byte	0x2
+	.byte	0xcb
+	.byte	0xe
+	.long	0x67e
+	.uleb128 0x4
+	.long	0x683
+	.uleb128 0x6
+	.long	0x4a
+	.long	0x69c
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x10c
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x2
+	.byte	0xcd
+	.byte	0xe
+	.long	0x6a8
+	.uleb128 0x4
+	.long	0x6ad
+	.uleb128 0x6
+	.long	0x4a
+	.long	0x6c6
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF109
+	.byte	0x2
+	.byte	0xcf
+	.byte	0xf
+	.long	0x6d2
+	.uleb128 0x4
+	.long	0x6d7
+	.uleb128 0x6
+	.long	0x4a
+	.long	0x6eb
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF110
+	.byte	0x2
+	.byte	0xd0
+	.byte	0xf
+	.long	0x6f7
+	.uleb128 0x4
+	.long	0x6fc
+	.uleb128 0x6
+	.long	0x4a
+	.long	0x710
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF111
+	.byte	0x2
+	.byte	0xd1
+	.byte	0xf
+	.long	0x71c
+	.uleb128 0x4
+	.long	0x721
+	.uleb128 0x6
+	.long	0x4a
+	.long	0x73a
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x6eb
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF112
+	.byte	0x2
+	.byte	0xd4
+	.byte	0x10
+	.long	0x746
+	.uleb128 0x4
+	.long	0x74b
+	.uleb128 0x11
+	.long	0x756
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF113
+	.byte	0x2
+	.byte	0xd5
+	.byte	0x10
+	.long	0x762
+	.uleb128 0x4
+	.long	0x767
+	.uleb128 0x11
+	.long	0x772
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF114
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x15
+	.long	0x77e
+	.uleb128 0x4
+	.long	0x783
+	.uleb128 0x6
+	.long	0x54e
+	.long	0x797
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0xca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF115
+	.byte	0x2
+	.byte	0xd7
+	.byte	0x15
+	.long	0x5ca
+	.uleb128 0x3
+	.long	.LASF116
+	.byte	0x2
+	.byte	0xd8
+	.byte	0xf
+	.long	0x7af
+	.uleb128 0x4
+	.long	0x7b4
+	.uleb128 0x6
+	.long	0x4a
+	.long	0x7cd
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0xca
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF117
+	.byte	0x2
+	.byte	0xd9
+	.byte	0xf
+	.long	0x6a8
+	.uleb128 0x3
+	.long	.LASF118
+	.byte	0x2
+	.byte	0xda
+	.byte	0x15
+	.long	0x5aa
+	.uleb128 0x3
+	.long	.LASF119
+	.byte	0x2
+	.byte	0xdb
+	.byte	0x15
+	.long	0x7f1
+	.uleb128 0x4
+	.long	0x7f6
+	.uleb128 0x6
+	.long	0x118
+	.long	0x805
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF120
+	.byte	0x2
+	.byte	0xdc
+	.byte	0x15
+	.long	0x811
+	.uleb128 0x4
+	.long	0x816
+	.uleb128 0x6
+	.long	0x54e
+	.long	0x82f
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x4a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF121
+	.byte	0x2
+	.byte	0xdd
+	.byte	0x15
+	.long	0x5aa
+	.uleb128 0x3
+	.long	.LASF122
+	.byte	0x2
+	.byte	0xde
+	.byte	0x15
+	.long	0x5aa
+	.uleb128 0x3
+	.long	.LASF123
+	.byte	0x2
+	.byte	0xdf
+	.byte	0x15
+	.long	0x5ef
+	.uleb128 0x3
+	.long	.LASF124
+	.byte	0x2
+	.byte	0xe0
+	.byte	0xf
+	.long	0x6a8
+	.uleb128 0x3
+	.long	.LASF125
+	.byte	0x2
+	.byte	0xe1
+	.byte	0xf
+	.long	0x6a8
+	.uleb128 0x3
+	.long	.LASF126
+	.byte	0x2
+	.byte	0xe2
+	.byte	0x15
+	.long	0x877
+	.uleb128 0x4
+	.long	0x87c
+	.uleb128 0x6
+	.long	0x54e
+	.long	0x895
+	.uleb128 0x2
+	.long	0x569
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF127
+	.byte	0x2
+	.byte	0xe3
+	.byte	0x15
+	.long	0x8a1
+	.uleb128 0x4
+	.long	0x8a6
+	.uleb128 0x6
+	.long	0x54e
+	.long	0x8ba
+	.uleb128 0x2
+	.long	0x569
+	.uleb128 0x2
+	.long	0x10c
+	.byte	0
+	.uleb128 0x26
+	.byte	0x5
+	.byte	0x4
+	.long	0x4a
+	.byte	0x2
+	.value	0x2a4
+	.byte	0xe
+	.long	0x8dc
+	.uleb128 0x16
+	.long	.LASF128
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF129
+	.sleb128 -1
+	.uleb128 0x16
+	.long	.LASF130
+	.byte	0x1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF131
+	.byte	0x2
+	.value	0x2a8
+	.byte	0x3
+	.long	0x8ba
+	.uleb128 0x3
+	.long	.LASF132
+	.byte	0xc
+	.byte	0x36
+	.byte	0xf
+	.long	0x8f5
+	.uleb128 0x4
+	.long	0x8fa
+	.uleb128 0x6
+	.long	0x4a
+	.long	0x913
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x913
+	.uleb128 0x2
+	.long	0x4a
+	.byte	0
+	.uleb128 0x4
+	.long	0x55d
+	.uleb128 0x3
+	.long	.LASF133
+	.byte	0xc
+	.byte	0x37
+	.byte	0x10
+	.long	0x924
+	.uleb128 0x4
+	.long	0x929
+	.uleb128 0x11
+	.long	0x939
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x913
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF134
+	.byte	0xc
+	.byte	0x39
+	.byte	0x15
+	.long	0x945
+	.uleb128 0x4
+	.long	0x94a
+	.uleb128 0x6
+	.long	0x54e
+	.long	0x968
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x968
+	.uleb128 0x2
+	.long	0x2a
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x4
+	.long	0x553
+	.uleb128 0x28
+	.value	0x120
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x9
+	.long	0xb4c
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0xc
+	.byte	0x42
+	.byte	0x10
+	.long	0x5be
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0xc
+	.byte	0x43
+	.byte	0x10
+	.long	0x5be
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0xc
+	.byte	0x44
+	.byte	0x10
+	.long	0x5be
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0xc
+	.byte	0x45
+	.byte	0x10
+	.long	0x5be
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0xc
+	.byte	0x46
+	.byte	0x10
+	.long	0x5be
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0xc
+	.byte	0x47
+	.byte	0x11
+	.long	0x5e3
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0xc
+	.byte	0x48
+	.byte	0xf
+	.long	0x59e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0xc
+	.byte	0x49
+	.byte	0xf
+	.long	0x59e
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xf
+	.long	0x59e
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0xc
+	.byte	0x4b
+	.byte	0xd
+	.long	0x60d
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0xc
+	.byte	0x4c
+	.byte	0xf
+	.long	0x59e
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0xc
+	.byte	0x4d
+	.byte	0x10
+	.long	0x5be
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0xc
+	.byte	0x4e
+	.byte	0x10
+	.long	0x5be
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0xc
+	.byte	0x4f
+	.byte	0x10
+	.long	0x5be
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0xc
+	.byte	0x50
+	.byte	0x10
+	.long	0x5be
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0xc
+	.byte	0x51
+	.byte	0x10
+	.long	0x5be
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0xc
+	.byte	0x52
+	.byte	0xf
+	.long	0x59e
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0xc
+	.byte	0x53
+	.byte	0xb
+	.long	0xbc
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0xc
+	.byte	0x54
+	.byte	0xf
+	.long	0x59e
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0xc
+	.byte	0x56
+	.byte	0x10
+	.long	0x5be
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF155
+	.byte	0xc
+	.byte	0x57
+	.byte	0x10
+	.long	0x5be
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0xc
+	.byte	0x58
+	.byte	0x10
+	.long	0x5be
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0xc
+	.byte	0x59
+	.byte	0x10
+	.long	0x5be
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0xc
+	.byte	0x5a
+	.byte	0x11
+	.long	0x5e3
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0xc
+	.byte	0x5b
+	.byte	0x10
+	.long	0x5be
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0xc
+	.byte	0x5c
+	.byte	0x10
+	.long	0x5be
+	.byte	0xc8
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x10
+	.long	0x5be
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x10
+	.long	0x5be
+	.byte	0xd8
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0xc
+	.byte	0x5f
+	.byte	0x10
+	.long	0x5be
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0xc
+	.byte	0x61
+	.byte	0x10
+	.long	0x5be
+	.byte	0xe8
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0xc
+	.byte	0x62
+	.byte	0x10
+	.long	0x5be
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0xc
+	.byte	0x63
+	.byte	0x10
+	.long	0x5be
+	.byte	0xf8
+	.uleb128 0x5
+	.long	.LASF167
+	.byte	0x64
+	.byte	0x10
+	.long	0x5be
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF168
+	.byte	0x66
+	.byte	0xf
+	.long	0x59e
+	.value	0x108
+	.uleb128 0x5
+	.long	.LASF169
+	.byte	0x68
+	.byte	0x10
+	.long	0x5be
+	.value	0x110
+	.uleb128 0x5
+	.long	.LASF170
+	.byte	0x69
+	.byte	0x10
+	.long	0x5be
+	.value	0x118
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF171
+	.byte	0xc
+	.byte	0x6a
+	.byte	0x3
+	.long	0x96d
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0xc
+	.byte	0x6c
+	.byte	0x9
+	.long	0xbe4
+	.uleb128 0x1
+	.long	.LASF172
+	.byte	0xc
+	.byte	0x6d
+	.byte	0xd
+	.long	0x62d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF173
+	.byte	0xc
+	.byte	0x6e
+	.byte	0x10
+	.long	0x5be
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF174
+	.byte	0xc
+	.byte	0x6f
+	.byte	0x12
+	.long	0x64d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF175
+	.byte	0xc
+	.byte	0x70
+	.byte	0x12
+	.long	0x64d
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF176
+	.byte	0xc
+	.byte	0x71
+	.byte	0xb
+	.long	0xbc
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF177
+	.byte	0xc
+	.byte	0x72
+	.byte	0x15
+	.long	0x672
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0xc
+	.byte	0x73
+	.byte	0xb
+	.long	0xbc
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0xc
+	.byte	0x74
+	.byte	0x10
+	.long	0x6c6
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0xc
+	.byte	0x76
+	.byte	0x10
+	.long	0x5be
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0xc
+	.byte	0x77
+	.byte	0x12
+	.long	0x64d
+	.byte	0x48
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF182
+	.byte	0xc
+	.byte	0x78
+	.byte	0x3
+	.long	0xb58
+	.uleb128 0x8
+	.byte	0x18
+	.byte	0xc
+	.byte	0x7a
+	.byte	0x9
+	.long	0xc21
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0xc
+	.byte	0x7b
+	.byte	0xd
+	.long	0x62d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0xc
+	.byte	0x7c
+	.byte	0x10
+	.long	0x5be
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0xc
+	.byte	0x7d
+	.byte	0x13
+	.long	0x69c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF186
+	.byte	0xc
+	.byte	0x7e
+	.byte	0x3
+	.long	0xbf0
+	.uleb128 0x3
+	.long	.LASF187
+	.byte	0xc
+	.byte	0x80
+	.byte	0x18
+	.long	0xc39
+	.uleb128 0x4
+	.long	0xc3e
+	.uleb128 0x6
+	.long	0x8dc
+	.long	0xc57
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0xc57
+	.byte	0
+	.uleb128 0x4
+	.long	0x54e
+	.uleb128 0x8
+	.byte	0x20
+	.byte	0xc
+	.byte	0x82
+	.byte	0x9
+	.long	0xc9a
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0xc
+	.byte	0x83
+	.byte	0xf
+	.long	0x59e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0xc
+	.byte	0x84
+	.byte	0xf
+	.long	0x59e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0xc
+	.byte	0x85
+	.byte	0xf
+	.long	0x59e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0xc
+	.byte	0x86
+	.byte	0xe
+	.long	0xc2d
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF192
+	.byte	0xc
+	.byte	0x87
+	.byte	0x3
+	.long	0xc5c
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0xc
+	.byte	0x89
+	.byte	0x9
+	.long	0xcca
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0xc
+	.byte	0x8a
+	.byte	0x14
+	.long	0x8e9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0xc
+	.byte	0x8b
+	.byte	0x18
+	.long	0x918
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF195
+	.byte	0xc
+	.byte	0x8c
+	.byte	0x3
+	.long	0xca6
+	.uleb128 0x4
+	.long	0xc9a
+	.uleb128 0x4
+	.long	0xb4c
+	.uleb128 0x4
+	.long	0xbe4
+	.uleb128 0x4
+	.long	0xc21
+	.uleb128 0x4
+	.long	0xcca
+	.uleb128 0x4
+	.long	0x132
+	.uleb128 0x4
+	.long	0x1d9
+	.uleb128 0x4
+	.long	0x17f
+	.uleb128 0x3
+	.long	.LASF196
+	.byte	0xe
+	.byte	0x66
+	.byte	0x12
+	.long	0x100
+	.uleb128 0x3
+	.long	.LASF197
+	.byte	0xe
+	.byte	0x67
+	.byte	0x12
+	.long	0xf4
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0xe
+	.byte	0x68
+	.byte	0x11
+	.long	0xe8
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.byte	0x95
+	.byte	0x5
+	.long	0xd68
+	.uleb128 0xd
+	.long	.LASF199
+	.byte	0x9e
+	.long	0x83
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF200
+	.byte	0xba
+	.long	0x83
+	.byte	0x3
+	.byte	0x2
+	.uleb128 0xd
+	.long	.LASF201
+	.byte	0xbf
+	.long	0x83
+	.byte	0x1
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF202
+	.byte	0xc3
+	.long	0x83
+	.byte	0x1
+	.byte	0x6
+	.uleb128 0xd
+	.long	.LASF203
+	.byte	0xc8
+	.long	0x83
+	.byte	0x1
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.byte	0x30
+	.byte	0x3
+	.byte	0x48
+	.byte	0x9
+	.long	0xdb3
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x3
+	.byte	0x92
+	.byte	0xe
+	.long	0x1ea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x3
+	.byte	0x93
+	.byte	0x10
+	.long	0x10c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x3
+	.byte	0x94
+	.byte	0xf
+	.long	0x118
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0x3
+	.byte	0xcc
+	.byte	0x7
+	.long	0xd22
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x3
+	.byte	0xcd
+	.byte	0xe
+	.long	0xdb3
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	0x3d
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0x3
+	.byte	0xce
+	.byte	0x3
+	.long	0xd68
+	.uleb128 0x8
+	.byte	0x48
+	.byte	0x3
+	.byte	0xd3
+	.byte	0x9
+	.long	0xe02
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0x3
+	.byte	0xd4
+	.byte	0x13
+	.long	0xdb8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0x3
+	.byte	0xd5
+	.byte	0x10
+	.long	0x10c
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0x3
+	.byte	0xd7
+	.byte	0xb
+	.long	0xca
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0x3
+	.byte	0xd8
+	.byte	0x10
+	.long	0x10c
+	.byte	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF213
+	.byte	0x3
+	.byte	0xda
+	.byte	0x3
+	.long	0xdc4
+	.uleb128 0x29
+	.byte	0x8
+	.byte	0x3
+	.byte	0xe1
+	.byte	0x5
+	.long	0xe42
+	.uleb128 0x2a
+	.string	"any"
+	.byte	0x3
+	.byte	0xe2
+	.byte	0xf
+	.long	0xbc
+	.uleb128 0x12
+	.long	.LASF214
+	.byte	0xe3
+	.long	0xe42
+	.uleb128 0x12
+	.long	.LASF215
+	.byte	0xe4
+	.long	0xe47
+	.uleb128 0x12
+	.long	.LASF216
+	.byte	0xe5
+	.long	0xe4c
+	.byte	0
+	.uleb128 0x4
+	.long	0xd16
+	.uleb128 0x4
+	.long	0xd0a
+	.uleb128 0x4
+	.long	0xcfe
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0x3
+	.byte	0xdf
+	.byte	0x9
+	.long	0xe75
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0x3
+	.byte	0xe0
+	.byte	0x1c
+	.long	0xe02
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0x3
+	.byte	0xe6
+	.byte	0x7
+	.long	0xe0e
+	.byte	0x48
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF218
+	.byte	0x3
+	.byte	0xe7
+	.byte	0x3
+	.long	0xe51
+	.uleb128 0x3
+	.long	.LASF219
+	.byte	0xa
+	.byte	0x13
+	.byte	0x15
+	.long	0x5ca
+	.uleb128 0x4
+	.long	0xe92
+	.uleb128 0x6
+	.long	0x54e
+	.long	0xea6
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF220
+	.byte	0xb
+	.byte	0x8
+	.byte	0x15
+	.long	0xe8d
+	.uleb128 0x3
+	.long	.LASF221
+	.byte	0xb
+	.byte	0x9
+	.byte	0xf
+	.long	0xebe
+	.uleb128 0x4
+	.long	0xec3
+	.uleb128 0x6
+	.long	0x4a
+	.long	0xedc
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0x4
+	.long	0x7e
+	.uleb128 0x17
+	.long	.LASF222
+	.byte	0x2b
+	.byte	0xe
+	.long	0xbc
+	.long	0xf00
+	.uleb128 0x2
+	.long	0xbc
+	.uleb128 0x2
+	.long	0xe2
+	.uleb128 0x2
+	.long	0x2a
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF223
+	.byte	0x3
+	.value	0x1d8
+	.byte	0x34
+	.long	0x54e
+	.long	0xf1c
+	.uleb128 0x2
+	.long	0x10c
+	.uleb128 0x2
+	.long	0xcfe
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF243
+	.byte	0x2
+	.value	0x1e4
+	.byte	0x2f
+	.long	0xf2f
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF224
+	.byte	0x9c
+	.byte	0xc
+	.long	0x4a
+	.long	0xf49
+	.uleb128 0x2
+	.long	0x66
+	.uleb128 0x2
+	.long	0x66
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF225
+	.byte	0x3
+	.value	0x359
+	.byte	0x37
+	.long	0x66
+	.long	0xf60
+	.uleb128 0x2
+	.long	0x54e
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF226
+	.byte	0xe
+	.value	0x198
+	.byte	0x34
+	.long	0x54e
+	.long	0xf81
+	.uleb128 0x2
+	.long	0x54e
+	.uleb128 0x2
+	.long	0x66
+	.uleb128 0x2
+	.long	0x66
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF230
+	.byte	0x30
+	.byte	0xb
+	.long	0x54e
+	.quad	.LFB85
+	.quad	.LFE85-.LFB85
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x111f
+	.uleb128 0x14
+	.long	.LASF227
+	.byte	0x30
+	.byte	0x39
+	.long	0x66
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x14
+	.long	.LASF228
+	.byte	0x30
+	.byte	0x4c
+	.long	0x10c
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x2c
+	.string	"s"
+	.byte	0x1
+	.byte	0x33
+	.byte	0x18
+	.long	0xedc
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x2d
+	.long	.LASF229
+	.byte	0x1
+	.byte	0x34
+	.byte	0xd
+	.long	0x54e
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2e
+	.long	0x122f
+	.quad	.LBI35
+	.byte	.LVU33
+	.long	.LLRL10
+	.byte	0x1
+	.byte	0x39
+	.byte	0x16
+	.long	0x10e6
+	.uleb128 0x9
+	.long	0x1240
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x19
+	.long	0x1293
+	.quad	.LBI37
+	.byte	.LVU35
+	.quad	.LBB37
+	.quad	.LBE37-.LBB37
+	.value	0x151
+	.byte	0x9
+	.long	0x1047
+	.uleb128 0x9
+	.long	0x12a4
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x19
+	.long	0x124c
+	.quad	.LBI39
+	.byte	.LVU41
+	.quad	.LBB39
+	.quad	.LBE39-.LBB39
+	.value	0x154
+	.byte	0xc
+	.long	0x1087
+	.uleb128 0x9
+	.long	0x125d
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1a
+	.long	0x1268
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.uleb128 0x1b
+	.long	0x1276
+	.quad	.LBI41
+	.byte	.LVU56
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.value	0x152
+	.byte	0x10
+	.uleb128 0x9
+	.long	0x1287
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x1b
+	.long	0x12b0
+	.quad	.LBI43
+	.byte	.LVU58
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.value	0x142
+	.byte	0x9
+	.uleb128 0x9
+	.long	0x12c1
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL8
+	.long	0xf00
+	.long	0x1104
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x2f
+	.quad	.LVL14
+	.long	0x131d
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF231
+	.byte	0x1d
+	.byte	0x5
+	.long	0x4a
+	.quad	.LFB84
+	.quad	.LFE84-.LFB84
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x122f
+	.uleb128 0x30
+	.string	"ptr"
+	.byte	0x1
+	.byte	0x1d
+	.byte	0x31
+	.long	0x54e
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x14
+	.long	.LASF32
+	.byte	0x1d
+	.byte	0x42
+	.long	0x66
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x31
+	.long	.LASF244
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x7
+	.long	0x4a
+	.sleb128 -1
+	.uleb128 0x32
+	.long	0x1186
+	.uleb128 0x33
+	.string	"tmp"
+	.byte	0x1
+	.byte	0x23
+	.byte	0x11
+	.long	0x54e
+	.byte	0
+	.uleb128 0x1d
+	.long	0x1300
+	.quad	.LBI31
+	.byte	.LVU3
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.long	0x11b6
+	.uleb128 0x9
+	.long	0x1311
+	.long	.LLST2
+	.long	.LVUS2
+	.byte	0
+	.uleb128 0x1d
+	.long	0x12cd
+	.quad	.LBI33
+	.byte	.LVU6
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.long	0x1200
+	.uleb128 0x9
+	.long	0x12e8
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x9
+	.long	0x12de
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x1a
+	.long	0x12f2
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL1
+	.long	0xf49
+	.long	0x1219
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x34
+	.quad	.LVL3
+	.long	0xf2f
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF232
+	.byte	0x3
+	.value	0x150
+	.byte	0x15
+	.long	0xbc
+	.long	0x124c
+	.uleb128 0xe
+	.string	"op"
+	.value	0x150
+	.byte	0x2e
+	.long	0x54e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF233
+	.byte	0x3
+	.value	0x148
+	.byte	0x15
+	.long	0xbc
+	.long	0x1276
+	.uleb128 0xe
+	.string	"op"
+	.value	0x148
+	.byte	0x3a
+	.long	0x54e
+	.uleb128 0x1e
+	.long	.LASF217
+	.byte	0x3
+	.value	0x149
+	.byte	0xb
+	.long	0xbc
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF234
+	.byte	0x3
+	.value	0x141
+	.byte	0x15
+	.long	0xbc
+	.long	0x1293
+	.uleb128 0xe
+	.string	"op"
+	.value	0x141
+	.byte	0x37
+	.long	0x54e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF235
+	.byte	0x3
+	.value	0x120
+	.byte	0x1c
+	.long	0x83
+	.long	0x12b0
+	.uleb128 0xe
+	.string	"op"
+	.value	0x120
+	.byte	0x3b
+	.long	0x54e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF236
+	.byte	0x3
+	.value	0x116
+	.byte	0x1c
+	.long	0x83
+	.long	0x12cd
+	.uleb128 0xe
+	.string	"op"
+	.value	0x116
+	.byte	0x39
+	.long	0x54e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF237
+	.byte	0x2
+	.value	0x2fb
+	.byte	0x1
+	.long	0x4a
+	.long	0x1300
+	.uleb128 0x1f
+	.long	.LASF238
+	.byte	0x21
+	.long	0x569
+	.uleb128 0x1f
+	.long	.LASF239
+	.byte	0x35
+	.long	0x36
+	.uleb128 0x1e
+	.long	.LASF240
+	.byte	0x2
+	.value	0x2fd
+	.byte	0x13
+	.long	0x36
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF241
+	.byte	0x2
+	.byte	0x84
+	.byte	0x1d
+	.long	0x569
+	.byte	0x3
+	.long	0x131d
+	.uleb128 0x36
+	.string	"ob"
+	.byte	0x2
+	.byte	0x84
+	.byte	0x2f
+	.long	0x54e
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF222
+	.long	.LASF245
+	.byte	0x10
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0xd
+	.uleb128 0xb
+	.uleb128 0x6b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 763
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL7-.LVL4
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.LVL4
+	.uleb128 .LVL17-.LVL4
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL17-.LVL4
+	.uleb128 .LVL18-.LVL4
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.LVL4
+	.uleb128 .LFE85-.LVL4
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 .LVL18-.LVL4
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.LVL4
+	.uleb128 .LFE85-.LVL4
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU23
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL7-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.LVL5
+	.uleb128 .LVL17-.LVL5
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL17-.LVL5
+	.uleb128 .LVL18-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.LVL5
+	.uleb128 .LFE85-.LVL5
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU24
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST9:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL9-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.LVL5
+	.uleb128 .LVL11-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.LVL5
+	.uleb128 .LVL15-.LVL5
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL15-.LVL5
+	.uleb128 .LVL18-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.LVL5
+	.uleb128 .LFE85-.LVL5
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU33
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU48
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL10
+	.byte	0x4
+	.uleb128 .LVL10-.LVL10
+	.uleb128 .LVL11-.LVL10
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.LVL10
+	.uleb128 .LVL13-.LVL10
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.LVL10
+	.uleb128 .LFE85-.LVL10
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU35
+	.uleb128 .LVU37
+.LLST12:
+	.byte	0x8
+	.quad	.LVL10
+	.uleb128 .LVL10-.LVL10
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU41
+	.uleb128 .LVU48
+.LLST13:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU46
+	.uleb128 .LVU48
+.LLST14:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL13-.LVL13
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU56
+	.uleb128 0
+.LLST15:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LFE85-.LVL18
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU58
+	.uleb128 .LVU61
+.LLST16:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL18-.LVL18
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LVL3-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.LVL0
+	.uleb128 .LFE84-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL2-.LVL0
+	.uleb128 .LVL3-1-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-1-.LVL0
+	.uleb128 .LVL3-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.LVL0
+	.uleb128 .LFE84-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU3
+	.uleb128 .LVU5
+.LLST2:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU5
+	.uleb128 .LVU10
+.LLST3:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x48
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU5
+	.uleb128 .LVU10
+.LLST4:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU9
+	.uleb128 .LVU10
+.LLST5:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL0-.LVL0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0xa8
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL10:
+	.byte	0x5
+	.quad	.LBB35
+	.byte	0x4
+	.uleb128 .LBB35-.LBB35
+	.uleb128 .LBE35-.LBB35
+	.byte	0x4
+	.uleb128 .LBB46-.LBB35
+	.uleb128 .LBE46-.LBB35
+	.byte	0
+.LLRL17:
+	.byte	0x7
+	.quad	.Ltext0
+	.uleb128 .Letext0-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF226:
+	.string	"PyUnicode_AsEncodedString"
+.LASF126:
+	.string	"newfunc"
+.LASF235:
+	.string	"PyUnicode_IS_COMPACT"
+.LASF54:
+	.string	"tp_hash"
+.LASF32:
+	.string	"name"
+.LASF102:
+	.string	"binaryfunc"
+.LASF100:
+	.string	"PyVarObject"
+.LASF95:
+	.string	"strides"
+.LASF158:
+	.string	"nb_inplace_power"
+.LASF23:
+	.string	"Py_hash_t"
+.LASF93:
+	.string	"format"
+.LASF31:
+	.string	"PyGetSetDef"
+.LASF117:
+	.string	"setattrofunc"
+.LASF240:
+	.string	"flags"
+.LASF45:
+	.string	"tp_dealloc"
+.LASF227:
+	.string	"buffer"
+.LASF162:
+	.string	"nb_inplace_xor"
+.LASF91:
+	.string	"readonly"
+.LASF53:
+	.string	"tp_as_mapping"
+.LASF169:
+	.string	"nb_matrix_multiply"
+.LASF192:
+	.string	"PyAsyncMethods"
+.LASF42:
+	.string	"tp_name"
+.LASF128:
+	.string	"PYGEN_RETURN"
+.LASF194:
+	.string	"bf_releasebuffer"
+.LASF131:
+	.string	"PySendResult"
+.LASF236:
+	.string	"PyUnicode_IS_ASCII"
+.LASF199:
+	.string	"interned"
+.LASF3:
+	.string	"wchar_t"
+.LASF59:
+	.string	"tp_as_buffer"
+.LASF76:
+	.string	"tp_init"
+.LASF231:
+	.string	"PyHlhdfAPI_CompareWithASCIIString"
+.LASF62:
+	.string	"tp_traverse"
+.LASF105:
+	.string	"lenfunc"
+.LASF145:
+	.string	"nb_invert"
+.LASF116:
+	.string	"setattrfunc"
+.LASF92:
+	.string	"ndim"
+.LASF85:
+	.string	"tp_weaklist"
+.LASF245:
+	.string	"__builtin_memcpy"
+.LASF114:
+	.string	"getattrfunc"
+.LASF28:
+	.string	"ml_meth"
+.LASF113:
+	.string	"destructor"
+.LASF233:
+	.string	"_PyUnicode_NONCOMPACT_DATA"
+.LASF65:
+	.string	"tp_weaklistoffset"
+.LASF175:
+	.string	"sq_item"
+.LASF47:
+	.string	"tp_getattr"
+.LASF134:
+	.string	"vectorcallfunc"
+.LASF21:
+	.string	"uint32_t"
+.LASF191:
+	.string	"am_send"
+.LASF154:
+	.string	"nb_inplace_add"
+.LASF124:
+	.string	"descrsetfunc"
+.LASF24:
+	.string	"float"
+.LASF41:
+	.string	"ob_base"
+.LASF172:
+	.string	"sq_length"
+.LASF66:
+	.string	"tp_iter"
+.LASF150:
+	.string	"nb_or"
+.LASF157:
+	.string	"nb_inplace_remainder"
+.LASF244:
+	.string	"result"
+.LASF243:
+	.string	"Py_DecRef"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF83:
+	.string	"tp_cache"
+.LASF137:
+	.string	"nb_multiply"
+.LASF57:
+	.string	"tp_getattro"
+.LASF125:
+	.string	"initproc"
+.LASF49:
+	.string	"tp_as_async"
+.LASF119:
+	.string	"hashfunc"
+.LASF67:
+	.string	"tp_iternext"
+.LASF200:
+	.string	"kind"
+.LASF195:
+	.string	"PyBufferProcs"
+.LASF230:
+	.string	"PyHlhdf_StringOrUnicode_FromASCII"
+.LASF14:
+	.string	"__uint16_t"
+.LASF212:
+	.string	"wstr_length"
+.LASF142:
+	.string	"nb_positive"
+.LASF133:
+	.string	"releasebufferproc"
+.LASF89:
+	.string	"tp_vectorcall"
+.LASF36:
+	.string	"_object"
+.LASF241:
+	.string	"Py_TYPE"
+.LASF2:
+	.string	"size_t"
+.LASF94:
+	.string	"shape"
+.LASF64:
+	.string	"tp_richcompare"
+.LASF225:
+	.string	"PyUnicode_AsUTF8"
+.LASF242:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fwrapv -fPIC -fasynchronous-unwind-tables"
+.LASF198:
+	.string	"Py_UCS1"
+.LASF197:
+	.string	"Py_UCS2"
+.LASF196:
+	.string	"Py_UCS4"
+.LASF130:
+	.string	"PYGEN_NEXT"
+.LASF160:
+	.string	"nb_inplace_rshift"
+.LASF170:
+	.string	"nb_inplace_matrix_multiply"
+.LASF77:
+	.string	"tp_alloc"
+.LASF220:
+	.string	"getter"
+.LASF82:
+	.string	"tp_mro"
+.LASF176:
+	.string	"was_sq_slice"
+.LASF232:
+	.string	"PyUnicode_DATA"
+.LASF84:
+	.string	"tp_subclasses"
+.LASF39:
+	.string	"PyTypeObject"
+.LASF22:
+	.string	"Py_ssize_t"
+.LASF166:
+	.string	"nb_inplace_floor_divide"
+.LASF70:
+	.string	"tp_getset"
+.LASF8:
+	.string	"char"
+.LASF97:
+	.string	"internal"
+.LASF98:
+	.string	"Py_buffer"
+.LASF180:
+	.string	"sq_inplace_concat"
+.LASF217:
+	.string	"data"
+.LASF141:
+	.string	"nb_negative"
+.LASF140:
+	.string	"nb_power"
+.LASF17:
+	.string	"ssize_t"
+.LASF207:
+	.string	"wstr"
+.LASF19:
+	.string	"uint8_t"
+.LASF40:
+	.string	"_typeobject"
+.LASF143:
+	.string	"nb_absolute"
+.LASF189:
+	.string	"am_aiter"
+.LASF173:
+	.string	"sq_concat"
+.LASF186:
+	.string	"PyMappingMethods"
+.LASF6:
+	.string	"long long int"
+.LASF209:
+	.string	"_base"
+.LASF110:
+	.string	"visitproc"
+.LASF90:
+	.string	"itemsize"
+.LASF69:
+	.string	"tp_members"
+.LASF138:
+	.string	"nb_remainder"
+.LASF35:
+	.string	"PyObject"
+.LASF147:
+	.string	"nb_rshift"
+.LASF223:
+	.string	"PyUnicode_New"
+.LASF203:
+	.string	"ready"
+.LASF58:
+	.string	"tp_setattro"
+.LASF123:
+	.string	"descrgetfunc"
+.LASF188:
+	.string	"am_await"
+.LASF71:
+	.string	"tp_base"
+.LASF127:
+	.string	"allocfunc"
+.LASF228:
+	.string	"size"
+.LASF163:
+	.string	"nb_inplace_or"
+.LASF183:
+	.string	"mp_length"
+.LASF61:
+	.string	"tp_doc"
+.LASF68:
+	.string	"tp_methods"
+.LASF219:
+	.string	"PyCFunction"
+.LASF148:
+	.string	"nb_and"
+.LASF44:
+	.string	"tp_itemsize"
+.LASF108:
+	.string	"objobjargproc"
+.LASF221:
+	.string	"setter"
+.LASF178:
+	.string	"was_sq_ass_slice"
+.LASF239:
+	.string	"feature"
+.LASF43:
+	.string	"tp_basicsize"
+.LASF87:
+	.string	"tp_version_tag"
+.LASF164:
+	.string	"nb_floor_divide"
+.LASF112:
+	.string	"freefunc"
+.LASF20:
+	.string	"uint16_t"
+.LASF129:
+	.string	"PYGEN_ERROR"
+.LASF73:
+	.string	"tp_descr_get"
+.LASF184:
+	.string	"mp_subscript"
+.LASF122:
+	.string	"iternextfunc"
+.LASF15:
+	.string	"__uint32_t"
+.LASF190:
+	.string	"am_anext"
+.LASF60:
+	.string	"tp_flags"
+.LASF99:
+	.string	"ob_size"
+.LASF109:
+	.string	"objobjproc"
+.LASF155:
+	.string	"nb_inplace_subtract"
+.LASF201:
+	.string	"compact"
+.LASF13:
+	.string	"short int"
+.LASF152:
+	.string	"nb_reserved"
+.LASF55:
+	.string	"tp_call"
+.LASF5:
+	.string	"long int"
+.LASF27:
+	.string	"ml_name"
+.LASF79:
+	.string	"tp_free"
+.LASF205:
+	.string	"hash"
+.LASF37:
+	.string	"ob_refcnt"
+.LASF204:
+	.string	"length"
+.LASF229:
+	.string	"unicode"
+.LASF81:
+	.string	"tp_bases"
+.LASF30:
+	.string	"ml_doc"
+.LASF33:
+	.string	"closure"
+.LASF211:
+	.string	"utf8"
+.LASF26:
+	.string	"PyMethodDef"
+.LASF50:
+	.string	"tp_repr"
+.LASF179:
+	.string	"sq_contains"
+.LASF177:
+	.string	"sq_ass_item"
+.LASF16:
+	.string	"__ssize_t"
+.LASF12:
+	.string	"__uint8_t"
+.LASF202:
+	.string	"ascii"
+.LASF213:
+	.string	"PyCompactUnicodeObject"
+.LASF118:
+	.string	"reprfunc"
+.LASF185:
+	.string	"mp_ass_subscript"
+.LASF10:
+	.string	"unsigned int"
+.LASF107:
+	.string	"ssizeobjargproc"
+.LASF153:
+	.string	"nb_float"
+.LASF165:
+	.string	"nb_true_divide"
+.LASF151:
+	.string	"nb_int"
+.LASF168:
+	.string	"nb_index"
+.LASF234:
+	.string	"_PyUnicode_COMPACT_DATA"
+.LASF208:
+	.string	"PyASCIIObject"
+.LASF4:
+	.string	"long unsigned int"
+.LASF149:
+	.string	"nb_xor"
+.LASF182:
+	.string	"PySequenceMethods"
+.LASF237:
+	.string	"PyType_HasFeature"
+.LASF206:
+	.string	"state"
+.LASF34:
+	.string	"PyMemberDef"
+.LASF215:
+	.string	"ucs2"
+.LASF216:
+	.string	"ucs4"
+.LASF238:
+	.string	"type"
+.LASF171:
+	.string	"PyNumberMethods"
+.LASF9:
+	.string	"unsigned char"
+.LASF159:
+	.string	"nb_inplace_lshift"
+.LASF80:
+	.string	"tp_is_gc"
+.LASF187:
+	.string	"sendfunc"
+.LASF52:
+	.string	"tp_as_sequence"
+.LASF111:
+	.string	"traverseproc"
+.LASF139:
+	.string	"nb_divmod"
+.LASF75:
+	.string	"tp_dictoffset"
+.LASF72:
+	.string	"tp_dict"
+.LASF210:
+	.string	"utf8_length"
+.LASF161:
+	.string	"nb_inplace_and"
+.LASF103:
+	.string	"ternaryfunc"
+.LASF56:
+	.string	"tp_str"
+.LASF29:
+	.string	"ml_flags"
+.LASF96:
+	.string	"suboffsets"
+.LASF115:
+	.string	"getattrofunc"
+.LASF63:
+	.string	"tp_clear"
+.LASF120:
+	.string	"richcmpfunc"
+.LASF214:
+	.string	"latin1"
+.LASF51:
+	.string	"tp_as_number"
+.LASF48:
+	.string	"tp_setattr"
+.LASF74:
+	.string	"tp_descr_set"
+.LASF193:
+	.string	"bf_getbuffer"
+.LASF78:
+	.string	"tp_new"
+.LASF11:
+	.string	"signed char"
+.LASF146:
+	.string	"nb_lshift"
+.LASF7:
+	.string	"short unsigned int"
+.LASF181:
+	.string	"sq_inplace_repeat"
+.LASF222:
+	.string	"memcpy"
+.LASF38:
+	.string	"ob_type"
+.LASF132:
+	.string	"getbufferproc"
+.LASF135:
+	.string	"nb_add"
+.LASF46:
+	.string	"tp_vectorcall_offset"
+.LASF86:
+	.string	"tp_del"
+.LASF167:
+	.string	"nb_inplace_true_divide"
+.LASF156:
+	.string	"nb_inplace_multiply"
+.LASF88:
+	.string	"tp_finalize"
+.LASF25:
+	.string	"double"
+.LASF144:
+	.string	"nb_bool"
+.LASF218:
+	.string	"PyUnicodeObject"
+.LASF174:
+	.string	"sq_repeat"
+.LASF136:
+	.string	"nb_subtract"
+.LASF106:
+	.string	"ssizeargfunc"
+.LASF101:
+	.string	"unaryfunc"
+.LASF104:
+	.string	"inquiry"
+.LASF224:
+	.string	"strcmp"
+.LASF121:
+	.string	"getiterfunc"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"pyhlcompat.c"
+.LASF1:
+	.string	"/root/repo/pyhlhdf"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -590,6 +590,10 @@ int pyarraytypeFromHdfType(const char* format)
     return PyArray_FLOAT;
   } else if (strcmp(format, "double") == 0) {
     return PyArray_DOUBLE;
+  } else if (strcmp(format, "half") == 0) {
+    return NPY_HALF;
+  } else if (strcmp(format, "bfloat16") == 0) {
+    return NPY_USHORT; /* numpy has no bfloat16, the bit patterns are returned */
   } else {
     fprintf(stderr, "Unsupported type %s\n", format);
     return -1;
@@ -291,7 +291,9 @@ int setObjectString_Length(PyObject* info,char* keyname,char* in_string,int len)
 char* translatePyFormatToHlHdf(char type);
 
 /**
- * Translates an hlhdf represented type into a PyArray known format
+ * Translates an hlhdf represented type into a PyArray known format.
+ * Since numpy has no bfloat16 type, 'bfloat16' is translated into unsigned
+ * short holding the bit patterns of the values.
  * @param[in] format	The hlhdf representation
  * @return The PyArray type if ok, -1 otherwise
  */
@@ -0,0 +1,24530 @@
+# 0 "pyhlhdf_common.c"
+# 1 "/root/repo/pyhlhdf//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pyhlhdf_common.c"
+# 27 "pyhlhdf_common.c"
+# 1 "pyhlhdf_common.h" 1
+# 30 "pyhlhdf_common.h"
+# 1 "pyhlcompat.h" 1
+# 33 "pyhlcompat.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 1
+# 11 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/patchlevel.h" 1
+# 12 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pyconfig.h" 1
+# 13 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pymacconfig.h" 1
+# 14 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 23 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h"
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 56 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64 strtof64 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float128 strtof128 (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float32x strtof32x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64x strtof64x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int strfromd (char *__dest, size_t __size, const char *__format,
+       double __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+extern int strfromf (char *__dest, size_t __size, const char *__format,
+       float __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+extern int strfroml (char *__dest, size_t __size, const char *__format,
+       long double __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 233 "/usr/include/stdlib.h" 3 4
+extern int strfromf32 (char *__dest, size_t __size, const char * __format,
+         _Float32 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64 (char *__dest, size_t __size, const char * __format,
+         _Float64 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf128 (char *__dest, size_t __size, const char * __format,
+   _Float128 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf32x (char *__dest, size_t __size, const char * __format,
+   _Float32x __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64x (char *__dest, size_t __size, const char * __format,
+   _Float64x __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 273 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 274 "/usr/include/stdlib.h" 2 3 4
+
+extern long int strtol_l (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+extern unsigned long int strtoul_l (const char *__restrict __nptr,
+        char **__restrict __endptr,
+        int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern long long int strtoll_l (const char *__restrict __nptr,
+    char **__restrict __endptr, int __base,
+    locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern unsigned long long int strtoull_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+extern double strtod_l (const char *__restrict __nptr,
+   char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+extern float strtof_l (const char *__restrict __nptr,
+         char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+extern long double strtold_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+# 317 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64 strtof64_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float128 strtof128_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float32x strtof32x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64x strtof64x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 30 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+
+
+typedef __ino64_t ino_t;
+
+
+
+
+typedef __ino64_t ino64_t;
+
+
+
+
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+
+
+typedef __off64_t off_t;
+
+
+
+
+typedef __off64_t off64_t;
+
+
+
+
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+
+
+
+
+typedef __ssize_t ssize_t;
+
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __useconds_t useconds_t;
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+# 49 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+    __fd_mask fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+# 205 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __blkcnt64_t blkcnt_t;
+
+
+
+typedef __fsblkcnt64_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt64_t fsfilcnt_t;
+
+
+
+
+
+typedef __blkcnt64_t blkcnt64_t;
+typedef __fsblkcnt64_t fsblkcnt64_t;
+typedef __fsfilcnt64_t fsfilcnt64_t;
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern char *secure_getenv (const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 711 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __asm__ ("" "mkstemp64")
+     __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+extern int mkstemp64 (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 733 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __asm__ ("" "mkstemps64")
+                     __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+extern int mkstemps64 (char *__template, int __suffixlen)
+     __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 765 "/usr/include/stdlib.h" 3 4
+extern int mkostemp (char *__template, int __flags) __asm__ ("" "mkostemp64")
+     __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+extern int mkostemp64 (char *__template, int __flags) __attribute__ ((__nonnull__ (1))) ;
+# 786 "/usr/include/stdlib.h" 3 4
+extern int mkostemps (char *__template, int __suffixlen, int __flags) __asm__ ("" "mkostemps64")
+
+     __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+extern int mkostemps64 (char *__template, int __suffixlen, int __flags)
+     __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+
+
+
+
+
+extern char *canonicalize_file_name (const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__malloc__))
+     __attribute__ ((__malloc__ (__builtin_free, 1))) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+
+
+typedef __compar_fn_t comparison_fn_t;
+
+
+
+typedef int (*__compar_d_fn_t) (const void *, const void *, void *);
+
+
+
+
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+
+extern void qsort_r (void *__base, size_t __nmemb, size_t __size,
+       __compar_d_fn_t __compar, void *__arg)
+  __attribute__ ((__nonnull__ (1, 4)));
+
+
+
+
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+
+
+
+
+
+
+
+extern int posix_openpt (int __oflag) ;
+
+
+
+
+
+
+
+extern int grantpt (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int unlockpt (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern char *ptsname (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int ptsname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+extern int getpt (void);
+
+
+
+
+
+
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 24 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/cookie_io_functions_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/cookie_io_functions_t.h" 3 4
+typedef __ssize_t cookie_read_function_t (void *__cookie, char *__buf,
+                                          size_t __nbytes);
+
+
+
+
+
+
+
+typedef __ssize_t cookie_write_function_t (void *__cookie, const char *__buf,
+                                           size_t __nbytes);
+
+
+
+
+
+
+
+typedef int cookie_seek_function_t (void *__cookie, __off64_t *__pos, int __w);
+
+
+typedef int cookie_close_function_t (void *__cookie);
+
+
+
+
+
+
+typedef struct _IO_cookie_io_functions_t
+{
+  cookie_read_function_t *read;
+  cookie_write_function_t *write;
+  cookie_seek_function_t *seek;
+  cookie_close_function_t *close;
+} cookie_io_functions_t;
+# 47 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+typedef __gnuc_va_list va_list;
+# 86 "/usr/include/stdio.h" 3 4
+typedef __fpos64_t fpos_t;
+
+
+typedef __fpos64_t fpos64_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 170 "/usr/include/stdio.h" 3 4
+extern int renameat2 (int __oldfd, const char *__old, int __newfd,
+        const char *__new, unsigned int __flags) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int fclose (FILE *__stream);
+# 192 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void) __asm__ ("" "tmpfile64")
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+
+
+extern FILE *tmpfile64 (void)
+   __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 249 "/usr/include/stdio.h" 3 4
+extern int fcloseall (void);
+# 270 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename, const char *__restrict __modes) __asm__ ("" "fopen64")
+
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+extern FILE *freopen (const char *__restrict __filename, const char *__restrict __modes, FILE *__restrict __stream) __asm__ ("" "freopen64")
+
+
+  ;
+
+
+
+
+
+
+extern FILE *fopen64 (const char *__restrict __filename,
+        const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+extern FILE *freopen64 (const char *__restrict __filename,
+   const char *__restrict __modes,
+   FILE *__restrict __stream) ;
+
+
+
+
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+
+extern FILE *fopencookie (void *__restrict __magic_cookie,
+     const char *__restrict __modes,
+     cookie_io_functions_t __io_funcs) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+
+
+
+
+
+extern int vasprintf (char **__restrict __ptr, const char *__restrict __f,
+        __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 0))) ;
+extern int __asprintf (char **__restrict __ptr,
+         const char *__restrict __fmt, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 3))) ;
+extern int asprintf (char **__restrict __ptr,
+       const char *__restrict __fmt, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 3))) ;
+
+
+
+
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 434 "/usr/include/stdio.h" 3 4
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 615 "/usr/include/stdio.h" 3 4
+extern char *fgets_unlocked (char *__restrict __s, int __n,
+        FILE *__restrict __stream)
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 691 "/usr/include/stdio.h" 3 4
+extern int fputs_unlocked (const char *__restrict __s,
+      FILE *__restrict __stream);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 744 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off64_t __off, int __whence) __asm__ ("" "fseeko64")
+
+                  ;
+extern __off64_t ftello (FILE *__stream) __asm__ ("" "ftello64");
+# 768 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos) __asm__ ("" "fgetpos64")
+                                          ;
+extern int fsetpos (FILE *__stream, const fpos_t *__pos) __asm__ ("" "fsetpos64")
+                                                          ;
+
+
+
+
+
+
+
+extern int fseeko64 (FILE *__stream, __off64_t __off, int __whence);
+extern __off64_t ftello64 (FILE *__stream) ;
+extern int fgetpos64 (FILE *__restrict __stream, fpos64_t *__restrict __pos);
+extern int fsetpos64 (FILE *__stream, const fpos64_t *__pos);
+
+
+
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+
+
+
+
+
+extern char *cuserid (char *__s)
+  __attribute__ ((__access__ (__write_only__, 1)));
+
+
+
+
+struct obstack;
+
+
+extern int obstack_printf (struct obstack *__restrict __obstack,
+      const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 3)));
+extern int obstack_vprintf (struct obstack *__restrict __obstack,
+       const char *__restrict __format,
+       __gnuc_va_list __args)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 2, 0)));
+
+
+
+
+
+
+
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) __ssize_t
+getline (char **__lineptr, size_t *__n, FILE *__stream)
+{
+  return __getdelim (__lineptr, __n, '\n', __stream);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 25 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/usr/include/errno.h" 1 3 4
+# 28 "/usr/include/errno.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/errno.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/errno.h" 3 4
+# 1 "/usr/include/linux/errno.h" 1 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/errno.h" 1 3 4
+# 1 "/usr/include/asm-generic/errno.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/asm-generic/errno-base.h" 1 3 4
+# 6 "/usr/include/asm-generic/errno.h" 2 3 4
+# 2 "/usr/include/x86_64-linux-gnu/asm/errno.h" 2 3 4
+# 2 "/usr/include/linux/errno.h" 2 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/errno.h" 2 3 4
+# 29 "/usr/include/errno.h" 2 3 4
+
+
+
+
+
+
+
+
+extern int *__errno_location (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern char *program_invocation_name;
+extern char *program_invocation_short_name;
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/error_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/error_t.h" 3 4
+typedef int error_t;
+# 49 "/usr/include/errno.h" 2 3 4
+
+
+
+
+# 26 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 27 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+
+
+# 1 "/usr/include/unistd.h" 1 3 4
+# 27 "/usr/include/unistd.h" 3 4
+
+# 202 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h" 1 3 4
+# 203 "/usr/include/unistd.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/environments.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/environments.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/environments.h" 2 3 4
+# 207 "/usr/include/unistd.h" 2 3 4
+# 226 "/usr/include/unistd.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 227 "/usr/include/unistd.h" 2 3 4
+# 267 "/usr/include/unistd.h" 3 4
+typedef __intptr_t intptr_t;
+
+
+
+
+
+
+typedef __socklen_t socklen_t;
+# 287 "/usr/include/unistd.h" 3 4
+extern int access (const char *__name, int __type) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int euidaccess (const char *__name, int __type)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int eaccess (const char *__name, int __type)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int execveat (int __fd, const char *__path, char *const __argv[],
+                     char *const __envp[], int __flags)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+
+
+
+
+extern int faccessat (int __fd, const char *__file, int __type, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+# 342 "/usr/include/unistd.h" 3 4
+extern __off64_t lseek (int __fd, __off64_t __offset, int __whence) __asm__ ("" "lseek64") __attribute__ ((__nothrow__ , __leaf__))
+
+             ;
+
+
+
+
+
+extern __off64_t lseek64 (int __fd, __off64_t __offset, int __whence)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int close (int __fd);
+
+
+
+
+extern void closefrom (int __lowfd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern ssize_t read (int __fd, void *__buf, size_t __nbytes)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern ssize_t write (int __fd, const void *__buf, size_t __n)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 404 "/usr/include/unistd.h" 3 4
+extern ssize_t pread (int __fd, void *__buf, size_t __nbytes, __off64_t __offset) __asm__ ("" "pread64")
+
+
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+extern ssize_t pwrite (int __fd, const void *__buf, size_t __nbytes, __off64_t __offset) __asm__ ("" "pwrite64")
+
+
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 422 "/usr/include/unistd.h" 3 4
+extern ssize_t pread64 (int __fd, void *__buf, size_t __nbytes,
+   __off64_t __offset)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+extern ssize_t pwrite64 (int __fd, const void *__buf, size_t __n,
+    __off64_t __offset)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+
+
+
+
+
+
+
+extern int pipe (int __pipedes[2]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int pipe2 (int __pipedes[2], int __flags) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 452 "/usr/include/unistd.h" 3 4
+extern unsigned int alarm (unsigned int __seconds) __attribute__ ((__nothrow__ , __leaf__));
+# 464 "/usr/include/unistd.h" 3 4
+extern unsigned int sleep (unsigned int __seconds);
+
+
+
+
+
+
+
+extern __useconds_t ualarm (__useconds_t __value, __useconds_t __interval)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int usleep (__useconds_t __useconds);
+# 489 "/usr/include/unistd.h" 3 4
+extern int pause (void);
+
+
+
+extern int chown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchown (int __fd, __uid_t __owner, __gid_t __group) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int lchown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int fchownat (int __fd, const char *__file, __uid_t __owner,
+       __gid_t __group, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+extern int chdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchdir (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 531 "/usr/include/unistd.h" 3 4
+extern char *getcwd (char *__buf, size_t __size) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern char *get_current_dir_name (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern char *getwd (char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__))
+    __attribute__ ((__access__ (__write_only__, 1)));
+
+
+
+
+extern int dup (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern int dup2 (int __fd, int __fd2) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int dup3 (int __fd, int __fd2, int __flags) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char **__environ;
+
+extern char **environ;
+
+
+
+
+
+extern int execve (const char *__path, char *const __argv[],
+     char *const __envp[]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int fexecve (int __fd, char *const __argv[], char *const __envp[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+extern int execv (const char *__path, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execle (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execl (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execvp (const char *__file, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execlp (const char *__file, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execvpe (const char *__file, char *const __argv[],
+      char *const __envp[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int nice (int __inc) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void _exit (int __status) __attribute__ ((__noreturn__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/confname.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/confname.h" 3 4
+enum
+  {
+    _PC_LINK_MAX,
+
+    _PC_MAX_CANON,
+
+    _PC_MAX_INPUT,
+
+    _PC_NAME_MAX,
+
+    _PC_PATH_MAX,
+
+    _PC_PIPE_BUF,
+
+    _PC_CHOWN_RESTRICTED,
+
+    _PC_NO_TRUNC,
+
+    _PC_VDISABLE,
+
+    _PC_SYNC_IO,
+
+    _PC_ASYNC_IO,
+
+    _PC_PRIO_IO,
+
+    _PC_SOCK_MAXBUF,
+
+    _PC_FILESIZEBITS,
+
+    _PC_REC_INCR_XFER_SIZE,
+
+    _PC_REC_MAX_XFER_SIZE,
+
+    _PC_REC_MIN_XFER_SIZE,
+
+    _PC_REC_XFER_ALIGN,
+
+    _PC_ALLOC_SIZE_MIN,
+
+    _PC_SYMLINK_MAX,
+
+    _PC_2_SYMLINKS
+
+  };
+
+
+enum
+  {
+    _SC_ARG_MAX,
+
+    _SC_CHILD_MAX,
+
+    _SC_CLK_TCK,
+
+    _SC_NGROUPS_MAX,
+
+    _SC_OPEN_MAX,
+
+    _SC_STREAM_MAX,
+
+    _SC_TZNAME_MAX,
+
+    _SC_JOB_CONTROL,
+
+    _SC_SAVED_IDS,
+
+    _SC_REALTIME_SIGNALS,
+
+    _SC_PRIORITY_SCHEDULING,
+
+    _SC_TIMERS,
+
+    _SC_ASYNCHRONOUS_IO,
+
+    _SC_PRIORITIZED_IO,
+
+    _SC_SYNCHRONIZED_IO,
+
+    _SC_FSYNC,
+
+    _SC_MAPPED_FILES,
+
+    _SC_MEMLOCK,
+
+    _SC_MEMLOCK_RANGE,
+
+    _SC_MEMORY_PROTECTION,
+
+    _SC_MESSAGE_PASSING,
+
+    _SC_SEMAPHORES,
+
+    _SC_SHARED_MEMORY_OBJECTS,
+
+    _SC_AIO_LISTIO_MAX,
+
+    _SC_AIO_MAX,
+
+    _SC_AIO_PRIO_DELTA_MAX,
+
+    _SC_DELAYTIMER_MAX,
+
+    _SC_MQ_OPEN_MAX,
+
+    _SC_MQ_PRIO_MAX,
+
+    _SC_VERSION,
+
+    _SC_PAGESIZE,
+
+
+    _SC_RTSIG_MAX,
+
+    _SC_SEM_NSEMS_MAX,
+
+    _SC_SEM_VALUE_MAX,
+
+    _SC_SIGQUEUE_MAX,
+
+    _SC_TIMER_MAX,
+
+
+
+
+    _SC_BC_BASE_MAX,
+
+    _SC_BC_DIM_MAX,
+
+    _SC_BC_SCALE_MAX,
+
+    _SC_BC_STRING_MAX,
+
+    _SC_COLL_WEIGHTS_MAX,
+
+    _SC_EQUIV_CLASS_MAX,
+
+    _SC_EXPR_NEST_MAX,
+
+    _SC_LINE_MAX,
+
+    _SC_RE_DUP_MAX,
+
+    _SC_CHARCLASS_NAME_MAX,
+
+
+    _SC_2_VERSION,
+
+    _SC_2_C_BIND,
+
+    _SC_2_C_DEV,
+
+    _SC_2_FORT_DEV,
+
+    _SC_2_FORT_RUN,
+
+    _SC_2_SW_DEV,
+
+    _SC_2_LOCALEDEF,
+
+
+    _SC_PII,
+
+    _SC_PII_XTI,
+
+    _SC_PII_SOCKET,
+
+    _SC_PII_INTERNET,
+
+    _SC_PII_OSI,
+
+    _SC_POLL,
+
+    _SC_SELECT,
+
+    _SC_UIO_MAXIOV,
+
+    _SC_IOV_MAX = _SC_UIO_MAXIOV,
+
+    _SC_PII_INTERNET_STREAM,
+
+    _SC_PII_INTERNET_DGRAM,
+
+    _SC_PII_OSI_COTS,
+
+    _SC_PII_OSI_CLTS,
+
+    _SC_PII_OSI_M,
+
+    _SC_T_IOV_MAX,
+
+
+
+    _SC_THREADS,
+
+    _SC_THREAD_SAFE_FUNCTIONS,
+
+    _SC_GETGR_R_SIZE_MAX,
+
+    _SC_GETPW_R_SIZE_MAX,
+
+    _SC_LOGIN_NAME_MAX,
+
+    _SC_TTY_NAME_MAX,
+
+    _SC_THREAD_DESTRUCTOR_ITERATIONS,
+
+    _SC_THREAD_KEYS_MAX,
+
+    _SC_THREAD_STACK_MIN,
+
+    _SC_THREAD_THREADS_MAX,
+
+    _SC_THREAD_ATTR_STACKADDR,
+
+    _SC_THREAD_ATTR_STACKSIZE,
+
+    _SC_THREAD_PRIORITY_SCHEDULING,
+
+    _SC_THREAD_PRIO_INHERIT,
+
+    _SC_THREAD_PRIO_PROTECT,
+
+    _SC_THREAD_PROCESS_SHARED,
+
+
+    _SC_NPROCESSORS_CONF,
+
+    _SC_NPROCESSORS_ONLN,
+
+    _SC_PHYS_PAGES,
+
+    _SC_AVPHYS_PAGES,
+
+    _SC_ATEXIT_MAX,
+
+    _SC_PASS_MAX,
+
+
+    _SC_XOPEN_VERSION,
+
+    _SC_XOPEN_XCU_VERSION,
+
+    _SC_XOPEN_UNIX,
+
+    _SC_XOPEN_CRYPT,
+
+    _SC_XOPEN_ENH_I18N,
+
+    _SC_XOPEN_SHM,
+
+
+    _SC_2_CHAR_TERM,
+
+    _SC_2_C_VERSION,
+
+    _SC_2_UPE,
+
+
+    _SC_XOPEN_XPG2,
+
+    _SC_XOPEN_XPG3,
+
+    _SC_XOPEN_XPG4,
+
+
+    _SC_CHAR_BIT,
+
+    _SC_CHAR_MAX,
+
+    _SC_CHAR_MIN,
+
+    _SC_INT_MAX,
+
+    _SC_INT_MIN,
+
+    _SC_LONG_BIT,
+
+    _SC_WORD_BIT,
+
+    _SC_MB_LEN_MAX,
+
+    _SC_NZERO,
+
+    _SC_SSIZE_MAX,
+
+    _SC_SCHAR_MAX,
+
+    _SC_SCHAR_MIN,
+
+    _SC_SHRT_MAX,
+
+    _SC_SHRT_MIN,
+
+    _SC_UCHAR_MAX,
+
+    _SC_UINT_MAX,
+
+    _SC_ULONG_MAX,
+
+    _SC_USHRT_MAX,
+
+
+    _SC_NL_ARGMAX,
+
+    _SC_NL_LANGMAX,
+
+    _SC_NL_MSGMAX,
+
+    _SC_NL_NMAX,
+
+    _SC_NL_SETMAX,
+
+    _SC_NL_TEXTMAX,
+
+
+    _SC_XBS5_ILP32_OFF32,
+
+    _SC_XBS5_ILP32_OFFBIG,
+
+    _SC_XBS5_LP64_OFF64,
+
+    _SC_XBS5_LPBIG_OFFBIG,
+
+
+    _SC_XOPEN_LEGACY,
+
+    _SC_XOPEN_REALTIME,
+
+    _SC_XOPEN_REALTIME_THREADS,
+
+
+    _SC_ADVISORY_INFO,
+
+    _SC_BARRIERS,
+
+    _SC_BASE,
+
+    _SC_C_LANG_SUPPORT,
+
+    _SC_C_LANG_SUPPORT_R,
+
+    _SC_CLOCK_SELECTION,
+
+    _SC_CPUTIME,
+
+    _SC_THREAD_CPUTIME,
+
+    _SC_DEVICE_IO,
+
+    _SC_DEVICE_SPECIFIC,
+
+    _SC_DEVICE_SPECIFIC_R,
+
+    _SC_FD_MGMT,
+
+    _SC_FIFO,
+
+    _SC_PIPE,
+
+    _SC_FILE_ATTRIBUTES,
+
+    _SC_FILE_LOCKING,
+
+    _SC_FILE_SYSTEM,
+
+    _SC_MONOTONIC_CLOCK,
+
+    _SC_MULTI_PROCESS,
+
+    _SC_SINGLE_PROCESS,
+
+    _SC_NETWORKING,
+
+    _SC_READER_WRITER_LOCKS,
+
+    _SC_SPIN_LOCKS,
+
+    _SC_REGEXP,
+
+    _SC_REGEX_VERSION,
+
+    _SC_SHELL,
+
+    _SC_SIGNALS,
+
+    _SC_SPAWN,
+
+    _SC_SPORADIC_SERVER,
+
+    _SC_THREAD_SPORADIC_SERVER,
+
+    _SC_SYSTEM_DATABASE,
+
+    _SC_SYSTEM_DATABASE_R,
+
+    _SC_TIMEOUTS,
+
+    _SC_TYPED_MEMORY_OBJECTS,
+
+    _SC_USER_GROUPS,
+
+    _SC_USER_GROUPS_R,
+
+    _SC_2_PBS,
+
+    _SC_2_PBS_ACCOUNTING,
+
+    _SC_2_PBS_LOCATE,
+
+    _SC_2_PBS_MESSAGE,
+
+    _SC_2_PBS_TRACK,
+
+    _SC_SYMLOOP_MAX,
+
+    _SC_STREAMS,
+
+    _SC_2_PBS_CHECKPOINT,
+
+
+    _SC_V6_ILP32_OFF32,
+
+    _SC_V6_ILP32_OFFBIG,
+
+    _SC_V6_LP64_OFF64,
+
+    _SC_V6_LPBIG_OFFBIG,
+
+
+    _SC_HOST_NAME_MAX,
+
+    _SC_TRACE,
+
+    _SC_TRACE_EVENT_FILTER,
+
+    _SC_TRACE_INHERIT,
+
+    _SC_TRACE_LOG,
+
+
+    _SC_LEVEL1_ICACHE_SIZE,
+
+    _SC_LEVEL1_ICACHE_ASSOC,
+
+    _SC_LEVEL1_ICACHE_LINESIZE,
+
+    _SC_LEVEL1_DCACHE_SIZE,
+
+    _SC_LEVEL1_DCACHE_ASSOC,
+
+    _SC_LEVEL1_DCACHE_LINESIZE,
+
+    _SC_LEVEL2_CACHE_SIZE,
+
+    _SC_LEVEL2_CACHE_ASSOC,
+
+    _SC_LEVEL2_CACHE_LINESIZE,
+
+    _SC_LEVEL3_CACHE_SIZE,
+
+    _SC_LEVEL3_CACHE_ASSOC,
+
+    _SC_LEVEL3_CACHE_LINESIZE,
+
+    _SC_LEVEL4_CACHE_SIZE,
+
+    _SC_LEVEL4_CACHE_ASSOC,
+
+    _SC_LEVEL4_CACHE_LINESIZE,
+
+
+
+    _SC_IPV6 = _SC_LEVEL1_ICACHE_SIZE + 50,
+
+    _SC_RAW_SOCKETS,
+
+
+    _SC_V7_ILP32_OFF32,
+
+    _SC_V7_ILP32_OFFBIG,
+
+    _SC_V7_LP64_OFF64,
+
+    _SC_V7_LPBIG_OFFBIG,
+
+
+    _SC_SS_REPL_MAX,
+
+
+    _SC_TRACE_EVENT_NAME_MAX,
+
+    _SC_TRACE_NAME_MAX,
+
+    _SC_TRACE_SYS_MAX,
+
+    _SC_TRACE_USER_EVENT_MAX,
+
+
+    _SC_XOPEN_STREAMS,
+
+
+    _SC_THREAD_ROBUST_PRIO_INHERIT,
+
+    _SC_THREAD_ROBUST_PRIO_PROTECT,
+
+
+    _SC_MINSIGSTKSZ,
+
+
+    _SC_SIGSTKSZ
+
+  };
+
+
+enum
+  {
+    _CS_PATH,
+
+
+    _CS_V6_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_GNU_LIBC_VERSION,
+
+    _CS_GNU_LIBPTHREAD_VERSION,
+
+
+    _CS_V5_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_V7_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_LFS_CFLAGS = 1000,
+
+    _CS_LFS_LDFLAGS,
+
+    _CS_LFS_LIBS,
+
+    _CS_LFS_LINTFLAGS,
+
+    _CS_LFS64_CFLAGS,
+
+    _CS_LFS64_LDFLAGS,
+
+    _CS_LFS64_LIBS,
+
+    _CS_LFS64_LINTFLAGS,
+
+
+    _CS_XBS5_ILP32_OFF32_CFLAGS = 1100,
+
+    _CS_XBS5_ILP32_OFF32_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFF32_LIBS,
+
+    _CS_XBS5_ILP32_OFF32_LINTFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_CFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LIBS,
+
+    _CS_XBS5_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_XBS5_LP64_OFF64_CFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LDFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LIBS,
+
+    _CS_XBS5_LP64_OFF64_LINTFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LIBS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V6_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V6_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V7_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V7_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_V6_ENV,
+
+    _CS_V7_ENV
+
+  };
+# 631 "/usr/include/unistd.h" 2 3 4
+
+
+extern long int pathconf (const char *__path, int __name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int fpathconf (int __fd, int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long int sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t confstr (int __name, char *__buf, size_t __len) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern __pid_t getpid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getppid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t __getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+extern __pid_t getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int setpgid (__pid_t __pid, __pid_t __pgid) __attribute__ ((__nothrow__ , __leaf__));
+# 682 "/usr/include/unistd.h" 3 4
+extern int setpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern __pid_t setsid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __pid_t getsid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __uid_t getuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __uid_t geteuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getgid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getegid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int getgroups (int __size, __gid_t __list[]) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 1)));
+
+
+extern int group_member (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int setuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setreuid (__uid_t __ruid, __uid_t __euid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int seteuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int setgid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setregid (__gid_t __rgid, __gid_t __egid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setegid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern int getresuid (__uid_t *__ruid, __uid_t *__euid, __uid_t *__suid)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int getresgid (__gid_t *__rgid, __gid_t *__egid, __gid_t *__sgid)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setresuid (__uid_t __ruid, __uid_t __euid, __uid_t __suid)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern int setresgid (__gid_t __rgid, __gid_t __egid, __gid_t __sgid)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern __pid_t fork (void) __attribute__ ((__nothrow__));
+
+
+
+
+
+
+
+extern __pid_t vfork (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern __pid_t _Fork (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *ttyname (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ttyname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+extern int isatty (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int ttyslot (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int link (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern int linkat (int __fromfd, const char *__from, int __tofd,
+     const char *__to, int __flags)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4))) ;
+
+
+
+
+extern int symlink (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern ssize_t readlink (const char *__restrict __path,
+    char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern int symlinkat (const char *__from, int __tofd,
+        const char *__to) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3))) ;
+
+
+extern ssize_t readlinkat (int __fd, const char *__restrict __path,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)))
+     __attribute__ ((__access__ (__write_only__, 3, 4)));
+
+
+
+extern int unlink (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int unlinkat (int __fd, const char *__name, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern int rmdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __pid_t tcgetpgrp (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int tcsetpgrp (int __fd, __pid_t __pgrp_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern char *getlogin (void);
+
+
+
+
+
+
+
+extern int getlogin_r (char *__name, size_t __name_len) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+extern int setlogin (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+
+
+
+
+
+
+
+
+extern char *optarg;
+# 50 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int optind;
+
+
+
+
+extern int opterr;
+
+
+
+extern int optopt;
+# 91 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int getopt (int ___argc, char *const *___argv, const char *__shortopts)
+       __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 2 3 4
+
+
+# 49 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+
+# 904 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+
+extern int gethostname (char *__name, size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+
+
+extern int sethostname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+extern int sethostid (long int __id) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern int getdomainname (char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+extern int setdomainname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+
+extern int vhangup (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int revoke (const char *__file) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+
+extern int profil (unsigned short int *__sample_buffer, size_t __size,
+     size_t __offset, unsigned int __scale)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int acct (const char *__name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *getusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void endusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void setusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int daemon (int __nochdir, int __noclose) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int chroot (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern char *getpass (const char *__prompt) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int fsync (int __fd);
+
+
+
+
+
+extern int syncfs (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int gethostid (void);
+
+
+extern void sync (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int getpagesize (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int getdtablesize (void) __attribute__ ((__nothrow__ , __leaf__));
+# 1030 "/usr/include/unistd.h" 3 4
+extern int truncate (const char *__file, __off64_t __length) __asm__ ("" "truncate64") __attribute__ ((__nothrow__ , __leaf__))
+
+                  __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+extern int truncate64 (const char *__file, __off64_t __length)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 1052 "/usr/include/unistd.h" 3 4
+extern int ftruncate (int __fd, __off64_t __length) __asm__ ("" "ftruncate64") __attribute__ ((__nothrow__ , __leaf__))
+                        ;
+
+
+
+
+
+extern int ftruncate64 (int __fd, __off64_t __length) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 1070 "/usr/include/unistd.h" 3 4
+extern int brk (void *__addr) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern void *sbrk (intptr_t __delta) __attribute__ ((__nothrow__ , __leaf__));
+# 1091 "/usr/include/unistd.h" 3 4
+extern long int syscall (long int __sysno, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 1117 "/usr/include/unistd.h" 3 4
+extern int lockf (int __fd, int __cmd, __off64_t __len) __asm__ ("" "lockf64")
+                       ;
+
+
+
+
+
+extern int lockf64 (int __fd, int __cmd, __off64_t __len) ;
+# 1142 "/usr/include/unistd.h" 3 4
+ssize_t copy_file_range (int __infd, __off64_t *__pinoff,
+    int __outfd, __off64_t *__poutoff,
+    size_t __length, unsigned int __flags);
+
+
+
+
+
+extern int fdatasync (int __fildes);
+# 1159 "/usr/include/unistd.h" 3 4
+extern char *crypt (const char *__key, const char *__salt)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void swab (const void *__restrict __from, void *__restrict __to,
+    ssize_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)))
+    __attribute__ ((__access__ (__read_only__, 1, 3)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 1198 "/usr/include/unistd.h" 3 4
+int getentropy (void *__buffer, size_t __length)
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 1208 "/usr/include/unistd.h" 3 4
+extern int close_range (unsigned int __fd, unsigned int __max_fd,
+   int __flags) __attribute__ ((__nothrow__ , __leaf__));
+# 1218 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 1 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 3 4
+extern __pid_t gettid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/linux/close_range.h" 1 3 4
+# 39 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 2 3 4
+# 1219 "/usr/include/unistd.h" 2 3 4
+
+
+# 30 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+
+
+
+
+
+# 1 "/usr/include/assert.h" 1 3 4
+# 36 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/usr/include/wchar.h" 1 3 4
+# 27 "/usr/include/wchar.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/wchar.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 36 "/usr/include/wchar.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 39 "/usr/include/wchar.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 41 "/usr/include/wchar.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/wint_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/wint_t.h" 3 4
+typedef unsigned int wint_t;
+# 42 "/usr/include/wchar.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h" 1 3 4
+
+
+
+
+
+typedef __mbstate_t mbstate_t;
+# 43 "/usr/include/wchar.h" 2 3 4
+# 79 "/usr/include/wchar.h" 3 4
+
+
+
+
+struct tm;
+
+
+
+extern wchar_t *wcscpy (wchar_t *__restrict __dest,
+   const wchar_t *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern wchar_t *wcsncpy (wchar_t *__restrict __dest,
+    const wchar_t *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern wchar_t *wcscat (wchar_t *__restrict __dest,
+   const wchar_t *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern wchar_t *wcsncat (wchar_t *__restrict __dest,
+    const wchar_t *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int wcscmp (const wchar_t *__s1, const wchar_t *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int wcsncmp (const wchar_t *__s1, const wchar_t *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int wcscasecmp (const wchar_t *__s1, const wchar_t *__s2) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wcsncasecmp (const wchar_t *__s1, const wchar_t *__s2,
+   size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int wcscasecmp_l (const wchar_t *__s1, const wchar_t *__s2,
+    locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int wcsncasecmp_l (const wchar_t *__s1, const wchar_t *__s2,
+     size_t __n, locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int wcscoll (const wchar_t *__s1, const wchar_t *__s2) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t wcsxfrm (wchar_t *__restrict __s1,
+         const wchar_t *__restrict __s2, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int wcscoll_l (const wchar_t *__s1, const wchar_t *__s2,
+        locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern size_t wcsxfrm_l (wchar_t *__s1, const wchar_t *__s2,
+    size_t __n, locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern wchar_t *wcsdup (const wchar_t *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+# 165 "/usr/include/wchar.h" 3 4
+extern wchar_t *wcschr (const wchar_t *__wcs, wchar_t __wc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+# 175 "/usr/include/wchar.h" 3 4
+extern wchar_t *wcsrchr (const wchar_t *__wcs, wchar_t __wc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+
+
+
+
+
+extern wchar_t *wcschrnul (const wchar_t *__s, wchar_t __wc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+
+
+
+
+extern size_t wcscspn (const wchar_t *__wcs, const wchar_t *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+
+
+extern size_t wcsspn (const wchar_t *__wcs, const wchar_t *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+# 202 "/usr/include/wchar.h" 3 4
+extern wchar_t *wcspbrk (const wchar_t *__wcs, const wchar_t *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+# 213 "/usr/include/wchar.h" 3 4
+extern wchar_t *wcsstr (const wchar_t *__haystack, const wchar_t *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+
+
+
+extern wchar_t *wcstok (wchar_t *__restrict __s,
+   const wchar_t *__restrict __delim,
+   wchar_t **__restrict __ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern size_t wcslen (const wchar_t *__s) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+# 234 "/usr/include/wchar.h" 3 4
+extern wchar_t *wcswcs (const wchar_t *__haystack, const wchar_t *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+
+
+
+
+
+extern size_t wcsnlen (const wchar_t *__s, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+# 254 "/usr/include/wchar.h" 3 4
+extern wchar_t *wmemchr (const wchar_t *__s, wchar_t __c, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+
+
+
+extern int wmemcmp (const wchar_t *__s1, const wchar_t *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+
+
+extern wchar_t *wmemcpy (wchar_t *__restrict __s1,
+    const wchar_t *__restrict __s2, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern wchar_t *wmemmove (wchar_t *__s1, const wchar_t *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern wchar_t *wmemset (wchar_t *__s, wchar_t __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern wchar_t *wmempcpy (wchar_t *__restrict __s1,
+     const wchar_t *__restrict __s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern wint_t btowc (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int wctob (wint_t __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int mbsinit (const mbstate_t *__ps) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+
+
+
+extern size_t mbrtowc (wchar_t *__restrict __pwc,
+         const char *__restrict __s, size_t __n,
+         mbstate_t *__restrict __p) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern size_t wcrtomb (char *__restrict __s, wchar_t __wc,
+         mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern size_t __mbrlen (const char *__restrict __s, size_t __n,
+   mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+extern size_t mbrlen (const char *__restrict __s, size_t __n,
+        mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern wint_t __btowc_alias (int __c) __asm ("btowc");
+extern __inline __attribute__ ((__gnu_inline__)) wint_t
+__attribute__ ((__nothrow__ , __leaf__)) btowc (int __c)
+{ return (__builtin_constant_p (__c) && __c >= '\0' && __c <= '\x7f'
+   ? (wint_t) __c : __btowc_alias (__c)); }
+
+extern int __wctob_alias (wint_t __c) __asm ("wctob");
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) wctob (wint_t __wc)
+{ return (__builtin_constant_p (__wc) && __wc >= L'\0' && __wc <= L'\x7f'
+   ? (int) __wc : __wctob_alias (__wc)); }
+
+extern __inline __attribute__ ((__gnu_inline__)) size_t
+__attribute__ ((__nothrow__ , __leaf__)) mbrlen (const char *__restrict __s, size_t __n, mbstate_t *__restrict __ps)
+
+{ return (__ps != ((void *)0)
+   ? mbrtowc (((void *)0), __s, __n, __ps) : __mbrlen (__s, __n, ((void *)0))); }
+
+
+
+
+extern size_t mbsrtowcs (wchar_t *__restrict __dst,
+    const char **__restrict __src, size_t __len,
+    mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t wcsrtombs (char *__restrict __dst,
+    const wchar_t **__restrict __src, size_t __len,
+    mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern size_t mbsnrtowcs (wchar_t *__restrict __dst,
+     const char **__restrict __src, size_t __nmc,
+     size_t __len, mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t wcsnrtombs (char *__restrict __dst,
+     const wchar_t **__restrict __src,
+     size_t __nwc, size_t __len,
+     mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int wcwidth (wchar_t __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int wcswidth (const wchar_t *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern double wcstod (const wchar_t *__restrict __nptr,
+        wchar_t **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float wcstof (const wchar_t *__restrict __nptr,
+       wchar_t **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__));
+extern long double wcstold (const wchar_t *__restrict __nptr,
+       wchar_t **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__));
+# 397 "/usr/include/wchar.h" 3 4
+extern _Float32 wcstof32 (const wchar_t *__restrict __nptr,
+     wchar_t **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 wcstof64 (const wchar_t *__restrict __nptr,
+     wchar_t **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 wcstof128 (const wchar_t *__restrict __nptr,
+       wchar_t **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x wcstof32x (const wchar_t *__restrict __nptr,
+       wchar_t **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x wcstof64x (const wchar_t *__restrict __nptr,
+       wchar_t **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__));
+# 429 "/usr/include/wchar.h" 3 4
+extern long int wcstol (const wchar_t *__restrict __nptr,
+   wchar_t **__restrict __endptr, int __base) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern unsigned long int wcstoul (const wchar_t *__restrict __nptr,
+      wchar_t **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+__extension__
+extern long long int wcstoll (const wchar_t *__restrict __nptr,
+         wchar_t **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__extension__
+extern unsigned long long int wcstoull (const wchar_t *__restrict __nptr,
+     wchar_t **__restrict __endptr,
+     int __base) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+__extension__
+extern long long int wcstoq (const wchar_t *__restrict __nptr,
+        wchar_t **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+__extension__
+extern unsigned long long int wcstouq (const wchar_t *__restrict __nptr,
+           wchar_t **__restrict __endptr,
+           int __base) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int wcstol_l (const wchar_t *__restrict __nptr,
+     wchar_t **__restrict __endptr, int __base,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+extern unsigned long int wcstoul_l (const wchar_t *__restrict __nptr,
+        wchar_t **__restrict __endptr,
+        int __base, locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+__extension__
+extern long long int wcstoll_l (const wchar_t *__restrict __nptr,
+    wchar_t **__restrict __endptr,
+    int __base, locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+__extension__
+extern unsigned long long int wcstoull_l (const wchar_t *__restrict __nptr,
+       wchar_t **__restrict __endptr,
+       int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+extern double wcstod_l (const wchar_t *__restrict __nptr,
+   wchar_t **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+extern float wcstof_l (const wchar_t *__restrict __nptr,
+         wchar_t **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double wcstold_l (const wchar_t *__restrict __nptr,
+         wchar_t **__restrict __endptr,
+         locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+# 512 "/usr/include/wchar.h" 3 4
+extern _Float32 wcstof32_l (const wchar_t *__restrict __nptr,
+       wchar_t **__restrict __endptr,
+       locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 wcstof64_l (const wchar_t *__restrict __nptr,
+       wchar_t **__restrict __endptr,
+       locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 wcstof128_l (const wchar_t *__restrict __nptr,
+         wchar_t **__restrict __endptr,
+         locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x wcstof32x_l (const wchar_t *__restrict __nptr,
+         wchar_t **__restrict __endptr,
+         locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x wcstof64x_l (const wchar_t *__restrict __nptr,
+         wchar_t **__restrict __endptr,
+         locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+# 552 "/usr/include/wchar.h" 3 4
+extern wchar_t *wcpcpy (wchar_t *__restrict __dest,
+   const wchar_t *__restrict __src) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern wchar_t *wcpncpy (wchar_t *__restrict __dest,
+    const wchar_t *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 581 "/usr/include/wchar.h" 3 4
+extern __FILE *open_wmemstream (wchar_t **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1)));
+
+
+
+
+
+extern int fwide (__FILE *__fp, int __mode) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int fwprintf (__FILE *__restrict __stream,
+       const wchar_t *__restrict __format, ...)
+                                                           ;
+
+
+
+
+extern int wprintf (const wchar_t *__restrict __format, ...)
+                                                           ;
+
+extern int swprintf (wchar_t *__restrict __s, size_t __n,
+       const wchar_t *__restrict __format, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern int vfwprintf (__FILE *__restrict __s,
+        const wchar_t *__restrict __format,
+        __gnuc_va_list __arg)
+                                                           ;
+
+
+
+
+extern int vwprintf (const wchar_t *__restrict __format,
+       __gnuc_va_list __arg)
+                                                           ;
+
+
+extern int vswprintf (wchar_t *__restrict __s, size_t __n,
+        const wchar_t *__restrict __format,
+        __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int fwscanf (__FILE *__restrict __stream,
+      const wchar_t *__restrict __format, ...)
+                                                          ;
+
+
+
+
+extern int wscanf (const wchar_t *__restrict __format, ...)
+                                                          ;
+
+extern int swscanf (const wchar_t *__restrict __s,
+      const wchar_t *__restrict __format, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+# 657 "/usr/include/wchar.h" 3 4
+extern int fwscanf (__FILE *__restrict __stream, const wchar_t *__restrict __format, ...) __asm__ ("" "__isoc99_fwscanf")
+
+
+                                                          ;
+extern int wscanf (const wchar_t *__restrict __format, ...) __asm__ ("" "__isoc99_wscanf")
+
+                                                          ;
+extern int swscanf (const wchar_t *__restrict __s, const wchar_t *__restrict __format, ...) __asm__ ("" "__isoc99_swscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+                                                          ;
+# 688 "/usr/include/wchar.h" 3 4
+extern int vfwscanf (__FILE *__restrict __s,
+       const wchar_t *__restrict __format,
+       __gnuc_va_list __arg)
+                                                          ;
+
+
+
+
+extern int vwscanf (const wchar_t *__restrict __format,
+      __gnuc_va_list __arg)
+                                                          ;
+
+extern int vswscanf (const wchar_t *__restrict __s,
+       const wchar_t *__restrict __format,
+       __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern int vfwscanf (__FILE *__restrict __s, const wchar_t *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfwscanf")
+
+
+                                                          ;
+extern int vwscanf (const wchar_t *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vwscanf")
+
+                                                          ;
+extern int vswscanf (const wchar_t *__restrict __s, const wchar_t *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vswscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+                                                          ;
+# 744 "/usr/include/wchar.h" 3 4
+extern wint_t fgetwc (__FILE *__stream);
+extern wint_t getwc (__FILE *__stream);
+
+
+
+
+
+extern wint_t getwchar (void);
+
+
+
+
+
+
+extern wint_t fputwc (wchar_t __wc, __FILE *__stream);
+extern wint_t putwc (wchar_t __wc, __FILE *__stream);
+
+
+
+
+
+extern wint_t putwchar (wchar_t __wc);
+
+
+
+
+
+
+
+extern wchar_t *fgetws (wchar_t *__restrict __ws, int __n,
+   __FILE *__restrict __stream);
+
+
+
+
+
+extern int fputws (const wchar_t *__restrict __ws,
+     __FILE *__restrict __stream);
+
+
+
+
+
+
+extern wint_t ungetwc (wint_t __wc, __FILE *__stream);
+# 799 "/usr/include/wchar.h" 3 4
+extern wint_t getwc_unlocked (__FILE *__stream);
+extern wint_t getwchar_unlocked (void);
+
+
+
+
+
+
+
+extern wint_t fgetwc_unlocked (__FILE *__stream);
+
+
+
+
+
+
+
+extern wint_t fputwc_unlocked (wchar_t __wc, __FILE *__stream);
+# 825 "/usr/include/wchar.h" 3 4
+extern wint_t putwc_unlocked (wchar_t __wc, __FILE *__stream);
+extern wint_t putwchar_unlocked (wchar_t __wc);
+# 835 "/usr/include/wchar.h" 3 4
+extern wchar_t *fgetws_unlocked (wchar_t *__restrict __ws, int __n,
+     __FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fputws_unlocked (const wchar_t *__restrict __ws,
+       __FILE *__restrict __stream);
+
+
+
+
+
+
+extern size_t wcsftime (wchar_t *__restrict __s, size_t __maxsize,
+   const wchar_t *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern size_t wcsftime_l (wchar_t *__restrict __s, size_t __maxsize,
+     const wchar_t *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+# 882 "/usr/include/wchar.h" 3 4
+
+# 37 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h" 1
+
+
+
+
+
+# 1 "/usr/include/inttypes.h" 1 3 4
+# 27 "/usr/include/inttypes.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 90 "/usr/include/stdint.h" 3 4
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 28 "/usr/include/inttypes.h" 2 3 4
+
+
+
+
+
+
+typedef int __gwchar_t;
+# 266 "/usr/include/inttypes.h" 3 4
+
+
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } imaxdiv_t;
+# 290 "/usr/include/inttypes.h" 3 4
+extern intmax_t imaxabs (intmax_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern imaxdiv_t imaxdiv (intmax_t __numer, intmax_t __denom)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern intmax_t strtoimax (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern uintmax_t strtoumax (const char *__restrict __nptr,
+       char ** __restrict __endptr, int __base) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern intmax_t wcstoimax (const __gwchar_t *__restrict __nptr,
+      __gwchar_t **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern uintmax_t wcstoumax (const __gwchar_t *__restrict __nptr,
+       __gwchar_t ** __restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 7 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h" 2
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 203 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/include/limits.h" 1 3 4
+# 26 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/limits.h" 2 3 4
+# 195 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 161 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/linux/limits.h" 1 3 4
+# 39 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 81 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+
+extern long int __sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+# 82 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 162 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 196 "/usr/include/limits.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h" 1 3 4
+# 200 "/usr/include/limits.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/xopen_lim.h" 1 3 4
+# 64 "/usr/include/x86_64-linux-gnu/bits/xopen_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h" 1 3 4
+# 65 "/usr/include/x86_64-linux-gnu/bits/xopen_lim.h" 2 3 4
+# 204 "/usr/include/limits.h" 2 3 4
+# 204 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 2 3 4
+# 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 9 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h" 2
+# 120 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h"
+
+# 120 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h"
+typedef uintptr_t Py_uintptr_t;
+typedef intptr_t Py_intptr_t;
+# 131 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h"
+typedef ssize_t Py_ssize_t;
+# 145 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h"
+typedef Py_ssize_t Py_hash_t;
+
+
+typedef size_t Py_uhash_t;
+
+
+typedef Py_ssize_t Py_ssize_clean_t;
+# 218 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h"
+# 1 "/usr/include/math.h" 1 3 4
+# 27 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/math.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 2 3 4
+# 41 "/usr/include/math.h" 2 3 4
+# 152 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 1 3 4
+# 153 "/usr/include/math.h" 2 3 4
+# 163 "/usr/include/math.h" 3 4
+
+# 163 "/usr/include/math.h" 3 4
+typedef float float_t;
+typedef double double_t;
+# 204 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 1 3 4
+# 205 "/usr/include/math.h" 2 3 4
+# 247 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h" 1 3 4
+# 248 "/usr/include/math.h" 2 3 4
+
+
+
+enum
+  {
+    FP_INT_UPWARD =
+
+      0,
+    FP_INT_DOWNWARD =
+
+      1,
+    FP_INT_TOWARDZERO =
+
+      2,
+    FP_INT_TONEARESTFROMZERO =
+
+      3,
+    FP_INT_TONEAREST =
+
+      4,
+  };
+# 312 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassify (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbit (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsig (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignaling (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 313 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double cos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincos (double __x, double *__sinx, double *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincos (double __x, double *__sinx, double *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern double acosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double exp (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern double __modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern double exp10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log1p (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log1p (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double logb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __logb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern double pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern double hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern double drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double significand (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __significand (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern double __nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern double j0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double j1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double jn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __jn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double yn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __yn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double erf (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erf (double) __attribute__ ((__nothrow__ , __leaf__));
+ extern double erfc (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erfc (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double lgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double tgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __tgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern double gamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __gamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double rint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __rint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double nextdown (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextdown (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nextup (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextup (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern double __remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__)); extern double __fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double roundeven (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __roundeven (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfp (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpx (double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalize (double *__cx, const double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double fmaxmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaxmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminmag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double fmaximum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmaximum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmaximum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum_mag (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmaximum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmaximum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fminimum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fminimum_mag_num (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorder (const double *__x, const double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermag (const double *__x, const double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern double getpayload (const double *__x) __attribute__ ((__nothrow__ , __leaf__)); extern double __getpayload (const double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayload (double *__x, double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsig (double *__x, double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 314 "/usr/include/math.h" 2 3 4
+# 329 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 330 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float cosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float coshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __coshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf (float __x, float *__sinx, float *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf (float __x, float *__sinx, float *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern float acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float expf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float logf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern float __modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern float exp10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float logbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern float powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern float hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern float dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float significandf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __significandf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern float __nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern float j0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float j1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float jnf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __jnf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float ynf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __ynf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float erff (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erff (float) __attribute__ ((__nothrow__ , __leaf__));
+ extern float erfcf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erfcf (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float lgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float tgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __tgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern float gammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __gammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float rintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __rintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float nextdownf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextdownf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nextupf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextupf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern float __remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float roundevenf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundevenf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf (float __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef (float *__cx, const float *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float fmaxmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminmagf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float fmaximumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimumf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmaximum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimum_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmaximum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimum_magf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmaximum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaximum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminimum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminimum_mag_numf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf (const float *__x, const float *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf (const float *__x, const float *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern float getpayloadf (const float *__x) __attribute__ ((__nothrow__ , __leaf__)); extern float __getpayloadf (const float *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf (float *__x, float __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf (float *__x, float __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__));
+# 331 "/usr/include/math.h" 2 3 4
+# 398 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 399 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosl (long double __x, long double *__sinx, long double *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosl (long double __x, long double *__sinx, long double *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern long double acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double expl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double logl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern long double __modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern long double exp10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern long double powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern long double hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern long double dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern long double j0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double j1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double erfl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfl (long double) __attribute__ ((__nothrow__ , __leaf__));
+ extern long double erfcl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfcl (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double lgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double tgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern long double gammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __gammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double nextdownl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextdownl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nextupl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextupl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double roundevenl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundevenl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxl (long double __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizel (long double *__cx, const long double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double fmaxmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminmagl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double fmaximuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimuml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmaximum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimum_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmaximum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimum_magl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmaximum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaximum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminimum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminimum_mag_numl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderl (const long double *__x, const long double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagl (const long double *__x, const long double *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern long double getpayloadl (const long double *__x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __getpayloadl (const long double *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadl (long double *__x, long double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigl (long double *__x, long double __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 400 "/usr/include/math.h" 2 3 4
+# 450 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float32 acosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __acosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 asinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __asinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 atanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __atanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 atan2f32 (_Float32 __y, _Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __atan2f32 (_Float32 __y, _Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 cosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __cosf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 sinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __sinf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 tanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __tanf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 coshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __coshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 sinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __sinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 tanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __tanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf32 (_Float32 __x, _Float32 *__sinx, _Float32 *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf32 (_Float32 __x, _Float32 *__sinx, _Float32 *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float32 acoshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __acoshf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 asinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __asinhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32 atanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __atanhf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32 expf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __expf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 frexpf32 (_Float32 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __frexpf32 (_Float32 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 ldexpf32 (_Float32 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __ldexpf32 (_Float32 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 logf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __logf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 log10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __log10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 modff32 (_Float32 __x, _Float32 *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __modff32 (_Float32 __x, _Float32 *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float32 exp10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __exp10f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 expm1f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __expm1f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 log1pf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __log1pf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 logbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __logbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 exp2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __exp2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32 log2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __log2f32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float32 powf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __powf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 sqrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __sqrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float32 hypotf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __hypotf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32 cbrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __cbrtf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 ceilf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __ceilf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fabsf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fabsf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 floorf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __floorf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmodf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __fmodf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32 copysignf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __copysignf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32 nanf32 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nanf32 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32 j0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __j0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 j1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __j1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 jnf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __jnf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 y0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __y0f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 y1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __y1f32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 ynf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __ynf32 (int, _Float32) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32 erff32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __erff32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float32 erfcf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __erfcf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32 lgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __lgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32 tgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __tgammaf32 (_Float32) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32 lgammaf32_r (_Float32, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __lgammaf32_r (_Float32, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 rintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __rintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 nextafterf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nextafterf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 nextdownf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nextdownf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float32 nextupf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nextupf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 remainderf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __remainderf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 scalbnf32 (_Float32 __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __scalbnf32 (_Float32 __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32 scalblnf32 (_Float32 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __scalblnf32 (_Float32 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 nearbyintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __nearbyintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 roundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __roundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32 truncf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __truncf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32 remquof32 (_Float32 __x, _Float32 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __remquof32 (_Float32 __x, _Float32 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 fdimf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __fdimf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32 fmaxf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaxf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32 fmaf32 (_Float32 __x, _Float32 __y, _Float32 __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __fmaf32 (_Float32 __x, _Float32 __y, _Float32 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32 roundevenf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __roundevenf32 (_Float32 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf32 (_Float32 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef32 (_Float32 *__cx, const _Float32 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32 fmaxmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaxmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminmagf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32 fmaximumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimumf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmaximum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimum_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmaximum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimum_magf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fmaximum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fmaximum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32 fminimum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32 __fminimum_mag_numf32 (_Float32 __x, _Float32 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf32 (const _Float32 *__x, const _Float32 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf32 (const _Float32 *__x, const _Float32 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float32 getpayloadf32 (const _Float32 *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32 __getpayloadf32 (const _Float32 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf32 (_Float32 *__x, _Float32 __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf32 (_Float32 *__x, _Float32 __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 451 "/usr/include/math.h" 2 3 4
+# 467 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float64 acosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __acosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 asinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __asinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 atanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __atanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 atan2f64 (_Float64 __y, _Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __atan2f64 (_Float64 __y, _Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 cosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __cosf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 sinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __sinf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 tanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __tanf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 coshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __coshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 sinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __sinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 tanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __tanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf64 (_Float64 __x, _Float64 *__sinx, _Float64 *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf64 (_Float64 __x, _Float64 *__sinx, _Float64 *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float64 acoshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __acoshf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 asinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __asinhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64 atanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __atanhf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64 expf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __expf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 frexpf64 (_Float64 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __frexpf64 (_Float64 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 ldexpf64 (_Float64 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __ldexpf64 (_Float64 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 logf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __logf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 log10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __log10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 modff64 (_Float64 __x, _Float64 *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __modff64 (_Float64 __x, _Float64 *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float64 exp10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __exp10f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 expm1f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __expm1f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 log1pf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __log1pf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 logbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __logbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 exp2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __exp2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64 log2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __log2f64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float64 powf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __powf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 sqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __sqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float64 hypotf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __hypotf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64 cbrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __cbrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 ceilf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __ceilf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fabsf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fabsf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 floorf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __floorf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmodf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __fmodf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64 copysignf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __copysignf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64 nanf64 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nanf64 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64 j0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __j0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 j1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __j1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 jnf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __jnf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 y0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __y0f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 y1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __y1f64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 ynf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __ynf64 (int, _Float64) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64 erff64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __erff64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float64 erfcf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __erfcf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64 lgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __lgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64 tgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __tgammaf64 (_Float64) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64 lgammaf64_r (_Float64, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __lgammaf64_r (_Float64, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 rintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __rintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 nextafterf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nextafterf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 nextdownf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nextdownf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float64 nextupf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nextupf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 remainderf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __remainderf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 scalbnf64 (_Float64 __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __scalbnf64 (_Float64 __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64 scalblnf64 (_Float64 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __scalblnf64 (_Float64 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 nearbyintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __nearbyintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 roundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __roundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64 truncf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __truncf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64 remquof64 (_Float64 __x, _Float64 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __remquof64 (_Float64 __x, _Float64 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 fdimf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __fdimf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64 fmaxf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaxf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64 fmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __fmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64 roundevenf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __roundevenf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf64 (_Float64 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef64 (_Float64 *__cx, const _Float64 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64 fmaxmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaxmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminmagf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64 fmaximumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimumf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmaximum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimum_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmaximum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimum_magf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fmaximum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fmaximum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64 fminimum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64 __fminimum_mag_numf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf64 (const _Float64 *__x, const _Float64 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf64 (const _Float64 *__x, const _Float64 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float64 getpayloadf64 (const _Float64 *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64 __getpayloadf64 (const _Float64 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf64 (_Float64 *__x, _Float64 __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf64 (_Float64 *__x, _Float64 __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 468 "/usr/include/math.h" 2 3 4
+# 481 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 482 "/usr/include/math.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float128 acosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __acosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 asinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __asinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 atanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __atanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 atan2f128 (_Float128 __y, _Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __atan2f128 (_Float128 __y, _Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 cosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __cosf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 sinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __sinf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 tanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __tanf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 coshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __coshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 sinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __sinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 tanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __tanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf128 (_Float128 __x, _Float128 *__sinx, _Float128 *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf128 (_Float128 __x, _Float128 *__sinx, _Float128 *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float128 acoshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __acoshf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 asinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __asinhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float128 atanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __atanhf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float128 expf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __expf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 frexpf128 (_Float128 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __frexpf128 (_Float128 __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 ldexpf128 (_Float128 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __ldexpf128 (_Float128 __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 logf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __logf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 log10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __log10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 modff128 (_Float128 __x, _Float128 *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __modff128 (_Float128 __x, _Float128 *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float128 exp10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __exp10f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 expm1f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __expm1f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 log1pf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __log1pf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 logbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __logbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 exp2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __exp2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float128 log2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __log2f128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float128 powf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __powf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float128 hypotf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __hypotf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float128 cbrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __cbrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 ceilf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __ceilf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fabsf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fabsf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 floorf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __floorf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmodf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __fmodf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float128 copysignf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __copysignf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float128 nanf128 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nanf128 (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float128 j0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __j0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 j1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __j1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 jnf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __jnf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 y0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __y0f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 y1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __y1f128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 ynf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __ynf128 (int, _Float128) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float128 erff128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __erff128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float128 erfcf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __erfcf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float128 lgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __lgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float128 tgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __tgammaf128 (_Float128) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float128 lgammaf128_r (_Float128, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __lgammaf128_r (_Float128, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 rintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __rintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float128 nextafterf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nextafterf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 nextdownf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nextdownf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float128 nextupf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nextupf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 remainderf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __remainderf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 scalbnf128 (_Float128 __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __scalbnf128 (_Float128 __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float128 scalblnf128 (_Float128 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __scalblnf128 (_Float128 __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 nearbyintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __nearbyintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 roundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __roundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float128 truncf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __truncf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float128 remquof128 (_Float128 __x, _Float128 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __remquof128 (_Float128 __x, _Float128 __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 fdimf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __fdimf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float128 fmaxf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaxf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float128 fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float128 roundevenf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __roundevenf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf128 (_Float128 __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef128 (_Float128 *__cx, const _Float128 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float128 fmaxmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaxmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminmagf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float128 fmaximumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimumf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmaximum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimum_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmaximum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimum_magf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fmaximum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fmaximum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float128 fminimum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float128 __fminimum_mag_numf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf128 (const _Float128 *__x, const _Float128 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf128 (const _Float128 *__x, const _Float128 *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float128 getpayloadf128 (const _Float128 *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float128 __getpayloadf128 (const _Float128 *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf128 (_Float128 *__x, _Float128 __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf128 (_Float128 *__x, _Float128 __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 485 "/usr/include/math.h" 2 3 4
+# 501 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float32x acosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __acosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x asinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __asinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x atanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __atanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x atan2f32x (_Float32x __y, _Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __atan2f32x (_Float32x __y, _Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x cosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __cosf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x sinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __sinf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x tanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __tanf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x coshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __coshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x sinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __sinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x tanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __tanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf32x (_Float32x __x, _Float32x *__sinx, _Float32x *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf32x (_Float32x __x, _Float32x *__sinx, _Float32x *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float32x acoshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __acoshf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x asinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __asinhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float32x atanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __atanhf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32x expf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __expf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x frexpf32x (_Float32x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __frexpf32x (_Float32x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x ldexpf32x (_Float32x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __ldexpf32x (_Float32x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x logf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __logf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x log10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __log10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x modff32x (_Float32x __x, _Float32x *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __modff32x (_Float32x __x, _Float32x *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float32x exp10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __exp10f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x expm1f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __expm1f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x log1pf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __log1pf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x logbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __logbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x exp2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __exp2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float32x log2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __log2f32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float32x powf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __powf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x sqrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __sqrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float32x hypotf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __hypotf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float32x cbrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __cbrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x ceilf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __ceilf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fabsf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fabsf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x floorf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __floorf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmodf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __fmodf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32x copysignf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __copysignf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32x nanf32x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nanf32x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32x j0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __j0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x j1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __j1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x jnf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __jnf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x y0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __y0f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x y1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __y1f32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x ynf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __ynf32x (int, _Float32x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float32x erff32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __erff32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float32x erfcf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __erfcf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float32x lgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __lgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32x tgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __tgammaf32x (_Float32x) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float32x lgammaf32x_r (_Float32x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __lgammaf32x_r (_Float32x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x rintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __rintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x nextafterf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nextafterf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x nextdownf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nextdownf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float32x nextupf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nextupf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x remainderf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __remainderf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x scalbnf32x (_Float32x __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __scalbnf32x (_Float32x __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32x scalblnf32x (_Float32x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __scalblnf32x (_Float32x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x nearbyintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __nearbyintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x roundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __roundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32x truncf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __truncf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32x remquof32x (_Float32x __x, _Float32x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __remquof32x (_Float32x __x, _Float32x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x fdimf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __fdimf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float32x fmaxf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaxf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float32x fmaf32x (_Float32x __x, _Float32x __y, _Float32x __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __fmaf32x (_Float32x __x, _Float32x __y, _Float32x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float32x roundevenf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __roundevenf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf32x (_Float32x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef32x (_Float32x *__cx, const _Float32x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float32x fmaxmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaxmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminmagf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float32x fmaximumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimumf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmaximum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimum_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmaximum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimum_magf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fmaximum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fmaximum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float32x fminimum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float32x __fminimum_mag_numf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf32x (const _Float32x *__x, const _Float32x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf32x (const _Float32x *__x, const _Float32x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float32x getpayloadf32x (const _Float32x *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float32x __getpayloadf32x (const _Float32x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf32x (_Float32x *__x, _Float32x __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf32x (_Float32x *__x, _Float32x __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 502 "/usr/include/math.h" 2 3 4
+# 518 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern _Float64x acosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __acosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x asinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __asinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x atanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __atanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x atan2f64x (_Float64x __y, _Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __atan2f64x (_Float64x __y, _Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x cosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __cosf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x sinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __sinf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x tanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __tanf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x coshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __coshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x sinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __sinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x tanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __tanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern void sincosf64x (_Float64x __x, _Float64x *__sinx, _Float64x *__cosx) __attribute__ ((__nothrow__ , __leaf__)); extern void __sincosf64x (_Float64x __x, _Float64x *__sinx, _Float64x *__cosx) __attribute__ ((__nothrow__ , __leaf__))
+                                                        ;
+
+
+
+
+ extern _Float64x acoshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __acoshf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x asinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __asinhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern _Float64x atanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __atanhf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64x expf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __expf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x frexpf64x (_Float64x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __frexpf64x (_Float64x __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x ldexpf64x (_Float64x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __ldexpf64x (_Float64x __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x logf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __logf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x log10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __log10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x modff64x (_Float64x __x, _Float64x *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __modff64x (_Float64x __x, _Float64x *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+ extern _Float64x exp10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __exp10f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x expm1f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __expm1f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x log1pf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __log1pf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x logbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __logbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x exp2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __exp2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern _Float64x log2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __log2f64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern _Float64x powf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __powf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern _Float64x hypotf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __hypotf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern _Float64x cbrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __cbrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x ceilf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __ceilf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fabsf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fabsf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x floorf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __floorf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmodf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __fmodf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 198 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64x copysignf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __copysignf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64x nanf64x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nanf64x (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 220 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64x j0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __j0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x j1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __j1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x jnf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __jnf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x y0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __y0f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x y1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __y1f64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x ynf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __ynf64x (int, _Float64x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern _Float64x erff64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __erff64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+ extern _Float64x erfcf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __erfcf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+extern _Float64x lgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __lgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64x tgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __tgammaf64x (_Float64x) __attribute__ ((__nothrow__ , __leaf__));
+# 252 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern _Float64x lgammaf64x_r (_Float64x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __lgammaf64x_r (_Float64x, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x rintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __rintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x nextafterf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nextafterf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x nextdownf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nextdownf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+extern _Float64x nextupf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nextupf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x remainderf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __remainderf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x scalbnf64x (_Float64x __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __scalbnf64x (_Float64x __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long int llogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __llogbf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64x scalblnf64x (_Float64x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __scalblnf64x (_Float64x __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x nearbyintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __nearbyintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x roundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __roundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64x truncf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __truncf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64x remquof64x (_Float64x __x, _Float64x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __remquof64x (_Float64x __x, _Float64x __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x fdimf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __fdimf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern _Float64x fmaxf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaxf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern _Float64x fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern _Float64x roundevenf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __roundevenf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern __intmax_t fromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                            ;
+
+
+
+extern __uintmax_t ufromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                              ;
+
+
+
+
+extern __intmax_t fromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __intmax_t __fromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                             ;
+
+
+
+
+extern __uintmax_t ufromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__)); extern __uintmax_t __ufromfpxf64x (_Float64x __x, int __round, unsigned int __width) __attribute__ ((__nothrow__ , __leaf__))
+                               ;
+
+
+extern int canonicalizef64x (_Float64x *__cx, const _Float64x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern _Float64x fmaxmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaxmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminmagf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern _Float64x fmaximumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimumf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmaximum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimum_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmaximum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimum_magf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fmaximum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fmaximum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern _Float64x fminimum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern _Float64x __fminimum_mag_numf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int totalorderf64x (const _Float64x *__x, const _Float64x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern int totalordermagf64x (const _Float64x *__x, const _Float64x *__y) __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__pure__));
+
+
+extern _Float64x getpayloadf64x (const _Float64x *__x) __attribute__ ((__nothrow__ , __leaf__)); extern _Float64x __getpayloadf64x (const _Float64x *__x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadf64x (_Float64x *__x, _Float64x __payload) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setpayloadsigf64x (_Float64x *__x, _Float64x __payload) __attribute__ ((__nothrow__ , __leaf__));
+# 519 "/usr/include/math.h" 2 3 4
+# 566 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern float fadd (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fdiv (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ffma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fmul (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsub (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 567 "/usr/include/math.h" 2 3 4
+# 587 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern float faddl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fdivl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ffmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fmull (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float fsubl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 588 "/usr/include/math.h" 2 3 4
+# 616 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern double daddl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ddivl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dfmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dmull (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dsqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double dsubl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 617 "/usr/include/math.h" 2 3 4
+# 697 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf32x (_Float32x __x, _Float32x __y, _Float32x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf32x (_Float32x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf32x (_Float32x __x, _Float32x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 698 "/usr/include/math.h" 2 3 4
+# 707 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 708 "/usr/include/math.h" 2 3 4
+# 717 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 718 "/usr/include/math.h" 2 3 4
+# 727 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32 f32addf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32divf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32mulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32 f32subf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 728 "/usr/include/math.h" 2 3 4
+# 747 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32x f32xaddf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xdivf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xfmaf64 (_Float64 __x, _Float64 __y, _Float64 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xmulf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsqrtf64 (_Float64 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsubf64 (_Float64 __x, _Float64 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 748 "/usr/include/math.h" 2 3 4
+# 757 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32x f32xaddf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xdivf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xfmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xmulf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsubf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 758 "/usr/include/math.h" 2 3 4
+# 767 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float32x f32xaddf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xdivf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xfmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xmulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float32x f32xsubf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 768 "/usr/include/math.h" 2 3 4
+# 787 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float64 f64addf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64divf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64fmaf64x (_Float64x __x, _Float64x __y, _Float64x __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64mulf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64sqrtf64x (_Float64x __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64subf64x (_Float64x __x, _Float64x __y) __attribute__ ((__nothrow__ , __leaf__));
+# 788 "/usr/include/math.h" 2 3 4
+# 797 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float64 f64addf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64divf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64fmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64mulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64sqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64 f64subf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 798 "/usr/include/math.h" 2 3 4
+# 817 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h" 3 4
+extern _Float64x f64xaddf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xdivf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xfmaf128 (_Float128 __x, _Float128 __y, _Float128 __z) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xmulf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xsqrtf128 (_Float128 __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern _Float64x f64xsubf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+# 818 "/usr/include/math.h" 2 3 4
+# 854 "/usr/include/math.h" 3 4
+extern int signgam;
+# 934 "/usr/include/math.h" 3 4
+enum
+  {
+    FP_NAN =
+
+      0,
+    FP_INFINITE =
+
+      1,
+    FP_ZERO =
+
+      2,
+    FP_SUBNORMAL =
+
+      3,
+    FP_NORMAL =
+
+      4
+  };
+# 1054 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h" 3 4
+extern int __iscanonicall (long double __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 1055 "/usr/include/math.h" 2 3 4
+# 1471 "/usr/include/math.h" 3 4
+
+# 219 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h" 2
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/time.h" 1 3 4
+# 34 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
+
+# 52 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
+struct timezone
+  {
+    int tz_minuteswest;
+    int tz_dsttime;
+  };
+# 67 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
+extern int gettimeofday (struct timeval *__restrict __tv,
+    void *__restrict __tz) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 86 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
+extern int settimeofday (const struct timeval *__tv,
+    const struct timezone *__tz)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int adjtime (const struct timeval *__delta,
+      struct timeval *__olddelta) __attribute__ ((__nothrow__ , __leaf__));
+# 114 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
+enum __itimer_which
+  {
+
+    ITIMER_REAL = 0,
+
+
+    ITIMER_VIRTUAL = 1,
+
+
+
+    ITIMER_PROF = 2
+
+  };
+
+
+
+struct itimerval
+  {
+
+    struct timeval it_interval;
+
+    struct timeval it_value;
+  };
+
+
+
+
+typedef enum __itimer_which __itimer_which_t;
+
+
+
+
+
+
+
+extern int getitimer (__itimer_which_t __which,
+        struct itimerval *__value) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int setitimer (__itimer_which_t __which,
+        const struct itimerval *__restrict __new,
+        struct itimerval *__restrict __old) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int utimes (const char *__file, const struct timeval __tvp[2])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 189 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
+extern int lutimes (const char *__file, const struct timeval __tvp[2])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int futimes (int __fd, const struct timeval __tvp[2]) __attribute__ ((__nothrow__ , __leaf__));
+# 214 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
+extern int futimesat (int __fd, const char *__file,
+        const struct timeval __tvp[2]) __attribute__ ((__nothrow__ , __leaf__));
+# 258 "/usr/include/x86_64-linux-gnu/sys/time.h" 3 4
+
+# 226 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h" 2
+
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 73 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timex.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+struct timex
+{
+# 58 "/usr/include/x86_64-linux-gnu/bits/timex.h" 3 4
+  unsigned int modes;
+  __syscall_slong_t offset;
+  __syscall_slong_t freq;
+  __syscall_slong_t maxerror;
+  __syscall_slong_t esterror;
+  int status;
+  __syscall_slong_t constant;
+  __syscall_slong_t precision;
+  __syscall_slong_t tolerance;
+  struct timeval time;
+  __syscall_slong_t tick;
+  __syscall_slong_t ppsfreq;
+  __syscall_slong_t jitter;
+  int shift;
+  __syscall_slong_t stabil;
+  __syscall_slong_t jitcnt;
+  __syscall_slong_t calcnt;
+  __syscall_slong_t errcnt;
+  __syscall_slong_t stbcnt;
+
+  int tai;
+
+
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32; int :32;
+  int :32; int :32; int :32;
+
+};
+# 74 "/usr/include/x86_64-linux-gnu/bits/time.h" 2 3 4
+
+
+
+
+extern int clock_adjtime (__clockid_t __clock_id, struct timex *__utx) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 90 "/usr/include/x86_64-linux-gnu/bits/time.h" 3 4
+
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+# 48 "/usr/include/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 68 "/usr/include/time.h" 3 4
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern char *strptime (const char *__restrict __s,
+         const char *__restrict __fmt, struct tm *__tp)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *strptime_l (const char *__restrict __s,
+    const char *__restrict __fmt, struct tm *__tp,
+    locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int timespec_get (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 399 "/usr/include/time.h" 3 4
+extern int timespec_getres (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 425 "/usr/include/time.h" 3 4
+extern int getdate_err;
+# 434 "/usr/include/time.h" 3 4
+extern struct tm *getdate (const char *__string);
+# 448 "/usr/include/time.h" 3 4
+extern int getdate_r (const char *__restrict __string,
+        struct tm *__restrict __resbufp);
+
+
+
+# 228 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h" 2
+# 244 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h"
+# 1 "/usr/include/x86_64-linux-gnu/sys/stat.h" 1 3 4
+# 99 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stat.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/stat.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+struct stat
+  {
+
+
+
+    __dev_t st_dev;
+
+
+
+
+    __ino_t st_ino;
+
+
+
+
+
+
+
+    __nlink_t st_nlink;
+    __mode_t st_mode;
+
+    __uid_t st_uid;
+    __gid_t st_gid;
+
+    int __pad0;
+
+    __dev_t st_rdev;
+
+
+
+
+    __off_t st_size;
+
+
+
+    __blksize_t st_blksize;
+
+    __blkcnt_t st_blocks;
+# 74 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+    struct timespec st_atim;
+    struct timespec st_mtim;
+    struct timespec st_ctim;
+# 89 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+    __syscall_slong_t __glibc_reserved[3];
+# 99 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+  };
+
+
+
+struct stat64
+  {
+
+
+
+    __dev_t st_dev;
+
+    __ino64_t st_ino;
+    __nlink_t st_nlink;
+    __mode_t st_mode;
+
+
+
+
+
+
+    __uid_t st_uid;
+    __gid_t st_gid;
+
+    int __pad0;
+    __dev_t st_rdev;
+    __off_t st_size;
+
+
+
+
+
+    __blksize_t st_blksize;
+    __blkcnt64_t st_blocks;
+
+
+
+
+
+
+
+    struct timespec st_atim;
+    struct timespec st_mtim;
+    struct timespec st_ctim;
+# 151 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+    __syscall_slong_t __glibc_reserved[3];
+
+
+
+
+  };
+# 26 "/usr/include/x86_64-linux-gnu/bits/stat.h" 2 3 4
+# 102 "/usr/include/x86_64-linux-gnu/sys/stat.h" 2 3 4
+# 227 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int stat (const char *__restrict __file, struct stat *__restrict __buf) __asm__ ("" "stat64") __attribute__ ((__nothrow__ , __leaf__))
+
+     __attribute__ ((__nonnull__ (1, 2)));
+extern int fstat (int __fd, struct stat *__buf) __asm__ ("" "fstat64") __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__nonnull__ (2)));
+# 240 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int stat64 (const char *__restrict __file,
+     struct stat64 *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int fstat64 (int __fd, struct stat64 *__buf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 279 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int fstatat (int __fd, const char *__restrict __file, struct stat *__restrict __buf, int __flag) __asm__ ("" "fstatat64") __attribute__ ((__nothrow__ , __leaf__))
+
+
+                 __attribute__ ((__nonnull__ (2, 3)));
+# 291 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int fstatat64 (int __fd, const char *__restrict __file,
+        struct stat64 *__restrict __buf, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 327 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int lstat (const char *__restrict __file, struct stat *__restrict __buf) __asm__ ("" "lstat64") __attribute__ ((__nothrow__ , __leaf__))
+
+
+     __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern int lstat64 (const char *__restrict __file,
+      struct stat64 *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 352 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int chmod (const char *__file, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int lchmod (const char *__file, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int fchmod (int __fd, __mode_t __mode) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int fchmodat (int __fd, const char *__file, __mode_t __mode,
+       int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+
+
+
+extern __mode_t umask (__mode_t __mask) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern __mode_t getumask (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int mkdir (const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int mkdirat (int __fd, const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+extern int mknod (const char *__path, __mode_t __mode, __dev_t __dev)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int mknodat (int __fd, const char *__path, __mode_t __mode,
+      __dev_t __dev) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+extern int mkfifo (const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int mkfifoat (int __fd, const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+extern int utimensat (int __fd, const char *__path,
+        const struct timespec __times[2],
+        int __flags)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 452 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int futimens (int __fd, const struct timespec __times[2]) __attribute__ ((__nothrow__ , __leaf__));
+# 465 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/statx.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/statx.h" 3 4
+# 1 "/usr/include/linux/stat.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/linux/types.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/types.h" 1 3 4
+# 1 "/usr/include/asm-generic/types.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/include/asm-generic/int-ll64.h" 1 3 4
+# 12 "/usr/include/asm-generic/int-ll64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h" 3 4
+# 1 "/usr/include/asm-generic/bitsperlong.h" 1 3 4
+# 12 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h" 2 3 4
+# 13 "/usr/include/asm-generic/int-ll64.h" 2 3 4
+
+
+
+
+
+
+
+typedef __signed__ char __s8;
+typedef unsigned char __u8;
+
+typedef __signed__ short __s16;
+typedef unsigned short __u16;
+
+typedef __signed__ int __s32;
+typedef unsigned int __u32;
+
+
+__extension__ typedef __signed__ long long __s64;
+__extension__ typedef unsigned long long __u64;
+# 8 "/usr/include/asm-generic/types.h" 2 3 4
+# 2 "/usr/include/x86_64-linux-gnu/asm/types.h" 2 3 4
+# 6 "/usr/include/linux/types.h" 2 3 4
+
+
+
+# 1 "/usr/include/linux/posix_types.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/linux/stddef.h" 1 3 4
+# 6 "/usr/include/linux/posix_types.h" 2 3 4
+# 25 "/usr/include/linux/posix_types.h" 3 4
+typedef struct {
+ unsigned long fds_bits[1024 / (8 * sizeof(long))];
+} __kernel_fd_set;
+
+
+typedef void (*__kernel_sighandler_t)(int);
+
+
+typedef int __kernel_key_t;
+typedef int __kernel_mqd_t;
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/posix_types.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h" 3 4
+typedef unsigned short __kernel_old_uid_t;
+typedef unsigned short __kernel_old_gid_t;
+
+
+typedef unsigned long __kernel_old_dev_t;
+
+
+# 1 "/usr/include/asm-generic/posix_types.h" 1 3 4
+# 15 "/usr/include/asm-generic/posix_types.h" 3 4
+typedef long __kernel_long_t;
+typedef unsigned long __kernel_ulong_t;
+
+
+
+typedef __kernel_ulong_t __kernel_ino_t;
+
+
+
+typedef unsigned int __kernel_mode_t;
+
+
+
+typedef int __kernel_pid_t;
+
+
+
+typedef int __kernel_ipc_pid_t;
+
+
+
+typedef unsigned int __kernel_uid_t;
+typedef unsigned int __kernel_gid_t;
+
+
+
+typedef __kernel_long_t __kernel_suseconds_t;
+
+
+
+typedef int __kernel_daddr_t;
+
+
+
+typedef unsigned int __kernel_uid32_t;
+typedef unsigned int __kernel_gid32_t;
+# 72 "/usr/include/asm-generic/posix_types.h" 3 4
+typedef __kernel_ulong_t __kernel_size_t;
+typedef __kernel_long_t __kernel_ssize_t;
+typedef __kernel_long_t __kernel_ptrdiff_t;
+
+
+
+
+typedef struct {
+ int val[2];
+} __kernel_fsid_t;
+
+
+
+
+
+typedef __kernel_long_t __kernel_off_t;
+typedef long long __kernel_loff_t;
+typedef __kernel_long_t __kernel_old_time_t;
+typedef __kernel_long_t __kernel_time_t;
+typedef long long __kernel_time64_t;
+typedef __kernel_long_t __kernel_clock_t;
+typedef int __kernel_timer_t;
+typedef int __kernel_clockid_t;
+typedef char * __kernel_caddr_t;
+typedef unsigned short __kernel_uid16_t;
+typedef unsigned short __kernel_gid16_t;
+# 19 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h" 2 3 4
+# 8 "/usr/include/x86_64-linux-gnu/asm/posix_types.h" 2 3 4
+# 37 "/usr/include/linux/posix_types.h" 2 3 4
+# 10 "/usr/include/linux/types.h" 2 3 4
+# 27 "/usr/include/linux/types.h" 3 4
+typedef __u16 __le16;
+typedef __u16 __be16;
+typedef __u32 __le32;
+typedef __u32 __be32;
+typedef __u64 __le64;
+typedef __u64 __be64;
+
+typedef __u16 __sum16;
+typedef __u32 __wsum;
+# 51 "/usr/include/linux/types.h" 3 4
+typedef unsigned __poll_t;
+# 6 "/usr/include/linux/stat.h" 2 3 4
+# 56 "/usr/include/linux/stat.h" 3 4
+struct statx_timestamp {
+ __s64 tv_sec;
+ __u32 tv_nsec;
+ __s32 __reserved;
+};
+# 99 "/usr/include/linux/stat.h" 3 4
+struct statx {
+
+ __u32 stx_mask;
+ __u32 stx_blksize;
+ __u64 stx_attributes;
+
+ __u32 stx_nlink;
+ __u32 stx_uid;
+ __u32 stx_gid;
+ __u16 stx_mode;
+ __u16 __spare0[1];
+
+ __u64 stx_ino;
+ __u64 stx_size;
+ __u64 stx_blocks;
+ __u64 stx_attributes_mask;
+
+ struct statx_timestamp stx_atime;
+ struct statx_timestamp stx_btime;
+ struct statx_timestamp stx_ctime;
+ struct statx_timestamp stx_mtime;
+
+ __u32 stx_rdev_major;
+ __u32 stx_rdev_minor;
+ __u32 stx_dev_major;
+ __u32 stx_dev_minor;
+
+ __u64 stx_mnt_id;
+ __u32 stx_dio_mem_align;
+ __u32 stx_dio_offset_align;
+
+ __u64 __spare3[12];
+
+};
+# 32 "/usr/include/x86_64-linux-gnu/bits/statx.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_statx_timestamp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_statx.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 2 3 4
+# 57 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h" 3 4
+
+
+
+int statx (int __dirfd, const char *__restrict __path, int __flags,
+           unsigned int __mask, struct statx *__restrict __buf)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 5)));
+
+
+# 40 "/usr/include/x86_64-linux-gnu/bits/statx.h" 2 3 4
+# 466 "/usr/include/x86_64-linux-gnu/sys/stat.h" 2 3 4
+
+
+
+# 245 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h" 2
+# 516 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/exports.h" 1
+# 517 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h" 2
+# 39 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pymacro.h" 1
+# 40 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pymath.h" 1
+# 41 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pymem.h" 1
+# 52 "/root/.pyenv/versions/3.11.7/include/python3.11/pymem.h"
+
+# 52 "/root/.pyenv/versions/3.11.7/include/python3.11/pymem.h"
+__attribute__ ((visibility ("default"))) void * PyMem_Malloc(size_t size);
+__attribute__ ((visibility ("default"))) void * PyMem_Calloc(size_t nelem, size_t elsize);
+__attribute__ ((visibility ("default"))) void * PyMem_Realloc(void *ptr, size_t new_size);
+__attribute__ ((visibility ("default"))) void PyMem_Free(void *ptr);
+# 96 "/root/.pyenv/versions/3.11.7/include/python3.11/pymem.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pymem.h" 1
+
+
+
+
+__attribute__ ((visibility ("default"))) void * PyMem_RawMalloc(size_t size);
+__attribute__ ((visibility ("default"))) void * PyMem_RawCalloc(size_t nelem, size_t elsize);
+__attribute__ ((visibility ("default"))) void * PyMem_RawRealloc(void *ptr, size_t new_size);
+__attribute__ ((visibility ("default"))) void PyMem_RawFree(void *ptr);
+
+
+__attribute__ ((visibility ("default"))) const char* _PyMem_GetCurrentAllocatorName(void);
+
+
+__attribute__ ((visibility ("default"))) char * _PyMem_RawStrdup(const char *str);
+
+
+__attribute__ ((visibility ("default"))) char * _PyMem_Strdup(const char *str);
+
+
+__attribute__ ((visibility ("default"))) wchar_t* _PyMem_RawWcsdup(const wchar_t *str);
+
+
+typedef enum {
+
+    PYMEM_DOMAIN_RAW,
+
+
+    PYMEM_DOMAIN_MEM,
+
+
+    PYMEM_DOMAIN_OBJ
+} PyMemAllocatorDomain;
+
+typedef enum {
+    PYMEM_ALLOCATOR_NOT_SET = 0,
+    PYMEM_ALLOCATOR_DEFAULT = 1,
+    PYMEM_ALLOCATOR_DEBUG = 2,
+    PYMEM_ALLOCATOR_MALLOC = 3,
+    PYMEM_ALLOCATOR_MALLOC_DEBUG = 4,
+
+    PYMEM_ALLOCATOR_PYMALLOC = 5,
+    PYMEM_ALLOCATOR_PYMALLOC_DEBUG = 6,
+
+} PyMemAllocatorName;
+
+
+typedef struct {
+
+    void *ctx;
+
+
+    void* (*malloc) (void *ctx, size_t size);
+
+
+    void* (*calloc) (void *ctx, size_t nelem, size_t elsize);
+
+
+    void* (*realloc) (void *ctx, void *ptr, size_t new_size);
+
+
+    void (*free) (void *ctx, void *ptr);
+} PyMemAllocatorEx;
+
+
+__attribute__ ((visibility ("default"))) void PyMem_GetAllocator(PyMemAllocatorDomain domain,
+                                    PyMemAllocatorEx *allocator);
+# 79 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pymem.h"
+__attribute__ ((visibility ("default"))) void PyMem_SetAllocator(PyMemAllocatorDomain domain,
+                                    PyMemAllocatorEx *allocator);
+# 98 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pymem.h"
+__attribute__ ((visibility ("default"))) void PyMem_SetupDebugHooks(void);
+# 97 "/root/.pyenv/versions/3.11.7/include/python3.11/pymem.h" 2
+# 42 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pytypedefs.h" 1
+# 12 "/root/.pyenv/versions/3.11.7/include/python3.11/pytypedefs.h"
+typedef struct PyModuleDef PyModuleDef;
+typedef struct PyModuleDef_Slot PyModuleDef_Slot;
+typedef struct PyMethodDef PyMethodDef;
+typedef struct PyGetSetDef PyGetSetDef;
+typedef struct PyMemberDef PyMemberDef;
+
+typedef struct _object PyObject;
+typedef struct _longobject PyLongObject;
+typedef struct _typeobject PyTypeObject;
+typedef struct PyCodeObject PyCodeObject;
+typedef struct _frame PyFrameObject;
+
+typedef struct _ts PyThreadState;
+typedef struct _is PyInterpreterState;
+# 43 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pybuffer.h" 1
+# 20 "/root/.pyenv/versions/3.11.7/include/python3.11/pybuffer.h"
+typedef struct {
+    void *buf;
+    PyObject *obj;
+    Py_ssize_t len;
+    Py_ssize_t itemsize;
+
+    int readonly;
+    int ndim;
+    char *format;
+    Py_ssize_t *shape;
+    Py_ssize_t *strides;
+    Py_ssize_t *suboffsets;
+    void *internal;
+} Py_buffer;
+
+
+__attribute__ ((visibility ("default"))) int PyObject_CheckBuffer(PyObject *obj);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyObject_GetBuffer(PyObject *obj, Py_buffer *view,
+                                   int flags);
+
+
+
+__attribute__ ((visibility ("default"))) void * PyBuffer_GetPointer(const Py_buffer *view, const Py_ssize_t *indices);
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyBuffer_SizeFromFormat(const char *format);
+
+
+__attribute__ ((visibility ("default"))) int PyBuffer_ToContiguous(void *buf, const Py_buffer *view,
+                                      Py_ssize_t len, char order);
+
+__attribute__ ((visibility ("default"))) int PyBuffer_FromContiguous(const Py_buffer *view, const void *buf,
+                                        Py_ssize_t len, char order);
+# 74 "/root/.pyenv/versions/3.11.7/include/python3.11/pybuffer.h"
+__attribute__ ((visibility ("default"))) int PyObject_CopyData(PyObject *dest, PyObject *src);
+
+
+__attribute__ ((visibility ("default"))) int PyBuffer_IsContiguous(const Py_buffer *view, char fort);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void PyBuffer_FillContiguousStrides(int ndims,
+                                               Py_ssize_t *shape,
+                                               Py_ssize_t *strides,
+                                               int itemsize,
+                                               char fort);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyBuffer_FillInfo(Py_buffer *view, PyObject *o, void *buf,
+                                  Py_ssize_t len, int readonly,
+                                  int flags);
+
+
+__attribute__ ((visibility ("default"))) void PyBuffer_Release(Py_buffer *view);
+# 44 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h" 1
+# 100 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+struct _object {
+   
+    Py_ssize_t ob_refcnt;
+    PyTypeObject *ob_type;
+};
+
+
+
+
+typedef struct {
+    PyObject ob_base;
+    Py_ssize_t ob_size;
+} PyVarObject;
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int Py_Is(PyObject *x, PyObject *y);
+
+
+
+static inline Py_ssize_t Py_REFCNT(PyObject *ob) {
+    return ob->ob_refcnt;
+}
+
+
+
+
+
+
+static inline PyTypeObject* Py_TYPE(PyObject *ob) {
+    return ob->ob_type;
+}
+
+
+
+
+
+static inline Py_ssize_t Py_SIZE(PyObject *ob) {
+    PyVarObject *var_ob = ((PyVarObject*)((ob)));
+    return var_ob->ob_size;
+}
+
+
+
+
+
+static inline int Py_IS_TYPE(PyObject *ob, PyTypeObject *type) {
+    return Py_TYPE(((PyObject*)((ob)))) == type;
+}
+
+
+
+
+
+static inline void Py_SET_REFCNT(PyObject *ob, Py_ssize_t refcnt) {
+    ob->ob_refcnt = refcnt;
+}
+
+
+
+
+
+static inline void Py_SET_TYPE(PyObject *ob, PyTypeObject *type) {
+    ob->ob_type = type;
+}
+
+
+
+
+
+static inline void Py_SET_SIZE(PyVarObject *ob, Py_ssize_t size) {
+    ob->ob_size = size;
+}
+# 196 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+typedef PyObject * (*unaryfunc)(PyObject *);
+typedef PyObject * (*binaryfunc)(PyObject *, PyObject *);
+typedef PyObject * (*ternaryfunc)(PyObject *, PyObject *, PyObject *);
+typedef int (*inquiry)(PyObject *);
+typedef Py_ssize_t (*lenfunc)(PyObject *);
+typedef PyObject *(*ssizeargfunc)(PyObject *, Py_ssize_t);
+typedef PyObject *(*ssizessizeargfunc)(PyObject *, Py_ssize_t, Py_ssize_t);
+typedef int(*ssizeobjargproc)(PyObject *, Py_ssize_t, PyObject *);
+typedef int(*ssizessizeobjargproc)(PyObject *, Py_ssize_t, Py_ssize_t, PyObject *);
+typedef int(*objobjargproc)(PyObject *, PyObject *, PyObject *);
+
+typedef int (*objobjproc)(PyObject *, PyObject *);
+typedef int (*visitproc)(PyObject *, void *);
+typedef int (*traverseproc)(PyObject *, visitproc, void *);
+
+
+typedef void (*freefunc)(void *);
+typedef void (*destructor)(PyObject *);
+typedef PyObject *(*getattrfunc)(PyObject *, char *);
+typedef PyObject *(*getattrofunc)(PyObject *, PyObject *);
+typedef int (*setattrfunc)(PyObject *, char *, PyObject *);
+typedef int (*setattrofunc)(PyObject *, PyObject *, PyObject *);
+typedef PyObject *(*reprfunc)(PyObject *);
+typedef Py_hash_t (*hashfunc)(PyObject *);
+typedef PyObject *(*richcmpfunc) (PyObject *, PyObject *, int);
+typedef PyObject *(*getiterfunc) (PyObject *);
+typedef PyObject *(*iternextfunc) (PyObject *);
+typedef PyObject *(*descrgetfunc) (PyObject *, PyObject *, PyObject *);
+typedef int (*descrsetfunc) (PyObject *, PyObject *, PyObject *);
+typedef int (*initproc)(PyObject *, PyObject *, PyObject *);
+typedef PyObject *(*newfunc)(PyTypeObject *, PyObject *, PyObject *);
+typedef PyObject *(*allocfunc)(PyTypeObject *, Py_ssize_t);
+
+typedef struct{
+    int slot;
+    void *pfunc;
+} PyType_Slot;
+
+typedef struct{
+    const char* name;
+    int basicsize;
+    int itemsize;
+    unsigned int flags;
+    PyType_Slot *slots;
+} PyType_Spec;
+
+__attribute__ ((visibility ("default"))) PyObject* PyType_FromSpec(PyType_Spec*);
+
+__attribute__ ((visibility ("default"))) PyObject* PyType_FromSpecWithBases(PyType_Spec*, PyObject*);
+
+
+__attribute__ ((visibility ("default"))) void* PyType_GetSlot(PyTypeObject*, int);
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyType_FromModuleAndSpec(PyObject *, PyType_Spec *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyType_GetModule(PyTypeObject *);
+__attribute__ ((visibility ("default"))) void * PyType_GetModuleState(PyTypeObject *);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyType_GetName(PyTypeObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyType_GetQualName(PyTypeObject *);
+
+
+
+__attribute__ ((visibility ("default"))) int PyType_IsSubtype(PyTypeObject *, PyTypeObject *);
+
+static inline int PyObject_TypeCheck(PyObject *ob, PyTypeObject *type) {
+    return Py_IS_TYPE(((PyObject*)((ob))), type) || PyType_IsSubtype(Py_TYPE(((PyObject*)((ob)))), type);
+}
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyType_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyBaseObject_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PySuper_Type;
+
+__attribute__ ((visibility ("default"))) unsigned long PyType_GetFlags(PyTypeObject*);
+
+__attribute__ ((visibility ("default"))) int PyType_Ready(PyTypeObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyType_GenericAlloc(PyTypeObject *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) PyObject * PyType_GenericNew(PyTypeObject *,
+                                               PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) unsigned int PyType_ClearCache(void);
+__attribute__ ((visibility ("default"))) void PyType_Modified(PyTypeObject *);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_Repr(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyObject_Str(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyObject_ASCII(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyObject_Bytes(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyObject_RichCompare(PyObject *, PyObject *, int);
+__attribute__ ((visibility ("default"))) int PyObject_RichCompareBool(PyObject *, PyObject *, int);
+__attribute__ ((visibility ("default"))) PyObject * PyObject_GetAttrString(PyObject *, const char *);
+__attribute__ ((visibility ("default"))) int PyObject_SetAttrString(PyObject *, const char *, PyObject *);
+__attribute__ ((visibility ("default"))) int PyObject_HasAttrString(PyObject *, const char *);
+__attribute__ ((visibility ("default"))) PyObject * PyObject_GetAttr(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) int PyObject_SetAttr(PyObject *, PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) int PyObject_HasAttr(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyObject_SelfIter(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyObject_GenericGetAttr(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) int PyObject_GenericSetAttr(PyObject *, PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) int PyObject_GenericSetDict(PyObject *, PyObject *, void *);
+
+__attribute__ ((visibility ("default"))) Py_hash_t PyObject_Hash(PyObject *);
+__attribute__ ((visibility ("default"))) Py_hash_t PyObject_HashNotImplemented(PyObject *);
+__attribute__ ((visibility ("default"))) int PyObject_IsTrue(PyObject *);
+__attribute__ ((visibility ("default"))) int PyObject_Not(PyObject *);
+__attribute__ ((visibility ("default"))) int PyCallable_Check(PyObject *);
+__attribute__ ((visibility ("default"))) void PyObject_ClearWeakRefs(PyObject *);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_Dir(PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_GetState(PyObject *);
+
+
+
+
+__attribute__ ((visibility ("default"))) int Py_ReprEnter(PyObject *);
+__attribute__ ((visibility ("default"))) void Py_ReprLeave(PyObject *);
+# 477 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+__attribute__ ((visibility ("default"))) void _Py_Dealloc(PyObject *);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void Py_IncRef(PyObject *);
+__attribute__ ((visibility ("default"))) void Py_DecRef(PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) void _Py_IncRef(PyObject *);
+__attribute__ ((visibility ("default"))) void _Py_DecRef(PyObject *);
+
+static inline void Py_INCREF(PyObject *op)
+{
+# 502 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+    op->ob_refcnt++;
+
+}
+# 533 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+static inline void Py_DECREF(PyObject *op)
+{
+
+
+    if (--op->ob_refcnt == 0) {
+        _Py_Dealloc(op);
+    }
+}
+# 589 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+static inline void Py_XINCREF(PyObject *op)
+{
+    if (op != 
+# 591 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h" 3 4
+             ((void *)0)
+# 591 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+                     ) {
+        Py_INCREF(((PyObject*)((op))));
+    }
+}
+
+
+
+
+static inline void Py_XDECREF(PyObject *op)
+{
+    if (op != 
+# 601 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h" 3 4
+             ((void *)0)
+# 601 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+                     ) {
+        Py_DECREF(((PyObject*)((op))));
+    }
+}
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* Py_NewRef(PyObject *obj);
+
+
+__attribute__ ((visibility ("default"))) PyObject* Py_XNewRef(PyObject *obj);
+
+static inline PyObject* _Py_NewRef(PyObject *obj)
+{
+    Py_INCREF(((PyObject*)((obj))));
+    return obj;
+}
+
+static inline PyObject* _Py_XNewRef(PyObject *obj)
+{
+    Py_XINCREF(((PyObject*)((obj))));
+    return obj;
+}
+# 646 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+extern __attribute__ ((visibility ("default"))) PyObject _Py_NoneStruct;
+
+
+
+__attribute__ ((visibility ("default"))) int Py_IsNone(PyObject *x);
+# 660 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+extern __attribute__ ((visibility ("default"))) PyObject _Py_NotImplementedStruct;
+# 676 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+typedef enum {
+    PYGEN_RETURN = 0,
+    PYGEN_ERROR = -1,
+    PYGEN_NEXT = 1,
+} PySendResult;
+# 757 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h" 1
+
+
+
+
+__attribute__ ((visibility ("default"))) void _Py_NewReference(PyObject *op);
+# 37 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+typedef struct _Py_Identifier {
+    const char* string;
+
+
+    Py_ssize_t index;
+} _Py_Identifier;
+# 54 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+typedef int (*getbufferproc)(PyObject *, Py_buffer *, int);
+typedef void (*releasebufferproc)(PyObject *, Py_buffer *);
+
+typedef PyObject *(*vectorcallfunc)(PyObject *callable, PyObject *const *args,
+                                    size_t nargsf, PyObject *kwnames);
+
+
+typedef struct {
+
+
+
+
+    binaryfunc nb_add;
+    binaryfunc nb_subtract;
+    binaryfunc nb_multiply;
+    binaryfunc nb_remainder;
+    binaryfunc nb_divmod;
+    ternaryfunc nb_power;
+    unaryfunc nb_negative;
+    unaryfunc nb_positive;
+    unaryfunc nb_absolute;
+    inquiry nb_bool;
+    unaryfunc nb_invert;
+    binaryfunc nb_lshift;
+    binaryfunc nb_rshift;
+    binaryfunc nb_and;
+    binaryfunc nb_xor;
+    binaryfunc nb_or;
+    unaryfunc nb_int;
+    void *nb_reserved;
+    unaryfunc nb_float;
+
+    binaryfunc nb_inplace_add;
+    binaryfunc nb_inplace_subtract;
+    binaryfunc nb_inplace_multiply;
+    binaryfunc nb_inplace_remainder;
+    ternaryfunc nb_inplace_power;
+    binaryfunc nb_inplace_lshift;
+    binaryfunc nb_inplace_rshift;
+    binaryfunc nb_inplace_and;
+    binaryfunc nb_inplace_xor;
+    binaryfunc nb_inplace_or;
+
+    binaryfunc nb_floor_divide;
+    binaryfunc nb_true_divide;
+    binaryfunc nb_inplace_floor_divide;
+    binaryfunc nb_inplace_true_divide;
+
+    unaryfunc nb_index;
+
+    binaryfunc nb_matrix_multiply;
+    binaryfunc nb_inplace_matrix_multiply;
+} PyNumberMethods;
+
+typedef struct {
+    lenfunc sq_length;
+    binaryfunc sq_concat;
+    ssizeargfunc sq_repeat;
+    ssizeargfunc sq_item;
+    void *was_sq_slice;
+    ssizeobjargproc sq_ass_item;
+    void *was_sq_ass_slice;
+    objobjproc sq_contains;
+
+    binaryfunc sq_inplace_concat;
+    ssizeargfunc sq_inplace_repeat;
+} PySequenceMethods;
+
+typedef struct {
+    lenfunc mp_length;
+    binaryfunc mp_subscript;
+    objobjargproc mp_ass_subscript;
+} PyMappingMethods;
+
+typedef PySendResult (*sendfunc)(PyObject *iter, PyObject *value, PyObject **result);
+
+typedef struct {
+    unaryfunc am_await;
+    unaryfunc am_aiter;
+    unaryfunc am_anext;
+    sendfunc am_send;
+} PyAsyncMethods;
+
+typedef struct {
+     getbufferproc bf_getbuffer;
+     releasebufferproc bf_releasebuffer;
+} PyBufferProcs;
+
+
+
+typedef Py_ssize_t printfunc;
+
+
+
+struct _typeobject {
+    PyVarObject ob_base;
+    const char *tp_name;
+    Py_ssize_t tp_basicsize, tp_itemsize;
+
+
+
+    destructor tp_dealloc;
+    Py_ssize_t tp_vectorcall_offset;
+    getattrfunc tp_getattr;
+    setattrfunc tp_setattr;
+    PyAsyncMethods *tp_as_async;
+
+    reprfunc tp_repr;
+
+
+
+    PyNumberMethods *tp_as_number;
+    PySequenceMethods *tp_as_sequence;
+    PyMappingMethods *tp_as_mapping;
+
+
+
+    hashfunc tp_hash;
+    ternaryfunc tp_call;
+    reprfunc tp_str;
+    getattrofunc tp_getattro;
+    setattrofunc tp_setattro;
+
+
+    PyBufferProcs *tp_as_buffer;
+
+
+    unsigned long tp_flags;
+
+    const char *tp_doc;
+
+
+
+    traverseproc tp_traverse;
+
+
+    inquiry tp_clear;
+
+
+
+    richcmpfunc tp_richcompare;
+
+
+    Py_ssize_t tp_weaklistoffset;
+
+
+    getiterfunc tp_iter;
+    iternextfunc tp_iternext;
+
+
+    PyMethodDef *tp_methods;
+    PyMemberDef *tp_members;
+    PyGetSetDef *tp_getset;
+
+    PyTypeObject *tp_base;
+    PyObject *tp_dict;
+    descrgetfunc tp_descr_get;
+    descrsetfunc tp_descr_set;
+    Py_ssize_t tp_dictoffset;
+    initproc tp_init;
+    allocfunc tp_alloc;
+    newfunc tp_new;
+    freefunc tp_free;
+    inquiry tp_is_gc;
+    PyObject *tp_bases;
+    PyObject *tp_mro;
+    PyObject *tp_cache;
+    PyObject *tp_subclasses;
+    PyObject *tp_weaklist;
+    destructor tp_del;
+
+
+    unsigned int tp_version_tag;
+
+    destructor tp_finalize;
+    vectorcallfunc tp_vectorcall;
+};
+
+
+
+
+struct _specialization_cache {
+    PyObject *getitem;
+};
+
+
+typedef struct _heaptypeobject {
+
+
+    PyTypeObject ht_type;
+    PyAsyncMethods as_async;
+    PyNumberMethods as_number;
+    PyMappingMethods as_mapping;
+    PySequenceMethods as_sequence;
+
+
+
+
+    PyBufferProcs as_buffer;
+    PyObject *ht_name, *ht_slots, *ht_qualname;
+    struct _dictkeysobject *ht_cached_keys;
+    PyObject *ht_module;
+    char *_ht_tpname;
+    struct _specialization_cache _spec_cache;
+
+} PyHeapTypeObject;
+
+__attribute__ ((visibility ("default"))) const char * _PyType_Name(PyTypeObject *);
+__attribute__ ((visibility ("default"))) PyObject * _PyType_Lookup(PyTypeObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * _PyType_LookupId(PyTypeObject *, _Py_Identifier *);
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_LookupSpecialId(PyObject *, _Py_Identifier *);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyTypeObject * _PyType_CalculateMetaclass(PyTypeObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * _PyType_GetDocFromInternalDoc(const char *, const char *);
+__attribute__ ((visibility ("default"))) PyObject * _PyType_GetTextSignatureFromInternalDoc(const char *, const char *);
+__attribute__ ((visibility ("default"))) PyObject * PyType_GetModuleByDef(PyTypeObject *, PyModuleDef *);
+
+__attribute__ ((visibility ("default"))) int PyObject_Print(PyObject *, FILE *, int);
+__attribute__ ((visibility ("default"))) void _Py_BreakPoint(void);
+__attribute__ ((visibility ("default"))) void _PyObject_Dump(PyObject *);
+__attribute__ ((visibility ("default"))) int _PyObject_IsFreed(PyObject *);
+
+__attribute__ ((visibility ("default"))) int _PyObject_IsAbstract(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_GetAttrId(PyObject *, _Py_Identifier *);
+__attribute__ ((visibility ("default"))) int _PyObject_SetAttrId(PyObject *, _Py_Identifier *, PyObject *);
+# 292 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+__attribute__ ((visibility ("default"))) int _PyObject_LookupAttr(PyObject *, PyObject *, PyObject **);
+__attribute__ ((visibility ("default"))) int _PyObject_LookupAttrId(PyObject *, _Py_Identifier *, PyObject **);
+
+__attribute__ ((visibility ("default"))) int _PyObject_GetMethod(PyObject *obj, PyObject *name, PyObject **method);
+
+__attribute__ ((visibility ("default"))) PyObject ** _PyObject_GetDictPtr(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_NextNotImplemented(PyObject *);
+__attribute__ ((visibility ("default"))) void PyObject_CallFinalizer(PyObject *);
+__attribute__ ((visibility ("default"))) int PyObject_CallFinalizerFromDealloc(PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject *
+_PyObject_GenericGetAttrWithDict(PyObject *, PyObject *, PyObject *, int);
+__attribute__ ((visibility ("default"))) int
+_PyObject_GenericSetAttrWithDict(PyObject *, PyObject *,
+                                 PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_FunctionStr(PyObject *);
+# 346 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyNone_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyNotImplemented_Type;
+
+
+
+
+extern __attribute__ ((visibility ("default"))) int _Py_SwappedOp[];
+
+__attribute__ ((visibility ("default"))) void
+_PyDebugAllocatorStats(FILE *out, const char *block_name, int num_blocks,
+                       size_t sizeof_block);
+__attribute__ ((visibility ("default"))) void
+_PyObject_DebugTypeStats(FILE *out);
+# 400 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+__attribute__ ((visibility ("default"))) void __attribute__((__noreturn__)) _PyObject_AssertFailed(
+    PyObject *obj,
+    const char *expr,
+    const char *msg,
+    const char *file,
+    int line,
+    const char *function);
+# 419 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+__attribute__ ((visibility ("default"))) int _PyObject_CheckConsistency(
+    PyObject *op,
+    int check_content);
+# 472 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+__attribute__ ((visibility ("default"))) int _PyTrash_begin(PyThreadState *tstate, PyObject *op);
+__attribute__ ((visibility ("default"))) void _PyTrash_end(PyThreadState *tstate);
+
+__attribute__ ((visibility ("default"))) int _PyTrash_cond(PyObject *op, destructor dealloc);
+# 504 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+__attribute__((__deprecated__)) typedef int UsingDeprecatedTrashcanMacro;
+# 758 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h" 2
+
+
+
+
+static inline int
+PyType_HasFeature(PyTypeObject *type, unsigned long feature)
+{
+    unsigned long flags;
+
+
+
+
+    flags = type->tp_flags;
+
+    return ((flags & feature) != 0);
+}
+
+
+
+static inline int PyType_Check(PyObject *op) {
+    return PyType_HasFeature(Py_TYPE(((PyObject*)((op)))), (1UL << 31));
+}
+
+
+
+
+
+
+
+static inline int PyType_CheckExact(PyObject *op) {
+    return Py_IS_TYPE(((PyObject*)((op))), &PyType_Type);
+}
+# 45 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/objimpl.h" 1
+# 97 "/root/.pyenv/versions/3.11.7/include/python3.11/objimpl.h"
+__attribute__ ((visibility ("default"))) void * PyObject_Malloc(size_t size);
+
+__attribute__ ((visibility ("default"))) void * PyObject_Calloc(size_t nelem, size_t elsize);
+
+__attribute__ ((visibility ("default"))) void * PyObject_Realloc(void *ptr, size_t new_size);
+__attribute__ ((visibility ("default"))) void PyObject_Free(void *ptr);
+# 121 "/root/.pyenv/versions/3.11.7/include/python3.11/objimpl.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_Init(PyObject *, PyTypeObject *);
+__attribute__ ((visibility ("default"))) PyVarObject * PyObject_InitVar(PyVarObject *,
+                                           PyTypeObject *, Py_ssize_t);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_New(PyTypeObject *);
+__attribute__ ((visibility ("default"))) PyVarObject * _PyObject_NewVar(PyTypeObject *, Py_ssize_t);
+# 154 "/root/.pyenv/versions/3.11.7/include/python3.11/objimpl.h"
+__attribute__ ((visibility ("default"))) Py_ssize_t PyGC_Collect(void);
+
+__attribute__ ((visibility ("default"))) int PyGC_Enable(void);
+__attribute__ ((visibility ("default"))) int PyGC_Disable(void);
+__attribute__ ((visibility ("default"))) int PyGC_IsEnabled(void);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyVarObject * _PyObject_GC_Resize(PyVarObject *, Py_ssize_t);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_GC_New(PyTypeObject *);
+__attribute__ ((visibility ("default"))) PyVarObject * _PyObject_GC_NewVar(PyTypeObject *, Py_ssize_t);
+
+
+
+
+__attribute__ ((visibility ("default"))) void PyObject_GC_Track(void *);
+
+
+
+
+__attribute__ ((visibility ("default"))) void PyObject_GC_UnTrack(void *);
+
+__attribute__ ((visibility ("default"))) void PyObject_GC_Del(void *);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyObject_GC_IsTracked(PyObject *);
+__attribute__ ((visibility ("default"))) int PyObject_GC_IsFinalized(PyObject *);
+# 208 "/root/.pyenv/versions/3.11.7/include/python3.11/objimpl.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/objimpl.h" 1
+# 56 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/objimpl.h"
+typedef struct {
+
+    void *ctx;
+
+
+    void* (*alloc) (void *ctx, size_t size);
+
+
+    void (*free) (void *ctx, void *ptr, size_t size);
+} PyObjectArenaAllocator;
+
+
+__attribute__ ((visibility ("default"))) void PyObject_GetArenaAllocator(PyObjectArenaAllocator *allocator);
+
+
+__attribute__ ((visibility ("default"))) void PyObject_SetArenaAllocator(PyObjectArenaAllocator *allocator);
+
+
+
+__attribute__ ((visibility ("default"))) int PyObject_IS_GC(PyObject *obj);
+# 87 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/objimpl.h"
+__attribute__ ((visibility ("default"))) int PyType_SUPPORTS_WEAKREFS(PyTypeObject *type);
+
+__attribute__ ((visibility ("default"))) PyObject ** PyObject_GET_WEAKREFS_LISTPTR(PyObject *op);
+# 209 "/root/.pyenv/versions/3.11.7/include/python3.11/objimpl.h" 2
+# 46 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/typeslots.h" 1
+# 47 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pyhash.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/pyhash.h"
+__attribute__ ((visibility ("default"))) Py_hash_t _Py_HashDouble(PyObject *, double);
+__attribute__ ((visibility ("default"))) Py_hash_t _Py_HashPointer(const void*);
+
+__attribute__ ((visibility ("default"))) Py_hash_t _Py_HashPointerRaw(const void*);
+__attribute__ ((visibility ("default"))) Py_hash_t _Py_HashBytes(const void*, Py_ssize_t);
+# 55 "/root/.pyenv/versions/3.11.7/include/python3.11/pyhash.h"
+typedef union {
+
+    unsigned char uc[24];
+
+    struct {
+        Py_hash_t prefix;
+        Py_hash_t suffix;
+    } fnv;
+
+    struct {
+        uint64_t k0;
+        uint64_t k1;
+    } siphash;
+
+    struct {
+        unsigned char padding[16];
+        Py_hash_t suffix;
+    } djbx33a;
+    struct {
+        unsigned char padding[16];
+        Py_hash_t hashsalt;
+    } expat;
+} _Py_HashSecret_t;
+extern __attribute__ ((visibility ("default"))) _Py_HashSecret_t _Py_HashSecret;
+
+
+
+
+
+
+
+typedef struct {
+    Py_hash_t (*const hash)(const void *, Py_ssize_t);
+    const char *name;
+    const int hash_bits;
+    const int seed_bits;
+} PyHash_FuncDef;
+
+__attribute__ ((visibility ("default"))) PyHash_FuncDef* PyHash_GetFuncDef(void);
+# 48 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pydebug.h" 1
+
+
+
+
+
+
+
+extern __attribute__ ((visibility ("default"))) int Py_DebugFlag;
+extern __attribute__ ((visibility ("default"))) int Py_VerboseFlag;
+extern __attribute__ ((visibility ("default"))) int Py_QuietFlag;
+extern __attribute__ ((visibility ("default"))) int Py_InteractiveFlag;
+extern __attribute__ ((visibility ("default"))) int Py_InspectFlag;
+extern __attribute__ ((visibility ("default"))) int Py_OptimizeFlag;
+extern __attribute__ ((visibility ("default"))) int Py_NoSiteFlag;
+extern __attribute__ ((visibility ("default"))) int Py_BytesWarningFlag;
+extern __attribute__ ((visibility ("default"))) int Py_FrozenFlag;
+extern __attribute__ ((visibility ("default"))) int Py_IgnoreEnvironmentFlag;
+extern __attribute__ ((visibility ("default"))) int Py_DontWriteBytecodeFlag;
+extern __attribute__ ((visibility ("default"))) int Py_NoUserSiteDirectory;
+extern __attribute__ ((visibility ("default"))) int Py_UnbufferedStdioFlag;
+extern __attribute__ ((visibility ("default"))) int Py_HashRandomizationFlag;
+extern __attribute__ ((visibility ("default"))) int Py_IsolatedFlag;
+# 32 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pydebug.h"
+extern __attribute__ ((visibility ("default"))) char* Py_GETENV(const char *name);
+# 49 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/bytearrayobject.h" 1
+# 20 "/root/.pyenv/versions/3.11.7/include/python3.11/bytearrayobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyByteArray_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyByteArrayIter_Type;
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyByteArray_FromObject(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyByteArray_Concat(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyByteArray_FromStringAndSize(const char *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) Py_ssize_t PyByteArray_Size(PyObject *);
+__attribute__ ((visibility ("default"))) char * PyByteArray_AsString(PyObject *);
+__attribute__ ((visibility ("default"))) int PyByteArray_Resize(PyObject *, Py_ssize_t);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytearrayobject.h" 1
+
+
+
+
+
+typedef struct {
+    PyVarObject ob_base;
+    Py_ssize_t ob_alloc;
+    char *ob_bytes;
+    char *ob_start;
+    Py_ssize_t ob_exports;
+} PyByteArrayObject;
+
+extern __attribute__ ((visibility ("default"))) char _PyByteArray_empty_string[];
+
+
+
+
+
+static inline char* PyByteArray_AS_STRING(PyObject *op)
+{
+    PyByteArrayObject *self = (
+# 22 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytearrayobject.h" 3 4
+                             ((void) (0))
+# 22 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytearrayobject.h"
+                             , ((PyByteArrayObject*)(op)));
+    if (Py_SIZE(((PyObject*)((self))))) {
+        return self->ob_start;
+    }
+    return _PyByteArray_empty_string;
+}
+
+
+
+
+static inline Py_ssize_t PyByteArray_GET_SIZE(PyObject *op) {
+    PyByteArrayObject *self = (
+# 33 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytearrayobject.h" 3 4
+                             ((void) (0))
+# 33 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytearrayobject.h"
+                             , ((PyByteArrayObject*)(op)));
+    return Py_SIZE(((PyObject*)((self))));
+}
+# 38 "/root/.pyenv/versions/3.11.7/include/python3.11/bytearrayobject.h" 2
+# 50 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/bytesobject.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/bytesobject.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 11 "/root/.pyenv/versions/3.11.7/include/python3.11/bytesobject.h" 2
+# 27 "/root/.pyenv/versions/3.11.7/include/python3.11/bytesobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyBytes_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyBytesIter_Type;
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyBytes_FromStringAndSize(const char *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) PyObject * PyBytes_FromString(const char *);
+__attribute__ ((visibility ("default"))) PyObject * PyBytes_FromObject(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyBytes_FromFormatV(const char*, va_list)
+                                __attribute__((format(printf, 1, 0)));
+__attribute__ ((visibility ("default"))) PyObject * PyBytes_FromFormat(const char*, ...)
+                                __attribute__((format(printf, 1, 2)));
+__attribute__ ((visibility ("default"))) Py_ssize_t PyBytes_Size(PyObject *);
+__attribute__ ((visibility ("default"))) char * PyBytes_AsString(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyBytes_Repr(PyObject *, int);
+__attribute__ ((visibility ("default"))) void PyBytes_Concat(PyObject **, PyObject *);
+__attribute__ ((visibility ("default"))) void PyBytes_ConcatAndDel(PyObject **, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyBytes_DecodeEscape(const char *, Py_ssize_t,
+                                            const char *, Py_ssize_t,
+                                            const char *);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyBytes_AsStringAndSize(
+    PyObject *obj,
+    char **s,
+    Py_ssize_t *len
+    );
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytesobject.h" 1
+
+
+
+
+typedef struct {
+    PyVarObject ob_base;
+    __attribute__((__deprecated__)) Py_hash_t ob_shash;
+    char ob_sval[1];
+
+
+
+
+
+
+} PyBytesObject;
+
+__attribute__ ((visibility ("default"))) int _PyBytes_Resize(PyObject **, Py_ssize_t);
+__attribute__ ((visibility ("default"))) PyObject* _PyBytes_FormatEx(
+    const char *format,
+    Py_ssize_t format_len,
+    PyObject *args,
+    int use_bytearray);
+__attribute__ ((visibility ("default"))) PyObject* _PyBytes_FromHex(
+    PyObject *string,
+    int use_bytearray);
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyBytes_DecodeEscape(const char *, Py_ssize_t,
+                                             const char *, const char **);
+
+
+
+
+
+static inline char* PyBytes_AS_STRING(PyObject *op)
+{
+    return (
+# 37 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytesobject.h" 3 4
+          ((void) (0))
+# 37 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytesobject.h"
+          , ((PyBytesObject*)(op)))->ob_sval;
+}
+
+
+
+
+static inline Py_ssize_t PyBytes_GET_SIZE(PyObject *op) {
+    PyBytesObject *self = (
+# 44 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytesobject.h" 3 4
+                         ((void) (0))
+# 44 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytesobject.h"
+                         , ((PyBytesObject*)(op)));
+    return Py_SIZE(((PyObject*)((self))));
+}
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyBytes_Join(PyObject *sep, PyObject *x);
+
+
+
+
+
+typedef struct {
+
+    PyObject *buffer;
+
+
+    Py_ssize_t allocated;
+
+
+
+    Py_ssize_t min_size;
+
+
+    int use_bytearray;
+
+
+
+    int overallocate;
+
+
+    int use_small_buffer;
+    char small_buffer[512];
+} _PyBytesWriter;
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void _PyBytesWriter_Init(_PyBytesWriter *writer);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyBytesWriter_Finish(_PyBytesWriter *writer,
+    void *str);
+
+
+__attribute__ ((visibility ("default"))) void _PyBytesWriter_Dealloc(_PyBytesWriter *writer);
+
+
+
+
+__attribute__ ((visibility ("default"))) void* _PyBytesWriter_Alloc(_PyBytesWriter *writer,
+    Py_ssize_t size);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void* _PyBytesWriter_Prepare(_PyBytesWriter *writer,
+    void *str,
+    Py_ssize_t size);
+# 124 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/bytesobject.h"
+__attribute__ ((visibility ("default"))) void* _PyBytesWriter_Resize(_PyBytesWriter *writer,
+    void *str,
+    Py_ssize_t size);
+
+
+
+__attribute__ ((visibility ("default"))) void* _PyBytesWriter_WriteBytes(_PyBytesWriter *writer,
+    void *str,
+    const void *bytes,
+    Py_ssize_t size);
+# 63 "/root/.pyenv/versions/3.11.7/include/python3.11/bytesobject.h" 2
+# 51 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h" 1
+# 58 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+# 1 "/usr/include/ctype.h" 1 3 4
+# 28 "/usr/include/ctype.h" 3 4
+
+# 46 "/usr/include/ctype.h" 3 4
+
+# 46 "/usr/include/ctype.h" 3 4
+enum
+{
+  _ISupper = ((0) < 8 ? ((1 << (0)) << 8) : ((1 << (0)) >> 8)),
+  _ISlower = ((1) < 8 ? ((1 << (1)) << 8) : ((1 << (1)) >> 8)),
+  _ISalpha = ((2) < 8 ? ((1 << (2)) << 8) : ((1 << (2)) >> 8)),
+  _ISdigit = ((3) < 8 ? ((1 << (3)) << 8) : ((1 << (3)) >> 8)),
+  _ISxdigit = ((4) < 8 ? ((1 << (4)) << 8) : ((1 << (4)) >> 8)),
+  _ISspace = ((5) < 8 ? ((1 << (5)) << 8) : ((1 << (5)) >> 8)),
+  _ISprint = ((6) < 8 ? ((1 << (6)) << 8) : ((1 << (6)) >> 8)),
+  _ISgraph = ((7) < 8 ? ((1 << (7)) << 8) : ((1 << (7)) >> 8)),
+  _ISblank = ((8) < 8 ? ((1 << (8)) << 8) : ((1 << (8)) >> 8)),
+  _IScntrl = ((9) < 8 ? ((1 << (9)) << 8) : ((1 << (9)) >> 8)),
+  _ISpunct = ((10) < 8 ? ((1 << (10)) << 8) : ((1 << (10)) >> 8)),
+  _ISalnum = ((11) < 8 ? ((1 << (11)) << 8) : ((1 << (11)) >> 8))
+};
+# 79 "/usr/include/ctype.h" 3 4
+extern const unsigned short int **__ctype_b_loc (void)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+extern const __int32_t **__ctype_tolower_loc (void)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+extern const __int32_t **__ctype_toupper_loc (void)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 108 "/usr/include/ctype.h" 3 4
+extern int isalnum (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isalpha (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int iscntrl (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isdigit (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int islower (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isgraph (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isprint (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int ispunct (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isspace (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isupper (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isxdigit (int) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int tolower (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int toupper (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int isblank (int) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int isctype (int __c, int __mask) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int isascii (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int toascii (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int _toupper (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int _tolower (int) __attribute__ ((__nothrow__ , __leaf__));
+# 206 "/usr/include/ctype.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) tolower (int __c)
+{
+  return __c >= -128 && __c < 256 ? (*__ctype_tolower_loc ())[__c] : __c;
+}
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) toupper (int __c)
+{
+  return __c >= -128 && __c < 256 ? (*__ctype_toupper_loc ())[__c] : __c;
+}
+# 251 "/usr/include/ctype.h" 3 4
+extern int isalnum_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isalpha_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int iscntrl_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isdigit_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int islower_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isgraph_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isprint_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int ispunct_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isspace_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isupper_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isxdigit_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int isblank_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int __tolower_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+extern int tolower_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __toupper_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+extern int toupper_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+# 327 "/usr/include/ctype.h" 3 4
+
+# 59 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h" 2
+# 102 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+
+# 102 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+typedef uint32_t Py_UCS4;
+typedef uint16_t Py_UCS2;
+typedef uint8_t Py_UCS1;
+
+
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyUnicode_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyUnicodeIter_Type;
+# 130 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_FromStringAndSize(
+    const char *u,
+    Py_ssize_t size
+    );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_FromString(
+    const char *u
+    );
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_Substring(
+    PyObject *str,
+    Py_ssize_t start,
+    Py_ssize_t end);
+# 154 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) Py_UCS4* PyUnicode_AsUCS4(
+    PyObject *unicode,
+    Py_UCS4* buffer,
+    Py_ssize_t buflen,
+    int copy_null);
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_UCS4* PyUnicode_AsUCS4Copy(PyObject *unicode);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyUnicode_GetLength(
+    PyObject *unicode
+);
+
+
+
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) Py_ssize_t PyUnicode_GetSize(
+    PyObject *unicode
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_UCS4 PyUnicode_ReadChar(
+    PyObject *unicode,
+    Py_ssize_t index
+    );
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicode_WriteChar(
+    PyObject *unicode,
+    Py_ssize_t index,
+    Py_UCS4 character
+    );
+# 217 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) int PyUnicode_Resize(
+    PyObject **unicode,
+    Py_ssize_t length
+    );
+# 235 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_FromEncodedObject(
+    PyObject *obj,
+    const char *encoding,
+    const char *errors
+    );
+# 250 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_FromObject(
+    PyObject *obj
+    );
+
+__attribute__ ((visibility ("default"))) PyObject * PyUnicode_FromFormatV(
+    const char *format,
+    va_list vargs
+    );
+__attribute__ ((visibility ("default"))) PyObject * PyUnicode_FromFormat(
+    const char *format,
+    ...
+    );
+
+__attribute__ ((visibility ("default"))) void PyUnicode_InternInPlace(PyObject **);
+__attribute__ ((visibility ("default"))) PyObject * PyUnicode_InternFromString(
+    const char *u
+    );
+
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PyUnicode_InternImmortal(PyObject **);
+# 281 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_FromWideChar(
+    const wchar_t *w,
+    Py_ssize_t size
+    );
+# 298 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) Py_ssize_t PyUnicode_AsWideChar(
+    PyObject *unicode,
+    wchar_t *w,
+    Py_ssize_t size
+    );
+# 312 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) wchar_t* PyUnicode_AsWideCharString(
+    PyObject *unicode,
+    Py_ssize_t *size
+    );
+# 328 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_FromOrdinal(int ordinal);
+# 351 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) const char* PyUnicode_GetDefaultEncoding(void);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_Decode(
+    const char *s,
+    Py_ssize_t size,
+    const char *encoding,
+    const char *errors
+    );
+# 372 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsDecodedObject(
+    PyObject *unicode,
+    const char *encoding,
+    const char *errors
+    );
+# 385 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsDecodedUnicode(
+    PyObject *unicode,
+    const char *encoding,
+    const char *errors
+    );
+# 399 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsEncodedObject(
+    PyObject *unicode,
+    const char *encoding,
+    const char *errors
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsEncodedString(
+    PyObject *unicode,
+    const char *encoding,
+    const char *errors
+    );
+# 421 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsEncodedUnicode(
+    PyObject *unicode,
+    const char *encoding,
+    const char *errors
+    );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_BuildEncodingMap(
+    PyObject* string
+   );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeUTF7(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeUTF7Stateful(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors,
+    Py_ssize_t *consumed
+    );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeUTF8(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeUTF8Stateful(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors,
+    Py_ssize_t *consumed
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsUTF8String(
+    PyObject *unicode
+    );
+# 479 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) const char * PyUnicode_AsUTF8AndSize(
+    PyObject *unicode,
+    Py_ssize_t *size);
+# 509 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeUTF32(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors,
+    int *byteorder
+
+
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeUTF32Stateful(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors,
+    int *byteorder,
+
+
+    Py_ssize_t *consumed
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsUTF32String(
+    PyObject *unicode
+    );
+# 576 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeUTF16(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors,
+    int *byteorder
+
+
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeUTF16Stateful(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors,
+    int *byteorder,
+
+
+    Py_ssize_t *consumed
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsUTF16String(
+    PyObject *unicode
+    );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeUnicodeEscape(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsUnicodeEscapeString(
+    PyObject *unicode
+    );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeRawUnicodeEscape(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsRawUnicodeEscapeString(
+    PyObject *unicode
+    );
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeLatin1(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsLatin1String(
+    PyObject *unicode
+    );
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeASCII(
+    const char *string,
+    Py_ssize_t length,
+    const char *errors
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsASCIIString(
+    PyObject *unicode
+    );
+# 673 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeCharmap(
+    const char *string,
+    Py_ssize_t length,
+    PyObject *mapping,
+    const char *errors
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_AsCharmapString(
+    PyObject *unicode,
+    PyObject *mapping
+    );
+# 736 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeLocaleAndSize(
+    const char *str,
+    Py_ssize_t len,
+    const char *errors);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeLocale(
+    const char *str,
+    const char *errors);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_EncodeLocale(
+    PyObject *unicode,
+    const char *errors
+    );
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicode_FSConverter(PyObject*, void*);
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicode_FSDecoder(PyObject*, void*);
+# 780 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeFSDefault(
+    const char *s
+    );
+# 791 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_DecodeFSDefaultAndSize(
+    const char *s,
+    Py_ssize_t size
+    );
+# 803 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_EncodeFSDefault(
+    PyObject *unicode
+    );
+# 815 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_Concat(
+    PyObject *left,
+    PyObject *right
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) void PyUnicode_Append(
+    PyObject **pleft,
+    PyObject *right
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) void PyUnicode_AppendAndDel(
+    PyObject **pleft,
+    PyObject *right
+    );
+# 847 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_Split(
+    PyObject *s,
+    PyObject *sep,
+    Py_ssize_t maxsplit
+    );
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_Splitlines(
+    PyObject *s,
+    int keepends
+    );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_Partition(
+    PyObject *s,
+    PyObject *sep
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_RPartition(
+    PyObject *s,
+    PyObject *sep
+    );
+# 891 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_RSplit(
+    PyObject *s,
+    PyObject *sep,
+    Py_ssize_t maxsplit
+    );
+# 909 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject * PyUnicode_Translate(
+    PyObject *str,
+    PyObject *table,
+    const char *errors
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_Join(
+    PyObject *separator,
+    PyObject *seq
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyUnicode_Tailmatch(
+    PyObject *str,
+    PyObject *substr,
+    Py_ssize_t start,
+    Py_ssize_t end,
+    int direction
+    );
+
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyUnicode_Find(
+    PyObject *str,
+    PyObject *substr,
+    Py_ssize_t start,
+    Py_ssize_t end,
+    int direction
+    );
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyUnicode_FindChar(
+    PyObject *str,
+    Py_UCS4 ch,
+    Py_ssize_t start,
+    Py_ssize_t end,
+    int direction
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyUnicode_Count(
+    PyObject *str,
+    PyObject *substr,
+    Py_ssize_t start,
+    Py_ssize_t end
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyUnicode_Replace(
+    PyObject *str,
+    PyObject *substr,
+    PyObject *replstr,
+    Py_ssize_t maxcount
+
+    );
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicode_Compare(
+    PyObject *left,
+    PyObject *right
+    );
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicode_CompareWithASCIIString(
+    PyObject *left,
+    const char *right
+    );
+# 1009 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject * PyUnicode_RichCompare(
+    PyObject *left,
+    PyObject *right,
+    int op
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyUnicode_Format(
+    PyObject *format,
+    PyObject *args
+    );
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicode_Contains(
+    PyObject *container,
+    PyObject *element
+    );
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicode_IsIdentifier(PyObject *s);
+
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                         typedef wchar_t Py_UNICODE;
+# 72 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+typedef struct {
+# 146 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+    PyObject ob_base;
+    Py_ssize_t length;
+    Py_hash_t hash;
+    struct {
+# 158 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+        unsigned int interned:2;
+# 186 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+        unsigned int kind:3;
+
+
+
+
+        unsigned int compact:1;
+
+
+
+        unsigned int ascii:1;
+
+
+
+
+        unsigned int ready:1;
+
+
+        unsigned int :24;
+    } state;
+    wchar_t *wstr;
+} PyASCIIObject;
+
+
+
+
+typedef struct {
+    PyASCIIObject _base;
+    Py_ssize_t utf8_length;
+
+    char *utf8;
+    Py_ssize_t wstr_length;
+
+} PyCompactUnicodeObject;
+
+
+
+
+typedef struct {
+    PyCompactUnicodeObject _base;
+    union {
+        void *any;
+        Py_UCS1 *latin1;
+        Py_UCS2 *ucs2;
+        Py_UCS4 *ucs4;
+    } data;
+} PyUnicodeObject;
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_CheckConsistency(
+    PyObject *op,
+    int check_content);
+# 259 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+static inline unsigned int PyUnicode_CHECK_INTERNED(PyObject *op) {
+    return (
+# 260 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 260 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , ((PyASCIIObject*)((op))))->state.interned;
+}
+
+
+
+
+
+
+static inline unsigned int PyUnicode_IS_READY(PyObject *op) {
+    return (
+# 269 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 269 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , ((PyASCIIObject*)((op))))->state.ready;
+}
+
+
+
+
+
+
+
+static inline unsigned int PyUnicode_IS_ASCII(PyObject *op) {
+    
+# 279 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+   ((void) (0))
+# 279 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                 ;
+    return (
+# 280 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 280 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , ((PyASCIIObject*)((op))))->state.ascii;
+}
+
+
+
+
+
+
+static inline unsigned int PyUnicode_IS_COMPACT(PyObject *op) {
+    return (
+# 289 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 289 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , ((PyASCIIObject*)((op))))->state.compact;
+}
+
+
+
+
+
+
+static inline int PyUnicode_IS_COMPACT_ASCII(PyObject *op) {
+    return ((
+# 298 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+           ((void) (0))
+# 298 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+           , ((PyASCIIObject*)((op))))->state.ascii && PyUnicode_IS_COMPACT(((PyObject*)((op)))));
+}
+
+
+
+
+enum PyUnicode_Kind {
+
+
+
+    PyUnicode_WCHAR_KIND = 0,
+
+    PyUnicode_1BYTE_KIND = 1,
+    PyUnicode_2BYTE_KIND = 2,
+    PyUnicode_4BYTE_KIND = 4
+};
+
+
+
+
+
+
+
+static inline void* _PyUnicode_COMPACT_DATA(PyObject *op) {
+    if (PyUnicode_IS_ASCII(((PyObject*)((op))))) {
+        return ((void*)(((
+# 323 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+              ((void) (0))
+# 323 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+              , ((PyASCIIObject*)((op)))) + 1)));
+    }
+    return ((void*)(((
+# 325 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 325 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , ((PyCompactUnicodeObject*)((op)))) + 1)));
+}
+
+static inline void* _PyUnicode_NONCOMPACT_DATA(PyObject *op) {
+    void *data;
+    
+# 330 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+   ((void) (0))
+# 330 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                    ;
+    data = (
+# 331 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 331 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , ((PyUnicodeObject*)((op))))->data.any;
+    
+# 332 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+   ((void) (0))
+# 332 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                       ;
+    return data;
+}
+
+static inline void* PyUnicode_DATA(PyObject *op) {
+    if (PyUnicode_IS_COMPACT(((PyObject*)((op))))) {
+        return _PyUnicode_COMPACT_DATA(op);
+    }
+    return _PyUnicode_NONCOMPACT_DATA(op);
+}
+# 358 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+static inline Py_ssize_t PyUnicode_GET_LENGTH(PyObject *op) {
+    
+# 359 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+   ((void) (0))
+# 359 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                 ;
+    return (
+# 360 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 360 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , ((PyASCIIObject*)((op))))->length;
+}
+# 371 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+static inline void PyUnicode_WRITE(int kind, void *data,
+                                   Py_ssize_t index, Py_UCS4 value)
+{
+    if (kind == PyUnicode_1BYTE_KIND) {
+        
+# 375 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+       ((void) (0))
+# 375 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                             ;
+        ((Py_UCS1*)(data))[index] = ((Py_UCS1)(value));
+    }
+    else if (kind == PyUnicode_2BYTE_KIND) {
+        
+# 379 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+       ((void) (0))
+# 379 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                               ;
+        ((Py_UCS2*)(data))[index] = ((Py_UCS2)(value));
+    }
+    else {
+        
+# 383 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+       ((void) (0))
+# 383 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                           ;
+        
+# 384 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+       ((void) (0))
+# 384 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                 ;
+        ((Py_UCS4*)(data))[index] = value;
+    }
+}
+# 396 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+static inline Py_UCS4 PyUnicode_READ(int kind,
+                                     const void *data, Py_ssize_t index)
+{
+    if (kind == PyUnicode_1BYTE_KIND) {
+        return ((const Py_UCS1*)(data))[index];
+    }
+    if (kind == PyUnicode_2BYTE_KIND) {
+        return ((const Py_UCS2*)(data))[index];
+    }
+    
+# 405 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+   ((void) (0))
+# 405 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                       ;
+    return ((const Py_UCS4*)(data))[index];
+}
+# 419 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+static inline Py_UCS4 PyUnicode_READ_CHAR(PyObject *unicode, Py_ssize_t index)
+{
+    int kind;
+    
+# 422 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+   ((void) (0))
+# 422 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                      ;
+    kind = (
+# 423 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 423 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , (
+# 423 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 423 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , ((PyASCIIObject*)((unicode))))->state.kind);
+    if (kind == PyUnicode_1BYTE_KIND) {
+        return ((Py_UCS1*)(PyUnicode_DATA(((PyObject*)((unicode))))))[index];
+    }
+    if (kind == PyUnicode_2BYTE_KIND) {
+        return ((Py_UCS2*)(PyUnicode_DATA(((PyObject*)((unicode))))))[index];
+    }
+    
+# 430 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+   ((void) (0))
+# 430 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                       ;
+    return ((Py_UCS4*)(PyUnicode_DATA(((PyObject*)((unicode))))))[index];
+}
+# 441 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+static inline Py_UCS4 PyUnicode_MAX_CHAR_VALUE(PyObject *op)
+{
+    int kind;
+
+    
+# 445 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+   ((void) (0))
+# 445 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                 ;
+    if (PyUnicode_IS_ASCII(((PyObject*)((op))))) {
+        return 0x7fU;
+    }
+
+    kind = (
+# 450 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 450 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , (
+# 450 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+          ((void) (0))
+# 450 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+          , ((PyASCIIObject*)((op))))->state.kind);
+    if (kind == PyUnicode_1BYTE_KIND) {
+       return 0xffU;
+    }
+    if (kind == PyUnicode_2BYTE_KIND) {
+        return 0xffffU;
+    }
+    
+# 457 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+   ((void) (0))
+# 457 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                       ;
+    return 0x10ffffU;
+}
+# 472 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_New(
+    Py_ssize_t size,
+    Py_UCS4 maxchar
+    );
+# 484 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) int _PyUnicode_Ready(
+    PyObject *unicode
+    );
+
+
+
+
+
+static inline int PyUnicode_READY(PyObject *op)
+{
+    if (PyUnicode_IS_READY(((PyObject*)((op))))) {
+        return 0;
+    }
+    return _PyUnicode_Ready(op);
+}
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_Copy(
+    PyObject *unicode
+    );
+# 526 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) Py_ssize_t PyUnicode_CopyCharacters(
+    PyObject *to,
+    Py_ssize_t to_start,
+    PyObject *from,
+    Py_ssize_t from_start,
+    Py_ssize_t how_many
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) void _PyUnicode_FastCopyCharacters(
+    PyObject *to,
+    Py_ssize_t to_start,
+    PyObject *from,
+    Py_ssize_t from_start,
+    Py_ssize_t how_many
+    );
+# 553 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) Py_ssize_t PyUnicode_Fill(
+    PyObject *unicode,
+    Py_ssize_t start,
+    Py_ssize_t length,
+    Py_UCS4 fill_char
+    );
+
+
+
+__attribute__ ((visibility ("default"))) void _PyUnicode_FastFill(
+    PyObject *unicode,
+    Py_ssize_t start,
+    Py_ssize_t length,
+    Py_UCS4 fill_char
+    );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyUnicode_FromKindAndData(
+    int kind,
+    const void *buffer,
+    Py_ssize_t size);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_FromASCII(
+    const char *buffer,
+    Py_ssize_t size);
+
+
+
+__attribute__ ((visibility ("default"))) Py_UCS4 _PyUnicode_FindMaxChar (
+    PyObject *unicode,
+    Py_ssize_t start,
+    Py_ssize_t end);
+# 600 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) PyObject* PyUnicode_FromUnicode(
+    const Py_UNICODE *u,
+    Py_ssize_t size
+    );
+
+
+
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) Py_UNICODE * PyUnicode_AsUnicode(
+    PyObject *unicode
+    );
+
+
+
+__attribute__ ((visibility ("default"))) const Py_UNICODE * _PyUnicode_AsUnicode(
+    PyObject *unicode
+    );
+
+
+
+
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) Py_UNICODE * PyUnicode_AsUnicodeAndSize(
+    PyObject *unicode,
+    Py_ssize_t *size
+    );
+
+
+
+
+__attribute__((__deprecated__))
+static inline Py_ssize_t PyUnicode_WSTR_LENGTH(PyObject *op)
+{
+    if (PyUnicode_IS_COMPACT_ASCII(((PyObject*)((op))))) {
+        return (
+# 636 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+              ((void) (0))
+# 636 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+              , ((PyASCIIObject*)((op))))->length;
+    }
+    else {
+        return (
+# 639 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+              ((void) (0))
+# 639 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+              , ((PyCompactUnicodeObject*)((op))))->wstr_length;
+    }
+}
+# 651 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__((__deprecated__))
+static inline Py_ssize_t PyUnicode_GET_SIZE(PyObject *op)
+{
+   
+# 654 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic push
+# 654 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+   
+# 655 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 655 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+    if ((
+# 656 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+       ((void) (0))
+# 656 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+       , ((PyASCIIObject*)((op))))->wstr == 
+# 656 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+                                        ((void *)0)
+# 656 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                                ) {
+        (void)PyUnicode_AsUnicode(op);
+        
+# 658 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+       ((void) (0))
+# 658 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                                                        ;
+    }
+    return PyUnicode_WSTR_LENGTH(((PyObject*)((op))));
+   
+# 661 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic pop
+# 661 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+}
+
+
+
+
+__attribute__((__deprecated__))
+static inline Py_ssize_t PyUnicode_GET_DATA_SIZE(PyObject *op)
+{
+   
+# 670 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic push
+# 670 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+   
+# 671 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 671 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+    return PyUnicode_GET_SIZE(((PyObject*)((op)))) * 4;
+   
+# 673 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic pop
+# 673 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+}
+# 684 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__((__deprecated__))
+static inline Py_UNICODE* PyUnicode_AS_UNICODE(PyObject *op)
+{
+    wchar_t *wstr = (
+# 687 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+                   ((void) (0))
+# 687 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                   , ((PyASCIIObject*)((op))))->wstr;
+    if (wstr != 
+# 688 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h" 3 4
+               ((void *)0)
+# 688 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+                       ) {
+        return wstr;
+    }
+
+   
+# 692 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic push
+# 692 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+   
+# 693 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 693 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+    return PyUnicode_AsUnicode(op);
+   
+# 695 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic pop
+# 695 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+}
+
+
+
+
+__attribute__((__deprecated__))
+static inline const char* PyUnicode_AS_DATA(PyObject *op)
+{
+   
+# 704 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic push
+# 704 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+   
+# 705 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 705 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+    Py_UNICODE *data = PyUnicode_AS_UNICODE(((PyObject*)((op))));
+
+    return ((const char*)(((const void*)(data))));
+   
+# 709 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+#pragma GCC diagnostic pop
+# 709 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+   
+}
+
+
+
+
+
+
+
+typedef struct {
+    PyObject *buffer;
+    void *data;
+    enum PyUnicode_Kind kind;
+    Py_UCS4 maxchar;
+    Py_ssize_t size;
+    Py_ssize_t pos;
+
+
+    Py_ssize_t min_length;
+
+
+    Py_UCS4 min_char;
+
+
+    unsigned char overallocate;
+
+
+
+    unsigned char readonly;
+} _PyUnicodeWriter ;
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void
+_PyUnicodeWriter_Init(_PyUnicodeWriter *writer);
+# 762 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) int
+_PyUnicodeWriter_PrepareInternal(_PyUnicodeWriter *writer,
+                                 Py_ssize_t length, Py_UCS4 maxchar);
+# 779 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) int
+_PyUnicodeWriter_PrepareKindInternal(_PyUnicodeWriter *writer,
+                                     enum PyUnicode_Kind kind);
+
+
+
+__attribute__ ((visibility ("default"))) int
+_PyUnicodeWriter_WriteChar(_PyUnicodeWriter *writer,
+    Py_UCS4 ch
+    );
+
+
+
+__attribute__ ((visibility ("default"))) int
+_PyUnicodeWriter_WriteStr(_PyUnicodeWriter *writer,
+    PyObject *str
+    );
+
+
+
+__attribute__ ((visibility ("default"))) int
+_PyUnicodeWriter_WriteSubstring(_PyUnicodeWriter *writer,
+    PyObject *str,
+    Py_ssize_t start,
+    Py_ssize_t end
+    );
+
+
+
+__attribute__ ((visibility ("default"))) int
+_PyUnicodeWriter_WriteASCIIString(_PyUnicodeWriter *writer,
+    const char *str,
+    Py_ssize_t len
+    );
+
+
+
+__attribute__ ((visibility ("default"))) int
+_PyUnicodeWriter_WriteLatin1String(_PyUnicodeWriter *writer,
+    const char *str,
+    Py_ssize_t len
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject *
+_PyUnicodeWriter_Finish(_PyUnicodeWriter *writer);
+
+
+__attribute__ ((visibility ("default"))) void
+_PyUnicodeWriter_Dealloc(_PyUnicodeWriter *writer);
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_FormatAdvancedWriter(
+    _PyUnicodeWriter *writer,
+    PyObject *obj,
+    PyObject *format_spec,
+    Py_ssize_t start,
+    Py_ssize_t end);
+# 857 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) const char * PyUnicode_AsUTF8(PyObject *unicode);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_EncodeUTF7(
+    PyObject *unicode,
+    int base64SetO,
+    int base64WhiteSpace,
+    const char *errors
+    );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_AsUTF8String(
+    PyObject *unicode,
+    const char *errors);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_EncodeUTF32(
+    PyObject *object,
+    const char *errors,
+    int byteorder
+    );
+# 900 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_EncodeUTF16(
+    PyObject* unicode,
+    const char *errors,
+    int byteorder
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_DecodeUnicodeEscapeStateful(
+        const char *string,
+        Py_ssize_t length,
+        const char *errors,
+        Py_ssize_t *consumed
+);
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_DecodeUnicodeEscapeInternal(
+        const char *string,
+        Py_ssize_t length,
+        const char *errors,
+        Py_ssize_t *consumed,
+        const char **first_invalid_escape
+
+
+);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_DecodeRawUnicodeEscapeStateful(
+        const char *string,
+        Py_ssize_t length,
+        const char *errors,
+        Py_ssize_t *consumed
+);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_AsLatin1String(
+    PyObject* unicode,
+    const char* errors);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_AsASCIIString(
+    PyObject* unicode,
+    const char* errors);
+# 961 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_EncodeCharmap(
+    PyObject *unicode,
+    PyObject *mapping,
+    const char *errors
+    );
+# 976 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_TransformDecimalAndSpaceToASCII(
+    PyObject *unicode
+    );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyUnicode_JoinArray(
+    PyObject *separator,
+    PyObject *const *items,
+    Py_ssize_t seqlen
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_EqualToASCIIId(
+    PyObject *left,
+    _Py_Identifier *right
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_EqualToASCIIString(
+    PyObject *left,
+    const char *right
+    );
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyUnicode_XStrip(
+    PyObject *self,
+    int striptype,
+    PyObject *sepobj
+    );
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t _PyUnicode_InsertThousandsGrouping(
+    _PyUnicodeWriter *writer,
+    Py_ssize_t n_buffer,
+    PyObject *digits,
+    Py_ssize_t d_pos,
+    Py_ssize_t n_digits,
+    Py_ssize_t min_width,
+    const char *grouping,
+    PyObject *thousands_sep,
+    Py_UCS4 *maxchar);
+
+
+
+
+
+extern __attribute__ ((visibility ("default"))) const unsigned char _Py_ascii_whitespace[];
+# 1038 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsLowercase(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsUppercase(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsTitlecase(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsXidStart(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsXidContinue(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsWhitespace(
+    const Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsLinebreak(
+    const Py_UCS4 ch
+    );
+
+                         __attribute__ ((visibility ("default"))) Py_UCS4 _PyUnicode_ToLowercase(
+    Py_UCS4 ch
+    );
+
+                         __attribute__ ((visibility ("default"))) Py_UCS4 _PyUnicode_ToUppercase(
+    Py_UCS4 ch
+    );
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) Py_UCS4 _PyUnicode_ToTitlecase(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_ToLowerFull(
+    Py_UCS4 ch,
+    Py_UCS4 *res
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_ToTitleFull(
+    Py_UCS4 ch,
+    Py_UCS4 *res
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_ToUpperFull(
+    Py_UCS4 ch,
+    Py_UCS4 *res
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_ToFoldedFull(
+    Py_UCS4 ch,
+    Py_UCS4 *res
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsCaseIgnorable(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsCased(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_ToDecimalDigit(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_ToDigit(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) double _PyUnicode_ToNumeric(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsDecimalDigit(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsDigit(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsNumeric(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsPrintable(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_IsAlpha(
+    Py_UCS4 ch
+    );
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_FormatLong(PyObject *, int, int, int);
+
+
+__attribute__ ((visibility ("default"))) PyObject* _PyUnicode_FromId(_Py_Identifier*);
+
+
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_EQ(PyObject *, PyObject *);
+
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_Equal(PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) int _PyUnicode_WideCharString_Converter(PyObject *, void *);
+__attribute__ ((visibility ("default"))) int _PyUnicode_WideCharString_Opt_Converter(PyObject *, void *);
+
+__attribute__ ((visibility ("default"))) Py_ssize_t _PyUnicode_ScanIdentifier(PyObject *);
+# 1043 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h" 2
+# 52 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/longobject.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/longobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyLong_Type;
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromLong(long);
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromUnsignedLong(unsigned long);
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromSize_t(size_t);
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromSsize_t(Py_ssize_t);
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromDouble(double);
+__attribute__ ((visibility ("default"))) long PyLong_AsLong(PyObject *);
+__attribute__ ((visibility ("default"))) long PyLong_AsLongAndOverflow(PyObject *, int *);
+__attribute__ ((visibility ("default"))) Py_ssize_t PyLong_AsSsize_t(PyObject *);
+__attribute__ ((visibility ("default"))) size_t PyLong_AsSize_t(PyObject *);
+__attribute__ ((visibility ("default"))) unsigned long PyLong_AsUnsignedLong(PyObject *);
+__attribute__ ((visibility ("default"))) unsigned long PyLong_AsUnsignedLongMask(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyLong_GetInfo(void);
+# 63 "/root/.pyenv/versions/3.11.7/include/python3.11/longobject.h"
+__attribute__ ((visibility ("default"))) double PyLong_AsDouble(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromVoidPtr(void *);
+__attribute__ ((visibility ("default"))) void * PyLong_AsVoidPtr(PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromLongLong(long long);
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromUnsignedLongLong(unsigned long long);
+__attribute__ ((visibility ("default"))) long long PyLong_AsLongLong(PyObject *);
+__attribute__ ((visibility ("default"))) unsigned long long PyLong_AsUnsignedLongLong(PyObject *);
+__attribute__ ((visibility ("default"))) unsigned long long PyLong_AsUnsignedLongLongMask(PyObject *);
+__attribute__ ((visibility ("default"))) long long PyLong_AsLongLongAndOverflow(PyObject *, int *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromString(const char *, char **, int);
+
+
+
+
+__attribute__ ((visibility ("default"))) unsigned long PyOS_strtoul(const char *, char **, int);
+__attribute__ ((visibility ("default"))) long PyOS_strtol(const char *, char **, int);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/longobject.h" 1
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyLong_AsInt(PyObject *);
+
+__attribute__ ((visibility ("default"))) int _PyLong_UnsignedShort_Converter(PyObject *, void *);
+__attribute__ ((visibility ("default"))) int _PyLong_UnsignedInt_Converter(PyObject *, void *);
+__attribute__ ((visibility ("default"))) int _PyLong_UnsignedLong_Converter(PyObject *, void *);
+__attribute__ ((visibility ("default"))) int _PyLong_UnsignedLongLong_Converter(PyObject *, void *);
+__attribute__ ((visibility ("default"))) int _PyLong_Size_t_Converter(PyObject *, void *);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) double _PyLong_Frexp(PyLongObject *a, Py_ssize_t *e);
+
+__attribute__ ((visibility ("default"))) PyObject * PyLong_FromUnicodeObject(PyObject *u, int base);
+__attribute__ ((visibility ("default"))) PyObject * _PyLong_FromBytes(const char *, Py_ssize_t, int);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyLong_Sign(PyObject *v);
+# 37 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/longobject.h"
+__attribute__ ((visibility ("default"))) size_t _PyLong_NumBits(PyObject *v);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyLong_DivmodNear(PyObject *, PyObject *);
+# 60 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/longobject.h"
+__attribute__ ((visibility ("default"))) PyObject * _PyLong_FromByteArray(
+    const unsigned char* bytes, size_t n,
+    int little_endian, int is_signed);
+# 83 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/longobject.h"
+__attribute__ ((visibility ("default"))) int _PyLong_AsByteArray(PyLongObject* v,
+    unsigned char* bytes, size_t n,
+    int little_endian, int is_signed);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyLong_Format(PyObject *obj, int base);
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyLong_GCD(PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyLong_Rshift(PyObject *, size_t);
+__attribute__ ((visibility ("default"))) PyObject * _PyLong_Lshift(PyObject *, size_t);
+# 85 "/root/.pyenv/versions/3.11.7/include/python3.11/longobject.h" 2
+# 53 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/longintrepr.h" 1
+# 43 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/longintrepr.h"
+typedef uint32_t digit;
+typedef int32_t sdigit;
+typedef uint64_t twodigits;
+typedef int64_t stwodigits;
+# 82 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/longintrepr.h"
+struct _longobject {
+    PyVarObject ob_base;
+    digit ob_digit[1];
+};
+
+__attribute__ ((visibility ("default"))) PyLongObject * _PyLong_New(Py_ssize_t);
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyLong_Copy(PyLongObject *src);
+# 54 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/boolobject.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/boolobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyBool_Type;
+
+
+
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyLongObject _Py_FalseStruct;
+extern __attribute__ ((visibility ("default"))) PyLongObject _Py_TrueStruct;
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int Py_IsTrue(PyObject *x);
+
+
+
+__attribute__ ((visibility ("default"))) int Py_IsFalse(PyObject *x);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyBool_FromLong(long);
+# 55 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/floatobject.h" 1
+# 14 "/root/.pyenv/versions/3.11.7/include/python3.11/floatobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyFloat_Type;
+# 31 "/root/.pyenv/versions/3.11.7/include/python3.11/floatobject.h"
+__attribute__ ((visibility ("default"))) double PyFloat_GetMax(void);
+__attribute__ ((visibility ("default"))) double PyFloat_GetMin(void);
+__attribute__ ((visibility ("default"))) PyObject* PyFloat_GetInfo(void);
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyFloat_FromString(PyObject*);
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyFloat_FromDouble(double);
+
+
+
+__attribute__ ((visibility ("default"))) double PyFloat_AsDouble(PyObject*);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/floatobject.h" 1
+
+
+
+
+typedef struct {
+    PyObject ob_base;
+    double ob_fval;
+} PyFloatObject;
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyFloat_Pack2(double x, char *p, int le);
+__attribute__ ((visibility ("default"))) int PyFloat_Pack4(double x, char *p, int le);
+__attribute__ ((visibility ("default"))) int PyFloat_Pack8(double x, char *p, int le);
+
+__attribute__ ((visibility ("default"))) double PyFloat_Unpack2(const char *p, int le);
+__attribute__ ((visibility ("default"))) double PyFloat_Unpack4(const char *p, int le);
+__attribute__ ((visibility ("default"))) double PyFloat_Unpack8(const char *p, int le);
+# 48 "/root/.pyenv/versions/3.11.7/include/python3.11/floatobject.h" 2
+# 56 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/complexobject.h" 1
+# 11 "/root/.pyenv/versions/3.11.7/include/python3.11/complexobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyComplex_Type;
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyComplex_FromDoubles(double real, double imag);
+
+__attribute__ ((visibility ("default"))) double PyComplex_RealAsDouble(PyObject *op);
+__attribute__ ((visibility ("default"))) double PyComplex_ImagAsDouble(PyObject *op);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/complexobject.h" 1
+
+
+
+
+typedef struct {
+    double real;
+    double imag;
+} Py_complex;
+
+
+
+__attribute__ ((visibility ("default"))) Py_complex _Py_c_sum(Py_complex, Py_complex);
+__attribute__ ((visibility ("default"))) Py_complex _Py_c_diff(Py_complex, Py_complex);
+__attribute__ ((visibility ("default"))) Py_complex _Py_c_neg(Py_complex);
+__attribute__ ((visibility ("default"))) Py_complex _Py_c_prod(Py_complex, Py_complex);
+__attribute__ ((visibility ("default"))) Py_complex _Py_c_quot(Py_complex, Py_complex);
+__attribute__ ((visibility ("default"))) Py_complex _Py_c_pow(Py_complex, Py_complex);
+__attribute__ ((visibility ("default"))) double _Py_c_abs(Py_complex);
+
+
+
+
+
+
+
+typedef struct {
+    PyObject ob_base;
+    Py_complex cval;
+} PyComplexObject;
+
+__attribute__ ((visibility ("default"))) PyObject * PyComplex_FromCComplex(Py_complex);
+
+__attribute__ ((visibility ("default"))) Py_complex PyComplex_AsCComplex(PyObject *op);
+# 24 "/root/.pyenv/versions/3.11.7/include/python3.11/complexobject.h" 2
+# 57 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/rangeobject.h" 1
+# 18 "/root/.pyenv/versions/3.11.7/include/python3.11/rangeobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyRange_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyRangeIter_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyLongRangeIter_Type;
+# 58 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/memoryobject.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/memoryobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyManagedBuffer_Type;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyMemoryView_Type;
+# 23 "/root/.pyenv/versions/3.11.7/include/python3.11/memoryobject.h"
+__attribute__ ((visibility ("default"))) PyObject * PyMemoryView_FromObject(PyObject *base);
+
+__attribute__ ((visibility ("default"))) PyObject * PyMemoryView_FromMemory(char *mem, Py_ssize_t size,
+                                               int flags);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyMemoryView_FromBuffer(const Py_buffer *info);
+
+__attribute__ ((visibility ("default"))) PyObject * PyMemoryView_GetContiguous(PyObject *base,
+                                                  int buffertype,
+                                                  char order);
+# 42 "/root/.pyenv/versions/3.11.7/include/python3.11/memoryobject.h"
+typedef struct {
+    PyObject ob_base;
+    int flags;
+    Py_ssize_t exports;
+    Py_buffer master;
+} _PyManagedBufferObject;
+# 57 "/root/.pyenv/versions/3.11.7/include/python3.11/memoryobject.h"
+typedef struct {
+    PyVarObject ob_base;
+    _PyManagedBufferObject *mbuf;
+    Py_hash_t hash;
+    int flags;
+    Py_ssize_t exports;
+    Py_buffer view;
+    PyObject *weakreflist;
+    Py_ssize_t ob_array[1];
+} PyMemoryViewObject;
+# 59 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/tupleobject.h" 1
+# 23 "/root/.pyenv/versions/3.11.7/include/python3.11/tupleobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyTuple_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyTupleIter_Type;
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyTuple_New(Py_ssize_t size);
+__attribute__ ((visibility ("default"))) Py_ssize_t PyTuple_Size(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyTuple_GetItem(PyObject *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) int PyTuple_SetItem(PyObject *, Py_ssize_t, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyTuple_GetSlice(PyObject *, Py_ssize_t, Py_ssize_t);
+__attribute__ ((visibility ("default"))) PyObject * PyTuple_Pack(Py_ssize_t, ...);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/tupleobject.h" 1
+
+
+
+
+typedef struct {
+    PyVarObject ob_base;
+
+
+
+    PyObject *ob_item[1];
+} PyTupleObject;
+
+__attribute__ ((visibility ("default"))) int _PyTuple_Resize(PyObject **, Py_ssize_t);
+__attribute__ ((visibility ("default"))) void _PyTuple_MaybeUntrack(PyObject *);
+
+
+
+
+
+
+
+static inline Py_ssize_t PyTuple_GET_SIZE(PyObject *op) {
+    PyTupleObject *tuple = (
+# 23 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/tupleobject.h" 3 4
+                          ((void) (0))
+# 23 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/tupleobject.h"
+                          , ((PyTupleObject*)((op))));
+    return Py_SIZE(((PyObject*)((tuple))));
+}
+
+
+
+
+
+
+
+static inline void
+PyTuple_SET_ITEM(PyObject *op, Py_ssize_t index, PyObject *value) {
+    PyTupleObject *tuple = (
+# 35 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/tupleobject.h" 3 4
+                          ((void) (0))
+# 35 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/tupleobject.h"
+                          , ((PyTupleObject*)((op))));
+    tuple->ob_item[index] = value;
+}
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void _PyTuple_DebugMallocStats(FILE *out);
+# 40 "/root/.pyenv/versions/3.11.7/include/python3.11/tupleobject.h" 2
+# 60 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/listobject.h" 1
+# 20 "/root/.pyenv/versions/3.11.7/include/python3.11/listobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyList_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyListIter_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyListRevIter_Type;
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyList_New(Py_ssize_t size);
+__attribute__ ((visibility ("default"))) Py_ssize_t PyList_Size(PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyList_GetItem(PyObject *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) int PyList_SetItem(PyObject *, Py_ssize_t, PyObject *);
+__attribute__ ((visibility ("default"))) int PyList_Insert(PyObject *, Py_ssize_t, PyObject *);
+__attribute__ ((visibility ("default"))) int PyList_Append(PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyList_GetSlice(PyObject *, Py_ssize_t, Py_ssize_t);
+__attribute__ ((visibility ("default"))) int PyList_SetSlice(PyObject *, Py_ssize_t, Py_ssize_t, PyObject *);
+
+__attribute__ ((visibility ("default"))) int PyList_Sort(PyObject *);
+__attribute__ ((visibility ("default"))) int PyList_Reverse(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyList_AsTuple(PyObject *);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/listobject.h" 1
+
+
+
+
+typedef struct {
+    PyVarObject ob_base;
+
+    PyObject **ob_item;
+# 21 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/listobject.h"
+    Py_ssize_t allocated;
+} PyListObject;
+
+__attribute__ ((visibility ("default"))) PyObject * _PyList_Extend(PyListObject *, PyObject *);
+__attribute__ ((visibility ("default"))) void _PyList_DebugMallocStats(FILE *out);
+
+
+
+
+
+
+
+static inline Py_ssize_t PyList_GET_SIZE(PyObject *op) {
+    PyListObject *list = (
+# 34 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/listobject.h" 3 4
+                        ((void) (0))
+# 34 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/listobject.h"
+                        , ((PyListObject*)((op))));
+    return Py_SIZE(((PyObject*)((list))));
+}
+
+
+
+
+
+
+static inline void
+PyList_SET_ITEM(PyObject *op, Py_ssize_t index, PyObject *value) {
+    PyListObject *list = (
+# 45 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/listobject.h" 3 4
+                        ((void) (0))
+# 45 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/listobject.h"
+                        , ((PyListObject*)((op))));
+    list->ob_item[index] = value;
+}
+# 46 "/root/.pyenv/versions/3.11.7/include/python3.11/listobject.h" 2
+# 61 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/dictobject.h" 1
+# 15 "/root/.pyenv/versions/3.11.7/include/python3.11/dictobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDict_Type;
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyDict_New(void);
+__attribute__ ((visibility ("default"))) PyObject * PyDict_GetItem(PyObject *mp, PyObject *key);
+__attribute__ ((visibility ("default"))) PyObject * PyDict_GetItemWithError(PyObject *mp, PyObject *key);
+__attribute__ ((visibility ("default"))) int PyDict_SetItem(PyObject *mp, PyObject *key, PyObject *item);
+__attribute__ ((visibility ("default"))) int PyDict_DelItem(PyObject *mp, PyObject *key);
+__attribute__ ((visibility ("default"))) void PyDict_Clear(PyObject *mp);
+__attribute__ ((visibility ("default"))) int PyDict_Next(
+    PyObject *mp, Py_ssize_t *pos, PyObject **key, PyObject **value);
+__attribute__ ((visibility ("default"))) PyObject * PyDict_Keys(PyObject *mp);
+__attribute__ ((visibility ("default"))) PyObject * PyDict_Values(PyObject *mp);
+__attribute__ ((visibility ("default"))) PyObject * PyDict_Items(PyObject *mp);
+__attribute__ ((visibility ("default"))) Py_ssize_t PyDict_Size(PyObject *mp);
+__attribute__ ((visibility ("default"))) PyObject * PyDict_Copy(PyObject *mp);
+__attribute__ ((visibility ("default"))) int PyDict_Contains(PyObject *mp, PyObject *key);
+
+
+__attribute__ ((visibility ("default"))) int PyDict_Update(PyObject *mp, PyObject *other);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyDict_Merge(PyObject *mp,
+                             PyObject *other,
+                             int override);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyDict_MergeFromSeq2(PyObject *d,
+                                     PyObject *seq2,
+                                     int override);
+
+__attribute__ ((visibility ("default"))) PyObject * PyDict_GetItemString(PyObject *dp, const char *key);
+__attribute__ ((visibility ("default"))) int PyDict_SetItemString(PyObject *dp, const char *key, PyObject *item);
+__attribute__ ((visibility ("default"))) int PyDict_DelItemString(PyObject *dp, const char *key);
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_GenericGetDict(PyObject *, void *);
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictKeys_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictValues_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictItems_Type;
+# 79 "/root/.pyenv/versions/3.11.7/include/python3.11/dictobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictIterKey_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictIterValue_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictIterItem_Type;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictRevIterKey_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictRevIterItem_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictRevIterValue_Type;
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/dictobject.h" 1
+
+
+
+
+typedef struct _dictkeysobject PyDictKeysObject;
+typedef struct _dictvalues PyDictValues;
+
+
+
+
+typedef struct {
+    PyObject ob_base;
+
+
+    Py_ssize_t ma_used;
+
+
+
+    uint64_t ma_version_tag;
+
+    PyDictKeysObject *ma_keys;
+
+
+
+
+
+
+    PyDictValues *ma_values;
+} PyDictObject;
+
+__attribute__ ((visibility ("default"))) PyObject * _PyDict_GetItem_KnownHash(PyObject *mp, PyObject *key,
+                                       Py_hash_t hash);
+__attribute__ ((visibility ("default"))) PyObject * _PyDict_GetItemWithError(PyObject *dp, PyObject *key);
+__attribute__ ((visibility ("default"))) PyObject * _PyDict_GetItemIdWithError(PyObject *dp,
+                                                  _Py_Identifier *key);
+__attribute__ ((visibility ("default"))) PyObject * _PyDict_GetItemStringWithError(PyObject *, const char *);
+__attribute__ ((visibility ("default"))) PyObject * PyDict_SetDefault(
+    PyObject *mp, PyObject *key, PyObject *defaultobj);
+__attribute__ ((visibility ("default"))) int _PyDict_SetItem_KnownHash(PyObject *mp, PyObject *key,
+                                          PyObject *item, Py_hash_t hash);
+__attribute__ ((visibility ("default"))) int _PyDict_DelItem_KnownHash(PyObject *mp, PyObject *key,
+                                          Py_hash_t hash);
+__attribute__ ((visibility ("default"))) int _PyDict_DelItemIf(PyObject *mp, PyObject *key,
+                                  int (*predicate)(PyObject *value));
+__attribute__ ((visibility ("default"))) int _PyDict_Next(
+    PyObject *mp, Py_ssize_t *pos, PyObject **key, PyObject **value, Py_hash_t *hash);
+
+
+
+__attribute__ ((visibility ("default"))) int _PyDict_Contains_KnownHash(PyObject *, PyObject *, Py_hash_t);
+__attribute__ ((visibility ("default"))) int _PyDict_ContainsId(PyObject *, _Py_Identifier *);
+__attribute__ ((visibility ("default"))) PyObject * _PyDict_NewPresized(Py_ssize_t minused);
+__attribute__ ((visibility ("default"))) void _PyDict_MaybeUntrack(PyObject *mp);
+__attribute__ ((visibility ("default"))) int _PyDict_HasOnlyStringKeys(PyObject *mp);
+__attribute__ ((visibility ("default"))) Py_ssize_t _PyDict_SizeOf(PyDictObject *);
+__attribute__ ((visibility ("default"))) PyObject * _PyDict_Pop(PyObject *, PyObject *, PyObject *);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyDict_MergeEx(PyObject *mp, PyObject *other, int override);
+__attribute__ ((visibility ("default"))) int _PyDict_SetItemId(PyObject *dp, _Py_Identifier *key, PyObject *item);
+
+__attribute__ ((visibility ("default"))) int _PyDict_DelItemId(PyObject *mp, _Py_Identifier *key);
+__attribute__ ((visibility ("default"))) void _PyDict_DebugMallocStats(FILE *out);
+
+
+
+typedef struct {
+    PyObject ob_base;
+    PyDictObject *dv_dict;
+} _PyDictViewObject;
+
+__attribute__ ((visibility ("default"))) PyObject * _PyDictView_New(PyObject *, PyTypeObject *);
+__attribute__ ((visibility ("default"))) PyObject * _PyDictView_Intersect(PyObject* self, PyObject *other);
+# 91 "/root/.pyenv/versions/3.11.7/include/python3.11/dictobject.h" 2
+# 62 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/odictobject.h" 1
+# 13 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/odictobject.h"
+typedef struct _odictobject PyODictObject;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyODict_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyODictIter_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyODictKeys_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyODictItems_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyODictValues_Type;
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyODict_New(void);
+__attribute__ ((visibility ("default"))) int PyODict_SetItem(PyObject *od, PyObject *key, PyObject *item);
+__attribute__ ((visibility ("default"))) int PyODict_DelItem(PyObject *od, PyObject *key);
+# 63 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/enumobject.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/enumobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyEnum_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyReversed_Type;
+# 64 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/setobject.h" 1
+# 9 "/root/.pyenv/versions/3.11.7/include/python3.11/setobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PySet_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyFrozenSet_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PySetIter_Type;
+
+__attribute__ ((visibility ("default"))) PyObject * PySet_New(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyFrozenSet_New(PyObject *);
+
+__attribute__ ((visibility ("default"))) int PySet_Add(PyObject *set, PyObject *key);
+__attribute__ ((visibility ("default"))) int PySet_Clear(PyObject *set);
+__attribute__ ((visibility ("default"))) int PySet_Contains(PyObject *anyset, PyObject *key);
+__attribute__ ((visibility ("default"))) int PySet_Discard(PyObject *set, PyObject *key);
+__attribute__ ((visibility ("default"))) PyObject * PySet_Pop(PyObject *set);
+__attribute__ ((visibility ("default"))) Py_ssize_t PySet_Size(PyObject *anyset);
+# 42 "/root/.pyenv/versions/3.11.7/include/python3.11/setobject.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/setobject.h" 1
+# 20 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/setobject.h"
+typedef struct {
+    PyObject *key;
+    Py_hash_t hash;
+} setentry;
+# 36 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/setobject.h"
+typedef struct {
+    PyObject ob_base;
+
+    Py_ssize_t fill;
+    Py_ssize_t used;
+
+
+
+
+
+    Py_ssize_t mask;
+
+
+
+
+
+
+    setentry *table;
+    Py_hash_t hash;
+    Py_ssize_t finger;
+
+    setentry smalltable[8];
+    PyObject *weakreflist;
+} PySetObject;
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyObject * _PySet_Dummy;
+
+__attribute__ ((visibility ("default"))) int _PySet_NextEntry(PyObject *set, Py_ssize_t *pos, PyObject **key, Py_hash_t *hash);
+__attribute__ ((visibility ("default"))) int _PySet_Update(PyObject *set, PyObject *iterable);
+# 43 "/root/.pyenv/versions/3.11.7/include/python3.11/setobject.h" 2
+# 65 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/methodobject.h" 1
+# 14 "/root/.pyenv/versions/3.11.7/include/python3.11/methodobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyCFunction_Type;
+
+
+
+
+typedef PyObject *(*PyCFunction)(PyObject *, PyObject *);
+typedef PyObject *(*_PyCFunctionFast) (PyObject *, PyObject *const *, Py_ssize_t);
+typedef PyObject *(*PyCFunctionWithKeywords)(PyObject *, PyObject *,
+                                             PyObject *);
+typedef PyObject *(*_PyCFunctionFastWithKeywords) (PyObject *,
+                                                   PyObject *const *, Py_ssize_t,
+                                                   PyObject *);
+typedef PyObject *(*PyCMethod)(PyObject *, PyTypeObject *, PyObject *const *,
+                               size_t, PyObject *);
+# 48 "/root/.pyenv/versions/3.11.7/include/python3.11/methodobject.h"
+__attribute__ ((visibility ("default"))) PyCFunction PyCFunction_GetFunction(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyCFunction_GetSelf(PyObject *);
+__attribute__ ((visibility ("default"))) int PyCFunction_GetFlags(PyObject *);
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) PyObject * PyCFunction_Call(PyObject *, PyObject *, PyObject *);
+
+struct PyMethodDef {
+    const char *ml_name;
+    PyCFunction ml_meth;
+    int ml_flags;
+
+    const char *ml_doc;
+};
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCFunction_New(PyMethodDef *, PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCFunction_NewEx(PyMethodDef *, PyObject *,
+                                         PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCMethod_New(PyMethodDef *, PyObject *,
+                                     PyObject *, PyTypeObject *);
+# 125 "/root/.pyenv/versions/3.11.7/include/python3.11/methodobject.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h" 1
+
+
+
+
+
+
+typedef struct {
+    PyObject ob_base;
+    PyMethodDef *m_ml;
+    PyObject *m_self;
+    PyObject *m_module;
+    PyObject *m_weakreflist;
+    vectorcallfunc vectorcall;
+} PyCFunctionObject;
+# 23 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h"
+typedef struct {
+    PyCFunctionObject func;
+    PyTypeObject *mm_class;
+} PyCMethodObject;
+
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyCMethod_Type;
+
+
+
+
+
+
+
+static inline PyCFunction PyCFunction_GET_FUNCTION(PyObject *func) {
+    return (
+# 41 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h" 3 4
+          ((void) (0))
+# 41 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h"
+          , ((PyCFunctionObject*)((func))))->m_ml->ml_meth;
+}
+
+
+
+
+static inline PyObject* PyCFunction_GET_SELF(PyObject *func_obj) {
+    PyCFunctionObject *func = (
+# 48 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h" 3 4
+                             ((void) (0))
+# 48 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h"
+                             , ((PyCFunctionObject*)((func_obj))));
+    if (func->m_ml->ml_flags & 0x0020) {
+        return 
+# 50 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h" 3 4
+              ((void *)0)
+# 50 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h"
+                      ;
+    }
+    return func->m_self;
+}
+
+
+
+
+static inline int PyCFunction_GET_FLAGS(PyObject *func) {
+    return (
+# 59 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h" 3 4
+          ((void) (0))
+# 59 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h"
+          , ((PyCFunctionObject*)((func))))->m_ml->ml_flags;
+}
+
+
+
+
+static inline PyTypeObject* PyCFunction_GET_CLASS(PyObject *func_obj) {
+    PyCFunctionObject *func = (
+# 66 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h" 3 4
+                             ((void) (0))
+# 66 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h"
+                             , ((PyCFunctionObject*)((func_obj))));
+    if (func->m_ml->ml_flags & 0x0200) {
+        return (
+# 68 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h" 3 4
+              ((void) (0))
+# 68 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h"
+              , ((PyCMethodObject*)((func))))->mm_class;
+    }
+    return 
+# 70 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h" 3 4
+          ((void *)0)
+# 70 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/methodobject.h"
+                  ;
+}
+# 126 "/root/.pyenv/versions/3.11.7/include/python3.11/methodobject.h" 2
+# 66 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/moduleobject.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/moduleobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyModule_Type;
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyModule_NewObject(
+    PyObject *name
+    );
+
+__attribute__ ((visibility ("default"))) PyObject * PyModule_New(
+    const char *name
+    );
+__attribute__ ((visibility ("default"))) PyObject * PyModule_GetDict(PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyModule_GetNameObject(PyObject *);
+
+__attribute__ ((visibility ("default"))) const char * PyModule_GetName(PyObject *);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) const char * PyModule_GetFilename(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyModule_GetFilenameObject(PyObject *);
+
+__attribute__ ((visibility ("default"))) void _PyModule_Clear(PyObject *);
+__attribute__ ((visibility ("default"))) void _PyModule_ClearDict(PyObject *);
+__attribute__ ((visibility ("default"))) int _PyModuleSpec_IsInitializing(PyObject *);
+
+__attribute__ ((visibility ("default"))) PyModuleDef* PyModule_GetDef(PyObject*);
+__attribute__ ((visibility ("default"))) void* PyModule_GetState(PyObject*);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyModuleDef_Init(PyModuleDef*);
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyModuleDef_Type;
+
+
+typedef struct PyModuleDef_Base {
+  PyObject ob_base;
+  PyObject* (*m_init)(void);
+  Py_ssize_t m_index;
+  PyObject* m_copy;
+} PyModuleDef_Base;
+# 60 "/root/.pyenv/versions/3.11.7/include/python3.11/moduleobject.h"
+struct PyModuleDef_Slot {
+    int slot;
+    void *value;
+};
+# 74 "/root/.pyenv/versions/3.11.7/include/python3.11/moduleobject.h"
+struct PyModuleDef {
+  PyModuleDef_Base m_base;
+  const char* m_name;
+  const char* m_doc;
+  Py_ssize_t m_size;
+  PyMethodDef *m_methods;
+  PyModuleDef_Slot *m_slots;
+  traverseproc m_traverse;
+  inquiry m_clear;
+  freefunc m_free;
+};
+# 67 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/funcobject.h" 1
+# 21 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/funcobject.h"
+typedef struct {
+    PyObject *fc_globals; PyObject *fc_builtins; PyObject *fc_name; PyObject *fc_qualname; PyObject *fc_code; PyObject *fc_defaults; PyObject *fc_kwdefaults; PyObject *fc_closure;
+} PyFrameConstructor;
+# 36 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/funcobject.h"
+typedef struct {
+    PyObject ob_base;
+    PyObject *func_globals; PyObject *func_builtins; PyObject *func_name; PyObject *func_qualname; PyObject *func_code; PyObject *func_defaults; PyObject *func_kwdefaults; PyObject *func_closure;
+    PyObject *func_doc;
+    PyObject *func_dict;
+    PyObject *func_weakreflist;
+    PyObject *func_module;
+    PyObject *func_annotations;
+    vectorcallfunc vectorcall;
+
+
+
+
+
+
+
+    uint32_t func_version;
+
+
+
+
+
+
+} PyFunctionObject;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyFunction_Type;
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyFunction_New(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyFunction_NewWithQualName(PyObject *, PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyFunction_GetCode(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyFunction_GetGlobals(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyFunction_GetModule(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyFunction_GetDefaults(PyObject *);
+__attribute__ ((visibility ("default"))) int PyFunction_SetDefaults(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyFunction_GetKwDefaults(PyObject *);
+__attribute__ ((visibility ("default"))) int PyFunction_SetKwDefaults(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyFunction_GetClosure(PyObject *);
+__attribute__ ((visibility ("default"))) int PyFunction_SetClosure(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyFunction_GetAnnotations(PyObject *);
+__attribute__ ((visibility ("default"))) int PyFunction_SetAnnotations(PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyFunction_Vectorcall(
+    PyObject *func,
+    PyObject *const *stack,
+    size_t nargsf,
+    PyObject *kwnames);
+# 103 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/funcobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyClassMethod_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyStaticMethod_Type;
+
+__attribute__ ((visibility ("default"))) PyObject * PyClassMethod_New(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyStaticMethod_New(PyObject *);
+# 68 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/classobject.h" 1
+# 12 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/classobject.h"
+typedef struct {
+    PyObject ob_base;
+    PyObject *im_func;
+    PyObject *im_self;
+    PyObject *im_weakreflist;
+    vectorcallfunc vectorcall;
+} PyMethodObject;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyMethod_Type;
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyMethod_New(PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyMethod_Function(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyMethod_Self(PyObject *);
+# 36 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/classobject.h"
+typedef struct {
+    PyObject ob_base;
+    PyObject *func;
+} PyInstanceMethodObject;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyInstanceMethod_Type;
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyInstanceMethod_New(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyInstanceMethod_Function(PyObject *);
+# 69 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/fileobject.h" 1
+# 11 "/root/.pyenv/versions/3.11.7/include/python3.11/fileobject.h"
+__attribute__ ((visibility ("default"))) PyObject * PyFile_FromFd(int, const char *, const char *, int,
+                                     const char *, const char *,
+                                     const char *, int);
+__attribute__ ((visibility ("default"))) PyObject * PyFile_GetLine(PyObject *, int);
+__attribute__ ((visibility ("default"))) int PyFile_WriteObject(PyObject *, PyObject *, int);
+__attribute__ ((visibility ("default"))) int PyFile_WriteString(const char *, PyObject *);
+__attribute__ ((visibility ("default"))) int PyObject_AsFileDescriptor(PyObject *);
+
+
+
+
+extern __attribute__ ((visibility ("default"))) const char * Py_FileSystemDefaultEncoding;
+
+extern __attribute__ ((visibility ("default"))) const char * Py_FileSystemDefaultEncodeErrors;
+
+extern __attribute__ ((visibility ("default"))) int Py_HasFileSystemDefaultEncoding;
+
+
+extern __attribute__ ((visibility ("default"))) int Py_UTF8Mode;
+# 42 "/root/.pyenv/versions/3.11.7/include/python3.11/fileobject.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/fileobject.h" 1
+
+
+
+
+__attribute__ ((visibility ("default"))) char * Py_UniversalNewlineFgets(char *, int, FILE*, PyObject *);
+__attribute__ ((visibility ("default"))) char * _Py_UniversalNewlineFgetsWithSize(char *, int, FILE*, PyObject *, size_t*);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyFile_NewStdPrinter(int);
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyStdPrinter_Type;
+
+typedef PyObject * (*Py_OpenCodeHookFunction)(PyObject *, void *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyFile_OpenCode(const char *utf8path);
+__attribute__ ((visibility ("default"))) PyObject * PyFile_OpenCodeObject(PyObject *path);
+__attribute__ ((visibility ("default"))) int PyFile_SetOpenCodeHook(Py_OpenCodeHookFunction hook, void *userData);
+
+__attribute__ ((visibility ("default"))) int _PyLong_FileDescriptor_Converter(PyObject *, void *);
+# 43 "/root/.pyenv/versions/3.11.7/include/python3.11/fileobject.h" 2
+# 70 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pycapsule.h" 1
+# 21 "/root/.pyenv/versions/3.11.7/include/python3.11/pycapsule.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyCapsule_Type;
+
+typedef void (*PyCapsule_Destructor)(PyObject *);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCapsule_New(
+    void *pointer,
+    const char *name,
+    PyCapsule_Destructor destructor);
+
+__attribute__ ((visibility ("default"))) void * PyCapsule_GetPointer(PyObject *capsule, const char *name);
+
+__attribute__ ((visibility ("default"))) PyCapsule_Destructor PyCapsule_GetDestructor(PyObject *capsule);
+
+__attribute__ ((visibility ("default"))) const char * PyCapsule_GetName(PyObject *capsule);
+
+__attribute__ ((visibility ("default"))) void * PyCapsule_GetContext(PyObject *capsule);
+
+__attribute__ ((visibility ("default"))) int PyCapsule_IsValid(PyObject *capsule, const char *name);
+
+__attribute__ ((visibility ("default"))) int PyCapsule_SetPointer(PyObject *capsule, void *pointer);
+
+__attribute__ ((visibility ("default"))) int PyCapsule_SetDestructor(PyObject *capsule, PyCapsule_Destructor destructor);
+
+__attribute__ ((visibility ("default"))) int PyCapsule_SetName(PyObject *capsule, const char *name);
+
+__attribute__ ((visibility ("default"))) int PyCapsule_SetContext(PyObject *capsule, void *context);
+
+__attribute__ ((visibility ("default"))) void * PyCapsule_Import(
+    const char *name,
+    int no_block);
+# 71 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/code.h" 1
+# 19 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/code.h"
+typedef uint16_t _Py_CODEUNIT;
+# 103 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/code.h"
+struct PyCodeObject { PyVarObject ob_base; PyObject *co_consts; PyObject *co_names; PyObject *co_exceptiontable; int co_flags; short co_warmup; short _co_linearray_entry_size; int co_argcount; int co_posonlyargcount; int co_kwonlyargcount; int co_stacksize; int co_firstlineno; int co_nlocalsplus; int co_nlocals; int co_nplaincellvars; int co_ncellvars; int co_nfreevars; PyObject *co_localsplusnames; PyObject *co_localspluskinds; PyObject *co_filename; PyObject *co_name; PyObject *co_qualname; PyObject *co_linetable; PyObject *co_weakreflist; PyObject *_co_code; char *_co_linearray; int _co_firsttraceable; void *co_extra; char co_code_adaptive[(1)]; };
+# 140 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/code.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyCode_Type;
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyCodeObject * PyCode_New(
+        int, int, int, int, int, PyObject *, PyObject *,
+        PyObject *, PyObject *, PyObject *, PyObject *,
+        PyObject *, PyObject *, PyObject *, int, PyObject *,
+        PyObject *);
+
+__attribute__ ((visibility ("default"))) PyCodeObject * PyCode_NewWithPosOnlyArgs(
+        int, int, int, int, int, int, PyObject *, PyObject *,
+        PyObject *, PyObject *, PyObject *, PyObject *,
+        PyObject *, PyObject *, PyObject *, int, PyObject *,
+        PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) PyCodeObject *
+PyCode_NewEmpty(const char *filename, const char *funcname, int firstlineno);
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyCode_Addr2Line(PyCodeObject *, int);
+
+__attribute__ ((visibility ("default"))) int PyCode_Addr2Location(PyCodeObject *, int, int *, int *, int *, int *);
+
+
+struct _opaque {
+    int computed_line;
+    const uint8_t *lo_next;
+    const uint8_t *limit;
+};
+
+typedef struct _line_offsets {
+    int ar_start;
+    int ar_end;
+    int ar_line;
+    struct _opaque opaque;
+} PyCodeAddressRange;
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyCode_CheckLineNumber(int lasti, PyCodeAddressRange *bounds);
+# 198 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/code.h"
+__attribute__ ((visibility ("default"))) PyObject* _PyCode_ConstantKey(PyObject *obj);
+
+__attribute__ ((visibility ("default"))) PyObject* PyCode_Optimize(PyObject *code, PyObject* consts,
+                                      PyObject *names, PyObject *lnotab);
+
+
+__attribute__ ((visibility ("default"))) int _PyCode_GetExtra(PyObject *code, Py_ssize_t index,
+                                 void **extra);
+__attribute__ ((visibility ("default"))) int _PyCode_SetExtra(PyObject *code, Py_ssize_t index,
+                                 void *extra);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCode_GetCode(PyCodeObject *code);
+
+__attribute__ ((visibility ("default"))) PyObject * PyCode_GetVarnames(PyCodeObject *code);
+
+__attribute__ ((visibility ("default"))) PyObject * PyCode_GetCellvars(PyCodeObject *code);
+
+__attribute__ ((visibility ("default"))) PyObject * PyCode_GetFreevars(PyCodeObject *code);
+
+typedef enum _PyCodeLocationInfoKind {
+
+    PY_CODE_LOCATION_INFO_SHORT0 = 0,
+
+    PY_CODE_LOCATION_INFO_ONE_LINE0 = 10,
+    PY_CODE_LOCATION_INFO_ONE_LINE1 = 11,
+    PY_CODE_LOCATION_INFO_ONE_LINE2 = 12,
+
+    PY_CODE_LOCATION_INFO_NO_COLUMNS = 13,
+    PY_CODE_LOCATION_INFO_LONG = 14,
+    PY_CODE_LOCATION_INFO_NONE = 15
+} _PyCodeLocationInfoKind;
+# 72 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pyframe.h" 1
+# 13 "/root/.pyenv/versions/3.11.7/include/python3.11/pyframe.h"
+__attribute__ ((visibility ("default"))) int PyFrame_GetLineNumber(PyFrameObject *);
+
+__attribute__ ((visibility ("default"))) PyCodeObject * PyFrame_GetCode(PyFrameObject *frame);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pyframe.h" 1
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyFrame_Type;
+
+
+
+__attribute__ ((visibility ("default"))) PyFrameObject * PyFrame_GetBack(PyFrameObject *frame);
+__attribute__ ((visibility ("default"))) PyObject * PyFrame_GetLocals(PyFrameObject *frame);
+
+__attribute__ ((visibility ("default"))) PyObject * PyFrame_GetGlobals(PyFrameObject *frame);
+__attribute__ ((visibility ("default"))) PyObject * PyFrame_GetBuiltins(PyFrameObject *frame);
+
+__attribute__ ((visibility ("default"))) PyObject * PyFrame_GetGenerator(PyFrameObject *frame);
+__attribute__ ((visibility ("default"))) int PyFrame_GetLasti(PyFrameObject *frame);
+# 20 "/root/.pyenv/versions/3.11.7/include/python3.11/pyframe.h" 2
+# 73 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/traceback.h" 1
+# 9 "/root/.pyenv/versions/3.11.7/include/python3.11/traceback.h"
+__attribute__ ((visibility ("default"))) int PyTraceBack_Here(PyFrameObject *);
+__attribute__ ((visibility ("default"))) int PyTraceBack_Print(PyObject *, PyObject *);
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyTraceBack_Type;
+
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/traceback.h" 1
+
+
+
+
+typedef struct _traceback PyTracebackObject;
+
+struct _traceback {
+    PyObject ob_base;
+    PyTracebackObject *tb_next;
+    PyFrameObject *tb_frame;
+    int tb_lasti;
+    int tb_lineno;
+};
+
+__attribute__ ((visibility ("default"))) int _Py_DisplaySourceLine(PyObject *, PyObject *, int, int, int *, PyObject **);
+__attribute__ ((visibility ("default"))) void _PyTraceback_Add(const char *, const char *, int);
+# 20 "/root/.pyenv/versions/3.11.7/include/python3.11/traceback.h" 2
+# 74 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/sliceobject.h" 1
+# 9 "/root/.pyenv/versions/3.11.7/include/python3.11/sliceobject.h"
+extern __attribute__ ((visibility ("default"))) PyObject _Py_EllipsisObject;
+# 22 "/root/.pyenv/versions/3.11.7/include/python3.11/sliceobject.h"
+typedef struct {
+    PyObject ob_base;
+    PyObject *start, *stop, *step;
+} PySliceObject;
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PySlice_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyEllipsis_Type;
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PySlice_New(PyObject* start, PyObject* stop,
+                                  PyObject* step);
+
+__attribute__ ((visibility ("default"))) PyObject * _PySlice_FromIndices(Py_ssize_t start, Py_ssize_t stop);
+__attribute__ ((visibility ("default"))) int _PySlice_GetLongIndices(PySliceObject *self, PyObject *length,
+                                 PyObject **start_ptr, PyObject **stop_ptr,
+                                 PyObject **step_ptr);
+
+__attribute__ ((visibility ("default"))) int PySlice_GetIndices(PyObject *r, Py_ssize_t length,
+                                  Py_ssize_t *start, Py_ssize_t *stop, Py_ssize_t *step);
+__attribute__((__deprecated__))
+__attribute__ ((visibility ("default"))) int PySlice_GetIndicesEx(PyObject *r, Py_ssize_t length,
+                                     Py_ssize_t *start, Py_ssize_t *stop,
+                                     Py_ssize_t *step,
+                                     Py_ssize_t *slicelength);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PySlice_Unpack(PyObject *slice,
+                               Py_ssize_t *start, Py_ssize_t *stop, Py_ssize_t *step);
+__attribute__ ((visibility ("default"))) Py_ssize_t PySlice_AdjustIndices(Py_ssize_t length,
+                                             Py_ssize_t *start, Py_ssize_t *stop,
+                                             Py_ssize_t step);
+# 75 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/cellobject.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/cellobject.h"
+typedef struct {
+    PyObject ob_base;
+
+    PyObject *ob_ref;
+} PyCellObject;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyCell_Type;
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCell_New(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyCell_Get(PyObject *);
+__attribute__ ((visibility ("default"))) int PyCell_Set(PyObject *, PyObject *);
+# 76 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/iterobject.h" 1
+
+
+
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PySeqIter_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyCallIter_Type;
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PySeqIter_New(PyObject *);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCallIter_New(PyObject *, PyObject *);
+# 77 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/initconfig.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/initconfig.h"
+typedef struct {
+    enum {
+        _PyStatus_TYPE_OK=0,
+        _PyStatus_TYPE_ERROR=1,
+        _PyStatus_TYPE_EXIT=2
+    } _type;
+    const char *func;
+    const char *err_msg;
+    int exitcode;
+} PyStatus;
+
+__attribute__ ((visibility ("default"))) PyStatus PyStatus_Ok(void);
+__attribute__ ((visibility ("default"))) PyStatus PyStatus_Error(const char *err_msg);
+__attribute__ ((visibility ("default"))) PyStatus PyStatus_NoMemory(void);
+__attribute__ ((visibility ("default"))) PyStatus PyStatus_Exit(int exitcode);
+__attribute__ ((visibility ("default"))) int PyStatus_IsError(PyStatus err);
+__attribute__ ((visibility ("default"))) int PyStatus_IsExit(PyStatus err);
+__attribute__ ((visibility ("default"))) int PyStatus_Exception(PyStatus err);
+
+
+
+typedef struct {
+
+
+    Py_ssize_t length;
+    wchar_t **items;
+} PyWideStringList;
+
+__attribute__ ((visibility ("default"))) PyStatus PyWideStringList_Append(PyWideStringList *list,
+    const wchar_t *item);
+__attribute__ ((visibility ("default"))) PyStatus PyWideStringList_Insert(PyWideStringList *list,
+    Py_ssize_t index,
+    const wchar_t *item);
+
+
+
+
+typedef struct PyPreConfig {
+    int _config_init;
+
+
+
+    int parse_argv;
+
+
+
+
+
+
+    int isolated;
+
+
+
+
+    int use_environment;
+
+
+
+    int configure_locale;
+# 81 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/initconfig.h"
+    int coerce_c_locale;
+
+
+
+
+
+
+
+    int coerce_c_locale_warn;
+# 114 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/initconfig.h"
+    int utf8_mode;
+
+
+
+
+
+    int dev_mode;
+
+
+
+    int allocator;
+} PyPreConfig;
+
+__attribute__ ((visibility ("default"))) void PyPreConfig_InitPythonConfig(PyPreConfig *config);
+__attribute__ ((visibility ("default"))) void PyPreConfig_InitIsolatedConfig(PyPreConfig *config);
+
+
+
+
+
+typedef struct PyConfig {
+    int _config_init;
+
+    int isolated;
+    int use_environment;
+    int dev_mode;
+    int install_signal_handlers;
+    int use_hash_seed;
+    unsigned long hash_seed;
+    int faulthandler;
+    int tracemalloc;
+    int import_time;
+    int code_debug_ranges;
+    int show_ref_count;
+    int dump_refs;
+    wchar_t *dump_refs_file;
+    int malloc_stats;
+    wchar_t *filesystem_encoding;
+    wchar_t *filesystem_errors;
+    wchar_t *pycache_prefix;
+    int parse_argv;
+    PyWideStringList orig_argv;
+    PyWideStringList argv;
+    PyWideStringList xoptions;
+    PyWideStringList warnoptions;
+    int site_import;
+    int bytes_warning;
+    int warn_default_encoding;
+    int inspect;
+    int interactive;
+    int optimization_level;
+    int parser_debug;
+    int write_bytecode;
+    int verbose;
+    int quiet;
+    int user_site_directory;
+    int configure_c_stdio;
+    int buffered_stdio;
+    wchar_t *stdio_encoding;
+    wchar_t *stdio_errors;
+
+
+
+    wchar_t *check_hash_pycs_mode;
+    int use_frozen_modules;
+    int safe_path;
+
+
+    int pathconfig_warnings;
+    wchar_t *program_name;
+    wchar_t *pythonpath_env;
+    wchar_t *home;
+    wchar_t *platlibdir;
+
+
+    int module_search_paths_set;
+    PyWideStringList module_search_paths;
+    wchar_t *stdlib_dir;
+    wchar_t *executable;
+    wchar_t *base_executable;
+    wchar_t *prefix;
+    wchar_t *base_prefix;
+    wchar_t *exec_prefix;
+    wchar_t *base_exec_prefix;
+
+
+    int skip_source_first_line;
+    wchar_t *run_command;
+    wchar_t *run_module;
+    wchar_t *run_filename;
+
+
+
+
+
+    int _install_importlib;
+
+
+    int _init_main;
+
+
+
+    int _isolated_interpreter;
+
+
+    int _is_python_build;
+} PyConfig;
+
+__attribute__ ((visibility ("default"))) void PyConfig_InitPythonConfig(PyConfig *config);
+__attribute__ ((visibility ("default"))) void PyConfig_InitIsolatedConfig(PyConfig *config);
+__attribute__ ((visibility ("default"))) void PyConfig_Clear(PyConfig *);
+__attribute__ ((visibility ("default"))) PyStatus PyConfig_SetString(
+    PyConfig *config,
+    wchar_t **config_str,
+    const wchar_t *str);
+__attribute__ ((visibility ("default"))) PyStatus PyConfig_SetBytesString(
+    PyConfig *config,
+    wchar_t **config_str,
+    const char *str);
+__attribute__ ((visibility ("default"))) PyStatus PyConfig_Read(PyConfig *config);
+__attribute__ ((visibility ("default"))) PyStatus PyConfig_SetBytesArgv(
+    PyConfig *config,
+    Py_ssize_t argc,
+    char * const *argv);
+__attribute__ ((visibility ("default"))) PyStatus PyConfig_SetArgv(PyConfig *config,
+    Py_ssize_t argc,
+    wchar_t * const *argv);
+__attribute__ ((visibility ("default"))) PyStatus PyConfig_SetWideStringList(PyConfig *config,
+    PyWideStringList *list,
+    Py_ssize_t length, wchar_t **items);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void Py_GetArgcArgv(int *argc, wchar_t ***argv);
+# 78 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pystate.h" 1
+# 14 "/root/.pyenv/versions/3.11.7/include/python3.11/pystate.h"
+__attribute__ ((visibility ("default"))) PyInterpreterState * PyInterpreterState_New(void);
+__attribute__ ((visibility ("default"))) void PyInterpreterState_Clear(PyInterpreterState *);
+__attribute__ ((visibility ("default"))) void PyInterpreterState_Delete(PyInterpreterState *);
+# 26 "/root/.pyenv/versions/3.11.7/include/python3.11/pystate.h"
+__attribute__ ((visibility ("default"))) PyInterpreterState * PyInterpreterState_Get(void);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyInterpreterState_GetDict(PyInterpreterState *);
+
+
+
+
+__attribute__ ((visibility ("default"))) int64_t PyInterpreterState_GetID(PyInterpreterState *);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyState_AddModule(PyObject*, PyModuleDef*);
+__attribute__ ((visibility ("default"))) int PyState_RemoveModule(PyModuleDef*);
+
+__attribute__ ((visibility ("default"))) PyObject* PyState_FindModule(PyModuleDef*);
+
+__attribute__ ((visibility ("default"))) PyThreadState * PyThreadState_New(PyInterpreterState *);
+__attribute__ ((visibility ("default"))) void PyThreadState_Clear(PyThreadState *);
+__attribute__ ((visibility ("default"))) void PyThreadState_Delete(PyThreadState *);
+# 60 "/root/.pyenv/versions/3.11.7/include/python3.11/pystate.h"
+__attribute__ ((visibility ("default"))) PyThreadState * PyThreadState_Get(void);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyThreadState * PyThreadState_Swap(PyThreadState *);
+__attribute__ ((visibility ("default"))) PyObject * PyThreadState_GetDict(void);
+__attribute__ ((visibility ("default"))) int PyThreadState_SetAsyncExc(unsigned long, PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) PyInterpreterState* PyThreadState_GetInterpreter(PyThreadState *tstate);
+__attribute__ ((visibility ("default"))) PyFrameObject* PyThreadState_GetFrame(PyThreadState *tstate);
+__attribute__ ((visibility ("default"))) uint64_t PyThreadState_GetID(PyThreadState *tstate);
+
+
+typedef
+    enum {PyGILState_LOCKED, PyGILState_UNLOCKED}
+        PyGILState_STATE;
+# 102 "/root/.pyenv/versions/3.11.7/include/python3.11/pystate.h"
+__attribute__ ((visibility ("default"))) PyGILState_STATE PyGILState_Ensure(void);
+# 112 "/root/.pyenv/versions/3.11.7/include/python3.11/pystate.h"
+__attribute__ ((visibility ("default"))) void PyGILState_Release(PyGILState_STATE);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyThreadState * PyGILState_GetThisThreadState(void);
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h" 1
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyInterpreterState_RequiresIDRef(PyInterpreterState *);
+__attribute__ ((visibility ("default"))) void _PyInterpreterState_RequireIDRef(PyInterpreterState *, int);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyInterpreterState_GetMainModule(PyInterpreterState *);
+
+
+
+
+typedef int (*Py_tracefunc)(PyObject *, PyFrameObject *, int, PyObject *);
+# 31 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+typedef struct {
+    PyCodeObject *code;
+    PyCodeAddressRange bounds;
+} PyTraceInfo;
+
+
+
+typedef struct _PyCFrame {
+# 49 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+    uint8_t use_tracing;
+
+    struct _PyInterpreterFrame *current_frame;
+    struct _PyCFrame *previous;
+} _PyCFrame;
+
+typedef struct _err_stackitem {
+# 69 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+    PyObject *exc_value;
+
+    struct _err_stackitem *previous_item;
+
+} _PyErr_StackItem;
+
+typedef struct _stack_chunk {
+    struct _stack_chunk *previous;
+    size_t size;
+    size_t top;
+    PyObject * data[1];
+} _PyStackChunk;
+
+struct _ts {
+
+
+    PyThreadState *prev;
+    PyThreadState *next;
+    PyInterpreterState *interp;
+
+
+
+
+
+    int _initialized;
+
+
+    int _static;
+
+    int recursion_remaining;
+    int recursion_limit;
+    int recursion_headroom;
+
+
+
+
+    int tracing;
+    int tracing_what;
+
+
+
+    _PyCFrame *cframe;
+
+    Py_tracefunc c_profilefunc;
+    Py_tracefunc c_tracefunc;
+    PyObject *c_profileobj;
+    PyObject *c_traceobj;
+
+
+    PyObject *curexc_type;
+    PyObject *curexc_value;
+    PyObject *curexc_traceback;
+
+
+
+
+    _PyErr_StackItem *exc_info;
+
+    PyObject *dict;
+
+    int gilstate_counter;
+
+    PyObject *async_exc;
+    unsigned long thread_id;
+
+
+
+
+
+    unsigned long native_thread_id;
+
+    int trash_delete_nesting;
+    PyObject *trash_delete_later;
+# 166 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+    void (*on_delete)(void *);
+    void *on_delete_data;
+
+    int coroutine_origin_tracking_depth;
+
+    PyObject *async_gen_firstiter;
+    PyObject *async_gen_finalizer;
+
+    PyObject *context;
+    uint64_t context_ver;
+
+
+    uint64_t id;
+
+    PyTraceInfo trace_info;
+
+    _PyStackChunk *datastack_chunk;
+    PyObject **datastack_top;
+    PyObject **datastack_limit;
+# 199 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+    _PyErr_StackItem exc_state;
+
+
+    _PyCFrame root_cframe;
+};
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyThreadState * _PyThreadState_Prealloc(PyInterpreterState *);
+
+
+
+__attribute__ ((visibility ("default"))) PyThreadState * _PyThreadState_UncheckedGet(void);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyThreadState_GetDict(PyThreadState *tstate);
+
+
+__attribute__ ((visibility ("default"))) void PyThreadState_EnterTracing(PyThreadState *tstate);
+
+
+
+__attribute__ ((visibility ("default"))) void PyThreadState_LeaveTracing(PyThreadState *tstate);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyGILState_Check(void);
+# 241 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+__attribute__ ((visibility ("default"))) PyInterpreterState * _PyGILState_GetInterpreterStateUnsafe(void);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyThread_CurrentFrames(void);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyThread_CurrentExceptions(void);
+
+
+
+__attribute__ ((visibility ("default"))) PyInterpreterState * PyInterpreterState_Main(void);
+__attribute__ ((visibility ("default"))) PyInterpreterState * PyInterpreterState_Head(void);
+__attribute__ ((visibility ("default"))) PyInterpreterState * PyInterpreterState_Next(PyInterpreterState *);
+__attribute__ ((visibility ("default"))) PyThreadState * PyInterpreterState_ThreadHead(PyInterpreterState *);
+__attribute__ ((visibility ("default"))) PyThreadState * PyThreadState_Next(PyThreadState *);
+__attribute__ ((visibility ("default"))) void PyThreadState_DeleteCurrent(void);
+
+
+
+typedef PyObject* (*_PyFrameEvalFunction)(PyThreadState *tstate, struct _PyInterpreterFrame *, int);
+
+__attribute__ ((visibility ("default"))) _PyFrameEvalFunction _PyInterpreterState_GetEvalFrameFunc(
+    PyInterpreterState *interp);
+__attribute__ ((visibility ("default"))) void _PyInterpreterState_SetEvalFrameFunc(
+    PyInterpreterState *interp,
+    _PyFrameEvalFunction eval_frame);
+
+__attribute__ ((visibility ("default"))) const PyConfig* _PyInterpreterState_GetConfig(PyInterpreterState *interp);
+# 283 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+__attribute__ ((visibility ("default"))) int _PyInterpreterState_GetConfigCopy(
+    struct PyConfig *config);
+# 301 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+__attribute__ ((visibility ("default"))) int _PyInterpreterState_SetConfig(
+    const struct PyConfig *config);
+
+
+
+__attribute__ ((visibility ("default"))) const PyConfig* _Py_GetConfig(void);
+
+
+
+
+
+
+
+typedef struct _xid _PyCrossInterpreterData;
+
+struct _xid {
+
+
+
+    void *data;
+
+
+
+
+
+
+    PyObject *obj;
+# 337 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+    int64_t interp;
+
+
+
+
+    PyObject *(*new_object)(_PyCrossInterpreterData *);
+# 352 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pystate.h"
+    void (*free)(void *);
+};
+
+__attribute__ ((visibility ("default"))) int _PyObject_GetCrossInterpreterData(PyObject *, _PyCrossInterpreterData *);
+__attribute__ ((visibility ("default"))) PyObject * _PyCrossInterpreterData_NewObject(_PyCrossInterpreterData *);
+__attribute__ ((visibility ("default"))) void _PyCrossInterpreterData_Release(_PyCrossInterpreterData *);
+
+__attribute__ ((visibility ("default"))) int _PyObject_CheckCrossInterpreterData(PyObject *);
+
+
+
+typedef int (*crossinterpdatafunc)(PyObject *, _PyCrossInterpreterData *);
+
+__attribute__ ((visibility ("default"))) int _PyCrossInterpreterData_RegisterClass(PyTypeObject *, crossinterpdatafunc);
+__attribute__ ((visibility ("default"))) crossinterpdatafunc _PyCrossInterpreterData_Lookup(PyObject *);
+# 126 "/root/.pyenv/versions/3.11.7/include/python3.11/pystate.h" 2
+# 79 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/genobject.h" 1
+# 33 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/genobject.h"
+typedef struct {
+
+    PyObject ob_base; PyCodeObject *gi_code; PyObject *gi_weakreflist; PyObject *gi_name; PyObject *gi_qualname; _PyErr_StackItem gi_exc_state; PyObject *gi_origin_or_finalizer; char gi_hooks_inited; char gi_closed; char gi_running_async; int8_t gi_frame_state; PyObject *gi_iframe[1];
+} PyGenObject;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyGen_Type;
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyGen_New(PyFrameObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyGen_NewWithQualName(PyFrameObject *,
+    PyObject *name, PyObject *qualname);
+__attribute__ ((visibility ("default"))) int _PyGen_SetStopIterationValue(PyObject *);
+__attribute__ ((visibility ("default"))) int _PyGen_FetchStopIterationValue(PyObject **);
+__attribute__ ((visibility ("default"))) void _PyGen_Finalize(PyObject *self);
+
+
+
+
+typedef struct {
+    PyObject ob_base; PyCodeObject *cr_code; PyObject *cr_weakreflist; PyObject *cr_name; PyObject *cr_qualname; _PyErr_StackItem cr_exc_state; PyObject *cr_origin_or_finalizer; char cr_hooks_inited; char cr_closed; char cr_running_async; int8_t cr_frame_state; PyObject *cr_iframe[1];
+} PyCoroObject;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyCoro_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyCoroWrapper_Type;
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCoro_New(PyFrameObject *,
+    PyObject *name, PyObject *qualname);
+
+
+
+
+typedef struct {
+    PyObject ob_base; PyCodeObject *ag_code; PyObject *ag_weakreflist; PyObject *ag_name; PyObject *ag_qualname; _PyErr_StackItem ag_exc_state; PyObject *ag_origin_or_finalizer; char ag_hooks_inited; char ag_closed; char ag_running_async; int8_t ag_frame_state; PyObject *ag_iframe[1];
+} PyAsyncGenObject;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyAsyncGen_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyAsyncGenASend_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyAsyncGenWrappedValue_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyAsyncGenAThrow_Type;
+
+__attribute__ ((visibility ("default"))) PyObject * PyAsyncGen_New(PyFrameObject *,
+    PyObject *name, PyObject *qualname);
+# 80 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/descrobject.h" 1
+
+
+
+
+
+
+
+typedef PyObject *(*getter)(PyObject *, void *);
+typedef int (*setter)(PyObject *, PyObject *, void *);
+
+struct PyGetSetDef {
+    const char *name;
+    getter get;
+    setter set;
+    const char *doc;
+    void *closure;
+};
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyClassMethodDescr_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyGetSetDescr_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyMemberDescr_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyMethodDescr_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyWrapperDescr_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyDictProxy_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyProperty_Type;
+
+__attribute__ ((visibility ("default"))) PyObject * PyDescr_NewMethod(PyTypeObject *, PyMethodDef *);
+__attribute__ ((visibility ("default"))) PyObject * PyDescr_NewClassMethod(PyTypeObject *, PyMethodDef *);
+__attribute__ ((visibility ("default"))) PyObject * PyDescr_NewMember(PyTypeObject *, PyMemberDef *);
+__attribute__ ((visibility ("default"))) PyObject * PyDescr_NewGetSet(PyTypeObject *, PyGetSetDef *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyDictProxy_New(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyWrapper_New(PyObject *, PyObject *);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/descrobject.h" 1
+
+
+
+
+typedef PyObject *(*wrapperfunc)(PyObject *self, PyObject *args,
+                                 void *wrapped);
+
+typedef PyObject *(*wrapperfunc_kwds)(PyObject *self, PyObject *args,
+                                      void *wrapped, PyObject *kwds);
+
+struct wrapperbase {
+    const char *name;
+    int offset;
+    void *function;
+    wrapperfunc wrapper;
+    const char *doc;
+    int flags;
+    PyObject *name_strobj;
+};
+
+
+
+
+
+
+typedef struct {
+    PyObject ob_base;
+    PyTypeObject *d_type;
+    PyObject *d_name;
+    PyObject *d_qualname;
+} PyDescrObject;
+
+
+
+
+
+
+typedef struct {
+    PyDescrObject d_common;
+    PyMethodDef *d_method;
+    vectorcallfunc vectorcall;
+} PyMethodDescrObject;
+
+typedef struct {
+    PyDescrObject d_common;
+    PyMemberDef *d_member;
+} PyMemberDescrObject;
+
+typedef struct {
+    PyDescrObject d_common;
+    PyGetSetDef *d_getset;
+} PyGetSetDescrObject;
+
+typedef struct {
+    PyDescrObject d_common;
+    struct wrapperbase *d_base;
+    void *d_wrapped;
+} PyWrapperDescrObject;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyMethodWrapper_Type;
+
+__attribute__ ((visibility ("default"))) PyObject * PyDescr_NewWrapper(PyTypeObject *,
+                                                struct wrapperbase *, void *);
+__attribute__ ((visibility ("default"))) int PyDescr_IsData(PyObject *);
+# 38 "/root/.pyenv/versions/3.11.7/include/python3.11/descrobject.h" 2
+# 81 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/genericaliasobject.h" 1
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * Py_GenericAlias(PyObject *, PyObject *);
+extern __attribute__ ((visibility ("default"))) PyTypeObject Py_GenericAliasType;
+# 82 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/warnings.h" 1
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyErr_WarnEx(
+    PyObject *category,
+    const char *message,
+    Py_ssize_t stack_level);
+
+__attribute__ ((visibility ("default"))) int PyErr_WarnFormat(
+    PyObject *category,
+    Py_ssize_t stack_level,
+    const char *format,
+    ...);
+
+
+
+__attribute__ ((visibility ("default"))) int PyErr_ResourceWarning(
+    PyObject *source,
+    Py_ssize_t stack_level,
+    const char *format,
+    ...);
+
+
+__attribute__ ((visibility ("default"))) int PyErr_WarnExplicit(
+    PyObject *category,
+    const char *message,
+    const char *filename,
+    int lineno,
+    const char *module,
+    PyObject *registry);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/warnings.h" 1
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyErr_WarnExplicitObject(
+    PyObject *category,
+    PyObject *message,
+    PyObject *filename,
+    int lineno,
+    PyObject *module,
+    PyObject *registry);
+
+__attribute__ ((visibility ("default"))) int PyErr_WarnExplicitFormat(
+    PyObject *category,
+    const char *filename, int lineno,
+    const char *module, PyObject *registry,
+    const char *format, ...);
+# 38 "/root/.pyenv/versions/3.11.7/include/python3.11/warnings.h" 2
+# 83 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/weakrefobject.h" 1
+# 9 "/root/.pyenv/versions/3.11.7/include/python3.11/weakrefobject.h"
+typedef struct _PyWeakReference PyWeakReference;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyWeakref_RefType;
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyWeakref_ProxyType;
+extern __attribute__ ((visibility ("default"))) PyTypeObject _PyWeakref_CallableProxyType;
+# 26 "/root/.pyenv/versions/3.11.7/include/python3.11/weakrefobject.h"
+__attribute__ ((visibility ("default"))) PyObject * PyWeakref_NewRef(PyObject *ob,
+                                        PyObject *callback);
+__attribute__ ((visibility ("default"))) PyObject * PyWeakref_NewProxy(PyObject *ob,
+                                          PyObject *callback);
+__attribute__ ((visibility ("default"))) PyObject * PyWeakref_GetObject(PyObject *ref);
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/weakrefobject.h" 1
+
+
+
+
+
+
+
+struct _PyWeakReference {
+    PyObject ob_base;
+
+
+
+
+
+    PyObject *wr_object;
+
+
+    PyObject *wr_callback;
+
+
+
+
+    Py_hash_t hash;
+
+
+
+
+
+
+    PyWeakReference *wr_prev;
+    PyWeakReference *wr_next;
+    vectorcallfunc vectorcall;
+};
+
+__attribute__ ((visibility ("default"))) Py_ssize_t _PyWeakref_GetWeakrefCount(PyWeakReference *head);
+
+__attribute__ ((visibility ("default"))) void _PyWeakref_ClearRef(PyWeakReference *self);
+
+static inline PyObject* PyWeakref_GET_OBJECT(PyObject *ref_obj) {
+    PyWeakReference *ref;
+    PyObject *obj;
+    
+# 42 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/weakrefobject.h" 3 4
+   ((void) (0))
+# 42 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/weakrefobject.h"
+                                   ;
+    ref = ((PyWeakReference*)(ref_obj));
+    obj = ref->wr_object;
+
+
+
+
+
+
+    if (Py_REFCNT(((PyObject*)((obj)))) > 0) {
+        return obj;
+    }
+    return (&_Py_NoneStruct);
+}
+# 36 "/root/.pyenv/versions/3.11.7/include/python3.11/weakrefobject.h" 2
+# 84 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/structseq.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/structseq.h"
+typedef struct PyStructSequence_Field {
+    const char *name;
+    const char *doc;
+} PyStructSequence_Field;
+
+typedef struct PyStructSequence_Desc {
+    const char *name;
+    const char *doc;
+    PyStructSequence_Field *fields;
+    int n_in_sequence;
+} PyStructSequence_Desc;
+
+extern __attribute__ ((visibility ("default"))) const char * const PyStructSequence_UnnamedField;
+
+
+__attribute__ ((visibility ("default"))) void PyStructSequence_InitType(PyTypeObject *type,
+                                           PyStructSequence_Desc *desc);
+__attribute__ ((visibility ("default"))) int PyStructSequence_InitType2(PyTypeObject *type,
+                                           PyStructSequence_Desc *desc);
+
+__attribute__ ((visibility ("default"))) PyTypeObject* PyStructSequence_NewType(PyStructSequence_Desc *desc);
+
+__attribute__ ((visibility ("default"))) PyObject * PyStructSequence_New(PyTypeObject* type);
+
+
+typedef PyTupleObject PyStructSequence;
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void PyStructSequence_SetItem(PyObject*, Py_ssize_t, PyObject*);
+__attribute__ ((visibility ("default"))) PyObject* PyStructSequence_GetItem(PyObject*, Py_ssize_t);
+# 85 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/picklebufobject.h" 1
+# 13 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/picklebufobject.h"
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyPickleBuffer_Type;
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyPickleBuffer_FromObject(PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) const Py_buffer * PyPickleBuffer_GetBuffer(PyObject *);
+
+__attribute__ ((visibility ("default"))) int PyPickleBuffer_Release(PyObject *);
+# 86 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pytime.h" 1
+# 59 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pytime.h"
+typedef int64_t _PyTime_t;
+
+
+
+
+
+
+typedef enum {
+
+
+    _PyTime_ROUND_FLOOR=0,
+
+
+    _PyTime_ROUND_CEILING=1,
+
+
+    _PyTime_ROUND_HALF_EVEN=2,
+
+
+
+
+
+
+    _PyTime_ROUND_UP=3,
+
+
+    _PyTime_ROUND_TIMEOUT = _PyTime_ROUND_UP
+} _PyTime_round_t;
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyLong_FromTime_t(
+    time_t sec);
+
+
+__attribute__ ((visibility ("default"))) time_t _PyLong_AsTime_t(
+    PyObject *obj);
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_ObjectToTime_t(
+    PyObject *obj,
+    time_t *sec,
+    _PyTime_round_t);
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_ObjectToTimeval(
+    PyObject *obj,
+    time_t *sec,
+    long *usec,
+    _PyTime_round_t);
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_ObjectToTimespec(
+    PyObject *obj,
+    time_t *sec,
+    long *nsec,
+    _PyTime_round_t);
+
+
+
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_FromSeconds(int seconds);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_FromNanoseconds(_PyTime_t ns);
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_FromNanosecondsObject(_PyTime_t *t,
+    PyObject *obj);
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_FromSecondsObject(_PyTime_t *t,
+    PyObject *obj,
+    _PyTime_round_t round);
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_FromMillisecondsObject(_PyTime_t *t,
+    PyObject *obj,
+    _PyTime_round_t round);
+
+
+__attribute__ ((visibility ("default"))) double _PyTime_AsSecondsDouble(_PyTime_t t);
+
+
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_AsMilliseconds(_PyTime_t t,
+    _PyTime_round_t round);
+
+
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_AsMicroseconds(_PyTime_t t,
+    _PyTime_round_t round);
+
+
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_AsNanoseconds(_PyTime_t t);
+# 171 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pytime.h"
+__attribute__ ((visibility ("default"))) PyObject * _PyTime_AsNanosecondsObject(_PyTime_t t);
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_FromTimeval(_PyTime_t *tp, struct timeval *tv);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_AsTimeval(_PyTime_t t,
+    struct timeval *tv,
+    _PyTime_round_t round);
+
+
+
+__attribute__ ((visibility ("default"))) void _PyTime_AsTimeval_clamp(_PyTime_t t,
+    struct timeval *tv,
+    _PyTime_round_t round);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_AsTimevalTime_t(
+    _PyTime_t t,
+    time_t *secs,
+    int *us,
+    _PyTime_round_t round);
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_FromTimespec(_PyTime_t *tp, struct timespec *ts);
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_AsTimespec(_PyTime_t t, struct timespec *ts);
+
+
+
+__attribute__ ((visibility ("default"))) void _PyTime_AsTimespec_clamp(_PyTime_t t, struct timespec *ts);
+
+
+
+
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_Add(_PyTime_t t1, _PyTime_t t2);
+
+
+
+
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_MulDiv(_PyTime_t ticks,
+    _PyTime_t mul,
+    _PyTime_t div);
+
+
+typedef struct {
+    const char *implementation;
+    int monotonic;
+    int adjustable;
+    double resolution;
+} _Py_clock_info_t;
+# 246 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pytime.h"
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_GetSystemClock(void);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_GetSystemClockWithInfo(
+    _PyTime_t *t,
+    _Py_clock_info_t *info);
+# 266 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pytime.h"
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_GetMonotonicClock(void);
+# 276 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pytime.h"
+__attribute__ ((visibility ("default"))) int _PyTime_GetMonotonicClockWithInfo(
+    _PyTime_t *t,
+    _Py_clock_info_t *info);
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_localtime(time_t t, struct tm *tm);
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_gmtime(time_t t, struct tm *tm);
+# 297 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pytime.h"
+__attribute__ ((visibility ("default"))) _PyTime_t _PyTime_GetPerfCounter(void);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int _PyTime_GetPerfCounterWithInfo(
+    _PyTime_t *t,
+    _Py_clock_info_t *info);
+
+
+
+
+__attribute__ ((visibility ("default"))) _PyTime_t _PyDeadline_Init(_PyTime_t timeout);
+
+
+
+__attribute__ ((visibility ("default"))) _PyTime_t _PyDeadline_Get(_PyTime_t deadline);
+# 87 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/codecs.h" 1
+# 26 "/root/.pyenv/versions/3.11.7/include/python3.11/codecs.h"
+__attribute__ ((visibility ("default"))) int PyCodec_Register(
+       PyObject *search_function
+       );
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyCodec_Unregister(
+       PyObject *search_function
+       );
+# 57 "/root/.pyenv/versions/3.11.7/include/python3.11/codecs.h"
+__attribute__ ((visibility ("default"))) PyObject * _PyCodec_Lookup(
+       const char *encoding
+       );
+
+__attribute__ ((visibility ("default"))) int _PyCodec_Forget(
+       const char *encoding
+       );
+# 73 "/root/.pyenv/versions/3.11.7/include/python3.11/codecs.h"
+__attribute__ ((visibility ("default"))) int PyCodec_KnownEncoding(
+       const char *encoding
+       );
+# 87 "/root/.pyenv/versions/3.11.7/include/python3.11/codecs.h"
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_Encode(
+       PyObject *object,
+       const char *encoding,
+       const char *errors
+       );
+# 103 "/root/.pyenv/versions/3.11.7/include/python3.11/codecs.h"
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_Decode(
+       PyObject *object,
+       const char *encoding,
+       const char *errors
+       );
+# 123 "/root/.pyenv/versions/3.11.7/include/python3.11/codecs.h"
+__attribute__ ((visibility ("default"))) PyObject * _PyCodec_LookupTextEncoding(
+       const char *encoding,
+       const char *alternate_command
+       );
+
+__attribute__ ((visibility ("default"))) PyObject * _PyCodec_EncodeText(
+       PyObject *object,
+       const char *encoding,
+       const char *errors
+       );
+
+__attribute__ ((visibility ("default"))) PyObject * _PyCodec_DecodeText(
+       PyObject *object,
+       const char *encoding,
+       const char *errors
+       );
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyCodecInfo_GetIncrementalDecoder(
+       PyObject *codec_info,
+       const char *errors
+       );
+
+__attribute__ ((visibility ("default"))) PyObject * _PyCodecInfo_GetIncrementalEncoder(
+       PyObject *codec_info,
+       const char *errors
+       );
+# 166 "/root/.pyenv/versions/3.11.7/include/python3.11/codecs.h"
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_Encoder(
+       const char *encoding
+       );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_Decoder(
+       const char *encoding
+       );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_IncrementalEncoder(
+       const char *encoding,
+       const char *errors
+       );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_IncrementalDecoder(
+       const char *encoding,
+       const char *errors
+       );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_StreamReader(
+       const char *encoding,
+       PyObject *stream,
+       const char *errors
+       );
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_StreamWriter(
+       const char *encoding,
+       PyObject *stream,
+       const char *errors
+       );
+# 214 "/root/.pyenv/versions/3.11.7/include/python3.11/codecs.h"
+__attribute__ ((visibility ("default"))) int PyCodec_RegisterError(const char *name, PyObject *error);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_LookupError(const char *name);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_StrictErrors(PyObject *exc);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_IgnoreErrors(PyObject *exc);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_ReplaceErrors(PyObject *exc);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_XMLCharRefReplaceErrors(PyObject *exc);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_BackslashReplaceErrors(PyObject *exc);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyCodec_NameReplaceErrors(PyObject *exc);
+
+
+
+extern __attribute__ ((visibility ("default"))) const char * Py_hexdigits;
+# 88 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pyerrors.h" 1
+# 11 "/root/.pyenv/versions/3.11.7/include/python3.11/pyerrors.h"
+__attribute__ ((visibility ("default"))) void PyErr_SetNone(PyObject *);
+__attribute__ ((visibility ("default"))) void PyErr_SetObject(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) void PyErr_SetString(
+    PyObject *exception,
+    const char *string
+    );
+__attribute__ ((visibility ("default"))) PyObject * PyErr_Occurred(void);
+__attribute__ ((visibility ("default"))) void PyErr_Clear(void);
+__attribute__ ((visibility ("default"))) void PyErr_Fetch(PyObject **, PyObject **, PyObject **);
+__attribute__ ((visibility ("default"))) void PyErr_Restore(PyObject *, PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject* PyErr_GetHandledException(void);
+__attribute__ ((visibility ("default"))) void PyErr_SetHandledException(PyObject *);
+
+
+__attribute__ ((visibility ("default"))) void PyErr_GetExcInfo(PyObject **, PyObject **, PyObject **);
+__attribute__ ((visibility ("default"))) void PyErr_SetExcInfo(PyObject *, PyObject *, PyObject *);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void __attribute__((__noreturn__)) Py_FatalError(const char *message);
+
+
+__attribute__ ((visibility ("default"))) int PyErr_GivenExceptionMatches(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) int PyErr_ExceptionMatches(PyObject *);
+__attribute__ ((visibility ("default"))) void PyErr_NormalizeException(PyObject**, PyObject**, PyObject**);
+
+
+__attribute__ ((visibility ("default"))) int PyException_SetTraceback(PyObject *, PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyException_GetTraceback(PyObject *);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyException_GetCause(PyObject *);
+__attribute__ ((visibility ("default"))) void PyException_SetCause(PyObject *, PyObject *);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyException_GetContext(PyObject *);
+__attribute__ ((visibility ("default"))) void PyException_SetContext(PyObject *, PyObject *);
+# 63 "/root/.pyenv/versions/3.11.7/include/python3.11/pyerrors.h"
+__attribute__ ((visibility ("default"))) const char * PyExceptionClass_Name(PyObject *);
+# 72 "/root/.pyenv/versions/3.11.7/include/python3.11/pyerrors.h"
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_BaseException;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_Exception;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_BaseExceptionGroup;
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_StopAsyncIteration;
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_StopIteration;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_GeneratorExit;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ArithmeticError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_LookupError;
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_AssertionError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_AttributeError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_BufferError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_EOFError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_FloatingPointError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_OSError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ImportError;
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ModuleNotFoundError;
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_IndexError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_KeyError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_KeyboardInterrupt;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_MemoryError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_NameError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_OverflowError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_RuntimeError;
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_RecursionError;
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_NotImplementedError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_SyntaxError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_IndentationError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_TabError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ReferenceError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_SystemError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_SystemExit;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_TypeError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_UnboundLocalError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_UnicodeError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_UnicodeEncodeError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_UnicodeDecodeError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_UnicodeTranslateError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ValueError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ZeroDivisionError;
+
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_BlockingIOError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_BrokenPipeError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ChildProcessError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ConnectionError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ConnectionAbortedError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ConnectionRefusedError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ConnectionResetError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_FileExistsError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_FileNotFoundError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_InterruptedError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_IsADirectoryError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_NotADirectoryError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_PermissionError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ProcessLookupError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_TimeoutError;
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_EnvironmentError;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_IOError;
+
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_Warning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_UserWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_DeprecationWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_PendingDeprecationWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_SyntaxWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_RuntimeWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_FutureWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ImportWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_UnicodeWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_BytesWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_EncodingWarning;
+extern __attribute__ ((visibility ("default"))) PyObject * PyExc_ResourceWarning;
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyErr_BadArgument(void);
+__attribute__ ((visibility ("default"))) PyObject * PyErr_NoMemory(void);
+__attribute__ ((visibility ("default"))) PyObject * PyErr_SetFromErrno(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyErr_SetFromErrnoWithFilenameObject(
+    PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyErr_SetFromErrnoWithFilenameObjects(
+    PyObject *, PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyErr_SetFromErrnoWithFilename(
+    PyObject *exc,
+    const char *filename
+    );
+
+__attribute__ ((visibility ("default"))) PyObject * PyErr_Format(
+    PyObject *exception,
+    const char *format,
+    ...
+    );
+
+__attribute__ ((visibility ("default"))) PyObject * PyErr_FormatV(
+    PyObject *exception,
+    const char *format,
+    va_list vargs);
+# 209 "/root/.pyenv/versions/3.11.7/include/python3.11/pyerrors.h"
+__attribute__ ((visibility ("default"))) PyObject * PyErr_SetImportErrorSubclass(PyObject *, PyObject *,
+    PyObject *, PyObject *);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyErr_SetImportError(PyObject *, PyObject *,
+    PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) void PyErr_BadInternalCall(void);
+__attribute__ ((visibility ("default"))) void _PyErr_BadInternalCall(const char *filename, int lineno);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyErr_NewException(
+    const char *name, PyObject *base, PyObject *dict);
+__attribute__ ((visibility ("default"))) PyObject * PyErr_NewExceptionWithDoc(
+    const char *name, const char *doc, PyObject *base, PyObject *dict);
+__attribute__ ((visibility ("default"))) void PyErr_WriteUnraisable(PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) int PyErr_CheckSignals(void);
+__attribute__ ((visibility ("default"))) void PyErr_SetInterrupt(void);
+
+__attribute__ ((visibility ("default"))) int PyErr_SetInterruptEx(int signum);
+
+
+
+__attribute__ ((visibility ("default"))) void PyErr_SyntaxLocation(
+    const char *filename,
+    int lineno);
+__attribute__ ((visibility ("default"))) void PyErr_SyntaxLocationEx(
+    const char *filename,
+    int lineno,
+    int col_offset);
+__attribute__ ((visibility ("default"))) PyObject * PyErr_ProgramText(
+    const char *filename,
+    int lineno);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyUnicodeDecodeError_Create(
+    const char *encoding,
+    const char *object,
+    Py_ssize_t length,
+    Py_ssize_t start,
+    Py_ssize_t end,
+    const char *reason
+    );
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyUnicodeEncodeError_GetEncoding(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyUnicodeDecodeError_GetEncoding(PyObject *);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyUnicodeEncodeError_GetObject(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyUnicodeDecodeError_GetObject(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyUnicodeTranslateError_GetObject(PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicodeEncodeError_GetStart(PyObject *, Py_ssize_t *);
+__attribute__ ((visibility ("default"))) int PyUnicodeDecodeError_GetStart(PyObject *, Py_ssize_t *);
+__attribute__ ((visibility ("default"))) int PyUnicodeTranslateError_GetStart(PyObject *, Py_ssize_t *);
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicodeEncodeError_SetStart(PyObject *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) int PyUnicodeDecodeError_SetStart(PyObject *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) int PyUnicodeTranslateError_SetStart(PyObject *, Py_ssize_t);
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicodeEncodeError_GetEnd(PyObject *, Py_ssize_t *);
+__attribute__ ((visibility ("default"))) int PyUnicodeDecodeError_GetEnd(PyObject *, Py_ssize_t *);
+__attribute__ ((visibility ("default"))) int PyUnicodeTranslateError_GetEnd(PyObject *, Py_ssize_t *);
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicodeEncodeError_SetEnd(PyObject *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) int PyUnicodeDecodeError_SetEnd(PyObject *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) int PyUnicodeTranslateError_SetEnd(PyObject *, Py_ssize_t);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyUnicodeEncodeError_GetReason(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyUnicodeDecodeError_GetReason(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyUnicodeTranslateError_GetReason(PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) int PyUnicodeEncodeError_SetReason(
+    PyObject *exc,
+    const char *reason
+    );
+__attribute__ ((visibility ("default"))) int PyUnicodeDecodeError_SetReason(
+    PyObject *exc,
+    const char *reason
+    );
+__attribute__ ((visibility ("default"))) int PyUnicodeTranslateError_SetReason(
+    PyObject *exc,
+    const char *reason
+    );
+
+__attribute__ ((visibility ("default"))) int PyOS_snprintf(char *str, size_t size, const char *format, ...)
+                        __attribute__((format(printf, 3, 4)));
+__attribute__ ((visibility ("default"))) int PyOS_vsnprintf(char *str, size_t size, const char *format, va_list va)
+                        __attribute__((format(printf, 3, 0)));
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pyerrors.h" 1
+# 13 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pyerrors.h"
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+} PyBaseExceptionObject;
+
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+    PyObject *msg;
+    PyObject *excs;
+} PyBaseExceptionGroupObject;
+
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+    PyObject *msg;
+    PyObject *filename;
+    PyObject *lineno;
+    PyObject *offset;
+    PyObject *end_lineno;
+    PyObject *end_offset;
+    PyObject *text;
+    PyObject *print_file_and_line;
+} PySyntaxErrorObject;
+
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+    PyObject *msg;
+    PyObject *name;
+    PyObject *path;
+} PyImportErrorObject;
+
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+    PyObject *encoding;
+    PyObject *object;
+    Py_ssize_t start;
+    Py_ssize_t end;
+    PyObject *reason;
+} PyUnicodeErrorObject;
+
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+    PyObject *code;
+} PySystemExitObject;
+
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+    PyObject *myerrno;
+    PyObject *strerror;
+    PyObject *filename;
+    PyObject *filename2;
+
+
+
+    Py_ssize_t written;
+} PyOSErrorObject;
+
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+    PyObject *value;
+} PyStopIterationObject;
+
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+    PyObject *name;
+} PyNameErrorObject;
+
+typedef struct {
+    PyObject ob_base; PyObject *dict; PyObject *args; PyObject *notes; PyObject *traceback; PyObject *context; PyObject *cause; char suppress_context;
+    PyObject *obj;
+    PyObject *name;
+} PyAttributeErrorObject;
+
+
+typedef PyOSErrorObject PyEnvironmentErrorObject;
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void _PyErr_SetKeyError(PyObject *);
+__attribute__ ((visibility ("default"))) _PyErr_StackItem* _PyErr_GetTopmostException(PyThreadState *tstate);
+__attribute__ ((visibility ("default"))) PyObject* _PyErr_GetHandledException(PyThreadState *);
+__attribute__ ((visibility ("default"))) void _PyErr_SetHandledException(PyThreadState *, PyObject *);
+__attribute__ ((visibility ("default"))) void _PyErr_GetExcInfo(PyThreadState *, PyObject **, PyObject **, PyObject **);
+
+
+
+__attribute__ ((visibility ("default"))) void _PyErr_ChainExceptions(PyObject *, PyObject *, PyObject *);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyErr_FormatFromCause(
+    PyObject *exception,
+    const char *format,
+    ...
+    );
+# 126 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pyerrors.h"
+__attribute__ ((visibility ("default"))) PyObject * _PyErr_TrySetFromCause(
+    const char *prefix_format,
+    ...
+    );
+
+
+
+int PySignal_SetWakeupFd(int fd);
+__attribute__ ((visibility ("default"))) int _PyErr_CheckSignals(void);
+
+
+
+__attribute__ ((visibility ("default"))) void PyErr_SyntaxLocationObject(
+    PyObject *filename,
+    int lineno,
+    int col_offset);
+
+__attribute__ ((visibility ("default"))) void PyErr_RangedSyntaxLocationObject(
+    PyObject *filename,
+    int lineno,
+    int col_offset,
+    int end_lineno,
+    int end_col_offset);
+
+__attribute__ ((visibility ("default"))) PyObject * PyErr_ProgramTextObject(
+    PyObject *filename,
+    int lineno);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyErr_ProgramDecodedTextObject(
+    PyObject *filename,
+    int lineno,
+    const char* encoding);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyUnicodeTranslateError_Create(
+    PyObject *object,
+    Py_ssize_t start,
+    Py_ssize_t end,
+    const char *reason
+    );
+
+__attribute__ ((visibility ("default"))) void _PyErr_WriteUnraisableMsg(
+    const char *err_msg,
+    PyObject *obj);
+
+__attribute__ ((visibility ("default"))) void __attribute__((__noreturn__)) _Py_FatalErrorFunc(
+    const char *func,
+    const char *message);
+
+__attribute__ ((visibility ("default"))) void __attribute__((__noreturn__)) _Py_FatalErrorFormat(
+    const char *func,
+    const char *format,
+    ...);
+# 325 "/root/.pyenv/versions/3.11.7/include/python3.11/pyerrors.h" 2
+# 89 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pythread.h" 1
+
+
+
+typedef void *PyThread_type_lock;
+
+
+
+
+
+
+
+typedef enum PyLockStatus {
+    PY_LOCK_FAILURE = 0,
+    PY_LOCK_ACQUIRED = 1,
+    PY_LOCK_INTR
+} PyLockStatus;
+
+__attribute__ ((visibility ("default"))) void PyThread_init_thread(void);
+__attribute__ ((visibility ("default"))) unsigned long PyThread_start_new_thread(void (*)(void *), void *);
+__attribute__ ((visibility ("default"))) void __attribute__((__noreturn__)) PyThread_exit_thread(void);
+__attribute__ ((visibility ("default"))) unsigned long PyThread_get_thread_ident(void);
+
+
+
+__attribute__ ((visibility ("default"))) unsigned long PyThread_get_thread_native_id(void);
+
+
+__attribute__ ((visibility ("default"))) PyThread_type_lock PyThread_allocate_lock(void);
+__attribute__ ((visibility ("default"))) void PyThread_free_lock(PyThread_type_lock);
+__attribute__ ((visibility ("default"))) int PyThread_acquire_lock(PyThread_type_lock, int);
+# 75 "/root/.pyenv/versions/3.11.7/include/python3.11/pythread.h"
+__attribute__ ((visibility ("default"))) PyLockStatus PyThread_acquire_lock_timed(PyThread_type_lock,
+                                                     long long microseconds,
+                                                     int intr_flag);
+
+__attribute__ ((visibility ("default"))) void PyThread_release_lock(PyThread_type_lock);
+
+__attribute__ ((visibility ("default"))) size_t PyThread_get_stacksize(void);
+__attribute__ ((visibility ("default"))) int PyThread_set_stacksize(size_t);
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyThread_GetInfo(void);
+# 96 "/root/.pyenv/versions/3.11.7/include/python3.11/pythread.h"
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) int PyThread_create_key(void);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PyThread_delete_key(int key);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) int PyThread_set_key_value(int key,
+                                                          void *value);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void * PyThread_get_key_value(int key);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PyThread_delete_key_value(int key);
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PyThread_ReInitTLS(void);
+
+
+
+
+
+
+typedef struct _Py_tss_t Py_tss_t;
+
+__attribute__ ((visibility ("default"))) Py_tss_t * PyThread_tss_alloc(void);
+__attribute__ ((visibility ("default"))) void PyThread_tss_free(Py_tss_t *key);
+
+
+__attribute__ ((visibility ("default"))) int PyThread_tss_is_created(Py_tss_t *key);
+__attribute__ ((visibility ("default"))) int PyThread_tss_create(Py_tss_t *key);
+__attribute__ ((visibility ("default"))) void PyThread_tss_delete(Py_tss_t *key);
+__attribute__ ((visibility ("default"))) int PyThread_tss_set(Py_tss_t *key, void *value);
+__attribute__ ((visibility ("default"))) void * PyThread_tss_get(Py_tss_t *key);
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pythread.h" 1
+# 11 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pythread.h"
+__attribute__ ((visibility ("default"))) int _PyThread_at_fork_reinit(PyThread_type_lock *lock);
+
+
+
+
+# 1 "/usr/include/pthread.h" 1 3 4
+# 22 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+# 43 "/usr/include/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+
+
+
+extern int clone (int (*__fn) (void *__arg), void *__child_stack,
+    int __flags, void *__arg, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int unshare (int __flags) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getcpu (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int getcpu (unsigned int *, unsigned int *) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int setns (int __fd, int __nstype) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 130 "/usr/include/sched.h" 3 4
+extern int sched_setaffinity (__pid_t __pid, size_t __cpusetsize,
+         const cpu_set_t *__cpuset) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getaffinity (__pid_t __pid, size_t __cpusetsize,
+         cpu_set_t *__cpuset) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 23 "/usr/include/pthread.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+  , PTHREAD_MUTEX_FAST_NP = PTHREAD_MUTEX_TIMED_NP
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+
+
+
+
+extern int pthread_tryjoin_np (pthread_t __th, void **__thread_return) __attribute__ ((__nothrow__ , __leaf__));
+# 233 "/usr/include/pthread.h" 3 4
+extern int pthread_timedjoin_np (pthread_t __th, void **__thread_return,
+     const struct timespec *__abstime);
+# 243 "/usr/include/pthread.h" 3 4
+extern int pthread_clockjoin_np (pthread_t __th, void **__thread_return,
+                                 clockid_t __clockid,
+     const struct timespec *__abstime);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_attr_setaffinity_np (pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern int pthread_attr_getaffinity_np (const pthread_attr_t *__attr,
+     size_t __cpusetsize,
+     cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+extern int pthread_getattr_default_np (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_setsigmask_np (pthread_attr_t *__attr,
+           const __sigset_t *sigmask);
+
+
+
+
+extern int pthread_attr_getsigmask_np (const pthread_attr_t *__attr,
+           __sigset_t *sigmask);
+
+
+
+
+
+
+
+extern int pthread_setattr_default_np (const pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_getattr_np (pthread_t __th, pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int pthread_getname_np (pthread_t __target_thread, char *__buf,
+          size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int pthread_setname_np (pthread_t __target_thread, const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+extern int pthread_getconcurrency (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setconcurrency (int __level) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int pthread_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int pthread_yield (void) __asm__ ("" "sched_yield") __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__deprecated__ ("pthread_yield is deprecated, use sched_yield instead")))
+                                                      ;
+
+
+
+
+
+
+
+extern int pthread_setaffinity_np (pthread_t __th, size_t __cpusetsize,
+       const cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getaffinity_np (pthread_t __th, size_t __cpusetsize,
+       cpu_set_t *__cpuset)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 732 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel_defer (__pthread_unwind_buf_t *__buf)
+     ;
+# 745 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel_restore (__pthread_unwind_buf_t *__buf)
+  ;
+
+
+
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 766 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp_cancel (struct __cancel_jmp_buf_tag __env[1], int __savemask) __asm__ ("" "__sigsetjmp") __attribute__ ((__nothrow__))
+
+
+                     __attribute__ ((__returns_twice__));
+# 781 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 817 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_clocklock (pthread_mutex_t *__restrict __mutex,
+        clockid_t __clockid,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_consistent_np (pthread_mutex_t *) __asm__ ("" "pthread_mutex_consistent") __attribute__ ((__nothrow__ , __leaf__))
+                                __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutex_consistent_np is deprecated, use pthread_mutex_consistent")))
+                                                                         ;
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_getrobust_np (pthread_mutexattr_t *, int *) __asm__ ("" "pthread_mutexattr_getrobust") __attribute__ ((__nothrow__ , __leaf__))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutexattr_getrobust_np is deprecated, use pthread_mutexattr_getrobust")))
+                                                                               ;
+
+
+
+
+
+
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_setrobust_np (pthread_mutexattr_t *, int) __asm__ ("" "pthread_mutexattr_setrobust") __attribute__ ((__nothrow__ , __leaf__))
+
+                                   __attribute__ ((__nonnull__ (1)))
+  __attribute__ ((__deprecated__ ("pthread_mutexattr_setrobust_np is deprecated, use pthread_mutexattr_setrobust")))
+                                                                               ;
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1004 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockrdlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1051 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_clockwrlock (pthread_rwlock_t *__restrict __rwlock,
+           clockid_t __clockid,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1171 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_clockwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       __clockid_t __clock_id,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 4)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__access__ (__none__, 2)));
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) pthread_equal (pthread_t __thread1, pthread_t __thread2)
+{
+  return __thread1 == __thread2;
+}
+
+
+
+# 17 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pythread.h" 2
+# 34 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pythread.h"
+
+# 34 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pythread.h"
+struct _Py_tss_t {
+    int _is_initialized;
+    pthread_key_t _key;
+};
+# 127 "/root/.pyenv/versions/3.11.7/include/python3.11/pythread.h" 2
+# 90 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/context.h" 1
+
+
+
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyContext_Type;
+typedef struct _pycontextobject PyContext;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyContextVar_Type;
+typedef struct _pycontextvarobject PyContextVar;
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyContextToken_Type;
+typedef struct _pycontexttokenobject PyContextToken;
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyContext_New(void);
+__attribute__ ((visibility ("default"))) PyObject * PyContext_Copy(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyContext_CopyCurrent(void);
+
+__attribute__ ((visibility ("default"))) int PyContext_Enter(PyObject *);
+__attribute__ ((visibility ("default"))) int PyContext_Exit(PyObject *);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyContextVar_New(
+    const char *name, PyObject *default_value);
+# 54 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/context.h"
+__attribute__ ((visibility ("default"))) int PyContextVar_Get(
+    PyObject *var, PyObject *default_value, PyObject **value);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyContextVar_Set(PyObject *var, PyObject *value);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyContextVar_Reset(PyObject *var, PyObject *token);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyContext_NewHamtForTests(void);
+# 91 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/modsupport.h" 1
+# 26 "/root/.pyenv/versions/3.11.7/include/python3.11/modsupport.h"
+__attribute__ ((visibility ("default"))) int PyArg_Parse(PyObject *, const char *, ...);
+__attribute__ ((visibility ("default"))) int PyArg_ParseTuple(PyObject *, const char *, ...);
+__attribute__ ((visibility ("default"))) int PyArg_ParseTupleAndKeywords(PyObject *, PyObject *,
+                                                  const char *, char **, ...);
+__attribute__ ((visibility ("default"))) int PyArg_VaParse(PyObject *, const char *, va_list);
+__attribute__ ((visibility ("default"))) int PyArg_VaParseTupleAndKeywords(PyObject *, PyObject *,
+                                                  const char *, char **, va_list);
+
+__attribute__ ((visibility ("default"))) int PyArg_ValidateKeywordArguments(PyObject *);
+__attribute__ ((visibility ("default"))) int PyArg_UnpackTuple(PyObject *, const char *, Py_ssize_t, Py_ssize_t, ...);
+__attribute__ ((visibility ("default"))) PyObject * Py_BuildValue(const char *, ...);
+__attribute__ ((visibility ("default"))) PyObject * _Py_BuildValue_SizeT(const char *, ...);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * Py_VaBuildValue(const char *, va_list);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyModule_AddObjectRef(PyObject *mod, const char *name, PyObject *value);
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyModule_AddObject(PyObject *mod, const char *, PyObject *value);
+
+__attribute__ ((visibility ("default"))) int PyModule_AddIntConstant(PyObject *, const char *, long);
+__attribute__ ((visibility ("default"))) int PyModule_AddStringConstant(PyObject *, const char *, const char *);
+
+
+
+__attribute__ ((visibility ("default"))) int PyModule_AddType(PyObject *module, PyTypeObject *type);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyModule_SetDocString(PyObject *, const char *);
+__attribute__ ((visibility ("default"))) int PyModule_AddFunctions(PyObject *, PyMethodDef *);
+__attribute__ ((visibility ("default"))) int PyModule_ExecDef(PyObject *module, PyModuleDef *def);
+# 135 "/root/.pyenv/versions/3.11.7/include/python3.11/modsupport.h"
+__attribute__ ((visibility ("default"))) PyObject * PyModule_Create2(PyModuleDef*, int apiver);
+# 147 "/root/.pyenv/versions/3.11.7/include/python3.11/modsupport.h"
+__attribute__ ((visibility ("default"))) PyObject * PyModule_FromDefAndSpec2(PyModuleDef *def,
+                                                PyObject *spec,
+                                                int module_api_version);
+# 163 "/root/.pyenv/versions/3.11.7/include/python3.11/modsupport.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/modsupport.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/modsupport.h"
+__attribute__ ((visibility ("default"))) PyObject * _Py_VaBuildValue_SizeT(const char *, va_list);
+__attribute__ ((visibility ("default"))) PyObject ** _Py_VaBuildStack_SizeT(
+    PyObject **small_stack,
+    Py_ssize_t small_stack_len,
+    const char *format,
+    va_list va,
+    Py_ssize_t *p_nargs);
+
+
+__attribute__ ((visibility ("default"))) int _PyArg_UnpackStack(
+    PyObject *const *args,
+    Py_ssize_t nargs,
+    const char *name,
+    Py_ssize_t min,
+    Py_ssize_t max,
+    ...);
+
+__attribute__ ((visibility ("default"))) int _PyArg_NoKeywords(const char *funcname, PyObject *kwargs);
+__attribute__ ((visibility ("default"))) int _PyArg_NoKwnames(const char *funcname, PyObject *kwnames);
+__attribute__ ((visibility ("default"))) int _PyArg_NoPositional(const char *funcname, PyObject *args);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) void _PyArg_BadArgument(const char *, const char *, const char *, PyObject *);
+__attribute__ ((visibility ("default"))) int _PyArg_CheckPositional(const char *, Py_ssize_t,
+                                       Py_ssize_t, Py_ssize_t);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject ** _Py_VaBuildStack(
+    PyObject **small_stack,
+    Py_ssize_t small_stack_len,
+    const char *format,
+    va_list va,
+    Py_ssize_t *p_nargs);
+
+typedef struct _PyArg_Parser {
+    const char *format;
+    const char * const *keywords;
+    const char *fname;
+    const char *custom_msg;
+    int pos;
+    int min;
+    int max;
+    PyObject *kwtuple;
+    struct _PyArg_Parser *next;
+} _PyArg_Parser;
+# 70 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/modsupport.h"
+__attribute__ ((visibility ("default"))) int _PyArg_ParseTupleAndKeywordsFast(PyObject *, PyObject *,
+                                                 struct _PyArg_Parser *, ...);
+__attribute__ ((visibility ("default"))) int _PyArg_ParseStack(
+    PyObject *const *args,
+    Py_ssize_t nargs,
+    const char *format,
+    ...);
+__attribute__ ((visibility ("default"))) int _PyArg_ParseStackAndKeywords(
+    PyObject *const *args,
+    Py_ssize_t nargs,
+    PyObject *kwnames,
+    struct _PyArg_Parser *,
+    ...);
+__attribute__ ((visibility ("default"))) int _PyArg_VaParseTupleAndKeywordsFast(PyObject *, PyObject *,
+                                                   struct _PyArg_Parser *, va_list);
+__attribute__ ((visibility ("default"))) PyObject * const * _PyArg_UnpackKeywords(
+        PyObject *const *args, Py_ssize_t nargs,
+        PyObject *kwargs, PyObject *kwnames,
+        struct _PyArg_Parser *parser,
+        int minpos, int maxpos, int minkw,
+        PyObject **buf);
+
+__attribute__ ((visibility ("default"))) PyObject * const * _PyArg_UnpackKeywordsWithVararg(
+        PyObject *const *args, Py_ssize_t nargs,
+        PyObject *kwargs, PyObject *kwnames,
+        struct _PyArg_Parser *parser,
+        int minpos, int maxpos, int minkw,
+        int vararg, PyObject **buf);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyModule_CreateInitialized(PyModuleDef*, int apiver);
+__attribute__ ((visibility ("default"))) int _PyModule_Add(PyObject *, const char *, PyObject *);
+
+extern __attribute__ ((visibility ("default"))) const char * _Py_PackageContext;
+# 164 "/root/.pyenv/versions/3.11.7/include/python3.11/modsupport.h" 2
+# 92 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/compile.h" 1
+# 18 "/root/.pyenv/versions/3.11.7/include/python3.11/compile.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/compile.h" 1
+# 26 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/compile.h"
+typedef struct {
+    int cf_flags;
+    int cf_feature_version;
+} PyCompilerFlags;
+
+
+
+
+
+
+typedef struct {
+    int ff_features;
+    int ff_lineno;
+} PyFutureFeatures;
+# 53 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/compile.h"
+__attribute__ ((visibility ("default"))) int PyCompile_OpcodeStackEffect(int opcode, int oparg);
+__attribute__ ((visibility ("default"))) int PyCompile_OpcodeStackEffectWithJump(int opcode, int oparg, int jump);
+# 19 "/root/.pyenv/versions/3.11.7/include/python3.11/compile.h" 2
+# 93 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pythonrun.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/pythonrun.h"
+__attribute__ ((visibility ("default"))) PyObject * Py_CompileString(const char *, const char *, int);
+
+__attribute__ ((visibility ("default"))) void PyErr_Print(void);
+__attribute__ ((visibility ("default"))) void PyErr_PrintEx(int);
+__attribute__ ((visibility ("default"))) void PyErr_Display(PyObject *, PyObject *, PyObject *);
+
+
+
+extern __attribute__ ((visibility ("default"))) int (*PyOS_InputHook)(void);
+# 38 "/root/.pyenv/versions/3.11.7/include/python3.11/pythonrun.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pythonrun.h" 1
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyRun_SimpleStringFlags(const char *, PyCompilerFlags *);
+__attribute__ ((visibility ("default"))) int _PyRun_SimpleFileObject(
+    FILE *fp,
+    PyObject *filename,
+    int closeit,
+    PyCompilerFlags *flags);
+__attribute__ ((visibility ("default"))) int PyRun_AnyFileExFlags(
+    FILE *fp,
+    const char *filename,
+    int closeit,
+    PyCompilerFlags *flags);
+__attribute__ ((visibility ("default"))) int _PyRun_AnyFileObject(
+    FILE *fp,
+    PyObject *filename,
+    int closeit,
+    PyCompilerFlags *flags);
+__attribute__ ((visibility ("default"))) int PyRun_SimpleFileExFlags(
+    FILE *fp,
+    const char *filename,
+    int closeit,
+    PyCompilerFlags *flags);
+__attribute__ ((visibility ("default"))) int PyRun_InteractiveOneFlags(
+    FILE *fp,
+    const char *filename,
+    PyCompilerFlags *flags);
+__attribute__ ((visibility ("default"))) int PyRun_InteractiveOneObject(
+    FILE *fp,
+    PyObject *filename,
+    PyCompilerFlags *flags);
+__attribute__ ((visibility ("default"))) int PyRun_InteractiveLoopFlags(
+    FILE *fp,
+    const char *filename,
+    PyCompilerFlags *flags);
+__attribute__ ((visibility ("default"))) int _PyRun_InteractiveLoopObject(
+    FILE *fp,
+    PyObject *filename,
+    PyCompilerFlags *flags);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyRun_StringFlags(const char *, int, PyObject *,
+                                         PyObject *, PyCompilerFlags *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyRun_FileExFlags(
+    FILE *fp,
+    const char *filename,
+    int start,
+    PyObject *globals,
+    PyObject *locals,
+    int closeit,
+    PyCompilerFlags *flags);
+
+
+__attribute__ ((visibility ("default"))) PyObject * Py_CompileStringExFlags(
+    const char *str,
+    const char *filename,
+    int start,
+    PyCompilerFlags *flags,
+    int optimize);
+__attribute__ ((visibility ("default"))) PyObject * Py_CompileStringObject(
+    const char *str,
+    PyObject *filename, int start,
+    PyCompilerFlags *flags,
+    int optimize);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) const char * _Py_SourceAsString(
+    PyObject *cmd,
+    const char *funcname,
+    const char *what,
+    PyCompilerFlags *cf,
+    PyObject **cmd_copy);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyRun_String(const char *str, int s, PyObject *g, PyObject *l);
+__attribute__ ((visibility ("default"))) int PyRun_AnyFile(FILE *fp, const char *name);
+__attribute__ ((visibility ("default"))) int PyRun_AnyFileEx(FILE *fp, const char *name, int closeit);
+__attribute__ ((visibility ("default"))) int PyRun_AnyFileFlags(FILE *, const char *, PyCompilerFlags *);
+__attribute__ ((visibility ("default"))) int PyRun_SimpleString(const char *s);
+__attribute__ ((visibility ("default"))) int PyRun_SimpleFile(FILE *f, const char *p);
+__attribute__ ((visibility ("default"))) int PyRun_SimpleFileEx(FILE *f, const char *p, int c);
+__attribute__ ((visibility ("default"))) int PyRun_InteractiveOne(FILE *f, const char *p);
+__attribute__ ((visibility ("default"))) int PyRun_InteractiveLoop(FILE *f, const char *p);
+__attribute__ ((visibility ("default"))) PyObject * PyRun_File(FILE *fp, const char *p, int s, PyObject *g, PyObject *l);
+__attribute__ ((visibility ("default"))) PyObject * PyRun_FileEx(FILE *fp, const char *p, int s, PyObject *g, PyObject *l, int c);
+__attribute__ ((visibility ("default"))) PyObject * PyRun_FileFlags(FILE *fp, const char *p, int s, PyObject *g, PyObject *l, PyCompilerFlags *flags);
+# 119 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pythonrun.h"
+__attribute__ ((visibility ("default"))) char * PyOS_Readline(FILE *, FILE *, const char *);
+extern __attribute__ ((visibility ("default"))) PyThreadState* _PyOS_ReadlineTState;
+extern __attribute__ ((visibility ("default"))) char *(*PyOS_ReadlineFunctionPointer)(FILE *, FILE *, const char *);
+# 39 "/root/.pyenv/versions/3.11.7/include/python3.11/pythonrun.h" 2
+# 94 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pylifecycle.h" 1
+# 12 "/root/.pyenv/versions/3.11.7/include/python3.11/pylifecycle.h"
+__attribute__ ((visibility ("default"))) void Py_Initialize(void);
+__attribute__ ((visibility ("default"))) void Py_InitializeEx(int);
+__attribute__ ((visibility ("default"))) void Py_Finalize(void);
+
+__attribute__ ((visibility ("default"))) int Py_FinalizeEx(void);
+
+__attribute__ ((visibility ("default"))) int Py_IsInitialized(void);
+
+
+__attribute__ ((visibility ("default"))) PyThreadState * Py_NewInterpreter(void);
+__attribute__ ((visibility ("default"))) void Py_EndInterpreter(PyThreadState *);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int Py_AtExit(void (*func)(void));
+
+__attribute__ ((visibility ("default"))) void __attribute__((__noreturn__)) Py_Exit(int);
+
+
+__attribute__ ((visibility ("default"))) int Py_Main(int argc, wchar_t **argv);
+__attribute__ ((visibility ("default"))) int Py_BytesMain(int argc, char **argv);
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void Py_SetProgramName(const wchar_t *);
+__attribute__ ((visibility ("default"))) wchar_t * Py_GetProgramName(void);
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void Py_SetPythonHome(const wchar_t *);
+__attribute__ ((visibility ("default"))) wchar_t * Py_GetPythonHome(void);
+
+__attribute__ ((visibility ("default"))) wchar_t * Py_GetProgramFullPath(void);
+
+__attribute__ ((visibility ("default"))) wchar_t * Py_GetPrefix(void);
+__attribute__ ((visibility ("default"))) wchar_t * Py_GetExecPrefix(void);
+__attribute__ ((visibility ("default"))) wchar_t * Py_GetPath(void);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void Py_SetPath(const wchar_t *);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) const char * Py_GetVersion(void);
+__attribute__ ((visibility ("default"))) const char * Py_GetPlatform(void);
+__attribute__ ((visibility ("default"))) const char * Py_GetCopyright(void);
+__attribute__ ((visibility ("default"))) const char * Py_GetCompiler(void);
+__attribute__ ((visibility ("default"))) const char * Py_GetBuildInfo(void);
+
+
+typedef void (*PyOS_sighandler_t)(int);
+__attribute__ ((visibility ("default"))) PyOS_sighandler_t PyOS_getsig(int);
+__attribute__ ((visibility ("default"))) PyOS_sighandler_t PyOS_setsig(int, PyOS_sighandler_t);
+
+
+extern __attribute__ ((visibility ("default"))) const unsigned long Py_Version;
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pylifecycle.h" 1
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int Py_FrozenMain(int argc, char **argv);
+
+
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) int Py_SetStandardStreamEncoding(
+    const char *encoding,
+    const char *errors);
+
+
+
+__attribute__ ((visibility ("default"))) PyStatus Py_PreInitialize(
+    const PyPreConfig *src_config);
+__attribute__ ((visibility ("default"))) PyStatus Py_PreInitializeFromBytesArgs(
+    const PyPreConfig *src_config,
+    Py_ssize_t argc,
+    char **argv);
+__attribute__ ((visibility ("default"))) PyStatus Py_PreInitializeFromArgs(
+    const PyPreConfig *src_config,
+    Py_ssize_t argc,
+    wchar_t **argv);
+
+__attribute__ ((visibility ("default"))) int _Py_IsCoreInitialized(void);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyStatus Py_InitializeFromConfig(
+    const PyConfig *config);
+__attribute__ ((visibility ("default"))) PyStatus _Py_InitializeMain(void);
+
+__attribute__ ((visibility ("default"))) int Py_RunMain(void);
+
+
+__attribute__ ((visibility ("default"))) void __attribute__((__noreturn__)) Py_ExitStatusException(PyStatus err);
+
+
+__attribute__ ((visibility ("default"))) void _Py_RestoreSignals(void);
+
+__attribute__ ((visibility ("default"))) int Py_FdIsInteractive(FILE *, const char *);
+__attribute__ ((visibility ("default"))) int _Py_FdIsInteractive(FILE *fp, PyObject *filename);
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void _Py_SetProgramFullPath(const wchar_t *);
+
+__attribute__ ((visibility ("default"))) const char * _Py_gitidentifier(void);
+__attribute__ ((visibility ("default"))) const char * _Py_gitversion(void);
+
+__attribute__ ((visibility ("default"))) int _Py_IsFinalizing(void);
+
+
+__attribute__ ((visibility ("default"))) int _PyOS_URandom(void *buffer, Py_ssize_t size);
+__attribute__ ((visibility ("default"))) int _PyOS_URandomNonblock(void *buffer, Py_ssize_t size);
+
+
+__attribute__ ((visibility ("default"))) int _Py_CoerceLegacyLocale(int warn);
+__attribute__ ((visibility ("default"))) int _Py_LegacyLocaleDetected(int warn);
+__attribute__ ((visibility ("default"))) char * _Py_SetLocaleFromEnv(int category);
+
+__attribute__ ((visibility ("default"))) PyThreadState * _Py_NewInterpreter(int isolated_subinterpreter);
+# 72 "/root/.pyenv/versions/3.11.7/include/python3.11/pylifecycle.h" 2
+# 95 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/ceval.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/ceval.h"
+__attribute__ ((visibility ("default"))) PyObject * PyEval_EvalCode(PyObject *, PyObject *, PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyEval_EvalCodeEx(PyObject *co,
+                                         PyObject *globals,
+                                         PyObject *locals,
+                                         PyObject *const *args, int argc,
+                                         PyObject *const *kwds, int kwdc,
+                                         PyObject *const *defs, int defc,
+                                         PyObject *kwdefs, PyObject *closure);
+# 27 "/root/.pyenv/versions/3.11.7/include/python3.11/ceval.h"
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) PyObject * PyEval_CallObjectWithKeywords(
+    PyObject *callable,
+    PyObject *args,
+    PyObject *kwargs);
+
+
+
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) PyObject * PyEval_CallFunction(
+    PyObject *callable, const char *format, ...);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) PyObject * PyEval_CallMethod(
+    PyObject *obj, const char *name, const char *format, ...);
+
+__attribute__ ((visibility ("default"))) PyObject * PyEval_GetBuiltins(void);
+__attribute__ ((visibility ("default"))) PyObject * PyEval_GetGlobals(void);
+__attribute__ ((visibility ("default"))) PyObject * PyEval_GetLocals(void);
+__attribute__ ((visibility ("default"))) PyFrameObject * PyEval_GetFrame(void);
+
+__attribute__ ((visibility ("default"))) int Py_AddPendingCall(int (*func)(void *), void *arg);
+__attribute__ ((visibility ("default"))) int Py_MakePendingCalls(void);
+# 74 "/root/.pyenv/versions/3.11.7/include/python3.11/ceval.h"
+__attribute__ ((visibility ("default"))) void Py_SetRecursionLimit(int);
+__attribute__ ((visibility ("default"))) int Py_GetRecursionLimit(void);
+
+__attribute__ ((visibility ("default"))) int Py_EnterRecursiveCall(const char *where);
+__attribute__ ((visibility ("default"))) void Py_LeaveRecursiveCall(void);
+
+__attribute__ ((visibility ("default"))) const char * PyEval_GetFuncName(PyObject *);
+__attribute__ ((visibility ("default"))) const char * PyEval_GetFuncDesc(PyObject *);
+
+__attribute__ ((visibility ("default"))) PyObject * PyEval_EvalFrame(PyFrameObject *);
+__attribute__ ((visibility ("default"))) PyObject * PyEval_EvalFrameEx(PyFrameObject *f, int exc);
+# 128 "/root/.pyenv/versions/3.11.7/include/python3.11/ceval.h"
+__attribute__ ((visibility ("default"))) PyThreadState * PyEval_SaveThread(void);
+__attribute__ ((visibility ("default"))) void PyEval_RestoreThread(PyThreadState *);
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) int PyEval_ThreadsInitialized(void);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PyEval_InitThreads(void);
+
+
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PyEval_AcquireLock(void);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PyEval_ReleaseLock(void);
+__attribute__ ((visibility ("default"))) void PyEval_AcquireThread(PyThreadState *tstate);
+__attribute__ ((visibility ("default"))) void PyEval_ReleaseThread(PyThreadState *tstate);
+# 161 "/root/.pyenv/versions/3.11.7/include/python3.11/ceval.h"
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/ceval.h" 1
+
+
+
+
+__attribute__ ((visibility ("default"))) void PyEval_SetProfile(Py_tracefunc, PyObject *);
+extern __attribute__ ((visibility ("default"))) int _PyEval_SetProfile(PyThreadState *tstate, Py_tracefunc func, PyObject *arg);
+__attribute__ ((visibility ("default"))) void PyEval_SetTrace(Py_tracefunc, PyObject *);
+__attribute__ ((visibility ("default"))) int _PyEval_SetTrace(PyThreadState *tstate, Py_tracefunc func, PyObject *arg);
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyEval_GetBuiltin(PyObject *);
+__attribute__ ((visibility ("default"))) PyObject * _PyEval_GetBuiltinId(_Py_Identifier *);
+
+
+
+__attribute__ ((visibility ("default"))) int PyEval_MergeCompilerFlags(PyCompilerFlags *cf);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyEval_EvalFrameDefault(PyThreadState *tstate, struct _PyInterpreterFrame *f, int exc);
+
+__attribute__ ((visibility ("default"))) void _PyEval_SetSwitchInterval(unsigned long microseconds);
+__attribute__ ((visibility ("default"))) unsigned long _PyEval_GetSwitchInterval(void);
+
+__attribute__ ((visibility ("default"))) Py_ssize_t _PyEval_RequestCodeExtraIndex(freefunc);
+
+__attribute__ ((visibility ("default"))) int _PyEval_SliceIndex(PyObject *, Py_ssize_t *);
+__attribute__ ((visibility ("default"))) int _PyEval_SliceIndexNotNone(PyObject *, Py_ssize_t *);
+# 162 "/root/.pyenv/versions/3.11.7/include/python3.11/ceval.h" 2
+# 96 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/sysmodule.h" 1
+# 10 "/root/.pyenv/versions/3.11.7/include/python3.11/sysmodule.h"
+__attribute__ ((visibility ("default"))) PyObject * PySys_GetObject(const char *);
+__attribute__ ((visibility ("default"))) int PySys_SetObject(const char *, PyObject *);
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PySys_SetArgv(int, wchar_t **);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PySys_SetArgvEx(int, wchar_t **, int);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PySys_SetPath(const wchar_t *);
+
+__attribute__ ((visibility ("default"))) void PySys_WriteStdout(const char *format, ...)
+                 __attribute__((format(printf, 1, 2)));
+__attribute__ ((visibility ("default"))) void PySys_WriteStderr(const char *format, ...)
+                 __attribute__((format(printf, 1, 2)));
+__attribute__ ((visibility ("default"))) void PySys_FormatStdout(const char *format, ...);
+__attribute__ ((visibility ("default"))) void PySys_FormatStderr(const char *format, ...);
+
+__attribute__ ((visibility ("default"))) void PySys_ResetWarnOptions(void);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PySys_AddWarnOption(const wchar_t *);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PySys_AddWarnOptionUnicode(PyObject *);
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) int PySys_HasWarnOptions(void);
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PySys_AddXOption(const wchar_t *);
+__attribute__ ((visibility ("default"))) PyObject * PySys_GetXOptions(void);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/sysmodule.h" 1
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PySys_GetAttr(PyThreadState *tstate,
+                                      PyObject *name);
+
+__attribute__ ((visibility ("default"))) size_t _PySys_GetSizeOf(PyObject *);
+
+typedef int(*Py_AuditHookFunction)(const char *, PyObject *, void *);
+
+__attribute__ ((visibility ("default"))) int PySys_Audit(
+    const char *event,
+    const char *argFormat,
+    ...);
+__attribute__ ((visibility ("default"))) int PySys_AddAuditHook(Py_AuditHookFunction, void*);
+# 35 "/root/.pyenv/versions/3.11.7/include/python3.11/sysmodule.h" 2
+# 97 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/osmodule.h" 1
+# 11 "/root/.pyenv/versions/3.11.7/include/python3.11/osmodule.h"
+__attribute__ ((visibility ("default"))) PyObject * PyOS_FSPath(PyObject *path);
+# 98 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/intrcheck.h" 1
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyOS_InterruptOccurred(void);
+
+
+__attribute__ ((visibility ("default"))) void PyOS_BeforeFork(void);
+__attribute__ ((visibility ("default"))) void PyOS_AfterFork_Parent(void);
+__attribute__ ((visibility ("default"))) void PyOS_AfterFork_Child(void);
+
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) void PyOS_AfterFork(void);
+
+
+__attribute__ ((visibility ("default"))) int _PyOS_IsMainThread(void);
+# 99 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/import.h" 1
+# 9 "/root/.pyenv/versions/3.11.7/include/python3.11/import.h"
+__attribute__ ((visibility ("default"))) long PyImport_GetMagicNumber(void);
+__attribute__ ((visibility ("default"))) const char * PyImport_GetMagicTag(void);
+__attribute__ ((visibility ("default"))) PyObject * PyImport_ExecCodeModule(
+    const char *name,
+    PyObject *co
+    );
+__attribute__ ((visibility ("default"))) PyObject * PyImport_ExecCodeModuleEx(
+    const char *name,
+    PyObject *co,
+    const char *pathname
+    );
+__attribute__ ((visibility ("default"))) PyObject * PyImport_ExecCodeModuleWithPathnames(
+    const char *name,
+    PyObject *co,
+    const char *pathname,
+    const char *cpathname
+    );
+
+__attribute__ ((visibility ("default"))) PyObject * PyImport_ExecCodeModuleObject(
+    PyObject *name,
+    PyObject *co,
+    PyObject *pathname,
+    PyObject *cpathname
+    );
+
+__attribute__ ((visibility ("default"))) PyObject * PyImport_GetModuleDict(void);
+
+__attribute__ ((visibility ("default"))) PyObject * PyImport_GetModule(PyObject *name);
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyImport_AddModuleObject(
+    PyObject *name
+    );
+
+__attribute__ ((visibility ("default"))) PyObject * PyImport_AddModule(
+    const char *name
+    );
+__attribute__ ((visibility ("default"))) PyObject * PyImport_ImportModule(
+    const char *name
+    );
+__attribute__ ((visibility ("default"))) PyObject * PyImport_ImportModuleNoBlock(
+    const char *name
+    );
+__attribute__ ((visibility ("default"))) PyObject * PyImport_ImportModuleLevel(
+    const char *name,
+    PyObject *globals,
+    PyObject *locals,
+    PyObject *fromlist,
+    int level
+    );
+
+__attribute__ ((visibility ("default"))) PyObject * PyImport_ImportModuleLevelObject(
+    PyObject *name,
+    PyObject *globals,
+    PyObject *locals,
+    PyObject *fromlist,
+    int level
+    );
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyImport_GetImporter(PyObject *path);
+__attribute__ ((visibility ("default"))) PyObject * PyImport_Import(PyObject *name);
+__attribute__ ((visibility ("default"))) PyObject * PyImport_ReloadModule(PyObject *m);
+
+__attribute__ ((visibility ("default"))) int PyImport_ImportFrozenModuleObject(
+    PyObject *name
+    );
+
+__attribute__ ((visibility ("default"))) int PyImport_ImportFrozenModule(
+    const char *name
+    );
+
+__attribute__ ((visibility ("default"))) int PyImport_AppendInittab(
+    const char *name,
+    PyObject* (*initfunc)(void)
+    );
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/import.h" 1
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject* PyInit__imp(void);
+
+__attribute__ ((visibility ("default"))) int _PyImport_IsInitialized(PyInterpreterState *);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyImport_GetModuleId(_Py_Identifier *name);
+__attribute__ ((visibility ("default"))) int _PyImport_SetModule(PyObject *name, PyObject *module);
+__attribute__ ((visibility ("default"))) int _PyImport_SetModuleString(const char *name, PyObject* module);
+
+__attribute__ ((visibility ("default"))) void _PyImport_AcquireLock(void);
+__attribute__ ((visibility ("default"))) int _PyImport_ReleaseLock(void);
+
+__attribute__ ((visibility ("default"))) int _PyImport_FixupBuiltin(
+    PyObject *mod,
+    const char *name,
+    PyObject *modules
+    );
+__attribute__ ((visibility ("default"))) int _PyImport_FixupExtensionObject(PyObject*, PyObject *,
+                                               PyObject *, PyObject *);
+
+struct _inittab {
+    const char *name;
+    PyObject* (*initfunc)(void);
+};
+extern __attribute__ ((visibility ("default"))) struct _inittab * PyImport_Inittab;
+__attribute__ ((visibility ("default"))) int PyImport_ExtendInittab(struct _inittab *newtab);
+
+struct _frozen {
+    const char *name;
+    const unsigned char *code;
+    int size;
+    int is_package;
+    PyObject *(*get_code)(void);
+};
+
+
+
+
+extern __attribute__ ((visibility ("default"))) const struct _frozen * PyImport_FrozenModules;
+
+extern __attribute__ ((visibility ("default"))) PyObject * _PyImport_GetModuleAttr(PyObject *, PyObject *);
+extern __attribute__ ((visibility ("default"))) PyObject * _PyImport_GetModuleAttrString(const char *, const char *);
+# 92 "/root/.pyenv/versions/3.11.7/include/python3.11/import.h" 2
+# 100 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h" 1
+# 146 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_CallNoArgs(PyObject *func);
+# 158 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_Call(PyObject *callable,
+                                     PyObject *args, PyObject *kwargs);
+# 169 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_CallObject(PyObject *callable,
+                                           PyObject *args);
+# 182 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_CallFunction(PyObject *callable,
+                                             const char *format, ...);
+# 194 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_CallMethod(PyObject *obj,
+                                           const char *name,
+                                           const char *format, ...);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_CallFunction_SizeT(PyObject *callable,
+                                                    const char *format,
+                                                    ...);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_CallMethod_SizeT(PyObject *obj,
+                                                  const char *name,
+                                                  const char *format,
+                                                  ...);
+# 215 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_CallFunctionObjArgs(PyObject *callable,
+                                                    ...);
+# 226 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_CallMethodObjArgs(
+    PyObject *obj,
+    PyObject *name,
+    ...);
+# 268 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_Type(PyObject *o);
+# 277 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) Py_ssize_t PyObject_Size(PyObject *o);
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyObject_Length(PyObject *o);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_GetItem(PyObject *o, PyObject *key);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyObject_SetItem(PyObject *o, PyObject *key, PyObject *v);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyObject_DelItemString(PyObject *o, const char *key);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyObject_DelItem(PyObject *o, PyObject *key);
+# 325 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__((__deprecated__))
+__attribute__ ((visibility ("default"))) int PyObject_AsCharBuffer(PyObject *obj,
+                                      const char **buffer,
+                                      Py_ssize_t *buffer_len);
+
+
+
+
+
+__attribute__((__deprecated__)) __attribute__ ((visibility ("default"))) int PyObject_CheckReadBuffer(PyObject *obj);
+
+
+
+
+
+
+
+__attribute__((__deprecated__))
+__attribute__ ((visibility ("default"))) int PyObject_AsReadBuffer(PyObject *obj,
+                                      const void **buffer,
+                                      Py_ssize_t *buffer_len);
+
+
+
+
+
+
+
+__attribute__((__deprecated__))
+__attribute__ ((visibility ("default"))) int PyObject_AsWriteBuffer(PyObject *obj,
+                                       void **buffer,
+                                       Py_ssize_t *buffer_len);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_Format(PyObject *obj,
+                                       PyObject *format_spec);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_GetIter(PyObject *);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_GetAIter(PyObject *);
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyIter_Check(PyObject *);
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyAIter_Check(PyObject *);
+# 396 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyIter_Next(PyObject *);
+# 408 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PySendResult PyIter_Send(PyObject *, PyObject *, PyObject **);
+# 417 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) int PyNumber_Check(PyObject *o);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Add(PyObject *o1, PyObject *o2);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Subtract(PyObject *o1, PyObject *o2);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Multiply(PyObject *o1, PyObject *o2);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_MatrixMultiply(PyObject *o1, PyObject *o2);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_FloorDivide(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_TrueDivide(PyObject *o1, PyObject *o2);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Remainder(PyObject *o1, PyObject *o2);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Divmod(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Power(PyObject *o1, PyObject *o2,
+                                      PyObject *o3);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Negative(PyObject *o);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Positive(PyObject *o);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Absolute(PyObject *o);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Invert(PyObject *o);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Lshift(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Rshift(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_And(PyObject *o1, PyObject *o2);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Xor(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Or(PyObject *o1, PyObject *o2);
+
+
+
+__attribute__ ((visibility ("default"))) int PyIndex_Check(PyObject *);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Index(PyObject *o);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyNumber_AsSsize_t(PyObject *o, PyObject *exc);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Long(PyObject *o);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_Float(PyObject *o);
+# 553 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceAdd(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceSubtract(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceMultiply(PyObject *o1, PyObject *o2);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceMatrixMultiply(PyObject *o1, PyObject *o2);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceFloorDivide(PyObject *o1,
+                                                   PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceTrueDivide(PyObject *o1,
+                                                  PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceRemainder(PyObject *o1, PyObject *o2);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlacePower(PyObject *o1, PyObject *o2,
+                                             PyObject *o3);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceLshift(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceRshift(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceAnd(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceXor(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_InPlaceOr(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyNumber_ToBase(PyObject *n, int base);
+# 643 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) int PySequence_Check(PyObject *o);
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PySequence_Size(PyObject *o);
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PySequence_Length(PyObject *o);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PySequence_Concat(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PySequence_Repeat(PyObject *o, Py_ssize_t count);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PySequence_GetItem(PyObject *o, Py_ssize_t i);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PySequence_GetSlice(PyObject *o, Py_ssize_t i1, Py_ssize_t i2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PySequence_SetItem(PyObject *o, Py_ssize_t i, PyObject *v);
+
+
+
+
+__attribute__ ((visibility ("default"))) int PySequence_DelItem(PyObject *o, Py_ssize_t i);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PySequence_SetSlice(PyObject *o, Py_ssize_t i1, Py_ssize_t i2,
+                                    PyObject *v);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PySequence_DelSlice(PyObject *o, Py_ssize_t i1, Py_ssize_t i2);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PySequence_Tuple(PyObject *o);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PySequence_List(PyObject *o);
+# 715 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PySequence_Fast(PyObject *o, const char* m);
+# 738 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) Py_ssize_t PySequence_Count(PyObject *o, PyObject *value);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PySequence_Contains(PyObject *seq, PyObject *ob);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PySequence_In(PyObject *o, PyObject *value);
+# 762 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) Py_ssize_t PySequence_Index(PyObject *o, PyObject *value);
+# 771 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PySequence_InPlaceConcat(PyObject *o1, PyObject *o2);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PySequence_InPlaceRepeat(PyObject *o, Py_ssize_t count);
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyMapping_Check(PyObject *o);
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyMapping_Size(PyObject *o);
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyMapping_Length(PyObject *o);
+# 823 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+__attribute__ ((visibility ("default"))) int PyMapping_HasKeyString(PyObject *o, const char *key);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyMapping_HasKey(PyObject *o, PyObject *key);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyMapping_Keys(PyObject *o);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyMapping_Values(PyObject *o);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyMapping_Items(PyObject *o);
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyMapping_GetItemString(PyObject *o,
+                                               const char *key);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyMapping_SetItemString(PyObject *o, const char *key,
+                                        PyObject *value);
+
+
+__attribute__ ((visibility ("default"))) int PyObject_IsInstance(PyObject *object, PyObject *typeorclass);
+
+
+__attribute__ ((visibility ("default"))) int PyObject_IsSubclass(PyObject *object, PyObject *typeorclass);
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h" 1
+# 21 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * _PyStack_AsDict(
+    PyObject *const *values,
+    PyObject *kwnames);
+# 36 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * _Py_CheckFunctionResult(
+    PyThreadState *tstate,
+    PyObject *callable,
+    PyObject *result,
+    const char *where);
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_MakeTpCall(
+    PyThreadState *tstate,
+    PyObject *callable,
+    PyObject *const *args, Py_ssize_t nargs,
+    PyObject *keywords);
+
+
+
+
+static inline Py_ssize_t
+PyVectorcall_NARGS(size_t n)
+{
+    return n & ~(((size_t)(1)) << (8 * sizeof(size_t) - 1));
+}
+
+__attribute__ ((visibility ("default"))) vectorcallfunc PyVectorcall_Function(PyObject *callable);
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_Vectorcall(
+    PyObject *callable,
+    PyObject *const *args,
+    size_t nargsf,
+    PyObject *kwnames);
+# 81 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+__attribute__ ((visibility ("default"))) PyObject * PyObject_VectorcallDict(
+    PyObject *callable,
+    PyObject *const *args,
+    size_t nargsf,
+    PyObject *kwargs);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * PyVectorcall_Call(PyObject *callable, PyObject *tuple, PyObject *dict);
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_FastCall(
+    PyObject *func,
+    PyObject *const *args,
+    Py_ssize_t nargs);
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_CallOneArg(PyObject *func, PyObject *arg);
+
+__attribute__ ((visibility ("default"))) PyObject * PyObject_VectorcallMethod(
+    PyObject *name, PyObject *const *args,
+    size_t nargsf, PyObject *kwnames);
+
+static inline PyObject *
+PyObject_CallMethodNoArgs(PyObject *self, PyObject *name)
+{
+    size_t nargsf = 1 | (((size_t)(1)) << (8 * sizeof(size_t) - 1));
+    return PyObject_VectorcallMethod(name, &self, nargsf, 
+# 107 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h" 3 4
+                                                         ((void *)0)
+# 107 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+                                                                 );
+}
+
+static inline PyObject *
+PyObject_CallMethodOneArg(PyObject *self, PyObject *name, PyObject *arg)
+{
+    PyObject *args[2] = {self, arg};
+    size_t nargsf = 2 | (((size_t)(1)) << (8 * sizeof(size_t) - 1));
+    
+# 115 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h" 3 4
+   ((void) (0))
+# 115 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+                      ;
+    return PyObject_VectorcallMethod(name, args, nargsf, 
+# 116 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h" 3 4
+                                                        ((void *)0)
+# 116 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+                                                                );
+}
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_CallMethod(PyObject *obj,
+                                            PyObject *name,
+                                            const char *format, ...);
+
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_CallMethodId(PyObject *obj,
+                                              _Py_Identifier *name,
+                                              const char *format, ...);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_CallMethodId_SizeT(PyObject *obj,
+                                                    _Py_Identifier *name,
+                                                    const char *format,
+                                                    ...);
+
+__attribute__ ((visibility ("default"))) PyObject * _PyObject_CallMethodIdObjArgs(
+    PyObject *obj,
+    _Py_Identifier *name,
+    ...);
+
+static inline PyObject *
+_PyObject_VectorcallMethodId(
+    _Py_Identifier *name, PyObject *const *args,
+    size_t nargsf, PyObject *kwnames)
+{
+    PyObject *oname = _PyUnicode_FromId(name);
+    if (!oname) {
+        return 
+# 146 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h" 3 4
+              ((void *)0)
+# 146 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+                      ;
+    }
+    return PyObject_VectorcallMethod(oname, args, nargsf, kwnames);
+}
+
+static inline PyObject *
+_PyObject_CallMethodIdNoArgs(PyObject *self, _Py_Identifier *name)
+{
+    size_t nargsf = 1 | (((size_t)(1)) << (8 * sizeof(size_t) - 1));
+    return _PyObject_VectorcallMethodId(name, &self, nargsf, 
+# 155 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h" 3 4
+                                                            ((void *)0)
+# 155 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+                                                                    );
+}
+
+static inline PyObject *
+_PyObject_CallMethodIdOneArg(PyObject *self, _Py_Identifier *name, PyObject *arg)
+{
+    PyObject *args[2] = {self, arg};
+    size_t nargsf = 2 | (((size_t)(1)) << (8 * sizeof(size_t) - 1));
+    
+# 163 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h" 3 4
+   ((void) (0))
+# 163 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+                      ;
+    return _PyObject_VectorcallMethodId(name, args, nargsf, 
+# 164 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h" 3 4
+                                                           ((void *)0)
+# 164 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+                                                                   );
+}
+
+__attribute__ ((visibility ("default"))) int _PyObject_HasLen(PyObject *o);
+
+
+
+
+__attribute__ ((visibility ("default"))) Py_ssize_t PyObject_LengthHint(PyObject *o, Py_ssize_t);
+# 196 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/abstract.h"
+__attribute__ ((visibility ("default"))) Py_ssize_t _PySequence_IterSearch(PyObject *seq,
+                                              PyObject *obj, int operation);
+
+
+
+__attribute__ ((visibility ("default"))) int _PyObject_RealIsInstance(PyObject *inst, PyObject *cls);
+
+__attribute__ ((visibility ("default"))) int _PyObject_RealIsSubclass(PyObject *derived, PyObject *cls);
+
+__attribute__ ((visibility ("default"))) char *const * _PySequence_BytesToCharpArray(PyObject* self);
+
+__attribute__ ((visibility ("default"))) void _Py_FreeCharPArray(char *const array[]);
+
+
+__attribute__ ((visibility ("default"))) void _Py_add_one_to_index_F(int nd, Py_ssize_t *index,
+                                        const Py_ssize_t *shape);
+__attribute__ ((visibility ("default"))) void _Py_add_one_to_index_C(int nd, Py_ssize_t *index,
+                                        const Py_ssize_t *shape);
+
+
+__attribute__ ((visibility ("default"))) int _Py_convert_optional_to_ssize_t(PyObject *, void *);
+
+
+__attribute__ ((visibility ("default"))) PyObject * _PyNumber_Index(PyObject *o);
+# 867 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h" 2
+# 101 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/bltinmodule.h" 1
+
+
+
+
+
+
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyFilter_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyMap_Type;
+extern __attribute__ ((visibility ("default"))) PyTypeObject PyZip_Type;
+# 102 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pyctype.h" 1
+# 16 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pyctype.h"
+extern __attribute__ ((visibility ("default"))) const unsigned int _Py_ctype_table[256];
+# 29 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pyctype.h"
+extern __attribute__ ((visibility ("default"))) const unsigned char _Py_ctype_tolower[256];
+extern __attribute__ ((visibility ("default"))) const unsigned char _Py_ctype_toupper[256];
+# 103 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pystrtod.h" 1
+# 9 "/root/.pyenv/versions/3.11.7/include/python3.11/pystrtod.h"
+__attribute__ ((visibility ("default"))) double PyOS_string_to_double(const char *str,
+                                         char **endptr,
+                                         PyObject *overflow_exception);
+
+
+
+__attribute__ ((visibility ("default"))) char * PyOS_double_to_string(double val,
+                                         char format_code,
+                                         int precision,
+                                         int flags,
+                                         int *type);
+
+
+__attribute__ ((visibility ("default"))) PyObject * _Py_string_to_number_with_underscores(
+    const char *str, Py_ssize_t len, const char *what, PyObject *obj, void *arg,
+    PyObject *(*innerfunc)(const char *, Py_ssize_t, void *));
+
+__attribute__ ((visibility ("default"))) double _Py_parse_inf_or_nan(const char *p, char **endptr);
+# 104 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/pystrcmp.h" 1
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyOS_mystrnicmp(const char *, const char *, Py_ssize_t);
+__attribute__ ((visibility ("default"))) int PyOS_mystricmp(const char *, const char *);
+# 105 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/fileutils.h" 1
+
+
+
+
+
+
+
+__attribute__ ((visibility ("default"))) wchar_t * Py_DecodeLocale(
+    const char *arg,
+    size_t *size);
+
+__attribute__ ((visibility ("default"))) char* Py_EncodeLocale(
+    const wchar_t *text,
+    size_t *error_pos);
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/fileutils.h" 1
+
+
+
+
+
+__attribute__ ((visibility ("default"))) FILE* _Py_fopen_obj(
+    PyObject *path,
+    const char *mode);
+# 20 "/root/.pyenv/versions/3.11.7/include/python3.11/fileutils.h" 2
+# 106 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/pyfpe.h" 1
+# 107 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/include/python3.11/tracemalloc.h" 1
+# 12 "/root/.pyenv/versions/3.11.7/include/python3.11/tracemalloc.h"
+__attribute__ ((visibility ("default"))) int PyTraceMalloc_Track(
+    unsigned int domain,
+    uintptr_t ptr,
+    size_t size);
+
+
+
+
+
+__attribute__ ((visibility ("default"))) int PyTraceMalloc_Untrack(
+    unsigned int domain,
+    uintptr_t ptr);
+# 33 "/root/.pyenv/versions/3.11.7/include/python3.11/tracemalloc.h"
+__attribute__ ((visibility ("default"))) PyObject* _PyTraceMalloc_GetTraceback(
+    unsigned int domain,
+    uintptr_t ptr);
+# 108 "/root/.pyenv/versions/3.11.7/include/python3.11/Python.h" 2
+# 34 "pyhlcompat.h" 2
+# 45 "pyhlcompat.h"
+int PyHlhdfAPI_CompareWithASCIIString(PyObject* ptr, const char* name);
+
+
+
+
+
+PyObject* PyHlhdf_StringOrUnicode_FromASCII(const char *buffer, Py_ssize_t size);
+# 31 "pyhlhdf_common.h" 2
+# 1 "../hlhdf/hlhdf.h" 1
+# 28 "../hlhdf/hlhdf.h"
+# 1 "/usr/include/hdf5/serial/hdf5.h" 1
+# 22 "/usr/include/hdf5/serial/hdf5.h"
+# 1 "/usr/include/hdf5/serial/H5public.h" 1
+# 29 "/usr/include/hdf5/serial/H5public.h"
+# 1 "/usr/include/hdf5/serial/H5pubconf.h" 1
+# 30 "/usr/include/hdf5/serial/H5public.h" 2
+
+
+# 1 "/usr/include/hdf5/serial/H5version.h" 1
+# 33 "/usr/include/hdf5/serial/H5public.h" 2
+# 41 "/usr/include/hdf5/serial/H5public.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 42 "/usr/include/hdf5/serial/H5public.h" 2
+# 57 "/usr/include/hdf5/serial/H5public.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 58 "/usr/include/hdf5/serial/H5public.h" 2
+# 75 "/usr/include/hdf5/serial/H5public.h"
+# 1 "/usr/include/hdf5/serial/H5api_adpt.h" 1
+# 76 "/usr/include/hdf5/serial/H5public.h" 2
+# 208 "/usr/include/hdf5/serial/H5public.h"
+
+# 208 "/usr/include/hdf5/serial/H5public.h"
+typedef int herr_t;
+# 227 "/usr/include/hdf5/serial/H5public.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 228 "/usr/include/hdf5/serial/H5public.h" 2
+# 239 "/usr/include/hdf5/serial/H5public.h"
+typedef 
+# 239 "/usr/include/hdf5/serial/H5public.h" 3 4
+       _Bool 
+# 239 "/usr/include/hdf5/serial/H5public.h"
+            hbool_t;
+typedef int htri_t;
+# 322 "/usr/include/hdf5/serial/H5public.h"
+
+# 322 "/usr/include/hdf5/serial/H5public.h"
+#pragma GCC diagnostic push
+# 322 "/usr/include/hdf5/serial/H5public.h"
+
+# 322 "/usr/include/hdf5/serial/H5public.h"
+#pragma GCC diagnostic ignored "-W" "long-long"
+# 322 "/usr/include/hdf5/serial/H5public.h"
+
+typedef unsigned long long hsize_t;
+typedef signed long long hssize_t;
+
+# 325 "/usr/include/hdf5/serial/H5public.h"
+#pragma GCC diagnostic pop
+# 325 "/usr/include/hdf5/serial/H5public.h"
+
+# 357 "/usr/include/hdf5/serial/H5public.h"
+typedef unsigned long haddr_t;
+# 410 "/usr/include/hdf5/serial/H5public.h"
+typedef enum {
+    H5_ITER_UNKNOWN = -1,
+    H5_ITER_INC,
+    H5_ITER_DEC,
+    H5_ITER_NATIVE,
+    H5_ITER_N
+} H5_iter_order_t;
+# 433 "/usr/include/hdf5/serial/H5public.h"
+typedef enum H5_index_t {
+    H5_INDEX_UNKNOWN = -1,
+    H5_INDEX_NAME,
+    H5_INDEX_CRT_ORDER,
+    H5_INDEX_N
+} H5_index_t;
+
+
+
+
+
+
+typedef struct H5_ih_info_t {
+    hsize_t index_size;
+    hsize_t heap_size;
+} H5_ih_info_t;
+
+
+
+
+
+typedef struct H5_alloc_stats_t {
+    unsigned long long total_alloc_bytes;
+    size_t curr_alloc_bytes;
+    size_t peak_alloc_bytes;
+    size_t max_block_size;
+    size_t total_alloc_blocks_count;
+    size_t curr_alloc_blocks_count;
+    size_t peak_alloc_blocks_count;
+} H5_alloc_stats_t;
+# 480 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5open(void);
+# 492 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5close(void);
+# 511 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5dont_atexit(void);
+# 531 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5garbage_collect(void);
+# 584 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_lim,
+                                     int arr_list_lim, int blk_global_lim, int blk_list_lim);
+# 604 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size, size_t *fac_size);
+# 625 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5get_alloc_stats(H5_alloc_stats_t *stats);
+# 640 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5get_libversion(unsigned *majnum, unsigned *minnum, unsigned *relnum);
+# 688 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5check_version(unsigned majnum, unsigned minnum, unsigned relnum);
+# 704 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5is_library_threadsafe(hbool_t *is_ts);
+# 741 "/usr/include/hdf5/serial/H5public.h"
+ herr_t H5free_memory(void *mem);
+# 797 "/usr/include/hdf5/serial/H5public.h"
+ void *H5allocate_memory(size_t size, hbool_t clear);
+# 871 "/usr/include/hdf5/serial/H5public.h"
+ void *H5resize_memory(void *mem, size_t size);
+# 23 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5Apublic.h" 1
+# 21 "/usr/include/hdf5/serial/H5Apublic.h"
+# 1 "/usr/include/hdf5/serial/H5Ipublic.h" 1
+# 39 "/usr/include/hdf5/serial/H5Ipublic.h"
+typedef enum H5I_type_t {
+    H5I_UNINIT = (-2),
+    H5I_BADID = (-1),
+    H5I_FILE = 1,
+    H5I_GROUP,
+    H5I_DATATYPE,
+    H5I_DATASPACE,
+    H5I_DATASET,
+    H5I_ATTR,
+    H5I_REFERENCE,
+    H5I_VFL,
+    H5I_GENPROP_CLS,
+    H5I_GENPROP_LST,
+    H5I_ERROR_CLASS,
+    H5I_ERROR_MSG,
+    H5I_ERROR_STACK,
+    H5I_NTYPES
+} H5I_type_t;
+
+
+
+
+
+typedef int64_t hid_t;
+# 81 "/usr/include/hdf5/serial/H5Ipublic.h"
+typedef herr_t (*H5I_free_t)(void *);
+
+
+
+
+
+typedef int (*H5I_search_func_t)(void *obj, hid_t id, void *key);
+# 117 "/usr/include/hdf5/serial/H5Ipublic.h"
+ hid_t H5Iregister(H5I_type_t type, const void *object);
+# 140 "/usr/include/hdf5/serial/H5Ipublic.h"
+ void *H5Iobject_verify(hid_t id, H5I_type_t type);
+# 170 "/usr/include/hdf5/serial/H5Ipublic.h"
+ void *H5Iremove_verify(hid_t id, H5I_type_t type);
+# 194 "/usr/include/hdf5/serial/H5Ipublic.h"
+ H5I_type_t H5Iget_type(hid_t id);
+# 218 "/usr/include/hdf5/serial/H5Ipublic.h"
+ hid_t H5Iget_file_id(hid_t id);
+# 260 "/usr/include/hdf5/serial/H5Ipublic.h"
+ ssize_t H5Iget_name(hid_t id, char *name , size_t size);
+# 305 "/usr/include/hdf5/serial/H5Ipublic.h"
+ int H5Iinc_ref(hid_t id);
+# 351 "/usr/include/hdf5/serial/H5Ipublic.h"
+ int H5Idec_ref(hid_t id);
+# 375 "/usr/include/hdf5/serial/H5Ipublic.h"
+ int H5Iget_ref(hid_t id);
+# 407 "/usr/include/hdf5/serial/H5Ipublic.h"
+ H5I_type_t H5Iregister_type(size_t hash_size, unsigned reserved, H5I_free_t free_func);
+# 431 "/usr/include/hdf5/serial/H5Ipublic.h"
+ herr_t H5Iclear_type(H5I_type_t type, hbool_t force);
+# 454 "/usr/include/hdf5/serial/H5Ipublic.h"
+ herr_t H5Idestroy_type(H5I_type_t type);
+# 473 "/usr/include/hdf5/serial/H5Ipublic.h"
+ int H5Iinc_type_ref(H5I_type_t type);
+# 493 "/usr/include/hdf5/serial/H5Ipublic.h"
+ int H5Idec_type_ref(H5I_type_t type);
+# 512 "/usr/include/hdf5/serial/H5Ipublic.h"
+ int H5Iget_type_ref(H5I_type_t type);
+# 553 "/usr/include/hdf5/serial/H5Ipublic.h"
+ void *H5Isearch(H5I_type_t type, H5I_search_func_t func, void *key);
+# 573 "/usr/include/hdf5/serial/H5Ipublic.h"
+ herr_t H5Inmembers(H5I_type_t type, hsize_t *num_members);
+# 589 "/usr/include/hdf5/serial/H5Ipublic.h"
+ htri_t H5Itype_exists(H5I_type_t type);
+# 617 "/usr/include/hdf5/serial/H5Ipublic.h"
+ htri_t H5Iis_valid(hid_t id);
+# 22 "/usr/include/hdf5/serial/H5Apublic.h" 2
+# 1 "/usr/include/hdf5/serial/H5Opublic.h" 1
+# 31 "/usr/include/hdf5/serial/H5Opublic.h"
+# 1 "/usr/include/hdf5/serial/H5Lpublic.h" 1
+# 30 "/usr/include/hdf5/serial/H5Lpublic.h"
+# 1 "/usr/include/hdf5/serial/H5Tpublic.h" 1
+# 32 "/usr/include/hdf5/serial/H5Tpublic.h"
+typedef enum H5T_class_t {
+    H5T_NO_CLASS = -1,
+    H5T_INTEGER = 0,
+    H5T_FLOAT = 1,
+    H5T_TIME = 2,
+    H5T_STRING = 3,
+    H5T_BITFIELD = 4,
+    H5T_OPAQUE = 5,
+    H5T_COMPOUND = 6,
+    H5T_REFERENCE = 7,
+    H5T_ENUM = 8,
+    H5T_VLEN = 9,
+    H5T_ARRAY = 10,
+
+    H5T_NCLASSES
+} H5T_class_t;
+
+
+
+
+
+
+typedef enum H5T_order_t {
+    H5T_ORDER_ERROR = -1,
+    H5T_ORDER_LE = 0,
+    H5T_ORDER_BE = 1,
+    H5T_ORDER_VAX = 2,
+    H5T_ORDER_MIXED = 3,
+    H5T_ORDER_NONE = 4
+
+} H5T_order_t;
+
+
+
+
+
+
+typedef enum H5T_sign_t {
+    H5T_SGN_ERROR = -1,
+    H5T_SGN_NONE = 0,
+    H5T_SGN_2 = 1,
+
+    H5T_NSGN = 2
+} H5T_sign_t;
+
+
+
+
+
+
+typedef enum H5T_norm_t {
+    H5T_NORM_ERROR = -1,
+    H5T_NORM_IMPLIED = 0,
+    H5T_NORM_MSBSET = 1,
+    H5T_NORM_NONE = 2
+
+} H5T_norm_t;
+
+
+
+
+
+
+typedef enum H5T_cset_t {
+    H5T_CSET_ERROR = -1,
+    H5T_CSET_ASCII = 0,
+    H5T_CSET_UTF8 = 1,
+    H5T_CSET_RESERVED_2 = 2,
+    H5T_CSET_RESERVED_3 = 3,
+    H5T_CSET_RESERVED_4 = 4,
+    H5T_CSET_RESERVED_5 = 5,
+    H5T_CSET_RESERVED_6 = 6,
+    H5T_CSET_RESERVED_7 = 7,
+    H5T_CSET_RESERVED_8 = 8,
+    H5T_CSET_RESERVED_9 = 9,
+    H5T_CSET_RESERVED_10 = 10,
+    H5T_CSET_RESERVED_11 = 11,
+    H5T_CSET_RESERVED_12 = 12,
+    H5T_CSET_RESERVED_13 = 13,
+    H5T_CSET_RESERVED_14 = 14,
+    H5T_CSET_RESERVED_15 = 15
+} H5T_cset_t;
+
+
+
+
+
+
+typedef enum H5T_str_t {
+    H5T_STR_ERROR = -1,
+    H5T_STR_NULLTERM = 0,
+    H5T_STR_NULLPAD = 1,
+    H5T_STR_SPACEPAD = 2,
+    H5T_STR_RESERVED_3 = 3,
+    H5T_STR_RESERVED_4 = 4,
+    H5T_STR_RESERVED_5 = 5,
+    H5T_STR_RESERVED_6 = 6,
+    H5T_STR_RESERVED_7 = 7,
+    H5T_STR_RESERVED_8 = 8,
+    H5T_STR_RESERVED_9 = 9,
+    H5T_STR_RESERVED_10 = 10,
+    H5T_STR_RESERVED_11 = 11,
+    H5T_STR_RESERVED_12 = 12,
+    H5T_STR_RESERVED_13 = 13,
+    H5T_STR_RESERVED_14 = 14,
+    H5T_STR_RESERVED_15 = 15
+} H5T_str_t;
+
+
+
+
+
+
+typedef enum H5T_pad_t {
+    H5T_PAD_ERROR = -1,
+    H5T_PAD_ZERO = 0,
+    H5T_PAD_ONE = 1,
+    H5T_PAD_BACKGROUND = 2,
+
+    H5T_NPAD = 3
+} H5T_pad_t;
+
+
+
+
+
+typedef enum H5T_cmd_t {
+    H5T_CONV_INIT = 0,
+    H5T_CONV_CONV = 1,
+    H5T_CONV_FREE = 2
+} H5T_cmd_t;
+
+
+
+
+typedef enum H5T_bkg_t {
+    H5T_BKG_NO = 0,
+    H5T_BKG_TEMP = 1,
+    H5T_BKG_YES = 2
+} H5T_bkg_t;
+
+
+
+
+
+typedef struct H5T_cdata_t {
+    H5T_cmd_t command;
+    H5T_bkg_t need_bkg;
+    hbool_t recalc;
+    void * priv;
+} H5T_cdata_t;
+
+
+
+
+
+typedef enum H5T_pers_t {
+    H5T_PERS_DONTCARE = -1,
+    H5T_PERS_HARD = 0,
+    H5T_PERS_SOFT = 1
+} H5T_pers_t;
+
+
+
+
+
+typedef enum H5T_direction_t {
+    H5T_DIR_DEFAULT = 0,
+    H5T_DIR_ASCEND = 1,
+    H5T_DIR_DESCEND = 2
+} H5T_direction_t;
+
+
+
+
+
+typedef enum H5T_conv_except_t {
+    H5T_CONV_EXCEPT_RANGE_HI = 0,
+
+    H5T_CONV_EXCEPT_RANGE_LOW = 1,
+
+    H5T_CONV_EXCEPT_PRECISION = 2,
+
+    H5T_CONV_EXCEPT_TRUNCATE = 3,
+
+    H5T_CONV_EXCEPT_PINF = 4,
+
+    H5T_CONV_EXCEPT_NINF = 5,
+
+    H5T_CONV_EXCEPT_NAN = 6
+
+} H5T_conv_except_t;
+
+
+
+
+typedef enum H5T_conv_ret_t {
+    H5T_CONV_ABORT = -1,
+    H5T_CONV_UNHANDLED = 0,
+    H5T_CONV_HANDLED = 1
+} H5T_conv_ret_t;
+
+
+
+
+
+typedef struct {
+    size_t len;
+    void * p;
+} hvl_t;
+# 265 "/usr/include/hdf5/serial/H5Tpublic.h"
+typedef herr_t (*H5T_conv_t)(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                             size_t bkg_stride, void *buf, void *bkg, hid_t dset_xfer_plist);
+# 286 "/usr/include/hdf5/serial/H5Tpublic.h"
+typedef H5T_conv_ret_t (*H5T_conv_except_func_t)(H5T_conv_except_t except_type, hid_t src_id, hid_t dst_id,
+                                                 void *src_buf, void *dst_buf, void *user_data);
+# 321 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_IEEE_F32BE_g;
+extern hid_t H5T_IEEE_F32LE_g;
+extern hid_t H5T_IEEE_F64BE_g;
+extern hid_t H5T_IEEE_F64LE_g;
+# 460 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_STD_I8BE_g;
+extern hid_t H5T_STD_I8LE_g;
+extern hid_t H5T_STD_I16BE_g;
+extern hid_t H5T_STD_I16LE_g;
+extern hid_t H5T_STD_I32BE_g;
+extern hid_t H5T_STD_I32LE_g;
+extern hid_t H5T_STD_I64BE_g;
+extern hid_t H5T_STD_I64LE_g;
+extern hid_t H5T_STD_U8BE_g;
+extern hid_t H5T_STD_U8LE_g;
+extern hid_t H5T_STD_U16BE_g;
+extern hid_t H5T_STD_U16LE_g;
+extern hid_t H5T_STD_U32BE_g;
+extern hid_t H5T_STD_U32LE_g;
+extern hid_t H5T_STD_U64BE_g;
+extern hid_t H5T_STD_U64LE_g;
+extern hid_t H5T_STD_B8BE_g;
+extern hid_t H5T_STD_B8LE_g;
+extern hid_t H5T_STD_B16BE_g;
+extern hid_t H5T_STD_B16LE_g;
+extern hid_t H5T_STD_B32BE_g;
+extern hid_t H5T_STD_B32LE_g;
+extern hid_t H5T_STD_B64BE_g;
+extern hid_t H5T_STD_B64LE_g;
+extern hid_t H5T_STD_REF_OBJ_g;
+extern hid_t H5T_STD_REF_DSETREG_g;
+# 506 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_UNIX_D32BE_g;
+extern hid_t H5T_UNIX_D32LE_g;
+extern hid_t H5T_UNIX_D64BE_g;
+extern hid_t H5T_UNIX_D64LE_g;
+# 520 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_C_S1_g;
+# 530 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_FORTRAN_S1_g;
+# 770 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_VAX_F32_g;
+extern hid_t H5T_VAX_F64_g;
+# 904 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_NATIVE_SCHAR_g;
+extern hid_t H5T_NATIVE_UCHAR_g;
+extern hid_t H5T_NATIVE_SHORT_g;
+extern hid_t H5T_NATIVE_USHORT_g;
+extern hid_t H5T_NATIVE_INT_g;
+extern hid_t H5T_NATIVE_UINT_g;
+extern hid_t H5T_NATIVE_LONG_g;
+extern hid_t H5T_NATIVE_ULONG_g;
+extern hid_t H5T_NATIVE_LLONG_g;
+extern hid_t H5T_NATIVE_ULLONG_g;
+extern hid_t H5T_NATIVE_FLOAT_g;
+extern hid_t H5T_NATIVE_DOUBLE_g;
+
+extern hid_t H5T_NATIVE_LDOUBLE_g;
+
+extern hid_t H5T_NATIVE_B8_g;
+extern hid_t H5T_NATIVE_B16_g;
+extern hid_t H5T_NATIVE_B32_g;
+extern hid_t H5T_NATIVE_B64_g;
+extern hid_t H5T_NATIVE_OPAQUE_g;
+extern hid_t H5T_NATIVE_HADDR_g;
+extern hid_t H5T_NATIVE_HSIZE_g;
+extern hid_t H5T_NATIVE_HSSIZE_g;
+extern hid_t H5T_NATIVE_HERR_g;
+extern hid_t H5T_NATIVE_HBOOL_g;
+# 955 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_NATIVE_INT8_g;
+extern hid_t H5T_NATIVE_UINT8_g;
+extern hid_t H5T_NATIVE_INT_LEAST8_g;
+extern hid_t H5T_NATIVE_UINT_LEAST8_g;
+extern hid_t H5T_NATIVE_INT_FAST8_g;
+extern hid_t H5T_NATIVE_UINT_FAST8_g;
+# 986 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_NATIVE_INT16_g;
+extern hid_t H5T_NATIVE_UINT16_g;
+extern hid_t H5T_NATIVE_INT_LEAST16_g;
+extern hid_t H5T_NATIVE_UINT_LEAST16_g;
+extern hid_t H5T_NATIVE_INT_FAST16_g;
+extern hid_t H5T_NATIVE_UINT_FAST16_g;
+# 1017 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_NATIVE_INT32_g;
+extern hid_t H5T_NATIVE_UINT32_g;
+extern hid_t H5T_NATIVE_INT_LEAST32_g;
+extern hid_t H5T_NATIVE_UINT_LEAST32_g;
+extern hid_t H5T_NATIVE_INT_FAST32_g;
+extern hid_t H5T_NATIVE_UINT_FAST32_g;
+# 1048 "/usr/include/hdf5/serial/H5Tpublic.h"
+extern hid_t H5T_NATIVE_INT64_g;
+extern hid_t H5T_NATIVE_UINT64_g;
+extern hid_t H5T_NATIVE_INT_LEAST64_g;
+extern hid_t H5T_NATIVE_UINT_LEAST64_g;
+extern hid_t H5T_NATIVE_INT_FAST64_g;
+extern hid_t H5T_NATIVE_UINT_FAST64_g;
+# 1098 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tcreate(H5T_class_t type, size_t size);
+# 1121 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tcopy(hid_t type_id);
+# 1136 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tclose(hid_t type_id);
+# 1153 "/usr/include/hdf5/serial/H5Tpublic.h"
+ htri_t H5Tequal(hid_t type1_id, hid_t type2_id);
+# 1170 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tlock(hid_t type_id);
+# 1217 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tcommit2(hid_t loc_id, const char *name, hid_t type_id, hid_t lcpl_id, hid_t tcpl_id,
+                         hid_t tapl_id);
+# 1242 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Topen2(hid_t loc_id, const char *name, hid_t tapl_id);
+# 1295 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tcommit_anon(hid_t loc_id, hid_t type_id, hid_t tcpl_id, hid_t tapl_id);
+# 1315 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tget_create_plist(hid_t type_id);
+# 1338 "/usr/include/hdf5/serial/H5Tpublic.h"
+ htri_t H5Tcommitted(hid_t type_id);
+# 1372 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tencode(hid_t obj_id, void *buf, size_t *nalloc);
+# 1394 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tdecode(const void *buf);
+# 1433 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tflush(hid_t type_id);
+# 1455 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Trefresh(hid_t type_id);
+# 1485 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tinsert(hid_t parent_id, const char *name, size_t offset, hid_t member_id);
+# 1501 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tpack(hid_t type_id);
+# 1525 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tenum_create(hid_t base_id);
+# 1556 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tenum_insert(hid_t type, const char *name, const void *value);
+# 1582 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tenum_nameof(hid_t type, const void *value, char *name , size_t size);
+# 1609 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tenum_valueof(hid_t type, const char *name, void *value );
+# 1645 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tvlen_create(hid_t base_id);
+# 1672 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tarray_create2(hid_t base_id, unsigned ndims, const hsize_t dim[ ]);
+# 1689 "/usr/include/hdf5/serial/H5Tpublic.h"
+ int H5Tget_array_ndims(hid_t type_id);
+# 1707 "/usr/include/hdf5/serial/H5Tpublic.h"
+ int H5Tget_array_dims2(hid_t type_id, hsize_t dims[]);
+# 1733 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_tag(hid_t type, const char *tag);
+# 1751 "/usr/include/hdf5/serial/H5Tpublic.h"
+ char *H5Tget_tag(hid_t type);
+# 1772 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tget_super(hid_t type);
+# 1795 "/usr/include/hdf5/serial/H5Tpublic.h"
+ H5T_class_t H5Tget_class(hid_t type_id);
+# 1821 "/usr/include/hdf5/serial/H5Tpublic.h"
+ htri_t H5Tdetect_class(hid_t type_id, H5T_class_t cls);
+# 1850 "/usr/include/hdf5/serial/H5Tpublic.h"
+ size_t H5Tget_size(hid_t type_id);
+# 1876 "/usr/include/hdf5/serial/H5Tpublic.h"
+ H5T_order_t H5Tget_order(hid_t type_id);
+# 1896 "/usr/include/hdf5/serial/H5Tpublic.h"
+ size_t H5Tget_precision(hid_t type_id);
+# 1925 "/usr/include/hdf5/serial/H5Tpublic.h"
+ int H5Tget_offset(hid_t type_id);
+# 1944 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tget_pad(hid_t type_id, H5T_pad_t *lsb , H5T_pad_t *msb );
+# 1961 "/usr/include/hdf5/serial/H5Tpublic.h"
+ H5T_sign_t H5Tget_sign(hid_t type_id);
+# 1985 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tget_fields(hid_t type_id, size_t *spos , size_t *epos , size_t *esize ,
+                            size_t *mpos , size_t *msize );
+# 2001 "/usr/include/hdf5/serial/H5Tpublic.h"
+ size_t H5Tget_ebias(hid_t type_id);
+# 2020 "/usr/include/hdf5/serial/H5Tpublic.h"
+ H5T_norm_t H5Tget_norm(hid_t type_id);
+# 2039 "/usr/include/hdf5/serial/H5Tpublic.h"
+ H5T_pad_t H5Tget_inpad(hid_t type_id);
+# 2060 "/usr/include/hdf5/serial/H5Tpublic.h"
+ H5T_str_t H5Tget_strpad(hid_t type_id);
+# 2077 "/usr/include/hdf5/serial/H5Tpublic.h"
+ int H5Tget_nmembers(hid_t type_id);
+# 2104 "/usr/include/hdf5/serial/H5Tpublic.h"
+ char *H5Tget_member_name(hid_t type_id, unsigned membno);
+# 2126 "/usr/include/hdf5/serial/H5Tpublic.h"
+ int H5Tget_member_index(hid_t type_id, const char *name);
+# 2150 "/usr/include/hdf5/serial/H5Tpublic.h"
+ size_t H5Tget_member_offset(hid_t type_id, unsigned membno);
+# 2171 "/usr/include/hdf5/serial/H5Tpublic.h"
+ H5T_class_t H5Tget_member_class(hid_t type_id, unsigned membno);
+# 2192 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tget_member_type(hid_t type_id, unsigned membno);
+# 2219 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tget_member_value(hid_t type_id, unsigned membno, void *value );
+# 2237 "/usr/include/hdf5/serial/H5Tpublic.h"
+ H5T_cset_t H5Tget_cset(hid_t type_id);
+# 2260 "/usr/include/hdf5/serial/H5Tpublic.h"
+ htri_t H5Tis_variable_str(hid_t type_id);
+# 2344 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tget_native_type(hid_t type_id, H5T_direction_t direction);
+# 2394 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_size(hid_t type_id, size_t size);
+# 2433 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_order(hid_t type_id, H5T_order_t order);
+# 2463 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_precision(hid_t type_id, size_t prec);
+# 2497 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_offset(hid_t type_id, size_t offset);
+# 2516 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_pad(hid_t type_id, H5T_pad_t lsb, H5T_pad_t msb);
+# 2533 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_sign(hid_t type_id, H5T_sign_t sign);
+# 2560 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_fields(hid_t type_id, size_t spos, size_t epos, size_t esize, size_t mpos, size_t msize);
+# 2576 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_ebias(hid_t type_id, size_t ebias);
+# 2594 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_norm(hid_t type_id, H5T_norm_t norm);
+# 2615 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_inpad(hid_t type_id, H5T_pad_t pad);
+# 2648 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_cset(hid_t type_id, H5T_cset_t cset);
+# 2680 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tset_strpad(hid_t type_id, H5T_str_t strpad);
+# 2730 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tregister(H5T_pers_t pers, const char *name, hid_t src_id, hid_t dst_id, H5T_conv_t func);
+# 2765 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tunregister(H5T_pers_t pers, const char *name, hid_t src_id, hid_t dst_id, H5T_conv_t func);
+# 2785 "/usr/include/hdf5/serial/H5Tpublic.h"
+ H5T_conv_t H5Tfind(hid_t src_id, hid_t dst_id, H5T_cdata_t **pcdata);
+# 2805 "/usr/include/hdf5/serial/H5Tpublic.h"
+ htri_t H5Tcompiler_conv(hid_t src_id, hid_t dst_id);
+# 2846 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tconvert(hid_t src_id, hid_t dst_id, size_t nelmts, void *buf, void *background,
+                         hid_t plist_id);
+# 2870 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Treclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void *buf);
+# 2928 "/usr/include/hdf5/serial/H5Tpublic.h"
+ herr_t H5Tcommit1(hid_t loc_id, const char *name, hid_t type_id);
+# 2954 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Topen1(hid_t loc_id, const char *name);
+# 2989 "/usr/include/hdf5/serial/H5Tpublic.h"
+ hid_t H5Tarray_create1(hid_t base_id, int ndims, const hsize_t dim[ ],
+                              const int perm[ ]);
+# 3017 "/usr/include/hdf5/serial/H5Tpublic.h"
+ int H5Tget_array_dims1(hid_t type_id, hsize_t dims[], int perm[]);
+# 31 "/usr/include/hdf5/serial/H5Lpublic.h" 2
+# 76 "/usr/include/hdf5/serial/H5Lpublic.h"
+typedef enum {
+    H5L_TYPE_ERROR = (-1),
+    H5L_TYPE_HARD = 0,
+    H5L_TYPE_SOFT = 1,
+    H5L_TYPE_EXTERNAL = 64,
+    H5L_TYPE_MAX = 255
+} H5L_type_t;
+# 96 "/usr/include/hdf5/serial/H5Lpublic.h"
+typedef struct {
+    H5L_type_t type;
+    hbool_t corder_valid;
+    int64_t corder;
+    H5T_cset_t cset;
+    union {
+        haddr_t address;
+        size_t val_size;
+    } u;
+} H5L_info_t;
+# 116 "/usr/include/hdf5/serial/H5Lpublic.h"
+typedef herr_t (*H5L_create_func_t)(const char *link_name, hid_t loc_group, const void *lnkdata,
+                                    size_t lnkdata_size, hid_t lcpl_id);
+
+
+
+typedef herr_t (*H5L_move_func_t)(const char *new_name, hid_t new_loc, const void *lnkdata,
+                                  size_t lnkdata_size);
+
+
+
+typedef herr_t (*H5L_copy_func_t)(const char *new_name, hid_t new_loc, const void *lnkdata,
+                                  size_t lnkdata_size);
+typedef hid_t (*H5L_traverse_0_func_t)(const char *link_name, hid_t cur_group, const void *lnkdata,
+                                       size_t lnkdata_size, hid_t lapl_id);
+
+
+
+typedef hid_t (*H5L_traverse_func_t)(const char *link_name, hid_t cur_group, const void *lnkdata,
+                                     size_t lnkdata_size, hid_t lapl_id, hid_t dxpl_id);
+
+
+
+typedef herr_t (*H5L_delete_func_t)(const char *link_name, hid_t file, const void *lnkdata,
+                                    size_t lnkdata_size);
+
+
+
+
+
+typedef ssize_t (*H5L_query_func_t)(const char *link_name, const void *lnkdata, size_t lnkdata_size,
+                                    void *buf , size_t buf_size);
+
+
+typedef struct {
+    int version;
+    H5L_type_t id;
+    const char * comment;
+    H5L_create_func_t create_func;
+    H5L_move_func_t move_func;
+    H5L_copy_func_t copy_func;
+    H5L_traverse_0_func_t trav_func;
+    H5L_delete_func_t del_func;
+    H5L_query_func_t query_func;
+} H5L_class_0_t;
+# 169 "/usr/include/hdf5/serial/H5Lpublic.h"
+typedef struct {
+    int version;
+    H5L_type_t id;
+    const char * comment;
+    H5L_create_func_t create_func;
+    H5L_move_func_t move_func;
+    H5L_copy_func_t copy_func;
+    H5L_traverse_func_t trav_func;
+    H5L_delete_func_t del_func;
+    H5L_query_func_t query_func;
+} H5L_class_t;
+
+
+
+
+
+
+typedef herr_t (*H5L_iterate_t)(hid_t group, const char *name, const H5L_info_t *info, void *op_data);
+
+
+
+
+
+typedef herr_t (*H5L_elink_traverse_t)(const char *parent_file_name, const char *parent_group_name,
+                                       const char *child_file_name, const char *child_object_name,
+                                       unsigned *acc_flags, hid_t fapl_id, void *op_data);
+# 259 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lmove(hid_t src_loc, const char *src_name, hid_t dst_loc, const char *dst_name, hid_t lcpl_id,
+                      hid_t lapl_id);
+# 319 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lcopy(hid_t src_loc, const char *src_name, hid_t dst_loc, const char *dst_name, hid_t lcpl_id,
+                      hid_t lapl_id);
+# 367 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lcreate_hard(hid_t cur_loc, const char *cur_name, hid_t dst_loc, const char *dst_name,
+                             hid_t lcpl_id, hid_t lapl_id);
+# 431 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lcreate_soft(const char *link_target, hid_t link_loc_id, const char *link_name, hid_t lcpl_id,
+                             hid_t lapl_id);
+# 469 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Ldelete(hid_t loc_id, const char *name, hid_t lapl_id);
+# 496 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Ldelete_by_idx(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                               H5_iter_order_t order, hsize_t n, hid_t lapl_id);
+# 551 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lget_val(hid_t loc_id, const char *name, void *buf , size_t size, hid_t lapl_id);
+# 607 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lget_val_by_idx(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                                H5_iter_order_t order, hsize_t n, void *buf , size_t size,
+                                hid_t lapl_id);
+# 695 "/usr/include/hdf5/serial/H5Lpublic.h"
+ htri_t H5Lexists(hid_t loc_id, const char *name, hid_t lapl_id);
+# 768 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lget_info(hid_t loc_id, const char *name, H5L_info_t *linfo, hid_t lapl_id);
+# 821 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lget_info_by_idx(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                                 H5_iter_order_t order, hsize_t n, H5L_info_t *linfo, hid_t lapl_id);
+# 874 "/usr/include/hdf5/serial/H5Lpublic.h"
+ ssize_t H5Lget_name_by_idx(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                                  H5_iter_order_t order, hsize_t n, char *name , size_t size,
+                                  hid_t lapl_id);
+# 943 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Literate(hid_t grp_id, H5_index_t idx_type, H5_iter_order_t order, hsize_t *idx,
+                         H5L_iterate_t op, void *op_data);
+# 1009 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Literate_by_name(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                                 H5_iter_order_t order, hsize_t *idx, H5L_iterate_t op, void *op_data,
+                                 hid_t lapl_id);
+# 1093 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lvisit(hid_t grp_id, H5_index_t idx_type, H5_iter_order_t order, H5L_iterate_t op,
+                       void *op_data);
+# 1176 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lvisit_by_name(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                               H5_iter_order_t order, H5L_iterate_t op, void *op_data, hid_t lapl_id);
+# 1221 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lcreate_ud(hid_t link_loc_id, const char *link_name, H5L_type_t link_type, const void *udata,
+                           size_t udata_size, hid_t lcpl_id, hid_t lapl_id);
+# 1377 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lregister(const H5L_class_t *cls);
+# 1395 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lunregister(H5L_type_t id);
+# 1415 "/usr/include/hdf5/serial/H5Lpublic.h"
+ htri_t H5Lis_registered(H5L_type_t id);
+# 1461 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lunpack_elink_val(const void *ext_linkval , size_t link_size, unsigned *flags,
+                                  const char **filename , const char **obj_path );
+# 1590 "/usr/include/hdf5/serial/H5Lpublic.h"
+ herr_t H5Lcreate_external(const char *file_name, const char *obj_name, hid_t link_loc_id,
+                                 const char *link_name, hid_t lcpl_id, hid_t lapl_id);
+# 32 "/usr/include/hdf5/serial/H5Opublic.h" 2
+# 101 "/usr/include/hdf5/serial/H5Opublic.h"
+typedef enum H5O_type_t {
+    H5O_TYPE_UNKNOWN = -1,
+    H5O_TYPE_GROUP,
+    H5O_TYPE_DATASET,
+    H5O_TYPE_NAMED_DATATYPE,
+    H5O_TYPE_NTYPES
+} H5O_type_t;
+
+
+
+
+
+
+
+typedef struct H5O_hdr_info_t {
+    unsigned version;
+    unsigned nmesgs;
+    unsigned nchunks;
+    unsigned flags;
+    struct {
+        hsize_t total;
+        hsize_t meta;
+        hsize_t mesg;
+        hsize_t free;
+    } space;
+    struct {
+        uint64_t present;
+        uint64_t shared;
+    } mesg;
+} H5O_hdr_info_t;
+
+
+
+
+
+
+
+typedef struct H5O_info_t {
+    unsigned long fileno;
+    haddr_t addr;
+    H5O_type_t type;
+    unsigned rc;
+    time_t atime;
+    time_t mtime;
+    time_t ctime;
+    time_t btime;
+    hsize_t num_attrs;
+    H5O_hdr_info_t hdr;
+    struct {
+        H5_ih_info_t obj;
+        H5_ih_info_t attr;
+    } meta_size;
+} H5O_info_t;
+
+
+
+
+
+typedef uint32_t H5O_msg_crt_idx_t;
+# 176 "/usr/include/hdf5/serial/H5Opublic.h"
+typedef herr_t (*H5O_iterate_t)(hid_t obj, const char *name, const H5O_info_t *info, void *op_data);
+
+
+
+typedef enum H5O_mcdt_search_ret_t {
+    H5O_MCDT_SEARCH_ERROR = -1,
+    H5O_MCDT_SEARCH_CONT,
+
+    H5O_MCDT_SEARCH_STOP
+
+} H5O_mcdt_search_ret_t;
+
+
+
+
+
+
+
+typedef H5O_mcdt_search_ret_t (*H5O_mcdt_search_cb_t)(void *op_data);
+# 250 "/usr/include/hdf5/serial/H5Opublic.h"
+ hid_t H5Oopen(hid_t loc_id, const char *name, hid_t lapl_id);
+# 298 "/usr/include/hdf5/serial/H5Opublic.h"
+ hid_t H5Oopen_by_addr(hid_t loc_id, haddr_t addr);
+# 354 "/usr/include/hdf5/serial/H5Opublic.h"
+ hid_t H5Oopen_by_idx(hid_t loc_id, const char *group_name, H5_index_t idx_type, H5_iter_order_t order,
+                            hsize_t n, hid_t lapl_id);
+# 448 "/usr/include/hdf5/serial/H5Opublic.h"
+ htri_t H5Oexists_by_name(hid_t loc_id, const char *name, hid_t lapl_id);
+# 491 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oget_info2(hid_t loc_id, H5O_info_t *oinfo, unsigned fields);
+# 523 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oget_info_by_name2(hid_t loc_id, const char *name, H5O_info_t *oinfo, unsigned fields,
+                                   hid_t lapl_id);
+# 565 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oget_info_by_idx2(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                                  H5_iter_order_t order, hsize_t n, H5O_info_t *oinfo, unsigned fields,
+                                  hid_t lapl_id);
+# 635 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Olink(hid_t obj_id, hid_t new_loc_id, const char *new_name, hid_t lcpl_id, hid_t lapl_id);
+# 670 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oincr_refcount(hid_t object_id);
+# 705 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Odecr_refcount(hid_t object_id);
+# 796 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Ocopy(hid_t src_loc_id, const char *src_name, hid_t dst_loc_id, const char *dst_name,
+                      hid_t ocpypl_id, hid_t lcpl_id);
+# 833 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oset_comment(hid_t obj_id, const char *comment);
+# 882 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oset_comment_by_name(hid_t loc_id, const char *name, const char *comment, hid_t lapl_id);
+# 922 "/usr/include/hdf5/serial/H5Opublic.h"
+ ssize_t H5Oget_comment(hid_t obj_id, char *comment, size_t bufsize);
+# 974 "/usr/include/hdf5/serial/H5Opublic.h"
+ ssize_t H5Oget_comment_by_name(hid_t loc_id, const char *name, char *comment, size_t bufsize,
+                                      hid_t lapl_id);
+# 1080 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Ovisit2(hid_t obj_id, H5_index_t idx_type, H5_iter_order_t order, H5O_iterate_t op,
+                        void *op_data, unsigned fields);
+# 1198 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Ovisit_by_name2(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
+                                H5_iter_order_t order, H5O_iterate_t op, void *op_data, unsigned fields,
+                                hid_t lapl_id);
+# 1226 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oclose(hid_t object_id);
+# 1259 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oflush(hid_t obj_id);
+# 1284 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Orefresh(hid_t oid);
+# 1327 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Odisable_mdc_flushes(hid_t object_id);
+# 1368 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oenable_mdc_flushes(hid_t object_id);
+# 1403 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oare_mdc_flushes_disabled(hid_t object_id, hbool_t *are_disabled);
+# 1434 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oget_info(hid_t loc_id, H5O_info_t *oinfo);
+# 1462 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oget_info_by_name(hid_t loc_id, const char *name, H5O_info_t *oinfo, hid_t lapl_id);
+# 1496 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oget_info_by_idx(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                                 H5_iter_order_t order, hsize_t n, H5O_info_t *oinfo, hid_t lapl_id);
+
+ herr_t H5Ovisit(hid_t obj_id, H5_index_t idx_type, H5_iter_order_t order, H5O_iterate_t op,
+                       void *op_data);
+ herr_t H5Ovisit_by_name(hid_t loc_id, const char *obj_name, H5_index_t idx_type, H5_iter_order_t order,
+                               H5O_iterate_t op, void *op_data, hid_t lapl_id);
+# 1574 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oget_info1(hid_t loc_id, H5O_info_t *oinfo);
+# 1609 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oget_info_by_name1(hid_t loc_id, const char *name, H5O_info_t *oinfo, hid_t lapl_id);
+# 1659 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Oget_info_by_idx1(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                                  H5_iter_order_t order, hsize_t n, H5O_info_t *oinfo, hid_t lapl_id);
+# 1759 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Ovisit1(hid_t obj_id, H5_index_t idx_type, H5_iter_order_t order, H5O_iterate_t op,
+                        void *op_data);
+# 1882 "/usr/include/hdf5/serial/H5Opublic.h"
+ herr_t H5Ovisit_by_name1(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
+                                H5_iter_order_t order, H5O_iterate_t op, void *op_data, hid_t lapl_id);
+# 1900 "/usr/include/hdf5/serial/H5Opublic.h"
+typedef struct H5O_stat_t {
+    hsize_t size;
+    hsize_t free;
+    unsigned nmesgs;
+    unsigned nchunks;
+} H5O_stat_t;
+# 23 "/usr/include/hdf5/serial/H5Apublic.h" 2
+
+
+
+
+
+
+typedef struct {
+    hbool_t corder_valid;
+    H5O_msg_crt_idx_t corder;
+    H5T_cset_t cset;
+    hsize_t data_size;
+} H5A_info_t;
+# 56 "/usr/include/hdf5/serial/H5Apublic.h"
+typedef herr_t (*H5A_operator2_t)(hid_t location_id , const char *attr_name ,
+                                  const H5A_info_t *ainfo , void *op_data );
+# 91 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Aclose(hid_t attr_id);
+# 131 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Acreate2(hid_t loc_id, const char *attr_name, hid_t type_id, hid_t space_id, hid_t acpl_id,
+                        hid_t aapl_id);
+# 171 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Acreate_by_name(hid_t loc_id, const char *obj_name, const char *attr_name, hid_t type_id,
+                               hid_t space_id, hid_t acpl_id, hid_t aapl_id, hid_t lapl_id);
+# 198 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Adelete(hid_t loc_id, const char *attr_name);
+# 237 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Adelete_by_idx(hid_t loc_id, const char *obj_name, H5_index_t idx_type, H5_iter_order_t order,
+                               hsize_t n, hid_t lapl_id);
+# 264 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Adelete_by_name(hid_t loc_id, const char *obj_name, const char *attr_name, hid_t lapl_id);
+# 283 "/usr/include/hdf5/serial/H5Apublic.h"
+ htri_t H5Aexists(hid_t obj_id, const char *attr_name);
+# 314 "/usr/include/hdf5/serial/H5Apublic.h"
+ htri_t H5Aexists_by_name(hid_t obj_id, const char *obj_name, const char *attr_name, hid_t lapl_id);
+# 332 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Aget_create_plist(hid_t attr_id);
+# 351 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Aget_info(hid_t attr_id, H5A_info_t *ainfo );
+# 386 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Aget_info_by_idx(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
+                                 H5_iter_order_t order, hsize_t n, H5A_info_t *ainfo , hid_t lapl_id);
+# 415 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Aget_info_by_name(hid_t loc_id, const char *obj_name, const char *attr_name,
+                                  H5A_info_t *ainfo , hid_t lapl_id);
+# 445 "/usr/include/hdf5/serial/H5Apublic.h"
+ ssize_t H5Aget_name(hid_t attr_id, size_t buf_size, char *buf);
+# 487 "/usr/include/hdf5/serial/H5Apublic.h"
+ ssize_t H5Aget_name_by_idx(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
+                                  H5_iter_order_t order, hsize_t n, char *name , size_t size,
+                                  hid_t lapl_id);
+# 508 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Aget_space(hid_t attr_id);
+# 526 "/usr/include/hdf5/serial/H5Apublic.h"
+ hsize_t H5Aget_storage_size(hid_t attr_id);
+# 548 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Aget_type(hid_t attr_id);
+# 601 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Aiterate2(hid_t loc_id, H5_index_t idx_type, H5_iter_order_t order, hsize_t *idx,
+                          H5A_operator2_t op, void *op_data);
+# 658 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Aiterate_by_name(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
+                                 H5_iter_order_t order, hsize_t *idx, H5A_operator2_t op, void *op_data,
+                                 hid_t lapl_id);
+# 693 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Aopen(hid_t obj_id, const char *attr_name, hid_t aapl_id);
+# 735 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Aopen_by_idx(hid_t loc_id, const char *obj_name, H5_index_t idx_type, H5_iter_order_t order,
+                            hsize_t n, hid_t aapl_id, hid_t lapl_id);
+# 776 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Aopen_by_name(hid_t loc_id, const char *obj_name, const char *attr_name, hid_t aapl_id,
+                             hid_t lapl_id);
+# 808 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Aread(hid_t attr_id, hid_t type_id, void *buf);
+# 830 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Arename(hid_t loc_id, const char *old_name, const char *new_name);
+# 859 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Awrite(hid_t attr_id, hid_t type_id, const void *buf);
+# 883 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Arename_by_name(hid_t loc_id, const char *obj_name, const char *old_attr_name,
+                                const char *new_attr_name, hid_t lapl_id);
+# 915 "/usr/include/hdf5/serial/H5Apublic.h"
+typedef herr_t (*H5A_operator1_t)(hid_t location_id , const char *attr_name ,
+                                  void *operator_data );
+# 954 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Acreate1(hid_t loc_id, const char *name, hid_t type_id, hid_t space_id, hid_t acpl_id);
+# 974 "/usr/include/hdf5/serial/H5Apublic.h"
+ int H5Aget_num_attrs(hid_t loc_id);
+# 1006 "/usr/include/hdf5/serial/H5Apublic.h"
+ herr_t H5Aiterate1(hid_t loc_id, unsigned *idx, H5A_operator1_t op, void *op_data);
+# 1032 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Aopen_idx(hid_t loc_id, unsigned idx);
+# 1056 "/usr/include/hdf5/serial/H5Apublic.h"
+ hid_t H5Aopen_name(hid_t loc_id, const char *name);
+# 24 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5ACpublic.h" 1
+# 29 "/usr/include/hdf5/serial/H5ACpublic.h"
+# 1 "/usr/include/hdf5/serial/H5Cpublic.h" 1
+# 34 "/usr/include/hdf5/serial/H5Cpublic.h"
+enum H5C_cache_incr_mode {
+    H5C_incr__off,
+
+
+    H5C_incr__threshold
+
+};
+
+enum H5C_cache_flash_incr_mode {
+    H5C_flash_incr__off,
+
+
+    H5C_flash_incr__add_space
+
+};
+
+enum H5C_cache_decr_mode {
+    H5C_decr__off,
+
+
+    H5C_decr__threshold,
+
+
+    H5C_decr__age_out,
+
+
+    H5C_decr__age_out_with_threshold
+
+};
+# 30 "/usr/include/hdf5/serial/H5ACpublic.h" 2
+# 470 "/usr/include/hdf5/serial/H5ACpublic.h"
+typedef struct H5AC_cache_config_t {
+
+
+    int version;
+
+
+
+
+    hbool_t rpt_fcn_enabled;
+
+
+
+
+
+
+
+    hbool_t open_trace_file;
+# 507 "/usr/include/hdf5/serial/H5ACpublic.h"
+    hbool_t close_trace_file;
+# 519 "/usr/include/hdf5/serial/H5ACpublic.h"
+    char trace_file_name[1024 + 1];
+# 534 "/usr/include/hdf5/serial/H5ACpublic.h"
+    hbool_t evictions_enabled;
+# 554 "/usr/include/hdf5/serial/H5ACpublic.h"
+    hbool_t set_initial_size;
+
+
+
+    size_t initial_size;
+
+
+
+
+
+    double min_clean_fraction;
+# 573 "/usr/include/hdf5/serial/H5ACpublic.h"
+    size_t max_size;
+
+
+
+    size_t min_size;
+
+
+
+    long int epoch_length;
+
+
+
+
+
+
+    enum H5C_cache_incr_mode incr_mode;
+
+
+
+
+    double lower_hr_threshold;
+# 603 "/usr/include/hdf5/serial/H5ACpublic.h"
+    double increment;
+# 615 "/usr/include/hdf5/serial/H5ACpublic.h"
+    hbool_t apply_max_increment;
+
+
+
+    size_t max_increment;
+
+
+
+    enum H5C_cache_flash_incr_mode flash_incr_mode;
+
+
+
+
+    double flash_multiple;
+# 637 "/usr/include/hdf5/serial/H5ACpublic.h"
+    double flash_threshold;
+# 646 "/usr/include/hdf5/serial/H5ACpublic.h"
+    enum H5C_cache_decr_mode decr_mode;
+
+
+
+
+    double upper_hr_threshold;
+# 665 "/usr/include/hdf5/serial/H5ACpublic.h"
+    double decrement;
+# 677 "/usr/include/hdf5/serial/H5ACpublic.h"
+    hbool_t apply_max_decrement;
+
+
+
+    size_t max_decrement;
+
+
+
+    int epochs_before_eviction;
+
+
+
+
+
+    hbool_t apply_empty_reserve;
+
+
+
+    double empty_reserve;
+# 704 "/usr/include/hdf5/serial/H5ACpublic.h"
+    size_t dirty_bytes_threshold;
+# 715 "/usr/include/hdf5/serial/H5ACpublic.h"
+    int metadata_write_strategy;
+# 725 "/usr/include/hdf5/serial/H5ACpublic.h"
+} H5AC_cache_config_t;
+# 740 "/usr/include/hdf5/serial/H5ACpublic.h"
+typedef struct H5AC_cache_image_config_t {
+    int version;
+
+
+
+
+
+    hbool_t generate_image;
+
+
+
+    hbool_t save_resize_status;
+
+
+
+
+    int entry_ageout;
+# 782 "/usr/include/hdf5/serial/H5ACpublic.h"
+} H5AC_cache_image_config_t;
+# 25 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5Dpublic.h" 1
+# 48 "/usr/include/hdf5/serial/H5Dpublic.h"
+typedef enum H5D_layout_t {
+    H5D_LAYOUT_ERROR = -1,
+    H5D_COMPACT = 0,
+    H5D_CONTIGUOUS = 1,
+    H5D_CHUNKED = 2,
+    H5D_VIRTUAL = 3,
+    H5D_NLAYOUTS = 4
+} H5D_layout_t;
+
+
+
+
+
+
+typedef enum H5D_chunk_index_t {
+    H5D_CHUNK_IDX_BTREE = 0,
+    H5D_CHUNK_IDX_SINGLE =
+        1,
+    H5D_CHUNK_IDX_NONE = 2,
+    H5D_CHUNK_IDX_FARRAY = 3,
+    H5D_CHUNK_IDX_EARRAY = 4,
+    H5D_CHUNK_IDX_BT2 = 5,
+    H5D_CHUNK_IDX_NTYPES
+} H5D_chunk_index_t;
+
+
+
+
+
+
+typedef enum H5D_alloc_time_t {
+    H5D_ALLOC_TIME_ERROR = -1,
+    H5D_ALLOC_TIME_DEFAULT = 0,
+    H5D_ALLOC_TIME_EARLY = 1,
+    H5D_ALLOC_TIME_LATE = 2,
+    H5D_ALLOC_TIME_INCR = 3
+} H5D_alloc_time_t;
+
+
+
+
+
+
+typedef enum H5D_space_status_t {
+    H5D_SPACE_STATUS_ERROR = -1,
+    H5D_SPACE_STATUS_NOT_ALLOCATED = 0,
+    H5D_SPACE_STATUS_PART_ALLOCATED = 1,
+    H5D_SPACE_STATUS_ALLOCATED = 2
+
+} H5D_space_status_t;
+
+
+
+
+
+
+typedef enum H5D_fill_time_t {
+    H5D_FILL_TIME_ERROR = -1,
+    H5D_FILL_TIME_ALLOC = 0,
+    H5D_FILL_TIME_NEVER = 1,
+    H5D_FILL_TIME_IFSET = 2
+} H5D_fill_time_t;
+
+
+
+
+
+
+typedef enum H5D_fill_value_t {
+    H5D_FILL_VALUE_ERROR = -1,
+    H5D_FILL_VALUE_UNDEFINED = 0,
+    H5D_FILL_VALUE_DEFAULT = 1,
+    H5D_FILL_VALUE_USER_DEFINED = 2
+} H5D_fill_value_t;
+
+
+
+
+
+
+typedef enum H5D_vds_view_t {
+    H5D_VDS_ERROR = -1,
+    H5D_VDS_FIRST_MISSING = 0,
+    H5D_VDS_LAST_AVAILABLE = 1
+} H5D_vds_view_t;
+# 146 "/usr/include/hdf5/serial/H5Dpublic.h"
+typedef herr_t (*H5D_append_cb_t)(hid_t dataset_id, hsize_t *cur_dims, void *op_data);
+# 164 "/usr/include/hdf5/serial/H5Dpublic.h"
+typedef herr_t (*H5D_operator_t)(void *elem, hid_t type_id, unsigned ndim, const hsize_t *point,
+                                 void *operator_data);
+# 194 "/usr/include/hdf5/serial/H5Dpublic.h"
+typedef herr_t (*H5D_scatter_func_t)(const void **src_buf , size_t *src_buf_bytes_used ,
+                                     void *op_data);
+# 222 "/usr/include/hdf5/serial/H5Dpublic.h"
+typedef herr_t (*H5D_gather_func_t)(const void *dst_buf, size_t dst_buf_bytes_used, void *op_data);
+# 294 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hid_t H5Dcreate2(hid_t loc_id, const char *name, hid_t type_id, hid_t space_id, hid_t lcpl_id,
+                        hid_t dcpl_id, hid_t dapl_id);
+# 336 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hid_t H5Dcreate_anon(hid_t loc_id, hid_t type_id, hid_t space_id, hid_t dcpl_id, hid_t dapl_id);
+# 364 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hid_t H5Dopen2(hid_t loc_id, const char *name, hid_t dapl_id);
+# 390 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hid_t H5Dget_space(hid_t dset_id);
+# 409 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dget_space_status(hid_t dset_id, H5D_space_status_t *allocation);
+# 429 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hid_t H5Dget_type(hid_t dset_id);
+# 447 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hid_t H5Dget_create_plist(hid_t dset_id);
+# 482 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hid_t H5Dget_access_plist(hid_t dset_id);
+# 523 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hsize_t H5Dget_storage_size(hid_t dset_id);
+# 548 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dget_chunk_storage_size(hid_t dset_id, const hsize_t *offset, hsize_t *chunk_bytes);
+# 582 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dget_num_chunks(hid_t dset_id, hid_t fspace_id, hsize_t *nchunks);
+# 613 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dget_chunk_info_by_coord(hid_t dset_id, const hsize_t *offset, unsigned *filter_mask,
+                                         haddr_t *addr, hsize_t *size);
+# 662 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dget_chunk_info(hid_t dset_id, hid_t fspace_id, hsize_t chk_idx, hsize_t *offset,
+                                unsigned *filter_mask, haddr_t *addr, hsize_t *size);
+# 683 "/usr/include/hdf5/serial/H5Dpublic.h"
+ haddr_t H5Dget_offset(hid_t dset_id);
+# 776 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
+                      hid_t dxpl_id, void *buf );
+# 892 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
+                       hid_t dxpl_id, const void *buf);
+# 955 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters, const hsize_t *offset,
+                             size_t data_size, const void *buf);
+# 1011 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dread_chunk(hid_t dset_id, hid_t dxpl_id, const hsize_t *offset, uint32_t *filters,
+                            void *buf);
+# 1044 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id, H5D_operator_t op, void *operator_data);
+# 1078 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dvlen_reclaim(hid_t type_id, hid_t space_id, hid_t dxpl_id, void *buf);
+# 1105 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dvlen_get_buf_size(hid_t dset_id, hid_t type_id, hid_t space_id, hsize_t *size);
+# 1143 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dfill(const void *fill, hid_t fill_type_id, void *buf, hid_t buf_type_id, hid_t space_id);
+# 1206 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dset_extent(hid_t dset_id, const hsize_t size[]);
+# 1231 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dflush(hid_t dset_id);
+# 1255 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Drefresh(hid_t dset_id);
+# 1293 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dscatter(H5D_scatter_func_t op, void *op_data, hid_t type_id, hid_t dst_space_id,
+                         void *dst_buf);
+# 1353 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dgather(hid_t src_space_id, const void *src_buf, hid_t type_id, size_t dst_buf_size,
+                        void *dst_buf, H5D_gather_func_t op, void *op_data);
+# 1377 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dclose(hid_t dset_id);
+
+
+ herr_t H5Ddebug(hid_t dset_id);
+ herr_t H5Dformat_convert(hid_t dset_id);
+ herr_t H5Dget_chunk_index_type(hid_t did, H5D_chunk_index_t *idx_type);
+# 1477 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hid_t H5Dcreate1(hid_t loc_id, const char *name, hid_t type_id, hid_t space_id, hid_t dcpl_id);
+# 1507 "/usr/include/hdf5/serial/H5Dpublic.h"
+ hid_t H5Dopen1(hid_t loc_id, const char *name);
+# 1546 "/usr/include/hdf5/serial/H5Dpublic.h"
+ herr_t H5Dextend(hid_t dset_id, const hsize_t size[]);
+# 26 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5Epublic.h" 1
+# 32 "/usr/include/hdf5/serial/H5Epublic.h"
+typedef enum H5E_type_t { H5E_MAJOR, H5E_MINOR } H5E_type_t;
+
+
+
+
+typedef struct H5E_error2_t {
+    hid_t cls_id;
+
+    hid_t maj_num;
+
+    hid_t min_num;
+
+    unsigned line;
+
+    const char *func_name;
+
+    const char *file_name;
+
+    const char *desc;
+
+} H5E_error2_t;
+# 64 "/usr/include/hdf5/serial/H5Epublic.h"
+extern hid_t H5E_ERR_CLS_g;
+
+
+
+# 1 "/usr/include/hdf5/serial/H5Epubgen.h" 1
+# 64 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_FUNC_g;
+extern hid_t H5E_FILE_g;
+extern hid_t H5E_SOHM_g;
+extern hid_t H5E_SYM_g;
+extern hid_t H5E_PLUGIN_g;
+extern hid_t H5E_VFL_g;
+extern hid_t H5E_INTERNAL_g;
+extern hid_t H5E_BTREE_g;
+extern hid_t H5E_REFERENCE_g;
+extern hid_t H5E_DATASPACE_g;
+extern hid_t H5E_RESOURCE_g;
+extern hid_t H5E_RS_g;
+extern hid_t H5E_FARRAY_g;
+extern hid_t H5E_HEAP_g;
+extern hid_t H5E_ATTR_g;
+extern hid_t H5E_IO_g;
+extern hid_t H5E_EFL_g;
+extern hid_t H5E_TST_g;
+extern hid_t H5E_PAGEBUF_g;
+extern hid_t H5E_FSPACE_g;
+extern hid_t H5E_DATASET_g;
+extern hid_t H5E_STORAGE_g;
+extern hid_t H5E_LINK_g;
+extern hid_t H5E_PLIST_g;
+extern hid_t H5E_DATATYPE_g;
+extern hid_t H5E_OHDR_g;
+extern hid_t H5E_ATOM_g;
+extern hid_t H5E_NONE_MAJOR_g;
+extern hid_t H5E_SLIST_g;
+extern hid_t H5E_ARGS_g;
+extern hid_t H5E_CONTEXT_g;
+extern hid_t H5E_EARRAY_g;
+extern hid_t H5E_PLINE_g;
+extern hid_t H5E_ERROR_g;
+extern hid_t H5E_CACHE_g;
+# 111 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_SEEKERROR_g;
+extern hid_t H5E_READERROR_g;
+extern hid_t H5E_WRITEERROR_g;
+extern hid_t H5E_CLOSEERROR_g;
+extern hid_t H5E_OVERFLOW_g;
+extern hid_t H5E_FCNTL_g;
+# 129 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_NOSPACE_g;
+extern hid_t H5E_CANTALLOC_g;
+extern hid_t H5E_CANTCOPY_g;
+extern hid_t H5E_CANTFREE_g;
+extern hid_t H5E_ALREADYEXISTS_g;
+extern hid_t H5E_CANTLOCK_g;
+extern hid_t H5E_CANTUNLOCK_g;
+extern hid_t H5E_CANTGC_g;
+extern hid_t H5E_CANTGETSIZE_g;
+extern hid_t H5E_OBJOPEN_g;
+# 147 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_CANTRESTORE_g;
+extern hid_t H5E_CANTCOMPUTE_g;
+extern hid_t H5E_CANTEXTEND_g;
+extern hid_t H5E_CANTATTACH_g;
+extern hid_t H5E_CANTUPDATE_g;
+extern hid_t H5E_CANTOPERATE_g;
+
+
+
+
+
+extern hid_t H5E_CANTINIT_g;
+extern hid_t H5E_ALREADYINIT_g;
+extern hid_t H5E_CANTRELEASE_g;
+
+
+
+
+
+
+extern hid_t H5E_CANTGET_g;
+extern hid_t H5E_CANTSET_g;
+extern hid_t H5E_DUPCLASS_g;
+extern hid_t H5E_SETDISALLOWED_g;
+
+
+
+
+
+extern hid_t H5E_CANTMERGE_g;
+extern hid_t H5E_CANTREVIVE_g;
+extern hid_t H5E_CANTSHRINK_g;
+# 190 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_LINKCOUNT_g;
+extern hid_t H5E_VERSION_g;
+extern hid_t H5E_ALIGNMENT_g;
+extern hid_t H5E_BADMESG_g;
+extern hid_t H5E_CANTDELETE_g;
+extern hid_t H5E_BADITER_g;
+extern hid_t H5E_CANTPACK_g;
+extern hid_t H5E_CANTRESET_g;
+extern hid_t H5E_CANTRENAME_g;
+
+
+
+extern hid_t H5E_SYSERRSTR_g;
+# 211 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_NOFILTER_g;
+extern hid_t H5E_CALLBACK_g;
+extern hid_t H5E_CANAPPLY_g;
+extern hid_t H5E_SETLOCAL_g;
+extern hid_t H5E_NOENCODER_g;
+extern hid_t H5E_CANTFILTER_g;
+
+
+
+
+
+
+extern hid_t H5E_CANTOPENOBJ_g;
+extern hid_t H5E_CANTCLOSEOBJ_g;
+extern hid_t H5E_COMPLEN_g;
+extern hid_t H5E_PATH_g;
+
+
+
+extern hid_t H5E_NONE_MINOR_g;
+
+
+
+extern hid_t H5E_OPENERROR_g;
+# 248 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_FILEEXISTS_g;
+extern hid_t H5E_FILEOPEN_g;
+extern hid_t H5E_CANTCREATE_g;
+extern hid_t H5E_CANTOPENFILE_g;
+extern hid_t H5E_CANTCLOSEFILE_g;
+extern hid_t H5E_NOTHDF5_g;
+extern hid_t H5E_BADFILE_g;
+extern hid_t H5E_TRUNCATED_g;
+extern hid_t H5E_MOUNT_g;
+extern hid_t H5E_CANTLOCKFILE_g;
+extern hid_t H5E_CANTUNLOCKFILE_g;
+# 267 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_BADATOM_g;
+extern hid_t H5E_BADGROUP_g;
+extern hid_t H5E_CANTREGISTER_g;
+extern hid_t H5E_CANTINC_g;
+extern hid_t H5E_CANTDEC_g;
+extern hid_t H5E_NOIDS_g;
+# 303 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_CANTFLUSH_g;
+extern hid_t H5E_CANTUNSERIALIZE_g;
+extern hid_t H5E_CANTSERIALIZE_g;
+extern hid_t H5E_CANTTAG_g;
+extern hid_t H5E_CANTLOAD_g;
+extern hid_t H5E_PROTECT_g;
+extern hid_t H5E_NOTCACHED_g;
+extern hid_t H5E_SYSTEM_g;
+extern hid_t H5E_CANTINS_g;
+extern hid_t H5E_CANTPROTECT_g;
+extern hid_t H5E_CANTUNPROTECT_g;
+extern hid_t H5E_CANTPIN_g;
+extern hid_t H5E_CANTUNPIN_g;
+extern hid_t H5E_CANTMARKDIRTY_g;
+extern hid_t H5E_CANTMARKCLEAN_g;
+extern hid_t H5E_CANTMARKUNSERIALIZED_g;
+extern hid_t H5E_CANTMARKSERIALIZED_g;
+extern hid_t H5E_CANTDIRTY_g;
+extern hid_t H5E_CANTCLEAN_g;
+extern hid_t H5E_CANTEXPUNGE_g;
+extern hid_t H5E_CANTRESIZE_g;
+extern hid_t H5E_CANTDEPEND_g;
+extern hid_t H5E_CANTUNDEPEND_g;
+extern hid_t H5E_CANTNOTIFY_g;
+extern hid_t H5E_LOGGING_g;
+extern hid_t H5E_LOGFAIL_g;
+extern hid_t H5E_CANTCORK_g;
+extern hid_t H5E_CANTUNCORK_g;
+
+
+
+
+
+
+
+extern hid_t H5E_TRAVERSE_g;
+extern hid_t H5E_NLINKS_g;
+extern hid_t H5E_NOTREGISTERED_g;
+extern hid_t H5E_CANTMOVE_g;
+extern hid_t H5E_CANTSORT_g;
+
+
+
+
+
+
+
+extern hid_t H5E_MPI_g;
+extern hid_t H5E_MPIERRSTR_g;
+extern hid_t H5E_CANTRECV_g;
+extern hid_t H5E_CANTGATHER_g;
+extern hid_t H5E_NO_INDEPENDENT_g;
+# 365 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_CANTCLIP_g;
+extern hid_t H5E_CANTCOUNT_g;
+extern hid_t H5E_CANTSELECT_g;
+extern hid_t H5E_CANTNEXT_g;
+extern hid_t H5E_BADSELECT_g;
+extern hid_t H5E_CANTCOMPARE_g;
+extern hid_t H5E_INCONSISTENTSTATE_g;
+extern hid_t H5E_CANTAPPEND_g;
+
+
+
+
+
+
+
+extern hid_t H5E_UNINITIALIZED_g;
+extern hid_t H5E_UNSUPPORTED_g;
+extern hid_t H5E_BADTYPE_g;
+extern hid_t H5E_BADRANGE_g;
+extern hid_t H5E_BADVALUE_g;
+# 398 "/usr/include/hdf5/serial/H5Epubgen.h"
+extern hid_t H5E_NOTFOUND_g;
+extern hid_t H5E_EXISTS_g;
+extern hid_t H5E_CANTENCODE_g;
+extern hid_t H5E_CANTDECODE_g;
+extern hid_t H5E_CANTSPLIT_g;
+extern hid_t H5E_CANTREDISTRIBUTE_g;
+extern hid_t H5E_CANTSWAP_g;
+extern hid_t H5E_CANTINSERT_g;
+extern hid_t H5E_CANTLIST_g;
+extern hid_t H5E_CANTMODIFY_g;
+extern hid_t H5E_CANTREMOVE_g;
+
+
+
+
+extern hid_t H5E_CANTCONVERT_g;
+extern hid_t H5E_BADSIZE_g;
+# 69 "/usr/include/hdf5/serial/H5Epublic.h" 2
+# 155 "/usr/include/hdf5/serial/H5Epublic.h"
+typedef enum H5E_direction_t {
+    H5E_WALK_UPWARD = 0,
+    H5E_WALK_DOWNWARD = 1
+} H5E_direction_t;
+# 175 "/usr/include/hdf5/serial/H5Epublic.h"
+typedef herr_t (*H5E_walk2_t)(unsigned n, const H5E_error2_t *err_desc, void *client_data);
+# 187 "/usr/include/hdf5/serial/H5Epublic.h"
+typedef herr_t (*H5E_auto2_t)(hid_t estack, void *client_data);
+# 212 "/usr/include/hdf5/serial/H5Epublic.h"
+ hid_t H5Eregister_class(const char *cls_name, const char *lib_name, const char *version);
+# 228 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eunregister_class(hid_t class_id);
+# 243 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eclose_msg(hid_t err_id);
+# 264 "/usr/include/hdf5/serial/H5Epublic.h"
+ hid_t H5Ecreate_msg(hid_t cls, H5E_type_t msg_type, const char *msg);
+# 279 "/usr/include/hdf5/serial/H5Epublic.h"
+ hid_t H5Ecreate_stack(void);
+# 293 "/usr/include/hdf5/serial/H5Epublic.h"
+ hid_t H5Eget_current_stack(void);
+# 309 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eclose_stack(hid_t stack_id);
+# 332 "/usr/include/hdf5/serial/H5Epublic.h"
+ ssize_t H5Eget_class_name(hid_t class_id, char *name, size_t size);
+# 350 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eset_current_stack(hid_t err_stack_id);
+# 384 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Epush2(hid_t err_stack, const char *file, const char *func, unsigned line, hid_t cls_id,
+                       hid_t maj_id, hid_t min_id, const char *msg, ...);
+# 404 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Epop(hid_t err_stack, size_t count);
+# 435 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eprint2(hid_t err_stack, FILE *stream);
+# 471 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Ewalk2(hid_t err_stack, H5E_direction_t direction, H5E_walk2_t func, void *client_data);
+# 514 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eget_auto2(hid_t estack_id, H5E_auto2_t *func, void **client_data);
+# 550 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eset_auto2(hid_t estack_id, H5E_auto2_t func, void *client_data);
+# 573 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eclear2(hid_t err_stack);
+# 595 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eauto_is_v2(hid_t err_stack, unsigned *is_stack);
+# 621 "/usr/include/hdf5/serial/H5Epublic.h"
+ ssize_t H5Eget_msg(hid_t msg_id, H5E_type_t *type, char *msg, size_t size);
+# 637 "/usr/include/hdf5/serial/H5Epublic.h"
+ ssize_t H5Eget_num(hid_t error_stack_id);
+# 650 "/usr/include/hdf5/serial/H5Epublic.h"
+typedef hid_t H5E_major_t;
+typedef hid_t H5E_minor_t;
+
+
+
+
+typedef struct H5E_error1_t {
+    H5E_major_t maj_num;
+    H5E_minor_t min_num;
+    const char *func_name;
+    const char *file_name;
+    unsigned line;
+    const char *desc;
+} H5E_error1_t;
+# 676 "/usr/include/hdf5/serial/H5Epublic.h"
+typedef herr_t (*H5E_walk1_t)(int n, H5E_error1_t *err_desc, void *client_data);
+# 687 "/usr/include/hdf5/serial/H5Epublic.h"
+typedef herr_t (*H5E_auto1_t)(void *client_data);
+# 707 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eclear1(void);
+# 751 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eget_auto1(H5E_auto1_t *func, void **client_data);
+# 780 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Epush1(const char *file, const char *func, unsigned line, H5E_major_t maj, H5E_minor_t min,
+                       const char *str);
+# 805 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eprint1(FILE *stream);
+# 836 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Eset_auto1(H5E_auto1_t func, void *client_data);
+# 869 "/usr/include/hdf5/serial/H5Epublic.h"
+ herr_t H5Ewalk1(H5E_direction_t direction, H5E_walk1_t func, void *client_data);
+# 890 "/usr/include/hdf5/serial/H5Epublic.h"
+ char *H5Eget_major(H5E_major_t maj);
+# 913 "/usr/include/hdf5/serial/H5Epublic.h"
+ char *H5Eget_minor(H5E_minor_t min);
+# 27 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5Fpublic.h" 1
+# 103 "/usr/include/hdf5/serial/H5Fpublic.h"
+typedef enum H5F_scope_t {
+    H5F_SCOPE_LOCAL = 0,
+    H5F_SCOPE_GLOBAL = 1
+} H5F_scope_t;
+# 116 "/usr/include/hdf5/serial/H5Fpublic.h"
+typedef enum H5F_close_degree_t {
+    H5F_CLOSE_DEFAULT = 0,
+    H5F_CLOSE_WEAK = 1,
+    H5F_CLOSE_SEMI = 2,
+    H5F_CLOSE_STRONG = 3
+} H5F_close_degree_t;
+
+
+
+
+
+typedef struct H5F_info2_t {
+    struct {
+        unsigned version;
+        hsize_t super_size;
+        hsize_t super_ext_size;
+    } super;
+    struct {
+        unsigned version;
+        hsize_t meta_size;
+        hsize_t tot_space;
+    } free;
+    struct {
+        unsigned version;
+        hsize_t hdr_size;
+        H5_ih_info_t msgs_info;
+    } sohm;
+} H5F_info2_t;
+# 154 "/usr/include/hdf5/serial/H5Fpublic.h"
+typedef enum H5F_mem_t {
+    H5FD_MEM_NOLIST = -1,
+
+
+    H5FD_MEM_DEFAULT = 0,
+
+
+
+
+    H5FD_MEM_SUPER = 1,
+    H5FD_MEM_BTREE = 2,
+    H5FD_MEM_DRAW = 3,
+    H5FD_MEM_GHEAP = 4,
+    H5FD_MEM_LHEAP = 5,
+    H5FD_MEM_OHDR = 6,
+
+    H5FD_MEM_NTYPES
+} H5F_mem_t;
+
+
+
+
+
+typedef struct H5F_sect_info_t {
+    haddr_t addr;
+    hsize_t size;
+} H5F_sect_info_t;
+
+
+
+
+
+typedef enum H5F_libver_t {
+    H5F_LIBVER_ERROR = -1,
+    H5F_LIBVER_EARLIEST = 0,
+    H5F_LIBVER_V18 = 1,
+    H5F_LIBVER_V110 = 2,
+    H5F_LIBVER_NBOUNDS
+} H5F_libver_t;
+
+
+
+
+
+
+
+typedef enum H5F_fspace_strategy_t {
+    H5F_FSPACE_STRATEGY_FSM_AGGR = 0,
+
+    H5F_FSPACE_STRATEGY_PAGE =
+        1,
+    H5F_FSPACE_STRATEGY_AGGR = 2,
+    H5F_FSPACE_STRATEGY_NONE = 3,
+    H5F_FSPACE_STRATEGY_NTYPES
+} H5F_fspace_strategy_t;
+
+
+
+
+
+
+
+typedef enum H5F_file_space_type_t {
+    H5F_FILE_SPACE_DEFAULT = 0,
+    H5F_FILE_SPACE_ALL_PERSIST = 1,
+    H5F_FILE_SPACE_ALL = 2,
+
+    H5F_FILE_SPACE_AGGR_VFD = 3,
+    H5F_FILE_SPACE_VFD = 4,
+    H5F_FILE_SPACE_NTYPES
+} H5F_file_space_type_t;
+# 233 "/usr/include/hdf5/serial/H5Fpublic.h"
+typedef struct H5F_retry_info_t {
+    unsigned nbins;
+    uint32_t *retries[21];
+} H5F_retry_info_t;
+
+
+
+
+
+typedef herr_t (*H5F_flush_cb_t)(hid_t object_id, void *udata);
+# 268 "/usr/include/hdf5/serial/H5Fpublic.h"
+ htri_t H5Fis_hdf5(const char *filename);
+# 347 "/usr/include/hdf5/serial/H5Fpublic.h"
+ hid_t H5Fcreate(const char *filename, unsigned flags, hid_t fcpl_id, hid_t fapl_id);
+# 440 "/usr/include/hdf5/serial/H5Fpublic.h"
+ hid_t H5Fopen(const char *filename, unsigned flags, hid_t fapl_id);
+# 466 "/usr/include/hdf5/serial/H5Fpublic.h"
+ hid_t H5Freopen(hid_t file_id);
+# 499 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fflush(hid_t object_id, H5F_scope_t scope);
+# 543 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fclose(hid_t file_id);
+# 561 "/usr/include/hdf5/serial/H5Fpublic.h"
+ hid_t H5Fget_create_plist(hid_t file_id);
+# 574 "/usr/include/hdf5/serial/H5Fpublic.h"
+ hid_t H5Fget_access_plist(hid_t file_id);
+# 601 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_intent(hid_t file_id, unsigned *intent);
+# 636 "/usr/include/hdf5/serial/H5Fpublic.h"
+ ssize_t H5Fget_obj_count(hid_t file_id, unsigned types);
+# 675 "/usr/include/hdf5/serial/H5Fpublic.h"
+ ssize_t H5Fget_obj_ids(hid_t file_id, unsigned types, size_t max_objs, hid_t *obj_id_list);
+# 701 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_vfd_handle(hid_t file_id, hid_t fapl, void **file_handle);
+# 729 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fmount(hid_t loc, const char *name, hid_t child, hid_t plist);
+# 751 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Funmount(hid_t loc, const char *name);
+# 775 "/usr/include/hdf5/serial/H5Fpublic.h"
+ hssize_t H5Fget_freespace(hid_t file_id);
+# 797 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_filesize(hid_t file_id, hsize_t *size);
+# 814 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_eoa(hid_t file_id, haddr_t *eoa);
+# 833 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fincrement_filesize(hid_t file_id, hsize_t increment);
+# 883 "/usr/include/hdf5/serial/H5Fpublic.h"
+ ssize_t H5Fget_file_image(hid_t file_id, void *buf_ptr, size_t buf_len);
+# 909 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_mdc_config(hid_t file_id, H5AC_cache_config_t *config_ptr);
+# 930 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fset_mdc_config(hid_t file_id, H5AC_cache_config_t *config_ptr);
+# 954 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_mdc_hit_rate(hid_t file_id, double *hit_rate_ptr);
+# 985 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_mdc_size(hid_t file_id, size_t *max_size_ptr, size_t *min_clean_size_ptr,
+                              size_t *cur_size_ptr, int *cur_num_entries_ptr);
+# 1014 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Freset_mdc_hit_rate_stats(hid_t file_id);
+# 1053 "/usr/include/hdf5/serial/H5Fpublic.h"
+ ssize_t H5Fget_name(hid_t obj_id, char *name, size_t size);
+# 1098 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_info2(hid_t obj_id, H5F_info2_t *file_info);
+# 1183 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_metadata_read_retry_info(hid_t file_id, H5F_retry_info_t *info);
+# 1216 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fstart_swmr_write(hid_t file_id);
+# 1264 "/usr/include/hdf5/serial/H5Fpublic.h"
+ ssize_t H5Fget_free_sections(hid_t file_id, H5F_mem_t type, size_t nsects,
+                                    H5F_sect_info_t *sect_info );
+# 1288 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fclear_elink_file_cache(hid_t file_id);
+# 1314 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fset_libver_bounds(hid_t file_id, H5F_libver_t low, H5F_libver_t high);
+# 1364 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fstart_mdc_logging(hid_t file_id);
+# 1409 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fstop_mdc_logging(hid_t file_id);
+# 1452 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_mdc_logging_status(hid_t file_id, hbool_t *is_enabled, hbool_t *is_currently_logging);
+
+
+
+
+
+ herr_t H5Fformat_convert(hid_t fid);
+# 1474 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Freset_page_buffering_stats(hid_t file_id);
+# 1502 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2], unsigned hits[2],
+                                          unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+# 1534 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_mdc_image_info(hid_t file_id, haddr_t *image_addr, hsize_t *image_size);
+# 1557 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_dset_no_attrs_hint(hid_t file_id, hbool_t *minimize);
+# 1588 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fset_dset_no_attrs_hint(hid_t file_id, hbool_t minimize);
+# 1696 "/usr/include/hdf5/serial/H5Fpublic.h"
+typedef struct H5F_info1_t {
+    hsize_t super_ext_size;
+    struct {
+        hsize_t hdr_size;
+        H5_ih_info_t msgs_info;
+    } sohm;
+} H5F_info1_t;
+# 1747 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fget_info1(hid_t obj_id, H5F_info1_t *file_info);
+# 1763 "/usr/include/hdf5/serial/H5Fpublic.h"
+ herr_t H5Fset_latest_format(hid_t file_id, hbool_t latest_format);
+# 28 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDpublic.h" 1
+# 28 "/usr/include/hdf5/serial/H5FDpublic.h"
+typedef enum H5F_mem_t H5FD_mem_t;
+# 267 "/usr/include/hdf5/serial/H5FDpublic.h"
+typedef struct H5FD_t H5FD_t;
+
+
+typedef struct H5FD_class_t {
+    const char * name;
+    haddr_t maxaddr;
+    H5F_close_degree_t fc_degree;
+    herr_t (*terminate)(void);
+    hsize_t (*sb_size)(H5FD_t *file);
+    herr_t (*sb_encode)(H5FD_t *file, char *name , unsigned char *p );
+    herr_t (*sb_decode)(H5FD_t *f, const char *name, const unsigned char *p);
+    size_t fapl_size;
+    void *(*fapl_get)(H5FD_t *file);
+    void *(*fapl_copy)(const void *fapl);
+    herr_t (*fapl_free)(void *fapl);
+    size_t dxpl_size;
+    void *(*dxpl_copy)(const void *dxpl);
+    herr_t (*dxpl_free)(void *dxpl);
+    H5FD_t *(*open)(const char *name, unsigned flags, hid_t fapl, haddr_t maxaddr);
+    herr_t (*close)(H5FD_t *file);
+    int (*cmp)(const H5FD_t *f1, const H5FD_t *f2);
+    herr_t (*query)(const H5FD_t *f1, unsigned long *flags);
+    herr_t (*get_type_map)(const H5FD_t *file, H5FD_mem_t *type_map);
+    haddr_t (*alloc)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, hsize_t size);
+    herr_t (*free)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, hsize_t size);
+    haddr_t (*get_eoa)(const H5FD_t *file, H5FD_mem_t type);
+    herr_t (*set_eoa)(H5FD_t *file, H5FD_mem_t type, haddr_t addr);
+    haddr_t (*get_eof)(const H5FD_t *file, H5FD_mem_t type);
+    herr_t (*get_handle)(H5FD_t *file, hid_t fapl, void **file_handle);
+    herr_t (*read)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl, haddr_t addr, size_t size, void *buffer);
+    herr_t (*write)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl, haddr_t addr, size_t size, const void *buffer);
+    herr_t (*flush)(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
+    herr_t (*truncate)(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
+    herr_t (*lock)(H5FD_t *file, hbool_t rw);
+    herr_t (*unlock)(H5FD_t *file);
+    H5FD_mem_t fl_map[H5FD_MEM_NTYPES];
+} H5FD_class_t;
+
+
+typedef struct H5FD_free_t {
+    haddr_t addr;
+    hsize_t size;
+    struct H5FD_free_t *next;
+} H5FD_free_t;
+
+
+
+
+
+struct H5FD_t {
+    hid_t driver_id;
+    const H5FD_class_t *cls;
+    unsigned long fileno;
+    unsigned access_flags;
+    unsigned long feature_flags;
+    haddr_t maxaddr;
+    haddr_t base_addr;
+
+
+    hsize_t threshold;
+    hsize_t alignment;
+    hbool_t paged_aggr;
+};
+
+
+
+
+
+typedef enum {
+    H5FD_FILE_IMAGE_OP_NO_OP,
+    H5FD_FILE_IMAGE_OP_PROPERTY_LIST_SET,
+
+
+
+    H5FD_FILE_IMAGE_OP_PROPERTY_LIST_COPY,
+
+
+    H5FD_FILE_IMAGE_OP_PROPERTY_LIST_GET,
+
+
+    H5FD_FILE_IMAGE_OP_PROPERTY_LIST_CLOSE,
+
+
+    H5FD_FILE_IMAGE_OP_FILE_OPEN,
+
+
+
+
+
+
+
+    H5FD_FILE_IMAGE_OP_FILE_RESIZE,
+
+
+    H5FD_FILE_IMAGE_OP_FILE_CLOSE
+
+
+} H5FD_file_image_op_t;
+
+
+
+
+
+
+typedef struct {
+# 381 "/usr/include/hdf5/serial/H5FDpublic.h"
+    void *(*image_malloc)(size_t size, H5FD_file_image_op_t file_image_op, void *udata);
+# 393 "/usr/include/hdf5/serial/H5FDpublic.h"
+    void *(*image_memcpy)(void *dest, const void *src, size_t size, H5FD_file_image_op_t file_image_op,
+                          void *udata);
+# 405 "/usr/include/hdf5/serial/H5FDpublic.h"
+    void *(*image_realloc)(void *ptr, size_t size, H5FD_file_image_op_t file_image_op, void *udata);
+
+
+
+
+
+
+    herr_t (*image_free)(void *ptr, H5FD_file_image_op_t file_image_op, void *udata);
+
+
+
+
+
+
+    void *(*udata_copy)(void *udata);
+
+
+
+
+
+
+    herr_t (*udata_free)(void *udata);
+# 435 "/usr/include/hdf5/serial/H5FDpublic.h"
+    void *udata;
+} H5FD_file_image_callbacks_t;
+
+
+
+
+
+
+
+ hid_t H5FDregister(const H5FD_class_t *cls);
+ herr_t H5FDunregister(hid_t driver_id);
+ H5FD_t *H5FDopen(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+ herr_t H5FDclose(H5FD_t *file);
+ int H5FDcmp(const H5FD_t *f1, const H5FD_t *f2);
+ int H5FDquery(const H5FD_t *f, unsigned long *flags);
+ haddr_t H5FDalloc(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, hsize_t size);
+ herr_t H5FDfree(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, hsize_t size);
+ haddr_t H5FDget_eoa(H5FD_t *file, H5FD_mem_t type);
+ herr_t H5FDset_eoa(H5FD_t *file, H5FD_mem_t type, haddr_t eoa);
+ haddr_t H5FDget_eof(H5FD_t *file, H5FD_mem_t type);
+ herr_t H5FDget_vfd_handle(H5FD_t *file, hid_t fapl, void **file_handle);
+ herr_t H5FDread(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                        void *buf );
+ herr_t H5FDwrite(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                         const void *buf);
+ herr_t H5FDflush(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
+ herr_t H5FDtruncate(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
+ herr_t H5FDlock(H5FD_t *file, hbool_t rw);
+ herr_t H5FDunlock(H5FD_t *file);
+
+
+ herr_t H5FDdriver_query(hid_t driver_id, unsigned long *flags );
+# 29 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5Gpublic.h" 1
+# 48 "/usr/include/hdf5/serial/H5Gpublic.h"
+typedef enum H5G_storage_type_t {
+    H5G_STORAGE_TYPE_UNKNOWN = -1,
+    H5G_STORAGE_TYPE_SYMBOL_TABLE,
+
+    H5G_STORAGE_TYPE_COMPACT,
+    H5G_STORAGE_TYPE_DENSE
+} H5G_storage_type_t;
+
+
+
+
+
+
+
+typedef struct H5G_info_t {
+    H5G_storage_type_t storage_type;
+    hsize_t nlinks;
+    int64_t max_corder;
+    hbool_t mounted;
+} H5G_info_t;
+# 126 "/usr/include/hdf5/serial/H5Gpublic.h"
+ hid_t H5Gcreate2(hid_t loc_id, const char *name, hid_t lcpl_id, hid_t gcpl_id, hid_t gapl_id);
+# 175 "/usr/include/hdf5/serial/H5Gpublic.h"
+ hid_t H5Gcreate_anon(hid_t loc_id, hid_t gcpl_id, hid_t gapl_id);
+# 205 "/usr/include/hdf5/serial/H5Gpublic.h"
+ hid_t H5Gopen2(hid_t loc_id, const char *name, hid_t gapl_id);
+# 228 "/usr/include/hdf5/serial/H5Gpublic.h"
+ hid_t H5Gget_create_plist(hid_t group_id);
+# 256 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gget_info(hid_t loc_id, H5G_info_t *ginfo);
+# 290 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gget_info_by_name(hid_t loc_id, const char *name, H5G_info_t *ginfo, hid_t lapl_id);
+# 337 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gget_info_by_idx(hid_t loc_id, const char *group_name, H5_index_t idx_type,
+                                 H5_iter_order_t order, hsize_t n, H5G_info_t *ginfo, hid_t lapl_id);
+# 366 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gflush(hid_t group_id);
+# 391 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Grefresh(hid_t group_id);
+# 417 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gclose(hid_t group_id);
+# 451 "/usr/include/hdf5/serial/H5Gpublic.h"
+typedef enum H5G_obj_t {
+    H5G_UNKNOWN = -1,
+    H5G_GROUP,
+    H5G_DATASET,
+    H5G_TYPE,
+    H5G_LINK,
+    H5G_UDLINK,
+    H5G_RESERVED_5,
+    H5G_RESERVED_6,
+    H5G_RESERVED_7
+} H5G_obj_t;
+# 470 "/usr/include/hdf5/serial/H5Gpublic.h"
+typedef herr_t (*H5G_iterate_t)(hid_t group, const char *name, void *op_data);
+# 479 "/usr/include/hdf5/serial/H5Gpublic.h"
+typedef struct H5G_stat_t {
+    unsigned long fileno[2];
+    unsigned long objno[2];
+    unsigned nlink;
+    H5G_obj_t type;
+    time_t mtime;
+    size_t linklen;
+    H5O_stat_t ohdr;
+} H5G_stat_t;
+# 541 "/usr/include/hdf5/serial/H5Gpublic.h"
+ hid_t H5Gcreate1(hid_t loc_id, const char *name, size_t size_hint);
+# 568 "/usr/include/hdf5/serial/H5Gpublic.h"
+ hid_t H5Gopen1(hid_t loc_id, const char *name);
+# 603 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Glink(hid_t cur_loc_id, H5L_type_t type, const char *cur_name, const char *new_name);
+# 639 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Glink2(hid_t cur_loc_id, const char *cur_name, H5L_type_t type, hid_t new_loc_id,
+                       const char *new_name);
+# 668 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gmove(hid_t src_loc_id, const char *src_name, const char *dst_name);
+# 699 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gmove2(hid_t src_loc_id, const char *src_name, hid_t dst_loc_id, const char *dst_name);
+# 740 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gunlink(hid_t loc_id, const char *name);
+# 778 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gget_linkval(hid_t loc_id, const char *name, size_t size, char *buf );
+# 818 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gset_comment(hid_t loc_id, const char *name, const char *comment);
+# 863 "/usr/include/hdf5/serial/H5Gpublic.h"
+ int H5Gget_comment(hid_t loc_id, const char *name, size_t bufsize, char *buf);
+# 925 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Giterate(hid_t loc_id, const char *name, int *idx, H5G_iterate_t op, void *op_data);
+# 946 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gget_num_objs(hid_t loc_id, hsize_t *num_objs);
+# 1003 "/usr/include/hdf5/serial/H5Gpublic.h"
+ herr_t H5Gget_objinfo(hid_t loc_id, const char *name, hbool_t follow_link,
+                             H5G_stat_t *statbuf );
+# 1051 "/usr/include/hdf5/serial/H5Gpublic.h"
+ ssize_t H5Gget_objname_by_idx(hid_t loc_id, hsize_t idx, char *name, size_t size);
+# 1083 "/usr/include/hdf5/serial/H5Gpublic.h"
+ H5G_obj_t H5Gget_objtype_by_idx(hid_t loc_id, hsize_t idx);
+# 30 "/usr/include/hdf5/serial/hdf5.h" 2
+
+
+# 1 "/usr/include/hdf5/serial/H5MMpublic.h" 1
+# 33 "/usr/include/hdf5/serial/H5MMpublic.h"
+typedef void *(*H5MM_allocate_t)(size_t size, void *alloc_info);
+
+
+
+typedef void (*H5MM_free_t)(void *mem, void *free_info);
+# 33 "/usr/include/hdf5/serial/hdf5.h" 2
+
+# 1 "/usr/include/hdf5/serial/H5Ppublic.h" 1
+# 33 "/usr/include/hdf5/serial/H5Ppublic.h"
+# 1 "/usr/include/hdf5/serial/H5Spublic.h" 1
+# 36 "/usr/include/hdf5/serial/H5Spublic.h"
+typedef enum H5S_class_t {
+    H5S_NO_CLASS = -1,
+    H5S_SCALAR = 0,
+    H5S_SIMPLE = 1,
+    H5S_NULL = 2
+} H5S_class_t;
+
+
+
+
+typedef enum H5S_seloper_t {
+    H5S_SELECT_NOOP = -1,
+    H5S_SELECT_SET = 0,
+    H5S_SELECT_OR,
+
+
+
+
+
+
+
+    H5S_SELECT_AND,
+
+
+
+
+
+
+
+    H5S_SELECT_XOR,
+
+
+
+
+
+
+
+    H5S_SELECT_NOTB,
+
+
+
+
+
+
+
+    H5S_SELECT_NOTA,
+
+
+
+
+
+
+
+    H5S_SELECT_APPEND,
+    H5S_SELECT_PREPEND,
+    H5S_SELECT_INVALID
+} H5S_seloper_t;
+
+
+
+
+typedef enum {
+    H5S_SEL_ERROR = -1,
+    H5S_SEL_NONE = 0,
+    H5S_SEL_POINTS = 1,
+    H5S_SEL_HYPERSLABS = 2,
+    H5S_SEL_ALL = 3,
+    H5S_SEL_N
+} H5S_sel_type;
+# 129 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sclose(hid_t space_id);
+# 148 "/usr/include/hdf5/serial/H5Spublic.h"
+ hid_t H5Scopy(hid_t space_id);
+# 180 "/usr/include/hdf5/serial/H5Spublic.h"
+ hid_t H5Screate(H5S_class_t type);
+# 233 "/usr/include/hdf5/serial/H5Spublic.h"
+ hid_t H5Screate_simple(int rank, const hsize_t dims[], const hsize_t maxdims[]);
+# 257 "/usr/include/hdf5/serial/H5Spublic.h"
+ hid_t H5Sdecode(const void *buf);
+# 295 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sencode(hid_t obj_id, void *buf, size_t *nalloc);
+# 313 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sextent_copy(hid_t dst_id, hid_t src_id);
+# 330 "/usr/include/hdf5/serial/H5Spublic.h"
+ htri_t H5Sextent_equal(hid_t space1_id, hid_t space2_id);
+# 357 "/usr/include/hdf5/serial/H5Spublic.h"
+ int H5Sget_simple_extent_dims(hid_t space_id, hsize_t dims[], hsize_t maxdims[]);
+# 375 "/usr/include/hdf5/serial/H5Spublic.h"
+ int H5Sget_simple_extent_ndims(hid_t space_id);
+# 394 "/usr/include/hdf5/serial/H5Spublic.h"
+ hssize_t H5Sget_simple_extent_npoints(hid_t space_id);
+# 412 "/usr/include/hdf5/serial/H5Spublic.h"
+ H5S_class_t H5Sget_simple_extent_type(hid_t space_id);
+# 432 "/usr/include/hdf5/serial/H5Spublic.h"
+ htri_t H5Sis_simple(hid_t space_id);
+# 450 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sset_extent_none(hid_t space_id);
+# 485 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sset_extent_simple(hid_t space_id, int rank, const hsize_t dims[], const hsize_t max[]);
+# 515 "/usr/include/hdf5/serial/H5Spublic.h"
+ hid_t H5Scombine_hyperslab(hid_t space_id, H5S_seloper_t op, const hsize_t start[],
+                                  const hsize_t stride[], const hsize_t count[], const hsize_t block[]);
+# 538 "/usr/include/hdf5/serial/H5Spublic.h"
+ hid_t H5Scombine_select(hid_t space1_id, H5S_seloper_t op, hid_t space2_id);
+# 573 "/usr/include/hdf5/serial/H5Spublic.h"
+ htri_t H5Sget_regular_hyperslab(hid_t spaceid, hsize_t start[], hsize_t stride[], hsize_t count[],
+                                       hsize_t block[]);
+# 610 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sget_select_bounds(hid_t spaceid, hsize_t start[], hsize_t end[]);
+# 637 "/usr/include/hdf5/serial/H5Spublic.h"
+ hssize_t H5Sget_select_elem_npoints(hid_t spaceid);
+# 669 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sget_select_elem_pointlist(hid_t spaceid, hsize_t startpoint, hsize_t numpoints,
+                                           hsize_t buf[ ]);
+# 702 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sget_select_hyper_blocklist(hid_t spaceid, hsize_t startblock, hsize_t numblocks,
+                                            hsize_t buf[ ]);
+# 720 "/usr/include/hdf5/serial/H5Spublic.h"
+ hssize_t H5Sget_select_hyper_nblocks(hid_t spaceid);
+# 740 "/usr/include/hdf5/serial/H5Spublic.h"
+ hssize_t H5Sget_select_npoints(hid_t spaceid);
+# 779 "/usr/include/hdf5/serial/H5Spublic.h"
+ H5S_sel_type H5Sget_select_type(hid_t spaceid);
+# 801 "/usr/include/hdf5/serial/H5Spublic.h"
+ htri_t H5Sis_regular_hyperslab(hid_t spaceid);
+# 822 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Smodify_select(hid_t space1_id, H5S_seloper_t op, hid_t space2_id);
+# 847 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Soffset_simple(hid_t space_id, const hssize_t *offset);
+# 865 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sselect_adjust(hid_t spaceid, const hssize_t *offset);
+# 885 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sselect_all(hid_t spaceid);
+# 903 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sselect_copy(hid_t dst_id, hid_t src_id);
+# 1002 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sselect_elements(hid_t space_id, H5S_seloper_t op, size_t num_elem, const hsize_t *coord);
+# 1108 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sselect_hyperslab(hid_t space_id, H5S_seloper_t op, const hsize_t start[],
+                                  const hsize_t stride[], const hsize_t count[], const hsize_t block[]);
+# 1131 "/usr/include/hdf5/serial/H5Spublic.h"
+ htri_t H5Sselect_intersect_block(hid_t space_id, const hsize_t *start, const hsize_t *end);
+# 1147 "/usr/include/hdf5/serial/H5Spublic.h"
+ herr_t H5Sselect_none(hid_t spaceid);
+# 1170 "/usr/include/hdf5/serial/H5Spublic.h"
+ hid_t H5Sselect_project_intersection(hid_t src_space_id, hid_t dst_space_id,
+                                            hid_t src_intersect_space_id);
+# 1191 "/usr/include/hdf5/serial/H5Spublic.h"
+ htri_t H5Sselect_shape_same(hid_t space1_id, hid_t space2_id);
+# 1209 "/usr/include/hdf5/serial/H5Spublic.h"
+ htri_t H5Sselect_valid(hid_t spaceid);
+# 34 "/usr/include/hdf5/serial/H5Ppublic.h" 2
+
+# 1 "/usr/include/hdf5/serial/H5Zpublic.h" 1
+# 33 "/usr/include/hdf5/serial/H5Zpublic.h"
+typedef int H5Z_filter_t;
+# 203 "/usr/include/hdf5/serial/H5Zpublic.h"
+typedef enum H5Z_SO_scale_type_t {
+    H5Z_SO_FLOAT_DSCALE = 0,
+    H5Z_SO_FLOAT_ESCALE = 1,
+    H5Z_SO_INT = 2
+} H5Z_SO_scale_type_t;
+# 218 "/usr/include/hdf5/serial/H5Zpublic.h"
+typedef enum H5Z_EDC_t {
+    H5Z_ERROR_EDC = -1,
+    H5Z_DISABLE_EDC = 0,
+    H5Z_ENABLE_EDC = 1,
+    H5Z_NO_EDC = 2
+} H5Z_EDC_t;
+# 232 "/usr/include/hdf5/serial/H5Zpublic.h"
+typedef enum H5Z_cb_return_t {
+    H5Z_CB_ERROR = -1,
+    H5Z_CB_FAIL = 0,
+    H5Z_CB_CONT = 1,
+    H5Z_CB_NO = 2
+} H5Z_cb_return_t;
+
+
+
+
+
+typedef H5Z_cb_return_t (*H5Z_filter_func_t)(H5Z_filter_t filter, void *buf, size_t buf_size, void *op_data);
+
+
+
+
+
+typedef struct H5Z_cb_t {
+    H5Z_filter_func_t func;
+    void * op_data;
+} H5Z_cb_t;
+# 291 "/usr/include/hdf5/serial/H5Zpublic.h"
+typedef htri_t (*H5Z_can_apply_func_t)(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+# 328 "/usr/include/hdf5/serial/H5Zpublic.h"
+typedef herr_t (*H5Z_set_local_func_t)(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+# 362 "/usr/include/hdf5/serial/H5Zpublic.h"
+typedef size_t (*H5Z_func_t)(unsigned int flags, size_t cd_nelmts, const unsigned int cd_values[],
+                             size_t nbytes, size_t *buf_size, void **buf);
+
+
+
+
+
+
+typedef struct H5Z_class2_t {
+    int version;
+    H5Z_filter_t id;
+    unsigned encoder_present;
+    unsigned decoder_present;
+    const char * name;
+    H5Z_can_apply_func_t can_apply;
+    H5Z_set_local_func_t set_local;
+    H5Z_func_t filter;
+} H5Z_class2_t;
+# 564 "/usr/include/hdf5/serial/H5Zpublic.h"
+ herr_t H5Zregister(const void *cls);
+# 592 "/usr/include/hdf5/serial/H5Zpublic.h"
+ herr_t H5Zunregister(H5Z_filter_t id);
+# 606 "/usr/include/hdf5/serial/H5Zpublic.h"
+ htri_t H5Zfilter_avail(H5Z_filter_t id);
+# 663 "/usr/include/hdf5/serial/H5Zpublic.h"
+ herr_t H5Zget_filter_info(H5Z_filter_t filter, unsigned int *filter_config_flags);
+# 676 "/usr/include/hdf5/serial/H5Zpublic.h"
+typedef struct H5Z_class1_t {
+    H5Z_filter_t id;
+    const char * name;
+    H5Z_can_apply_func_t can_apply;
+    H5Z_set_local_func_t set_local;
+    H5Z_func_t filter;
+} H5Z_class1_t;
+# 36 "/usr/include/hdf5/serial/H5Ppublic.h" 2
+# 113 "/usr/include/hdf5/serial/H5Ppublic.h"
+typedef herr_t (*H5P_cls_create_func_t)(hid_t prop_id, void *create_data);
+
+
+
+
+
+
+typedef herr_t (*H5P_cls_copy_func_t)(hid_t new_prop_id, hid_t old_prop_id, void *copy_data);
+
+
+
+
+
+
+typedef herr_t (*H5P_cls_close_func_t)(hid_t prop_id, void *close_data);
+# 143 "/usr/include/hdf5/serial/H5Ppublic.h"
+typedef herr_t (*H5P_prp_cb1_t)(const char *name, size_t size, void *value);
+# 159 "/usr/include/hdf5/serial/H5Ppublic.h"
+typedef herr_t (*H5P_prp_cb2_t)(hid_t prop_id, const char *name, size_t size, void *value);
+
+
+typedef H5P_prp_cb1_t H5P_prp_create_func_t;
+typedef H5P_prp_cb2_t H5P_prp_set_func_t;
+typedef H5P_prp_cb2_t H5P_prp_get_func_t;
+typedef H5P_prp_cb2_t H5P_prp_delete_func_t;
+typedef H5P_prp_cb1_t H5P_prp_copy_func_t;
+
+
+
+
+
+typedef int (*H5P_prp_compare_func_t)(const void *value1, const void *value2, size_t size);
+
+
+typedef H5P_prp_cb1_t H5P_prp_close_func_t;
+
+
+
+
+
+
+typedef herr_t (*H5P_iterate_t)(hid_t id, const char *name, void *iter_data);
+# 193 "/usr/include/hdf5/serial/H5Ppublic.h"
+typedef enum H5D_mpio_actual_chunk_opt_mode_t {
+    H5D_MPIO_NO_CHUNK_OPTIMIZATION = 0,
+
+
+    H5D_MPIO_LINK_CHUNK,
+
+    H5D_MPIO_MULTI_CHUNK
+
+
+
+
+
+} H5D_mpio_actual_chunk_opt_mode_t;
+# 214 "/usr/include/hdf5/serial/H5Ppublic.h"
+typedef enum H5D_mpio_actual_io_mode_t {
+    H5D_MPIO_NO_COLLECTIVE = 0x0,
+
+
+    H5D_MPIO_CHUNK_INDEPENDENT = 0x1,
+
+
+    H5D_MPIO_CHUNK_COLLECTIVE = 0x2,
+
+
+    H5D_MPIO_CHUNK_MIXED = 0x1 | 0x2,
+
+
+
+    H5D_MPIO_CONTIGUOUS_COLLECTIVE = 0x4
+
+} H5D_mpio_actual_io_mode_t;
+
+
+
+
+
+
+typedef enum H5D_mpio_no_collective_cause_t {
+    H5D_MPIO_COLLECTIVE = 0x00,
+
+    H5D_MPIO_SET_INDEPENDENT = 0x01,
+
+    H5D_MPIO_DATATYPE_CONVERSION = 0x02,
+
+    H5D_MPIO_DATA_TRANSFORMS = 0x04,
+
+    H5D_MPIO_MPI_OPT_TYPES_ENV_VAR_DISABLED = 0x08,
+
+    H5D_MPIO_NOT_SIMPLE_OR_SCALAR_DATASPACES = 0x10,
+
+    H5D_MPIO_NOT_CONTIGUOUS_OR_CHUNKED_DATASET = 0x20,
+
+    H5D_MPIO_PARALLEL_FILTERED_WRITES_DISABLED = 0x40,
+
+    H5D_MPIO_ERROR_WHILE_CHECKING_COLLECTIVE_POSSIBLE = 0x80,
+
+    H5D_MPIO_NO_COLLECTIVE_MAX_CAUSE = 0x100
+
+} H5D_mpio_no_collective_cause_t;
+# 267 "/usr/include/hdf5/serial/H5Ppublic.h"
+extern hid_t H5P_CLS_ROOT_ID_g;
+extern hid_t H5P_CLS_OBJECT_CREATE_ID_g;
+extern hid_t H5P_CLS_FILE_CREATE_ID_g;
+extern hid_t H5P_CLS_FILE_ACCESS_ID_g;
+extern hid_t H5P_CLS_DATASET_CREATE_ID_g;
+extern hid_t H5P_CLS_DATASET_ACCESS_ID_g;
+extern hid_t H5P_CLS_DATASET_XFER_ID_g;
+extern hid_t H5P_CLS_FILE_MOUNT_ID_g;
+extern hid_t H5P_CLS_GROUP_CREATE_ID_g;
+extern hid_t H5P_CLS_GROUP_ACCESS_ID_g;
+extern hid_t H5P_CLS_DATATYPE_CREATE_ID_g;
+extern hid_t H5P_CLS_DATATYPE_ACCESS_ID_g;
+extern hid_t H5P_CLS_STRING_CREATE_ID_g;
+extern hid_t H5P_CLS_ATTRIBUTE_CREATE_ID_g;
+extern hid_t H5P_CLS_ATTRIBUTE_ACCESS_ID_g;
+extern hid_t H5P_CLS_OBJECT_COPY_ID_g;
+extern hid_t H5P_CLS_LINK_CREATE_ID_g;
+extern hid_t H5P_CLS_LINK_ACCESS_ID_g;
+
+
+
+extern hid_t H5P_LST_FILE_CREATE_ID_g;
+extern hid_t H5P_LST_FILE_ACCESS_ID_g;
+extern hid_t H5P_LST_DATASET_CREATE_ID_g;
+extern hid_t H5P_LST_DATASET_ACCESS_ID_g;
+extern hid_t H5P_LST_DATASET_XFER_ID_g;
+extern hid_t H5P_LST_FILE_MOUNT_ID_g;
+extern hid_t H5P_LST_GROUP_CREATE_ID_g;
+extern hid_t H5P_LST_GROUP_ACCESS_ID_g;
+extern hid_t H5P_LST_DATATYPE_CREATE_ID_g;
+extern hid_t H5P_LST_DATATYPE_ACCESS_ID_g;
+extern hid_t H5P_LST_ATTRIBUTE_CREATE_ID_g;
+extern hid_t H5P_LST_ATTRIBUTE_ACCESS_ID_g;
+extern hid_t H5P_LST_OBJECT_COPY_ID_g;
+extern hid_t H5P_LST_LINK_CREATE_ID_g;
+extern hid_t H5P_LST_LINK_ACCESS_ID_g;
+# 327 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pclose(hid_t plist_id);
+# 344 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pclose_class(hid_t plist_id);
+# 361 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pcopy(hid_t plist_id);
+# 397 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pcopy_prop(hid_t dst_id, hid_t src_id, const char *name);
+# 515 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pcreate(hid_t cls_id);
+# 621 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pcreate_class(hid_t parent, const char *name, H5P_cls_create_func_t create, void *create_data,
+                             H5P_cls_copy_func_t copy, void *copy_data, H5P_cls_close_func_t close,
+                             void *close_data);
+# 652 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pdecode(const void *buf);
+# 691 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pencode(hid_t plist_id, void *buf, size_t *nalloc);
+# 711 "/usr/include/hdf5/serial/H5Ppublic.h"
+ htri_t H5Pequal(hid_t id1, hid_t id2);
+# 729 "/usr/include/hdf5/serial/H5Ppublic.h"
+ htri_t H5Pexist(hid_t plist_id, const char *name);
+# 761 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget(hid_t plist_id, const char *name, void *value);
+# 824 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pget_class(hid_t plist_id);
+# 968 "/usr/include/hdf5/serial/H5Ppublic.h"
+ char *H5Pget_class_name(hid_t pclass_id);
+# 984 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pget_class_parent(hid_t pclass_id);
+# 1007 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_nprops(hid_t id, size_t *nprops);
+# 1028 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_size(hid_t id, const char *name, size_t *size);
+# 1276 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pinsert2(hid_t plist_id, const char *name, size_t size, void *value, H5P_prp_set_func_t set,
+                         H5P_prp_get_func_t get, H5P_prp_delete_func_t prp_del, H5P_prp_copy_func_t copy,
+                         H5P_prp_compare_func_t compare, H5P_prp_close_func_t close);
+# 1298 "/usr/include/hdf5/serial/H5Ppublic.h"
+ htri_t H5Pisa_class(hid_t plist_id, hid_t pclass_id);
+# 1367 "/usr/include/hdf5/serial/H5Ppublic.h"
+ int H5Piterate(hid_t id, int *idx, H5P_iterate_t iter_func, void *iter_data);
+# 1645 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pregister2(hid_t cls_id, const char *name, size_t size, void *def_value,
+                           H5P_prp_create_func_t create, H5P_prp_set_func_t set, H5P_prp_get_func_t get,
+                           H5P_prp_delete_func_t prp_del, H5P_prp_copy_func_t copy,
+                           H5P_prp_compare_func_t compare, H5P_prp_close_func_t close);
+# 1674 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Premove(hid_t plist_id, const char *name);
+# 1706 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset(hid_t plist_id, const char *name, const void *value);
+# 1725 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Punregister(hid_t pclass_id, const char *name);
+# 1747 "/usr/include/hdf5/serial/H5Ppublic.h"
+ htri_t H5Pall_filters_avail(hid_t plist_id);
+# 1789 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_attr_creation_order(hid_t plist_id, unsigned *crt_order_flags);
+# 1825 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_attr_phase_change(hid_t plist_id, unsigned *max_compact, unsigned *min_dense);
+# 1890 "/usr/include/hdf5/serial/H5Ppublic.h"
+ H5Z_filter_t H5Pget_filter2(hid_t plist_id, unsigned idx, unsigned int *flags ,
+                                   size_t *cd_nelmts , unsigned cd_values[] , size_t namelen,
+                                   char name[], unsigned *filter_config );
+# 1948 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_filter_by_id2(hid_t plist_id, H5Z_filter_t filter_id, unsigned int *flags ,
+                                   size_t *cd_nelmts , unsigned cd_values[] , size_t namelen,
+                                   char name[] , unsigned *filter_config );
+# 1975 "/usr/include/hdf5/serial/H5Ppublic.h"
+ int H5Pget_nfilters(hid_t plist_id);
+# 2007 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_obj_track_times(hid_t plist_id, hbool_t *track_times);
+# 2035 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pmodify_filter(hid_t plist_id, H5Z_filter_t filter, unsigned int flags, size_t cd_nelmts,
+                               const unsigned int cd_values[ ]);
+# 2102 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Premove_filter(hid_t plist_id, H5Z_filter_t filter);
+# 2152 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_attr_creation_order(hid_t plist_id, unsigned crt_order_flags);
+# 2190 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_attr_phase_change(hid_t plist_id, unsigned max_compact, unsigned min_dense);
+# 2248 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_deflate(hid_t plist_id, unsigned level);
+# 2512 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_filter(hid_t plist_id, H5Z_filter_t filter, unsigned int flags, size_t cd_nelmts,
+                            const unsigned int c_values[]);
+# 2555 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_fletcher32(hid_t plist_id);
+# 2585 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_obj_track_times(hid_t plist_id, hbool_t track_times);
+# 2608 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_file_space_page_size(hid_t plist_id, hsize_t *fsp_size);
+# 2638 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_file_space_strategy(hid_t plist_id, H5F_fspace_strategy_t *strategy, hbool_t *persist,
+                                         hsize_t *threshold);
+# 2663 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_istore_k(hid_t plist_id, unsigned *ik );
+# 2695 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_shared_mesg_index(hid_t plist_id, unsigned index_num, unsigned *mesg_type_flags,
+                                       unsigned *min_mesg_size);
+# 2719 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_shared_mesg_nindexes(hid_t plist_id, unsigned *nindexes);
+# 2754 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_shared_mesg_phase_change(hid_t plist_id, unsigned *max_list, unsigned *min_btree);
+# 2776 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_sizes(hid_t plist_id, size_t *sizeof_addr , size_t *sizeof_size );
+# 2809 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_sym_k(hid_t plist_id, unsigned *ik , unsigned *lk );
+# 2826 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_userblock(hid_t plist_id, hsize_t *size);
+# 2850 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_file_space_page_size(hid_t plist_id, hsize_t fsp_size);
+# 2886 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_file_space_strategy(hid_t plist_id, H5F_fspace_strategy_t strategy, hbool_t persist,
+                                         hsize_t threshold);
+# 2917 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_istore_k(hid_t plist_id, unsigned ik);
+# 2985 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_shared_mesg_index(hid_t plist_id, unsigned index_num, unsigned mesg_type_flags,
+                                       unsigned min_mesg_size);
+# 3018 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_shared_mesg_nindexes(hid_t plist_id, unsigned nindexes);
+# 3054 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_shared_mesg_phase_change(hid_t plist_id, unsigned max_list, unsigned min_btree);
+# 3078 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_sizes(hid_t plist_id, size_t sizeof_addr, size_t sizeof_size);
+# 3120 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_sym_k(hid_t plist_id, unsigned ik, unsigned lk);
+# 3138 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_userblock(hid_t plist_id, hsize_t size);
+# 3161 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_alignment(hid_t fapl_id, hsize_t *threshold , hsize_t *alignment );
+# 3196 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_cache(hid_t plist_id, int *mdc_nelmts,
+                           size_t *rdcc_nslots , size_t *rdcc_nbytes , double *rdcc_w0);
+# 3236 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_core_write_tracking(hid_t fapl_id, hbool_t *is_enabled, size_t *page_size);
+# 3360 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pget_driver(hid_t plist_id);
+# 3398 "/usr/include/hdf5/serial/H5Ppublic.h"
+ const void *H5Pget_driver_info(hid_t plist_id);
+# 3415 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_elink_file_cache_size(hid_t plist_id, unsigned *efc_size);
+# 3442 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_evict_on_close(hid_t fapl_id, hbool_t *evict_on_close);
+# 3463 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_family_offset(hid_t fapl_id, hsize_t *offset);
+# 3484 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_fclose_degree(hid_t fapl_id, H5F_close_degree_t *degree);
+# 3536 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_file_image(hid_t fapl_id, void **buf_ptr_ptr, size_t *buf_len_ptr);
+# 3575 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_file_image_callbacks(hid_t fapl_id, H5FD_file_image_callbacks_t *callbacks_ptr);
+# 3592 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_file_locking(hid_t fapl_id, hbool_t *use_file_locking, hbool_t *ignore_when_disabled);
+# 3614 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_gc_references(hid_t fapl_id, unsigned *gc_ref );
+# 3645 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_libver_bounds(hid_t plist_id, H5F_libver_t *low, H5F_libver_t *high);
+# 3683 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr);
+# 3704 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr );
+# 3749 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_mdc_log_options(hid_t plist_id, hbool_t *is_enabled, char *location,
+                                     size_t *location_size, hbool_t *start_on_access);
+# 3770 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_meta_block_size(hid_t fapl_id, hsize_t *size);
+# 3852 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_metadata_read_attempts(hid_t plist_id, unsigned *attempts);
+# 3885 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_multi_type(hid_t fapl_id, H5FD_mem_t *type);
+# 3915 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_object_flush_cb(hid_t plist_id, H5F_flush_cb_t *func, void **udata);
+# 3941 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_perc,
+                                      unsigned *min_raw_perc);
+# 3963 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_sieve_buf_size(hid_t fapl_id, size_t *size );
+# 3982 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_small_data_block_size(hid_t fapl_id, hsize_t *size );
+# 4019 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_alignment(hid_t fapl_id, hsize_t threshold, hsize_t alignment);
+# 4114 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_cache(hid_t plist_id, int mdc_nelmts, size_t rdcc_nslots, size_t rdcc_nbytes,
+                           double rdcc_w0);
+# 4174 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_core_write_tracking(hid_t fapl_id, hbool_t is_enabled, size_t page_size);
+# 4201 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_driver(hid_t plist_id, hid_t driver_id, const void *driver_info);
+# 4273 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_elink_file_cache_size(hid_t plist_id, unsigned efc_size);
+# 4305 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_evict_on_close(hid_t fapl_id, hbool_t evict_on_close);
+# 4337 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_family_offset(hid_t fapl_id, hsize_t offset);
+# 4398 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_fclose_degree(hid_t fapl_id, H5F_close_degree_t degree);
+# 4451 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_file_image(hid_t fapl_id, void *buf_ptr, size_t buf_len);
+# 4621 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_file_image_callbacks(hid_t fapl_id, H5FD_file_image_callbacks_t *callbacks_ptr);
+# 4645 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_file_locking(hid_t fapl_id, hbool_t use_file_locking, hbool_t ignore_when_disabled);
+# 4672 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_gc_references(hid_t fapl_id, unsigned gc_ref);
+# 4810 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_libver_bounds(hid_t plist_id, H5F_libver_t low, H5F_libver_t high);
+# 4840 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr);
+# 4888 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_mdc_log_options(hid_t plist_id, hbool_t is_enabled, const char *location,
+                                     hbool_t start_on_access);
+# 4921 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_meta_block_size(hid_t fapl_id, hsize_t size);
+# 4978 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_metadata_read_attempts(hid_t plist_id, unsigned attempts);
+# 5027 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_multi_type(hid_t fapl_id, H5FD_mem_t type);
+# 5060 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_object_flush_cb(hid_t plist_id, H5F_flush_cb_t func, void *udata);
+# 5095 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_sieve_buf_size(hid_t fapl_id, size_t size);
+# 5133 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_small_data_block_size(hid_t fapl_id, hsize_t size);
+# 5319 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr);
+# 5361 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned min_meta_per,
+                                      unsigned min_raw_per);
+# 5397 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pfill_value_defined(hid_t plist, H5D_fill_value_t *status);
+# 5445 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_alloc_time(hid_t plist_id, H5D_alloc_time_t *alloc_time );
+# 5467 "/usr/include/hdf5/serial/H5Ppublic.h"
+ int H5Pget_chunk(hid_t plist_id, int max_ndims, hsize_t dim[] );
+# 5493 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_chunk_opts(hid_t plist_id, unsigned *opts);
+# 5516 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_dset_no_attrs_hint(hid_t dcpl_id, hbool_t *minimize);
+# 5549 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_external(hid_t plist_id, unsigned idx, size_t name_size, char *name ,
+                              off_t *offset , hsize_t *size );
+# 5567 "/usr/include/hdf5/serial/H5Ppublic.h"
+ int H5Pget_external_count(hid_t plist_id);
+# 5611 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_fill_time(hid_t plist_id, H5D_fill_time_t *fill_time );
+# 5648 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_fill_value(hid_t plist_id, hid_t type_id, void *value );
+# 5683 "/usr/include/hdf5/serial/H5Ppublic.h"
+ H5D_layout_t H5Pget_layout(hid_t plist_id);
+# 5703 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_virtual_count(hid_t dcpl_id, size_t *count );
+# 5746 "/usr/include/hdf5/serial/H5Ppublic.h"
+ ssize_t H5Pget_virtual_dsetname(hid_t dcpl_id, size_t index, char *name , size_t size);
+# 5790 "/usr/include/hdf5/serial/H5Ppublic.h"
+ ssize_t H5Pget_virtual_filename(hid_t dcpl_id, size_t index, char *name , size_t size);
+# 5815 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pget_virtual_srcspace(hid_t dcpl_id, size_t index);
+# 5840 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pget_virtual_vspace(hid_t dcpl_id, size_t index);
+# 5898 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_alloc_time(hid_t plist_id, H5D_alloc_time_t alloc_time);
+# 5941 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_chunk(hid_t plist_id, int ndims, const hsize_t dim[ ]);
+# 5980 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_chunk_opts(hid_t plist_id, unsigned opts);
+# 6008 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_dset_no_attrs_hint(hid_t dcpl_id, hbool_t minimize);
+# 6053 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_external(hid_t plist_id, const char *name, off_t offset, hsize_t size);
+# 6095 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_fill_time(hid_t plist_id, H5D_fill_time_t fill_time);
+# 6145 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_fill_value(hid_t plist_id, hid_t type_id, const void *value);
+# 6181 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_shuffle(hid_t plist_id);
+# 6218 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_layout(hid_t plist_id, H5D_layout_t layout);
+# 6310 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_nbit(hid_t plist_id);
+# 6419 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_scaleoffset(hid_t plist_id, H5Z_SO_scale_type_t scale_type, int scale_factor);
+# 6576 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_szip(hid_t plist_id, unsigned options_mask, unsigned pixels_per_block);
+# 6704 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_virtual(hid_t dcpl_id, hid_t vspace_id, const char *src_file_name,
+                             const char *src_dset_name, hid_t src_space_id);
+# 6739 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_append_flush(hid_t dapl_id, unsigned dims, hsize_t boundary[], H5D_append_cb_t *func,
+                                  void **udata);
+# 6771 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_chunk_cache(hid_t dapl_id, size_t *rdcc_nslots , size_t *rdcc_nbytes ,
+                                 double *rdcc_w0 );
+# 6812 "/usr/include/hdf5/serial/H5Ppublic.h"
+ ssize_t H5Pget_efile_prefix(hid_t dapl_id, char *prefix , size_t size);
+# 6846 "/usr/include/hdf5/serial/H5Ppublic.h"
+ ssize_t H5Pget_virtual_prefix(hid_t dapl_id, char *prefix , size_t size);
+# 6872 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_virtual_printf_gap(hid_t dapl_id, hsize_t *gap_size);
+# 6896 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_virtual_view(hid_t dapl_id, H5D_vds_view_t *view);
+# 6971 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_append_flush(hid_t dapl_id, unsigned ndims, const hsize_t boundary[],
+                                  H5D_append_cb_t func, void *udata);
+# 7092 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_chunk_cache(hid_t dapl_id, size_t rdcc_nslots, size_t rdcc_nbytes, double rdcc_w0);
+# 7160 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_efile_prefix(hid_t dapl_id, const char *prefix);
+# 7186 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_virtual_prefix(hid_t dapl_id, const char *prefix);
+# 7228 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_virtual_printf_gap(hid_t dapl_id, hsize_t gap_size);
+# 7266 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_virtual_view(hid_t dapl_id, H5D_vds_view_t view);
+# 7289 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_btree_ratios(hid_t plist_id, double *left , double *middle ,
+                                  double *right );
+# 7311 "/usr/include/hdf5/serial/H5Ppublic.h"
+ size_t H5Pget_buffer(hid_t plist_id, void **tconv , void **bkg );
+# 7349 "/usr/include/hdf5/serial/H5Ppublic.h"
+ ssize_t H5Pget_data_transform(hid_t plist_id, char *expression , size_t size);
+# 7368 "/usr/include/hdf5/serial/H5Ppublic.h"
+ H5Z_EDC_t H5Pget_edc_check(hid_t plist_id);
+# 7391 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_hyper_vector_size(hid_t fapl_id, size_t *size );
+# 7413 "/usr/include/hdf5/serial/H5Ppublic.h"
+ int H5Pget_preserve(hid_t plist_id);
+# 7439 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, void **operate_data);
+# 7462 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_vlen_mem_manager(hid_t plist_id, H5MM_allocate_t *alloc_func, void **alloc_info,
+                                      H5MM_free_t *free_func, void **free_info);
+# 7494 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_btree_ratios(hid_t plist_id, double left, double middle, double right);
+# 7535 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_buffer(hid_t plist_id, size_t size, void *tconv, void *bkg);
+# 7569 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_data_transform(hid_t plist_id, const char *expression);
+# 7616 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_edc_check(hid_t plist_id, H5Z_EDC_t check);
+# 7647 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_filter_callback(hid_t plist_id, H5Z_filter_func_t func, void *op_data);
+# 7680 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_hyper_vector_size(hid_t plist_id, size_t size);
+# 7708 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_preserve(hid_t plist_id, hbool_t status);
+# 7736 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void *operate_data);
+# 7785 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_vlen_mem_manager(hid_t plist_id, H5MM_allocate_t alloc_func, void *alloc_info,
+                                      H5MM_free_t free_func, void *free_info);
+# 7953 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_create_intermediate_group(hid_t plist_id, unsigned *crt_intmd );
+# 7971 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_create_intermediate_group(hid_t plist_id, unsigned crt_intmd);
+# 8004 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_est_link_info(hid_t plist_id, unsigned *est_num_entries ,
+                                   unsigned *est_name_len );
+# 8029 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_link_creation_order(hid_t plist_id, unsigned *crt_order_flags );
+# 8071 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_link_phase_change(hid_t plist_id, unsigned *max_compact ,
+                                       unsigned *min_dense );
+# 8092 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_local_heap_size_hint(hid_t plist_id, size_t *size_hint );
+# 8131 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_est_link_info(hid_t plist_id, unsigned est_num_entries, unsigned est_name_len);
+# 8190 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_link_creation_order(hid_t plist_id, unsigned crt_order_flags);
+# 8223 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_link_phase_change(hid_t plist_id, unsigned max_compact, unsigned min_dense);
+# 8287 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_local_heap_size_hint(hid_t plist_id, size_t size_hint);
+# 8318 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_char_encoding(hid_t plist_id, H5T_cset_t *encoding );
+# 8359 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_char_encoding(hid_t plist_id, H5T_cset_t encoding);
+# 8402 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_elink_acc_flags(hid_t lapl_id, unsigned *flags);
+# 8445 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_elink_cb(hid_t lapl_id, H5L_elink_traverse_t *func, void **op_data);
+# 8468 "/usr/include/hdf5/serial/H5Ppublic.h"
+ hid_t H5Pget_elink_fapl(hid_t lapl_id);
+# 8499 "/usr/include/hdf5/serial/H5Ppublic.h"
+ ssize_t H5Pget_elink_prefix(hid_t plist_id, char *prefix, size_t size);
+# 8526 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_nlinks(hid_t plist_id, size_t *nlinks);
+# 8575 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_elink_acc_flags(hid_t lapl_id, unsigned flags);
+# 8649 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_elink_cb(hid_t lapl_id, H5L_elink_traverse_t func, void *op_data);
+# 8668 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_elink_fapl(hid_t lapl_id, hid_t fapl_id);
+# 8690 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_elink_prefix(hid_t plist_id, const char *prefix);
+# 8716 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_nlinks(hid_t plist_id, size_t nlinks);
+# 8833 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Padd_merge_committed_dtype_path(hid_t plist_id, const char *path);
+# 8884 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pfree_merge_committed_dtype_paths(hid_t plist_id);
+# 8909 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_copy_object(hid_t plist_id, unsigned *copy_options );
+# 8947 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_mcdt_search_cb(hid_t plist_id, H5O_mcdt_search_cb_t *func, void **op_data);
+# 9040 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_copy_object(hid_t plist_id, unsigned copy_options);
+# 9125 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_mcdt_search_cb(hid_t plist_id, H5O_mcdt_search_cb_t func, void *op_data);
+# 9265 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pregister1(hid_t cls_id, const char *name, size_t size, void *def_value,
+                           H5P_prp_create_func_t prp_create, H5P_prp_set_func_t prp_set,
+                           H5P_prp_get_func_t prp_get, H5P_prp_delete_func_t prp_del,
+                           H5P_prp_copy_func_t prp_copy, H5P_prp_close_func_t prp_close);
+# 9377 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pinsert1(hid_t plist_id, const char *name, size_t size, void *value,
+                         H5P_prp_set_func_t prp_set, H5P_prp_get_func_t prp_get,
+                         H5P_prp_delete_func_t prp_delete, H5P_prp_copy_func_t prp_copy,
+                         H5P_prp_close_func_t prp_close);
+# 9434 "/usr/include/hdf5/serial/H5Ppublic.h"
+ H5Z_filter_t H5Pget_filter1(hid_t plist_id, unsigned filter, unsigned int *flags ,
+                                   size_t *cd_nelmts , unsigned cd_values[] , size_t namelen,
+                                   char name[]);
+# 9489 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_filter_by_id1(hid_t plist_id, H5Z_filter_t id, unsigned int *flags ,
+                                   size_t *cd_nelmts , unsigned cd_values[] , size_t namelen,
+                                   char name[] );
+# 9517 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_version(hid_t plist_id, unsigned *boot , unsigned *freelist ,
+                             unsigned *stab , unsigned *shhdr );
+# 9538 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pset_file_space(hid_t plist_id, H5F_file_space_type_t strategy, hsize_t threshold);
+# 9557 "/usr/include/hdf5/serial/H5Ppublic.h"
+ herr_t H5Pget_file_space(hid_t plist_id, H5F_file_space_type_t *strategy, hsize_t *threshold);
+# 35 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5PLpublic.h" 1
+# 35 "/usr/include/hdf5/serial/H5PLpublic.h"
+typedef enum H5PL_type_t {
+    H5PL_TYPE_ERROR = -1,
+    H5PL_TYPE_FILTER = 0,
+    H5PL_TYPE_NONE = 1
+} H5PL_type_t;
+# 88 "/usr/include/hdf5/serial/H5PLpublic.h"
+ herr_t H5PLset_loading_state(unsigned int plugin_control_mask);
+# 113 "/usr/include/hdf5/serial/H5PLpublic.h"
+ herr_t H5PLget_loading_state(unsigned int *plugin_control_mask );
+# 126 "/usr/include/hdf5/serial/H5PLpublic.h"
+ herr_t H5PLappend(const char *search_path);
+# 139 "/usr/include/hdf5/serial/H5PLpublic.h"
+ herr_t H5PLprepend(const char *search_path);
+# 153 "/usr/include/hdf5/serial/H5PLpublic.h"
+ herr_t H5PLreplace(const char *search_path, unsigned int index);
+# 168 "/usr/include/hdf5/serial/H5PLpublic.h"
+ herr_t H5PLinsert(const char *search_path, unsigned int index);
+# 182 "/usr/include/hdf5/serial/H5PLpublic.h"
+ herr_t H5PLremove(unsigned int index);
+# 206 "/usr/include/hdf5/serial/H5PLpublic.h"
+ ssize_t H5PLget(unsigned int index, char *path_buf , size_t buf_size);
+# 219 "/usr/include/hdf5/serial/H5PLpublic.h"
+ herr_t H5PLsize(unsigned int *num_paths );
+# 36 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5Rpublic.h" 1
+# 52 "/usr/include/hdf5/serial/H5Rpublic.h"
+typedef enum {
+    H5R_BADTYPE = (-1),
+    H5R_OBJECT,
+    H5R_DATASET_REGION,
+    H5R_MAXTYPE
+} H5R_type_t;
+# 66 "/usr/include/hdf5/serial/H5Rpublic.h"
+typedef haddr_t hobj_ref_t;
+# 76 "/usr/include/hdf5/serial/H5Rpublic.h"
+typedef unsigned char hdset_reg_ref_t[(sizeof(haddr_t) + 4)];
+# 123 "/usr/include/hdf5/serial/H5Rpublic.h"
+ herr_t H5Rcreate(void *ref, hid_t loc_id, const char *name, H5R_type_t ref_type, hid_t space_id);
+# 164 "/usr/include/hdf5/serial/H5Rpublic.h"
+ hid_t H5Rdereference2(hid_t obj_id, hid_t oapl_id, H5R_type_t ref_type, const void *ref);
+# 194 "/usr/include/hdf5/serial/H5Rpublic.h"
+ hid_t H5Rget_region(hid_t dataset, H5R_type_t ref_type, const void *ref);
+# 250 "/usr/include/hdf5/serial/H5Rpublic.h"
+ herr_t H5Rget_obj_type2(hid_t id, H5R_type_t ref_type, const void *_ref, H5O_type_t *obj_type);
+# 308 "/usr/include/hdf5/serial/H5Rpublic.h"
+ ssize_t H5Rget_name(hid_t loc_id, H5R_type_t ref_type, const void *ref, char *name ,
+                           size_t size);
+# 379 "/usr/include/hdf5/serial/H5Rpublic.h"
+ H5G_obj_t H5Rget_obj_type1(hid_t id, H5R_type_t ref_type, const void *ref);
+# 421 "/usr/include/hdf5/serial/H5Rpublic.h"
+ hid_t H5Rdereference1(hid_t obj_id, H5R_type_t ref_type, const void *ref);
+# 37 "/usr/include/hdf5/serial/hdf5.h" 2
+
+
+
+
+
+# 1 "/usr/include/hdf5/serial/H5FDcore.h" 1
+# 28 "/usr/include/hdf5/serial/H5FDcore.h"
+ hid_t H5FD_core_init(void);
+# 73 "/usr/include/hdf5/serial/H5FDcore.h"
+ herr_t H5Pset_fapl_core(hid_t fapl_id, size_t increment, hbool_t backing_store);
+# 92 "/usr/include/hdf5/serial/H5FDcore.h"
+ herr_t H5Pget_fapl_core(hid_t fapl_id, size_t *increment , hbool_t *backing_store );
+# 43 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDdirect.h" 1
+# 44 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDfamily.h" 1
+# 29 "/usr/include/hdf5/serial/H5FDfamily.h"
+ hid_t H5FD_family_init(void);
+# 61 "/usr/include/hdf5/serial/H5FDfamily.h"
+ herr_t H5Pset_fapl_family(hid_t fapl_id, hsize_t memb_size, hid_t memb_fapl_id);
+# 81 "/usr/include/hdf5/serial/H5FDfamily.h"
+ herr_t H5Pget_fapl_family(hid_t fapl_id, hsize_t *memb_size , hid_t *memb_fapl_id );
+# 45 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDhdfs.h" 1
+# 100 "/usr/include/hdf5/serial/H5FDhdfs.h"
+typedef struct H5FD_hdfs_fapl_t {
+    int32_t version;
+    char namenode_name[128 + 1];
+    int32_t namenode_port;
+    char user_name[128 + 1];
+    char kerberos_ticket_cache[128 + 1];
+    int32_t stream_buffer_size;
+} H5FD_hdfs_fapl_t;
+
+
+
+
+
+ hid_t H5FD_hdfs_init(void);
+
+
+
+
+
+
+ herr_t H5Pget_fapl_hdfs(hid_t fapl_id, H5FD_hdfs_fapl_t *fa_out);
+
+
+
+
+
+
+ herr_t H5Pset_fapl_hdfs(hid_t fapl_id, H5FD_hdfs_fapl_t *fa);
+# 46 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDlog.h" 1
+# 68 "/usr/include/hdf5/serial/H5FDlog.h"
+ hid_t H5FD_log_init(void);
+# 472 "/usr/include/hdf5/serial/H5FDlog.h"
+ herr_t H5Pset_fapl_log(hid_t fapl_id, const char *logfile, unsigned long long flags, size_t buf_size);
+# 47 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDmirror.h" 1
+# 48 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDmpi.h" 1
+# 40 "/usr/include/hdf5/serial/H5FDmpi.h"
+typedef enum H5FD_mpio_xfer_t {
+    H5FD_MPIO_INDEPENDENT = 0,
+    H5FD_MPIO_COLLECTIVE
+} H5FD_mpio_xfer_t;
+
+
+typedef enum H5FD_mpio_chunk_opt_t {
+    H5FD_MPIO_CHUNK_DEFAULT = 0,
+    H5FD_MPIO_CHUNK_ONE_IO,
+    H5FD_MPIO_CHUNK_MULTI_IO
+} H5FD_mpio_chunk_opt_t;
+
+
+typedef enum H5FD_mpio_collective_opt_t {
+    H5FD_MPIO_COLLECTIVE_IO = 0,
+    H5FD_MPIO_INDIVIDUAL_IO
+} H5FD_mpio_collective_opt_t;
+
+
+# 1 "/usr/include/hdf5/serial/H5FDmpio.h" 1
+# 60 "/usr/include/hdf5/serial/H5FDmpi.h" 2
+# 49 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDmulti.h" 1
+# 28 "/usr/include/hdf5/serial/H5FDmulti.h"
+ hid_t H5FD_multi_init(void);
+# 158 "/usr/include/hdf5/serial/H5FDmulti.h"
+ herr_t H5Pset_fapl_multi(hid_t fapl_id, const H5FD_mem_t *memb_map, const hid_t *memb_fapl,
+                                const char *const *memb_name, const haddr_t *memb_addr, hbool_t relax);
+# 181 "/usr/include/hdf5/serial/H5FDmulti.h"
+ herr_t H5Pget_fapl_multi(hid_t fapl_id, H5FD_mem_t *memb_map , hid_t *memb_fapl ,
+                                char **memb_name , haddr_t *memb_addr , hbool_t *relax );
+# 250 "/usr/include/hdf5/serial/H5FDmulti.h"
+ herr_t H5Pset_fapl_split(hid_t fapl, const char *meta_ext, hid_t meta_plist_id, const char *raw_ext,
+                                hid_t raw_plist_id);
+# 50 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDros3.h" 1
+# 80 "/usr/include/hdf5/serial/H5FDros3.h"
+typedef struct H5FD_ros3_fapl_t {
+    int32_t version;
+    hbool_t authenticate;
+    char aws_region[32 + 1];
+    char secret_id[128 + 1];
+    char secret_key[128 + 1];
+} H5FD_ros3_fapl_t;
+
+
+
+
+
+ hid_t H5FD_ros3_init(void);
+
+
+
+
+
+
+ herr_t H5Pget_fapl_ros3(hid_t fapl_id, H5FD_ros3_fapl_t *fa_out);
+
+
+
+
+
+
+ herr_t H5Pset_fapl_ros3(hid_t fapl_id, H5FD_ros3_fapl_t *fa);
+# 51 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDsec2.h" 1
+# 29 "/usr/include/hdf5/serial/H5FDsec2.h"
+ hid_t H5FD_sec2_init(void);
+ herr_t H5Pset_fapl_sec2(hid_t fapl_id);
+# 52 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDsplitter.h" 1
+# 77 "/usr/include/hdf5/serial/H5FDsplitter.h"
+typedef struct H5FD_splitter_vfd_config_t {
+    int32_t magic;
+    unsigned int version;
+    hid_t rw_fapl_id;
+    hid_t wo_fapl_id;
+    char wo_path[4096 + 1];
+    char log_file_path[4096 + 1];
+    hbool_t ignore_wo_errs;
+} H5FD_splitter_vfd_config_t;
+
+
+
+
+ hid_t H5FD_splitter_init(void);
+
+
+
+
+
+
+ herr_t H5Pset_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *config_ptr);
+
+
+
+
+
+
+ herr_t H5Pget_fapl_splitter(hid_t fapl_id, H5FD_splitter_vfd_config_t *config_ptr);
+# 53 "/usr/include/hdf5/serial/hdf5.h" 2
+# 1 "/usr/include/hdf5/serial/H5FDstdio.h" 1
+# 31 "/usr/include/hdf5/serial/H5FDstdio.h"
+ hid_t H5FD_stdio_init(void);
+# 46 "/usr/include/hdf5/serial/H5FDstdio.h"
+ herr_t H5Pset_fapl_stdio(hid_t fapl_id);
+# 54 "/usr/include/hdf5/serial/hdf5.h" 2
+# 29 "../hlhdf/hlhdf.h" 2
+# 1 "../hlhdf/hlhdf_types.h" 1
+# 77 "../hlhdf/hlhdf_types.h"
+typedef enum HL_FormatSpecifier {
+  HLHDF_UNDEFINED = 0,
+  HLHDF_CHAR,
+  HLHDF_SCHAR,
+  HLHDF_UCHAR,
+  HLHDF_SHORT,
+  HLHDF_USHORT,
+  HLHDF_INT,
+  HLHDF_UINT,
+  HLHDF_LONG,
+  HLHDF_ULONG,
+  HLHDF_LLONG,
+  HLHDF_ULLONG,
+  HLHDF_FLOAT,
+  HLHDF_DOUBLE,
+  HLHDF_LDOUBLE,
+  HLHDF_HSIZE,
+  HLHDF_HSSIZE,
+  HLHDF_HERR,
+  HLHDF_HBOOL,
+  HLHDF_STRING,
+  HLHDF_COMPOUND,
+  HLHDF_ARRAY,
+  HLHDF_HALF,
+  HLHDF_BFLOAT16,
+  HLHDF_END_OF_SPECIFIERS
+} HL_FormatSpecifier;
+
+
+
+
+
+
+
+typedef enum HL_CompressionType {
+  CT_NONE=0,
+  CT_ZLIB,
+  CT_SZLIB
+} HL_CompressionType;
+
+
+
+
+
+typedef enum HL_PredictorType {
+  PT_NONE=0,
+  PT_DELTA
+} HL_PredictorType;
+# 138 "../hlhdf/hlhdf_types.h"
+typedef struct {
+   unsigned super;
+   unsigned freelist;
+   unsigned stab;
+   unsigned shhdr;
+} HL_PropertyVersion;
+
+
+
+
+
+typedef struct {
+   size_t sizeof_addr;
+   size_t sizeof_size;
+} HL_PropertySize;
+
+
+
+
+
+typedef struct {
+   unsigned ik;
+   unsigned lk;
+} HL_PropertySymK;
+
+
+
+
+
+typedef struct {
+
+
+
+  HL_PropertyVersion version;
+
+
+
+
+  hsize_t userblock;
+
+
+
+
+  HL_PropertySize sizes;
+
+
+
+
+  HL_PropertySymK sym_k;
+
+
+
+
+  unsigned istore_k;
+
+
+
+
+
+
+
+  hsize_t meta_block_size;
+
+} HL_FileCreationProperty;
+
+
+
+
+
+typedef struct {
+
+
+
+
+
+   HL_CompressionType type;
+
+
+
+
+
+   int level;
+# 235 "../hlhdf/hlhdf_types.h"
+   unsigned int szlib_mask;
+
+
+
+
+
+   unsigned int szlib_px_per_block;
+# 251 "../hlhdf/hlhdf_types.h"
+   int summary_tile_size;
+# 260 "../hlhdf/hlhdf_types.h"
+   int keep_bits;
+
+
+
+
+
+   int keep_digits;
+# 276 "../hlhdf/hlhdf_types.h"
+   HL_PredictorType predictor;
+} HL_Compression;
+
+
+
+
+
+
+typedef struct {
+   unsigned long long allocations;
+   unsigned long long frees;
+   unsigned long long bytesAllocated;
+   unsigned long long currentBytes;
+   unsigned long long peakBytes;
+   unsigned long long filesOpened;
+   unsigned long long objectsOpened;
+   unsigned long long datasetReads;
+   unsigned long long attributeReads;
+   unsigned long long datasetWrites;
+   unsigned long long attributeWrites;
+   unsigned long long bytesRead;
+   unsigned long long bytesWritten;
+   double fileOpenTime;
+   double datasetReadTime;
+   double attributeReadTime;
+   double datasetWriteTime;
+   double attributeWriteTime;
+} HL_Statistics;
+# 324 "../hlhdf/hlhdf_types.h"
+typedef struct {
+   unsigned long long count;
+   unsigned long long validCount;
+   unsigned long long nodataCount;
+   unsigned long long undetectCount;
+   double min;
+   double max;
+   double sum;
+   double mean;
+   int nbins;
+   double histogramLow;
+   double histogramHigh;
+   unsigned long long histogram[256];
+} HL_DataStatistics;
+
+
+
+
+
+typedef enum HL_Type {
+  UNDEFINED_ID=-1,
+  ATTRIBUTE_ID=0,
+  GROUP_ID,
+  DATASET_ID,
+  TYPE_ID,
+  REFERENCE_ID
+} HL_Type;
+
+
+
+
+
+
+typedef enum HL_DataType {
+  DTYPE_UNDEFINED_ID=-1,
+  HL_SIMPLE=0,
+  HL_ARRAY
+} HL_DataType;
+
+
+
+
+
+typedef enum HL_NodeMark {
+  NMARK_UNDEFINED=-1,
+  NMARK_ORIGINAL=0,
+  NMARK_CREATED,
+  NMARK_CHANGED,
+  NMARK_SELECT,
+  NMARK_SELECTMETA
+} HL_NodeMark;
+
+
+
+
+
+
+
+typedef struct {
+   char attrname[256];
+   size_t offset;
+   size_t size;
+   char format[256];
+   int ndims;
+   size_t dims[4];
+} HL_CompoundTypeAttribute;
+
+
+
+
+
+
+
+typedef struct {
+   char hltypename[256];
+   unsigned long objno[2];
+   size_t size;
+   int nAttrs;
+   int nAllocAttrs;
+   HL_CompoundTypeAttribute** attrs;
+} HL_CompoundTypeDescription;
+
+
+
+
+
+typedef struct _HL_Node HL_Node;
+
+
+
+
+
+typedef struct _HL_NodeList HL_NodeList;
+# 427 "../hlhdf/hlhdf_types.h"
+typedef void (*HL_ReadManyCallback)(int index, const char* filename, HL_NodeList* nodelist, void* userdata);
+
+
+
+
+
+typedef enum HL_AsyncStatus {
+  HL_ASYNC_PENDING=0,
+  HL_ASYNC_RUNNING,
+  HL_ASYNC_DONE,
+  HL_ASYNC_FAILED,
+  HL_ASYNC_CANCELLED
+} HL_AsyncStatus;
+
+
+
+
+
+typedef struct _HL_AsyncOperation HL_AsyncOperation;
+# 459 "../hlhdf/hlhdf_types.h"
+typedef int (*HL_AsyncCallback)(HL_AsyncOperation* op, HL_AsyncStatus status, void* userdata);
+# 30 "../hlhdf/hlhdf.h" 2
+# 1 "../hlhdf/hlhdf_node.h" 1
+# 36 "../hlhdf/hlhdf_node.h"
+HL_Node* HLNode_new(const char* name);
+
+
+
+
+
+
+void HLNode_free(HL_Node* node);
+
+
+
+
+
+
+
+HL_Node* HLNode_newGroup(const char* name);
+
+
+
+
+
+
+
+HL_Node* HLNode_newAttribute(const char* name);
+
+
+
+
+
+
+
+HL_Node* HLNode_newDataset(const char* name);
+
+
+
+
+
+
+
+HL_Node* HLNode_newDatatype(const char* name);
+
+
+
+
+
+
+
+HL_Node* HLNode_newReference(const char* name);
+# 92 "../hlhdf/hlhdf_node.h"
+HL_Node* HLNode_copy(HL_Node* node);
+# 104 "../hlhdf/hlhdf_node.h"
+int HLNode_setScalarValue(HL_Node* node,size_t sz,unsigned char* value,const char* fmt,hid_t typid);
+# 118 "../hlhdf/hlhdf_node.h"
+int HLNode_adoptScalarValue(HL_Node* node,size_t sz,unsigned char* value,void (*freefn)(void*),
+  const char* fmt,hid_t typid);
+# 133 "../hlhdf/hlhdf_node.h"
+int HLNode_setArrayValue(HL_Node* node,size_t sz,int ndims,hsize_t* dims,unsigned char* value,
+      const char* fmt,hid_t typid);
+# 151 "../hlhdf/hlhdf_node.h"
+int HLNode_adoptArrayValue(HL_Node* node,size_t sz,int ndims,hsize_t* dims,unsigned char* value,
+  void (*freefn)(void*),const char* fmt,hid_t typid);
+# 171 "../hlhdf/hlhdf_node.h"
+int HLNode_setExternalArrayValue(HL_Node* node,size_t sz,int ndims,hsize_t* dims,unsigned char* value,
+  void* owner,void (*releasefn)(void*),const char* fmt,hid_t typid);
+# 190 "../hlhdf/hlhdf_node.h"
+int HLNode_borrowArrayValue(HL_Node* node,size_t sz,int ndims,hsize_t* dims,unsigned char* value,
+  const char* fmt,hid_t typid);
+
+
+
+
+
+
+const char* HLNode_getName(HL_Node* node);
+# 207 "../hlhdf/hlhdf_node.h"
+unsigned char* HLNode_getData(HL_Node* node);
+# 217 "../hlhdf/hlhdf_node.h"
+unsigned char* HLNode_getWritableData(HL_Node* node);
+# 229 "../hlhdf/hlhdf_node.h"
+int HLNode_getDataAs(HL_Node* node, HL_FormatSpecifier target, void* out);
+# 238 "../hlhdf/hlhdf_node.h"
+int HLNode_convertData(HL_Node* node, HL_FormatSpecifier target);
+# 248 "../hlhdf/hlhdf_node.h"
+int HLNode_releaseData(HL_Node* node);
+# 258 "../hlhdf/hlhdf_node.h"
+int HLNode_getStatistics(HL_Node* node, HL_DataStatistics* stats);
+
+
+
+
+
+
+size_t HLNode_getDataSize(HL_Node* node);
+
+
+
+
+
+
+unsigned char* HLNode_getRawdata(HL_Node* node);
+
+
+
+
+
+
+size_t HLNode_getRawdataSize(HL_Node* node);
+
+
+
+
+
+
+
+int HLNode_nameEquals(HL_Node* node, const char* name);
+
+
+
+
+
+
+void HLNode_setMark(HL_Node* node, const HL_NodeMark mark);
+
+
+
+
+
+
+HL_NodeMark HLNode_getMark(HL_Node* node);
+
+
+
+
+
+
+
+int HLNode_fetched(HL_Node* node);
+
+
+
+
+
+
+void HLNode_setFetched(HL_Node* node, int fetched);
+
+
+
+
+
+
+
+HL_Type HLNode_getType(HL_Node* node);
+
+
+
+
+
+
+const char* HLNode_getFormatName(HL_Node* node);
+
+
+
+
+
+
+HL_FormatSpecifier HLNode_getFormat(HL_Node* node);
+
+
+
+
+
+
+
+void HLNode_setDataType(HL_Node* node, HL_DataType datatype);
+
+
+
+
+
+
+HL_DataType HLNode_getDataType(HL_Node* node);
+# 362 "../hlhdf/hlhdf_node.h"
+int HLNode_setDimensions(HL_Node* node, int ndims, hsize_t* dims);
+
+
+
+
+
+
+
+void HLNode_getDimensions(HL_Node* node, int* ndims, hsize_t** dims);
+
+
+
+
+
+
+int HLNode_getRank(HL_Node* node);
+
+
+
+
+
+
+
+hsize_t HLNode_getDimension(HL_Node* node, int index);
+# 395 "../hlhdf/hlhdf_node.h"
+hsize_t HLNode_getNumberOfPoints(HL_Node* node);
+
+
+
+
+
+
+void HLNode_setCompoundDescription(HL_Node* node, HL_CompoundTypeDescription* descr);
+
+
+
+
+
+
+HL_CompoundTypeDescription* HLNode_getCompoundDescription(HL_Node* node);
+
+
+
+
+
+
+HL_Compression* HLNode_getCompression(HL_Node* node);
+
+
+
+
+
+
+void HLNode_setCompression(HL_Node* node, HL_Compression* compression);
+# 433 "../hlhdf/hlhdf_node.h"
+int HLNode_commitType(HL_Node* node,hid_t typid);
+# 31 "../hlhdf/hlhdf.h" 2
+# 1 "../hlhdf/hlhdf_nodelist.h" 1
+# 35 "../hlhdf/hlhdf_nodelist.h"
+HL_NodeList* HLNodeList_new(void);
+
+
+
+
+
+
+void HLNodeList_free(HL_NodeList* nodelist);
+
+
+
+
+
+
+
+int HLNodeList_setFileName(HL_NodeList* nodelist, const char* filename);
+# 63 "../hlhdf/hlhdf_nodelist.h"
+int HLNodeList_setLazyLoading(HL_NodeList* nodelist, int lazy);
+
+
+
+
+
+
+int HLNodeList_isLazyLoading(HL_NodeList* nodelist);
+# 84 "../hlhdf/hlhdf_nodelist.h"
+int HLNodeList_setDataBudget(HL_NodeList* nodelist, size_t budget);
+
+
+
+
+
+
+size_t HLNodeList_getDataBudget(HL_NodeList* nodelist);
+
+
+
+
+
+
+
+size_t HLNodeList_getCachedDataSize(HL_NodeList* nodelist);
+# 113 "../hlhdf/hlhdf_nodelist.h"
+int HLNodeList_setComputeStatistics(HL_NodeList* nodelist, int compute);
+
+
+
+
+
+
+int HLNodeList_isComputingStatistics(HL_NodeList* nodelist);
+# 131 "../hlhdf/hlhdf_nodelist.h"
+int HLNodeList_setStatisticsHistogram(HL_NodeList* nodelist, int nbins, double low, double high);
+
+
+
+
+
+
+char* HLNodeList_getFileName(HL_NodeList* nodelist);
+
+
+
+
+
+
+int HLNodeList_getNumberOfNodes(HL_NodeList* nodelist);
+
+
+
+
+
+
+
+HL_Node* HLNodeList_getNodeByIndex(HL_NodeList* nodelist, int index);
+
+
+
+
+
+
+void HLNodeList_markNodes(HL_NodeList* nodelist, const HL_NodeMark mark);
+# 169 "../hlhdf/hlhdf_nodelist.h"
+int HLNodeList_addNode(HL_NodeList* nodelist, HL_Node* node);
+# 179 "../hlhdf/hlhdf_nodelist.h"
+HL_Node* HLNodeList_getNodeByName(HL_NodeList* nodelist,const char* nodeName);
+
+
+
+
+
+
+
+int HLNodeList_hasNodeByName(HL_NodeList* nodelist, const char* nodeName);
+# 197 "../hlhdf/hlhdf_nodelist.h"
+HL_CompoundTypeDescription* HLNodeList_findCompoundDescription(HL_NodeList* nodelist,
+                  unsigned long objno0,
+                  unsigned long objno1);
+# 32 "../hlhdf/hlhdf.h" 2
+# 1 "../hlhdf/hlhdf_read.h" 1
+# 39 "../hlhdf/hlhdf_read.h"
+HL_NodeList* HLNodeList_readFrom(const char* filename, const char* fromPath);
+# 49 "../hlhdf/hlhdf_read.h"
+HL_NodeList* HLNodeList_read(const char* filename);
+# 58 "../hlhdf/hlhdf_read.h"
+int HLNodeList_selectNode(HL_NodeList* nodelist, const char* name);
+
+
+
+
+
+
+
+int HLNodeList_selectAllNodes(HL_NodeList* nodelist);
+# 75 "../hlhdf/hlhdf_read.h"
+int HLNodeList_selectMetadataNodes(HL_NodeList* nodelist);
+# 84 "../hlhdf/hlhdf_read.h"
+int HLNodeList_selectAllMetadataNodes(HL_NodeList* nodelist);
+# 93 "../hlhdf/hlhdf_read.h"
+int HLNodeList_selectOnlyDatasetNodes(HL_NodeList* nodelist);
+# 102 "../hlhdf/hlhdf_read.h"
+int HLNodeList_deselectNode(HL_NodeList* nodelist, const char* name);
+
+
+
+
+
+
+
+int HLNodeList_fetchMarkedNodes(HL_NodeList* nodelist);
+# 119 "../hlhdf/hlhdf_read.h"
+HL_Node* HLNodeList_fetchNode(HL_NodeList* nodelist, const char* name);
+# 137 "../hlhdf/hlhdf_read.h"
+HL_Node* HLNodeList_fetchNodeInto(HL_NodeList* nodelist, const char* name, const char* format,
+  unsigned char* buffer, size_t size, void* owner, void (*releasefn)(void*));
+# 157 "../hlhdf/hlhdf_read.h"
+HL_Node* HLNodeList_fetchDecoded(HL_NodeList* nodelist, const char* name, HL_FormatSpecifier format,
+  double nodataValue, double undetectValue);
+# 170 "../hlhdf/hlhdf_read.h"
+int HLNodeList_fetchStoredStatistics(HL_NodeList* nodelist, const char* name, HL_DataStatistics* stats);
+# 189 "../hlhdf/hlhdf_read.h"
+int HLNodeList_mayContainValues(HL_NodeList* nodelist, const char* name, int rank,
+  const hsize_t* start, const hsize_t* count, double low, double high);
+# 209 "../hlhdf/hlhdf_read.h"
+int HLNodeList_prefetch(HL_NodeList* nodelist, const char** names, int n);
+# 233 "../hlhdf/hlhdf_read.h"
+int HLNodeList_readMany(const char** filenames, int n, int (*selection)(HL_NodeList*), int nworkers,
+                        double timeout, HL_ReadManyCallback callback, void* userdata);
+# 33 "../hlhdf/hlhdf.h" 2
+# 1 "../hlhdf/hlhdf_write.h" 1
+# 38 "../hlhdf/hlhdf_write.h"
+int HLNodeList_write(HL_NodeList* nodelist, HL_FileCreationProperty* property, HL_Compression* compr);
+# 47 "../hlhdf/hlhdf_write.h"
+int HLNodeList_update(HL_NodeList* nodelist, HL_Compression* compr);
+# 34 "../hlhdf/hlhdf.h" 2
+# 1 "../hlhdf/hlhdf_compound.h" 1
+# 35 "../hlhdf/hlhdf_compound.h"
+HL_CompoundTypeDescription* newHL_CompoundTypeDescription(void);
+
+
+
+
+
+
+void freeHL_CompoundTypeDescription(HL_CompoundTypeDescription* typelist);
+# 55 "../hlhdf/hlhdf_compound.h"
+HL_CompoundTypeAttribute* newHL_CompoundTypeAttribute(char* attrname,
+                  size_t offset,
+                  const char* format,
+                  size_t size,
+                  int ndims,
+                  size_t* dims);
+
+
+
+
+
+
+void freeHL_CompoundTypeAttribute(HL_CompoundTypeAttribute* attr);
+# 76 "../hlhdf/hlhdf_compound.h"
+int addHL_CompoundTypeAttribute(HL_CompoundTypeDescription* typelist,
+           HL_CompoundTypeAttribute* attribute);
+
+
+
+
+
+
+
+HL_CompoundTypeDescription* copyHL_CompoundTypeDescription(HL_CompoundTypeDescription* descr);
+# 35 "../hlhdf/hlhdf.h" 2
+# 1 "../hlhdf/hlhdf_async.h" 1
+# 42 "../hlhdf/hlhdf_async.h"
+HL_AsyncOperation* HLNodeList_fetchMarkedNodesAsync(HL_NodeList* nodelist, HL_AsyncCallback callback, void* userdata);
+# 55 "../hlhdf/hlhdf_async.h"
+HL_AsyncOperation* HLNodeList_writeAsync(HL_NodeList* nodelist, HL_FileCreationProperty* property,
+  HL_Compression* compr, HL_AsyncCallback callback, void* userdata);
+# 68 "../hlhdf/hlhdf_async.h"
+HL_AsyncOperation* HLNodeList_updateAsync(HL_NodeList* nodelist, HL_Compression* compr,
+  HL_AsyncCallback callback, void* userdata);
+
+
+
+
+
+
+
+HL_AsyncStatus HLAsyncOperation_poll(HL_AsyncOperation* op);
+
+
+
+
+
+
+
+HL_AsyncStatus HLAsyncOperation_wait(HL_AsyncOperation* op);
+# 94 "../hlhdf/hlhdf_async.h"
+int HLAsyncOperation_cancel(HL_AsyncOperation* op);
+
+
+
+
+
+
+
+void HLAsyncOperation_free(HL_AsyncOperation* op);
+# 36 "../hlhdf/hlhdf.h" 2
+# 63 "../hlhdf/hlhdf.h"
+void HL_disableErrorReporting(void);
+
+
+
+
+
+void HL_enableErrorReporting(void);
+
+
+
+
+
+
+int HL_isErrorReportingEnabled(void);
+
+
+
+
+
+
+
+void HL_init(void);
+# 96 "../hlhdf/hlhdf.h"
+void HL_lockHdf5(void);
+
+
+
+
+
+void HL_unlockHdf5(void);
+
+
+
+
+
+
+
+int HL_isHdf5Threadsafe(void);
+# 124 "../hlhdf/hlhdf.h"
+void HL_setDebugMode(int flag);
+
+
+
+
+
+
+
+int HL_isHDF5File(const char* filename);
+
+
+
+
+
+
+
+HL_FileCreationProperty* HLFileCreationProperty_new(void);
+
+
+
+
+
+
+void HLFileCreationProperty_free(HL_FileCreationProperty* prop);
+# 156 "../hlhdf/hlhdf.h"
+int HL_sizeOfFormat(const char* format);
+# 166 "../hlhdf/hlhdf.h"
+int HL_isFormatSupported(const char* format);
+
+
+
+
+
+
+HL_FormatSpecifier HL_getFormatSpecifier(const char* format);
+
+
+
+
+
+
+const char* HL_getFormatSpecifierString(HL_FormatSpecifier specifier);
+
+
+
+
+
+const char* HL_getHDF5Version(void);
+
+
+
+
+
+
+
+HL_Compression* HLCompression_new(HL_CompressionType type);
+
+
+
+
+
+
+
+HL_Compression* HLCompression_clone(HL_Compression* inv);
+
+
+
+
+
+
+
+void HLCompression_init(HL_Compression* inv,HL_CompressionType type);
+
+
+
+
+
+
+void HLCompression_free(HL_Compression* inv);
+# 227 "../hlhdf/hlhdf.h"
+int HL_getStatistics(HL_Statistics* stats);
+
+
+
+
+
+
+
+void HL_resetStatistics(void);
+# 32 "pyhlhdf_common.h" 2
+# 1 "hlhdf_arrayobject_wrap.h" 1
+# 39 "hlhdf_arrayobject_wrap.h"
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/arrayobject.h" 1
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h" 1
+# 12 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h"
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h" 1
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h" 1
+
+
+
+
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/numpyconfig.h" 1
+
+
+
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/_numpyconfig.h" 1
+# 5 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/numpyconfig.h" 2
+# 9 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h" 2
+# 191 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+enum {
+        NPY_CPU_UNKNOWN_ENDIAN,
+        NPY_CPU_LITTLE,
+        NPY_CPU_BIG
+};
+
+
+
+
+
+typedef Py_intptr_t npy_intp;
+typedef Py_uintptr_t npy_uintp;
+# 291 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+typedef long long npy_longlong;
+typedef unsigned long long npy_ulonglong;
+# 315 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+typedef unsigned char npy_bool;
+# 342 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+    typedef long double npy_longdouble;
+
+
+
+
+
+
+
+typedef signed char npy_byte;
+typedef unsigned char npy_ubyte;
+typedef unsigned short npy_ushort;
+typedef unsigned int npy_uint;
+typedef unsigned long npy_ulong;
+
+
+typedef char npy_char;
+typedef short npy_short;
+typedef int npy_int;
+typedef long npy_long;
+typedef float npy_float;
+typedef double npy_double;
+
+typedef Py_hash_t npy_hash_t;
+# 395 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+typedef struct { double real, imag; } npy_cdouble;
+
+
+
+
+
+
+typedef struct { float real, imag; } npy_cfloat;
+
+
+
+
+
+
+typedef struct { npy_longdouble real, imag; } npy_clongdouble;
+# 452 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 453 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h" 2
+# 524 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+        typedef long npy_int64;
+        typedef unsigned long npy_uint64;
+# 676 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+        typedef int npy_int32;
+        typedef unsigned int npy_uint32;
+        typedef unsigned int npy_ucs4;
+# 733 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+        typedef short npy_int16;
+        typedef unsigned short npy_uint16;
+# 791 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+        typedef signed char npy_int8;
+        typedef unsigned char npy_uint8;
+# 876 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+        typedef double npy_float64;
+        typedef npy_cdouble npy_complex128;
+# 932 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+        typedef float npy_float32;
+        typedef npy_cfloat npy_complex64;
+# 997 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+typedef npy_uint16 npy_half;
+typedef npy_half npy_float16;
+# 1056 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+        typedef npy_longdouble npy_float128;
+        typedef npy_clongdouble npy_complex256;
+# 1079 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+typedef npy_int64 npy_timedelta;
+typedef npy_int64 npy_datetime;
+# 5 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_endian.h" 1
+# 6 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_cpu.h" 1
+# 7 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/utils.h" 1
+# 8 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h" 2
+# 48 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+enum NPY_TYPES { NPY_BOOL=0,
+                    NPY_BYTE, NPY_UBYTE,
+                    NPY_SHORT, NPY_USHORT,
+                    NPY_INT, NPY_UINT,
+                    NPY_LONG, NPY_ULONG,
+                    NPY_LONGLONG, NPY_ULONGLONG,
+                    NPY_FLOAT, NPY_DOUBLE, NPY_LONGDOUBLE,
+                    NPY_CFLOAT, NPY_CDOUBLE, NPY_CLONGDOUBLE,
+                    NPY_OBJECT=17,
+                    NPY_STRING, NPY_UNICODE,
+                    NPY_VOID,
+
+
+
+
+                    NPY_DATETIME, NPY_TIMEDELTA, NPY_HALF,
+
+                    NPY_NTYPES,
+                    NPY_NOTYPE,
+                    NPY_CHAR __attribute__ ((deprecated ("Use NPY_STRING"))),
+                    NPY_USERDEF=256,
+
+
+                    NPY_NTYPES_ABI_COMPATIBLE=21
+};
+# 94 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+enum NPY_TYPECHAR {
+        NPY_BOOLLTR = '?',
+        NPY_BYTELTR = 'b',
+        NPY_UBYTELTR = 'B',
+        NPY_SHORTLTR = 'h',
+        NPY_USHORTLTR = 'H',
+        NPY_INTLTR = 'i',
+        NPY_UINTLTR = 'I',
+        NPY_LONGLTR = 'l',
+        NPY_ULONGLTR = 'L',
+        NPY_LONGLONGLTR = 'q',
+        NPY_ULONGLONGLTR = 'Q',
+        NPY_HALFLTR = 'e',
+        NPY_FLOATLTR = 'f',
+        NPY_DOUBLELTR = 'd',
+        NPY_LONGDOUBLELTR = 'g',
+        NPY_CFLOATLTR = 'F',
+        NPY_CDOUBLELTR = 'D',
+        NPY_CLONGDOUBLELTR = 'G',
+        NPY_OBJECTLTR = 'O',
+        NPY_STRINGLTR = 'S',
+        NPY_STRINGLTR2 = 'a',
+        NPY_UNICODELTR = 'U',
+        NPY_VOIDLTR = 'V',
+        NPY_DATETIMELTR = 'M',
+        NPY_TIMEDELTALTR = 'm',
+        NPY_CHARLTR = 'c',
+
+
+
+
+
+
+
+        NPY_INTPLTR = 'p',
+        NPY_UINTPLTR = 'P',
+
+
+
+
+
+        NPY_GENBOOLLTR ='b',
+        NPY_SIGNEDLTR = 'i',
+        NPY_UNSIGNEDLTR = 'u',
+        NPY_FLOATINGLTR = 'f',
+        NPY_COMPLEXLTR = 'c'
+};
+# 149 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef enum {
+        NPY_QUICKSORT=0,
+        NPY_HEAPSORT=1,
+        NPY_MERGESORT=2,
+        NPY_STABLESORT=2,
+} NPY_SORTKIND;
+
+
+
+typedef enum {
+        NPY_INTROSELECT=0
+} NPY_SELECTKIND;
+
+
+
+typedef enum {
+        NPY_SEARCHLEFT=0,
+        NPY_SEARCHRIGHT=1
+} NPY_SEARCHSIDE;
+
+
+
+typedef enum {
+        NPY_NOSCALAR=-1,
+        NPY_BOOL_SCALAR,
+        NPY_INTPOS_SCALAR,
+        NPY_INTNEG_SCALAR,
+        NPY_FLOAT_SCALAR,
+        NPY_COMPLEX_SCALAR,
+        NPY_OBJECT_SCALAR
+} NPY_SCALARKIND;
+
+
+
+typedef enum {
+
+        NPY_ANYORDER=-1,
+
+        NPY_CORDER=0,
+
+        NPY_FORTRANORDER=1,
+
+        NPY_KEEPORDER=2
+} NPY_ORDER;
+
+
+typedef enum {
+        _NPY_ERROR_OCCURRED_IN_CAST = -1,
+
+        NPY_NO_CASTING=0,
+
+        NPY_EQUIV_CASTING=1,
+
+        NPY_SAFE_CASTING=2,
+
+        NPY_SAME_KIND_CASTING=3,
+
+        NPY_UNSAFE_CASTING=4,
+} NPY_CASTING;
+
+typedef enum {
+        NPY_CLIP=0,
+        NPY_WRAP=1,
+        NPY_RAISE=2
+} NPY_CLIPMODE;
+
+typedef enum {
+        NPY_VALID=0,
+        NPY_SAME=1,
+        NPY_FULL=2
+} NPY_CORRELATEMODE;
+# 239 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef enum {
+
+        NPY_FR_ERROR = -1,
+
+
+        NPY_FR_Y = 0,
+        NPY_FR_M = 1,
+        NPY_FR_W = 2,
+
+        NPY_FR_D = 4,
+        NPY_FR_h = 5,
+        NPY_FR_m = 6,
+        NPY_FR_s = 7,
+        NPY_FR_ms = 8,
+        NPY_FR_us = 9,
+        NPY_FR_ns = 10,
+        NPY_FR_ps = 11,
+        NPY_FR_fs = 12,
+        NPY_FR_as = 13,
+        NPY_FR_GENERIC = 14
+} NPY_DATETIMEUNIT;
+# 272 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef enum {
+
+    NPY_BUSDAY_FORWARD,
+    NPY_BUSDAY_FOLLOWING = NPY_BUSDAY_FORWARD,
+
+    NPY_BUSDAY_BACKWARD,
+    NPY_BUSDAY_PRECEDING = NPY_BUSDAY_BACKWARD,
+
+
+
+
+    NPY_BUSDAY_MODIFIEDFOLLOWING,
+
+
+
+
+    NPY_BUSDAY_MODIFIEDPRECEDING,
+
+    NPY_BUSDAY_NAT,
+
+    NPY_BUSDAY_RAISE
+} NPY_BUSDAY_ROLL;
+# 308 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef struct NpyAuxData_tag NpyAuxData;
+
+
+typedef void (NpyAuxData_FreeFunc) (NpyAuxData *);
+typedef NpyAuxData *(NpyAuxData_CloneFunc) (NpyAuxData *);
+
+struct NpyAuxData_tag {
+    NpyAuxData_FreeFunc *free;
+    NpyAuxData_CloneFunc *clone;
+
+    void *reserved[2];
+};
+# 363 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+struct _PyArray_Descr;
+
+
+typedef PyObject * (PyArray_GetItemFunc) (void *, void *);
+typedef int (PyArray_SetItemFunc)(PyObject *, void *, void *);
+
+typedef void (PyArray_CopySwapNFunc)(void *, npy_intp, void *, npy_intp,
+                                     npy_intp, int, void *);
+
+typedef void (PyArray_CopySwapFunc)(void *, void *, int, void *);
+typedef npy_bool (PyArray_NonzeroFunc)(void *, void *);
+
+
+
+
+
+
+
+typedef int (PyArray_CompareFunc)(const void *, const void *, void *);
+typedef int (PyArray_ArgFunc)(void*, npy_intp, npy_intp*, void *);
+
+typedef void (PyArray_DotFunc)(void *, npy_intp, void *, npy_intp, void *,
+                               npy_intp, void *);
+
+typedef void (PyArray_VectorUnaryFunc)(void *, void *, npy_intp, void *,
+                                       void *);
+
+
+
+
+
+typedef int (PyArray_ScanFunc)(FILE *fp, void *dptr,
+                               char *ignore, struct _PyArray_Descr *);
+typedef int (PyArray_FromStrFunc)(char *s, void *dptr, char **endptr,
+                                  struct _PyArray_Descr *);
+
+typedef int (PyArray_FillFunc)(void *, npy_intp, void *);
+
+typedef int (PyArray_SortFunc)(void *, npy_intp, void *);
+typedef int (PyArray_ArgSortFunc)(void *, npy_intp *, npy_intp, void *);
+typedef int (PyArray_PartitionFunc)(void *, npy_intp, npy_intp,
+                                    npy_intp *, npy_intp *,
+                                    void *);
+typedef int (PyArray_ArgPartitionFunc)(void *, npy_intp *, npy_intp, npy_intp,
+                                       npy_intp *, npy_intp *,
+                                       void *);
+
+typedef int (PyArray_FillWithScalarFunc)(void *, npy_intp, void *, void *);
+
+typedef int (PyArray_ScalarKindFunc)(void *);
+
+typedef void (PyArray_FastClipFunc)(void *in, npy_intp n_in, void *min,
+                                    void *max, void *out);
+typedef void (PyArray_FastPutmaskFunc)(void *in, void *mask, npy_intp n_in,
+                                       void *values, npy_intp nv);
+typedef int (PyArray_FastTakeFunc)(void *dest, void *src, npy_intp *indarray,
+                                       npy_intp nindarray, npy_intp n_outer,
+                                       npy_intp m_middle, npy_intp nelem,
+                                       NPY_CLIPMODE clipmode);
+
+typedef struct {
+        npy_intp *ptr;
+        int len;
+} PyArray_Dims;
+
+typedef struct {
+
+
+
+
+
+
+        PyArray_VectorUnaryFunc *cast[NPY_NTYPES_ABI_COMPATIBLE];
+
+
+
+
+
+
+
+        PyArray_GetItemFunc *getitem;
+        PyArray_SetItemFunc *setitem;
+
+
+
+
+
+        PyArray_CopySwapNFunc *copyswapn;
+        PyArray_CopySwapFunc *copyswap;
+
+
+
+
+
+        PyArray_CompareFunc *compare;
+
+
+
+
+
+        PyArray_ArgFunc *argmax;
+
+
+
+
+
+        PyArray_DotFunc *dotfunc;
+
+
+
+
+
+
+        PyArray_ScanFunc *scanfunc;
+
+
+
+
+
+        PyArray_FromStrFunc *fromstr;
+
+
+
+
+
+
+        PyArray_NonzeroFunc *nonzero;
+
+
+
+
+
+
+        PyArray_FillFunc *fill;
+
+
+
+
+
+        PyArray_FillWithScalarFunc *fillwithscalar;
+
+
+
+
+
+        PyArray_SortFunc *sort[(NPY_STABLESORT + 1)];
+        PyArray_ArgSortFunc *argsort[(NPY_STABLESORT + 1)];
+
+
+
+
+
+
+
+        PyObject *castdict;
+
+
+
+
+
+
+        PyArray_ScalarKindFunc *scalarkind;
+        int **cancastscalarkindto;
+        int *cancastto;
+
+        PyArray_FastClipFunc *fastclip;
+        PyArray_FastPutmaskFunc *fastputmask;
+        PyArray_FastTakeFunc *fasttake;
+
+
+
+
+
+        PyArray_ArgFunc *argmin;
+
+} PyArray_ArrFuncs;
+# 576 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef struct _PyArray_Descr {
+        PyObject ob_base;
+
+
+
+
+
+
+        PyTypeObject *typeobj;
+
+        char kind;
+
+        char type;
+
+
+
+
+        char byteorder;
+
+        char flags;
+
+        int type_num;
+
+        int elsize;
+
+        int alignment;
+
+
+
+
+
+        struct _arr_descr *subarray;
+
+
+
+
+
+        PyObject *fields;
+
+
+
+
+        PyObject *names;
+
+
+
+
+        PyArray_ArrFuncs *f;
+
+        PyObject *metadata;
+
+
+
+
+
+        NpyAuxData *c_metadata;
+
+
+
+        npy_hash_t hash;
+} PyArray_Descr;
+
+typedef struct _arr_descr {
+        PyArray_Descr *base;
+        PyObject *shape;
+} PyArray_ArrayDescr;
+
+
+
+
+
+typedef struct {
+    void *ctx;
+    void* (*malloc) (void *ctx, size_t size);
+    void* (*calloc) (void *ctx, size_t nelem, size_t elsize);
+    void* (*realloc) (void *ctx, void *ptr, size_t new_size);
+    void (*free) (void *ctx, void *ptr, size_t size);
+
+
+
+
+} PyDataMemAllocator;
+
+typedef struct {
+    char name[127];
+    uint8_t version;
+    PyDataMemAllocator allocator;
+} PyDataMem_Handler;
+# 677 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef struct tagPyArrayObject_fields {
+    PyObject ob_base;
+
+    char *data;
+
+    int nd;
+
+    npy_intp *dimensions;
+
+
+
+
+    npy_intp *strides;
+# 708 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+    PyObject *base;
+
+    PyArray_Descr *descr;
+
+    int flags;
+
+    PyObject *weakreflist;
+# 724 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+} PyArrayObject_fields;
+# 736 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef PyArrayObject_fields PyArrayObject;
+# 757 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef struct PyArrayFlagsObject {
+        PyObject ob_base;
+        PyObject *arr;
+        int flags;
+} PyArrayFlagsObject;
+
+
+
+typedef struct {
+        PyObject ob_base;
+        PyObject *base;
+        void *ptr;
+        npy_intp len;
+        int flags;
+} PyArray_Chunk;
+
+typedef struct {
+    NPY_DATETIMEUNIT base;
+    int num;
+} PyArray_DatetimeMetaData;
+
+typedef struct {
+    NpyAuxData base;
+    PyArray_DatetimeMetaData meta;
+} PyArray_DatetimeDTypeMetaData;
+
+
+
+
+
+typedef struct {
+        npy_int64 year;
+        npy_int32 month, day, hour, min, sec, us, ps, as;
+} npy_datetimestruct;
+
+
+typedef struct {
+        npy_int64 day;
+        npy_int32 sec, us, ps, as;
+} npy_timedeltastruct;
+
+typedef int (PyArray_FinalizeFunc)(PyArrayObject *, PyObject *);
+# 1029 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef struct NpyIter_InternalOnly NpyIter;
+
+
+typedef int (NpyIter_IterNextFunc)(NpyIter *iter);
+typedef void (NpyIter_GetMultiIndexFunc)(NpyIter *iter,
+                                      npy_intp *outcoords);
+# 1113 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef struct PyArrayIterObject_tag PyArrayIterObject;
+
+
+
+
+
+typedef char* (*npy_iter_get_dataptr_t)(
+        PyArrayIterObject* iter, const npy_intp*);
+
+struct PyArrayIterObject_tag {
+        PyObject ob_base;
+        int nd_m1;
+        npy_intp index, size;
+        npy_intp coordinates[32];
+        npy_intp dims_m1[32];
+        npy_intp strides[32];
+        npy_intp backstrides[32];
+        npy_intp factors[32];
+        PyArrayObject *ao;
+        char *dataptr;
+        npy_bool contiguous;
+
+        npy_intp bounds[32][2];
+        npy_intp limits[32][2];
+        npy_intp limits_sizes[32];
+        npy_iter_get_dataptr_t translate;
+} ;
+# 1255 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef struct {
+        PyObject ob_base;
+        int numiter;
+        npy_intp size;
+        npy_intp index;
+        int nd;
+        npy_intp dimensions[32];
+        PyArrayIterObject *iters[32];
+} PyArrayMultiIterObject;
+# 1312 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef struct {
+        PyObject ob_base;
+
+
+
+
+
+        int numiter;
+
+        npy_intp size;
+
+        npy_intp index;
+        int nd;
+        npy_intp dimensions[32];
+        NpyIter *outer;
+
+        void *unused[32 - 2];
+        PyArrayObject *array;
+
+        PyArrayIterObject *ait;
+
+
+
+
+
+        PyArrayObject *subspace;
+
+
+
+
+
+        int iteraxes[32];
+        npy_intp fancy_strides[32];
+
+
+        char *baseoffset;
+
+
+
+
+
+        int consec;
+        char *dataptr;
+
+        int nd_fancy;
+        npy_intp fancy_dims[32];
+
+
+
+
+
+        int needs_api;
+
+
+
+
+        PyArrayObject *extra_op;
+        PyArray_Descr *extra_op_dtype;
+        npy_uint32 *extra_op_flags;
+
+        NpyIter *extra_op_iter;
+        NpyIter_IterNextFunc *extra_op_next;
+        char **extra_op_ptrs;
+
+
+
+
+        NpyIter_IterNextFunc *outer_next;
+        char **outer_ptrs;
+        npy_intp *outer_strides;
+
+
+
+
+        NpyIter *subspace_iter;
+        NpyIter_IterNextFunc *subspace_next;
+        char **subspace_ptrs;
+        npy_intp *subspace_strides;
+
+
+        npy_intp iter_count;
+
+} PyArrayMapIterObject;
+
+enum {
+    NPY_NEIGHBORHOOD_ITER_ZERO_PADDING,
+    NPY_NEIGHBORHOOD_ITER_ONE_PADDING,
+    NPY_NEIGHBORHOOD_ITER_CONSTANT_PADDING,
+    NPY_NEIGHBORHOOD_ITER_CIRCULAR_PADDING,
+    NPY_NEIGHBORHOOD_ITER_MIRROR_PADDING
+};
+
+typedef struct {
+    PyObject ob_base;
+
+
+
+
+    int nd_m1;
+    npy_intp index, size;
+    npy_intp coordinates[32];
+    npy_intp dims_m1[32];
+    npy_intp strides[32];
+    npy_intp backstrides[32];
+    npy_intp factors[32];
+    PyArrayObject *ao;
+    char *dataptr;
+    npy_bool contiguous;
+
+    npy_intp bounds[32][2];
+    npy_intp limits[32][2];
+    npy_intp limits_sizes[32];
+    npy_iter_get_dataptr_t translate;
+
+
+
+
+    npy_intp nd;
+
+
+    npy_intp dimensions[32];
+
+
+
+
+
+    PyArrayIterObject* _internal_iter;
+
+
+
+
+    char* constant;
+
+    int mode;
+} PyArrayNeighborhoodIterObject;
+
+
+
+
+
+
+static inline int
+PyArrayNeighborhoodIter_Reset(PyArrayNeighborhoodIterObject* iter);
+static inline int
+PyArrayNeighborhoodIter_Next(PyArrayNeighborhoodIterObject* iter);
+# 1467 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/_neighborhood_iterator_imp.h" 1
+
+
+
+
+
+
+static inline int
+_PyArrayNeighborhoodIter_IncrCoord(PyArrayNeighborhoodIterObject* iter);
+# 37 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/_neighborhood_iterator_imp.h"
+static inline int
+_PyArrayNeighborhoodIter_IncrCoord(PyArrayNeighborhoodIterObject* iter)
+{
+    npy_intp i, wb;
+
+    for (i = iter->nd - 1; i >= 0; --i) {
+        wb = iter->coordinates[i] < iter->bounds[i][1]; if (wb) { iter->coordinates[i] += 1; return 0; } else { iter->coordinates[i] = iter->bounds[i][0]; }
+    }
+
+    return 0;
+}
+
+
+
+
+static inline int
+_PyArrayNeighborhoodIter_IncrCoord2D(PyArrayNeighborhoodIterObject* iter)
+{
+    npy_intp wb;
+
+    wb = iter->coordinates[1] < iter->bounds[1][1]; if (wb) { iter->coordinates[1] += 1; return 0; } else { iter->coordinates[1] = iter->bounds[1][0]; }
+    wb = iter->coordinates[0] < iter->bounds[0][1]; if (wb) { iter->coordinates[0] += 1; return 0; } else { iter->coordinates[0] = iter->bounds[0][0]; }
+
+    return 0;
+}
+
+
+
+
+
+static inline int
+PyArrayNeighborhoodIter_Next(PyArrayNeighborhoodIterObject* iter)
+{
+    _PyArrayNeighborhoodIter_IncrCoord (iter);
+    iter->dataptr = iter->translate((PyArrayIterObject*)iter, iter->coordinates);
+
+    return 0;
+}
+
+
+
+
+static inline int
+PyArrayNeighborhoodIter_Reset(PyArrayNeighborhoodIterObject* iter)
+{
+    npy_intp i;
+
+    for (i = 0; i < iter->nd; ++i) {
+        iter->coordinates[i] = iter->bounds[i][0];
+    }
+    iter->dataptr = iter->translate((PyArrayIterObject*)iter, iter->coordinates);
+
+    return 0;
+}
+# 1468 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h" 2
+# 1629 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+static inline PyArray_Descr *
+PyArray_DTYPE(PyArrayObject *arr)
+{
+    return ((PyArrayObject_fields *)arr)->descr;
+}
+
+static inline npy_intp *
+PyArray_SHAPE(PyArrayObject *arr)
+{
+    return ((PyArrayObject_fields *)arr)->dimensions;
+}
+
+
+
+
+
+static inline void
+PyArray_ENABLEFLAGS(PyArrayObject *arr, int flags)
+{
+    ((PyArrayObject_fields *)arr)->flags |= flags;
+}
+
+
+
+
+
+static inline void
+PyArray_CLEARFLAGS(PyArrayObject *arr, int flags)
+{
+    ((PyArrayObject_fields *)arr)->flags &= ~flags;
+}
+# 1804 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+typedef struct {
+    npy_intp perm, stride;
+} npy_stride_sort_item;
+
+
+
+
+
+
+
+typedef struct {
+    int two;
+
+
+
+
+    int nd;
+
+    char typekind;
+
+
+
+
+    int itemsize;
+
+    int flags;
+# 1838 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+    npy_intp *shape;
+
+
+
+
+    npy_intp *strides;
+
+    void *data;
+
+    PyObject *descr;
+
+
+
+} PyArrayInterface;
+
+
+
+
+
+typedef void (PyDataMem_EventHookFunc)(void *inp, void *outp, size_t size,
+                                       void *user_data);
+# 1929 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_1_7_deprecated_api.h" 1
+# 122 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_1_7_deprecated_api.h"
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/old_defines.h" 1
+# 123 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_1_7_deprecated_api.h" 2
+# 1930 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h" 2
+# 13 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h" 2
+# 21 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h"
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/__multiarray_api.h" 1
+# 636 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/__multiarray_api.h"
+extern void **PyArrayAPIXXX;
+# 22 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h" 2
+# 155 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h"
+static inline void
+PyArray_DiscardWritebackIfCopy(PyArrayObject *arr)
+{
+    PyArrayObject_fields *fa = (PyArrayObject_fields *)arr;
+    if (fa && fa->base) {
+        if (fa->flags & 0x2000) {
+            PyArray_ENABLEFLAGS((PyArrayObject*)fa->base, 0x0400);
+            Py_DECREF(((PyObject*)((fa->base))));
+            fa->base = 
+# 163 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h" 3 4
+                      ((void *)0)
+# 163 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h"
+                          ;
+            PyArray_CLEARFLAGS(arr, 0x2000);
+        }
+    }
+}
+# 217 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h"
+static inline int
+NPY_TITLE_KEY_check(PyObject *key, PyObject *value)
+{
+    PyObject *title;
+    if (PyTuple_Size(value) != 3) {
+        return 0;
+    }
+    title = PyTuple_GetItem(value, 2);
+    if (key == title) {
+        return 1;
+    }
+# 237 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarrayobject.h"
+    return 0;
+}
+# 6 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/arrayobject.h" 2
+# 1 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_interrupt.h" 1
+# 22 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_interrupt.h"
+# 1 "/usr/include/setjmp.h" 1 3 4
+# 27 "/usr/include/setjmp.h" 3 4
+
+
+
+
+
+
+# 32 "/usr/include/setjmp.h" 3 4
+typedef struct __jmp_buf_tag jmp_buf[1];
+
+
+
+extern int setjmp (jmp_buf __env) __attribute__ ((__nothrow__));
+
+
+
+
+extern int __sigsetjmp (struct __jmp_buf_tag __env[1], int __savemask) __attribute__ ((__nothrow__));
+
+
+
+extern int _setjmp (struct __jmp_buf_tag __env[1]) __attribute__ ((__nothrow__));
+# 54 "/usr/include/setjmp.h" 3 4
+extern void longjmp (struct __jmp_buf_tag __env[1], int __val)
+     __attribute__ ((__nothrow__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _longjmp (struct __jmp_buf_tag __env[1], int __val)
+     __attribute__ ((__nothrow__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+typedef struct __jmp_buf_tag sigjmp_buf[1];
+# 80 "/usr/include/setjmp.h" 3 4
+extern void siglongjmp (sigjmp_buf __env, int __val)
+     __attribute__ ((__nothrow__)) __attribute__ ((__noreturn__));
+# 90 "/usr/include/setjmp.h" 3 4
+
+# 23 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_interrupt.h" 2
+# 1 "/usr/include/signal.h" 1 3 4
+# 27 "/usr/include/signal.h" 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/signum-generic.h" 1 3 4
+# 76 "/usr/include/x86_64-linux-gnu/bits/signum-generic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/signum-arch.h" 1 3 4
+# 77 "/usr/include/x86_64-linux-gnu/bits/signum-generic.h" 2 3 4
+# 31 "/usr/include/signal.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sig_atomic_t.h" 1 3 4
+
+
+
+
+
+
+
+typedef __sig_atomic_t sig_atomic_t;
+# 33 "/usr/include/signal.h" 2 3 4
+# 57 "/usr/include/signal.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigval_t.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types/__sigval_t.h" 3 4
+union sigval
+{
+  int sival_int;
+  void *sival_ptr;
+};
+
+typedef union sigval __sigval_t;
+# 7 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 2 3 4
+# 16 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/siginfo-arch.h" 1 3 4
+# 17 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 2 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/types/siginfo_t.h" 3 4
+typedef struct
+  {
+    int si_signo;
+
+    int si_errno;
+
+    int si_code;
+
+
+
+
+
+    int __pad0;
+
+
+    union
+      {
+ int _pad[((128 / sizeof (int)) - 4)];
+
+
+ struct
+   {
+     __pid_t si_pid;
+     __uid_t si_uid;
+   } _kill;
+
+
+ struct
+   {
+     int si_tid;
+     int si_overrun;
+     __sigval_t si_sigval;
+   } _timer;
+
+
+ struct
+   {
+     __pid_t si_pid;
+     __uid_t si_uid;
+     __sigval_t si_sigval;
+   } _rt;
+
+
+ struct
+   {
+     __pid_t si_pid;
+     __uid_t si_uid;
+     int si_status;
+     __clock_t si_utime;
+     __clock_t si_stime;
+   } _sigchld;
+
+
+ struct
+   {
+     void *si_addr;
+    
+     short int si_addr_lsb;
+     union
+       {
+
+  struct
+    {
+      void *_lower;
+      void *_upper;
+    } _addr_bnd;
+
+  __uint32_t _pkey;
+       } _bounds;
+   } _sigfault;
+
+
+ struct
+   {
+     long int si_band;
+     int si_fd;
+   } _sigpoll;
+
+
+
+ struct
+   {
+     void *_call_addr;
+     int _syscall;
+     unsigned int _arch;
+   } _sigsys;
+
+      } _sifields;
+  } siginfo_t ;
+# 58 "/usr/include/signal.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h" 3 4
+enum
+{
+  SI_ASYNCNL = -60,
+  SI_DETHREAD = -7,
+
+  SI_TKILL,
+  SI_SIGIO,
+
+  SI_ASYNCIO,
+  SI_MESGQ,
+  SI_TIMER,
+
+
+
+
+
+  SI_QUEUE,
+  SI_USER,
+  SI_KERNEL = 0x80
+# 66 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h" 3 4
+};
+
+
+
+
+enum
+{
+  ILL_ILLOPC = 1,
+
+  ILL_ILLOPN,
+
+  ILL_ILLADR,
+
+  ILL_ILLTRP,
+
+  ILL_PRVOPC,
+
+  ILL_PRVREG,
+
+  ILL_COPROC,
+
+  ILL_BADSTK,
+
+  ILL_BADIADDR
+
+};
+
+
+enum
+{
+  FPE_INTDIV = 1,
+
+  FPE_INTOVF,
+
+  FPE_FLTDIV,
+
+  FPE_FLTOVF,
+
+  FPE_FLTUND,
+
+  FPE_FLTRES,
+
+  FPE_FLTINV,
+
+  FPE_FLTSUB,
+
+  FPE_FLTUNK = 14,
+
+  FPE_CONDTRAP
+
+};
+
+
+enum
+{
+  SEGV_MAPERR = 1,
+
+  SEGV_ACCERR,
+
+  SEGV_BNDERR,
+
+  SEGV_PKUERR,
+
+  SEGV_ACCADI,
+
+  SEGV_ADIDERR,
+
+  SEGV_ADIPERR,
+
+  SEGV_MTEAERR,
+
+  SEGV_MTESERR
+
+};
+
+
+enum
+{
+  BUS_ADRALN = 1,
+
+  BUS_ADRERR,
+
+  BUS_OBJERR,
+
+  BUS_MCEERR_AR,
+
+  BUS_MCEERR_AO
+
+};
+
+
+
+
+enum
+{
+  TRAP_BRKPT = 1,
+
+  TRAP_TRACE,
+
+  TRAP_BRANCH,
+
+  TRAP_HWBKPT,
+
+  TRAP_UNK
+
+};
+
+
+
+
+enum
+{
+  CLD_EXITED = 1,
+
+  CLD_KILLED,
+
+  CLD_DUMPED,
+
+  CLD_TRAPPED,
+
+  CLD_STOPPED,
+
+  CLD_CONTINUED
+
+};
+
+
+enum
+{
+  POLL_IN = 1,
+
+  POLL_OUT,
+
+  POLL_MSG,
+
+  POLL_ERR,
+
+  POLL_PRI,
+
+  POLL_HUP
+
+};
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts-arch.h" 1 3 4
+# 214 "/usr/include/x86_64-linux-gnu/bits/siginfo-consts.h" 2 3 4
+# 59 "/usr/include/signal.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigval_t.h" 1 3 4
+# 16 "/usr/include/x86_64-linux-gnu/bits/types/sigval_t.h" 3 4
+typedef __sigval_t sigval_t;
+# 63 "/usr/include/signal.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigevent_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigevent_t.h" 2 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/sigevent_t.h" 3 4
+typedef struct sigevent
+  {
+    __sigval_t sigev_value;
+    int sigev_signo;
+    int sigev_notify;
+
+    union
+      {
+ int _pad[((64 / sizeof (int)) - 4)];
+
+
+
+ __pid_t _tid;
+
+ struct
+   {
+     void (*_function) (__sigval_t);
+     pthread_attr_t *_attribute;
+   } _sigev_thread;
+      } _sigev_un;
+  } sigevent_t;
+# 67 "/usr/include/signal.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigevent-consts.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/sigevent-consts.h" 3 4
+enum
+{
+  SIGEV_SIGNAL = 0,
+
+  SIGEV_NONE,
+
+  SIGEV_THREAD,
+
+
+  SIGEV_THREAD_ID = 4
+
+
+};
+# 68 "/usr/include/signal.h" 2 3 4
+
+
+
+
+typedef void (*__sighandler_t) (int);
+
+
+
+
+extern __sighandler_t __sysv_signal (int __sig, __sighandler_t __handler)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+extern __sighandler_t sysv_signal (int __sig, __sighandler_t __handler)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern __sighandler_t signal (int __sig, __sighandler_t __handler)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 112 "/usr/include/signal.h" 3 4
+extern int kill (__pid_t __pid, int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int killpg (__pid_t __pgrp, int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int raise (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __sighandler_t ssignal (int __sig, __sighandler_t __handler)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern int gsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void psignal (int __sig, const char *__s);
+
+
+extern void psiginfo (const siginfo_t *__pinfo, const char *__s);
+# 151 "/usr/include/signal.h" 3 4
+extern int sigpause (int __sig) __asm__ ("__xpg_sigpause")
+  __attribute__ ((__deprecated__ ("Use the sigsuspend function instead")));
+# 173 "/usr/include/signal.h" 3 4
+extern int sigblock (int __mask) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__deprecated__));
+
+
+extern int sigsetmask (int __mask) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__deprecated__));
+
+
+extern int siggetmask (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__deprecated__));
+# 188 "/usr/include/signal.h" 3 4
+typedef __sighandler_t sighandler_t;
+
+
+
+
+typedef __sighandler_t sig_t;
+
+
+
+
+
+extern int sigemptyset (sigset_t *__set) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigfillset (sigset_t *__set) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigaddset (sigset_t *__set, int __signo) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigdelset (sigset_t *__set, int __signo) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigismember (const sigset_t *__set, int __signo)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int sigisemptyset (const sigset_t *__set) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigandset (sigset_t *__set, const sigset_t *__left,
+        const sigset_t *__right) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern int sigorset (sigset_t *__set, const sigset_t *__left,
+       const sigset_t *__right) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigaction.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/sigaction.h" 3 4
+struct sigaction
+  {
+
+
+    union
+      {
+
+ __sighandler_t sa_handler;
+
+ void (*sa_sigaction) (int, siginfo_t *, void *);
+      }
+    __sigaction_handler;
+
+
+
+
+
+
+
+    __sigset_t sa_mask;
+
+
+    int sa_flags;
+
+
+    void (*sa_restorer) (void);
+  };
+# 230 "/usr/include/signal.h" 2 3 4
+
+
+extern int sigprocmask (int __how, const sigset_t *__restrict __set,
+   sigset_t *__restrict __oset) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int sigsuspend (const sigset_t *__set) __attribute__ ((__nonnull__ (1)));
+
+
+extern int sigaction (int __sig, const struct sigaction *__restrict __act,
+        struct sigaction *__restrict __oact) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sigpending (sigset_t *__set) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int sigwait (const sigset_t *__restrict __set, int *__restrict __sig)
+     __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern int sigwaitinfo (const sigset_t *__restrict __set,
+   siginfo_t *__restrict __info) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int sigtimedwait (const sigset_t *__restrict __set,
+    siginfo_t *__restrict __info,
+    const struct timespec *__restrict __timeout)
+     __attribute__ ((__nonnull__ (1)));
+# 292 "/usr/include/signal.h" 3 4
+extern int sigqueue (__pid_t __pid, int __sig, const union sigval __val)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigcontext.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/sigcontext.h" 3 4
+struct _fpx_sw_bytes
+{
+  __uint32_t magic1;
+  __uint32_t extended_size;
+  __uint64_t xstate_bv;
+  __uint32_t xstate_size;
+  __uint32_t __glibc_reserved1[7];
+};
+
+struct _fpreg
+{
+  unsigned short significand[4];
+  unsigned short exponent;
+};
+
+struct _fpxreg
+{
+  unsigned short significand[4];
+  unsigned short exponent;
+  unsigned short __glibc_reserved1[3];
+};
+
+struct _xmmreg
+{
+  __uint32_t element[4];
+};
+# 123 "/usr/include/x86_64-linux-gnu/bits/sigcontext.h" 3 4
+struct _fpstate
+{
+
+  __uint16_t cwd;
+  __uint16_t swd;
+  __uint16_t ftw;
+  __uint16_t fop;
+  __uint64_t rip;
+  __uint64_t rdp;
+  __uint32_t mxcsr;
+  __uint32_t mxcr_mask;
+  struct _fpxreg _st[8];
+  struct _xmmreg _xmm[16];
+  __uint32_t __glibc_reserved1[24];
+};
+
+struct sigcontext
+{
+  __uint64_t r8;
+  __uint64_t r9;
+  __uint64_t r10;
+  __uint64_t r11;
+  __uint64_t r12;
+  __uint64_t r13;
+  __uint64_t r14;
+  __uint64_t r15;
+  __uint64_t rdi;
+  __uint64_t rsi;
+  __uint64_t rbp;
+  __uint64_t rbx;
+  __uint64_t rdx;
+  __uint64_t rax;
+  __uint64_t rcx;
+  __uint64_t rsp;
+  __uint64_t rip;
+  __uint64_t eflags;
+  unsigned short cs;
+  unsigned short gs;
+  unsigned short fs;
+  unsigned short __pad0;
+  __uint64_t err;
+  __uint64_t trapno;
+  __uint64_t oldmask;
+  __uint64_t cr2;
+  __extension__ union
+    {
+      struct _fpstate * fpstate;
+      __uint64_t __fpstate_word;
+    };
+  __uint64_t __reserved1 [8];
+};
+
+
+
+struct _xsave_hdr
+{
+  __uint64_t xstate_bv;
+  __uint64_t __glibc_reserved1[2];
+  __uint64_t __glibc_reserved2[5];
+};
+
+struct _ymmh_state
+{
+  __uint32_t ymmh_space[64];
+};
+
+struct _xstate
+{
+  struct _fpstate fpstate;
+  struct _xsave_hdr xstate_hdr;
+  struct _ymmh_state ymmh;
+};
+# 302 "/usr/include/signal.h" 2 3 4
+
+
+extern int sigreturn (struct sigcontext *__scp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 312 "/usr/include/signal.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/stack_t.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/stack_t.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types/stack_t.h" 2 3 4
+
+
+typedef struct
+  {
+    void *ss_sp;
+    int ss_flags;
+    size_t ss_size;
+  } stack_t;
+# 314 "/usr/include/signal.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/ucontext.h" 1 3 4
+# 37 "/usr/include/x86_64-linux-gnu/sys/ucontext.h" 3 4
+__extension__ typedef long long int greg_t;
+# 46 "/usr/include/x86_64-linux-gnu/sys/ucontext.h" 3 4
+typedef greg_t gregset_t[23];
+
+
+
+enum
+{
+  REG_R8 = 0,
+
+  REG_R9,
+
+  REG_R10,
+
+  REG_R11,
+
+  REG_R12,
+
+  REG_R13,
+
+  REG_R14,
+
+  REG_R15,
+
+  REG_RDI,
+
+  REG_RSI,
+
+  REG_RBP,
+
+  REG_RBX,
+
+  REG_RDX,
+
+  REG_RAX,
+
+  REG_RCX,
+
+  REG_RSP,
+
+  REG_RIP,
+
+  REG_EFL,
+
+  REG_CSGSFS,
+
+  REG_ERR,
+
+  REG_TRAPNO,
+
+  REG_OLDMASK,
+
+  REG_CR2
+
+};
+
+
+struct _libc_fpxreg
+{
+  unsigned short int significand[4];
+  unsigned short int exponent;
+  unsigned short int __glibc_reserved1[3];
+};
+
+struct _libc_xmmreg
+{
+  __uint32_t element[4];
+};
+
+struct _libc_fpstate
+{
+
+  __uint16_t cwd;
+  __uint16_t swd;
+  __uint16_t ftw;
+  __uint16_t fop;
+  __uint64_t rip;
+  __uint64_t rdp;
+  __uint32_t mxcsr;
+  __uint32_t mxcr_mask;
+  struct _libc_fpxreg _st[8];
+  struct _libc_xmmreg _xmm[16];
+  __uint32_t __glibc_reserved1[24];
+};
+
+
+typedef struct _libc_fpstate *fpregset_t;
+
+
+typedef struct
+  {
+    gregset_t gregs;
+
+    fpregset_t fpregs;
+    __extension__ unsigned long long __reserved1 [8];
+} mcontext_t;
+
+
+typedef struct ucontext_t
+  {
+    unsigned long int uc_flags;
+    struct ucontext_t *uc_link;
+    stack_t uc_stack;
+    mcontext_t uc_mcontext;
+    sigset_t uc_sigmask;
+    struct _libc_fpstate __fpregs_mem;
+    __extension__ unsigned long long int __ssp[4];
+  } ucontext_t;
+# 317 "/usr/include/signal.h" 2 3 4
+
+
+
+
+
+
+
+extern int siginterrupt (int __sig, int __interrupt) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__deprecated__ ("Use sigaction with SA_RESTART instead")));
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigstack.h" 1 3 4
+# 328 "/usr/include/signal.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigstksz.h" 1 3 4
+# 329 "/usr/include/signal.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/ss_flags.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/ss_flags.h" 3 4
+enum
+{
+  SS_ONSTACK = 1,
+
+  SS_DISABLE
+
+};
+# 330 "/usr/include/signal.h" 2 3 4
+
+
+
+extern int sigaltstack (const stack_t *__restrict __ss,
+   stack_t *__restrict __oss) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sigstack.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sigstack.h" 3 4
+struct sigstack
+  {
+    void *ss_sp;
+    int ss_onstack;
+  };
+# 340 "/usr/include/signal.h" 2 3 4
+
+
+
+
+
+
+
+extern int sigstack (struct sigstack *__ss, struct sigstack *__oss)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__deprecated__));
+
+
+
+
+
+
+extern int sighold (int __sig) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__deprecated__ ("Use the sigprocmask function instead")));
+
+
+extern int sigrelse (int __sig) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__deprecated__ ("Use the sigprocmask function instead")));
+
+
+extern int sigignore (int __sig) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__deprecated__ ("Use the signal function instead")));
+
+
+extern __sighandler_t sigset (int __sig, __sighandler_t __disp) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__deprecated__ ("Use the signal and sigprocmask functions instead")))
+                                                        ;
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/sigthread.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/sigthread.h" 3 4
+extern int pthread_sigmask (int __how,
+       const __sigset_t *__restrict __newmask,
+       __sigset_t *__restrict __oldmask)__attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_kill (pthread_t __threadid, int __signo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int pthread_sigqueue (pthread_t __threadid, int __signo,
+        const union sigval __value) __attribute__ ((__nothrow__ , __leaf__));
+# 377 "/usr/include/signal.h" 2 3 4
+
+
+
+
+
+
+extern int __libc_current_sigrtmin (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int __libc_current_sigrtmax (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/signal_ext.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/signal_ext.h" 3 4
+extern int tgkill (__pid_t __tgid, __pid_t __tid, int __signal);
+# 392 "/usr/include/signal.h" 2 3 4
+
+
+# 24 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_interrupt.h" 2
+# 7 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/arrayobject.h" 2
+# 40 "hlhdf_arrayobject_wrap.h" 2
+# 33 "pyhlhdf_common.h" 2
+# 41 "pyhlhdf_common.h"
+
+# 41 "pyhlhdf_common.h"
+int getFloatFromDictionary(char* name, float* val, PyObject* dict);
+# 50 "pyhlhdf_common.h"
+int getDoubleFromDictionary(char* name, double* val, PyObject* dict);
+# 59 "pyhlhdf_common.h"
+int getIntegerFromDictionary(char* name, int* val, PyObject* dict);
+# 68 "pyhlhdf_common.h"
+int getUnsignedLongFromDictionary(char* name, unsigned long* val, PyObject* dict);
+# 77 "pyhlhdf_common.h"
+int getLongFromDictionary(char* name, long* val, PyObject* dict);
+# 86 "pyhlhdf_common.h"
+int getFloatFromObject(char* name, float* val, PyObject* dict);
+# 95 "pyhlhdf_common.h"
+int getDoubleFromObject(char* name, double* val, PyObject* dict);
+# 104 "pyhlhdf_common.h"
+int getIntegerFromObject(char* name, int* val, PyObject* dict);
+# 113 "pyhlhdf_common.h"
+int getLongFromObject(char* name, long* val, PyObject* dict);
+# 122 "pyhlhdf_common.h"
+int getUnsignedLongFromObject(char* name, unsigned long* val, PyObject* dict);
+# 131 "pyhlhdf_common.h"
+int getShortFromObject(char* name, short* val, PyObject* dict);
+# 140 "pyhlhdf_common.h"
+int getByteFromObject(char* name, unsigned char* val, PyObject* dict);
+
+
+
+
+
+
+
+char* getStringFromObject(char* name, PyObject* dict);
+# 157 "pyhlhdf_common.h"
+int getIdxIntegerFromTuple(int idx, int* val, PyObject* tuple);
+# 166 "pyhlhdf_common.h"
+int getIdxDoubleFromTuple(int idx, double* val, PyObject* tuple);
+
+
+
+
+
+
+
+char* getStringFromDictionary(char* name, PyObject* dict);
+# 183 "pyhlhdf_common.h"
+int setMappingInteger(PyObject* info, char* keyname, int in_value);
+# 192 "pyhlhdf_common.h"
+int setMappingDouble(PyObject* info, char* keyname, double in_value);
+# 201 "pyhlhdf_common.h"
+int setMappingFloat(PyObject* info, char* keyname, float in_value);
+# 210 "pyhlhdf_common.h"
+int setMappingString(PyObject* info,char* keyname,char* in_string);
+# 220 "pyhlhdf_common.h"
+int setMappingString_Length(PyObject* info,char* keyname,char* in_string,int len);
+# 229 "pyhlhdf_common.h"
+int setObjectInteger(PyObject* info, char* keyname, int in_value);
+# 238 "pyhlhdf_common.h"
+int setObjectLong(PyObject* info, char* keyname, long in_value);
+# 247 "pyhlhdf_common.h"
+int setObjectUnsignedLong(PyObject* info, char* keyname, unsigned long in_value);
+# 256 "pyhlhdf_common.h"
+int setObjectDouble(PyObject* info, char* keyname, double in_value);
+# 265 "pyhlhdf_common.h"
+int setObjectFloat(PyObject* info, char* keyname, float in_value);
+# 274 "pyhlhdf_common.h"
+int setObjectString(PyObject* info,char* keyname,char* in_string);
+# 284 "pyhlhdf_common.h"
+int setObjectString_Length(PyObject* info,char* keyname,char* in_string,int len);
+
+
+
+
+
+
+char* translatePyFormatToHlHdf(char type);
+# 300 "pyhlhdf_common.h"
+int pyarraytypeFromHdfType(const char* format);
+
+
+
+
+
+
+
+PyArrayObject* new1d_ArrayObject(int nl, const char* format);
+# 317 "pyhlhdf_common.h"
+PyArrayObject* new2d_ArrayObject(int xsize,int ysize, const char* format);
+# 28 "pyhlhdf_common.c" 2
+
+
+
+
+int getFloatFromDictionary(char* name, float* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyMapping_GetItemString(dict,name);
+   if(pyo) {
+      (*val)=(float)PyFloat_AsDouble(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getDoubleFromDictionary(char* name, double* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyMapping_GetItemString(dict,name);
+   if(pyo) {
+      (*val)=PyFloat_AsDouble(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getIntegerFromDictionary(char* name, int* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyMapping_GetItemString(dict,name);
+   if(pyo) {
+      (*val)=PyLong_AsLong(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getLongFromDictionary(char* name, long* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyMapping_GetItemString(dict,name);
+   if(pyo) {
+      (*val)=(long)PyLong_AsLong(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getUnsignedLongFromDictionary(char* name, unsigned long* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyMapping_GetItemString(dict,name);
+   if(pyo) {
+      (*val)=(unsigned long)PyLong_AsLong(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+
+int getFloatFromObject(char* name, float* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyObject_GetAttrString(dict,name);
+   if(pyo) {
+      (*val)=(float)PyFloat_AsDouble(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getDoubleFromObject(char* name, double* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyObject_GetAttrString(dict,name);
+   if(pyo) {
+      (*val)=PyFloat_AsDouble(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getIntegerFromObject(char* name, int* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyObject_GetAttrString(dict,name);
+   if(pyo) {
+      (*val)=PyLong_AsLong(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getLongFromObject(char* name, long* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyObject_GetAttrString(dict,name);
+   if(pyo) {
+      (*val)=(long)PyLong_AsLong(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getUnsignedLongFromObject(char* name, unsigned long* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyObject_GetAttrString(dict,name);
+   if(pyo) {
+      (*val)=(unsigned long)PyLong_AsLong(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+
+int getShortFromObject(char* name, short* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyObject_GetAttrString(dict,name);
+   if(pyo) {
+      (*val)=(short)PyLong_AsLong(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getByteFromObject(char* name, unsigned char* val, PyObject* dict)
+{
+   PyObject* pyo;
+   pyo = PyObject_GetAttrString(dict,name);
+   if(pyo) {
+      (*val)=(unsigned char)PyLong_AsLong(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+char* getStringFromObject(char* name, PyObject* dict)
+{
+   PyObject* pyo;
+   char* retstr=
+# 229 "pyhlhdf_common.c" 3 4
+               ((void *)0)
+# 229 "pyhlhdf_common.c"
+                   ;
+   pyo=PyObject_GetAttrString(dict,name);
+   if(pyo) {
+      retstr=strdup(PyUnicode_AsUTF8(pyo));
+      Py_DECREF(((PyObject*)((pyo))));
+   }
+   PyErr_Clear();
+   return retstr;
+}
+
+
+
+
+int getIdxIntegerFromTuple(int idx, int* val, PyObject* tuple)
+{
+   PyObject* pyo;
+   pyo=PySequence_GetItem(tuple,idx);
+   if(pyo) {
+      (*val)=PyLong_AsLong(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+int getIdxDoubleFromTuple(int idx, double* val, PyObject* tuple)
+{
+   PyObject* pyo;
+   pyo=PySequence_GetItem(tuple,idx);
+   if(pyo) {
+      (*val)=PyFloat_AsDouble(pyo);
+      Py_DECREF(((PyObject*)((pyo))));
+      return 1;
+   }
+   PyErr_Clear();
+   return 0;
+}
+
+
+
+
+char* getStringFromDictionary(char* name, PyObject* dict)
+{
+   PyObject* pyo;
+   char* retstr=
+# 277 "pyhlhdf_common.c" 3 4
+               ((void *)0)
+# 277 "pyhlhdf_common.c"
+                   ;
+   pyo=PyMapping_GetItemString(dict,name);
+   if(pyo) {
+      retstr=strdup(PyUnicode_AsUTF8(pyo));
+      Py_DECREF(((PyObject*)((pyo))));
+   }
+   PyErr_Clear();
+   return retstr;
+}
+
+
+
+
+int setMappingInteger(PyObject* info, char* keyname, int in_value)
+{
+   int ret=1;
+
+   PyObject* out_value=PyLong_FromLong(in_value);
+   if(!out_value)
+      return 0;
+
+   if(PyMapping_SetItemString(info,keyname,out_value)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_value))));
+
+   return ret;
+}
+
+
+
+
+int setMappingDouble(PyObject* info, char* keyname, double in_value)
+{
+   int ret=1;
+
+   PyObject* out_value=PyFloat_FromDouble(in_value);
+   if(!out_value)
+      return 0;
+
+   if(PyMapping_SetItemString(info,keyname,out_value)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_value))));
+
+   return ret;
+}
+
+
+
+
+int setMappingFloat(PyObject* info, char* keyname, float in_value)
+{
+   int ret=1;
+
+   PyObject* out_value=PyFloat_FromDouble((float)in_value);
+   if(!out_value)
+      return 0;
+
+   if(PyMapping_SetItemString(info,keyname,out_value)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_value))));
+
+   return ret;
+}
+
+
+
+
+int setMappingString(PyObject* info,char* keyname,char* in_string)
+{
+   int ret=1;
+   PyObject* out_string=PyUnicode_FromString(in_string);
+   if(!out_string)
+      return 0;
+
+   if(PyMapping_SetItemString(info,keyname,out_string)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_string))));
+
+   return ret;
+}
+
+
+
+
+int setMappingString_Length(PyObject* info,char* keyname,char* in_string,int len)
+{
+   int ret=1;
+   PyObject* out_string=PyUnicode_FromStringAndSize(in_string, len);
+   if(!out_string)
+      return 0;
+
+   if(PyMapping_SetItemString(info,keyname,out_string)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_string))));
+
+   return ret;
+}
+
+
+
+
+int setObjectInteger(PyObject* info, char* keyname, int in_value)
+{
+   int ret=1;
+
+   PyObject* out_value=PyLong_FromLong(in_value);
+   if(!out_value)
+      return 0;
+
+   if(PyObject_SetAttrString(info,keyname,out_value)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_value))));
+
+   return ret;
+}
+
+
+
+
+int setObjectLong(PyObject* info, char* keyname, long in_value)
+{
+   int ret=1;
+
+   PyObject* out_value=PyLong_FromLong(in_value);
+   if(!out_value)
+      return 0;
+
+   if(PyObject_SetAttrString(info,keyname,out_value)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_value))));
+
+   return ret;
+}
+
+
+
+int setObjectUnsignedLong(PyObject* info, char* keyname, unsigned long in_value)
+{
+   int ret=1;
+
+   PyObject* out_value=PyLong_FromLong((long)in_value);
+   if(!out_value)
+      return 0;
+
+   if(PyObject_SetAttrString(info,keyname,out_value)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_value))));
+
+   return ret;
+}
+
+
+
+
+int setObjectDouble(PyObject* info, char* keyname, double in_value)
+{
+   int ret=1;
+
+   PyObject* out_value=PyFloat_FromDouble(in_value);
+   if(!out_value)
+      return 0;
+
+   if(PyObject_SetAttrString(info,keyname,out_value)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_value))));
+
+   return ret;
+}
+
+
+
+
+int setObjectFloat(PyObject* info, char* keyname, float in_value)
+{
+   int ret=1;
+
+   PyObject* out_value=PyFloat_FromDouble((float)in_value);
+   if(!out_value)
+      return 0;
+
+   if(PyObject_SetAttrString(info,keyname,out_value)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_value))));
+
+   return ret;
+}
+
+
+
+
+int setObjectString(PyObject* info,char* keyname,char* in_string)
+{
+   int ret=1;
+   PyObject* out_string=PyUnicode_FromString(in_string);
+   if(!out_string)
+      return 0;
+
+   if(PyObject_SetAttrString(info,keyname,out_string)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_string))));
+
+   return ret;
+}
+
+
+
+
+int setObjectString_Length(PyObject* info,char* keyname,char* in_string,int len)
+{
+   int ret=1;
+   PyObject* out_string=
+# 498 "pyhlhdf_common.c" 3 4
+                       ((void *)0)
+# 498 "pyhlhdf_common.c"
+                           ;
+
+   if(strlen(in_string)<len)
+      return setObjectString(info,keyname,in_string);
+
+   out_string=PyUnicode_FromStringAndSize(in_string, len);
+   if(!out_string)
+      return 0;
+
+   if(PyObject_SetAttrString(info,keyname,out_string)==-1)
+      ret=0;
+
+   Py_DECREF(((PyObject*)((out_string))));
+
+   return ret;
+}
+
+
+
+
+char* translatePyFormatToHlHdf(char type)
+{
+   char* retv=
+# 520 "pyhlhdf_common.c" 3 4
+             ((void *)0)
+# 520 "pyhlhdf_common.c"
+                 ;
+
+   switch(type) {
+   case 'c':
+   case 'b':
+      retv=strdup("char");
+      break;
+   case 'B':
+      retv=strdup("uchar");
+      break;
+   case 'h':
+      retv=strdup("short");
+      break;
+   case 'H':
+      retv=strdup("ushort");
+      break;
+   case 'i':
+      retv=strdup("int");
+      break;
+   case 'I':
+      retv=strdup("uint");
+      break;
+   case 'l':
+      retv=strdup("long");
+      break;
+   case 'L':
+      retv=strdup("ulong");
+      break;
+   case 'f':
+      retv=strdup("float");
+      break;
+   case 'd':
+      retv=strdup("double");
+      break;
+   case 'F':
+   case 'D':
+   case 'O':
+   default:
+      fprintf(
+# 558 "pyhlhdf_common.c" 3 4
+             stderr
+# 558 "pyhlhdf_common.c"
+                   ,"Unsupported datatype '%c'\n",type);
+   }
+   return retv;
+}
+
+
+
+
+int pyarraytypeFromHdfType(const char* format)
+{
+  if (!format)
+    return -1;
+
+  if (strcmp(format, "char") == 0) {
+    return NPY_CHAR;
+  } else if (strcmp(format, "schar") == 0) {
+    return NPY_BYTE;
+  } else if (strcmp(format, "uchar") == 0) {
+    return NPY_UBYTE;
+  } else if (strcmp(format, "short") == 0) {
+    return NPY_SHORT;
+  } else if (strcmp(format, "ushort") == 0) {
+    return NPY_USHORT;
+  } else if (strcmp(format, "int") == 0) {
+    return NPY_INT;
+  } else if (strcmp(format, "uint") == 0) {
+    return NPY_UINT;
+  } else if (strcmp(format, "long") == 0) {
+    return NPY_LONG;
+  } else if (strcmp(format, "ulong") == 0) {
+    return NPY_ULONG;
+  } else if (strcmp(format, "float") == 0) {
+    return NPY_FLOAT;
+  } else if (strcmp(format, "double") == 0) {
+    return NPY_DOUBLE;
+  } else if (strcmp(format, "half") == 0) {
+    return NPY_HALF;
+  } else if (strcmp(format, "bfloat16") == 0) {
+    return NPY_USHORT;
+  } else {
+    fprintf(
+# 598 "pyhlhdf_common.c" 3 4
+           stderr
+# 598 "pyhlhdf_common.c"
+                 , "Unsupported type %s\n", format);
+    return -1;
+  }
+  return -1;
+}
+
+
+
+
+PyArrayObject* new1d_ArrayObject(int nl,
+     const char* format)
+{
+   npy_intp dims[1];
+   PyArrayObject* arr;
+   int iformat=pyarraytypeFromHdfType(format);
+
+   if(iformat==-1)
+      return 
+# 615 "pyhlhdf_common.c" 3 4
+            ((void *)0)
+# 615 "pyhlhdf_common.c"
+                ;
+
+   dims[0]=(npy_intp)nl;
+
+   arr=(PyArrayObject*)(*(PyObject * (*)(PyTypeObject *, int, npy_intp const *, int, npy_intp const *, void *, int, int, PyObject *)) PyArrayAPIXXX[93])(&(*(PyTypeObject *)PyArrayAPIXXX[2]), 1, dims, iformat, 
+# 619 "pyhlhdf_common.c" 3 4
+                      ((void *)0)
+# 619 "pyhlhdf_common.c"
+                      , 
+# 619 "pyhlhdf_common.c" 3 4
+                      ((void *)0)
+# 619 "pyhlhdf_common.c"
+                      , 0, 0, 
+# 619 "pyhlhdf_common.c" 3 4
+                      ((void *)0)
+# 619 "pyhlhdf_common.c"
+                      );
+
+   return arr;
+}
+
+
+
+
+PyArrayObject* new2d_ArrayObject(int xsize,int ysize,
+     const char* format)
+{
+   npy_intp dims[2];
+   PyArrayObject* arr;
+   int iformat=pyarraytypeFromHdfType(format);
+
+   if(iformat==-1)
+      return 
+# 635 "pyhlhdf_common.c" 3 4
+            ((void *)0)
+# 635 "pyhlhdf_common.c"
+                ;
+
+   dims[0]=(npy_intp)ysize;
+   dims[1]=(npy_intp)xsize;
+
+   arr=(PyArrayObject*)(*(PyObject * (*)(PyTypeObject *, int, npy_intp const *, int, npy_intp const *, void *, int, int, PyObject *)) PyArrayAPIXXX[93])(&(*(PyTypeObject *)PyArrayAPIXXX[2]), 2, dims, iformat, 
+# 640 "pyhlhdf_common.c" 3 4
+                      ((void *)0)
+# 640 "pyhlhdf_common.c"
+                      , 
+# 640 "pyhlhdf_common.c" 3 4
+                      ((void *)0)
+# 640 "pyhlhdf_common.c"
+                      , 0, 0, 
+# 640 "pyhlhdf_common.c" 3 4
+                      ((void *)0)
+# 640 "pyhlhdf_common.c"
+                      );
+
+   return arr;
+}
@@ -0,0 +1,18047 @@
+	.file	"pyhlhdf_common.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/pyhlhdf" "pyhlhdf_common.c"
+	.p2align 4
+	.globl	getFloatFromDictionary
+	.type	getFloatFromDictionary, @function
+getFloatFromDictionary:
+.LVL0:
+.LFB94:
+	.file 1 "pyhlhdf_common.c"
+	.loc 1 33 1 view -0
+	.cfi_startproc
+	.loc 1 34 4 view .LVU1
+	.loc 1 35 4 view .LVU2
+	.loc 1 33 1 is_stmt 0 view .LVU3
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL1:
+	.loc 1 33 1 view .LVU4
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 35 10 view .LVU5
+	movq	%rax, %rsi
+.LVL2:
+	.loc 1 33 1 view .LVU6
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 35 10 view .LVU7
+	call	PyMapping_GetItemString@PLT
+.LVL3:
+	.loc 1 36 4 is_stmt 1 view .LVU8
+	.loc 1 36 6 is_stmt 0 view .LVU9
+	testq	%rax, %rax
+	je	.L2
+	.loc 1 37 21 view .LVU10
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 37 7 is_stmt 1 view .LVU11
+	.loc 1 37 21 is_stmt 0 view .LVU12
+	call	PyFloat_AsDouble@PLT
+.LVL4:
+	.loc 1 37 14 view .LVU13
+	cvtsd2ss	%xmm0, %xmm0
+	movss	%xmm0, 0(%rbp)
+	.loc 1 38 7 is_stmt 1 view .LVU14
+.LVL5:
+.LBB58:
+.LBI58:
+	.file 2 "/root/.pyenv/versions/3.11.7/include/python3.11/object.h"
+	.loc 2 533 20 view .LVU15
+.LBB59:
+	.loc 2 537 5 view .LVU16
+	.loc 2 537 8 is_stmt 0 view .LVU17
+	subq	$1, (%rbx)
+	je	.L7
+.LBE59:
+.LBE58:
+	.loc 1 39 14 view .LVU18
+	movl	$1, %eax
+.L8:
+	.loc 1 43 1 view .LVU19
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL6:
+	.loc 1 43 1 view .LVU20
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL7:
+	.loc 1 43 1 view .LVU21
+	ret
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.cfi_restore_state
+	.loc 1 41 4 is_stmt 1 view .LVU22
+	call	PyErr_Clear@PLT
+.LVL9:
+	.loc 1 42 4 view .LVU23
+	.loc 1 43 1 is_stmt 0 view .LVU24
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 42 11 view .LVU25
+	xorl	%eax, %eax
+	.loc 1 43 1 view .LVU26
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL10:
+	.loc 1 43 1 view .LVU27
+	ret
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.cfi_restore_state
+.LBB61:
+.LBB60:
+	.loc 2 538 9 is_stmt 1 view .LVU28
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL12:
+.LBE60:
+.LBE61:
+	.loc 1 39 14 is_stmt 0 view .LVU29
+	movl	$1, %eax
+	jmp	.L8
+	.cfi_endproc
+.LFE94:
+	.size	getFloatFromDictionary, .-getFloatFromDictionary
+	.p2align 4
+	.globl	getDoubleFromDictionary
+	.type	getDoubleFromDictionary, @function
+getDoubleFromDictionary:
+.LVL13:
+.LFB95:
+	.loc 1 49 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 50 4 view .LVU31
+	.loc 1 51 4 view .LVU32
+	.loc 1 49 1 is_stmt 0 view .LVU33
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL14:
+	.loc 1 49 1 view .LVU34
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 51 10 view .LVU35
+	movq	%rax, %rsi
+.LVL15:
+	.loc 1 49 1 view .LVU36
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 51 10 view .LVU37
+	call	PyMapping_GetItemString@PLT
+.LVL16:
+	.loc 1 52 4 is_stmt 1 view .LVU38
+	.loc 1 52 6 is_stmt 0 view .LVU39
+	testq	%rax, %rax
+	je	.L10
+	.loc 1 53 14 view .LVU40
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 53 7 is_stmt 1 view .LVU41
+	.loc 1 53 14 is_stmt 0 view .LVU42
+	call	PyFloat_AsDouble@PLT
+.LVL17:
+	.loc 1 53 13 view .LVU43
+	movsd	%xmm0, 0(%rbp)
+	.loc 1 54 7 is_stmt 1 view .LVU44
+.LVL18:
+.LBB62:
+.LBI62:
+	.loc 2 533 20 view .LVU45
+.LBB63:
+	.loc 2 537 5 view .LVU46
+	.loc 2 537 8 is_stmt 0 view .LVU47
+	subq	$1, (%rbx)
+	je	.L14
+.LBE63:
+.LBE62:
+	.loc 1 55 14 view .LVU48
+	movl	$1, %eax
+.L15:
+	.loc 1 59 1 view .LVU49
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL19:
+	.loc 1 59 1 view .LVU50
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL20:
+	.loc 1 59 1 view .LVU51
+	ret
+.LVL21:
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.cfi_restore_state
+	.loc 1 57 4 is_stmt 1 view .LVU52
+	call	PyErr_Clear@PLT
+.LVL22:
+	.loc 1 58 4 view .LVU53
+	.loc 1 59 1 is_stmt 0 view .LVU54
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 58 11 view .LVU55
+	xorl	%eax, %eax
+	.loc 1 59 1 view .LVU56
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL23:
+	.loc 1 59 1 view .LVU57
+	ret
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.cfi_restore_state
+.LBB65:
+.LBB64:
+	.loc 2 538 9 is_stmt 1 view .LVU58
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL25:
+.LBE64:
+.LBE65:
+	.loc 1 55 14 is_stmt 0 view .LVU59
+	movl	$1, %eax
+	jmp	.L15
+	.cfi_endproc
+.LFE95:
+	.size	getDoubleFromDictionary, .-getDoubleFromDictionary
+	.p2align 4
+	.globl	getIntegerFromDictionary
+	.type	getIntegerFromDictionary, @function
+getIntegerFromDictionary:
+.LVL26:
+.LFB96:
+	.loc 1 65 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 66 4 view .LVU61
+	.loc 1 67 4 view .LVU62
+	.loc 1 65 1 is_stmt 0 view .LVU63
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL27:
+	.loc 1 65 1 view .LVU64
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 67 10 view .LVU65
+	movq	%rax, %rsi
+.LVL28:
+	.loc 1 65 1 view .LVU66
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 67 10 view .LVU67
+	call	PyMapping_GetItemString@PLT
+.LVL29:
+	.loc 1 68 4 is_stmt 1 view .LVU68
+	.loc 1 68 6 is_stmt 0 view .LVU69
+	testq	%rax, %rax
+	je	.L17
+	.loc 1 69 14 view .LVU70
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 69 7 is_stmt 1 view .LVU71
+	.loc 1 69 14 is_stmt 0 view .LVU72
+	call	PyLong_AsLong@PLT
+.LVL30:
+	.loc 1 69 13 view .LVU73
+	movl	%eax, 0(%rbp)
+	.loc 1 70 7 is_stmt 1 view .LVU74
+.LVL31:
+.LBB66:
+.LBI66:
+	.loc 2 533 20 view .LVU75
+.LBB67:
+	.loc 2 537 5 view .LVU76
+	.loc 2 537 8 is_stmt 0 view .LVU77
+	subq	$1, (%rbx)
+	je	.L21
+.LBE67:
+.LBE66:
+	.loc 1 71 14 view .LVU78
+	movl	$1, %eax
+.L22:
+	.loc 1 75 1 view .LVU79
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL32:
+	.loc 1 75 1 view .LVU80
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL33:
+	.loc 1 75 1 view .LVU81
+	ret
+.LVL34:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.cfi_restore_state
+	.loc 1 73 4 is_stmt 1 view .LVU82
+	call	PyErr_Clear@PLT
+.LVL35:
+	.loc 1 74 4 view .LVU83
+	.loc 1 75 1 is_stmt 0 view .LVU84
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 74 11 view .LVU85
+	xorl	%eax, %eax
+	.loc 1 75 1 view .LVU86
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL36:
+	.loc 1 75 1 view .LVU87
+	ret
+.LVL37:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	.cfi_restore_state
+.LBB69:
+.LBB68:
+	.loc 2 538 9 is_stmt 1 view .LVU88
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL38:
+.LBE68:
+.LBE69:
+	.loc 1 71 14 is_stmt 0 view .LVU89
+	movl	$1, %eax
+	jmp	.L22
+	.cfi_endproc
+.LFE96:
+	.size	getIntegerFromDictionary, .-getIntegerFromDictionary
+	.p2align 4
+	.globl	getLongFromDictionary
+	.type	getLongFromDictionary, @function
+getLongFromDictionary:
+.LVL39:
+.LFB97:
+	.loc 1 81 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 82 4 view .LVU91
+	.loc 1 83 4 view .LVU92
+	.loc 1 81 1 is_stmt 0 view .LVU93
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL40:
+	.loc 1 81 1 view .LVU94
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 83 10 view .LVU95
+	movq	%rax, %rsi
+.LVL41:
+	.loc 1 81 1 view .LVU96
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 83 10 view .LVU97
+	call	PyMapping_GetItemString@PLT
+.LVL42:
+	.loc 1 84 4 is_stmt 1 view .LVU98
+	.loc 1 84 6 is_stmt 0 view .LVU99
+	testq	%rax, %rax
+	je	.L24
+	.loc 1 85 14 view .LVU100
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 85 7 is_stmt 1 view .LVU101
+	.loc 1 85 14 is_stmt 0 view .LVU102
+	call	PyLong_AsLong@PLT
+.LVL43:
+	.loc 1 85 13 view .LVU103
+	movq	%rax, 0(%rbp)
+	.loc 1 86 7 is_stmt 1 view .LVU104
+.LVL44:
+.LBB70:
+.LBI70:
+	.loc 2 533 20 view .LVU105
+.LBB71:
+	.loc 2 537 5 view .LVU106
+	.loc 2 537 8 is_stmt 0 view .LVU107
+	subq	$1, (%rbx)
+	je	.L28
+.LBE71:
+.LBE70:
+	.loc 1 87 14 view .LVU108
+	movl	$1, %eax
+.L29:
+	.loc 1 91 1 view .LVU109
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL45:
+	.loc 1 91 1 view .LVU110
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL46:
+	.loc 1 91 1 view .LVU111
+	ret
+.LVL47:
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	.cfi_restore_state
+	.loc 1 89 4 is_stmt 1 view .LVU112
+	call	PyErr_Clear@PLT
+.LVL48:
+	.loc 1 90 4 view .LVU113
+	.loc 1 91 1 is_stmt 0 view .LVU114
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 90 11 view .LVU115
+	xorl	%eax, %eax
+	.loc 1 91 1 view .LVU116
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL49:
+	.loc 1 91 1 view .LVU117
+	ret
+.LVL50:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.cfi_restore_state
+.LBB73:
+.LBB72:
+	.loc 2 538 9 is_stmt 1 view .LVU118
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL51:
+.LBE72:
+.LBE73:
+	.loc 1 87 14 is_stmt 0 view .LVU119
+	movl	$1, %eax
+	jmp	.L29
+	.cfi_endproc
+.LFE97:
+	.size	getLongFromDictionary, .-getLongFromDictionary
+	.p2align 4
+	.globl	getUnsignedLongFromDictionary
+	.type	getUnsignedLongFromDictionary, @function
+getUnsignedLongFromDictionary:
+.LVL52:
+.LFB98:
+	.loc 1 97 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 98 4 view .LVU121
+	.loc 1 99 4 view .LVU122
+	.loc 1 97 1 is_stmt 0 view .LVU123
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL53:
+	.loc 1 97 1 view .LVU124
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 99 10 view .LVU125
+	movq	%rax, %rsi
+.LVL54:
+	.loc 1 97 1 view .LVU126
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 99 10 view .LVU127
+	call	PyMapping_GetItemString@PLT
+.LVL55:
+	.loc 1 100 4 is_stmt 1 view .LVU128
+	.loc 1 100 6 is_stmt 0 view .LVU129
+	testq	%rax, %rax
+	je	.L31
+	.loc 1 101 29 view .LVU130
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 101 7 is_stmt 1 view .LVU131
+	.loc 1 101 29 is_stmt 0 view .LVU132
+	call	PyLong_AsLong@PLT
+.LVL56:
+	.loc 1 101 13 view .LVU133
+	movq	%rax, 0(%rbp)
+	.loc 1 102 7 is_stmt 1 view .LVU134
+.LVL57:
+.LBB74:
+.LBI74:
+	.loc 2 533 20 view .LVU135
+.LBB75:
+	.loc 2 537 5 view .LVU136
+	.loc 2 537 8 is_stmt 0 view .LVU137
+	subq	$1, (%rbx)
+	je	.L35
+.LBE75:
+.LBE74:
+	.loc 1 103 14 view .LVU138
+	movl	$1, %eax
+.L36:
+	.loc 1 107 1 view .LVU139
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL58:
+	.loc 1 107 1 view .LVU140
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL59:
+	.loc 1 107 1 view .LVU141
+	ret
+.LVL60:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.cfi_restore_state
+	.loc 1 105 4 is_stmt 1 view .LVU142
+	call	PyErr_Clear@PLT
+.LVL61:
+	.loc 1 106 4 view .LVU143
+	.loc 1 107 1 is_stmt 0 view .LVU144
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 106 11 view .LVU145
+	xorl	%eax, %eax
+	.loc 1 107 1 view .LVU146
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL62:
+	.loc 1 107 1 view .LVU147
+	ret
+.LVL63:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.cfi_restore_state
+.LBB77:
+.LBB76:
+	.loc 2 538 9 is_stmt 1 view .LVU148
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL64:
+.LBE76:
+.LBE77:
+	.loc 1 103 14 is_stmt 0 view .LVU149
+	movl	$1, %eax
+	jmp	.L36
+	.cfi_endproc
+.LFE98:
+	.size	getUnsignedLongFromDictionary, .-getUnsignedLongFromDictionary
+	.p2align 4
+	.globl	getFloatFromObject
+	.type	getFloatFromObject, @function
+getFloatFromObject:
+.LVL65:
+.LFB99:
+	.loc 1 114 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 115 4 view .LVU151
+	.loc 1 116 4 view .LVU152
+	.loc 1 114 1 is_stmt 0 view .LVU153
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL66:
+	.loc 1 114 1 view .LVU154
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 116 10 view .LVU155
+	movq	%rax, %rsi
+.LVL67:
+	.loc 1 114 1 view .LVU156
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 116 10 view .LVU157
+	call	PyObject_GetAttrString@PLT
+.LVL68:
+	.loc 1 117 4 is_stmt 1 view .LVU158
+	.loc 1 117 6 is_stmt 0 view .LVU159
+	testq	%rax, %rax
+	je	.L38
+	.loc 1 118 21 view .LVU160
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 118 7 is_stmt 1 view .LVU161
+	.loc 1 118 21 is_stmt 0 view .LVU162
+	call	PyFloat_AsDouble@PLT
+.LVL69:
+	.loc 1 118 14 view .LVU163
+	cvtsd2ss	%xmm0, %xmm0
+	movss	%xmm0, 0(%rbp)
+	.loc 1 119 7 is_stmt 1 view .LVU164
+.LVL70:
+.LBB78:
+.LBI78:
+	.loc 2 533 20 view .LVU165
+.LBB79:
+	.loc 2 537 5 view .LVU166
+	.loc 2 537 8 is_stmt 0 view .LVU167
+	subq	$1, (%rbx)
+	je	.L42
+.LBE79:
+.LBE78:
+	.loc 1 120 14 view .LVU168
+	movl	$1, %eax
+.L43:
+	.loc 1 124 1 view .LVU169
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL71:
+	.loc 1 124 1 view .LVU170
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL72:
+	.loc 1 124 1 view .LVU171
+	ret
+.LVL73:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.cfi_restore_state
+	.loc 1 122 4 is_stmt 1 view .LVU172
+	call	PyErr_Clear@PLT
+.LVL74:
+	.loc 1 123 4 view .LVU173
+	.loc 1 124 1 is_stmt 0 view .LVU174
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 123 11 view .LVU175
+	xorl	%eax, %eax
+	.loc 1 124 1 view .LVU176
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL75:
+	.loc 1 124 1 view .LVU177
+	ret
+.LVL76:
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	.cfi_restore_state
+.LBB81:
+.LBB80:
+	.loc 2 538 9 is_stmt 1 view .LVU178
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL77:
+.LBE80:
+.LBE81:
+	.loc 1 120 14 is_stmt 0 view .LVU179
+	movl	$1, %eax
+	jmp	.L43
+	.cfi_endproc
+.LFE99:
+	.size	getFloatFromObject, .-getFloatFromObject
+	.p2align 4
+	.globl	getDoubleFromObject
+	.type	getDoubleFromObject, @function
+getDoubleFromObject:
+.LVL78:
+.LFB100:
+	.loc 1 130 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 131 4 view .LVU181
+	.loc 1 132 4 view .LVU182
+	.loc 1 130 1 is_stmt 0 view .LVU183
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL79:
+	.loc 1 130 1 view .LVU184
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 132 10 view .LVU185
+	movq	%rax, %rsi
+.LVL80:
+	.loc 1 130 1 view .LVU186
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 132 10 view .LVU187
+	call	PyObject_GetAttrString@PLT
+.LVL81:
+	.loc 1 133 4 is_stmt 1 view .LVU188
+	.loc 1 133 6 is_stmt 0 view .LVU189
+	testq	%rax, %rax
+	je	.L45
+	.loc 1 134 14 view .LVU190
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 134 7 is_stmt 1 view .LVU191
+	.loc 1 134 14 is_stmt 0 view .LVU192
+	call	PyFloat_AsDouble@PLT
+.LVL82:
+	.loc 1 134 13 view .LVU193
+	movsd	%xmm0, 0(%rbp)
+	.loc 1 135 7 is_stmt 1 view .LVU194
+.LVL83:
+.LBB82:
+.LBI82:
+	.loc 2 533 20 view .LVU195
+.LBB83:
+	.loc 2 537 5 view .LVU196
+	.loc 2 537 8 is_stmt 0 view .LVU197
+	subq	$1, (%rbx)
+	je	.L49
+.LBE83:
+.LBE82:
+	.loc 1 136 14 view .LVU198
+	movl	$1, %eax
+.L50:
+	.loc 1 140 1 view .LVU199
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL84:
+	.loc 1 140 1 view .LVU200
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL85:
+	.loc 1 140 1 view .LVU201
+	ret
+.LVL86:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.cfi_restore_state
+	.loc 1 138 4 is_stmt 1 view .LVU202
+	call	PyErr_Clear@PLT
+.LVL87:
+	.loc 1 139 4 view .LVU203
+	.loc 1 140 1 is_stmt 0 view .LVU204
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 139 11 view .LVU205
+	xorl	%eax, %eax
+	.loc 1 140 1 view .LVU206
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL88:
+	.loc 1 140 1 view .LVU207
+	ret
+.LVL89:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.cfi_restore_state
+.LBB85:
+.LBB84:
+	.loc 2 538 9 is_stmt 1 view .LVU208
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL90:
+.LBE84:
+.LBE85:
+	.loc 1 136 14 is_stmt 0 view .LVU209
+	movl	$1, %eax
+	jmp	.L50
+	.cfi_endproc
+.LFE100:
+	.size	getDoubleFromObject, .-getDoubleFromObject
+	.p2align 4
+	.globl	getIntegerFromObject
+	.type	getIntegerFromObject, @function
+getIntegerFromObject:
+.LVL91:
+.LFB101:
+	.loc 1 146 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 147 4 view .LVU211
+	.loc 1 148 4 view .LVU212
+	.loc 1 146 1 is_stmt 0 view .LVU213
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL92:
+	.loc 1 146 1 view .LVU214
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 148 10 view .LVU215
+	movq	%rax, %rsi
+.LVL93:
+	.loc 1 146 1 view .LVU216
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 148 10 view .LVU217
+	call	PyObject_GetAttrString@PLT
+.LVL94:
+	.loc 1 149 4 is_stmt 1 view .LVU218
+	.loc 1 149 6 is_stmt 0 view .LVU219
+	testq	%rax, %rax
+	je	.L52
+	.loc 1 150 14 view .LVU220
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 150 7 is_stmt 1 view .LVU221
+	.loc 1 150 14 is_stmt 0 view .LVU222
+	call	PyLong_AsLong@PLT
+.LVL95:
+	.loc 1 150 13 view .LVU223
+	movl	%eax, 0(%rbp)
+	.loc 1 151 7 is_stmt 1 view .LVU224
+.LVL96:
+.LBB86:
+.LBI86:
+	.loc 2 533 20 view .LVU225
+.LBB87:
+	.loc 2 537 5 view .LVU226
+	.loc 2 537 8 is_stmt 0 view .LVU227
+	subq	$1, (%rbx)
+	je	.L56
+.LBE87:
+.LBE86:
+	.loc 1 152 14 view .LVU228
+	movl	$1, %eax
+.L57:
+	.loc 1 156 1 view .LVU229
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL97:
+	.loc 1 156 1 view .LVU230
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL98:
+	.loc 1 156 1 view .LVU231
+	ret
+.LVL99:
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	.cfi_restore_state
+	.loc 1 154 4 is_stmt 1 view .LVU232
+	call	PyErr_Clear@PLT
+.LVL100:
+	.loc 1 155 4 view .LVU233
+	.loc 1 156 1 is_stmt 0 view .LVU234
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 155 11 view .LVU235
+	xorl	%eax, %eax
+	.loc 1 156 1 view .LVU236
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL101:
+	.loc 1 156 1 view .LVU237
+	ret
+.LVL102:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.cfi_restore_state
+.LBB89:
+.LBB88:
+	.loc 2 538 9 is_stmt 1 view .LVU238
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL103:
+.LBE88:
+.LBE89:
+	.loc 1 152 14 is_stmt 0 view .LVU239
+	movl	$1, %eax
+	jmp	.L57
+	.cfi_endproc
+.LFE101:
+	.size	getIntegerFromObject, .-getIntegerFromObject
+	.p2align 4
+	.globl	getLongFromObject
+	.type	getLongFromObject, @function
+getLongFromObject:
+.LVL104:
+.LFB102:
+	.loc 1 162 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 163 4 view .LVU241
+	.loc 1 164 4 view .LVU242
+	.loc 1 162 1 is_stmt 0 view .LVU243
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL105:
+	.loc 1 162 1 view .LVU244
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 164 10 view .LVU245
+	movq	%rax, %rsi
+.LVL106:
+	.loc 1 162 1 view .LVU246
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 164 10 view .LVU247
+	call	PyObject_GetAttrString@PLT
+.LVL107:
+	.loc 1 165 4 is_stmt 1 view .LVU248
+	.loc 1 165 6 is_stmt 0 view .LVU249
+	testq	%rax, %rax
+	je	.L59
+	.loc 1 166 14 view .LVU250
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 166 7 is_stmt 1 view .LVU251
+	.loc 1 166 14 is_stmt 0 view .LVU252
+	call	PyLong_AsLong@PLT
+.LVL108:
+	.loc 1 166 13 view .LVU253
+	movq	%rax, 0(%rbp)
+	.loc 1 167 7 is_stmt 1 view .LVU254
+.LVL109:
+.LBB90:
+.LBI90:
+	.loc 2 533 20 view .LVU255
+.LBB91:
+	.loc 2 537 5 view .LVU256
+	.loc 2 537 8 is_stmt 0 view .LVU257
+	subq	$1, (%rbx)
+	je	.L63
+.LBE91:
+.LBE90:
+	.loc 1 168 14 view .LVU258
+	movl	$1, %eax
+.L64:
+	.loc 1 172 1 view .LVU259
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL110:
+	.loc 1 172 1 view .LVU260
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL111:
+	.loc 1 172 1 view .LVU261
+	ret
+.LVL112:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.cfi_restore_state
+	.loc 1 170 4 is_stmt 1 view .LVU262
+	call	PyErr_Clear@PLT
+.LVL113:
+	.loc 1 171 4 view .LVU263
+	.loc 1 172 1 is_stmt 0 view .LVU264
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 171 11 view .LVU265
+	xorl	%eax, %eax
+	.loc 1 172 1 view .LVU266
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL114:
+	.loc 1 172 1 view .LVU267
+	ret
+.LVL115:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	.cfi_restore_state
+.LBB93:
+.LBB92:
+	.loc 2 538 9 is_stmt 1 view .LVU268
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL116:
+.LBE92:
+.LBE93:
+	.loc 1 168 14 is_stmt 0 view .LVU269
+	movl	$1, %eax
+	jmp	.L64
+	.cfi_endproc
+.LFE102:
+	.size	getLongFromObject, .-getLongFromObject
+	.p2align 4
+	.globl	getUnsignedLongFromObject
+	.type	getUnsignedLongFromObject, @function
+getUnsignedLongFromObject:
+.LVL117:
+.LFB103:
+	.loc 1 178 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 179 4 view .LVU271
+	.loc 1 180 4 view .LVU272
+	.loc 1 178 1 is_stmt 0 view .LVU273
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL118:
+	.loc 1 178 1 view .LVU274
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 180 10 view .LVU275
+	movq	%rax, %rsi
+.LVL119:
+	.loc 1 178 1 view .LVU276
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 180 10 view .LVU277
+	call	PyObject_GetAttrString@PLT
+.LVL120:
+	.loc 1 181 4 is_stmt 1 view .LVU278
+	.loc 1 181 6 is_stmt 0 view .LVU279
+	testq	%rax, %rax
+	je	.L66
+	.loc 1 182 29 view .LVU280
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 182 7 is_stmt 1 view .LVU281
+	.loc 1 182 29 is_stmt 0 view .LVU282
+	call	PyLong_AsLong@PLT
+.LVL121:
+	.loc 1 182 13 view .LVU283
+	movq	%rax, 0(%rbp)
+	.loc 1 183 7 is_stmt 1 view .LVU284
+.LVL122:
+.LBB94:
+.LBI94:
+	.loc 2 533 20 view .LVU285
+.LBB95:
+	.loc 2 537 5 view .LVU286
+	.loc 2 537 8 is_stmt 0 view .LVU287
+	subq	$1, (%rbx)
+	je	.L70
+.LBE95:
+.LBE94:
+	.loc 1 184 14 view .LVU288
+	movl	$1, %eax
+.L71:
+	.loc 1 188 1 view .LVU289
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL123:
+	.loc 1 188 1 view .LVU290
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL124:
+	.loc 1 188 1 view .LVU291
+	ret
+.LVL125:
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	.cfi_restore_state
+	.loc 1 186 4 is_stmt 1 view .LVU292
+	call	PyErr_Clear@PLT
+.LVL126:
+	.loc 1 187 4 view .LVU293
+	.loc 1 188 1 is_stmt 0 view .LVU294
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 187 11 view .LVU295
+	xorl	%eax, %eax
+	.loc 1 188 1 view .LVU296
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL127:
+	.loc 1 188 1 view .LVU297
+	ret
+.LVL128:
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.cfi_restore_state
+.LBB97:
+.LBB96:
+	.loc 2 538 9 is_stmt 1 view .LVU298
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL129:
+.LBE96:
+.LBE97:
+	.loc 1 184 14 is_stmt 0 view .LVU299
+	movl	$1, %eax
+	jmp	.L71
+	.cfi_endproc
+.LFE103:
+	.size	getUnsignedLongFromObject, .-getUnsignedLongFromObject
+	.p2align 4
+	.globl	getShortFromObject
+	.type	getShortFromObject, @function
+getShortFromObject:
+.LVL130:
+.LFB104:
+	.loc 1 195 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 196 4 view .LVU301
+	.loc 1 197 4 view .LVU302
+	.loc 1 195 1 is_stmt 0 view .LVU303
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL131:
+	.loc 1 195 1 view .LVU304
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 197 10 view .LVU305
+	movq	%rax, %rsi
+.LVL132:
+	.loc 1 195 1 view .LVU306
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 197 10 view .LVU307
+	call	PyObject_GetAttrString@PLT
+.LVL133:
+	.loc 1 198 4 is_stmt 1 view .LVU308
+	.loc 1 198 6 is_stmt 0 view .LVU309
+	testq	%rax, %rax
+	je	.L73
+	.loc 1 199 21 view .LVU310
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 199 7 is_stmt 1 view .LVU311
+	.loc 1 199 21 is_stmt 0 view .LVU312
+	call	PyLong_AsLong@PLT
+.LVL134:
+	.loc 1 199 14 view .LVU313
+	movw	%ax, 0(%rbp)
+	.loc 1 200 7 is_stmt 1 view .LVU314
+.LVL135:
+.LBB98:
+.LBI98:
+	.loc 2 533 20 view .LVU315
+.LBB99:
+	.loc 2 537 5 view .LVU316
+	.loc 2 537 8 is_stmt 0 view .LVU317
+	subq	$1, (%rbx)
+	je	.L77
+.LBE99:
+.LBE98:
+	.loc 1 201 14 view .LVU318
+	movl	$1, %eax
+.L78:
+	.loc 1 205 1 view .LVU319
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL136:
+	.loc 1 205 1 view .LVU320
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL137:
+	.loc 1 205 1 view .LVU321
+	ret
+.LVL138:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	.cfi_restore_state
+	.loc 1 203 4 is_stmt 1 view .LVU322
+	call	PyErr_Clear@PLT
+.LVL139:
+	.loc 1 204 4 view .LVU323
+	.loc 1 205 1 is_stmt 0 view .LVU324
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 204 11 view .LVU325
+	xorl	%eax, %eax
+	.loc 1 205 1 view .LVU326
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL140:
+	.loc 1 205 1 view .LVU327
+	ret
+.LVL141:
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	.cfi_restore_state
+.LBB101:
+.LBB100:
+	.loc 2 538 9 is_stmt 1 view .LVU328
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL142:
+.LBE100:
+.LBE101:
+	.loc 1 201 14 is_stmt 0 view .LVU329
+	movl	$1, %eax
+	jmp	.L78
+	.cfi_endproc
+.LFE104:
+	.size	getShortFromObject, .-getShortFromObject
+	.p2align 4
+	.globl	getByteFromObject
+	.type	getByteFromObject, @function
+getByteFromObject:
+.LVL143:
+.LFB105:
+	.loc 1 211 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 212 4 view .LVU331
+	.loc 1 213 4 view .LVU332
+	.loc 1 211 1 is_stmt 0 view .LVU333
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL144:
+	.loc 1 211 1 view .LVU334
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 213 10 view .LVU335
+	movq	%rax, %rsi
+.LVL145:
+	.loc 1 211 1 view .LVU336
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 213 10 view .LVU337
+	call	PyObject_GetAttrString@PLT
+.LVL146:
+	.loc 1 214 4 is_stmt 1 view .LVU338
+	.loc 1 214 6 is_stmt 0 view .LVU339
+	testq	%rax, %rax
+	je	.L80
+	.loc 1 215 29 view .LVU340
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 215 7 is_stmt 1 view .LVU341
+	.loc 1 215 29 is_stmt 0 view .LVU342
+	call	PyLong_AsLong@PLT
+.LVL147:
+	.loc 1 215 14 view .LVU343
+	movb	%al, 0(%rbp)
+	.loc 1 216 7 is_stmt 1 view .LVU344
+.LVL148:
+.LBB102:
+.LBI102:
+	.loc 2 533 20 view .LVU345
+.LBB103:
+	.loc 2 537 5 view .LVU346
+	.loc 2 537 8 is_stmt 0 view .LVU347
+	subq	$1, (%rbx)
+	je	.L84
+.LBE103:
+.LBE102:
+	.loc 1 217 14 view .LVU348
+	movl	$1, %eax
+.L85:
+	.loc 1 221 1 view .LVU349
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL149:
+	.loc 1 221 1 view .LVU350
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL150:
+	.loc 1 221 1 view .LVU351
+	ret
+.LVL151:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.cfi_restore_state
+	.loc 1 219 4 is_stmt 1 view .LVU352
+	call	PyErr_Clear@PLT
+.LVL152:
+	.loc 1 220 4 view .LVU353
+	.loc 1 221 1 is_stmt 0 view .LVU354
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 220 11 view .LVU355
+	xorl	%eax, %eax
+	.loc 1 221 1 view .LVU356
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL153:
+	.loc 1 221 1 view .LVU357
+	ret
+.LVL154:
+	.p2align 4,,10
+	.p2align 3
+.L84:
+	.cfi_restore_state
+.LBB105:
+.LBB104:
+	.loc 2 538 9 is_stmt 1 view .LVU358
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL155:
+.LBE104:
+.LBE105:
+	.loc 1 217 14 is_stmt 0 view .LVU359
+	movl	$1, %eax
+	jmp	.L85
+	.cfi_endproc
+.LFE105:
+	.size	getByteFromObject, .-getByteFromObject
+	.p2align 4
+	.globl	getStringFromObject
+	.type	getStringFromObject, @function
+getStringFromObject:
+.LVL156:
+.LFB106:
+	.loc 1 227 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 228 4 view .LVU361
+	.loc 1 229 4 view .LVU362
+	.loc 1 230 4 view .LVU363
+	.loc 1 227 1 is_stmt 0 view .LVU364
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rdi
+.LVL157:
+	.loc 1 227 1 view .LVU365
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 230 8 view .LVU366
+	movq	%rax, %rsi
+.LVL158:
+	.loc 1 227 1 view .LVU367
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 230 8 view .LVU368
+	call	PyObject_GetAttrString@PLT
+.LVL159:
+	.loc 1 230 8 view .LVU369
+	movq	%rax, %rbx
+.LVL160:
+	.loc 1 231 4 is_stmt 1 view .LVU370
+	.loc 1 231 6 is_stmt 0 view .LVU371
+	testq	%rax, %rax
+	je	.L87
+	.loc 1 232 7 is_stmt 1 view .LVU372
+	.loc 1 232 14 is_stmt 0 view .LVU373
+	movq	%rax, %rdi
+	call	PyUnicode_AsUTF8@PLT
+.LVL161:
+	.loc 1 232 14 view .LVU374
+	movq	%rax, %rdi
+	call	strdup@PLT
+.LVL162:
+.LBB106:
+.LBB107:
+	.loc 2 537 8 view .LVU375
+	subq	$1, (%rbx)
+.LBE107:
+.LBE106:
+	.loc 1 232 14 view .LVU376
+	movq	%rax, %rbp
+.LVL163:
+	.loc 1 233 7 is_stmt 1 view .LVU377
+.LBB111:
+.LBI106:
+	.loc 2 533 20 view .LVU378
+.LBB108:
+	.loc 2 537 5 view .LVU379
+	.loc 2 537 8 is_stmt 0 view .LVU380
+	je	.L88
+.LBE108:
+.LBE111:
+	.loc 1 232 14 view .LVU381
+	movq	%rbp, %rbx
+.LVL164:
+.L87:
+	.loc 1 235 4 is_stmt 1 view .LVU382
+	call	PyErr_Clear@PLT
+.LVL165:
+	.loc 1 236 4 view .LVU383
+	.loc 1 237 1 is_stmt 0 view .LVU384
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL166:
+	.loc 1 237 1 view .LVU385
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL167:
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.cfi_restore_state
+.LBB112:
+.LBB109:
+	.loc 2 538 9 is_stmt 1 view .LVU386
+	movq	%rbx, %rdi
+.LBE109:
+.LBE112:
+	.loc 1 232 14 is_stmt 0 view .LVU387
+	movq	%rbp, %rbx
+.LVL168:
+.LBB113:
+.LBB110:
+	.loc 2 538 9 view .LVU388
+	call	_Py_Dealloc@PLT
+.LVL169:
+	.loc 2 538 9 view .LVU389
+	jmp	.L87
+.LBE110:
+.LBE113:
+	.cfi_endproc
+.LFE106:
+	.size	getStringFromObject, .-getStringFromObject
+	.p2align 4
+	.globl	getIdxIntegerFromTuple
+	.type	getIdxIntegerFromTuple, @function
+getIdxIntegerFromTuple:
+.LVL170:
+.LFB107:
+	.loc 1 243 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 244 4 view .LVU391
+	.loc 1 245 4 view .LVU392
+	.loc 1 243 1 is_stmt 0 view .LVU393
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%edi, %eax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL171:
+	.loc 1 243 1 view .LVU394
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 245 8 view .LVU395
+	movslq	%eax, %rsi
+.LVL172:
+	.loc 1 243 1 view .LVU396
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 245 8 view .LVU397
+	call	PySequence_GetItem@PLT
+.LVL173:
+	.loc 1 246 4 is_stmt 1 view .LVU398
+	.loc 1 246 6 is_stmt 0 view .LVU399
+	testq	%rax, %rax
+	je	.L95
+	.loc 1 247 14 view .LVU400
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 247 7 is_stmt 1 view .LVU401
+	.loc 1 247 14 is_stmt 0 view .LVU402
+	call	PyLong_AsLong@PLT
+.LVL174:
+	.loc 1 247 13 view .LVU403
+	movl	%eax, 0(%rbp)
+	.loc 1 248 7 is_stmt 1 view .LVU404
+.LVL175:
+.LBB114:
+.LBI114:
+	.loc 2 533 20 view .LVU405
+.LBB115:
+	.loc 2 537 5 view .LVU406
+	.loc 2 537 8 is_stmt 0 view .LVU407
+	subq	$1, (%rbx)
+	je	.L99
+.LBE115:
+.LBE114:
+	.loc 1 249 14 view .LVU408
+	movl	$1, %eax
+.L100:
+	.loc 1 253 1 view .LVU409
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL176:
+	.loc 1 253 1 view .LVU410
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL177:
+	.loc 1 253 1 view .LVU411
+	ret
+.LVL178:
+	.p2align 4,,10
+	.p2align 3
+.L95:
+	.cfi_restore_state
+	.loc 1 251 4 is_stmt 1 view .LVU412
+	call	PyErr_Clear@PLT
+.LVL179:
+	.loc 1 252 4 view .LVU413
+	.loc 1 253 1 is_stmt 0 view .LVU414
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 252 11 view .LVU415
+	xorl	%eax, %eax
+	.loc 1 253 1 view .LVU416
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL180:
+	.loc 1 253 1 view .LVU417
+	ret
+.LVL181:
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.cfi_restore_state
+.LBB117:
+.LBB116:
+	.loc 2 538 9 is_stmt 1 view .LVU418
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL182:
+.LBE116:
+.LBE117:
+	.loc 1 249 14 is_stmt 0 view .LVU419
+	movl	$1, %eax
+	jmp	.L100
+	.cfi_endproc
+.LFE107:
+	.size	getIdxIntegerFromTuple, .-getIdxIntegerFromTuple
+	.p2align 4
+	.globl	getIdxDoubleFromTuple
+	.type	getIdxDoubleFromTuple, @function
+getIdxDoubleFromTuple:
+.LVL183:
+.LFB108:
+	.loc 1 259 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 260 4 view .LVU421
+	.loc 1 261 4 view .LVU422
+	.loc 1 259 1 is_stmt 0 view .LVU423
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%edi, %eax
+	movq	%rsi, %rbp
+	movq	%rdx, %rdi
+.LVL184:
+	.loc 1 259 1 view .LVU424
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 261 8 view .LVU425
+	movslq	%eax, %rsi
+.LVL185:
+	.loc 1 259 1 view .LVU426
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 261 8 view .LVU427
+	call	PySequence_GetItem@PLT
+.LVL186:
+	.loc 1 262 4 is_stmt 1 view .LVU428
+	.loc 1 262 6 is_stmt 0 view .LVU429
+	testq	%rax, %rax
+	je	.L102
+	.loc 1 263 14 view .LVU430
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	.loc 1 263 7 is_stmt 1 view .LVU431
+	.loc 1 263 14 is_stmt 0 view .LVU432
+	call	PyFloat_AsDouble@PLT
+.LVL187:
+	.loc 1 263 13 view .LVU433
+	movsd	%xmm0, 0(%rbp)
+	.loc 1 264 7 is_stmt 1 view .LVU434
+.LVL188:
+.LBB118:
+.LBI118:
+	.loc 2 533 20 view .LVU435
+.LBB119:
+	.loc 2 537 5 view .LVU436
+	.loc 2 537 8 is_stmt 0 view .LVU437
+	subq	$1, (%rbx)
+	je	.L106
+.LBE119:
+.LBE118:
+	.loc 1 265 14 view .LVU438
+	movl	$1, %eax
+.L107:
+	.loc 1 269 1 view .LVU439
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL189:
+	.loc 1 269 1 view .LVU440
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL190:
+	.loc 1 269 1 view .LVU441
+	ret
+.LVL191:
+	.p2align 4,,10
+	.p2align 3
+.L102:
+	.cfi_restore_state
+	.loc 1 267 4 is_stmt 1 view .LVU442
+	call	PyErr_Clear@PLT
+.LVL192:
+	.loc 1 268 4 view .LVU443
+	.loc 1 269 1 is_stmt 0 view .LVU444
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 268 11 view .LVU445
+	xorl	%eax, %eax
+	.loc 1 269 1 view .LVU446
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL193:
+	.loc 1 269 1 view .LVU447
+	ret
+.LVL194:
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	.cfi_restore_state
+.LBB121:
+.LBB120:
+	.loc 2 538 9 is_stmt 1 view .LVU448
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL195:
+.LBE120:
+.LBE121:
+	.loc 1 265 14 is_stmt 0 view .LVU449
+	movl	$1, %eax
+	jmp	.L107
+	.cfi_endproc
+.LFE108:
+	.size	getIdxDoubleFromTuple, .-getIdxDoubleFromTuple
+	.p2align 4
+	.globl	getStringFromDictionary
+	.type	getStringFromDictionary, @function
+getStringFromDictionary:
+.LVL196:
+.LFB109:
+	.loc 1 275 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 276 4 view .LVU451
+	.loc 1 277 4 view .LVU452
+	.loc 1 278 4 view .LVU453
+	.loc 1 275 1 is_stmt 0 view .LVU454
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rax
+	movq	%rsi, %rdi
+.LVL197:
+	.loc 1 275 1 view .LVU455
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 278 8 view .LVU456
+	movq	%rax, %rsi
+.LVL198:
+	.loc 1 275 1 view .LVU457
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 278 8 view .LVU458
+	call	PyMapping_GetItemString@PLT
+.LVL199:
+	.loc 1 278 8 view .LVU459
+	movq	%rax, %rbx
+.LVL200:
+	.loc 1 279 4 is_stmt 1 view .LVU460
+	.loc 1 279 6 is_stmt 0 view .LVU461
+	testq	%rax, %rax
+	je	.L109
+	.loc 1 280 7 is_stmt 1 view .LVU462
+	.loc 1 280 14 is_stmt 0 view .LVU463
+	movq	%rax, %rdi
+	call	PyUnicode_AsUTF8@PLT
+.LVL201:
+	.loc 1 280 14 view .LVU464
+	movq	%rax, %rdi
+	call	strdup@PLT
+.LVL202:
+.LBB122:
+.LBB123:
+	.loc 2 537 8 view .LVU465
+	subq	$1, (%rbx)
+.LBE123:
+.LBE122:
+	.loc 1 280 14 view .LVU466
+	movq	%rax, %rbp
+.LVL203:
+	.loc 1 281 7 is_stmt 1 view .LVU467
+.LBB127:
+.LBI122:
+	.loc 2 533 20 view .LVU468
+.LBB124:
+	.loc 2 537 5 view .LVU469
+	.loc 2 537 8 is_stmt 0 view .LVU470
+	je	.L110
+.LBE124:
+.LBE127:
+	.loc 1 280 14 view .LVU471
+	movq	%rbp, %rbx
+.LVL204:
+.L109:
+	.loc 1 283 4 is_stmt 1 view .LVU472
+	call	PyErr_Clear@PLT
+.LVL205:
+	.loc 1 284 4 view .LVU473
+	.loc 1 285 1 is_stmt 0 view .LVU474
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL206:
+	.loc 1 285 1 view .LVU475
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL207:
+	.p2align 4,,10
+	.p2align 3
+.L110:
+	.cfi_restore_state
+.LBB128:
+.LBB125:
+	.loc 2 538 9 is_stmt 1 view .LVU476
+	movq	%rbx, %rdi
+.LBE125:
+.LBE128:
+	.loc 1 280 14 is_stmt 0 view .LVU477
+	movq	%rbp, %rbx
+.LVL208:
+.LBB129:
+.LBB126:
+	.loc 2 538 9 view .LVU478
+	call	_Py_Dealloc@PLT
+.LVL209:
+	.loc 2 538 9 view .LVU479
+	jmp	.L109
+.LBE126:
+.LBE129:
+	.cfi_endproc
+.LFE109:
+	.size	getStringFromDictionary, .-getStringFromDictionary
+	.p2align 4
+	.globl	setMappingInteger
+	.type	setMappingInteger, @function
+setMappingInteger:
+.LVL210:
+.LFB110:
+	.loc 1 291 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 292 4 view .LVU481
+	.loc 1 294 4 view .LVU482
+	.loc 1 291 1 is_stmt 0 view .LVU483
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	.loc 1 294 24 view .LVU484
+	movslq	%edx, %rdi
+.LVL211:
+	.loc 1 291 1 view .LVU485
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 294 24 view .LVU486
+	call	PyLong_FromLong@PLT
+.LVL212:
+	.loc 1 294 24 view .LVU487
+	movq	%rax, %rbx
+.LVL213:
+	.loc 1 295 4 is_stmt 1 view .LVU488
+	xorl	%eax, %eax
+.LVL214:
+	.loc 1 295 6 is_stmt 0 view .LVU489
+	testq	%rbx, %rbx
+	je	.L116
+	.loc 1 298 4 is_stmt 1 view .LVU490
+	.loc 1 298 7 is_stmt 0 view .LVU491
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyMapping_SetItemString@PLT
+.LVL215:
+.LBB130:
+.LBB131:
+	.loc 2 537 8 view .LVU492
+	subq	$1, (%rbx)
+.LBE131:
+.LBE130:
+	.loc 1 298 7 view .LVU493
+	movl	%eax, %ebp
+.LVL216:
+	.loc 1 301 4 is_stmt 1 view .LVU494
+.LBB134:
+.LBI130:
+	.loc 2 533 20 view .LVU495
+.LBB132:
+	.loc 2 537 5 view .LVU496
+	.loc 2 537 8 is_stmt 0 view .LVU497
+	je	.L118
+.LBE132:
+.LBE134:
+	.loc 1 298 6 view .LVU498
+	xorl	%eax, %eax
+.LVL217:
+	.loc 1 298 6 view .LVU499
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL218:
+.L116:
+	.loc 1 304 1 view .LVU500
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL219:
+	.loc 1 304 1 view .LVU501
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL220:
+	.loc 1 304 1 view .LVU502
+	ret
+.LVL221:
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	.cfi_restore_state
+.LBB135:
+.LBB133:
+	.loc 2 538 9 is_stmt 1 view .LVU503
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL222:
+	.loc 2 538 9 is_stmt 0 view .LVU504
+.LBE133:
+.LBE135:
+	.loc 1 298 6 view .LVU505
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L116
+	.cfi_endproc
+.LFE110:
+	.size	setMappingInteger, .-setMappingInteger
+	.p2align 4
+	.globl	setMappingDouble
+	.type	setMappingDouble, @function
+setMappingDouble:
+.LVL223:
+.LFB111:
+	.loc 1 310 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 311 4 view .LVU507
+	.loc 1 313 4 view .LVU508
+	.loc 1 310 1 is_stmt 0 view .LVU509
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 313 24 view .LVU510
+	call	PyFloat_FromDouble@PLT
+.LVL224:
+	.loc 1 313 24 view .LVU511
+	movq	%rax, %rbx
+.LVL225:
+	.loc 1 314 4 is_stmt 1 view .LVU512
+	xorl	%eax, %eax
+.LVL226:
+	.loc 1 314 6 is_stmt 0 view .LVU513
+	testq	%rbx, %rbx
+	je	.L124
+	.loc 1 317 4 is_stmt 1 view .LVU514
+	.loc 1 317 7 is_stmt 0 view .LVU515
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyMapping_SetItemString@PLT
+.LVL227:
+.LBB136:
+.LBB137:
+	.loc 2 537 8 view .LVU516
+	subq	$1, (%rbx)
+.LBE137:
+.LBE136:
+	.loc 1 317 7 view .LVU517
+	movl	%eax, %ebp
+.LVL228:
+	.loc 1 320 4 is_stmt 1 view .LVU518
+.LBB140:
+.LBI136:
+	.loc 2 533 20 view .LVU519
+.LBB138:
+	.loc 2 537 5 view .LVU520
+	.loc 2 537 8 is_stmt 0 view .LVU521
+	je	.L126
+.LBE138:
+.LBE140:
+	.loc 1 317 6 view .LVU522
+	xorl	%eax, %eax
+.LVL229:
+	.loc 1 317 6 view .LVU523
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL230:
+.L124:
+	.loc 1 323 1 view .LVU524
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL231:
+	.loc 1 323 1 view .LVU525
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL232:
+	.loc 1 323 1 view .LVU526
+	ret
+.LVL233:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	.cfi_restore_state
+.LBB141:
+.LBB139:
+	.loc 2 538 9 is_stmt 1 view .LVU527
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL234:
+	.loc 2 538 9 is_stmt 0 view .LVU528
+.LBE139:
+.LBE141:
+	.loc 1 317 6 view .LVU529
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L124
+	.cfi_endproc
+.LFE111:
+	.size	setMappingDouble, .-setMappingDouble
+	.p2align 4
+	.globl	setMappingFloat
+	.type	setMappingFloat, @function
+setMappingFloat:
+.LVL235:
+.LFB112:
+	.loc 1 329 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 330 4 view .LVU531
+	.loc 1 332 4 view .LVU532
+	.loc 1 329 1 is_stmt 0 view .LVU533
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 332 24 view .LVU534
+	cvtss2sd	%xmm0, %xmm0
+.LVL236:
+	.loc 1 329 1 view .LVU535
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 332 24 view .LVU536
+	call	PyFloat_FromDouble@PLT
+.LVL237:
+	.loc 1 332 24 view .LVU537
+	movq	%rax, %rbx
+.LVL238:
+	.loc 1 333 4 is_stmt 1 view .LVU538
+	xorl	%eax, %eax
+.LVL239:
+	.loc 1 333 6 is_stmt 0 view .LVU539
+	testq	%rbx, %rbx
+	je	.L132
+	.loc 1 336 4 is_stmt 1 view .LVU540
+	.loc 1 336 7 is_stmt 0 view .LVU541
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyMapping_SetItemString@PLT
+.LVL240:
+.LBB142:
+.LBB143:
+	.loc 2 537 8 view .LVU542
+	subq	$1, (%rbx)
+.LBE143:
+.LBE142:
+	.loc 1 336 7 view .LVU543
+	movl	%eax, %ebp
+.LVL241:
+	.loc 1 339 4 is_stmt 1 view .LVU544
+.LBB146:
+.LBI142:
+	.loc 2 533 20 view .LVU545
+.LBB144:
+	.loc 2 537 5 view .LVU546
+	.loc 2 537 8 is_stmt 0 view .LVU547
+	je	.L134
+.LBE144:
+.LBE146:
+	.loc 1 336 6 view .LVU548
+	xorl	%eax, %eax
+.LVL242:
+	.loc 1 336 6 view .LVU549
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL243:
+.L132:
+	.loc 1 342 1 view .LVU550
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL244:
+	.loc 1 342 1 view .LVU551
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL245:
+	.loc 1 342 1 view .LVU552
+	ret
+.LVL246:
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	.cfi_restore_state
+.LBB147:
+.LBB145:
+	.loc 2 538 9 is_stmt 1 view .LVU553
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL247:
+	.loc 2 538 9 is_stmt 0 view .LVU554
+.LBE145:
+.LBE147:
+	.loc 1 336 6 view .LVU555
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L132
+	.cfi_endproc
+.LFE112:
+	.size	setMappingFloat, .-setMappingFloat
+	.p2align 4
+	.globl	setMappingString
+	.type	setMappingString, @function
+setMappingString:
+.LVL248:
+.LFB113:
+	.loc 1 348 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 349 4 view .LVU557
+	.loc 1 350 4 view .LVU558
+	.loc 1 348 1 is_stmt 0 view .LVU559
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	movq	%rdx, %rdi
+.LVL249:
+	.loc 1 348 1 view .LVU560
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 350 25 view .LVU561
+	call	PyUnicode_FromString@PLT
+.LVL250:
+	.loc 1 350 25 view .LVU562
+	movq	%rax, %rbx
+.LVL251:
+	.loc 1 351 4 is_stmt 1 view .LVU563
+	xorl	%eax, %eax
+.LVL252:
+	.loc 1 351 6 is_stmt 0 view .LVU564
+	testq	%rbx, %rbx
+	je	.L140
+	.loc 1 354 4 is_stmt 1 view .LVU565
+	.loc 1 354 7 is_stmt 0 view .LVU566
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyMapping_SetItemString@PLT
+.LVL253:
+.LBB148:
+.LBB149:
+	.loc 2 537 8 view .LVU567
+	subq	$1, (%rbx)
+.LBE149:
+.LBE148:
+	.loc 1 354 7 view .LVU568
+	movl	%eax, %ebp
+.LVL254:
+	.loc 1 357 4 is_stmt 1 view .LVU569
+.LBB152:
+.LBI148:
+	.loc 2 533 20 view .LVU570
+.LBB150:
+	.loc 2 537 5 view .LVU571
+	.loc 2 537 8 is_stmt 0 view .LVU572
+	je	.L142
+.LBE150:
+.LBE152:
+	.loc 1 354 6 view .LVU573
+	xorl	%eax, %eax
+.LVL255:
+	.loc 1 354 6 view .LVU574
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL256:
+.L140:
+	.loc 1 360 1 view .LVU575
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL257:
+	.loc 1 360 1 view .LVU576
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL258:
+	.loc 1 360 1 view .LVU577
+	ret
+.LVL259:
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	.cfi_restore_state
+.LBB153:
+.LBB151:
+	.loc 2 538 9 is_stmt 1 view .LVU578
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL260:
+	.loc 2 538 9 is_stmt 0 view .LVU579
+.LBE151:
+.LBE153:
+	.loc 1 354 6 view .LVU580
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L140
+	.cfi_endproc
+.LFE113:
+	.size	setMappingString, .-setMappingString
+	.p2align 4
+	.globl	setMappingString_Length
+	.type	setMappingString_Length, @function
+setMappingString_Length:
+.LVL261:
+.LFB114:
+	.loc 1 366 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 367 4 view .LVU582
+	.loc 1 368 4 view .LVU583
+	.loc 1 366 1 is_stmt 0 view .LVU584
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	.loc 1 368 25 view .LVU585
+	movslq	%ecx, %rsi
+.LVL262:
+	.loc 1 366 1 view .LVU586
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	movq	%rdx, %rdi
+.LVL263:
+	.loc 1 366 1 view .LVU587
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 368 25 view .LVU588
+	call	PyUnicode_FromStringAndSize@PLT
+.LVL264:
+	.loc 1 368 25 view .LVU589
+	movq	%rax, %rbx
+.LVL265:
+	.loc 1 369 4 is_stmt 1 view .LVU590
+	xorl	%eax, %eax
+.LVL266:
+	.loc 1 369 6 is_stmt 0 view .LVU591
+	testq	%rbx, %rbx
+	je	.L148
+	.loc 1 372 4 is_stmt 1 view .LVU592
+	.loc 1 372 7 is_stmt 0 view .LVU593
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyMapping_SetItemString@PLT
+.LVL267:
+.LBB154:
+.LBB155:
+	.loc 2 537 8 view .LVU594
+	subq	$1, (%rbx)
+.LBE155:
+.LBE154:
+	.loc 1 372 7 view .LVU595
+	movl	%eax, %ebp
+.LVL268:
+	.loc 1 375 4 is_stmt 1 view .LVU596
+.LBB158:
+.LBI154:
+	.loc 2 533 20 view .LVU597
+.LBB156:
+	.loc 2 537 5 view .LVU598
+	.loc 2 537 8 is_stmt 0 view .LVU599
+	je	.L150
+.LBE156:
+.LBE158:
+	.loc 1 372 6 view .LVU600
+	xorl	%eax, %eax
+.LVL269:
+	.loc 1 372 6 view .LVU601
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL270:
+.L148:
+	.loc 1 378 1 view .LVU602
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL271:
+	.loc 1 378 1 view .LVU603
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL272:
+	.loc 1 378 1 view .LVU604
+	ret
+.LVL273:
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.cfi_restore_state
+.LBB159:
+.LBB157:
+	.loc 2 538 9 is_stmt 1 view .LVU605
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL274:
+	.loc 2 538 9 is_stmt 0 view .LVU606
+.LBE157:
+.LBE159:
+	.loc 1 372 6 view .LVU607
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L148
+	.cfi_endproc
+.LFE114:
+	.size	setMappingString_Length, .-setMappingString_Length
+	.p2align 4
+	.globl	setObjectInteger
+	.type	setObjectInteger, @function
+setObjectInteger:
+.LVL275:
+.LFB115:
+	.loc 1 384 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 385 4 view .LVU609
+	.loc 1 387 4 view .LVU610
+	.loc 1 384 1 is_stmt 0 view .LVU611
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	.loc 1 387 24 view .LVU612
+	movslq	%edx, %rdi
+.LVL276:
+	.loc 1 384 1 view .LVU613
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 387 24 view .LVU614
+	call	PyLong_FromLong@PLT
+.LVL277:
+	.loc 1 387 24 view .LVU615
+	movq	%rax, %rbx
+.LVL278:
+	.loc 1 388 4 is_stmt 1 view .LVU616
+	xorl	%eax, %eax
+.LVL279:
+	.loc 1 388 6 is_stmt 0 view .LVU617
+	testq	%rbx, %rbx
+	je	.L156
+	.loc 1 391 4 is_stmt 1 view .LVU618
+	.loc 1 391 7 is_stmt 0 view .LVU619
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyObject_SetAttrString@PLT
+.LVL280:
+.LBB160:
+.LBB161:
+	.loc 2 537 8 view .LVU620
+	subq	$1, (%rbx)
+.LBE161:
+.LBE160:
+	.loc 1 391 7 view .LVU621
+	movl	%eax, %ebp
+.LVL281:
+	.loc 1 394 4 is_stmt 1 view .LVU622
+.LBB164:
+.LBI160:
+	.loc 2 533 20 view .LVU623
+.LBB162:
+	.loc 2 537 5 view .LVU624
+	.loc 2 537 8 is_stmt 0 view .LVU625
+	je	.L158
+.LBE162:
+.LBE164:
+	.loc 1 391 6 view .LVU626
+	xorl	%eax, %eax
+.LVL282:
+	.loc 1 391 6 view .LVU627
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL283:
+.L156:
+	.loc 1 397 1 view .LVU628
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL284:
+	.loc 1 397 1 view .LVU629
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL285:
+	.loc 1 397 1 view .LVU630
+	ret
+.LVL286:
+	.p2align 4,,10
+	.p2align 3
+.L158:
+	.cfi_restore_state
+.LBB165:
+.LBB163:
+	.loc 2 538 9 is_stmt 1 view .LVU631
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL287:
+	.loc 2 538 9 is_stmt 0 view .LVU632
+.LBE163:
+.LBE165:
+	.loc 1 391 6 view .LVU633
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L156
+	.cfi_endproc
+.LFE115:
+	.size	setObjectInteger, .-setObjectInteger
+	.p2align 4
+	.globl	setObjectLong
+	.type	setObjectLong, @function
+setObjectLong:
+.LVL288:
+.LFB116:
+	.loc 1 403 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 404 4 view .LVU635
+	.loc 1 406 4 view .LVU636
+	.loc 1 403 1 is_stmt 0 view .LVU637
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	movq	%rdx, %rdi
+.LVL289:
+	.loc 1 403 1 view .LVU638
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 406 24 view .LVU639
+	call	PyLong_FromLong@PLT
+.LVL290:
+	.loc 1 406 24 view .LVU640
+	movq	%rax, %rbx
+.LVL291:
+	.loc 1 407 4 is_stmt 1 view .LVU641
+	xorl	%eax, %eax
+.LVL292:
+	.loc 1 407 6 is_stmt 0 view .LVU642
+	testq	%rbx, %rbx
+	je	.L164
+	.loc 1 410 4 is_stmt 1 view .LVU643
+	.loc 1 410 7 is_stmt 0 view .LVU644
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyObject_SetAttrString@PLT
+.LVL293:
+.LBB166:
+.LBB167:
+	.loc 2 537 8 view .LVU645
+	subq	$1, (%rbx)
+.LBE167:
+.LBE166:
+	.loc 1 410 7 view .LVU646
+	movl	%eax, %ebp
+.LVL294:
+	.loc 1 413 4 is_stmt 1 view .LVU647
+.LBB170:
+.LBI166:
+	.loc 2 533 20 view .LVU648
+.LBB168:
+	.loc 2 537 5 view .LVU649
+	.loc 2 537 8 is_stmt 0 view .LVU650
+	je	.L166
+.LBE168:
+.LBE170:
+	.loc 1 410 6 view .LVU651
+	xorl	%eax, %eax
+.LVL295:
+	.loc 1 410 6 view .LVU652
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL296:
+.L164:
+	.loc 1 416 1 view .LVU653
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL297:
+	.loc 1 416 1 view .LVU654
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL298:
+	.loc 1 416 1 view .LVU655
+	ret
+.LVL299:
+	.p2align 4,,10
+	.p2align 3
+.L166:
+	.cfi_restore_state
+.LBB171:
+.LBB169:
+	.loc 2 538 9 is_stmt 1 view .LVU656
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL300:
+	.loc 2 538 9 is_stmt 0 view .LVU657
+.LBE169:
+.LBE171:
+	.loc 1 410 6 view .LVU658
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L164
+	.cfi_endproc
+.LFE116:
+	.size	setObjectLong, .-setObjectLong
+	.p2align 4
+	.globl	setObjectUnsignedLong
+	.type	setObjectUnsignedLong, @function
+setObjectUnsignedLong:
+.LVL301:
+.LFB117:
+	.loc 1 421 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 422 4 view .LVU660
+	.loc 1 424 4 view .LVU661
+	.loc 1 421 1 is_stmt 0 view .LVU662
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	movq	%rdx, %rdi
+.LVL302:
+	.loc 1 421 1 view .LVU663
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 424 24 view .LVU664
+	call	PyLong_FromLong@PLT
+.LVL303:
+	.loc 1 424 24 view .LVU665
+	movq	%rax, %rbx
+.LVL304:
+	.loc 1 425 4 is_stmt 1 view .LVU666
+	xorl	%eax, %eax
+.LVL305:
+	.loc 1 425 6 is_stmt 0 view .LVU667
+	testq	%rbx, %rbx
+	je	.L172
+	.loc 1 428 4 is_stmt 1 view .LVU668
+	.loc 1 428 7 is_stmt 0 view .LVU669
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyObject_SetAttrString@PLT
+.LVL306:
+.LBB172:
+.LBB173:
+	.loc 2 537 8 view .LVU670
+	subq	$1, (%rbx)
+.LBE173:
+.LBE172:
+	.loc 1 428 7 view .LVU671
+	movl	%eax, %ebp
+.LVL307:
+	.loc 1 431 4 is_stmt 1 view .LVU672
+.LBB176:
+.LBI172:
+	.loc 2 533 20 view .LVU673
+.LBB174:
+	.loc 2 537 5 view .LVU674
+	.loc 2 537 8 is_stmt 0 view .LVU675
+	je	.L174
+.LBE174:
+.LBE176:
+	.loc 1 428 6 view .LVU676
+	xorl	%eax, %eax
+.LVL308:
+	.loc 1 428 6 view .LVU677
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL309:
+.L172:
+	.loc 1 434 1 view .LVU678
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL310:
+	.loc 1 434 1 view .LVU679
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL311:
+	.loc 1 434 1 view .LVU680
+	ret
+.LVL312:
+	.p2align 4,,10
+	.p2align 3
+.L174:
+	.cfi_restore_state
+.LBB177:
+.LBB175:
+	.loc 2 538 9 is_stmt 1 view .LVU681
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL313:
+	.loc 2 538 9 is_stmt 0 view .LVU682
+.LBE175:
+.LBE177:
+	.loc 1 428 6 view .LVU683
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L172
+	.cfi_endproc
+.LFE117:
+	.size	setObjectUnsignedLong, .-setObjectUnsignedLong
+	.p2align 4
+	.globl	setObjectDouble
+	.type	setObjectDouble, @function
+setObjectDouble:
+.LVL314:
+.LFB118:
+	.loc 1 440 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 441 4 view .LVU685
+	.loc 1 443 4 view .LVU686
+	.loc 1 440 1 is_stmt 0 view .LVU687
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 443 24 view .LVU688
+	call	PyFloat_FromDouble@PLT
+.LVL315:
+	.loc 1 443 24 view .LVU689
+	movq	%rax, %rbx
+.LVL316:
+	.loc 1 444 4 is_stmt 1 view .LVU690
+	xorl	%eax, %eax
+.LVL317:
+	.loc 1 444 6 is_stmt 0 view .LVU691
+	testq	%rbx, %rbx
+	je	.L180
+	.loc 1 447 4 is_stmt 1 view .LVU692
+	.loc 1 447 7 is_stmt 0 view .LVU693
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyObject_SetAttrString@PLT
+.LVL318:
+.LBB178:
+.LBB179:
+	.loc 2 537 8 view .LVU694
+	subq	$1, (%rbx)
+.LBE179:
+.LBE178:
+	.loc 1 447 7 view .LVU695
+	movl	%eax, %ebp
+.LVL319:
+	.loc 1 450 4 is_stmt 1 view .LVU696
+.LBB182:
+.LBI178:
+	.loc 2 533 20 view .LVU697
+.LBB180:
+	.loc 2 537 5 view .LVU698
+	.loc 2 537 8 is_stmt 0 view .LVU699
+	je	.L182
+.LBE180:
+.LBE182:
+	.loc 1 447 6 view .LVU700
+	xorl	%eax, %eax
+.LVL320:
+	.loc 1 447 6 view .LVU701
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL321:
+.L180:
+	.loc 1 453 1 view .LVU702
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL322:
+	.loc 1 453 1 view .LVU703
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL323:
+	.loc 1 453 1 view .LVU704
+	ret
+.LVL324:
+	.p2align 4,,10
+	.p2align 3
+.L182:
+	.cfi_restore_state
+.LBB183:
+.LBB181:
+	.loc 2 538 9 is_stmt 1 view .LVU705
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL325:
+	.loc 2 538 9 is_stmt 0 view .LVU706
+.LBE181:
+.LBE183:
+	.loc 1 447 6 view .LVU707
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L180
+	.cfi_endproc
+.LFE118:
+	.size	setObjectDouble, .-setObjectDouble
+	.p2align 4
+	.globl	setObjectFloat
+	.type	setObjectFloat, @function
+setObjectFloat:
+.LVL326:
+.LFB119:
+	.loc 1 459 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 460 4 view .LVU709
+	.loc 1 462 4 view .LVU710
+	.loc 1 459 1 is_stmt 0 view .LVU711
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 462 24 view .LVU712
+	cvtss2sd	%xmm0, %xmm0
+.LVL327:
+	.loc 1 459 1 view .LVU713
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 462 24 view .LVU714
+	call	PyFloat_FromDouble@PLT
+.LVL328:
+	.loc 1 462 24 view .LVU715
+	movq	%rax, %rbx
+.LVL329:
+	.loc 1 463 4 is_stmt 1 view .LVU716
+	xorl	%eax, %eax
+.LVL330:
+	.loc 1 463 6 is_stmt 0 view .LVU717
+	testq	%rbx, %rbx
+	je	.L188
+	.loc 1 466 4 is_stmt 1 view .LVU718
+	.loc 1 466 7 is_stmt 0 view .LVU719
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyObject_SetAttrString@PLT
+.LVL331:
+.LBB184:
+.LBB185:
+	.loc 2 537 8 view .LVU720
+	subq	$1, (%rbx)
+.LBE185:
+.LBE184:
+	.loc 1 466 7 view .LVU721
+	movl	%eax, %ebp
+.LVL332:
+	.loc 1 469 4 is_stmt 1 view .LVU722
+.LBB188:
+.LBI184:
+	.loc 2 533 20 view .LVU723
+.LBB186:
+	.loc 2 537 5 view .LVU724
+	.loc 2 537 8 is_stmt 0 view .LVU725
+	je	.L190
+.LBE186:
+.LBE188:
+	.loc 1 466 6 view .LVU726
+	xorl	%eax, %eax
+.LVL333:
+	.loc 1 466 6 view .LVU727
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL334:
+.L188:
+	.loc 1 472 1 view .LVU728
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL335:
+	.loc 1 472 1 view .LVU729
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL336:
+	.loc 1 472 1 view .LVU730
+	ret
+.LVL337:
+	.p2align 4,,10
+	.p2align 3
+.L190:
+	.cfi_restore_state
+.LBB189:
+.LBB187:
+	.loc 2 538 9 is_stmt 1 view .LVU731
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL338:
+	.loc 2 538 9 is_stmt 0 view .LVU732
+.LBE187:
+.LBE189:
+	.loc 1 466 6 view .LVU733
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L188
+	.cfi_endproc
+.LFE119:
+	.size	setObjectFloat, .-setObjectFloat
+	.p2align 4
+	.globl	setObjectString
+	.type	setObjectString, @function
+setObjectString:
+.LVL339:
+.LFB120:
+	.loc 1 478 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 479 4 view .LVU735
+	.loc 1 480 4 view .LVU736
+	.loc 1 478 1 is_stmt 0 view .LVU737
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	movq	%rdx, %rdi
+.LVL340:
+	.loc 1 478 1 view .LVU738
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 480 25 view .LVU739
+	call	PyUnicode_FromString@PLT
+.LVL341:
+	.loc 1 480 25 view .LVU740
+	movq	%rax, %rbx
+.LVL342:
+	.loc 1 481 4 is_stmt 1 view .LVU741
+	xorl	%eax, %eax
+.LVL343:
+	.loc 1 481 6 is_stmt 0 view .LVU742
+	testq	%rbx, %rbx
+	je	.L196
+	.loc 1 484 4 is_stmt 1 view .LVU743
+	.loc 1 484 7 is_stmt 0 view .LVU744
+	movq	%rbp, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	PyObject_SetAttrString@PLT
+.LVL344:
+.LBB190:
+.LBB191:
+	.loc 2 537 8 view .LVU745
+	subq	$1, (%rbx)
+.LBE191:
+.LBE190:
+	.loc 1 484 7 view .LVU746
+	movl	%eax, %ebp
+.LVL345:
+	.loc 1 487 4 is_stmt 1 view .LVU747
+.LBB194:
+.LBI190:
+	.loc 2 533 20 view .LVU748
+.LBB192:
+	.loc 2 537 5 view .LVU749
+	.loc 2 537 8 is_stmt 0 view .LVU750
+	je	.L198
+.LBE192:
+.LBE194:
+	.loc 1 484 6 view .LVU751
+	xorl	%eax, %eax
+.LVL346:
+	.loc 1 484 6 view .LVU752
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL347:
+.L196:
+	.loc 1 490 1 view .LVU753
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL348:
+	.loc 1 490 1 view .LVU754
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL349:
+	.loc 1 490 1 view .LVU755
+	ret
+.LVL350:
+	.p2align 4,,10
+	.p2align 3
+.L198:
+	.cfi_restore_state
+.LBB195:
+.LBB193:
+	.loc 2 538 9 is_stmt 1 view .LVU756
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL351:
+	.loc 2 538 9 is_stmt 0 view .LVU757
+.LBE193:
+.LBE195:
+	.loc 1 484 6 view .LVU758
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+	jmp	.L196
+	.cfi_endproc
+.LFE120:
+	.size	setObjectString, .-setObjectString
+	.p2align 4
+	.globl	setObjectString_Length
+	.type	setObjectString_Length, @function
+setObjectString_Length:
+.LVL352:
+.LFB121:
+	.loc 1 496 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 497 4 view .LVU760
+	.loc 1 498 4 view .LVU761
+	.loc 1 500 4 view .LVU762
+	.loc 1 496 1 is_stmt 0 view .LVU763
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	.loc 1 500 7 view .LVU764
+	movq	%rdx, %rdi
+.LVL353:
+	.loc 1 496 1 view .LVU765
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movl	%ecx, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 500 7 view .LVU766
+	call	strlen@PLT
+.LVL354:
+	.loc 1 500 24 view .LVU767
+	movslq	%ebx, %rsi
+	.loc 1 500 6 view .LVU768
+	cmpq	%rsi, %rax
+	jb	.L212
+	.loc 1 503 4 is_stmt 1 view .LVU769
+	.loc 1 503 15 is_stmt 0 view .LVU770
+	movq	%rbp, %rdi
+	call	PyUnicode_FromStringAndSize@PLT
+.LVL355:
+	movq	%rax, %rbx
+.LVL356:
+	.loc 1 504 4 is_stmt 1 view .LVU771
+	.loc 1 505 14 is_stmt 0 view .LVU772
+	xorl	%eax, %eax
+.LVL357:
+	.loc 1 504 6 view .LVU773
+	testq	%rbx, %rbx
+	je	.L204
+	.loc 1 507 4 is_stmt 1 view .LVU774
+	.loc 1 507 7 is_stmt 0 view .LVU775
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	call	PyObject_SetAttrString@PLT
+.LVL358:
+.LBB196:
+.LBB197:
+	.loc 2 537 8 view .LVU776
+	subq	$1, (%rbx)
+.LBE197:
+.LBE196:
+	.loc 1 507 7 view .LVU777
+	movl	%eax, %ebp
+.LVL359:
+	.loc 1 510 4 is_stmt 1 view .LVU778
+.LBB200:
+.LBI196:
+	.loc 2 533 20 view .LVU779
+.LBB198:
+	.loc 2 537 5 view .LVU780
+	.loc 2 537 8 is_stmt 0 view .LVU781
+	je	.L207
+.LVL360:
+.L208:
+	.loc 2 537 8 view .LVU782
+.LBE198:
+.LBE200:
+	.loc 1 507 6 view .LVU783
+	xorl	%eax, %eax
+	cmpl	$-1, %ebp
+	setne	%al
+.LVL361:
+.L204:
+	.loc 1 513 1 view .LVU784
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL362:
+	.loc 1 513 1 view .LVU785
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL363:
+	.loc 1 513 1 view .LVU786
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL364:
+	.loc 1 513 1 view .LVU787
+	ret
+.LVL365:
+	.p2align 4,,10
+	.p2align 3
+.L212:
+	.cfi_restore_state
+	.loc 1 501 7 is_stmt 1 view .LVU788
+	.loc 1 513 1 is_stmt 0 view .LVU789
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 501 14 view .LVU790
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	.loc 1 513 1 view .LVU791
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL366:
+	.loc 1 513 1 view .LVU792
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL367:
+	.loc 1 513 1 view .LVU793
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL368:
+	.loc 1 513 1 view .LVU794
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL369:
+	.loc 1 501 14 view .LVU795
+	jmp	setObjectString@PLT
+.LVL370:
+	.p2align 4,,10
+	.p2align 3
+.L207:
+	.cfi_restore_state
+.LBB201:
+.LBB199:
+	.loc 2 538 9 is_stmt 1 view .LVU796
+	movq	%rbx, %rdi
+	call	_Py_Dealloc@PLT
+.LVL371:
+	.loc 2 538 9 is_stmt 0 view .LVU797
+	jmp	.L208
+.LBE199:
+.LBE201:
+	.cfi_endproc
+.LFE121:
+	.size	setObjectString_Length, .-setObjectString_Length
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"char"
+.LC1:
+	.string	"uchar"
+.LC2:
+	.string	"short"
+.LC3:
+	.string	"ushort"
+.LC4:
+	.string	"int"
+.LC5:
+	.string	"uint"
+.LC6:
+	.string	"long"
+.LC7:
+	.string	"ulong"
+.LC8:
+	.string	"float"
+.LC9:
+	.string	"double"
+.LC10:
+	.string	"Unsupported datatype '%c'\n"
+	.text
+	.p2align 4
+	.globl	translatePyFormatToHlHdf
+	.type	translatePyFormatToHlHdf, @function
+translatePyFormatToHlHdf:
+.LVL372:
+.LFB122:
+	.loc 1 519 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 520 4 view .LVU799
+	.loc 1 522 4 view .LVU800
+	leal	-66(%rdi), %eax
+	cmpb	$42, %al
+	ja	.L214
+	leaq	.L216(%rip), %rdx
+	movzbl	%al, %eax
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L216:
+	.long	.L225-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L224-.L216
+	.long	.L223-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L222-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L221-.L216
+	.long	.L221-.L216
+	.long	.L220-.L216
+	.long	.L214-.L216
+	.long	.L219-.L216
+	.long	.L214-.L216
+	.long	.L218-.L216
+	.long	.L217-.L216
+	.long	.L214-.L216
+	.long	.L214-.L216
+	.long	.L215-.L216
+	.text
+	.p2align 4,,10
+	.p2align 3
+.L214:
+	.loc 1 558 7 view .LVU801
+	.loc 1 519 1 is_stmt 0 view .LVU802
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 558 7 view .LVU803
+	movq	stderr@GOTPCREL(%rip), %rax
+	.loc 1 522 4 view .LVU804
+	movsbl	%dil, %edx
+	.loc 1 558 7 view .LVU805
+	leaq	.LC10(%rip), %rsi
+	movq	(%rax), %rdi
+.LVL373:
+	.loc 1 558 7 view .LVU806
+	xorl	%eax, %eax
+	call	fprintf@PLT
+.LVL374:
+	.loc 1 560 4 is_stmt 1 view .LVU807
+	.loc 1 561 1 is_stmt 0 view .LVU808
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL375:
+	.p2align 4,,10
+	.p2align 3
+.L221:
+	.loc 1 525 7 is_stmt 1 view .LVU809
+	.loc 1 525 12 is_stmt 0 view .LVU810
+	leaq	.LC0(%rip), %rdi
+.LVL376:
+	.loc 1 525 12 view .LVU811
+	jmp	strdup@PLT
+.LVL377:
+	.p2align 4,,10
+	.p2align 3
+.L220:
+	.loc 1 552 7 is_stmt 1 view .LVU812
+	.loc 1 552 12 is_stmt 0 view .LVU813
+	leaq	.LC9(%rip), %rdi
+.LVL378:
+	.loc 1 552 12 view .LVU814
+	jmp	strdup@PLT
+.LVL379:
+	.p2align 4,,10
+	.p2align 3
+.L225:
+	.loc 1 528 7 is_stmt 1 view .LVU815
+	.loc 1 528 12 is_stmt 0 view .LVU816
+	leaq	.LC1(%rip), %rdi
+.LVL380:
+	.loc 1 528 12 view .LVU817
+	jmp	strdup@PLT
+.LVL381:
+	.p2align 4,,10
+	.p2align 3
+.L224:
+	.loc 1 534 7 is_stmt 1 view .LVU818
+	.loc 1 534 12 is_stmt 0 view .LVU819
+	leaq	.LC3(%rip), %rdi
+.LVL382:
+	.loc 1 534 12 view .LVU820
+	jmp	strdup@PLT
+.LVL383:
+	.p2align 4,,10
+	.p2align 3
+.L217:
+	.loc 1 537 7 is_stmt 1 view .LVU821
+	.loc 1 537 12 is_stmt 0 view .LVU822
+	leaq	.LC4(%rip), %rdi
+.LVL384:
+	.loc 1 537 12 view .LVU823
+	jmp	strdup@PLT
+.LVL385:
+	.p2align 4,,10
+	.p2align 3
+.L215:
+	.loc 1 543 7 is_stmt 1 view .LVU824
+	.loc 1 543 12 is_stmt 0 view .LVU825
+	leaq	.LC6(%rip), %rdi
+.LVL386:
+	.loc 1 543 12 view .LVU826
+	jmp	strdup@PLT
+.LVL387:
+	.p2align 4,,10
+	.p2align 3
+.L223:
+	.loc 1 540 7 is_stmt 1 view .LVU827
+	.loc 1 540 12 is_stmt 0 view .LVU828
+	leaq	.LC5(%rip), %rdi
+.LVL388:
+	.loc 1 540 12 view .LVU829
+	jmp	strdup@PLT
+.LVL389:
+	.p2align 4,,10
+	.p2align 3
+.L222:
+	.loc 1 546 7 is_stmt 1 view .LVU830
+	.loc 1 546 12 is_stmt 0 view .LVU831
+	leaq	.LC7(%rip), %rdi
+.LVL390:
+	.loc 1 546 12 view .LVU832
+	jmp	strdup@PLT
+.LVL391:
+	.p2align 4,,10
+	.p2align 3
+.L219:
+	.loc 1 549 7 is_stmt 1 view .LVU833
+	.loc 1 549 12 is_stmt 0 view .LVU834
+	leaq	.LC8(%rip), %rdi
+.LVL392:
+	.loc 1 549 12 view .LVU835
+	jmp	strdup@PLT
+.LVL393:
+	.p2align 4,,10
+	.p2align 3
+.L218:
+	.loc 1 531 7 is_stmt 1 view .LVU836
+	.loc 1 531 12 is_stmt 0 view .LVU837
+	leaq	.LC2(%rip), %rdi
+.LVL394:
+	.loc 1 531 12 view .LVU838
+	jmp	strdup@PLT
+.LVL395:
+	.cfi_endproc
+.LFE122:
+	.size	translatePyFormatToHlHdf, .-translatePyFormatToHlHdf
+	.section	.rodata.str1.1
+.LC11:
+	.string	"schar"
+.LC12:
+	.string	"half"
+.LC13:
+	.string	"bfloat16"
+.LC14:
+	.string	"Unsupported type %s\n"
+	.text
+	.p2align 4
+	.globl	pyarraytypeFromHdfType
+	.type	pyarraytypeFromHdfType, @function
+pyarraytypeFromHdfType:
+.LVL396:
+.LFB123:
+	.loc 1 567 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 568 3 view .LVU840
+	.loc 1 568 6 is_stmt 0 view .LVU841
+	testq	%rdi, %rdi
+	je	.L260
+	.loc 1 567 1 view .LVU842
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 571 7 view .LVU843
+	leaq	.LC0(%rip), %rsi
+	movq	%rdi, %rbx
+	.loc 1 571 3 is_stmt 1 view .LVU844
+	.loc 1 571 7 is_stmt 0 view .LVU845
+	call	strcmp@PLT
+.LVL397:
+	.loc 1 571 7 view .LVU846
+	movl	%eax, %edx
+	.loc 1 572 12 view .LVU847
+	movl	$26, %eax
+	.loc 1 571 6 view .LVU848
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 573 10 is_stmt 1 view .LVU849
+	.loc 1 573 14 is_stmt 0 view .LVU850
+	leaq	.LC11(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL398:
+	movl	%eax, %edx
+	.loc 1 574 12 view .LVU851
+	movl	$1, %eax
+	.loc 1 573 13 view .LVU852
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 575 10 is_stmt 1 view .LVU853
+	.loc 1 575 14 is_stmt 0 view .LVU854
+	leaq	.LC1(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL399:
+	movl	%eax, %edx
+	.loc 1 576 12 view .LVU855
+	movl	$2, %eax
+	.loc 1 575 13 view .LVU856
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 577 10 is_stmt 1 view .LVU857
+	.loc 1 577 14 is_stmt 0 view .LVU858
+	leaq	.LC2(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL400:
+	movl	%eax, %edx
+	.loc 1 578 12 view .LVU859
+	movl	$3, %eax
+	.loc 1 577 13 view .LVU860
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 579 10 is_stmt 1 view .LVU861
+	.loc 1 579 14 is_stmt 0 view .LVU862
+	leaq	.LC3(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL401:
+	movl	%eax, %edx
+	.loc 1 580 12 view .LVU863
+	movl	$4, %eax
+	.loc 1 579 13 view .LVU864
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 581 10 is_stmt 1 view .LVU865
+	.loc 1 581 14 is_stmt 0 view .LVU866
+	leaq	.LC4(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL402:
+	movl	%eax, %edx
+	.loc 1 582 12 view .LVU867
+	movl	$5, %eax
+	.loc 1 581 13 view .LVU868
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 583 10 is_stmt 1 view .LVU869
+	.loc 1 583 14 is_stmt 0 view .LVU870
+	leaq	.LC5(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL403:
+	movl	%eax, %edx
+	.loc 1 584 12 view .LVU871
+	movl	$6, %eax
+	.loc 1 583 13 view .LVU872
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 585 10 is_stmt 1 view .LVU873
+	.loc 1 585 14 is_stmt 0 view .LVU874
+	leaq	.LC6(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL404:
+	movl	%eax, %edx
+	.loc 1 586 12 view .LVU875
+	movl	$7, %eax
+	.loc 1 585 13 view .LVU876
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 587 10 is_stmt 1 view .LVU877
+	.loc 1 587 14 is_stmt 0 view .LVU878
+	leaq	.LC7(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL405:
+	movl	%eax, %edx
+	.loc 1 588 12 view .LVU879
+	movl	$8, %eax
+	.loc 1 587 13 view .LVU880
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 589 10 is_stmt 1 view .LVU881
+	.loc 1 589 14 is_stmt 0 view .LVU882
+	leaq	.LC8(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL406:
+	movl	%eax, %edx
+	.loc 1 590 12 view .LVU883
+	movl	$11, %eax
+	.loc 1 589 13 view .LVU884
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 591 10 is_stmt 1 view .LVU885
+	.loc 1 591 14 is_stmt 0 view .LVU886
+	leaq	.LC9(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL407:
+	movl	%eax, %edx
+	.loc 1 592 12 view .LVU887
+	movl	$12, %eax
+	.loc 1 591 13 view .LVU888
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 593 10 is_stmt 1 view .LVU889
+	.loc 1 593 14 is_stmt 0 view .LVU890
+	leaq	.LC12(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL408:
+	movl	%eax, %edx
+	.loc 1 594 12 view .LVU891
+	movl	$23, %eax
+	.loc 1 593 13 view .LVU892
+	testl	%edx, %edx
+	je	.L228
+	.loc 1 595 10 is_stmt 1 view .LVU893
+	.loc 1 595 14 is_stmt 0 view .LVU894
+	leaq	.LC13(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL409:
+	.loc 1 595 13 view .LVU895
+	testl	%eax, %eax
+	jne	.L263
+	.loc 1 580 12 view .LVU896
+	movl	$4, %eax
+.L228:
+	.loc 1 602 1 view .LVU897
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL410:
+	.loc 1 602 1 view .LVU898
+	ret
+.LVL411:
+.L263:
+	.cfi_restore_state
+	.loc 1 598 5 is_stmt 1 view .LVU899
+	movq	stderr@GOTPCREL(%rip), %rax
+	movq	%rbx, %rdx
+	leaq	.LC14(%rip), %rsi
+	movq	(%rax), %rdi
+	xorl	%eax, %eax
+	call	fprintf@PLT
+.LVL412:
+	.loc 1 599 5 view .LVU900
+	.loc 1 569 12 is_stmt 0 view .LVU901
+	orl	$-1, %eax
+	.loc 1 602 1 view .LVU902
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL413:
+	.loc 1 602 1 view .LVU903
+	ret
+.LVL414:
+.L260:
+	.cfi_restore 3
+	.loc 1 569 12 view .LVU904
+	orl	$-1, %eax
+	.loc 1 602 1 view .LVU905
+	ret
+	.cfi_endproc
+.LFE123:
+	.size	pyarraytypeFromHdfType, .-pyarraytypeFromHdfType
+	.p2align 4
+	.globl	new1d_ArrayObject
+	.type	new1d_ArrayObject, @function
+new1d_ArrayObject:
+.LVL415:
+.LFB124:
+	.loc 1 609 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 610 4 view .LVU907
+	.loc 1 611 4 view .LVU908
+	.loc 1 612 4 view .LVU909
+	.loc 1 609 1 is_stmt 0 view .LVU910
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	%edi, %ebx
+	movq	%rsi, %rdi
+.LVL416:
+	.loc 1 609 1 view .LVU911
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 612 16 view .LVU912
+	call	pyarraytypeFromHdfType@PLT
+.LVL417:
+	.loc 1 614 4 is_stmt 1 view .LVU913
+	.loc 1 614 6 is_stmt 0 view .LVU914
+	cmpl	$-1, %eax
+	je	.L266
+	movl	%eax, %ecx
+	.loc 1 617 4 is_stmt 1 view .LVU915
+	.loc 1 619 148 is_stmt 0 view .LVU916
+	movq	PyArrayAPIXXX@GOTPCREL(%rip), %rax
+.LVL418:
+	.loc 1 617 12 view .LVU917
+	movslq	%ebx, %rdi
+	.loc 1 619 25 view .LVU918
+	xorl	%r9d, %r9d
+	.loc 1 617 12 view .LVU919
+	movq	%rdi, 8(%rsp)
+	.loc 1 619 4 is_stmt 1 view .LVU920
+	.loc 1 619 25 is_stmt 0 view .LVU921
+	leaq	8(%rsp), %rdx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	xorl	%r8d, %r8d
+	.loc 1 619 148 view .LVU922
+	movq	(%rax), %rax
+	.loc 1 619 25 view .LVU923
+	movl	$1, %esi
+	movq	16(%rax), %rdi
+	pushq	$0
+	.cfi_def_cfa_offset 48
+	pushq	$0
+	.cfi_def_cfa_offset 56
+	pushq	$0
+	.cfi_def_cfa_offset 64
+	call	*744(%rax)
+.LVL419:
+	.loc 1 621 4 is_stmt 1 view .LVU924
+	.loc 1 621 11 is_stmt 0 view .LVU925
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 32
+.LVL420:
+.L264:
+	.loc 1 622 1 view .LVU926
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL421:
+	.loc 1 622 1 view .LVU927
+	ret
+.LVL422:
+	.p2align 4,,10
+	.p2align 3
+.L266:
+	.cfi_restore_state
+	.loc 1 615 13 view .LVU928
+	xorl	%eax, %eax
+.LVL423:
+	.loc 1 615 13 view .LVU929
+	jmp	.L264
+	.cfi_endproc
+.LFE124:
+	.size	new1d_ArrayObject, .-new1d_ArrayObject
+	.p2align 4
+	.globl	new2d_ArrayObject
+	.type	new2d_ArrayObject, @function
+new2d_ArrayObject:
+.LVL424:
+.LFB125:
+	.loc 1 629 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 630 4 view .LVU931
+	.loc 1 631 4 view .LVU932
+	.loc 1 632 4 view .LVU933
+	.loc 1 629 1 is_stmt 0 view .LVU934
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%esi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movslq	%edi, %rbx
+	movq	%rdx, %rdi
+.LVL425:
+	.loc 1 629 1 view .LVU935
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 632 16 view .LVU936
+	call	pyarraytypeFromHdfType@PLT
+.LVL426:
+	.loc 1 634 4 is_stmt 1 view .LVU937
+	.loc 1 634 6 is_stmt 0 view .LVU938
+	cmpl	$-1, %eax
+	je	.L270
+	movl	%eax, %ecx
+	.loc 1 637 4 is_stmt 1 view .LVU939
+	.loc 1 640 148 is_stmt 0 view .LVU940
+	movq	PyArrayAPIXXX@GOTPCREL(%rip), %rax
+.LVL427:
+	.loc 1 637 12 view .LVU941
+	movslq	%ebp, %rsi
+	.loc 1 640 25 view .LVU942
+	movq	%rsp, %rdx
+	.loc 1 637 12 view .LVU943
+	movq	%rsi, (%rsp)
+	.loc 1 638 4 is_stmt 1 view .LVU944
+	.loc 1 640 25 is_stmt 0 view .LVU945
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 56
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	.loc 1 640 148 view .LVU946
+	movq	(%rax), %rax
+	.loc 1 638 12 view .LVU947
+	movq	%rbx, 16(%rsp)
+	.loc 1 640 4 is_stmt 1 view .LVU948
+	.loc 1 640 25 is_stmt 0 view .LVU949
+	movl	$2, %esi
+	movq	16(%rax), %rdi
+	pushq	$0
+	.cfi_def_cfa_offset 64
+	pushq	$0
+	.cfi_def_cfa_offset 72
+	pushq	$0
+	.cfi_def_cfa_offset 80
+	call	*744(%rax)
+.LVL428:
+	.loc 1 642 4 is_stmt 1 view .LVU950
+	.loc 1 642 11 is_stmt 0 view .LVU951
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 48
+.LVL429:
+.L268:
+	.loc 1 643 1 view .LVU952
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL430:
+	.loc 1 643 1 view .LVU953
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL431:
+	.loc 1 643 1 view .LVU954
+	ret
+.LVL432:
+	.p2align 4,,10
+	.p2align 3
+.L270:
+	.cfi_restore_state
+	.loc 1 635 13 view .LVU955
+	xorl	%eax, %eax
+.LVL433:
+	.loc 1 635 13 view .LVU956
+	jmp	.L268
+	.cfi_endproc
+.LFE125:
+	.size	new2d_ArrayObject, .-new2d_ArrayObject
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 8 "/usr/include/unistd.h"
+	.file 9 "/root/.pyenv/versions/3.11.7/include/python3.11/pyport.h"
+	.file 10 "/root/.pyenv/versions/3.11.7/include/python3.11/pytypedefs.h"
+	.file 11 "/root/.pyenv/versions/3.11.7/include/python3.11/methodobject.h"
+	.file 12 "/root/.pyenv/versions/3.11.7/include/python3.11/descrobject.h"
+	.file 13 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/object.h"
+	.file 14 "/root/.pyenv/versions/3.11.7/include/python3.11/pybuffer.h"
+	.file 15 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/npy_common.h"
+	.file 16 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/ndarraytypes.h"
+	.file 17 "/usr/include/stdio.h"
+	.file 18 "/root/.pyenv/versions/3.11.7/lib/python3.11/site-packages/numpy/core/include/numpy/__multiarray_api.h"
+	.file 19 "/usr/include/string.h"
+	.file 20 "/root/.pyenv/versions/3.11.7/include/python3.11/unicodeobject.h"
+	.file 21 "/root/.pyenv/versions/3.11.7/include/python3.11/floatobject.h"
+	.file 22 "/root/.pyenv/versions/3.11.7/include/python3.11/abstract.h"
+	.file 23 "/root/.pyenv/versions/3.11.7/include/python3.11/longobject.h"
+	.file 24 "/root/.pyenv/versions/3.11.7/include/python3.11/cpython/unicodeobject.h"
+	.file 25 "/root/.pyenv/versions/3.11.7/include/python3.11/pyerrors.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x3a60
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2d
+	.long	.LASF408
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF3
+	.uleb128 0x6
+	.long	.LASF13
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF5
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF6
+	.uleb128 0x14
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x27
+	.long	0x6b
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x28
+	.long	0x75
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF9
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF11
+	.uleb128 0x14
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0x6
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x98
+	.byte	0x12
+	.long	0x56
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x99
+	.byte	0x12
+	.long	0x56
+	.uleb128 0x2f
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x4
+	.byte	0xc2
+	.byte	0x12
+	.long	0x56
+	.uleb128 0x4
+	.long	0x75
+	.uleb128 0x6
+	.long	.LASF17
+	.byte	0x4
+	.byte	0xcf
+	.byte	0x12
+	.long	0x56
+	.uleb128 0x6
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x13
+	.long	0xb7
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF19
+	.uleb128 0x4
+	.long	0xec
+	.uleb128 0x30
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x106
+	.uleb128 0x2
+	.long	0xe7
+	.uleb128 0x2
+	.long	0xe7
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF58
+	.byte	0xd8
+	.byte	0x6
+	.byte	0x31
+	.long	0x28c
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x33
+	.byte	0x7
+	.long	0x4f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x36
+	.byte	0x9
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x37
+	.byte	0x9
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x6
+	.byte	0x38
+	.byte	0x9
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x9
+	.long	0xc3
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x9
+	.long	0xc3
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x9
+	.long	0xc3
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x9
+	.long	0xc3
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x40
+	.byte	0x9
+	.long	0xc3
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x41
+	.byte	0x9
+	.long	0xc3
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x42
+	.byte	0x9
+	.long	0xc3
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x44
+	.byte	0x16
+	.long	0x2a5
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x6
+	.byte	0x46
+	.byte	0x14
+	.long	0x2aa
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x6
+	.byte	0x48
+	.byte	0x7
+	.long	0x4f
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x6
+	.byte	0x49
+	.byte	0x7
+	.long	0x4f
+	.byte	0x74
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xb
+	.long	0x9d
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x12
+	.long	0x64
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xf
+	.long	0x8f
+	.byte	0x82
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x8
+	.long	0x2af
+	.byte	0x83
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x51
+	.byte	0xf
+	.long	0x2bf
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x59
+	.byte	0xd
+	.long	0xa9
+	.byte	0x90
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2c9
+	.byte	0x98
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2d3
+	.byte	0xa0
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0x6
+	.byte	0x5d
+	.byte	0x14
+	.long	0x2aa
+	.byte	0xa8
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x9
+	.long	0xb5
+	.byte	0xb0
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xa
+	.long	0x3c
+	.byte	0xb8
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0x6
+	.byte	0x60
+	.byte	0x7
+	.long	0x4f
+	.byte	0xc0
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x6
+	.byte	0x62
+	.byte	0x8
+	.long	0x2d8
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF49
+	.byte	0x7
+	.byte	0x7
+	.byte	0x19
+	.long	0x106
+	.uleb128 0x31
+	.long	.LASF409
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x25
+	.long	.LASF50
+	.uleb128 0x4
+	.long	0x2a0
+	.uleb128 0x4
+	.long	0x106
+	.uleb128 0x1d
+	.long	0x75
+	.long	0x2bf
+	.uleb128 0x1e
+	.long	0x48
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x298
+	.uleb128 0x25
+	.long	.LASF51
+	.uleb128 0x4
+	.long	0x2c4
+	.uleb128 0x25
+	.long	.LASF52
+	.uleb128 0x4
+	.long	0x2ce
+	.uleb128 0x1d
+	.long	0x75
+	.long	0x2e8
+	.uleb128 0x1e
+	.long	0x48
+	.byte	0x13
+	.byte	0
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x2f7
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x4
+	.long	0x28c
+	.uleb128 0x27
+	.long	0x2f7
+	.uleb128 0x32
+	.long	.LASF344
+	.byte	0x11
+	.byte	0x91
+	.byte	0xe
+	.long	0x2f7
+	.uleb128 0xc
+	.long	.LASF53
+	.byte	0x8
+	.value	0x10b
+	.byte	0x14
+	.long	0xc8
+	.uleb128 0x4
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF54
+	.byte	0x9
+	.byte	0x79
+	.byte	0x12
+	.long	0x30d
+	.uleb128 0x6
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x83
+	.byte	0x11
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF56
+	.byte	0x9
+	.byte	0x91
+	.byte	0x14
+	.long	0x32b
+	.uleb128 0x6
+	.long	.LASF57
+	.byte	0xa
+	.byte	0xe
+	.byte	0x1c
+	.long	0x34f
+	.uleb128 0x24
+	.long	.LASF57
+	.byte	0x20
+	.byte	0xb
+	.byte	0x36
+	.long	0x390
+	.uleb128 0x3
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x37
+	.byte	0x11
+	.long	0x6b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x38
+	.byte	0x11
+	.long	0xf09
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF61
+	.byte	0xb
+	.byte	0x39
+	.byte	0x9
+	.long	0x4f
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF62
+	.byte	0xb
+	.byte	0x3b
+	.byte	0x11
+	.long	0x6b
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF63
+	.byte	0xa
+	.byte	0xf
+	.byte	0x1c
+	.long	0x39c
+	.uleb128 0x24
+	.long	.LASF63
+	.byte	0x28
+	.byte	0xc
+	.byte	0xb
+	.long	0x3ea
+	.uleb128 0x3
+	.long	.LASF64
+	.byte	0xc
+	.byte	0xc
+	.byte	0x11
+	.long	0x6b
+	.byte	0
+	.uleb128 0x21
+	.string	"get"
+	.byte	0xc
+	.byte	0xd
+	.byte	0xc
+	.long	0xf2e
+	.byte	0x8
+	.uleb128 0x21
+	.string	"set"
+	.byte	0xc
+	.byte	0xe
+	.byte	0xc
+	.long	0xf3a
+	.byte	0x10
+	.uleb128 0x21
+	.string	"doc"
+	.byte	0xc
+	.byte	0xf
+	.byte	0x11
+	.long	0x6b
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF65
+	.byte	0xc
+	.byte	0x10
+	.byte	0xb
+	.long	0xb5
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF66
+	.byte	0xa
+	.byte	0x10
+	.byte	0x1c
+	.long	0x3f6
+	.uleb128 0x25
+	.long	.LASF66
+	.uleb128 0x6
+	.long	.LASF67
+	.byte	0xa
+	.byte	0x12
+	.byte	0x18
+	.long	0x407
+	.uleb128 0x24
+	.long	.LASF68
+	.byte	0x10
+	.byte	0x2
+	.byte	0x64
+	.long	0x42e
+	.uleb128 0x3
+	.long	.LASF69
+	.byte	0x2
+	.byte	0x66
+	.byte	0x10
+	.long	0x32b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF70
+	.byte	0x2
+	.byte	0x67
+	.byte	0x13
+	.long	0x779
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF71
+	.byte	0xa
+	.byte	0x14
+	.byte	0x1c
+	.long	0x43a
+	.uleb128 0x33
+	.long	.LASF72
+	.value	0x198
+	.byte	0xd
+	.byte	0x94
+	.byte	0x8
+	.long	0x6c6
+	.uleb128 0x3
+	.long	.LASF73
+	.byte	0xd
+	.byte	0x95
+	.byte	0x11
+	.long	0x7a1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF74
+	.byte	0xd
+	.byte	0x96
+	.byte	0x11
+	.long	0x6b
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0xd
+	.byte	0x97
+	.byte	0x10
+	.long	0x32b
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF76
+	.byte	0xd
+	.byte	0x97
+	.byte	0x1e
+	.long	0x32b
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF77
+	.byte	0xd
+	.byte	0x9b
+	.byte	0x10
+	.long	0x965
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF78
+	.byte	0xd
+	.byte	0x9c
+	.byte	0x10
+	.long	0x32b
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF79
+	.byte	0xd
+	.byte	0x9d
+	.byte	0x11
+	.long	0x981
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF80
+	.byte	0xd
+	.byte	0x9e
+	.byte	0x11
+	.long	0x9b2
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF81
+	.byte	0xd
+	.byte	0x9f
+	.byte	0x15
+	.long	0xee1
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF82
+	.byte	0xd
+	.byte	0xa1
+	.byte	0xe
+	.long	0x9e8
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF83
+	.byte	0xd
+	.byte	0xa5
+	.byte	0x16
+	.long	0xee6
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF84
+	.byte	0xd
+	.byte	0xa6
+	.byte	0x18
+	.long	0xeeb
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF85
+	.byte	0xd
+	.byte	0xa7
+	.byte	0x17
+	.long	0xef0
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF86
+	.byte	0xd
+	.byte	0xab
+	.byte	0xe
+	.long	0x9f4
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF87
+	.byte	0xd
+	.byte	0xac
+	.byte	0x11
+	.long	0x7f2
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF88
+	.byte	0xd
+	.byte	0xad
+	.byte	0xe
+	.long	0x9e8
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF89
+	.byte	0xd
+	.byte	0xae
+	.byte	0x12
+	.long	0x9a6
+	.byte	0x90
+	.uleb128 0x3
+	.long	.LASF90
+	.byte	0xd
+	.byte	0xaf
+	.byte	0x12
+	.long	0x9dc
+	.byte	0x98
+	.uleb128 0x3
+	.long	.LASF91
+	.byte	0xd
+	.byte	0xb2
+	.byte	0x14
+	.long	0xef5
+	.byte	0xa0
+	.uleb128 0x3
+	.long	.LASF92
+	.byte	0xd
+	.byte	0xb5
+	.byte	0x13
+	.long	0x48
+	.byte	0xa8
+	.uleb128 0x3
+	.long	.LASF93
+	.byte	0xd
+	.byte	0xb7
+	.byte	0x11
+	.long	0x6b
+	.byte	0xb0
+	.uleb128 0x3
+	.long	.LASF94
+	.byte	0xd
+	.byte	0xbb
+	.byte	0x12
+	.long	0x91f
+	.byte	0xb8
+	.uleb128 0x3
+	.long	.LASF95
+	.byte	0xd
+	.byte	0xbe
+	.byte	0xd
+	.long	0x81c
+	.byte	0xc0
+	.uleb128 0x3
+	.long	.LASF96
+	.byte	0xd
+	.byte	0xc2
+	.byte	0x11
+	.long	0xa14
+	.byte	0xc8
+	.uleb128 0x3
+	.long	.LASF97
+	.byte	0xd
+	.byte	0xc5
+	.byte	0x10
+	.long	0x32b
+	.byte	0xd0
+	.uleb128 0x3
+	.long	.LASF98
+	.byte	0xd
+	.byte	0xc8
+	.byte	0x11
+	.long	0xa3e
+	.byte	0xd8
+	.uleb128 0x3
+	.long	.LASF99
+	.byte	0xd
+	.byte	0xc9
+	.byte	0x12
+	.long	0xa4a
+	.byte	0xe0
+	.uleb128 0x3
+	.long	.LASF100
+	.byte	0xd
+	.byte	0xcc
+	.byte	0x12
+	.long	0xefa
+	.byte	0xe8
+	.uleb128 0x3
+	.long	.LASF101
+	.byte	0xd
+	.byte	0xcd
+	.byte	0x12
+	.long	0xeff
+	.byte	0xf0
+	.uleb128 0x3
+	.long	.LASF102
+	.byte	0xd
+	.byte	0xce
+	.byte	0x12
+	.long	0xf04
+	.byte	0xf8
+	.uleb128 0xf
+	.long	.LASF103
+	.byte	0xd0
+	.byte	0x13
+	.long	0x779
+	.value	0x100
+	.uleb128 0xf
+	.long	.LASF104
+	.byte	0xd1
+	.byte	0xf
+	.long	0x75e
+	.value	0x108
+	.uleb128 0xf
+	.long	.LASF105
+	.byte	0xd2
+	.byte	0x12
+	.long	0xa56
+	.value	0x110
+	.uleb128 0xf
+	.long	.LASF106
+	.byte	0xd3
+	.byte	0x12
+	.long	0xa62
+	.value	0x118
+	.uleb128 0xf
+	.long	.LASF107
+	.byte	0xd4
+	.byte	0x10
+	.long	0x32b
+	.value	0x120
+	.uleb128 0xf
+	.long	.LASF108
+	.byte	0xd5
+	.byte	0xe
+	.long	0xa6e
+	.value	0x128
+	.uleb128 0xf
+	.long	.LASF109
+	.byte	0xd6
+	.byte	0xf
+	.long	0xaa4
+	.value	0x130
+	.uleb128 0xf
+	.long	.LASF110
+	.byte	0xd7
+	.byte	0xd
+	.long	0xa7a
+	.value	0x138
+	.uleb128 0xf
+	.long	.LASF111
+	.byte	0xd8
+	.byte	0xe
+	.long	0x949
+	.value	0x140
+	.uleb128 0xf
+	.long	.LASF112
+	.byte	0xd9
+	.byte	0xd
+	.long	0x81c
+	.value	0x148
+	.uleb128 0xf
+	.long	.LASF113
+	.byte	0xda
+	.byte	0xf
+	.long	0x75e
+	.value	0x150
+	.uleb128 0xf
+	.long	.LASF114
+	.byte	0xdb
+	.byte	0xf
+	.long	0x75e
+	.value	0x158
+	.uleb128 0xf
+	.long	.LASF115
+	.byte	0xdc
+	.byte	0xf
+	.long	0x75e
+	.value	0x160
+	.uleb128 0xf
+	.long	.LASF116
+	.byte	0xdd
+	.byte	0xf
+	.long	0x75e
+	.value	0x168
+	.uleb128 0xf
+	.long	.LASF117
+	.byte	0xde
+	.byte	0xf
+	.long	0x75e
+	.value	0x170
+	.uleb128 0xf
+	.long	.LASF118
+	.byte	0xdf
+	.byte	0x10
+	.long	0x965
+	.value	0x178
+	.uleb128 0xf
+	.long	.LASF119
+	.byte	0xe2
+	.byte	0x12
+	.long	0x88
+	.value	0x180
+	.uleb128 0xf
+	.long	.LASF120
+	.byte	0xe4
+	.byte	0x10
+	.long	0x965
+	.value	0x188
+	.uleb128 0xf
+	.long	.LASF121
+	.byte	0xe5
+	.byte	0x14
+	.long	0xb48
+	.value	0x190
+	.byte	0
+	.uleb128 0x22
+	.byte	0x50
+	.byte	0xe
+	.byte	0x14
+	.long	0x75e
+	.uleb128 0x21
+	.string	"buf"
+	.byte	0xe
+	.byte	0x15
+	.byte	0xb
+	.long	0xb5
+	.byte	0
+	.uleb128 0x21
+	.string	"obj"
+	.byte	0xe
+	.byte	0x16
+	.byte	0xf
+	.long	0x75e
+	.byte	0x8
+	.uleb128 0x21
+	.string	"len"
+	.byte	0xe
+	.byte	0x17
+	.byte	0x10
+	.long	0x32b
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF122
+	.byte	0xe
+	.byte	0x18
+	.byte	0x10
+	.long	0x32b
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF123
+	.byte	0xe
+	.byte	0x1a
+	.byte	0x9
+	.long	0x4f
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF124
+	.byte	0xe
+	.byte	0x1b
+	.byte	0x9
+	.long	0x4f
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF125
+	.byte	0xe
+	.byte	0x1c
+	.byte	0xb
+	.long	0xc3
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF126
+	.byte	0xe
+	.byte	0x1d
+	.byte	0x11
+	.long	0x768
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF127
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x11
+	.long	0x768
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF128
+	.byte	0xe
+	.byte	0x1f
+	.byte	0x11
+	.long	0x768
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF129
+	.byte	0xe
+	.byte	0x20
+	.byte	0xb
+	.long	0xb5
+	.byte	0x48
+	.byte	0
+	.uleb128 0x4
+	.long	0x3fb
+	.uleb128 0x28
+	.long	0x75e
+	.uleb128 0x4
+	.long	0x32b
+	.uleb128 0x6
+	.long	.LASF130
+	.byte	0xe
+	.byte	0x21
+	.byte	0x3
+	.long	0x6c6
+	.uleb128 0x4
+	.long	0x42e
+	.uleb128 0x22
+	.byte	0x18
+	.byte	0x2
+	.byte	0x6d
+	.long	0x7a1
+	.uleb128 0x3
+	.long	.LASF73
+	.byte	0x2
+	.byte	0x6e
+	.byte	0xe
+	.long	0x3fb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF131
+	.byte	0x2
+	.byte	0x6f
+	.byte	0x10
+	.long	0x32b
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF132
+	.byte	0x2
+	.byte	0x70
+	.byte	0x3
+	.long	0x77e
+	.uleb128 0x6
+	.long	.LASF133
+	.byte	0x2
+	.byte	0xc4
+	.byte	0x16
+	.long	0x7b9
+	.uleb128 0x4
+	.long	0x7be
+	.uleb128 0xa
+	.long	0x75e
+	.long	0x7cd
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF134
+	.byte	0x2
+	.byte	0xc5
+	.byte	0x16
+	.long	0x7d9
+	.uleb128 0x4
+	.long	0x7de
+	.uleb128 0xa
+	.long	0x75e
+	.long	0x7f2
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF135
+	.byte	0x2
+	.byte	0xc6
+	.byte	0x16
+	.long	0x7fe
+	.uleb128 0x4
+	.long	0x803
+	.uleb128 0xa
+	.long	0x75e
+	.long	0x81c
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF136
+	.byte	0x2
+	.byte	0xc7
+	.byte	0xf
+	.long	0x828
+	.uleb128 0x4
+	.long	0x82d
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x83c
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF137
+	.byte	0x2
+	.byte	0xc8
+	.byte	0x16
+	.long	0x848
+	.uleb128 0x4
+	.long	0x84d
+	.uleb128 0xa
+	.long	0x32b
+	.long	0x85c
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF138
+	.byte	0x2
+	.byte	0xc9
+	.byte	0x15
+	.long	0x868
+	.uleb128 0x4
+	.long	0x86d
+	.uleb128 0xa
+	.long	0x75e
+	.long	0x881
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x32b
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF139
+	.byte	0x2
+	.byte	0xcb
+	.byte	0xe
+	.long	0x88d
+	.uleb128 0x4
+	.long	0x892
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x8ab
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x32b
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF140
+	.byte	0x2
+	.byte	0xcd
+	.byte	0xe
+	.long	0x8b7
+	.uleb128 0x4
+	.long	0x8bc
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x8d5
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF141
+	.byte	0x2
+	.byte	0xcf
+	.byte	0xf
+	.long	0x8e1
+	.uleb128 0x4
+	.long	0x8e6
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x8fa
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF142
+	.byte	0x2
+	.byte	0xd0
+	.byte	0xf
+	.long	0x906
+	.uleb128 0x4
+	.long	0x90b
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x91f
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF143
+	.byte	0x2
+	.byte	0xd1
+	.byte	0xf
+	.long	0x92b
+	.uleb128 0x4
+	.long	0x930
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x949
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x8fa
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF144
+	.byte	0x2
+	.byte	0xd4
+	.byte	0x10
+	.long	0x955
+	.uleb128 0x4
+	.long	0x95a
+	.uleb128 0x1b
+	.long	0x965
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF145
+	.byte	0x2
+	.byte	0xd5
+	.byte	0x10
+	.long	0x971
+	.uleb128 0x4
+	.long	0x976
+	.uleb128 0x1b
+	.long	0x981
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF146
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x15
+	.long	0x98d
+	.uleb128 0x4
+	.long	0x992
+	.uleb128 0xa
+	.long	0x75e
+	.long	0x9a6
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xc3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF147
+	.byte	0x2
+	.byte	0xd7
+	.byte	0x15
+	.long	0x7d9
+	.uleb128 0x6
+	.long	.LASF148
+	.byte	0x2
+	.byte	0xd8
+	.byte	0xf
+	.long	0x9be
+	.uleb128 0x4
+	.long	0x9c3
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x9dc
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xc3
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF149
+	.byte	0x2
+	.byte	0xd9
+	.byte	0xf
+	.long	0x8b7
+	.uleb128 0x6
+	.long	.LASF150
+	.byte	0x2
+	.byte	0xda
+	.byte	0x15
+	.long	0x7b9
+	.uleb128 0x6
+	.long	.LASF151
+	.byte	0x2
+	.byte	0xdb
+	.byte	0x15
+	.long	0xa00
+	.uleb128 0x4
+	.long	0xa05
+	.uleb128 0xa
+	.long	0x337
+	.long	0xa14
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF152
+	.byte	0x2
+	.byte	0xdc
+	.byte	0x15
+	.long	0xa20
+	.uleb128 0x4
+	.long	0xa25
+	.uleb128 0xa
+	.long	0x75e
+	.long	0xa3e
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x4f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF153
+	.byte	0x2
+	.byte	0xdd
+	.byte	0x15
+	.long	0x7b9
+	.uleb128 0x6
+	.long	.LASF154
+	.byte	0x2
+	.byte	0xde
+	.byte	0x15
+	.long	0x7b9
+	.uleb128 0x6
+	.long	.LASF155
+	.byte	0x2
+	.byte	0xdf
+	.byte	0x15
+	.long	0x7fe
+	.uleb128 0x6
+	.long	.LASF156
+	.byte	0x2
+	.byte	0xe0
+	.byte	0xf
+	.long	0x8b7
+	.uleb128 0x6
+	.long	.LASF157
+	.byte	0x2
+	.byte	0xe1
+	.byte	0xf
+	.long	0x8b7
+	.uleb128 0x6
+	.long	.LASF158
+	.byte	0x2
+	.byte	0xe2
+	.byte	0x15
+	.long	0xa86
+	.uleb128 0x4
+	.long	0xa8b
+	.uleb128 0xa
+	.long	0x75e
+	.long	0xaa4
+	.uleb128 0x2
+	.long	0x779
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF159
+	.byte	0x2
+	.byte	0xe3
+	.byte	0x15
+	.long	0xab0
+	.uleb128 0x4
+	.long	0xab5
+	.uleb128 0xa
+	.long	0x75e
+	.long	0xac9
+	.uleb128 0x2
+	.long	0x779
+	.uleb128 0x2
+	.long	0x32b
+	.byte	0
+	.uleb128 0x34
+	.byte	0x5
+	.byte	0x4
+	.long	0x4f
+	.byte	0x2
+	.value	0x2a4
+	.byte	0xe
+	.long	0xaeb
+	.uleb128 0xb
+	.long	.LASF160
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF161
+	.sleb128 -1
+	.uleb128 0xb
+	.long	.LASF162
+	.byte	0x1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF163
+	.byte	0x2
+	.value	0x2a8
+	.byte	0x3
+	.long	0xac9
+	.uleb128 0x6
+	.long	.LASF164
+	.byte	0xd
+	.byte	0x36
+	.byte	0xf
+	.long	0xb04
+	.uleb128 0x4
+	.long	0xb09
+	.uleb128 0xa
+	.long	0x4f
+	.long	0xb22
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xb22
+	.uleb128 0x2
+	.long	0x4f
+	.byte	0
+	.uleb128 0x4
+	.long	0x76d
+	.uleb128 0x6
+	.long	.LASF165
+	.byte	0xd
+	.byte	0x37
+	.byte	0x10
+	.long	0xb33
+	.uleb128 0x4
+	.long	0xb38
+	.uleb128 0x1b
+	.long	0xb48
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xb22
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF166
+	.byte	0xd
+	.byte	0x39
+	.byte	0x15
+	.long	0xb54
+	.uleb128 0x4
+	.long	0xb59
+	.uleb128 0xa
+	.long	0x75e
+	.long	0xb77
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xb77
+	.uleb128 0x2
+	.long	0x3c
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x4
+	.long	0x763
+	.uleb128 0x36
+	.value	0x120
+	.byte	0xd
+	.byte	0x3d
+	.byte	0x9
+	.long	0xd5b
+	.uleb128 0x3
+	.long	.LASF167
+	.byte	0xd
+	.byte	0x42
+	.byte	0x10
+	.long	0x7cd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF168
+	.byte	0xd
+	.byte	0x43
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF169
+	.byte	0xd
+	.byte	0x44
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF170
+	.byte	0xd
+	.byte	0x45
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF171
+	.byte	0xd
+	.byte	0x46
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF172
+	.byte	0xd
+	.byte	0x47
+	.byte	0x11
+	.long	0x7f2
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF173
+	.byte	0xd
+	.byte	0x48
+	.byte	0xf
+	.long	0x7ad
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF174
+	.byte	0xd
+	.byte	0x49
+	.byte	0xf
+	.long	0x7ad
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF175
+	.byte	0xd
+	.byte	0x4a
+	.byte	0xf
+	.long	0x7ad
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF176
+	.byte	0xd
+	.byte	0x4b
+	.byte	0xd
+	.long	0x81c
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF177
+	.byte	0xd
+	.byte	0x4c
+	.byte	0xf
+	.long	0x7ad
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF178
+	.byte	0xd
+	.byte	0x4d
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF179
+	.byte	0xd
+	.byte	0x4e
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF180
+	.byte	0xd
+	.byte	0x4f
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF181
+	.byte	0xd
+	.byte	0x50
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF182
+	.byte	0xd
+	.byte	0x51
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF183
+	.byte	0xd
+	.byte	0x52
+	.byte	0xf
+	.long	0x7ad
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF184
+	.byte	0xd
+	.byte	0x53
+	.byte	0xb
+	.long	0xb5
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF185
+	.byte	0xd
+	.byte	0x54
+	.byte	0xf
+	.long	0x7ad
+	.byte	0x90
+	.uleb128 0x3
+	.long	.LASF186
+	.byte	0xd
+	.byte	0x56
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x98
+	.uleb128 0x3
+	.long	.LASF187
+	.byte	0xd
+	.byte	0x57
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xa0
+	.uleb128 0x3
+	.long	.LASF188
+	.byte	0xd
+	.byte	0x58
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xa8
+	.uleb128 0x3
+	.long	.LASF189
+	.byte	0xd
+	.byte	0x59
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xb0
+	.uleb128 0x3
+	.long	.LASF190
+	.byte	0xd
+	.byte	0x5a
+	.byte	0x11
+	.long	0x7f2
+	.byte	0xb8
+	.uleb128 0x3
+	.long	.LASF191
+	.byte	0xd
+	.byte	0x5b
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xc0
+	.uleb128 0x3
+	.long	.LASF192
+	.byte	0xd
+	.byte	0x5c
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xc8
+	.uleb128 0x3
+	.long	.LASF193
+	.byte	0xd
+	.byte	0x5d
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xd0
+	.uleb128 0x3
+	.long	.LASF194
+	.byte	0xd
+	.byte	0x5e
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xd8
+	.uleb128 0x3
+	.long	.LASF195
+	.byte	0xd
+	.byte	0x5f
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xe0
+	.uleb128 0x3
+	.long	.LASF196
+	.byte	0xd
+	.byte	0x61
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xe8
+	.uleb128 0x3
+	.long	.LASF197
+	.byte	0xd
+	.byte	0x62
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xf0
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0xd
+	.byte	0x63
+	.byte	0x10
+	.long	0x7cd
+	.byte	0xf8
+	.uleb128 0xf
+	.long	.LASF199
+	.byte	0x64
+	.byte	0x10
+	.long	0x7cd
+	.value	0x100
+	.uleb128 0xf
+	.long	.LASF200
+	.byte	0x66
+	.byte	0xf
+	.long	0x7ad
+	.value	0x108
+	.uleb128 0xf
+	.long	.LASF201
+	.byte	0x68
+	.byte	0x10
+	.long	0x7cd
+	.value	0x110
+	.uleb128 0xf
+	.long	.LASF202
+	.byte	0x69
+	.byte	0x10
+	.long	0x7cd
+	.value	0x118
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF203
+	.byte	0xd
+	.byte	0x6a
+	.byte	0x3
+	.long	0xb7c
+	.uleb128 0x22
+	.byte	0x50
+	.byte	0xd
+	.byte	0x6c
+	.long	0xdf2
+	.uleb128 0x3
+	.long	.LASF204
+	.byte	0xd
+	.byte	0x6d
+	.byte	0xd
+	.long	0x83c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF205
+	.byte	0xd
+	.byte	0x6e
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF206
+	.byte	0xd
+	.byte	0x6f
+	.byte	0x12
+	.long	0x85c
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF207
+	.byte	0xd
+	.byte	0x70
+	.byte	0x12
+	.long	0x85c
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF208
+	.byte	0xd
+	.byte	0x71
+	.byte	0xb
+	.long	0xb5
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF209
+	.byte	0xd
+	.byte	0x72
+	.byte	0x15
+	.long	0x881
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF210
+	.byte	0xd
+	.byte	0x73
+	.byte	0xb
+	.long	0xb5
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF211
+	.byte	0xd
+	.byte	0x74
+	.byte	0x10
+	.long	0x8d5
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF212
+	.byte	0xd
+	.byte	0x76
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF213
+	.byte	0xd
+	.byte	0x77
+	.byte	0x12
+	.long	0x85c
+	.byte	0x48
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF214
+	.byte	0xd
+	.byte	0x78
+	.byte	0x3
+	.long	0xd67
+	.uleb128 0x22
+	.byte	0x18
+	.byte	0xd
+	.byte	0x7a
+	.long	0xe2e
+	.uleb128 0x3
+	.long	.LASF215
+	.byte	0xd
+	.byte	0x7b
+	.byte	0xd
+	.long	0x83c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF216
+	.byte	0xd
+	.byte	0x7c
+	.byte	0x10
+	.long	0x7cd
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF217
+	.byte	0xd
+	.byte	0x7d
+	.byte	0x13
+	.long	0x8ab
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF218
+	.byte	0xd
+	.byte	0x7e
+	.byte	0x3
+	.long	0xdfe
+	.uleb128 0x6
+	.long	.LASF219
+	.byte	0xd
+	.byte	0x80
+	.byte	0x18
+	.long	0xe46
+	.uleb128 0x4
+	.long	0xe4b
+	.uleb128 0xa
+	.long	0xaeb
+	.long	0xe64
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xe64
+	.byte	0
+	.uleb128 0x4
+	.long	0x75e
+	.uleb128 0x22
+	.byte	0x20
+	.byte	0xd
+	.byte	0x82
+	.long	0xea6
+	.uleb128 0x3
+	.long	.LASF220
+	.byte	0xd
+	.byte	0x83
+	.byte	0xf
+	.long	0x7ad
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF221
+	.byte	0xd
+	.byte	0x84
+	.byte	0xf
+	.long	0x7ad
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF222
+	.byte	0xd
+	.byte	0x85
+	.byte	0xf
+	.long	0x7ad
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF223
+	.byte	0xd
+	.byte	0x86
+	.byte	0xe
+	.long	0xe3a
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF224
+	.byte	0xd
+	.byte	0x87
+	.byte	0x3
+	.long	0xe69
+	.uleb128 0x22
+	.byte	0x10
+	.byte	0xd
+	.byte	0x89
+	.long	0xed5
+	.uleb128 0x3
+	.long	.LASF225
+	.byte	0xd
+	.byte	0x8a
+	.byte	0x14
+	.long	0xaf8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF226
+	.byte	0xd
+	.byte	0x8b
+	.byte	0x18
+	.long	0xb27
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF227
+	.byte	0xd
+	.byte	0x8c
+	.byte	0x3
+	.long	0xeb2
+	.uleb128 0x4
+	.long	0xea6
+	.uleb128 0x4
+	.long	0xd5b
+	.uleb128 0x4
+	.long	0xdf2
+	.uleb128 0x4
+	.long	0xe2e
+	.uleb128 0x4
+	.long	0xed5
+	.uleb128 0x4
+	.long	0x343
+	.uleb128 0x4
+	.long	0x3ea
+	.uleb128 0x4
+	.long	0x390
+	.uleb128 0x6
+	.long	.LASF228
+	.byte	0xb
+	.byte	0x13
+	.byte	0x15
+	.long	0x7d9
+	.uleb128 0x4
+	.long	0xf1a
+	.uleb128 0xa
+	.long	0x75e
+	.long	0xf2e
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF229
+	.byte	0xc
+	.byte	0x8
+	.byte	0x15
+	.long	0xf15
+	.uleb128 0x6
+	.long	.LASF230
+	.byte	0xc
+	.byte	0x9
+	.byte	0xf
+	.long	0xf46
+	.uleb128 0x4
+	.long	0xf4b
+	.uleb128 0xa
+	.long	0x4f
+	.long	0xf64
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x14
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF231
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF232
+	.uleb128 0x4
+	.long	0x81
+	.uleb128 0x4
+	.long	0x48
+	.uleb128 0x4
+	.long	0xb5
+	.uleb128 0x6
+	.long	.LASF233
+	.byte	0xf
+	.byte	0xc9
+	.byte	0x15
+	.long	0x31f
+	.uleb128 0xc
+	.long	.LASF234
+	.byte	0xf
+	.value	0x13b
+	.byte	0x17
+	.long	0x81
+	.uleb128 0xc
+	.long	.LASF235
+	.byte	0xf
+	.value	0x16c
+	.byte	0x13
+	.long	0x337
+	.uleb128 0x37
+	.long	.LASF410
+	.byte	0x7
+	.byte	0x4
+	.long	0x88
+	.byte	0x10
+	.byte	0x30
+	.byte	0x6
+	.long	0x1069
+	.uleb128 0xb
+	.long	.LASF236
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF237
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF238
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF239
+	.byte	0x3
+	.uleb128 0xb
+	.long	.LASF240
+	.byte	0x4
+	.uleb128 0xb
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF242
+	.byte	0x6
+	.uleb128 0xb
+	.long	.LASF243
+	.byte	0x7
+	.uleb128 0xb
+	.long	.LASF244
+	.byte	0x8
+	.uleb128 0xb
+	.long	.LASF245
+	.byte	0x9
+	.uleb128 0xb
+	.long	.LASF246
+	.byte	0xa
+	.uleb128 0xb
+	.long	.LASF247
+	.byte	0xb
+	.uleb128 0xb
+	.long	.LASF248
+	.byte	0xc
+	.uleb128 0xb
+	.long	.LASF249
+	.byte	0xd
+	.uleb128 0xb
+	.long	.LASF250
+	.byte	0xe
+	.uleb128 0xb
+	.long	.LASF251
+	.byte	0xf
+	.uleb128 0xb
+	.long	.LASF252
+	.byte	0x10
+	.uleb128 0xb
+	.long	.LASF253
+	.byte	0x11
+	.uleb128 0xb
+	.long	.LASF254
+	.byte	0x12
+	.uleb128 0xb
+	.long	.LASF255
+	.byte	0x13
+	.uleb128 0xb
+	.long	.LASF256
+	.byte	0x14
+	.uleb128 0xb
+	.long	.LASF257
+	.byte	0x15
+	.uleb128 0xb
+	.long	.LASF258
+	.byte	0x16
+	.uleb128 0xb
+	.long	.LASF259
+	.byte	0x17
+	.uleb128 0xb
+	.long	.LASF260
+	.byte	0x18
+	.uleb128 0xb
+	.long	.LASF261
+	.byte	0x19
+	.uleb128 0xb
+	.long	.LASF262
+	.byte	0x1a
+	.uleb128 0x38
+	.long	.LASF263
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF264
+	.byte	0x15
+	.byte	0
+	.uleb128 0x39
+	.byte	0x7
+	.byte	0x4
+	.long	0x88
+	.byte	0x10
+	.byte	0xd1
+	.byte	0xe
+	.long	0x108a
+	.uleb128 0xb
+	.long	.LASF265
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF266
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF267
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF268
+	.byte	0x10
+	.byte	0xd5
+	.byte	0x3
+	.long	0x1069
+	.uleb128 0xc
+	.long	.LASF269
+	.byte	0x10
+	.value	0x134
+	.byte	0x1f
+	.long	0x10a3
+	.uleb128 0x26
+	.long	.LASF270
+	.byte	0x20
+	.value	0x13a
+	.byte	0x8
+	.long	0x10d8
+	.uleb128 0x8
+	.long	.LASF271
+	.value	0x13b
+	.byte	0x1a
+	.long	0x1111
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF272
+	.value	0x13c
+	.byte	0x1b
+	.long	0x1116
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF273
+	.value	0x13e
+	.byte	0xb
+	.long	0x111b
+	.byte	0x10
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF274
+	.byte	0x10
+	.value	0x137
+	.byte	0xf
+	.long	0x10e5
+	.uleb128 0x1b
+	.long	0x10f0
+	.uleb128 0x2
+	.long	0x10f0
+	.byte	0
+	.uleb128 0x4
+	.long	0x1096
+	.uleb128 0xc
+	.long	.LASF275
+	.byte	0x10
+	.value	0x138
+	.byte	0x16
+	.long	0x1102
+	.uleb128 0xa
+	.long	0x10f0
+	.long	0x1111
+	.uleb128 0x2
+	.long	0x10f0
+	.byte	0
+	.uleb128 0x4
+	.long	0x10d8
+	.uleb128 0x4
+	.long	0x10f5
+	.uleb128 0x1d
+	.long	0xb5
+	.long	0x112b
+	.uleb128 0x1e
+	.long	0x48
+	.byte	0x1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF276
+	.byte	0x10
+	.value	0x16e
+	.byte	0x15
+	.long	0x1138
+	.uleb128 0xa
+	.long	0x75e
+	.long	0x114c
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF277
+	.byte	0x10
+	.value	0x16f
+	.byte	0xe
+	.long	0x1159
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x1172
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF278
+	.byte	0x10
+	.value	0x171
+	.byte	0xf
+	.long	0x117f
+	.uleb128 0x1b
+	.long	0x11a8
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0x4f
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF279
+	.byte	0x10
+	.value	0x174
+	.byte	0xf
+	.long	0x11b5
+	.uleb128 0x1b
+	.long	0x11cf
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0x4f
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF280
+	.byte	0x10
+	.value	0x175
+	.byte	0x13
+	.long	0x11dc
+	.uleb128 0xa
+	.long	0xf8d
+	.long	0x11f0
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF281
+	.byte	0x10
+	.value	0x17d
+	.byte	0xe
+	.long	0xed
+	.uleb128 0xc
+	.long	.LASF282
+	.byte	0x10
+	.value	0x17e
+	.byte	0xe
+	.long	0x120a
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x1228
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0x1228
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x4
+	.long	0xf81
+	.uleb128 0xc
+	.long	.LASF283
+	.byte	0x10
+	.value	0x180
+	.byte	0xf
+	.long	0x123a
+	.uleb128 0x1b
+	.long	0x1263
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF284
+	.byte	0x10
+	.value	0x183
+	.byte	0xf
+	.long	0x1270
+	.uleb128 0x1b
+	.long	0x128f
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF285
+	.byte	0x10
+	.value	0x18a
+	.byte	0xe
+	.long	0x129c
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x12ba
+	.uleb128 0x2
+	.long	0x2f7
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xc3
+	.uleb128 0x2
+	.long	0x12ba
+	.byte	0
+	.uleb128 0x4
+	.long	0x12bf
+	.uleb128 0x26
+	.long	.LASF286
+	.byte	0x60
+	.value	0x240
+	.byte	0x10
+	.long	0x139b
+	.uleb128 0x8
+	.long	.LASF73
+	.value	0x241
+	.byte	0x12
+	.long	0x3fb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x248
+	.byte	0x17
+	.long	0x779
+	.byte	0x10
+	.uleb128 0x8
+	.long	.LASF288
+	.value	0x24a
+	.byte	0xe
+	.long	0x75
+	.byte	0x18
+	.uleb128 0x8
+	.long	.LASF289
+	.value	0x24c
+	.byte	0xe
+	.long	0x75
+	.byte	0x19
+	.uleb128 0x8
+	.long	.LASF290
+	.value	0x251
+	.byte	0xe
+	.long	0x75
+	.byte	0x1a
+	.uleb128 0x8
+	.long	.LASF291
+	.value	0x253
+	.byte	0xe
+	.long	0x75
+	.byte	0x1b
+	.uleb128 0x8
+	.long	.LASF292
+	.value	0x255
+	.byte	0xd
+	.long	0x4f
+	.byte	0x1c
+	.uleb128 0x8
+	.long	.LASF293
+	.value	0x257
+	.byte	0xd
+	.long	0x4f
+	.byte	0x20
+	.uleb128 0x8
+	.long	.LASF294
+	.value	0x259
+	.byte	0xd
+	.long	0x4f
+	.byte	0x24
+	.uleb128 0x8
+	.long	.LASF295
+	.value	0x25f
+	.byte	0x1c
+	.long	0x1703
+	.byte	0x28
+	.uleb128 0x8
+	.long	.LASF296
+	.value	0x265
+	.byte	0x13
+	.long	0x75e
+	.byte	0x30
+	.uleb128 0x8
+	.long	.LASF297
+	.value	0x26a
+	.byte	0x13
+	.long	0x75e
+	.byte	0x38
+	.uleb128 0x29
+	.string	"f"
+	.value	0x26f
+	.byte	0x1b
+	.long	0x1708
+	.byte	0x40
+	.uleb128 0x8
+	.long	.LASF298
+	.value	0x271
+	.byte	0x13
+	.long	0x75e
+	.byte	0x48
+	.uleb128 0x8
+	.long	.LASF299
+	.value	0x277
+	.byte	0x15
+	.long	0x10f0
+	.byte	0x50
+	.uleb128 0x8
+	.long	.LASF300
+	.value	0x27b
+	.byte	0x14
+	.long	0xf9a
+	.byte	0x58
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF301
+	.byte	0x10
+	.value	0x18c
+	.byte	0xe
+	.long	0x13a8
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x13c6
+	.uleb128 0x2
+	.long	0xc3
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0x31a
+	.uleb128 0x2
+	.long	0x12ba
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF302
+	.byte	0x10
+	.value	0x18f
+	.byte	0xe
+	.long	0x13d3
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x13ec
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF303
+	.byte	0x10
+	.value	0x191
+	.byte	0xe
+	.long	0x13d3
+	.uleb128 0xc
+	.long	.LASF304
+	.byte	0x10
+	.value	0x192
+	.byte	0xe
+	.long	0x1406
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x1424
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0x1228
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF305
+	.byte	0x10
+	.value	0x19a
+	.byte	0xe
+	.long	0x1431
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x144f
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF306
+	.byte	0x10
+	.value	0x19c
+	.byte	0xe
+	.long	0x2e8
+	.uleb128 0xc
+	.long	.LASF307
+	.byte	0x10
+	.value	0x19e
+	.byte	0xf
+	.long	0x1469
+	.uleb128 0x1b
+	.long	0x1488
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF308
+	.byte	0x10
+	.value	0x1a0
+	.byte	0xf
+	.long	0x1495
+	.uleb128 0x1b
+	.long	0x14b4
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xf81
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF309
+	.byte	0x10
+	.value	0x1a2
+	.byte	0xe
+	.long	0x14c1
+	.uleb128 0xa
+	.long	0x4f
+	.long	0x14f3
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0x1228
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0xf81
+	.uleb128 0x2
+	.long	0x108a
+	.byte	0
+	.uleb128 0x3a
+	.value	0x178
+	.byte	0x10
+	.value	0x1ac
+	.byte	0x9
+	.long	0x1635
+	.uleb128 0x8
+	.long	.LASF310
+	.value	0x1b3
+	.byte	0x22
+	.long	0x1635
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF311
+	.value	0x1bb
+	.byte	0x1e
+	.long	0x164a
+	.byte	0xa8
+	.uleb128 0x8
+	.long	.LASF312
+	.value	0x1bc
+	.byte	0x1e
+	.long	0x164f
+	.byte	0xb0
+	.uleb128 0x8
+	.long	.LASF313
+	.value	0x1c2
+	.byte	0x20
+	.long	0x1654
+	.byte	0xb8
+	.uleb128 0x8
+	.long	.LASF314
+	.value	0x1c3
+	.byte	0x1f
+	.long	0x1659
+	.byte	0xc0
+	.uleb128 0x8
+	.long	.LASF315
+	.value	0x1c9
+	.byte	0x1e
+	.long	0x165e
+	.byte	0xc8
+	.uleb128 0x8
+	.long	.LASF316
+	.value	0x1cf
+	.byte	0x1a
+	.long	0x1663
+	.byte	0xd0
+	.uleb128 0x8
+	.long	.LASF317
+	.value	0x1d5
+	.byte	0x1a
+	.long	0x1668
+	.byte	0xd8
+	.uleb128 0x8
+	.long	.LASF318
+	.value	0x1dc
+	.byte	0x1b
+	.long	0x166d
+	.byte	0xe0
+	.uleb128 0x8
+	.long	.LASF319
+	.value	0x1e2
+	.byte	0x1e
+	.long	0x1672
+	.byte	0xe8
+	.uleb128 0x8
+	.long	.LASF320
+	.value	0x1e9
+	.byte	0x1e
+	.long	0x1677
+	.byte	0xf0
+	.uleb128 0x8
+	.long	.LASF321
+	.value	0x1f0
+	.byte	0x1b
+	.long	0x167c
+	.byte	0xf8
+	.uleb128 0x1a
+	.long	.LASF322
+	.value	0x1f6
+	.byte	0x25
+	.long	0x1681
+	.value	0x100
+	.uleb128 0x1a
+	.long	.LASF323
+	.value	0x1fc
+	.byte	0x1b
+	.long	0x1686
+	.value	0x108
+	.uleb128 0x1a
+	.long	.LASF324
+	.value	0x1fd
+	.byte	0x1e
+	.long	0x169b
+	.value	0x120
+	.uleb128 0x1a
+	.long	.LASF325
+	.value	0x205
+	.byte	0x13
+	.long	0x75e
+	.value	0x138
+	.uleb128 0x1a
+	.long	.LASF326
+	.value	0x20c
+	.byte	0x21
+	.long	0x16b0
+	.value	0x140
+	.uleb128 0x1a
+	.long	.LASF327
+	.value	0x20d
+	.byte	0xf
+	.long	0x16b5
+	.value	0x148
+	.uleb128 0x1a
+	.long	.LASF328
+	.value	0x20e
+	.byte	0xe
+	.long	0x16ba
+	.value	0x150
+	.uleb128 0x1a
+	.long	.LASF329
+	.value	0x210
+	.byte	0x1f
+	.long	0x16bf
+	.value	0x158
+	.uleb128 0x1a
+	.long	.LASF330
+	.value	0x211
+	.byte	0x22
+	.long	0x16c4
+	.value	0x160
+	.uleb128 0x1a
+	.long	.LASF331
+	.value	0x212
+	.byte	0x1f
+	.long	0x16c9
+	.value	0x168
+	.uleb128 0x1a
+	.long	.LASF332
+	.value	0x218
+	.byte	0x1a
+	.long	0x1663
+	.value	0x170
+	.byte	0
+	.uleb128 0x1d
+	.long	0x1645
+	.long	0x1645
+	.uleb128 0x1e
+	.long	0x48
+	.byte	0x14
+	.byte	0
+	.uleb128 0x4
+	.long	0x1263
+	.uleb128 0x4
+	.long	0x112b
+	.uleb128 0x4
+	.long	0x114c
+	.uleb128 0x4
+	.long	0x1172
+	.uleb128 0x4
+	.long	0x11a8
+	.uleb128 0x4
+	.long	0x11f0
+	.uleb128 0x4
+	.long	0x11fd
+	.uleb128 0x4
+	.long	0x122d
+	.uleb128 0x4
+	.long	0x128f
+	.uleb128 0x4
+	.long	0x139b
+	.uleb128 0x4
+	.long	0x11cf
+	.uleb128 0x4
+	.long	0x13c6
+	.uleb128 0x4
+	.long	0x1424
+	.uleb128 0x1d
+	.long	0x1696
+	.long	0x1696
+	.uleb128 0x1e
+	.long	0x48
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	0x13ec
+	.uleb128 0x1d
+	.long	0x16ab
+	.long	0x16ab
+	.uleb128 0x1e
+	.long	0x48
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	0x13f9
+	.uleb128 0x4
+	.long	0x144f
+	.uleb128 0x4
+	.long	0x16ba
+	.uleb128 0x4
+	.long	0x4f
+	.uleb128 0x4
+	.long	0x145c
+	.uleb128 0x4
+	.long	0x1488
+	.uleb128 0x4
+	.long	0x14b4
+	.uleb128 0xc
+	.long	.LASF333
+	.byte	0x10
+	.value	0x21a
+	.byte	0x3
+	.long	0x14f3
+	.uleb128 0x26
+	.long	.LASF334
+	.byte	0x10
+	.value	0x27e
+	.byte	0x10
+	.long	0x1703
+	.uleb128 0x8
+	.long	.LASF335
+	.value	0x27f
+	.byte	0x18
+	.long	0x171a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF126
+	.value	0x280
+	.byte	0x13
+	.long	0x75e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x16db
+	.uleb128 0x4
+	.long	0x16ce
+	.uleb128 0xc
+	.long	.LASF336
+	.byte	0x10
+	.value	0x27c
+	.byte	0x3
+	.long	0x12bf
+	.uleb128 0x4
+	.long	0x170d
+	.uleb128 0x26
+	.long	.LASF337
+	.byte	0x50
+	.value	0x2a5
+	.byte	0x10
+	.long	0x17a1
+	.uleb128 0x8
+	.long	.LASF73
+	.value	0x2a6
+	.byte	0xe
+	.long	0x3fb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF338
+	.value	0x2a8
+	.byte	0xb
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x29
+	.string	"nd"
+	.value	0x2aa
+	.byte	0x9
+	.long	0x4f
+	.byte	0x18
+	.uleb128 0x8
+	.long	.LASF339
+	.value	0x2ac
+	.byte	0xf
+	.long	0x1228
+	.byte	0x20
+	.uleb128 0x8
+	.long	.LASF127
+	.value	0x2b1
+	.byte	0xf
+	.long	0x1228
+	.byte	0x28
+	.uleb128 0x8
+	.long	.LASF335
+	.value	0x2c4
+	.byte	0xf
+	.long	0x75e
+	.byte	0x30
+	.uleb128 0x8
+	.long	.LASF340
+	.value	0x2c6
+	.byte	0x14
+	.long	0x171a
+	.byte	0x38
+	.uleb128 0x8
+	.long	.LASF291
+	.value	0x2c8
+	.byte	0x9
+	.long	0x4f
+	.byte	0x40
+	.uleb128 0x8
+	.long	.LASF341
+	.value	0x2ca
+	.byte	0xf
+	.long	0x75e
+	.byte	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF342
+	.byte	0x10
+	.value	0x2d4
+	.byte	0x3
+	.long	0x171f
+	.uleb128 0xc
+	.long	.LASF343
+	.byte	0x10
+	.value	0x2e0
+	.byte	0x1e
+	.long	0x17a1
+	.uleb128 0x4
+	.long	0x17ae
+	.uleb128 0x3b
+	.long	.LASF345
+	.byte	0x12
+	.value	0x27c
+	.byte	0xf
+	.long	0xf7c
+	.uleb128 0x1f
+	.long	.LASF346
+	.byte	0x13
+	.byte	0x9c
+	.byte	0xc
+	.long	0x4f
+	.long	0x17e8
+	.uleb128 0x2
+	.long	0x6b
+	.uleb128 0x2
+	.long	0x6b
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF347
+	.byte	0x11
+	.value	0x15e
+	.byte	0xc
+	.long	0x4f
+	.long	0x1805
+	.uleb128 0x2
+	.long	0x2fc
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x3c
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF348
+	.byte	0x13
+	.value	0x197
+	.byte	0xf
+	.long	0x3c
+	.long	0x181c
+	.uleb128 0x2
+	.long	0x6b
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF349
+	.byte	0x2
+	.value	0x122
+	.byte	0x2e
+	.long	0x4f
+	.long	0x183d
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x6b
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF350
+	.byte	0x14
+	.byte	0x82
+	.byte	0x34
+	.long	0x75e
+	.long	0x1858
+	.uleb128 0x2
+	.long	0x6b
+	.uleb128 0x2
+	.long	0x32b
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF351
+	.byte	0x14
+	.byte	0x89
+	.byte	0x34
+	.long	0x75e
+	.long	0x186e
+	.uleb128 0x2
+	.long	0x6b
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF352
+	.byte	0x15
+	.byte	0x27
+	.byte	0x34
+	.long	0x75e
+	.long	0x1884
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF353
+	.byte	0x16
+	.value	0x357
+	.byte	0x2e
+	.long	0x4f
+	.long	0x18a5
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x6b
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF354
+	.byte	0x17
+	.byte	0x10
+	.byte	0x35
+	.long	0x75e
+	.long	0x18bb
+	.uleb128 0x2
+	.long	0x56
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF355
+	.byte	0x16
+	.value	0x29c
+	.byte	0x35
+	.long	0x75e
+	.long	0x18d7
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x32b
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF356
+	.byte	0x13
+	.byte	0xbb
+	.byte	0xe
+	.long	0xc3
+	.long	0x18ed
+	.uleb128 0x2
+	.long	0x6b
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF357
+	.byte	0x18
+	.value	0x359
+	.byte	0x37
+	.long	0x6b
+	.long	0x1904
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF358
+	.byte	0x2
+	.value	0x121
+	.byte	0x35
+	.long	0x75e
+	.long	0x1920
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x6b
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF359
+	.byte	0x17
+	.byte	0x15
+	.byte	0x2f
+	.long	0x56
+	.long	0x1936
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF411
+	.byte	0x2
+	.value	0x1dd
+	.byte	0x2f
+	.long	0x1949
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF412
+	.byte	0x19
+	.byte	0x12
+	.byte	0x2f
+	.uleb128 0x1f
+	.long	.LASF360
+	.byte	0x15
+	.byte	0x2b
+	.byte	0x31
+	.long	0x2e
+	.long	0x1967
+	.uleb128 0x2
+	.long	0x75e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF361
+	.byte	0x16
+	.value	0x350
+	.byte	0x35
+	.long	0x75e
+	.long	0x1983
+	.uleb128 0x2
+	.long	0x75e
+	.uleb128 0x2
+	.long	0x6b
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF365
+	.value	0x273
+	.byte	0x10
+	.long	0x17bb
+	.quad	.LFB125
+	.quad	.LFE125-.LFB125
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a50
+	.uleb128 0x7
+	.long	.LASF362
+	.value	0x273
+	.byte	0x26
+	.long	0x4f
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x7
+	.long	.LASF363
+	.value	0x273
+	.byte	0x30
+	.long	0x4f
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x7
+	.long	.LASF125
+	.value	0x274
+	.byte	0x12
+	.long	0x6b
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x2a
+	.long	.LASF367
+	.value	0x276
+	.long	0x1a50
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x12
+	.string	"arr"
+	.value	0x277
+	.byte	0x13
+	.long	0x17bb
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x13
+	.long	.LASF364
+	.value	0x278
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0x5
+	.quad	.LVL426
+	.long	0x1b28
+	.long	0x1a30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL428
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0xf81
+	.long	0x1a60
+	.uleb128 0x1e
+	.long	0x48
+	.byte	0x1
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF366
+	.value	0x25f
+	.byte	0x10
+	.long	0x17bb
+	.quad	.LFB124
+	.quad	.LFE124-.LFB124
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b18
+	.uleb128 0x23
+	.string	"nl"
+	.value	0x25f
+	.byte	0x26
+	.long	0x4f
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x7
+	.long	.LASF125
+	.value	0x260
+	.byte	0x12
+	.long	0x6b
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x2a
+	.long	.LASF367
+	.value	0x262
+	.long	0x1b18
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x12
+	.string	"arr"
+	.value	0x263
+	.byte	0x13
+	.long	0x17bb
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x13
+	.long	.LASF364
+	.value	0x264
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x5
+	.quad	.LVL417
+	.long	0x1b28
+	.long	0x1af8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL419
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0xf81
+	.long	0x1b28
+	.uleb128 0x1e
+	.long	0x48
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF368
+	.value	0x236
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB123
+	.quad	.LFE123-.LFB123
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d61
+	.uleb128 0x7
+	.long	.LASF125
+	.value	0x236
+	.byte	0x28
+	.long	0x6b
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x5
+	.quad	.LVL397
+	.long	0x17cd
+	.long	0x1b83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL398
+	.long	0x17cd
+	.long	0x1ba8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL399
+	.long	0x17cd
+	.long	0x1bcd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL400
+	.long	0x17cd
+	.long	0x1bf2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL401
+	.long	0x17cd
+	.long	0x1c17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL402
+	.long	0x17cd
+	.long	0x1c3c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL403
+	.long	0x17cd
+	.long	0x1c61
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL404
+	.long	0x17cd
+	.long	0x1c86
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL405
+	.long	0x17cd
+	.long	0x1cab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL406
+	.long	0x17cd
+	.long	0x1cd0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL407
+	.long	0x17cd
+	.long	0x1cf5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL408
+	.long	0x17cd
+	.long	0x1d1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL409
+	.long	0x17cd
+	.long	0x1d3f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL412
+	.long	0x17e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF369
+	.value	0x206
+	.byte	0x7
+	.long	0xc3
+	.quad	.LFB122
+	.quad	.LFE122-.LFB122
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f04
+	.uleb128 0x7
+	.long	.LASF289
+	.value	0x206
+	.byte	0x25
+	.long	0x75
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x3f
+	.long	.LASF370
+	.byte	0x1
+	.value	0x208
+	.byte	0xa
+	.long	0xc3
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL374
+	.long	0x17e8
+	.long	0x1dd1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL377
+	.long	0x18d7
+	.long	0x1df0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL379
+	.long	0x18d7
+	.long	0x1e0f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL381
+	.long	0x18d7
+	.long	0x1e2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL383
+	.long	0x18d7
+	.long	0x1e4d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL385
+	.long	0x18d7
+	.long	0x1e6c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL387
+	.long	0x18d7
+	.long	0x1e8b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL389
+	.long	0x18d7
+	.long	0x1eaa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL391
+	.long	0x18d7
+	.long	0x1ec9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL393
+	.long	0x18d7
+	.long	0x1ee8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x2c
+	.quad	.LVL395
+	.long	0x18d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF371
+	.value	0x1ef
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB121
+	.quad	.LFE121-.LFB121
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x205d
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x1ef
+	.byte	0x26
+	.long	0x75e
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x1ef
+	.byte	0x31
+	.long	0xc3
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0x7
+	.long	.LASF374
+	.value	0x1ef
+	.byte	0x3f
+	.long	0xc3
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x23
+	.string	"len"
+	.value	0x1ef
+	.byte	0x4d
+	.long	0x4f
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x1f1
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x13
+	.long	.LASF375
+	.value	0x1f2
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI196
+	.byte	.LVU779
+	.long	.LLRL180
+	.value	0x1fe
+	.byte	0x4
+	.long	0x1fd9
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0x9
+	.quad	.LVL371
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL354
+	.long	0x1805
+	.long	0x1ff1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL355
+	.long	0x183d
+	.long	0x2015
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL358
+	.long	0x181c
+	.long	0x2039
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2c
+	.quad	.LVL370
+	.long	0x205d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF376
+	.value	0x1dd
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB120
+	.quad	.LFE120-.LFB120
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2158
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x1dd
+	.byte	0x1f
+	.long	0x75e
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x1dd
+	.byte	0x2a
+	.long	0xc3
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x7
+	.long	.LASF374
+	.value	0x1dd
+	.byte	0x38
+	.long	0xc3
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x1df
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x13
+	.long	.LASF375
+	.value	0x1e0
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI190
+	.byte	.LVU748
+	.long	.LLRL172
+	.value	0x1e7
+	.byte	0x4
+	.long	0x211e
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x9
+	.quad	.LVL351
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL341
+	.long	0x1858
+	.long	0x2137
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL344
+	.long	0x181c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF377
+	.value	0x1ca
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB119
+	.quad	.LFE119-.LFB119
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2257
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x1ca
+	.byte	0x1e
+	.long	0x75e
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x1ca
+	.byte	0x2a
+	.long	0xc3
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x7
+	.long	.LASF378
+	.value	0x1ca
+	.byte	0x39
+	.long	0x35
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x1cc
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x13
+	.long	.LASF379
+	.value	0x1ce
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI184
+	.byte	.LVU723
+	.long	.LLRL165
+	.value	0x1d5
+	.byte	0x4
+	.long	0x2219
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x9
+	.quad	.LVL338
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL328
+	.long	0x186e
+	.long	0x2236
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL331
+	.long	0x181c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF380
+	.value	0x1b7
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB118
+	.quad	.LFE118-.LFB118
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2354
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x1b7
+	.byte	0x1f
+	.long	0x75e
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x1b7
+	.byte	0x2b
+	.long	0xc3
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x7
+	.long	.LASF378
+	.value	0x1b7
+	.byte	0x3b
+	.long	0x2e
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x1b9
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x13
+	.long	.LASF379
+	.value	0x1bb
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI178
+	.byte	.LVU697
+	.long	.LLRL158
+	.value	0x1c2
+	.byte	0x4
+	.long	0x2318
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x9
+	.quad	.LVL325
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL315
+	.long	0x186e
+	.long	0x2333
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL318
+	.long	0x181c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF381
+	.value	0x1a4
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB117
+	.quad	.LFE117-.LFB117
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x244f
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x1a4
+	.byte	0x25
+	.long	0x75e
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x1a4
+	.byte	0x31
+	.long	0xc3
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x7
+	.long	.LASF378
+	.value	0x1a4
+	.byte	0x48
+	.long	0x48
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x1a6
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x13
+	.long	.LASF379
+	.value	0x1a8
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI172
+	.byte	.LVU673
+	.long	.LLRL151
+	.value	0x1af
+	.byte	0x4
+	.long	0x2415
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x9
+	.quad	.LVL313
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL303
+	.long	0x18a5
+	.long	0x242e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL306
+	.long	0x181c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF382
+	.value	0x192
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB116
+	.quad	.LFE116-.LFB116
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x254a
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x192
+	.byte	0x1d
+	.long	0x75e
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x192
+	.byte	0x29
+	.long	0xc3
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x7
+	.long	.LASF378
+	.value	0x192
+	.byte	0x37
+	.long	0x56
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x194
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x13
+	.long	.LASF379
+	.value	0x196
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI166
+	.byte	.LVU648
+	.long	.LLRL144
+	.value	0x19d
+	.byte	0x4
+	.long	0x2510
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x9
+	.quad	.LVL300
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL290
+	.long	0x18a5
+	.long	0x2529
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL293
+	.long	0x181c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF383
+	.value	0x17f
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB115
+	.quad	.LFE115-.LFB115
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x264b
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x17f
+	.byte	0x20
+	.long	0x75e
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x17f
+	.byte	0x2c
+	.long	0xc3
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x7
+	.long	.LASF378
+	.value	0x17f
+	.byte	0x39
+	.long	0x4f
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x181
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x13
+	.long	.LASF379
+	.value	0x183
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI160
+	.byte	.LVU623
+	.long	.LLRL137
+	.value	0x18a
+	.byte	0x4
+	.long	0x260b
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x9
+	.quad	.LVL287
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL277
+	.long	0x18a5
+	.long	0x262a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL280
+	.long	0x181c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF384
+	.value	0x16d
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB114
+	.quad	.LFE114-.LFB114
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2767
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x16d
+	.byte	0x27
+	.long	0x75e
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x16d
+	.byte	0x32
+	.long	0xc3
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x7
+	.long	.LASF374
+	.value	0x16d
+	.byte	0x40
+	.long	0xc3
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x23
+	.string	"len"
+	.value	0x16d
+	.byte	0x4e
+	.long	0x4f
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x16f
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x13
+	.long	.LASF375
+	.value	0x170
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI154
+	.byte	.LVU597
+	.long	.LLRL130
+	.value	0x177
+	.byte	0x4
+	.long	0x2720
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x9
+	.quad	.LVL274
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL264
+	.long	0x183d
+	.long	0x2746
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL267
+	.long	0x1884
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF385
+	.value	0x15b
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB113
+	.quad	.LFE113-.LFB113
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2862
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x15b
+	.byte	0x20
+	.long	0x75e
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x15b
+	.byte	0x2b
+	.long	0xc3
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x7
+	.long	.LASF374
+	.value	0x15b
+	.byte	0x39
+	.long	0xc3
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x15d
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x13
+	.long	.LASF375
+	.value	0x15e
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI148
+	.byte	.LVU570
+	.long	.LLRL122
+	.value	0x165
+	.byte	0x4
+	.long	0x2828
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x9
+	.quad	.LVL260
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL250
+	.long	0x1858
+	.long	0x2841
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL253
+	.long	0x1884
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF386
+	.value	0x148
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB112
+	.quad	.LFE112-.LFB112
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2961
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x148
+	.byte	0x1f
+	.long	0x75e
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x148
+	.byte	0x2b
+	.long	0xc3
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x7
+	.long	.LASF378
+	.value	0x148
+	.byte	0x3a
+	.long	0x35
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x14a
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x13
+	.long	.LASF379
+	.value	0x14c
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI142
+	.byte	.LVU545
+	.long	.LLRL115
+	.value	0x153
+	.byte	0x4
+	.long	0x2923
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x9
+	.quad	.LVL247
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL237
+	.long	0x186e
+	.long	0x2940
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL240
+	.long	0x1884
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF387
+	.value	0x135
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB111
+	.quad	.LFE111-.LFB111
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a5e
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x135
+	.byte	0x20
+	.long	0x75e
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x135
+	.byte	0x2c
+	.long	0xc3
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x7
+	.long	.LASF378
+	.value	0x135
+	.byte	0x3c
+	.long	0x2e
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x137
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x13
+	.long	.LASF379
+	.value	0x139
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI136
+	.byte	.LVU519
+	.long	.LLRL108
+	.value	0x140
+	.byte	0x4
+	.long	0x2a22
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x9
+	.quad	.LVL234
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL224
+	.long	0x186e
+	.long	0x2a3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL227
+	.long	0x1884
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF388
+	.value	0x122
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB110
+	.quad	.LFE110-.LFB110
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2b5f
+	.uleb128 0x7
+	.long	.LASF372
+	.value	0x122
+	.byte	0x21
+	.long	0x75e
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x7
+	.long	.LASF373
+	.value	0x122
+	.byte	0x2d
+	.long	0xc3
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x7
+	.long	.LASF378
+	.value	0x122
+	.byte	0x3a
+	.long	0x4f
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x124
+	.byte	0x8
+	.long	0x4f
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x13
+	.long	.LASF379
+	.value	0x126
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI130
+	.byte	.LVU495
+	.long	.LLRL101
+	.value	0x12d
+	.byte	0x4
+	.long	0x2b1f
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x9
+	.quad	.LVL222
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL212
+	.long	0x18a5
+	.long	0x2b3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL215
+	.long	0x1884
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF389
+	.value	0x112
+	.byte	0x7
+	.long	0xc3
+	.quad	.LFB109
+	.quad	.LFE109-.LFB109
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c58
+	.uleb128 0x7
+	.long	.LASF64
+	.value	0x112
+	.byte	0x25
+	.long	0xc3
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x7
+	.long	.LASF390
+	.value	0x112
+	.byte	0x35
+	.long	0x75e
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x12
+	.string	"pyo"
+	.value	0x114
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x13
+	.long	.LASF391
+	.value	0x115
+	.byte	0xa
+	.long	0xc3
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI122
+	.byte	.LVU468
+	.long	.LLRL94
+	.value	0x119
+	.byte	0x7
+	.long	0x2c05
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x10
+	.quad	.LVL209
+	.long	0x1936
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL199
+	.long	0x1967
+	.long	0x2c25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL201
+	.long	0x18ed
+	.long	0x2c3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL202
+	.long	0x18d7
+	.uleb128 0x10
+	.quad	.LVL205
+	.long	0x1949
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF392
+	.value	0x102
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB108
+	.quad	.LFE108-.LFB108
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d51
+	.uleb128 0x23
+	.string	"idx"
+	.value	0x102
+	.byte	0x1f
+	.long	0x4f
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x23
+	.string	"val"
+	.value	0x102
+	.byte	0x2c
+	.long	0x2d51
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x7
+	.long	.LASF393
+	.value	0x102
+	.byte	0x3b
+	.long	0x75e
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x12
+	.string	"pyo"
+	.value	0x104
+	.byte	0xe
+	.long	0x75e
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x15
+	.long	0x3a4c
+	.quad	.LBI118
+	.byte	.LVU435
+	.long	.LLRL88
+	.value	0x108
+	.byte	0x7
+	.long	0x2d05
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x9
+	.quad	.LVL195
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL186
+	.long	0x18bb
+	.long	0x2d2b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL187
+	.long	0x1951
+	.long	0x2d43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL192
+	.long	0x1949
+	.byte	0
+	.uleb128 0x4
+	.long	0x2e
+	.uleb128 0x16
+	.long	.LASF394
+	.byte	0xf2
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB107
+	.quad	.LFE107-.LFB107
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e47
+	.uleb128 0x17
+	.string	"idx"
+	.byte	0xf2
+	.byte	0x20
+	.long	0x4f
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x17
+	.string	"val"
+	.byte	0xf2
+	.byte	0x2a
+	.long	0x16ba
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0xe
+	.long	.LASF393
+	.byte	0xf2
+	.byte	0x39
+	.long	0x75e
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0xf4
+	.long	0x75e
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI114
+	.byte	.LVU405
+	.long	.LLRL82
+	.byte	0xf8
+	.long	0x2dfb
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x9
+	.quad	.LVL182
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL173
+	.long	0x18bb
+	.long	0x2e21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL174
+	.long	0x1920
+	.long	0x2e39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL179
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF395
+	.byte	0xe2
+	.byte	0x7
+	.long	0xc3
+	.quad	.LFB106
+	.quad	.LFE106-.LFB106
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2f39
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0xe2
+	.byte	0x21
+	.long	0xc3
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0xe2
+	.byte	0x31
+	.long	0x75e
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0xe4
+	.long	0x75e
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x40
+	.long	.LASF391
+	.byte	0x1
+	.byte	0xe5
+	.byte	0xa
+	.long	0xc3
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI106
+	.byte	.LVU378
+	.long	.LLRL76
+	.byte	0xe9
+	.long	0x2ee6
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x10
+	.quad	.LVL169
+	.long	0x1936
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL159
+	.long	0x1904
+	.long	0x2f06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL161
+	.long	0x18ed
+	.long	0x2f1e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL162
+	.long	0x18d7
+	.uleb128 0x10
+	.quad	.LVL165
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF396
+	.byte	0xd2
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB105
+	.quad	.LFE105-.LFB105
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3024
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0xd2
+	.byte	0x1d
+	.long	0xc3
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x17
+	.string	"val"
+	.byte	0xd2
+	.byte	0x32
+	.long	0xf72
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0xd2
+	.byte	0x41
+	.long	0x75e
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0xd4
+	.long	0x75e
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI102
+	.byte	.LVU345
+	.long	.LLRL70
+	.byte	0xd8
+	.long	0x2fde
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x9
+	.quad	.LVL155
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL146
+	.long	0x1904
+	.long	0x2ffe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL147
+	.long	0x1920
+	.long	0x3016
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL152
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF397
+	.byte	0xc2
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB104
+	.quad	.LFE104-.LFB104
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x310f
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0xc2
+	.byte	0x1e
+	.long	0xc3
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x17
+	.string	"val"
+	.byte	0xc2
+	.byte	0x2b
+	.long	0x310f
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0xc2
+	.byte	0x3a
+	.long	0x75e
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0xc4
+	.long	0x75e
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI98
+	.byte	.LVU315
+	.long	.LLRL64
+	.byte	0xc8
+	.long	0x30c9
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x9
+	.quad	.LVL142
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL133
+	.long	0x1904
+	.long	0x30e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL134
+	.long	0x1920
+	.long	0x3101
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL139
+	.long	0x1949
+	.byte	0
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x16
+	.long	.LASF398
+	.byte	0xb1
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB103
+	.quad	.LFE103-.LFB103
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x31ff
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0xb1
+	.byte	0x25
+	.long	0xc3
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x17
+	.string	"val"
+	.byte	0xb1
+	.byte	0x3a
+	.long	0xf77
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0xb1
+	.byte	0x49
+	.long	0x75e
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0xb3
+	.long	0x75e
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI94
+	.byte	.LVU285
+	.long	.LLRL58
+	.byte	0xb7
+	.long	0x31b9
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x9
+	.quad	.LVL129
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL120
+	.long	0x1904
+	.long	0x31d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL121
+	.long	0x1920
+	.long	0x31f1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL126
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF399
+	.byte	0xa1
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB102
+	.quad	.LFE102-.LFB102
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x32ea
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0xa1
+	.byte	0x1d
+	.long	0xc3
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x17
+	.string	"val"
+	.byte	0xa1
+	.byte	0x29
+	.long	0x32ea
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0xa1
+	.byte	0x38
+	.long	0x75e
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0xa3
+	.long	0x75e
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI90
+	.byte	.LVU255
+	.long	.LLRL52
+	.byte	0xa7
+	.long	0x32a4
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x9
+	.quad	.LVL116
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL107
+	.long	0x1904
+	.long	0x32c4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL108
+	.long	0x1920
+	.long	0x32dc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL113
+	.long	0x1949
+	.byte	0
+	.uleb128 0x4
+	.long	0x56
+	.uleb128 0x16
+	.long	.LASF400
+	.byte	0x91
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB101
+	.quad	.LFE101-.LFB101
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x33da
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0x91
+	.byte	0x20
+	.long	0xc3
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x17
+	.string	"val"
+	.byte	0x91
+	.byte	0x2b
+	.long	0x16ba
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0x91
+	.byte	0x3a
+	.long	0x75e
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0x93
+	.long	0x75e
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI86
+	.byte	.LVU225
+	.long	.LLRL46
+	.byte	0x97
+	.long	0x3394
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x9
+	.quad	.LVL103
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL94
+	.long	0x1904
+	.long	0x33b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL95
+	.long	0x1920
+	.long	0x33cc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL100
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF401
+	.byte	0x81
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB100
+	.quad	.LFE100-.LFB100
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x34c5
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0x81
+	.byte	0x1f
+	.long	0xc3
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x17
+	.string	"val"
+	.byte	0x81
+	.byte	0x2d
+	.long	0x2d51
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0x81
+	.byte	0x3c
+	.long	0x75e
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0x83
+	.long	0x75e
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI82
+	.byte	.LVU195
+	.long	.LLRL40
+	.byte	0x87
+	.long	0x347f
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x9
+	.quad	.LVL90
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL81
+	.long	0x1904
+	.long	0x349f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL82
+	.long	0x1951
+	.long	0x34b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL87
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF402
+	.byte	0x71
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB99
+	.quad	.LFE99-.LFB99
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x35b0
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0x71
+	.byte	0x1e
+	.long	0xc3
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x17
+	.string	"val"
+	.byte	0x71
+	.byte	0x2b
+	.long	0x35b0
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0x71
+	.byte	0x3a
+	.long	0x75e
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0x73
+	.long	0x75e
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI78
+	.byte	.LVU165
+	.long	.LLRL34
+	.byte	0x77
+	.long	0x356a
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x9
+	.quad	.LVL77
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL68
+	.long	0x1904
+	.long	0x358a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL69
+	.long	0x1951
+	.long	0x35a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL74
+	.long	0x1949
+	.byte	0
+	.uleb128 0x4
+	.long	0x35
+	.uleb128 0x16
+	.long	.LASF403
+	.byte	0x60
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB98
+	.quad	.LFE98-.LFB98
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x36a0
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0x60
+	.byte	0x29
+	.long	0xc3
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x17
+	.string	"val"
+	.byte	0x60
+	.byte	0x3e
+	.long	0xf77
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0x60
+	.byte	0x4d
+	.long	0x75e
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0x62
+	.long	0x75e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI74
+	.byte	.LVU135
+	.long	.LLRL28
+	.byte	0x66
+	.long	0x365a
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x9
+	.quad	.LVL64
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL55
+	.long	0x1967
+	.long	0x367a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL56
+	.long	0x1920
+	.long	0x3692
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL61
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF404
+	.byte	0x50
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB97
+	.quad	.LFE97-.LFB97
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x378b
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0x50
+	.byte	0x21
+	.long	0xc3
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x17
+	.string	"val"
+	.byte	0x50
+	.byte	0x2d
+	.long	0x32ea
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0x50
+	.byte	0x3c
+	.long	0x75e
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0x52
+	.long	0x75e
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI70
+	.byte	.LVU105
+	.long	.LLRL22
+	.byte	0x56
+	.long	0x3745
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x9
+	.quad	.LVL51
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL42
+	.long	0x1967
+	.long	0x3765
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL43
+	.long	0x1920
+	.long	0x377d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL48
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF405
+	.byte	0x40
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB96
+	.quad	.LFE96-.LFB96
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3876
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0x40
+	.byte	0x24
+	.long	0xc3
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x17
+	.string	"val"
+	.byte	0x40
+	.byte	0x2f
+	.long	0x16ba
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0x40
+	.byte	0x3e
+	.long	0x75e
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0x42
+	.long	0x75e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI66
+	.byte	.LVU75
+	.long	.LLRL16
+	.byte	0x46
+	.long	0x3830
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x9
+	.quad	.LVL38
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL29
+	.long	0x1967
+	.long	0x3850
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL30
+	.long	0x1920
+	.long	0x3868
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL35
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF406
+	.byte	0x30
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB95
+	.quad	.LFE95-.LFB95
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3961
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0x30
+	.byte	0x23
+	.long	0xc3
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x17
+	.string	"val"
+	.byte	0x30
+	.byte	0x31
+	.long	0x2d51
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0x30
+	.byte	0x40
+	.long	0x75e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0x32
+	.long	0x75e
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI62
+	.byte	.LVU45
+	.long	.LLRL10
+	.byte	0x36
+	.long	0x391b
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x9
+	.quad	.LVL25
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL16
+	.long	0x1967
+	.long	0x393b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL17
+	.long	0x1951
+	.long	0x3953
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL22
+	.long	0x1949
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF407
+	.byte	0x20
+	.byte	0x5
+	.long	0x4f
+	.quad	.LFB94
+	.quad	.LFE94-.LFB94
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3a4c
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0x20
+	.byte	0x22
+	.long	0xc3
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x17
+	.string	"val"
+	.byte	0x20
+	.byte	0x2f
+	.long	0x35b0
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xe
+	.long	.LASF390
+	.byte	0x20
+	.byte	0x3e
+	.long	0x75e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x18
+	.string	"pyo"
+	.byte	0x22
+	.long	0x75e
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x19
+	.long	0x3a4c
+	.quad	.LBI58
+	.byte	.LVU15
+	.long	.LLRL4
+	.byte	0x26
+	.long	0x3a06
+	.uleb128 0xd
+	.long	0x3a56
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x9
+	.quad	.LVL12
+	.long	0x1936
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL3
+	.long	0x1967
+	.long	0x3a26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL4
+	.long	0x1951
+	.long	0x3a3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL9
+	.long	0x1949
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF413
+	.byte	0x2
+	.value	0x215
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0x42
+	.string	"op"
+	.byte	0x2
+	.value	0x215
+	.byte	0x28
+	.long	0x75e
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS188:
+	.uleb128 0
+	.uleb128 .LVU935
+	.uleb128 .LVU935
+	.uleb128 .LVU953
+	.uleb128 .LVU953
+	.uleb128 0
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 .LFE125-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS189:
+	.uleb128 0
+	.uleb128 .LVU937
+	.uleb128 .LVU937
+	.uleb128 .LVU954
+	.uleb128 .LVU954
+	.uleb128 .LVU955
+	.uleb128 .LVU955
+	.uleb128 0
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LVL426-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL426-1-.Ltext0
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LFE125-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS190:
+	.uleb128 0
+	.uleb128 .LVU937
+	.uleb128 .LVU937
+	.uleb128 0
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LVL426-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL426-1-.Ltext0
+	.uleb128 .LFE125-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU950
+	.uleb128 .LVU952
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU937
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU950
+	.uleb128 .LVU955
+	.uleb128 .LVU956
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 .LVL428-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL433-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS184:
+	.uleb128 0
+	.uleb128 .LVU911
+	.uleb128 .LVU911
+	.uleb128 .LVU927
+	.uleb128 .LVU927
+	.uleb128 .LVU928
+	.uleb128 .LVU928
+	.uleb128 0
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LFE124-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS185:
+	.uleb128 0
+	.uleb128 .LVU913
+	.uleb128 .LVU913
+	.uleb128 0
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 .LVL417-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL417-1-.Ltext0
+	.uleb128 .LFE124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU924
+	.uleb128 .LVU926
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL419-.Ltext0
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU913
+	.uleb128 .LVU917
+	.uleb128 .LVU917
+	.uleb128 .LVU924
+	.uleb128 .LVU928
+	.uleb128 .LVU929
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 .LVL419-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS183:
+	.uleb128 0
+	.uleb128 .LVU846
+	.uleb128 .LVU846
+	.uleb128 .LVU898
+	.uleb128 .LVU898
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU903
+	.uleb128 .LVU903
+	.uleb128 .LVU904
+	.uleb128 .LVU904
+	.uleb128 0
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL397-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL397-1-.Ltext0
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 .LFE123-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS182:
+	.uleb128 0
+	.uleb128 .LVU806
+	.uleb128 .LVU806
+	.uleb128 .LVU807
+	.uleb128 .LVU807
+	.uleb128 .LVU809
+	.uleb128 .LVU809
+	.uleb128 .LVU811
+	.uleb128 .LVU811
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 .LVU814
+	.uleb128 .LVU814
+	.uleb128 .LVU815
+	.uleb128 .LVU815
+	.uleb128 .LVU817
+	.uleb128 .LVU817
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU821
+	.uleb128 .LVU821
+	.uleb128 .LVU823
+	.uleb128 .LVU823
+	.uleb128 .LVU824
+	.uleb128 .LVU824
+	.uleb128 .LVU826
+	.uleb128 .LVU826
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU829
+	.uleb128 .LVU829
+	.uleb128 .LVU830
+	.uleb128 .LVU830
+	.uleb128 .LVU832
+	.uleb128 .LVU832
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 .LVU835
+	.uleb128 .LVU835
+	.uleb128 .LVU836
+	.uleb128 .LVU836
+	.uleb128 .LVU838
+	.uleb128 .LVU838
+	.uleb128 0
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LVL374-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL374-1-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LFE122-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS174:
+	.uleb128 0
+	.uleb128 .LVU765
+	.uleb128 .LVU765
+	.uleb128 .LVU786
+	.uleb128 .LVU786
+	.uleb128 .LVU788
+	.uleb128 .LVU788
+	.uleb128 .LVU794
+	.uleb128 .LVU794
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 0
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL370-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL370-1-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LFE121-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS175:
+	.uleb128 0
+	.uleb128 .LVU767
+	.uleb128 .LVU767
+	.uleb128 .LVU787
+	.uleb128 .LVU787
+	.uleb128 .LVU788
+	.uleb128 .LVU788
+	.uleb128 .LVU795
+	.uleb128 .LVU795
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 0
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL354-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL354-1-.Ltext0
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LVL370-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL370-1-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LFE121-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS176:
+	.uleb128 0
+	.uleb128 .LVU767
+	.uleb128 .LVU767
+	.uleb128 .LVU778
+	.uleb128 .LVU778
+	.uleb128 .LVU788
+	.uleb128 .LVU788
+	.uleb128 .LVU793
+	.uleb128 .LVU793
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 0
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL354-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL354-1-.Ltext0
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL370-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL370-1-.Ltext0
+	.uleb128 .LFE121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS177:
+	.uleb128 0
+	.uleb128 .LVU767
+	.uleb128 .LVU767
+	.uleb128 .LVU771
+	.uleb128 .LVU771
+	.uleb128 .LVU788
+	.uleb128 .LVU788
+	.uleb128 .LVU792
+	.uleb128 .LVU792
+	.uleb128 0
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL354-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL354-1-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 .LFE121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU761
+	.uleb128 .LVU778
+	.uleb128 .LVU778
+	.uleb128 .LVU782
+	.uleb128 .LVU782
+	.uleb128 .LVU784
+	.uleb128 .LVU788
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 .LVU797
+	.uleb128 .LVU797
+	.uleb128 0
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL371-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL371-1-.Ltext0
+	.uleb128 .LFE121-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU762
+	.uleb128 .LVU771
+	.uleb128 .LVU771
+	.uleb128 .LVU773
+	.uleb128 .LVU773
+	.uleb128 .LVU785
+	.uleb128 .LVU788
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 0
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LFE121-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU779
+	.uleb128 .LVU784
+	.uleb128 .LVU796
+	.uleb128 0
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LFE121-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS167:
+	.uleb128 0
+	.uleb128 .LVU738
+	.uleb128 .LVU738
+	.uleb128 .LVU747
+	.uleb128 .LVU747
+	.uleb128 0
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LFE120-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS168:
+	.uleb128 0
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 .LVU755
+	.uleb128 .LVU755
+	.uleb128 .LVU756
+	.uleb128 .LVU756
+	.uleb128 0
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL341-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL341-1-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LFE120-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS169:
+	.uleb128 0
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 0
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL341-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL341-1-.Ltext0
+	.uleb128 .LFE120-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU736
+	.uleb128 .LVU747
+	.uleb128 .LVU747
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 .LVU753
+	.uleb128 .LVU756
+	.uleb128 .LVU757
+	.uleb128 .LVU757
+	.uleb128 0
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL351-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL351-1-.Ltext0
+	.uleb128 .LFE120-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU741
+	.uleb128 .LVU742
+	.uleb128 .LVU742
+	.uleb128 .LVU754
+	.uleb128 .LVU756
+	.uleb128 0
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LFE120-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU748
+	.uleb128 .LVU753
+	.uleb128 .LVU756
+	.uleb128 0
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LFE120-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS160:
+	.uleb128 0
+	.uleb128 .LVU715
+	.uleb128 .LVU715
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 0
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL328-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL328-1-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LFE119-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 0
+	.uleb128 .LVU715
+	.uleb128 .LVU715
+	.uleb128 .LVU730
+	.uleb128 .LVU730
+	.uleb128 .LVU731
+	.uleb128 .LVU731
+	.uleb128 0
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL328-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL328-1-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LFE119-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS162:
+	.uleb128 0
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 0
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LFE119-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU710
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU727
+	.uleb128 .LVU727
+	.uleb128 .LVU728
+	.uleb128 .LVU731
+	.uleb128 .LVU732
+	.uleb128 .LVU732
+	.uleb128 0
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL338-1-.Ltext0
+	.uleb128 .LFE119-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU716
+	.uleb128 .LVU717
+	.uleb128 .LVU717
+	.uleb128 .LVU729
+	.uleb128 .LVU731
+	.uleb128 0
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LFE119-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU723
+	.uleb128 .LVU728
+	.uleb128 .LVU731
+	.uleb128 0
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LFE119-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS153:
+	.uleb128 0
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 .LVU696
+	.uleb128 .LVU696
+	.uleb128 0
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL315-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL315-1-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LFE118-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 0
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 .LVU704
+	.uleb128 .LVU704
+	.uleb128 .LVU705
+	.uleb128 .LVU705
+	.uleb128 0
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL315-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL315-1-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LFE118-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS155:
+	.uleb128 0
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 0
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL315-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL315-1-.Ltext0
+	.uleb128 .LFE118-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU686
+	.uleb128 .LVU696
+	.uleb128 .LVU696
+	.uleb128 .LVU701
+	.uleb128 .LVU701
+	.uleb128 .LVU702
+	.uleb128 .LVU705
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 0
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL325-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL325-1-.Ltext0
+	.uleb128 .LFE118-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU690
+	.uleb128 .LVU691
+	.uleb128 .LVU691
+	.uleb128 .LVU703
+	.uleb128 .LVU705
+	.uleb128 0
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LFE118-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU697
+	.uleb128 .LVU702
+	.uleb128 .LVU705
+	.uleb128 0
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LFE118-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS146:
+	.uleb128 0
+	.uleb128 .LVU663
+	.uleb128 .LVU663
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 0
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LFE117-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS147:
+	.uleb128 0
+	.uleb128 .LVU665
+	.uleb128 .LVU665
+	.uleb128 .LVU680
+	.uleb128 .LVU680
+	.uleb128 .LVU681
+	.uleb128 .LVU681
+	.uleb128 0
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL303-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL303-1-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LFE117-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS148:
+	.uleb128 0
+	.uleb128 .LVU665
+	.uleb128 .LVU665
+	.uleb128 0
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL303-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL303-1-.Ltext0
+	.uleb128 .LFE117-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU661
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 .LVU677
+	.uleb128 .LVU677
+	.uleb128 .LVU678
+	.uleb128 .LVU681
+	.uleb128 .LVU682
+	.uleb128 .LVU682
+	.uleb128 0
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL313-1-.Ltext0
+	.uleb128 .LFE117-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU666
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU679
+	.uleb128 .LVU681
+	.uleb128 0
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LFE117-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU673
+	.uleb128 .LVU678
+	.uleb128 .LVU681
+	.uleb128 0
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LFE117-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS139:
+	.uleb128 0
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 0
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LFE116-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 0
+	.uleb128 .LVU640
+	.uleb128 .LVU640
+	.uleb128 .LVU655
+	.uleb128 .LVU655
+	.uleb128 .LVU656
+	.uleb128 .LVU656
+	.uleb128 0
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL290-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL290-1-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LFE116-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS141:
+	.uleb128 0
+	.uleb128 .LVU640
+	.uleb128 .LVU640
+	.uleb128 0
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL290-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL290-1-.Ltext0
+	.uleb128 .LFE116-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU636
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 .LVU653
+	.uleb128 .LVU656
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 0
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL300-1-.Ltext0
+	.uleb128 .LFE116-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU641
+	.uleb128 .LVU642
+	.uleb128 .LVU642
+	.uleb128 .LVU654
+	.uleb128 .LVU656
+	.uleb128 0
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LFE116-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 .LVU656
+	.uleb128 0
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LFE116-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS132:
+	.uleb128 0
+	.uleb128 .LVU613
+	.uleb128 .LVU613
+	.uleb128 .LVU622
+	.uleb128 .LVU622
+	.uleb128 0
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LFE115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS133:
+	.uleb128 0
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 .LVU631
+	.uleb128 .LVU631
+	.uleb128 0
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL277-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL277-1-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LFE115-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS134:
+	.uleb128 0
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 0
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL277-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL277-1-.Ltext0
+	.uleb128 .LFE115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU610
+	.uleb128 .LVU622
+	.uleb128 .LVU622
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU628
+	.uleb128 .LVU631
+	.uleb128 .LVU632
+	.uleb128 .LVU632
+	.uleb128 0
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL287-1-.Ltext0
+	.uleb128 .LFE115-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU616
+	.uleb128 .LVU617
+	.uleb128 .LVU617
+	.uleb128 .LVU629
+	.uleb128 .LVU631
+	.uleb128 0
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LFE115-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU623
+	.uleb128 .LVU628
+	.uleb128 .LVU631
+	.uleb128 0
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LFE115-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS124:
+	.uleb128 0
+	.uleb128 .LVU587
+	.uleb128 .LVU587
+	.uleb128 .LVU596
+	.uleb128 .LVU596
+	.uleb128 0
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LFE114-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS125:
+	.uleb128 0
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 0
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LFE114-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS126:
+	.uleb128 0
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 0
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL264-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL264-1-.Ltext0
+	.uleb128 .LFE114-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 0
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL264-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL264-1-.Ltext0
+	.uleb128 .LFE114-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU583
+	.uleb128 .LVU596
+	.uleb128 .LVU596
+	.uleb128 .LVU601
+	.uleb128 .LVU601
+	.uleb128 .LVU602
+	.uleb128 .LVU605
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL274-1-.Ltext0
+	.uleb128 .LFE114-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU590
+	.uleb128 .LVU591
+	.uleb128 .LVU591
+	.uleb128 .LVU603
+	.uleb128 .LVU605
+	.uleb128 0
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LFE114-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU597
+	.uleb128 .LVU602
+	.uleb128 .LVU605
+	.uleb128 0
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LFE114-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS117:
+	.uleb128 0
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 0
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LFE113-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 0
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU578
+	.uleb128 .LVU578
+	.uleb128 0
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL250-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL250-1-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LFE113-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS119:
+	.uleb128 0
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 0
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL250-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL250-1-.Ltext0
+	.uleb128 .LFE113-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU558
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU574
+	.uleb128 .LVU574
+	.uleb128 .LVU575
+	.uleb128 .LVU578
+	.uleb128 .LVU579
+	.uleb128 .LVU579
+	.uleb128 0
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL260-1-.Ltext0
+	.uleb128 .LFE113-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU563
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU576
+	.uleb128 .LVU578
+	.uleb128 0
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LFE113-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU570
+	.uleb128 .LVU575
+	.uleb128 .LVU578
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LFE113-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS110:
+	.uleb128 0
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 0
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL237-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL237-1-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LFE112-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 0
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU552
+	.uleb128 .LVU552
+	.uleb128 .LVU553
+	.uleb128 .LVU553
+	.uleb128 0
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL237-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL237-1-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LFE112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU535
+	.uleb128 .LVU535
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LFE112-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU532
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 .LVU550
+	.uleb128 .LVU553
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 .LFE112-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU538
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 .LVU551
+	.uleb128 .LVU553
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LFE112-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU545
+	.uleb128 .LVU550
+	.uleb128 .LVU553
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LFE112-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS103:
+	.uleb128 0
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 .LVU518
+	.uleb128 .LVU518
+	.uleb128 0
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL224-1-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LFE111-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 0
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 .LVU526
+	.uleb128 .LVU526
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 0
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL224-1-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LFE111-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS105:
+	.uleb128 0
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL224-1-.Ltext0
+	.uleb128 .LFE111-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU508
+	.uleb128 .LVU518
+	.uleb128 .LVU518
+	.uleb128 .LVU523
+	.uleb128 .LVU523
+	.uleb128 .LVU524
+	.uleb128 .LVU527
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 0
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL234-1-.Ltext0
+	.uleb128 .LFE111-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU512
+	.uleb128 .LVU513
+	.uleb128 .LVU513
+	.uleb128 .LVU525
+	.uleb128 .LVU527
+	.uleb128 0
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LFE111-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU519
+	.uleb128 .LVU524
+	.uleb128 .LVU527
+	.uleb128 0
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LFE111-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS96:
+	.uleb128 0
+	.uleb128 .LVU485
+	.uleb128 .LVU485
+	.uleb128 .LVU494
+	.uleb128 .LVU494
+	.uleb128 0
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LFE110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 0
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 0
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL212-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL212-1-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LFE110-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS98:
+	.uleb128 0
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 0
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL212-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL212-1-.Ltext0
+	.uleb128 .LFE110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU482
+	.uleb128 .LVU494
+	.uleb128 .LVU494
+	.uleb128 .LVU499
+	.uleb128 .LVU499
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 0
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL222-1-.Ltext0
+	.uleb128 .LFE110-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU488
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 .LVU501
+	.uleb128 .LVU503
+	.uleb128 0
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LFE110-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU495
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 0
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LFE110-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS90:
+	.uleb128 0
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 0
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL199-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL199-1-.Ltext0
+	.uleb128 .LFE109-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 0
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 0
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL199-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL199-1-.Ltext0
+	.uleb128 .LFE109-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU460
+	.uleb128 .LVU464
+	.uleb128 .LVU464
+	.uleb128 .LVU472
+	.uleb128 .LVU476
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU479
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL201-1-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU453
+	.uleb128 .LVU467
+	.uleb128 .LVU467
+	.uleb128 .LVU472
+	.uleb128 .LVU472
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 0
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL209-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL209-1-.Ltext0
+	.uleb128 .LFE109-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU468
+	.uleb128 .LVU472
+	.uleb128 .LVU476
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU479
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS84:
+	.uleb128 0
+	.uleb128 .LVU424
+	.uleb128 .LVU424
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 0
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL186-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL186-1-.Ltext0
+	.uleb128 .LFE108-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 0
+	.uleb128 .LVU426
+	.uleb128 .LVU426
+	.uleb128 .LVU441
+	.uleb128 .LVU441
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 .LVU447
+	.uleb128 .LVU447
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LFE108-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS86:
+	.uleb128 0
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL186-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL186-1-.Ltext0
+	.uleb128 .LFE108-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU428
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 .LVU440
+	.uleb128 .LVU442
+	.uleb128 .LVU443
+	.uleb128 .LVU448
+	.uleb128 0
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LFE108-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU435
+	.uleb128 .LVU440
+	.uleb128 .LVU448
+	.uleb128 0
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LFE108-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 .LFE107-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 0
+	.uleb128 .LVU396
+	.uleb128 .LVU396
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU412
+	.uleb128 .LVU412
+	.uleb128 .LVU417
+	.uleb128 .LVU417
+	.uleb128 .LVU418
+	.uleb128 .LVU418
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LFE107-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS80:
+	.uleb128 0
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 0
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 .LFE107-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU398
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 .LVU410
+	.uleb128 .LVU412
+	.uleb128 .LVU413
+	.uleb128 .LVU418
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LFE107-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU405
+	.uleb128 .LVU410
+	.uleb128 .LVU418
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LFE107-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS72:
+	.uleb128 0
+	.uleb128 .LVU365
+	.uleb128 .LVU365
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 .LFE106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 0
+	.uleb128 .LVU367
+	.uleb128 .LVU367
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 .LFE106-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU370
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU382
+	.uleb128 .LVU386
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU389
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU363
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 .LFE106-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU378
+	.uleb128 .LVU382
+	.uleb128 .LVU386
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU389
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 .LFE105-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 .LVU357
+	.uleb128 .LVU357
+	.uleb128 .LVU358
+	.uleb128 .LVU358
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LFE105-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 .LFE105-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU338
+	.uleb128 .LVU343
+	.uleb128 .LVU343
+	.uleb128 .LVU350
+	.uleb128 .LVU352
+	.uleb128 .LVU353
+	.uleb128 .LVU358
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL147-1-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LFE105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU345
+	.uleb128 .LVU350
+	.uleb128 .LVU358
+	.uleb128 0
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LFE105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL133-1-.Ltext0
+	.uleb128 .LFE104-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU328
+	.uleb128 .LVU328
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LFE104-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL133-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL133-1-.Ltext0
+	.uleb128 .LFE104-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU308
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU320
+	.uleb128 .LVU322
+	.uleb128 .LVU323
+	.uleb128 .LVU328
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL134-1-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LFE104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU315
+	.uleb128 .LVU320
+	.uleb128 .LVU328
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LFE104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL120-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL120-1-.Ltext0
+	.uleb128 .LFE103-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU291
+	.uleb128 .LVU291
+	.uleb128 .LVU292
+	.uleb128 .LVU292
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU298
+	.uleb128 .LVU298
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LFE103-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS56:
+	.uleb128 0
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL120-1-.Ltext0
+	.uleb128 .LFE103-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU278
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU290
+	.uleb128 .LVU292
+	.uleb128 .LVU293
+	.uleb128 .LVU298
+	.uleb128 0
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL121-1-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LFE103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU285
+	.uleb128 .LVU290
+	.uleb128 .LVU298
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LFE103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 .LFE102-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 0
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LFE102-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS50:
+	.uleb128 0
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 .LFE102-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU248
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU260
+	.uleb128 .LVU262
+	.uleb128 .LVU263
+	.uleb128 .LVU268
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LFE102-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU255
+	.uleb128 .LVU260
+	.uleb128 .LVU268
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LFE102-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL94-1-.Ltext0
+	.uleb128 .LFE101-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LFE101-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL94-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL94-1-.Ltext0
+	.uleb128 .LFE101-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU218
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU230
+	.uleb128 .LVU232
+	.uleb128 .LVU233
+	.uleb128 .LVU238
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LFE101-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU225
+	.uleb128 .LVU230
+	.uleb128 .LVU238
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LFE101-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 .LFE100-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 0
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE100-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL81-1-.Ltext0
+	.uleb128 .LFE100-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU188
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU200
+	.uleb128 .LVU202
+	.uleb128 .LVU203
+	.uleb128 .LVU208
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE100-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU195
+	.uleb128 .LVU200
+	.uleb128 .LVU208
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE100-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LFE99-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE99-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LFE99-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU158
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+	.uleb128 .LVU173
+	.uleb128 .LVU178
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL69-1-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE99-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU165
+	.uleb128 .LVU170
+	.uleb128 .LVU178
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE99-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LFE98-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE98-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LFE98-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU128
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU140
+	.uleb128 .LVU142
+	.uleb128 .LVU143
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE98-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU135
+	.uleb128 .LVU140
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE98-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LFE97-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE97-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LFE97-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU98
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU110
+	.uleb128 .LVU112
+	.uleb128 .LVU113
+	.uleb128 .LVU118
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE97-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU105
+	.uleb128 .LVU110
+	.uleb128 .LVU118
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE97-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 .LFE96-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE96-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 .LFE96-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU68
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU80
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+	.uleb128 .LVU88
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE96-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU75
+	.uleb128 .LVU80
+	.uleb128 .LVU88
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE96-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LFE95-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE95-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LFE95-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU38
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU50
+	.uleb128 .LVU52
+	.uleb128 .LVU53
+	.uleb128 .LVU58
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE95-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU45
+	.uleb128 .LVU50
+	.uleb128 .LVU58
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE95-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LFE94-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE94-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LFE94-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU8
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU20
+	.uleb128 .LVU22
+	.uleb128 .LVU23
+	.uleb128 .LVU28
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE94-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU15
+	.uleb128 .LVU20
+	.uleb128 .LVU28
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE94-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0
+.LLRL76:
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0
+.LLRL82:
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0
+.LLRL88:
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB129-.Ltext0
+	.uleb128 .LBE129-.Ltext0
+	.byte	0
+.LLRL101:
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB134-.Ltext0
+	.uleb128 .LBE134-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0
+.LLRL108:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0
+.LLRL115:
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB146-.Ltext0
+	.uleb128 .LBE146-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB147-.Ltext0
+	.uleb128 .LBE147-.Ltext0
+	.byte	0
+.LLRL122:
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0
+.LLRL130:
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0
+.LLRL137:
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB164-.Ltext0
+	.uleb128 .LBE164-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB165-.Ltext0
+	.uleb128 .LBE165-.Ltext0
+	.byte	0
+.LLRL144:
+	.byte	0x4
+	.uleb128 .LBB166-.Ltext0
+	.uleb128 .LBE166-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0
+.LLRL151:
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB176-.Ltext0
+	.uleb128 .LBE176-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB177-.Ltext0
+	.uleb128 .LBE177-.Ltext0
+	.byte	0
+.LLRL158:
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0
+.LLRL165:
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB189-.Ltext0
+	.uleb128 .LBE189-.Ltext0
+	.byte	0
+.LLRL172:
+	.byte	0x4
+	.uleb128 .LBB190-.Ltext0
+	.uleb128 .LBE190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB194-.Ltext0
+	.uleb128 .LBE194-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB195-.Ltext0
+	.uleb128 .LBE195-.Ltext0
+	.byte	0
+.LLRL180:
+	.byte	0x4
+	.uleb128 .LBB196-.Ltext0
+	.uleb128 .LBE196-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB200-.Ltext0
+	.uleb128 .LBE200-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB201-.Ltext0
+	.uleb128 .LBE201-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF384:
+	.string	"setMappingString_Length"
+.LASF345:
+	.string	"PyArrayAPIXXX"
+.LASF337:
+	.string	"tagPyArrayObject_fields"
+.LASF68:
+	.string	"_object"
+.LASF279:
+	.string	"PyArray_CopySwapFunc"
+.LASF243:
+	.string	"NPY_LONG"
+.LASF369:
+	.string	"translatePyFormatToHlHdf"
+.LASF351:
+	.string	"PyUnicode_FromString"
+.LASF370:
+	.string	"retv"
+.LASF86:
+	.string	"tp_hash"
+.LASF39:
+	.string	"_shortbuf"
+.LASF150:
+	.string	"reprfunc"
+.LASF409:
+	.string	"_IO_lock_t"
+.LASF395:
+	.string	"getStringFromObject"
+.LASF275:
+	.string	"NpyAuxData_CloneFunc"
+.LASF127:
+	.string	"strides"
+.LASF190:
+	.string	"nb_inplace_power"
+.LASF56:
+	.string	"Py_hash_t"
+.LASF344:
+	.string	"stderr"
+.LASF125:
+	.string	"format"
+.LASF28:
+	.string	"_IO_buf_end"
+.LASF14:
+	.string	"__off_t"
+.LASF149:
+	.string	"setattrofunc"
+.LASF285:
+	.string	"PyArray_ScanFunc"
+.LASF326:
+	.string	"scalarkind"
+.LASF267:
+	.string	"NPY_RAISE"
+.LASF291:
+	.string	"flags"
+.LASF77:
+	.string	"tp_dealloc"
+.LASF194:
+	.string	"nb_inplace_xor"
+.LASF293:
+	.string	"elsize"
+.LASF405:
+	.string	"getIntegerFromDictionary"
+.LASF85:
+	.string	"tp_as_mapping"
+.LASF239:
+	.string	"NPY_SHORT"
+.LASF410:
+	.string	"NPY_TYPES"
+.LASF304:
+	.string	"PyArray_ArgSortFunc"
+.LASF26:
+	.string	"_IO_write_end"
+.LASF224:
+	.string	"PyAsyncMethods"
+.LASF327:
+	.string	"cancastscalarkindto"
+.LASF343:
+	.string	"PyArrayObject"
+.LASF74:
+	.string	"tp_name"
+.LASF160:
+	.string	"PYGEN_RETURN"
+.LASF236:
+	.string	"NPY_BOOL"
+.LASF394:
+	.string	"getIdxIntegerFromTuple"
+.LASF20:
+	.string	"_flags"
+.LASF246:
+	.string	"NPY_ULONGLONG"
+.LASF375:
+	.string	"out_string"
+.LASF54:
+	.string	"Py_intptr_t"
+.LASF49:
+	.string	"FILE"
+.LASF272:
+	.string	"clone"
+.LASF91:
+	.string	"tp_as_buffer"
+.LASF237:
+	.string	"NPY_BYTE"
+.LASF108:
+	.string	"tp_init"
+.LASF255:
+	.string	"NPY_UNICODE"
+.LASF362:
+	.string	"xsize"
+.LASF270:
+	.string	"NpyAuxData_tag"
+.LASF209:
+	.string	"sq_ass_item"
+.LASF177:
+	.string	"nb_invert"
+.LASF306:
+	.string	"PyArray_ScalarKindFunc"
+.LASF296:
+	.string	"fields"
+.LASF396:
+	.string	"getByteFromObject"
+.LASF148:
+	.string	"setattrfunc"
+.LASF252:
+	.string	"NPY_CLONGDOUBLE"
+.LASF117:
+	.string	"tp_weaklist"
+.LASF286:
+	.string	"_PyArray_Descr"
+.LASF355:
+	.string	"PySequence_GetItem"
+.LASF146:
+	.string	"getattrfunc"
+.LASF18:
+	.string	"ssize_t"
+.LASF60:
+	.string	"ml_meth"
+.LASF145:
+	.string	"destructor"
+.LASF139:
+	.string	"ssizeobjargproc"
+.LASF402:
+	.string	"getFloatFromObject"
+.LASF257:
+	.string	"NPY_DATETIME"
+.LASF367:
+	.string	"dims"
+.LASF97:
+	.string	"tp_weaklistoffset"
+.LASF164:
+	.string	"getbufferproc"
+.LASF332:
+	.string	"argmin"
+.LASF82:
+	.string	"tp_repr"
+.LASF79:
+	.string	"tp_getattr"
+.LASF404:
+	.string	"getLongFromDictionary"
+.LASF166:
+	.string	"vectorcallfunc"
+.LASF223:
+	.string	"am_send"
+.LASF186:
+	.string	"nb_inplace_add"
+.LASF156:
+	.string	"descrsetfunc"
+.LASF328:
+	.string	"cancastto"
+.LASF266:
+	.string	"NPY_WRAP"
+.LASF282:
+	.string	"PyArray_ArgFunc"
+.LASF299:
+	.string	"c_metadata"
+.LASF3:
+	.string	"float"
+.LASF73:
+	.string	"ob_base"
+.LASF204:
+	.string	"sq_length"
+.LASF51:
+	.string	"_IO_codecvt"
+.LASF98:
+	.string	"tp_iter"
+.LASF335:
+	.string	"base"
+.LASF182:
+	.string	"nb_or"
+.LASF287:
+	.string	"typeobj"
+.LASF189:
+	.string	"nb_inplace_remainder"
+.LASF195:
+	.string	"nb_inplace_or"
+.LASF242:
+	.string	"NPY_UINT"
+.LASF19:
+	.string	"long long unsigned int"
+.LASF115:
+	.string	"tp_cache"
+.LASF169:
+	.string	"nb_multiply"
+.LASF89:
+	.string	"tp_getattro"
+.LASF157:
+	.string	"initproc"
+.LASF81:
+	.string	"tp_as_async"
+.LASF321:
+	.string	"fill"
+.LASF151:
+	.string	"hashfunc"
+.LASF99:
+	.string	"tp_iternext"
+.LASF288:
+	.string	"kind"
+.LASF220:
+	.string	"am_await"
+.LASF109:
+	.string	"tp_alloc"
+.LASF331:
+	.string	"fasttake"
+.LASF30:
+	.string	"_IO_backup_base"
+.LASF380:
+	.string	"setObjectDouble"
+.LASF301:
+	.string	"PyArray_FromStrFunc"
+.LASF41:
+	.string	"_offset"
+.LASF387:
+	.string	"setMappingDouble"
+.LASF174:
+	.string	"nb_positive"
+.LASF165:
+	.string	"releasebufferproc"
+.LASF121:
+	.string	"tp_vectorcall"
+.LASF347:
+	.string	"fprintf"
+.LASF34:
+	.string	"_fileno"
+.LASF94:
+	.string	"tp_traverse"
+.LASF308:
+	.string	"PyArray_FastPutmaskFunc"
+.LASF13:
+	.string	"size_t"
+.LASF32:
+	.string	"_markers"
+.LASF96:
+	.string	"tp_richcompare"
+.LASF357:
+	.string	"PyUnicode_AsUTF8"
+.LASF284:
+	.string	"PyArray_VectorUnaryFunc"
+.LASF408:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g -O3 -fwrapv -fPIC -fasynchronous-unwind-tables"
+.LASF198:
+	.string	"nb_inplace_floor_divide"
+.LASF23:
+	.string	"_IO_read_base"
+.LASF232:
+	.string	"_Bool"
+.LASF373:
+	.string	"keyname"
+.LASF162:
+	.string	"PYGEN_NEXT"
+.LASF318:
+	.string	"scanfunc"
+.LASF202:
+	.string	"nb_inplace_matrix_multiply"
+.LASF31:
+	.string	"_IO_save_end"
+.LASF63:
+	.string	"PyGetSetDef"
+.LASF25:
+	.string	"_IO_write_ptr"
+.LASF229:
+	.string	"getter"
+.LASF271:
+	.string	"free"
+.LASF152:
+	.string	"richcmpfunc"
+.LASF208:
+	.string	"was_sq_slice"
+.LASF140:
+	.string	"objobjargproc"
+.LASF253:
+	.string	"NPY_OBJECT"
+.LASF411:
+	.string	"_Py_Dealloc"
+.LASF290:
+	.string	"byteorder"
+.LASF116:
+	.string	"tp_subclasses"
+.LASF71:
+	.string	"PyTypeObject"
+.LASF24:
+	.string	"_IO_write_base"
+.LASF352:
+	.string	"PyFloat_FromDouble"
+.LASF368:
+	.string	"pyarraytypeFromHdfType"
+.LASF55:
+	.string	"Py_ssize_t"
+.LASF102:
+	.string	"tp_getset"
+.LASF281:
+	.string	"PyArray_CompareFunc"
+.LASF302:
+	.string	"PyArray_FillFunc"
+.LASF406:
+	.string	"getDoubleFromDictionary"
+.LASF244:
+	.string	"NPY_ULONG"
+.LASF8:
+	.string	"char"
+.LASF241:
+	.string	"NPY_INT"
+.LASF277:
+	.string	"PyArray_SetItemFunc"
+.LASF47:
+	.string	"_mode"
+.LASF412:
+	.string	"PyErr_Clear"
+.LASF226:
+	.string	"bf_releasebuffer"
+.LASF300:
+	.string	"hash"
+.LASF276:
+	.string	"PyArray_GetItemFunc"
+.LASF268:
+	.string	"NPY_CLIPMODE"
+.LASF50:
+	.string	"_IO_marker"
+.LASF323:
+	.string	"sort"
+.LASF283:
+	.string	"PyArray_DotFunc"
+.LASF235:
+	.string	"npy_hash_t"
+.LASF21:
+	.string	"_IO_read_ptr"
+.LASF305:
+	.string	"PyArray_FillWithScalarFunc"
+.LASF212:
+	.string	"sq_inplace_concat"
+.LASF338:
+	.string	"data"
+.LASF398:
+	.string	"getUnsignedLongFromObject"
+.LASF143:
+	.string	"traverseproc"
+.LASF173:
+	.string	"nb_negative"
+.LASF10:
+	.string	"unsigned int"
+.LASF172:
+	.string	"nb_power"
+.LASF254:
+	.string	"NPY_STRING"
+.LASF280:
+	.string	"PyArray_NonzeroFunc"
+.LASF192:
+	.string	"nb_inplace_rshift"
+.LASF322:
+	.string	"fillwithscalar"
+.LASF289:
+	.string	"type"
+.LASF269:
+	.string	"NpyAuxData"
+.LASF221:
+	.string	"am_aiter"
+.LASF217:
+	.string	"mp_ass_subscript"
+.LASF17:
+	.string	"__intptr_t"
+.LASF295:
+	.string	"subarray"
+.LASF339:
+	.string	"dimensions"
+.LASF329:
+	.string	"fastclip"
+.LASF205:
+	.string	"sq_concat"
+.LASF353:
+	.string	"PyMapping_SetItemString"
+.LASF218:
+	.string	"PyMappingMethods"
+.LASF142:
+	.string	"visitproc"
+.LASF6:
+	.string	"long long int"
+.LASF228:
+	.string	"PyCFunction"
+.LASF53:
+	.string	"intptr_t"
+.LASF29:
+	.string	"_IO_save_base"
+.LASF126:
+	.string	"shape"
+.LASF122:
+	.string	"itemsize"
+.LASF101:
+	.string	"tp_members"
+.LASF389:
+	.string	"getStringFromDictionary"
+.LASF377:
+	.string	"setObjectFloat"
+.LASF390:
+	.string	"dict"
+.LASF259:
+	.string	"NPY_HALF"
+.LASF170:
+	.string	"nb_remainder"
+.LASF67:
+	.string	"PyObject"
+.LASF364:
+	.string	"iformat"
+.LASF134:
+	.string	"binaryfunc"
+.LASF397:
+	.string	"getShortFromObject"
+.LASF90:
+	.string	"tp_setattro"
+.LASF155:
+	.string	"descrgetfunc"
+.LASF391:
+	.string	"retstr"
+.LASF361:
+	.string	"PyMapping_GetItemString"
+.LASF297:
+	.string	"names"
+.LASF103:
+	.string	"tp_base"
+.LASF107:
+	.string	"tp_dictoffset"
+.LASF159:
+	.string	"allocfunc"
+.LASF45:
+	.string	"_freeres_buf"
+.LASF315:
+	.string	"compare"
+.LASF264:
+	.string	"NPY_NTYPES_ABI_COMPATIBLE"
+.LASF393:
+	.string	"tuple"
+.LASF215:
+	.string	"mp_length"
+.LASF83:
+	.string	"tp_as_number"
+.LASF72:
+	.string	"_typeobject"
+.LASF233:
+	.string	"npy_intp"
+.LASF372:
+	.string	"info"
+.LASF379:
+	.string	"out_value"
+.LASF93:
+	.string	"tp_doc"
+.LASF46:
+	.string	"__pad5"
+.LASF317:
+	.string	"dotfunc"
+.LASF180:
+	.string	"nb_and"
+.LASF193:
+	.string	"nb_inplace_and"
+.LASF403:
+	.string	"getUnsignedLongFromDictionary"
+.LASF76:
+	.string	"tp_itemsize"
+.LASF245:
+	.string	"NPY_LONGLONG"
+.LASF340:
+	.string	"descr"
+.LASF230:
+	.string	"setter"
+.LASF210:
+	.string	"was_sq_ass_slice"
+.LASF38:
+	.string	"_vtable_offset"
+.LASF274:
+	.string	"NpyAuxData_FreeFunc"
+.LASF341:
+	.string	"weakreflist"
+.LASF197:
+	.string	"nb_true_divide"
+.LASF348:
+	.string	"strlen"
+.LASF75:
+	.string	"tp_basicsize"
+.LASF119:
+	.string	"tp_version_tag"
+.LASF350:
+	.string	"PyUnicode_FromStringAndSize"
+.LASF196:
+	.string	"nb_floor_divide"
+.LASF144:
+	.string	"freefunc"
+.LASF231:
+	.string	"long double"
+.LASF312:
+	.string	"setitem"
+.LASF132:
+	.string	"PyVarObject"
+.LASF161:
+	.string	"PYGEN_ERROR"
+.LASF105:
+	.string	"tp_descr_get"
+.LASF324:
+	.string	"argsort"
+.LASF216:
+	.string	"mp_subscript"
+.LASF360:
+	.string	"PyFloat_AsDouble"
+.LASF153:
+	.string	"getiterfunc"
+.LASF154:
+	.string	"iternextfunc"
+.LASF222:
+	.string	"am_anext"
+.LASF354:
+	.string	"PyLong_FromLong"
+.LASF258:
+	.string	"NPY_TIMEDELTA"
+.LASF92:
+	.string	"tp_flags"
+.LASF392:
+	.string	"getIdxDoubleFromTuple"
+.LASF131:
+	.string	"ob_size"
+.LASF141:
+	.string	"objobjproc"
+.LASF251:
+	.string	"NPY_CDOUBLE"
+.LASF187:
+	.string	"nb_inplace_subtract"
+.LASF22:
+	.string	"_IO_read_end"
+.LASF298:
+	.string	"metadata"
+.LASF316:
+	.string	"argmax"
+.LASF334:
+	.string	"_arr_descr"
+.LASF12:
+	.string	"short int"
+.LASF184:
+	.string	"nb_reserved"
+.LASF320:
+	.string	"nonzero"
+.LASF87:
+	.string	"tp_call"
+.LASF325:
+	.string	"castdict"
+.LASF5:
+	.string	"long int"
+.LASF59:
+	.string	"ml_name"
+.LASF111:
+	.string	"tp_free"
+.LASF124:
+	.string	"ndim"
+.LASF69:
+	.string	"ob_refcnt"
+.LASF137:
+	.string	"lenfunc"
+.LASF400:
+	.string	"getIntegerFromObject"
+.LASF58:
+	.string	"_IO_FILE"
+.LASF260:
+	.string	"NPY_NTYPES"
+.LASF262:
+	.string	"NPY_CHAR"
+.LASF113:
+	.string	"tp_bases"
+.LASF52:
+	.string	"_IO_wide_data"
+.LASF62:
+	.string	"ml_doc"
+.LASF65:
+	.string	"closure"
+.LASF100:
+	.string	"tp_methods"
+.LASF250:
+	.string	"NPY_CFLOAT"
+.LASF57:
+	.string	"PyMethodDef"
+.LASF167:
+	.string	"nb_add"
+.LASF342:
+	.string	"PyArrayObject_fields"
+.LASF333:
+	.string	"PyArray_ArrFuncs"
+.LASF407:
+	.string	"getFloatFromDictionary"
+.LASF114:
+	.string	"tp_mro"
+.LASF383:
+	.string	"setObjectInteger"
+.LASF381:
+	.string	"setObjectUnsignedLong"
+.LASF16:
+	.string	"__ssize_t"
+.LASF181:
+	.string	"nb_xor"
+.LASF130:
+	.string	"Py_buffer"
+.LASF64:
+	.string	"name"
+.LASF136:
+	.string	"inquiry"
+.LASF376:
+	.string	"setObjectString"
+.LASF40:
+	.string	"_lock"
+.LASF27:
+	.string	"_IO_buf_base"
+.LASF185:
+	.string	"nb_float"
+.LASF363:
+	.string	"ysize"
+.LASF385:
+	.string	"setMappingString"
+.LASF43:
+	.string	"_wide_data"
+.LASF183:
+	.string	"nb_int"
+.LASF388:
+	.string	"setMappingInteger"
+.LASF200:
+	.string	"nb_index"
+.LASF179:
+	.string	"nb_rshift"
+.LASF4:
+	.string	"long unsigned int"
+.LASF42:
+	.string	"_codecvt"
+.LASF36:
+	.string	"_old_offset"
+.LASF214:
+	.string	"PySequenceMethods"
+.LASF247:
+	.string	"NPY_FLOAT"
+.LASF303:
+	.string	"PyArray_SortFunc"
+.LASF401:
+	.string	"getDoubleFromObject"
+.LASF413:
+	.string	"Py_DECREF"
+.LASF265:
+	.string	"NPY_CLIP"
+.LASF261:
+	.string	"NPY_NOTYPE"
+.LASF310:
+	.string	"cast"
+.LASF66:
+	.string	"PyMemberDef"
+.LASF382:
+	.string	"setObjectLong"
+.LASF309:
+	.string	"PyArray_FastTakeFunc"
+.LASF203:
+	.string	"PyNumberMethods"
+.LASF9:
+	.string	"unsigned char"
+.LASF191:
+	.string	"nb_inplace_lshift"
+.LASF201:
+	.string	"nb_matrix_multiply"
+.LASF112:
+	.string	"tp_is_gc"
+.LASF365:
+	.string	"new2d_ArrayObject"
+.LASF219:
+	.string	"sendfunc"
+.LASF84:
+	.string	"tp_as_sequence"
+.LASF399:
+	.string	"getLongFromObject"
+.LASF129:
+	.string	"internal"
+.LASF171:
+	.string	"nb_divmod"
+.LASF378:
+	.string	"in_value"
+.LASF104:
+	.string	"tp_dict"
+.LASF263:
+	.string	"NPY_USERDEF"
+.LASF240:
+	.string	"NPY_USHORT"
+.LASF249:
+	.string	"NPY_LONGDOUBLE"
+.LASF135:
+	.string	"ternaryfunc"
+.LASF44:
+	.string	"_freeres_list"
+.LASF292:
+	.string	"type_num"
+.LASF88:
+	.string	"tp_str"
+.LASF61:
+	.string	"ml_flags"
+.LASF163:
+	.string	"PySendResult"
+.LASF386:
+	.string	"setMappingFloat"
+.LASF128:
+	.string	"suboffsets"
+.LASF147:
+	.string	"getattrofunc"
+.LASF95:
+	.string	"tp_clear"
+.LASF123:
+	.string	"readonly"
+.LASF366:
+	.string	"new1d_ArrayObject"
+.LASF336:
+	.string	"PyArray_Descr"
+.LASF234:
+	.string	"npy_bool"
+.LASF106:
+	.string	"tp_descr_set"
+.LASF225:
+	.string	"bf_getbuffer"
+.LASF110:
+	.string	"tp_new"
+.LASF11:
+	.string	"signed char"
+.LASF178:
+	.string	"nb_lshift"
+.LASF356:
+	.string	"strdup"
+.LASF313:
+	.string	"copyswapn"
+.LASF175:
+	.string	"nb_absolute"
+.LASF207:
+	.string	"sq_item"
+.LASF7:
+	.string	"short unsigned int"
+.LASF319:
+	.string	"fromstr"
+.LASF278:
+	.string	"PyArray_CopySwapNFunc"
+.LASF213:
+	.string	"sq_inplace_repeat"
+.LASF227:
+	.string	"PyBufferProcs"
+.LASF70:
+	.string	"ob_type"
+.LASF358:
+	.string	"PyObject_GetAttrString"
+.LASF211:
+	.string	"sq_contains"
+.LASF78:
+	.string	"tp_vectorcall_offset"
+.LASF118:
+	.string	"tp_del"
+.LASF273:
+	.string	"reserved"
+.LASF199:
+	.string	"nb_inplace_true_divide"
+.LASF188:
+	.string	"nb_inplace_multiply"
+.LASF120:
+	.string	"tp_finalize"
+.LASF2:
+	.string	"double"
+.LASF294:
+	.string	"alignment"
+.LASF176:
+	.string	"nb_bool"
+.LASF256:
+	.string	"NPY_VOID"
+.LASF33:
+	.string	"_chain"
+.LASF374:
+	.string	"in_string"
+.LASF80:
+	.string	"tp_setattr"
+.LASF311:
+	.string	"getitem"
+.LASF248:
+	.string	"NPY_DOUBLE"
+.LASF206:
+	.string	"sq_repeat"
+.LASF35:
+	.string	"_flags2"
+.LASF168:
+	.string	"nb_subtract"
+.LASF349:
+	.string	"PyObject_SetAttrString"
+.LASF371:
+	.string	"setObjectString_Length"
+.LASF158:
+	.string	"newfunc"
+.LASF307:
+	.string	"PyArray_FastClipFunc"
+.LASF37:
+	.string	"_cur_column"
+.LASF138:
+	.string	"ssizeargfunc"
+.LASF133:
+	.string	"unaryfunc"
+.LASF330:
+	.string	"fastputmask"
+.LASF15:
+	.string	"__off64_t"
+.LASF48:
+	.string	"_unused2"
+.LASF346:
+	.string	"strcmp"
+.LASF314:
+	.string	"copyswap"
+.LASF238:
+	.string	"NPY_UBYTE"
+.LASF359:
+	.string	"PyLong_AsLong"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"pyhlhdf_common.c"
+.LASF1:
+	.string	"/root/repo/pyhlhdf"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,77 @@
+###########################################################################
+# Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+#
+# This file is part of HLHDF.
+#
+# HLHDF is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# HLHDF is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+###########################################################################
+
+## @file HlhdfBenchmark.py
+#
+# Measures the throughput of the reads that process a dataset in blocks
+# compared to a plain fetch of the same dataset. Not part of the test suite
+# since the timings depend on the machine, run it with the same environment
+# as HlhdfTestSuite.py.
+import os
+import time
+import numpy
+import _pyhl
+
+BENCHMARKFILE = "hlhdfbenchmark.h5"
+
+## Writes a compressed 2000x2000 double dataset as one chunk
+def writeFile():
+  data = (numpy.arange(2000 * 2000) % 1000).astype(numpy.float64).reshape(2000, 2000)
+  a = _pyhl.nodelist()
+  b = _pyhl.node(_pyhl.DATASET_ID, "/data", _pyhl.compression(_pyhl.COMPRESSION_ZLIB))
+  b.setArrayValue(-1, list(data.shape), data, "double", -1)
+  a.addNode(b)
+  a.write(BENCHMARKFILE)
+  return data.nbytes
+
+## Returns the best time out of a number of reads
+def timeRead(read, repeat=5):
+  best = None
+  for i in range(repeat):
+    starttime = time.time()
+    read(_pyhl.read_nodelist(BENCHMARKFILE))
+    elapsed = time.time() - starttime
+    if best is None or elapsed < best:
+      best = elapsed
+  return best
+
+def report(name, nbytes, elapsed, reference):
+  print("%-20s %8.3f s %8.1f MB/s %6.2f x fetch" % (name, elapsed, nbytes / elapsed / 1e6, elapsed / reference))
+
+def fetchDecoded(a):
+  a.fetch_decoded("/data")
+
+def fetchWithStatistics(a):
+  a.set_compute_statistics(True)
+  a.fetchNode("/data")
+
+BENCHMARKS = [
+  ("fetch_decoded", fetchDecoded),
+  ("fetch + statistics", fetchWithStatistics),
+]
+
+if __name__ == "__main__":
+  nbytes = writeFile()
+  try:
+    reference = timeRead(lambda a: a.fetchNode("/data"))
+    report("fetch", nbytes, reference, reference)
+    for name, read in BENCHMARKS:
+      report(name, nbytes, timeRead(read), reference)
+  finally:
+    os.remove(BENCHMARKFILE)
@@ -0,0 +1,47 @@
+###########################################################################
+# Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+#
+# This file is part of HLHDF.
+#
+# HLHDF is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# HLHDF is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+###########################################################################
+'''
+Tests the debug reporting
+
+@author: anders
+'''
+import unittest
+import _pyhl
+import _varioustests
+
+HLHDF_INFO = 3
+HLHDF_WARNING = 4
+
+class HlhdfDebugTest(unittest.TestCase):
+  def testAsyncSink(self):
+    reported, evaluated, dropped = _varioustests.logThroughAsyncSink(100, 1000, HLHDF_INFO)
+    self.assertEqual(100, reported)
+    self.assertEqual(100, evaluated)
+    self.assertEqual(0, dropped)
+
+  def testAsyncSink_filteredLevel(self):
+    reported, evaluated, dropped = _varioustests.logThroughAsyncSink(100, 1000, HLHDF_WARNING)
+    self.assertEqual(0, reported)
+    self.assertEqual(0, evaluated)
+    self.assertEqual(0, dropped)
+
+  def testAsyncSink_smallBuffer(self):
+    reported, evaluated, dropped = _varioustests.logThroughAsyncSink(1000, 2, HLHDF_INFO)
+    self.assertEqual(1000, evaluated)
+    self.assertEqual(1000, reported + dropped)
@@ -23,6 +23,7 @@ Created on Jun 22, 2009
 '''
 import unittest
 import _pyhl
+import numpy
 
 class HlhdfNodeTest(unittest.TestCase):
   TESTFILE = "fixture_VhlhdfRead_datafile.h5"
@@ -95,6 +96,77 @@ class HlhdfNodeTest(unittest.TestCase):
     except IOError:
       pass
 
+  def testDataIsWritableCopy(self):
+    node = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    node.setArrayValue(-1, [10, 20], numpy.arange(200, dtype=numpy.int32).reshape(10, 20), "int", -1)
+    a = node.data()
+    a += 1
+    a[0, 0] = -1
+    self.assertEqual(-1, a[0, 0])
+    self.assertTrue(numpy.all(numpy.arange(200).reshape(10, 20) == node.data()))
+    self.assertFalse(numpy.shares_memory(a, node.data(copy=False)))
+
+  def testDataIsNotCopied(self):
+    node = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    node.setArrayValue(-1, [10, 20], numpy.arange(200, dtype=numpy.int32).reshape(10, 20), "int", -1)
+    a = node.data(copy=False)
+    b = node.data(False)
+    self.assertTrue(numpy.shares_memory(a, b))
+    self.assertFalse(a.flags.writeable)
+
+  def testDataValidAfterNewValue(self):
+    node = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    node.setArrayValue(-1, [10, 20], numpy.arange(200, dtype=numpy.int32).reshape(10, 20), "int", -1)
+    a = node.data(copy=False)
+    node.setArrayValue(-1, [5], numpy.zeros(5, numpy.int32), "int", -1)
+    del node
+    self.assertTrue(numpy.all(numpy.arange(200).reshape(10, 20) == a))
+
+  def testFetchedDataIsNotCopied(self):
+    nodelist = _pyhl.read_nodelist(self.TESTFILE)
+    node = nodelist.fetchNode("/intarray")
+    a = node.data(copy=False)
+    del nodelist, node
+    self.assertEqual(numpy.int32, a.dtype)
+    self.assertFalse(a.flags.writeable)
+
+
+  def testDataAs(self):
+    node = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    node.setArrayValue(-1, [2, 50], numpy.arange(100, dtype=numpy.uint8).reshape(2, 50), "uchar", -1)
+    a = node.data_as("float")
+    self.assertEqual(numpy.float32, a.dtype)
+    self.assertEqual((2, 50), a.shape)
+    self.assertTrue(numpy.all(numpy.arange(100).reshape(2, 50) == a))
+    self.assertEqual("uchar", node.format())
+
+  def testDataAs_saturates(self):
+    node = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    node.setArrayValue(-1, [5], numpy.array([-3.5, 1.7, 300.0, numpy.nan, 254.0]), "double", -1)
+    a = node.data_as("uchar")
+    self.assertEqual([0, 1, 255, 0, 254], a.tolist())
+    a = node.data_as("short")
+    self.assertEqual([-3, 1, 300, 0, 254], a.tolist())
+
+  def testDataAs_scalar(self):
+    node = _pyhl.node(_pyhl.ATTRIBUTE_ID, "/attr")
+    node.setScalarValue(-1, 70000, "int", -1)
+    self.assertEqual(32767, node.data_as("short")[()])
+    self.assertEqual(70000.0, node.data_as("double")[()])
+
+  def testDataAs_notNumeric(self):
+    node = _pyhl.node(_pyhl.ATTRIBUTE_ID, "/attr")
+    node.setScalarValue(-1, "abc", "string", -1)
+    self.assertRaises(TypeError, node.data_as, "float")
+    self.assertRaises(TypeError, node.data_as, "string")
+
+  def testConvertData(self):
+    nodelist = _pyhl.read_nodelist(self.TESTFILE)
+    node = nodelist.fetchNode("/doublearray")
+    node.convert_data("float")
+    self.assertEqual("float", node.format())
+    self.assertTrue(numpy.allclose([1.0, 2.1, 3.2], node.data()))
+    self.assertEqual(numpy.float32, node.data().dtype)
 
 if __name__ == "__main__":
     #import sys;sys.argv = ['', 'Test.testName']
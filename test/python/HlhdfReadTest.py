@@ -24,8 +24,11 @@ Created on Jun 5, 2009
 import unittest
 import _pyhl
 import _rave_info_type
+import _varioustests
 import numpy
+import sys
 import os
+import time
 
 class HlhdfReadTest(unittest.TestCase):
   TESTFILE = "fixture_VhlhdfRead_datafile.h5"
@@ -743,6 +746,17 @@ class HlhdfReadTest(unittest.TestCase):
     self.assertEqual(150.0, comp["yscale"])
     self.assertTrue(numpy.all(comp["area_extent"] == [0.0,0.0,0.0,0.0]))
 
+  def testReadCompoundAttribute_sharedNativeType(self):
+    # The native compound type is shared between reads, make sure it survives
+    # that the first nodelist is released
+    for i in range(2):
+      nodelist = _pyhl.read_nodelist(self.TESTFILE)
+      comp = nodelist.fetchNode("/compoundgroup/attribute").compound_data()
+      self.assertEqual(10, comp["xsize"])
+      self.assertEqual(150.0, comp["yscale"])
+      self.assertTrue(numpy.all(comp["area_extent"] == [0.0,0.0,0.0,0.0]))
+      del nodelist
+
   def testReadCompoundAttribute2_byType(self):
     rinfo_type=_rave_info_type.type()
     rinfo_obj=_rave_info_type.object()
@@ -794,6 +808,107 @@ class HlhdfReadTest(unittest.TestCase):
     except AttributeError:
       pass
     
+  def testAttributes(self):
+    attrs = self.h5nodelist.attributes()
+    self.assertEqual("My String", attrs["/stringvalue"])
+    self.assertEqual(123, attrs["/charvalue"])
+    self.assertEqual(123456789, attrs["/ulongvalue"])
+    self.assertFalse("/intarray" in attrs)
+    self.assertEqual(123, self.h5nodelist.getNode("/charvalue").data())
+
+  def testAttributes_withPrefix(self):
+    attrs = self.h5nodelist.attributes("/compoundgroup/")
+    self.assertEqual(set(["/compoundgroup/attribute", "/compoundgroup/attribute2", "/compoundgroup/unnamed_type_attribute"]), set(attrs.keys()))
+
+  def testAttributes_doesNotFetchMarkedNodes(self):
+    self.h5nodelist.selectNode("/group1/intdset")
+    _pyhl.reset_statistics()
+    self.h5nodelist.attributes("/compoundgroup/")
+    self.assertEqual(0, _pyhl.get_statistics()["dataset_reads"])
+    self.h5nodelist.fetch()
+    self.assertEqual(1, _pyhl.get_statistics()["dataset_reads"])
+
+  def testDatasets(self):
+    dsets = self.h5nodelist.datasets("/group1/")
+    self.assertTrue("/group1/intdset" in dsets)
+    self.assertFalse("/intarray" in dsets)
+    self.assertTrue(numpy.all(self.h5nodelist.fetchNode("/group1/intdset").data() == dsets["/group1/intdset"]))
+
+  def testFetchArrays(self):
+    result = self.h5nodelist.fetch_arrays(["/group1/intdset", "/doublearray"])
+    self.assertEqual(set(["/group1/intdset", "/doublearray"]), set(result.keys()))
+    self.assertTrue(numpy.all(self.h5nodelist.getNode("/group1/intdset").data() == result["/group1/intdset"]))
+    self.assertTrue(numpy.all(self.h5nodelist.getNode("/doublearray").data() == result["/doublearray"]))
+
+  def testFetchArrays_withOut(self):
+    expected = self.h5nodelist.fetchNode("/group1/intdset").data()
+    out = numpy.zeros(expected.shape, numpy.float64)
+    result = self.h5nodelist.fetch_arrays(["/group1/intdset", "/doublearray"], {"/group1/intdset":out})
+    self.assertTrue(result["/group1/intdset"] is out)
+    self.assertTrue(numpy.all(expected == out))
+    node = self.h5nodelist.getNode("/group1/intdset")
+    self.assertEqual("double", node.format())
+    self.assertTrue(numpy.shares_memory(out, node.data(copy=False)))
+
+  def testFetchArrays_withOut_sharesMemoryWithNode(self):
+    out = numpy.zeros(self.h5nodelist.fetchNode("/doublearray").data().shape, numpy.float64)
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.fetch_arrays(["/doublearray"], {"/doublearray":out})
+    out[0] = 123.0
+    self.assertEqual(123.0, a.getNode("/doublearray").data()[0])
+    refcount = sys.getrefcount(out)
+    del a
+    self.assertEqual(refcount - 1, sys.getrefcount(out))
+
+  def testFetchArrays_withWrongSizedOut(self):
+    try:
+      self.h5nodelist.fetch_arrays(["/group1/intdset"], {"/group1/intdset":numpy.zeros(3, numpy.int32)})
+      self.fail("Expected IOError")
+    except IOError:
+      pass
+
+  def testFetchArrays_noSuchDataset(self):
+    try:
+      self.h5nodelist.fetch_arrays(["/nosuchdataset"])
+      self.fail("Expected AttributeError")
+    except AttributeError:
+      pass
+
+  def testReadCompoundAttribute_asArray(self):
+    node=self.h5nodelist.fetchNode("/compoundgroup/attribute")
+    comp = node.compound_array(copy=False)
+    self.assertEqual((), comp.shape)
+    self.assertEqual(10, comp["xsize"])
+    self.assertEqual(150.0, comp["yscale"])
+    self.assertTrue(numpy.all(comp["area_extent"] == [0.0,0.0,0.0,0.0]))
+    self.assertFalse(comp.flags.writeable)
+    self.assertTrue(node.compound_array().flags.writeable)
+
+  def testReadCompoundDataset2_asArray(self):
+    node=self.h5nodelist.fetchNode("/compoundgroup/dataset2")
+    comp = node.compound_array()
+    self.assertEqual((2,2), comp.shape)
+    self.assertTrue(numpy.all(comp["xsize"] == [[99, 98], [88, 78]]))
+    self.assertTrue(numpy.all(comp["yscale"] == [[150.0, 130.0], [110.0, 91.0]]))
+    self.assertTrue(numpy.all(comp["area_extent"][1,1] == [53.0,52.0,51.0,50.0]))
+
+  def testReadCompoundArray_notCompound(self):
+    node=self.h5nodelist.fetchNode("/intarray")
+    try:
+      node.compound_array()
+      self.fail("Expected AttributeError")
+    except AttributeError:
+      pass
+
+  def testReadCompoundArray_nodeAddedToNodelist(self):
+    node = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    _pyhl.nodelist().addNode(node)
+    try:
+      node.compound_array()
+      self.fail("Expected AttributeError")
+    except AttributeError:
+      pass
+
   def testReadUnnamedCompoundAttribute_byDictionary(self):
     node=self.h5nodelist.fetchNode("/compoundgroup/unnamed_type_attribute")
     self.assertEqual("compound", node.format())
@@ -889,6 +1004,140 @@ class HlhdfReadTest(unittest.TestCase):
     node= nl.fetchNode("/variable")
     self.assertEqual("this is a variable length string", node.data())
     self.assertEqual("this is a variable length string\x00", node.rawdata())
-      
+
+  def testLazyLoading(self):
+    self.h5nodelist.set_lazy_loading(True)
+    _pyhl.reset_statistics()
+    self.assertEqual(989898, self.h5nodelist.getNode("/intvalue").data())
+    self.assertEqual(4, len(self.h5nodelist.getNode("/intarray").data()))
+    self.assertEqual(4, len(self.h5nodelist.getNode("/intarray").data()))
+    stats = _pyhl.get_statistics()
+    self.assertEqual(1, stats["files_opened"])
+    self.assertEqual(1, stats["dataset_reads"])
+
+  def testLazyLoading_turnedOff(self):
+    self.h5nodelist.set_lazy_loading(True)
+    self.h5nodelist.set_lazy_loading(False)
+    try:
+      self.h5nodelist.getNode("/intarray").data()
+      self.fail("Expected exception")
+    except AttributeError:
+      pass
+
+  def testLazyLoading_notReadFromFile(self):
+    a = _pyhl.nodelist()
+    self.assertRaises(IOError, a.set_lazy_loading, True)
+
+  def testReleaseData(self):
+    self.h5nodelist.set_lazy_loading(True)
+    self.h5nodelist.getNode("/intarray")
+    _pyhl.reset_statistics()
+    self.h5nodelist.release_data("/intarray")
+    self.assertEqual(4, len(self.h5nodelist.getNode("/intarray").data()))
+    self.assertEqual(1, _pyhl.get_statistics()["dataset_reads"])
+
+  def testReleaseData_notWritten(self):
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    b.setArrayValue(-1, [2], numpy.zeros(2, numpy.int32), "int", -1)
+    a.addNode(b)
+    self.assertRaises(ValueError, a.release_data, "/data")
+
+  def testDataBudget(self):
+    self.h5nodelist.set_lazy_loading(True)
+    self.h5nodelist.set_data_budget(30)
+    self.assertEqual(4, len(self.h5nodelist.getNode("/intarray").data()))
+    self.assertEqual(16, self.h5nodelist.cached_data_size())
+    self.assertEqual(3, len(self.h5nodelist.getNode("/doublearray").data()))
+    self.assertEqual(24, self.h5nodelist.cached_data_size())
+
+    _pyhl.reset_statistics()
+    self.assertEqual(3, len(self.h5nodelist.getNode("/doublearray").data()))
+    self.assertEqual(0, _pyhl.get_statistics()["dataset_reads"])
+    self.assertEqual(4, len(self.h5nodelist.getNode("/intarray").data()))
+    self.assertEqual(1, _pyhl.get_statistics()["dataset_reads"])
+
+  def testDataBudget_removed(self):
+    self.h5nodelist.set_lazy_loading(True)
+    self.h5nodelist.set_data_budget(40)
+    self.h5nodelist.getNode("/intarray")
+    self.h5nodelist.set_data_budget(0)
+    self.assertEqual(0, self.h5nodelist.cached_data_size())
+
+  def testReadNodelists(self):
+    result = _pyhl.read_nodelists([self.TESTFILE, self.STRINGSFIXTURE], 2)
+    self.assertEqual(2, len(result))
+    self.h5nodelist.selectAll()
+    self.h5nodelist.fetch()
+    self.assertEqual(self.h5nodelist.getNodeNames(), result[0].getNodeNames())
+    self.assertEqual("My String", result[0].getNode("/stringvalue").data())
+    self.assertTrue(numpy.array_equal(self.h5nodelist.getNode("/doublearray").data(), result[0].getNode("/doublearray").data()))
+    self.assertEqual("this is a variable length string", result[1].getNode("/variable").data())
+
+  def testReadNodelists_dataOutlivesNodelist(self):
+    result = _pyhl.read_nodelists([self.TESTFILE, self.TESTFILE])
+    a = result[0].getNode("/doublearray").data(copy=False)
+    b = result[1].getNode("/doublearray").data(copy=False)
+    del result
+    expected = self.h5nodelist.fetchNode("/doublearray").data()
+    self.assertTrue(numpy.array_equal(expected, a))
+    self.assertTrue(numpy.array_equal(expected, b))
+
+  def testReadNodelists_compound(self):
+    result = _pyhl.read_nodelists([self.TESTFILE])
+    expected = self.h5nodelist.fetchNode("/compoundgroup/attribute").compound_data()
+    self.assertEqual(expected, result[0].getNode("/compoundgroup/attribute").compound_data())
+
+  def testReadNodelists_missingFile(self):
+    result = _pyhl.read_nodelists(["nonexisting.h5", self.TESTFILE, "nonexisting2.h5"])
+    self.assertEqual(None, result[0])
+    self.assertTrue(result[1] != None)
+    self.assertEqual(None, result[2])
+
+  def testReadNodelists_badFileInTheMiddle(self):
+    with open("testreadnodelists_bad.h5", "wb") as fp:
+      fp.write(b"This is not a HDF5 file")
+    try:
+      result = _pyhl.read_nodelists([self.TESTFILE, "testreadnodelists_bad.h5", self.TESTFILE, self.TESTFILE], 1)
+      self.assertTrue(result[0] != None)
+      self.assertEqual(None, result[1])
+      self.assertTrue(result[2] != None)
+      self.assertTrue(result[3] != None)
+    finally:
+      os.unlink("testreadnodelists_bad.h5")
+
+  def testReadNodelists_workerCrashes(self):
+    crashfile = "testreadnodelists_crash.h5"
+    if os.path.lexists(crashfile):
+      os.unlink(crashfile)
+    os.symlink(self.TESTFILE, crashfile)
+    try:
+      files = [self.TESTFILE, crashfile, self.TESTFILE, crashfile, self.TESTFILE]
+      self.assertEqual([True, False, True, False, True], _varioustests.readManyWithCrashes(files, 1))
+      self.assertEqual([True, False, True, False, True], _varioustests.readManyWithCrashes(files, 2))
+    finally:
+      os.unlink(crashfile)
+
+  def testReadNodelists_timeout(self):
+    fifo = "testreadnodelists.fifo"
+    if os.path.exists(fifo):
+      os.unlink(fifo)
+    os.mkfifo(fifo)
+    try:
+      # Opening the fifo blocks until there is a writer, which never comes
+      starttime = time.time()
+      result = _pyhl.read_nodelists([fifo, self.TESTFILE], 1, 1.0)
+      self.assertLess(time.time() - starttime, 10.0)
+      self.assertEqual(None, result[0])
+      self.assertTrue(result[1] != None)
+    finally:
+      os.unlink(fifo)
+
+  def testReadNodelists_empty(self):
+    self.assertEqual([], _pyhl.read_nodelists([]))
+
+  def testReadNodelists_notStrings(self):
+    self.assertRaises(TypeError, _pyhl.read_nodelists, [1, 2])
+
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,97 @@
+###########################################################################
+# Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+#
+# This file is part of HLHDF.
+#
+# HLHDF is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# HLHDF is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+###########################################################################
+'''
+Tests the allocation and I/O statistics
+
+@author: anders
+'''
+import unittest
+import _pyhl
+import numpy
+import os
+
+class HlhdfStatisticsTest(unittest.TestCase):
+  TESTFILE = "teststatistics.hdf"
+
+  def setUp(self):
+    _pyhl.show_hlhdferrors(0)
+    _pyhl.show_hdf5errors(0)
+    if os.path.isfile(self.TESTFILE):
+      os.unlink(self.TESTFILE)
+
+  def tearDown(self):
+    if os.path.isfile(self.TESTFILE):
+      os.unlink(self.TESTFILE)
+
+  def testResetStatistics(self):
+    _pyhl.reset_statistics()
+    stats = _pyhl.get_statistics()
+    self.assertEqual(0, stats["allocations"])
+    self.assertEqual(0, stats["files_opened"])
+    self.assertEqual(0, stats["dataset_reads"])
+    self.assertEqual(0, stats["bytes_written"])
+    self.assertEqual(stats["current_bytes"], stats["peak_bytes"])
+
+  def testWriteAndReadStatistics(self):
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.ATTRIBUTE_ID, "/attr")
+    b.setScalarValue(-1, 10, "int", -1)
+    a.addNode(b)
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    b.setArrayValue(-1, [10, 20], numpy.zeros((10, 20), numpy.int32), "int", -1)
+    a.addNode(b)
+
+    _pyhl.reset_statistics()
+    a.write(self.TESTFILE)
+    stats = _pyhl.get_statistics()
+    self.assertEqual(1, stats["files_opened"])
+    self.assertEqual(1, stats["dataset_writes"])
+    self.assertEqual(1, stats["attribute_writes"])
+    self.assertEqual(800 + 4, stats["bytes_written"])
+    self.assertTrue(stats["dataset_write_time"] >= 0.0)
+
+    _pyhl.reset_statistics()
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.selectAll()
+    a.fetch()
+    stats = _pyhl.get_statistics()
+    self.assertEqual(2, stats["files_opened"])
+    self.assertEqual(1, stats["dataset_reads"])
+    self.assertEqual(2, stats["attribute_reads"])
+    self.assertTrue(stats["bytes_read"] >= 800 + 4)
+    self.assertTrue(stats["objects_opened"] > 0)
+    self.assertTrue(stats["allocations"] > 0)
+    self.assertTrue(stats["bytes_allocated"] >= 800)
+    self.assertTrue(stats["peak_bytes"] >= stats["current_bytes"])
+
+  def testCopiedNodesShareData(self):
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    b.setArrayValue(-1, [500, 500], numpy.ones((500, 500), numpy.int32), "int", -1)
+    a.addNode(b)
+
+    _pyhl.reset_statistics()
+    copies = [a.getNode("/data") for i in range(3)]
+    stats = _pyhl.get_statistics()
+    self.assertTrue(stats["bytes_allocated"] < 500*500*4)
+
+    copies[0].setArrayValue(-1, [500, 500], numpy.zeros((500, 500), numpy.int32), "int", -1)
+    self.assertEqual(0, copies[0].data().sum())
+    self.assertEqual(500*500, copies[1].data().sum())
+    self.assertEqual(500*500, a.getNode("/data").data().sum())
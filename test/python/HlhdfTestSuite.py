@@ -27,6 +27,9 @@ from HlhdfUpdateTest import *
 from HlhdfNodeTest import *
 from HlhdfPyhlhdfCommonTest import *
 from HlhdfFileCreationPropertyTest import *
+from HlhdfStatisticsTest import *
+from HlhdfDebugTest import *
+from HlhdfThreadTest import *
 
 if __name__ == '__main__':
   unittest.main()
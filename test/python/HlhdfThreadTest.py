@@ -0,0 +1,233 @@
+###########################################################################
+# Copyright (C) 2009 Swedish Meteorological and Hydrological Institute, SMHI,
+#
+# This file is part of HLHDF.
+#
+# HLHDF is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# HLHDF is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
+###########################################################################
+'''
+Tests that the library can be used from several threads at the same time
+
+@author: anders
+'''
+import unittest
+import asyncio
+import concurrent.futures
+import _pyhl
+import _varioustests
+import numpy
+import os
+import threading
+
+class HlhdfThreadTest(unittest.TestCase):
+  TESTFILE = "fixture_VhlhdfRead_datafile.h5"
+
+  def testReadInThreads(self):
+    result = _varioustests.readInThreads(self.TESTFILE, 8, 10)
+    self.assertEqual(80, result)
+
+  def testReadInThreads_singleThread(self):
+    result = _varioustests.readInThreads(self.TESTFILE, 1, 5)
+    self.assertEqual(5, result)
+
+  def testReadInThreads_tooManyThreads(self):
+    self.assertRaises(ValueError, _varioustests.readInThreads, self.TESTFILE, 33, 1)
+
+  def testWriteAndReadInPythonThreads(self):
+    errors = []
+    def worker(index):
+      filename = "testthread_%d.hdf" % index
+      try:
+        for i in range(5):
+          a = _pyhl.nodelist()
+          b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+          b.setArrayValue(-1, [100, 100], numpy.full((100, 100), index * 10 + i, numpy.int32), "int", -1)
+          a.addNode(b)
+          a.write(filename, 6)
+          a = _pyhl.read_nodelist(filename)
+          a.selectAll()
+          a.fetch()
+          if not numpy.all(a.getNode("/data").data() == index * 10 + i):
+            errors.append("Wrong data in thread %d" % index)
+      except Exception as e:
+        errors.append(str(e))
+      finally:
+        if os.path.isfile(filename):
+          os.unlink(filename)
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(4)]
+    for t in threads:
+      t.start()
+    for t in threads:
+      t.join()
+    self.assertEqual([], errors)
+
+  def testWriteAndFetchAsync(self):
+    filename = "testthread_async.hdf"
+    try:
+      a = _pyhl.nodelist()
+      b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+      b.setArrayValue(-1, [100, 100], numpy.arange(10000, dtype=numpy.int32).reshape(100, 100), "int", -1)
+      a.addNode(b)
+      future = a.write_async(filename, 6)
+      self.assertTrue(isinstance(future, concurrent.futures.Future))
+      self.assertEqual(None, future.result(10))
+
+      a = _pyhl.read_nodelist(filename)
+      a.selectAll()
+      future = a.fetch_async()
+      future.result(10)
+      self.assertTrue(numpy.all(numpy.arange(10000).reshape(100, 100) == a.getNode("/data").data()))
+    finally:
+      if os.path.isfile(filename):
+        os.unlink(filename)
+
+  def testPrefetch(self):
+    filename = "testthread_prefetch.hdf"
+    try:
+      a = _pyhl.nodelist()
+      for i in range(5):
+        b = _pyhl.node(_pyhl.DATASET_ID, "/data%d" % i)
+        b.setArrayValue(-1, [200, 200], numpy.arange(40000, dtype=numpy.int32).reshape(200, 200) + i, "int", -1)
+        a.addNode(b)
+      a.write(filename, 6)
+
+      a = _pyhl.read_nodelist(filename)
+      a.prefetch(["/data%d" % i for i in range(5)])
+      for i in range(5):
+        self.assertTrue(numpy.all(numpy.arange(40000).reshape(200, 200) + i == a.fetchNode("/data%d" % i).data()))
+    finally:
+      if os.path.isfile(filename):
+        os.unlink(filename)
+
+  def testPrefetch_thenFetch(self):
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.prefetch(["/intarray", "/doublearray"])
+    a.selectAll()
+    a.fetch()
+    self.assertEqual(4, len(a.getNode("/intarray").data()))
+    self.assertEqual("int", a.getNode("/intarray").format())
+    self.assertEqual("double", a.getNode("/doublearray").format())
+
+  def testPrefetch_thenAsync(self):
+    filename = "testthread_prefetch_async.hdf"
+    try:
+      a = _pyhl.nodelist()
+      for i in range(5):
+        b = _pyhl.node(_pyhl.DATASET_ID, "/data%d" % i)
+        b.setArrayValue(-1, [1000, 1000], numpy.arange(1000000, dtype=numpy.int32).reshape(1000, 1000) + i, "int", -1)
+        a.addNode(b)
+      a.write(filename, 6)
+
+      a = _pyhl.read_nodelist(filename)
+      a.prefetch(["/data%d" % i for i in range(5)])
+      a.selectAll()
+      a.fetch_async().result(30)
+      for i in range(5):
+        self.assertTrue(numpy.all(numpy.arange(1000000).reshape(1000, 1000) + i == a.getNode("/data%d" % i).data()))
+
+      a.prefetch(["/data%d" % i for i in range(5)])
+      a.write_async(filename, 6).result(30)
+      a = _pyhl.read_nodelist(filename)
+      a.prefetch(["/data%d" % i for i in range(5)])
+      a.update_async(6).result(30)
+      self.assertTrue(numpy.all(numpy.arange(1000000).reshape(1000, 1000) == a.fetchNode("/data0").data()))
+    finally:
+      if os.path.isfile(filename):
+        os.unlink(filename)
+
+  def testReadNodelists_whileFetchingAsync(self):
+    filename = "testthread_readnodelists.hdf"
+    try:
+      a = _pyhl.nodelist()
+      for i in range(5):
+        b = _pyhl.node(_pyhl.DATASET_ID, "/data%d" % i)
+        b.setArrayValue(-1, [1000, 1000], numpy.arange(1000000, dtype=numpy.int32).reshape(1000, 1000) + i, "int", -1)
+        a.addNode(b)
+      a.write(filename, 6)
+
+      # The workers are forked while the library's own threads are reading the file
+      a = _pyhl.read_nodelist(filename)
+      a.prefetch(["/data%d" % i for i in range(3)])
+      b = _pyhl.read_nodelist(filename)
+      b.selectAll()
+      future = b.fetch_async()
+      result = _pyhl.read_nodelists([filename, filename], 2, 30.0)
+      future.result(30)
+      for nodelist in result + [a, b]:
+        self.assertTrue(numpy.all(numpy.arange(1000000).reshape(1000, 1000) + 2 == nodelist.fetchNode("/data2").data()))
+    finally:
+      if os.path.isfile(filename):
+        os.unlink(filename)
+
+  def testPrefetch_freeWhilePrefetching(self):
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.prefetch(["/intarray", "/doublearray"])
+    del a
+
+  def testPrefetch_noSuchNode(self):
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    self.assertRaises(AttributeError, a.prefetch, ["/intarray", "/nosuchnode"])
+
+  def testWriteAsync_failure(self):
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    b.setArrayValue(-1, [2], numpy.zeros(2, numpy.int32), "int", -1)
+    a.addNode(b)
+    future = a.write_async("/nosuchdirectory/testthread_async_failure.hdf")
+    self.assertRaises(IOError, future.result, 10)
+
+  def testFetchAsync_fork(self):
+    childSucceeded, done = _varioustests.forkWhileFetchingAsync(self.TESTFILE, 3)
+    self.assertTrue(childSucceeded)
+    self.assertEqual(3, done)
+
+  def testFetchAsync_errorReporting(self):
+    enabled, handlerInstalled = _varioustests.errorReportingAfterAsyncFetch(self.TESTFILE)
+    self.assertTrue(enabled)
+    self.assertTrue(handlerInstalled)
+
+  def testFetchAsync_nodelistBusy(self):
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.selectAll()
+    future = a.fetch_async()
+    try:
+      a.getNodeNames()
+      busy = False
+    except RuntimeError:
+      busy = True
+    future.result(10)
+    self.assertTrue(busy or future.done())
+    self.assertTrue(len(a.getNodeNames()) > 0)
+
+  def testFetchAsync_cancel(self):
+    nodelists = [_pyhl.read_nodelist(self.TESTFILE) for i in range(5)]
+    futures = []
+    for a in nodelists:
+      a.selectAll()
+      futures.append(a.fetch_async())
+    cancelled = futures[-1].cancel()
+    concurrent.futures.wait(futures, 10)
+    self.assertEqual(cancelled, futures[-1].cancelled())
+    for f in futures[:-1]:
+      self.assertEqual(None, f.result())
+    self.assertTrue(len(nodelists[-1].getNodeNames()) > 0)
+
+  def testFetchAsync_asyncio(self):
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.selectAll()
+    async def fetch():
+      await asyncio.wrap_future(a.fetch_async())
+      return a.getNode("/intarray").data()
+    self.assertEqual(4, len(asyncio.run(fetch())))
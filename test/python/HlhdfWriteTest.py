@@ -26,12 +26,14 @@ import unittest
 import _pyhl
 import numpy
 import os
+import ctypes
 import _varioustests
 import _rave_info_type
 
 class HlhdfWriteTest(unittest.TestCase):
   TESTFILE = "testskrivning.hdf"
   TESTFILE2 = "testskrivning2.hdf"
+  HLHDFDIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "hlhdf")
   
   def setUp(self):
     _pyhl.show_hlhdferrors(0)
@@ -554,6 +556,52 @@ class HlhdfWriteTest(unittest.TestCase):
     self.assertEqual(_pyhl.DATASET_ID, b.type())
     self.assertTrue(numpy.all(c == b.data()))
 
+  # Format written, numpy type and the format that the native type is read back as
+  ALL_FORMATS = [("char", numpy.int8, "schar"), ("schar", numpy.int8, "schar"), ("uchar", numpy.uint8, "uchar"),
+                 ("short", numpy.int16, "short"), ("ushort", numpy.uint16, "ushort"), ("int", numpy.int32, "int"),
+                 ("uint", numpy.uint32, "uint"), ("long", numpy.int64, "long"), ("ulong", numpy.uint64, "ulong"),
+                 ("llong", numpy.int64, "long"), ("ullong", numpy.uint64, "ulong"), ("float", numpy.float32, "float"),
+                 ("double", numpy.float64, "double"), ("hsize", numpy.uint64, "ulong"), ("hssize", numpy.int64, "long"),
+                 ("herr", numpy.int32, "int"), ("hbool", numpy.uint8, "uchar"), ("half", numpy.float16, "half")]
+
+  def writeAllFormats(self, filename, offset):
+    a = _pyhl.nodelist()
+    for hltype, dtype, readtype in self.ALL_FORMATS:
+      self.addArrayValueNode(a, _pyhl.DATASET_ID, "/" + hltype, -1, [3], numpy.array([1, 2, 3], dtype) + offset, hltype, -1)
+    a.write(filename)
+
+  def assertAllFormats(self, a, offset):
+    for hltype, dtype, readtype in self.ALL_FORMATS:
+      b = a.getNode("/" + hltype)
+      self.assertEqual(readtype, b.format(), hltype)
+      self.assertEqual(dtype, b.data().dtype, hltype)
+      self.assertEqual([1 + offset, 2 + offset, 3 + offset], b.data().tolist(), hltype)
+
+  def testWriteAndReadAllFormats(self):
+    self.writeAllFormats(self.TESTFILE, 0)
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.selectAll()
+    a.fetch()
+    self.assertAllFormats(a, 0)
+
+  def testSharedTypesAfterNodelistIsFreed(self):
+    # The nodes share the native type ids, freeing them must not close the shared ids
+    self.writeAllFormats(self.TESTFILE, 0)
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.selectAll()
+    a.fetch()
+    kept = a.getNode("/int")
+    del a
+
+    self.writeAllFormats(self.TESTFILE2, 10)
+    a = _pyhl.read_nodelist(self.TESTFILE2)
+    a.selectAll()
+    a.fetch()
+    self.assertAllFormats(a, 10)
+    self.assertEqual("int", kept.format())
+    self.assertEqual([1, 2, 3], kept.data().tolist())
+
   def testWriteGroup(self):
     a=_pyhl.nodelist()
     self.addGroupNode(a, "/group1")
@@ -686,5 +734,537 @@ class HlhdfWriteTest(unittest.TestCase):
     a = _pyhl.read_nodelist(self.TESTFILE)
     a.write(self.TESTFILE2)
     
+  def testSetArrayValueIsNotCopied(self):
+    c = numpy.arange(100, dtype=numpy.int32).reshape(10, 10)
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    b.setArrayValue(-1, [10, 10], c, "int", -1)
+    self.assertTrue(numpy.shares_memory(c, b.data(copy=False)))
+
+  def testSetArrayValueFromBufferObjects(self):
+    c = numpy.arange(24, dtype=numpy.int32)
+    a = _pyhl.nodelist()
+    self.addArrayValueNode(a, _pyhl.DATASET_ID, "/memoryview", -1, [24], memoryview(c), "int", -1)
+    self.addArrayValueNode(a, _pyhl.DATASET_ID, "/bytes", -1, [4, 6], c.tobytes(), "int", -1)
+    self.addArrayValueNode(a, _pyhl.DATASET_ID, "/fortran", -1, [4, 6], numpy.asfortranarray(c.reshape(4, 6)), "int", -1)
+    self.addArrayValueNode(a, _pyhl.DATASET_ID, "/nodims", -1, None, c.reshape(2, 3, 4), "int", -1)
+    self.addArrayValueNode(a, _pyhl.DATASET_ID, "/rank6", -1, [1, 2, 1, 3, 2, 2], c.reshape(1, 2, 1, 3, 2, 2), "int", -1)
+    a.write(self.TESTFILE)
+
+    #verify
+    a=_pyhl.read_nodelist(self.TESTFILE)
+    self.assertTrue(numpy.all(c == a.fetchNode("/memoryview").data()))
+    self.assertTrue(numpy.all(c.reshape(4, 6) == a.fetchNode("/bytes").data()))
+    self.assertTrue(numpy.all(c.reshape(4, 6) == a.fetchNode("/fortran").data()))
+    self.assertEqual([2, 3, 4], a.fetchNode("/nodims").dims())
+    self.assertEqual([1, 2, 1, 3, 2, 2], a.fetchNode("/rank6").dims())
+
+  def testSetArrayValueFromBufferWithWrongSize(self):
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    try:
+      b.setArrayValue(-1, [5], numpy.zeros(4, numpy.int32), "int", -1)
+      self.fail("Expected AttributeError")
+    except AttributeError:
+      pass
+    try:
+      b.setArrayValue(-1, [4], numpy.zeros(4, numpy.int16), "int", -1)
+      self.fail("Expected ValueError")
+    except ValueError:
+      pass
+    try:
+      b.setArrayValue(-1, [4], numpy.zeros(16, numpy.uint8), "int", -1)
+      self.fail("Expected ValueError")
+    except ValueError:
+      pass
+    try:
+      b.setArrayValue(-1, [4], numpy.zeros(16, numpy.int8), "int", -1)
+      self.fail("Expected ValueError")
+    except ValueError:
+      pass
+    b.setArrayValue(-1, [4], bytearray(16), "int", -1)
+    self.assertEqual([4], b.dims())
+
+  def testSetArrayValueWithTooHighRank(self):
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    try:
+      b.setArrayValue(-1, None, memoryview(bytes(4)).cast("i", [1]*33), "int", -1)
+      self.fail("Expected ValueError")
+    except ValueError:
+      pass
+    try:
+      b.setArrayValue(-1, [1]*33, numpy.zeros(1, numpy.int32), "int", -1)
+      self.fail("Expected ValueError")
+    except ValueError:
+      pass
+
+  def testWriteAdoptedAndBorrowedValues(self):
+    freed, hasData = _varioustests.writeAdoptedAndBorrowed(self.TESTFILE)
+    self.assertEqual(1, freed)
+    self.assertEqual(0, hasData)
+
+    #verify
+    a=_pyhl.read_nodelist(self.TESTFILE)
+    self.assertTrue(numpy.all(numpy.arange(100) == a.fetchNode("/adopted").data()))
+    self.assertTrue(numpy.all(numpy.arange(100, 200) == a.fetchNode("/borrowed").data()))
+    self.assertEqual(42, a.fetchNode("/scalar").data())
+
+  def testWriteBorrowedValue_failedWrite(self):
+    written, hasData = _varioustests.writeBorrowedAndFail("/nonexisting/directory/borrowed.h5")
+    self.assertEqual(0, written)
+    self.assertEqual(0, hasData)
+
+  def testWriteCompoundArrayValue(self):
+    dtype = numpy.dtype([("id", numpy.int32), ("name", "S8"), ("pos", numpy.float64, (3,)), ("flag", numpy.uint8)])
+    c = numpy.zeros((2, 3), dtype)
+    c["id"] = numpy.arange(6).reshape(2, 3)
+    c["name"] = b"abc"
+    c["pos"] = numpy.arange(18, dtype=numpy.float64).reshape(2, 3, 3)
+    c["flag"] = 1
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/compound")
+    b.setCompoundArrayValue(c)
+    a.addNode(b)
+    b = _pyhl.node(_pyhl.ATTRIBUTE_ID, "/scalar")
+    b.setCompoundArrayValue(c[1,2])
+    a.addNode(b)
+    a.write(self.TESTFILE)
+
+    #verify
+    a=_pyhl.read_nodelist(self.TESTFILE)
+    result = a.fetchNode("/compound").compound_array()
+    self.assertEqual((2, 3), result.shape)
+    self.assertTrue(numpy.all(c["id"] == result["id"]))
+    self.assertTrue(numpy.all(c["name"] == result["name"]))
+    self.assertTrue(numpy.all(c["pos"] == result["pos"]))
+    self.assertTrue(numpy.all(c["flag"] == result["flag"]))
+    comp = a.fetchNode("/scalar").compound_data()
+    self.assertEqual(5, comp["id"])
+    self.assertEqual("abc", comp["name"])
+
+  def testWriteCompoundArrayValue_notStructured(self):
+    b = _pyhl.node(_pyhl.DATASET_ID, "/compound")
+    try:
+      b.setCompoundArrayValue(numpy.zeros(4, numpy.int32))
+      self.fail("Expected TypeError")
+    except TypeError:
+      pass
+  def writeOdimFile(self, data, hltype, compression=None):
+    a = _pyhl.nodelist()
+    for g in ["/dataset1", "/dataset1/what", "/dataset1/data1", "/dataset1/data1/what"]:
+      a.addNode(_pyhl.node(_pyhl.GROUP_ID, g))
+    self.addScalarValueNode(a, _pyhl.ATTRIBUTE_ID, "/dataset1/what/offset", -1, -32.0, "double", -1)
+    self.addScalarValueNode(a, _pyhl.ATTRIBUTE_ID, "/dataset1/what/gain", -1, 2.0, "double", -1)
+    self.addScalarValueNode(a, _pyhl.ATTRIBUTE_ID, "/dataset1/data1/what/gain", -1, 0.5, "double", -1)
+    self.addScalarValueNode(a, _pyhl.ATTRIBUTE_ID, "/dataset1/data1/what/nodata", -1, 255.0, "double", -1)
+    self.addScalarValueNode(a, _pyhl.ATTRIBUTE_ID, "/dataset1/data1/what/undetect", -1, 0.0, "double", -1)
+    if compression is None:
+      self.addArrayValueNode(a, _pyhl.DATASET_ID, "/dataset1/data1/data", -1, list(data.shape), data, hltype, -1)
+    else:
+      b = _pyhl.node(_pyhl.DATASET_ID, "/dataset1/data1/data", compression)
+      b.setArrayValue(-1, list(data.shape), data, hltype, -1)
+      a.addNode(b)
+    a.write(self.TESTFILE)
+
+  def testFetchDecoded(self):
+    data = (numpy.arange(200 * 400) % 256).astype(numpy.uint8).reshape(200, 400)
+    self.writeOdimFile(data, "uchar")
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    result = a.fetch_decoded("/dataset1/data1/data")
+    self.assertEqual(numpy.float64, result.dtype)
+    self.assertEqual((200, 400), result.shape)
+    expected = data * 0.5 - 32.0
+    valid = (data != 255) & (data != 0)
+    self.assertTrue(numpy.all(expected[valid] == result[valid]))
+    self.assertTrue(numpy.all(numpy.isnan(result[~valid])))
+
+  def writeCompressedFile(self, data, hltype):
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data", _pyhl.compression(_pyhl.COMPRESSION_ZLIB))
+    b.setArrayValue(-1, list(data.shape), data, hltype, -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+
+  def testFetchDecoded_compressed(self):
+    # Several blocks of rows, the last one partial, out of the one compressed chunk
+    data = (numpy.arange(500 * 400) % 1000).astype(numpy.float64).reshape(500, 400)
+    self.writeCompressedFile(data, "double")
+
+    result = _pyhl.read_nodelist(self.TESTFILE).fetch_decoded("/data")
+    self.assertEqual((500, 400), result.shape)
+    self.assertTrue(numpy.array_equal(data, result))
+
+  def testFetchDecoded_sentinels(self):
+    data = numpy.array([[0, 10, 255], [20, 0, 30]], numpy.uint16)
+    self.writeOdimFile(data, "ushort")
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    result = a.fetch_decoded("/dataset1/data1/data", "float", -9999.0, -30.0)
+    self.assertEqual(numpy.float32, result.dtype)
+    self.assertEqual([[-30.0, -27.0, -9999.0], [-22.0, -30.0, -17.0]], result.tolist())
+    self.assertEqual("UNDEFINED", a.getNode("/dataset1/data1/data").format())
+
+  def testFetchDecoded_noWhat(self):
+    a = _pyhl.nodelist()
+    self.addArrayValueNode(a, _pyhl.DATASET_ID, "/data", -1, [3], numpy.array([1, 2, 3], numpy.int16), "short", -1)
+    a.write(self.TESTFILE)
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    self.assertEqual([1.0, 2.0, 3.0], a.fetch_decoded("/data").tolist())
+
+  def testFetchDecoded_isWritable(self):
+    a = _pyhl.nodelist()
+    self.addArrayValueNode(a, _pyhl.DATASET_ID, "/data", -1, [3], numpy.array([1, 2, 3], numpy.int16), "short", -1)
+    a.write(self.TESTFILE)
+
+    result = _pyhl.read_nodelist(self.TESTFILE).fetch_decoded("/data")
+    self.assertTrue(result.flags.writeable)
+    result *= 2.0
+    self.assertEqual([2.0, 4.0, 6.0], result.tolist())
+
+  def testFetchDecoded_notDataset(self):
+    data = numpy.zeros((2, 2), numpy.uint8)
+    self.writeOdimFile(data, "uchar")
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    self.assertRaises(AttributeError, a.fetch_decoded, "/dataset1/data1/what/gain")
+    self.assertRaises(TypeError, a.fetch_decoded, "/dataset1/data1/data", "int")
+
+  def testFetchStatistics(self):
+    data = (numpy.arange(300 * 500) % 256).astype(numpy.uint8).reshape(300, 500)
+    self.writeOdimFile(data, "uchar")
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.set_compute_statistics(True, 4, 0.0, 256.0)
+    a.selectAll()
+    a.fetch()
+    node = a.getNode("/dataset1/data1/data")
+    stats = node.statistics()
+    valid = data[(data != 255) & (data != 0)]
+    self.assertEqual(data.size, stats["count"])
+    self.assertEqual(valid.size, stats["valid_count"])
+    self.assertEqual(numpy.count_nonzero(data == 255), stats["nodata_count"])
+    self.assertEqual(numpy.count_nonzero(data == 0), stats["undetect_count"])
+    self.assertEqual(1.0, stats["min"])
+    self.assertEqual(254.0, stats["max"])
+    self.assertAlmostEqual(valid.mean(), stats["mean"], 10)
+    self.assertEqual(numpy.histogram(valid, 4, (0.0, 256.0))[0].tolist(), stats["histogram"])
+    self.assertTrue(numpy.all(data == node.data()))
+
+    node.setArrayValue(-1, list(data.shape), data, "uchar", -1)
+    self.assertEqual(None, node.statistics())
+
+  def testFetchStatistics_compressed(self):
+    # Several blocks of rows, the last one partial, out of the one compressed chunk
+    data = (numpy.arange(500 * 400) % 1000).astype(numpy.float64).reshape(500, 400)
+    self.writeCompressedFile(data, "double")
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.set_compute_statistics(True, 10, 0.0, 1000.0)
+    node = a.fetchNode("/data")
+    stats = node.statistics()
+    self.assertEqual(data.size, stats["count"])
+    self.assertEqual(data.size, stats["valid_count"])
+    self.assertEqual(data.min(), stats["min"])
+    self.assertEqual(data.max(), stats["max"])
+    self.assertAlmostEqual(data.mean(), stats["mean"], 10)
+    self.assertEqual(numpy.histogram(data, 10, (0.0, 1000.0))[0].tolist(), stats["histogram"])
+    self.assertTrue(numpy.array_equal(data, node.data()))
+
+  def testFetchStatistics_float(self):
+    data = numpy.array([[1.5, numpy.nan, -2.0], [255.0, 4.0, 0.0]], numpy.float32)
+    self.writeOdimFile(data, "float")
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.set_compute_statistics(True)
+    stats = a.fetchNode("/dataset1/data1/data").statistics()
+    self.assertEqual(6, stats["count"])
+    self.assertEqual(3, stats["valid_count"])
+    self.assertEqual(1, stats["nodata_count"])
+    self.assertEqual(1, stats["undetect_count"])
+    self.assertEqual(-2.0, stats["min"])
+    self.assertEqual(4.0, stats["max"])
+    self.assertAlmostEqual(3.5 / 3, stats["mean"], 6)
+    self.assertEqual([], stats["histogram"])
+
+  def testFetchStatistics_off(self):
+    data = numpy.zeros((2, 2), numpy.uint8)
+    self.writeOdimFile(data, "uchar")
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    self.assertEqual(None, a.fetchNode("/dataset1/data1/data").statistics())
+    self.assertRaises(ValueError, a.set_compute_statistics, True, 300, 0.0, 1.0)
+    self.assertRaises(ValueError, a.set_compute_statistics, True, 4, 1.0, 1.0)
+
+  def testStoredStatistics(self):
+    data = numpy.zeros((300, 500), numpy.uint8)
+    data[100:120, 300:340] = 200
+    data[250:260, 10:20] = 10
+    data[0, 0:5] = 255
+    compression = _pyhl.compression(_pyhl.COMPRESSION_ZLIB)
+    compression.summary_tile_size = 64
+    self.assertEqual(64, compression.summary_tile_size)
+    self.writeOdimFile(data, "uchar", compression)
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    self.assertFalse(any(n.find("_hlhdf_") >= 0 for n in a.getNodeNames().keys()))
+    stats = a.fetch_stored_statistics("/dataset1/data1/data")
+    self.assertEqual(data.size, stats["count"])
+    self.assertEqual(900, stats["valid_count"])
+    self.assertEqual(5, stats["nodata_count"])
+    self.assertEqual(data.size - 905, stats["undetect_count"])
+    self.assertEqual(10.0, stats["min"])
+    self.assertEqual(200.0, stats["max"])
+    self.assertAlmostEqual((800 * 200 + 100 * 10) / 900.0, stats["mean"], 10)
+    self.assertEqual([], stats["histogram"])
+
+    self.assertTrue(a.may_contain_values("/dataset1/data1/data", 150.0, 255.0))
+    self.assertFalse(a.may_contain_values("/dataset1/data1/data", 201.0, 255.0))
+    self.assertFalse(a.may_contain_values("/dataset1/data1/data", 150.0, 255.0, [0, 0], [64, 64]))
+    self.assertTrue(a.may_contain_values("/dataset1/data1/data", 150.0, 255.0, [110, 330], [1, 1]))
+    self.assertFalse(a.may_contain_values("/dataset1/data1/data", 150.0, 255.0, [200, 0], [100, 128]))
+    self.assertTrue(a.may_contain_values("/dataset1/data1/data", 0.0, 20.0, [200, 0], [100, 128]))
+    self.assertRaises(ValueError, a.may_contain_values, "/dataset1/data1/data", 0.0, 1.0, [0, 0], [1])
+    self.assertRaises(IOError, a.may_contain_values, "/dataset1/data1/data", 0.0, 1.0, [0], [1])
+    self.assertRaises(IOError, a.may_contain_values, "/dataset1/data1/data", 0.0, 1.0, [290, 0], [20, 1])
+
+    a.selectAll()
+    a.fetch()
+    self.assertTrue(numpy.all(data == a.getNode("/dataset1/data1/data").data()))
+
+  def testStoredStatistics_manyTiles(self):
+    data = numpy.zeros(10000, numpy.int16)
+    data[9999] = 100
+    compression = _pyhl.compression(_pyhl.COMPRESSION_ZLIB)
+    compression.summary_tile_size = 1
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data", compression)
+    b.setArrayValue(-1, [10000], data, "short", -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    stats = a.fetch_stored_statistics("/data")
+    self.assertEqual(10000, stats["valid_count"])
+    self.assertEqual(0.0, stats["min"])
+    self.assertEqual(100.0, stats["max"])
+    self.assertFalse(a.may_contain_values("/data", 50.0, 150.0, [0], [8000]))
+    self.assertTrue(a.may_contain_values("/data", 50.0, 150.0, [9997], [1]))
+    self.assertFalse(a.may_contain_values("/data", 50.0, 150.0, [9995], [1]))
+
+  def testStoredStatistics_otherPrefixedAttributesAreRead(self):
+    a = _pyhl.nodelist()
+    self.addArrayValueNode(a, _pyhl.DATASET_ID, "/data", -1, [3], numpy.array([1, 2, 3], numpy.int16), "short", -1)
+    self.addScalarValueNode(a, _pyhl.ATTRIBUTE_ID, "/data/_hlhdf_min_user", -1, 5, "int", -1)
+    self.addScalarValueNode(a, _pyhl.ATTRIBUTE_ID, "/_hlhdf_note", -1, "mine", "string", -1)
+    a.write(self.TESTFILE)
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    self.assertEqual(5, a.fetchNode("/data/_hlhdf_min_user").data())
+    self.assertEqual("mine", a.fetchNode("/_hlhdf_note").data())
+
+  def testStoredStatistics_notStored(self):
+    self.writeOdimFile(numpy.zeros((2, 2), numpy.uint8), "uchar")
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    self.assertEqual(None, a.fetch_stored_statistics("/dataset1/data1/data"))
+    self.assertTrue(a.may_contain_values("/dataset1/data1/data", 100.0, 200.0))
+
+  def testWriteHalf(self):
+    data = numpy.array([[1.0, -2.5, 65504, 1e-7], [numpy.inf, numpy.nan, 0.333, -0.0]], numpy.float16)
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    b.setArrayValue(-1, [2, 4], data, "half", -1)
+    a.addNode(b)
+    b = _pyhl.node(_pyhl.ATTRIBUTE_ID, "/attr")
+    b.setScalarValue(-1, 1.5, "half", -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.selectAll()
+    a.fetch()
+    b = a.getNode("/data")
+    self.assertEqual("half", b.format())
+    self.assertEqual(numpy.float16, b.data().dtype)
+    self.assertTrue(numpy.array_equal(data, b.data(), equal_nan=True))
+    self.assertTrue(numpy.array_equal(data.astype(numpy.float32), b.data_as("float"), equal_nan=True))
+    self.assertTrue(numpy.array_equal(data.astype(numpy.float64), b.data_as("double"), equal_nan=True))
+    self.assertEqual("half", a.getNode("/attr").format())
+    self.assertEqual(1.5, a.getNode("/attr").data())
+
+  def testConvertAllHalfValues(self):
+    bits = numpy.arange(65536, dtype=numpy.uint32).astype(numpy.uint16)
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    b.setArrayValue(-1, [bits.size], bits.view(numpy.float16), "half", -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+
+    b = _pyhl.read_nodelist(self.TESTFILE).fetchNode("/data")
+    expected = bits.view(numpy.float16).astype(numpy.float32)
+    self.assertTrue(numpy.array_equal(expected, b.data_as("float"), equal_nan=True))
+
+  def testConvertFloatToHalf(self):
+    data = numpy.linspace(-70000, 70000, 100001).astype(numpy.float32)
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    b.setArrayValue(-1, [data.size], data, "float", -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+
+    b = _pyhl.read_nodelist(self.TESTFILE).fetchNode("/data")
+    with numpy.errstate(over="ignore"):
+      expected = data.astype(numpy.float16)
+    self.assertTrue(numpy.array_equal(expected, b.data_as("half")))
+
+  def testWriteBfloat16(self):
+    data = numpy.array([0x3f80, 0xc020, 0x7f80, 0x0001], numpy.uint16)
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data")
+    b.setArrayValue(-1, [4], data, "bfloat16", -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+
+    b = _pyhl.read_nodelist(self.TESTFILE).fetchNode("/data")
+    self.assertEqual("bfloat16", b.format())
+    self.assertTrue(numpy.array_equal(data, b.data()))
+    expected = (data.astype(numpy.uint32) << 16).view(numpy.float32)
+    self.assertTrue(numpy.array_equal(expected, b.data_as("float")))
+
+  def roundMantissa(self, data, keepbits, utype, mbits):
+    u = data.view(utype)
+    shift = utype(mbits - keepbits)
+    half = utype((1 << (mbits - keepbits - 1)) - 1)
+    mask = ~utype((1 << (mbits - keepbits)) - 1)
+    rounded = ((u + half + ((u >> shift) & utype(1))) & mask).view(data.dtype)
+    return numpy.where(numpy.isfinite(data), rounded, data)
+
+  def testWriteKeepBits(self):
+    numpy.random.seed(5)
+    data = (numpy.linspace(0.0, 50.0, 100000) + numpy.random.random(100000)).astype(numpy.float32)
+    data[0:4] = [numpy.nan, numpy.inf, -numpy.inf, numpy.finfo(numpy.float32).max]
+    original = data.copy()
+    compression = _pyhl.compression(_pyhl.COMPRESSION_ZLIB)
+    compression.keep_bits = 7
+    self.assertEqual(7, compression.keep_bits)
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data", compression)
+    b.setArrayValue(-1, [data.size], data, "float", -1)
+    a.addNode(b)
+    b = _pyhl.node(_pyhl.DATASET_ID, "/double", compression)
+    b.setArrayValue(-1, [data.size], data.astype(numpy.float64), "double", -1)
+    a.addNode(b)
+    b = _pyhl.node(_pyhl.DATASET_ID, "/int", compression)
+    b.setArrayValue(-1, [10], numpy.arange(10, dtype=numpy.int32), "int", -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+    roundedSize = os.path.getsize(self.TESTFILE)
+    self.assertTrue(numpy.array_equal(original, a.getNode("/data").data(), equal_nan=True))
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    self.assertEqual(3, len(a.getNodeNames()))
+    a.selectAll()
+    a.fetch()
+    expected = self.roundMantissa(original, 7, numpy.uint32, 23)
+    self.assertTrue(numpy.array_equal(expected, a.getNode("/data").data(), equal_nan=True))
+    expected = self.roundMantissa(original.astype(numpy.float64), 7, numpy.uint64, 52)
+    self.assertTrue(numpy.array_equal(expected, a.getNode("/double").data(), equal_nan=True))
+    self.assertTrue(numpy.array_equal(numpy.arange(10), a.getNode("/int").data()))
+    self.assertEqual(numpy.inf, a.getNode("/data").data()[3])
+    written = a.getNode("/data").data()[4:]
+    self.assertTrue(numpy.all(numpy.abs(written - original[4:]) <= numpy.abs(original[4:]) * 2.0**-8))
+
+    compression.keep_bits = 0
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data", compression)
+    b.setArrayValue(-1, [data.size], data, "float", -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+    self.assertTrue(roundedSize < os.path.getsize(self.TESTFILE))
+
+  def testWriteKeepDigits(self):
+    data = numpy.array([1.0 / 3.0, 123.456789, -0.000123456, 0.0], numpy.float32)
+    compression = _pyhl.compression(_pyhl.COMPRESSION_ZLIB)
+    compression.keep_digits = 3
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data", compression)
+    b.setArrayValue(-1, [data.size], data, "float", -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+
+    b = _pyhl.read_nodelist(self.TESTFILE).fetchNode("/data")
+    self.assertTrue(numpy.array_equal(self.roundMantissa(data, 10, numpy.uint32, 23), b.data()))
+    self.assertTrue(numpy.allclose(data, b.data(), rtol=5e-4, atol=0))
+
+  def testWriteDeltaPredictor(self):
+    numpy.random.seed(7)
+    rays = numpy.linspace(0, 200, 360).reshape(360, 1)
+    bins = numpy.linspace(0, 50, 500).reshape(1, 500)
+    data = (rays + bins + numpy.random.random((360, 500)) * 3).astype(numpy.uint8)
+    compression = _pyhl.compression(_pyhl.COMPRESSION_ZLIB)
+    self.assertEqual(_pyhl.PREDICTOR_NONE, compression.predictor)
+    self.writeOdimFile(data, "uchar", compression)
+    plainSize = os.path.getsize(self.TESTFILE)
+
+    compression.predictor = _pyhl.PREDICTOR_DELTA
+    self.assertEqual(_pyhl.PREDICTOR_DELTA, compression.predictor)
+    self.writeOdimFile(data, "uchar", compression)
+    self.assertTrue(os.path.getsize(self.TESTFILE) < plainSize)
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.selectAll()
+    a.fetch()
+    self.assertTrue(numpy.array_equal(data, a.getNode("/dataset1/data1/data").data()))
+
+  def testDeltaFilterPlugin(self):
+    class FilterClass(ctypes.Structure):
+      _fields_ = [("version", ctypes.c_int), ("id", ctypes.c_int)]
+    plugin = ctypes.CDLL(os.path.join(self.HLHDFDIR, "libh5hlhdfdelta.so"))
+    plugin.H5PLget_plugin_info.restype = ctypes.POINTER(FilterClass)
+    self.assertEqual(0, plugin.H5PLget_plugin_type()) # H5PL_TYPE_FILTER
+    self.assertEqual(32790, plugin.H5PLget_plugin_info().contents.id)
+
+  def testDeltaFilterPlugin_notInLibrary(self):
+    library = ctypes.CDLL(os.path.join(self.HLHDFDIR, "libhlhdf.so"))
+    self.assertFalse(hasattr(library, "H5PLget_plugin_type"))
+    self.assertFalse(hasattr(library, "H5PLget_plugin_info"))
+
+  def testWriteDeltaPredictor_allSizes(self):
+    numpy.random.seed(9)
+    compression = _pyhl.compression(_pyhl.COMPRESSION_ZLIB)
+    compression.predictor = _pyhl.PREDICTOR_DELTA
+    values = {}
+    a = _pyhl.nodelist()
+    for hltype, dtype in [("schar", numpy.int8), ("ushort", numpy.uint16), ("int", numpy.int32),
+                          ("llong", numpy.int64), ("float", numpy.float32)]:
+      info = numpy.iinfo(dtype) if dtype != numpy.float32 else numpy.finfo(dtype)
+      values[hltype] = numpy.random.uniform(info.min, info.max, (7, 37)).astype(dtype)
+      b = _pyhl.node(_pyhl.DATASET_ID, "/" + hltype, compression)
+      b.setArrayValue(-1, [7, 37], values[hltype], hltype, -1)
+      a.addNode(b)
+    a.write(self.TESTFILE)
+
+    a = _pyhl.read_nodelist(self.TESTFILE)
+    a.selectAll()
+    a.fetch()
+    for hltype in values:
+      self.assertTrue(numpy.array_equal(values[hltype], a.getNode("/" + hltype).data()), hltype)
+
+  def testWriteDeltaPredictor_noCompression(self):
+    data = numpy.arange(1000, dtype=numpy.int16) * 3 - 1000
+    compression = _pyhl.compression(_pyhl.COMPRESSION_ZLIB)
+    compression.level = 0
+    compression.predictor = _pyhl.PREDICTOR_DELTA
+    a = _pyhl.nodelist()
+    b = _pyhl.node(_pyhl.DATASET_ID, "/data", compression)
+    b.setArrayValue(-1, [1000], data, "short", -1)
+    a.addNode(b)
+    a.write(self.TESTFILE)
+
+    b = _pyhl.read_nodelist(self.TESTFILE).fetchNode("/data")
+    self.assertTrue(numpy.array_equal(data, b.data()))
+    try:
+      compression.predictor = 5
+      self.fail("Expected AttributeError")
+    except AttributeError:
+      pass
+
 if __name__ == '__main__':
   unittest.main()
@@ -28,6 +28,13 @@ along with HLHDF.  If not, see <http://www.gnu.org/licenses/>.
 /** To ensure that arrayobject is imported correctly */
 #define HLHDF_PYMODULE_WITH_IMPORT_ARRAY
 #include "pyhlhdf_common.h"
+#include "hlhdf_debug.h"
+#include "hlhdf_alloc.h"
+#include "hlhdf.h"
+#include "hlhdf_read.h"
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/wait.h>
 
 static PyObject *ErrorObject;
 
@@ -67,10 +74,434 @@ static PyObject* _varioustests_translatePyFormatToHlHdf(PyObject* self, PyObject
   return result;
 }
 
+static int numberOfReportedMessages = 0;
+
+static void countingDebugFunction(char* filename, int lineno, HL_Debug lvl, const char* fmt, ...)
+{
+  numberOfReportedMessages++;
+}
+
+static int countEvaluations(int* counter)
+{
+  (*counter)++;
+  return *counter;
+}
+
+/**
+ * Reports nmessages INFO messages through the asynchronous debug sink with the
+ * debug level set to level. Returns a tuple (number of messages that reached the debug function,
+ * number of evaluated message arguments, number of dropped messages).
+ */
+static PyObject* _varioustests_logThroughAsyncSink(PyObject* self, PyObject* args)
+{
+  int nmessages = 0, capacity = 0, level = 0, i = 0;
+  int evaluated = 0;
+  unsigned long dropped = 0;
+  HL_Debug oldLevel = hlhdfDbg.dbgLevel;
+  void (*oldfun)(char* filename, int lineno, HL_Debug lvl, const char* fmt, ...) = hlhdfDbg.dbgfun;
+
+  if (!PyArg_ParseTuple(args, "iii", &nmessages, &capacity, &level)) {
+    return NULL;
+  }
+  numberOfReportedMessages = 0;
+  HL_setDebugFunction(countingDebugFunction);
+  HL_setDebugLevel((HL_Debug)level);
+  if (!HL_enableAsyncDebugSink((size_t)capacity)) {
+    HL_setDebugFunction(oldfun);
+    HL_setDebugLevel(oldLevel);
+    setException(PyExc_RuntimeError, "Could not enable async debug sink");
+    return NULL;
+  }
+  for (i = 0; i < nmessages; i++) {
+    HL_INFO1("Message %d", countEvaluations(&evaluated));
+  }
+  dropped = HL_getDroppedDebugMessages();
+  HL_disableAsyncDebugSink();
+  HL_setDebugFunction(oldfun);
+  HL_setDebugLevel(oldLevel);
+
+  return Py_BuildValue("(iik)", numberOfReportedMessages, evaluated, dropped);
+}
+
+/**
+ * Arguments to the reader threads.
+ */
+typedef struct {
+  const char* filename; /**< the file to read */
+  int niterations; /**< number of times the file should be read */
+  int expectedNodes; /**< the number of nodes the file contains */
+  int successful; /**< number of successful reads */
+} ThreadedReadArgs;
+
+static void* threadedReader(void* arg)
+{
+  ThreadedReadArgs* args = (ThreadedReadArgs*)arg;
+  int i = 0;
+  for (i = 0; i < args->niterations; i++) {
+    HL_NodeList* nodelist = HLNodeList_read(args->filename);
+    if (nodelist != NULL) {
+      if (HLNodeList_selectAllNodes(nodelist) &&
+          HLNodeList_fetchMarkedNodes(nodelist) &&
+          HLNodeList_getNumberOfNodes(nodelist) == args->expectedNodes) {
+        args->successful++;
+      }
+      HLNodeList_free(nodelist);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Reads and fetches the file niterations times in each of nthreads threads at the same time.
+ * Returns the total number of reads that gave the same result as when reading the file
+ * from the calling thread.
+ */
+static PyObject* _varioustests_readInThreads(PyObject* self, PyObject* args)
+{
+  char* filename = NULL;
+  int nthreads = 0, niterations = 0, i = 0, successful = 0, expectedNodes = 0;
+  HL_NodeList* nodelist = NULL;
+  pthread_t threads[32];
+  ThreadedReadArgs threadArgs[32];
+
+  if (!PyArg_ParseTuple(args, "sii", &filename, &nthreads, &niterations)) {
+    return NULL;
+  }
+  if (nthreads <= 0 || nthreads > 32) {
+    setException(PyExc_ValueError, "nthreads must be between 1 and 32");
+    return NULL;
+  }
+  if ((nodelist = HLNodeList_read(filename)) == NULL) {
+    setException(PyExc_IOError, "Could not read file");
+    return NULL;
+  }
+  expectedNodes = HLNodeList_getNumberOfNodes(nodelist);
+  HLNodeList_free(nodelist);
+
+  Py_BEGIN_ALLOW_THREADS
+  for (i = 0; i < nthreads; i++) {
+    threadArgs[i].filename = filename;
+    threadArgs[i].niterations = niterations;
+    threadArgs[i].expectedNodes = expectedNodes;
+    threadArgs[i].successful = 0;
+    if (pthread_create(&threads[i], NULL, threadedReader, &threadArgs[i]) != 0) {
+      break;
+    }
+  }
+  nthreads = i;
+  for (i = 0; i < nthreads; i++) {
+    pthread_join(threads[i], NULL);
+    successful += threadArgs[i].successful;
+  }
+  Py_END_ALLOW_THREADS
+
+  return PyInt_FromLong(successful);
+}
+
+static int adoptedFreeCount = 0;
+
+static void countingFree(void* data)
+{
+  adoptedFreeCount++;
+  free(data);
+}
+
+/**
+ * Writes a file with one adopted dataset (/adopted = 0..99), one borrowed dataset
+ * (/borrowed = 100..199) and one adopted scalar attribute (/scalar = 42).
+ * Returns a tuple (number of times the adopted buffer was released,
+ * if the borrowed node had data after write).
+ */
+static PyObject* _varioustests_writeAdoptedAndBorrowed(PyObject* self, PyObject* args)
+{
+  char* filename = NULL;
+  HL_NodeList* nodelist = NULL;
+  HL_Node* node = NULL;
+  HL_Node* borrowed = NULL;
+  hsize_t dims[1] = {100};
+  int borrowedData[100];
+  int* adoptedData = NULL;
+  int* scalarData = NULL;
+  int i = 0, hasData = 0;
+  PyObject* retv = NULL;
+
+  if (!PyArg_ParseTuple(args, "s", &filename)) {
+    return NULL;
+  }
+  adoptedFreeCount = 0;
+  adoptedData = malloc(sizeof(int)*100);
+  scalarData = HLHDF_MALLOC(sizeof(int));
+  for (i = 0; i < 100; i++) {
+    adoptedData[i] = i;
+    borrowedData[i] = 100 + i;
+  }
+  *scalarData = 42;
+
+  nodelist = HLNodeList_new();
+  node = HLNode_newDataset("/adopted");
+  if (!HLNode_adoptArrayValue(node, sizeof(int), 1, dims, (unsigned char*)adoptedData, countingFree, "int", -1) ||
+      !HLNodeList_addNode(nodelist, node)) {
+    goto fail;
+  }
+  node = borrowed = HLNode_newDataset("/borrowed");
+  if (!HLNode_borrowArrayValue(borrowed, sizeof(int), 1, dims, (unsigned char*)borrowedData, "int", -1) ||
+      !HLNodeList_addNode(nodelist, borrowed)) {
+    goto fail;
+  }
+  node = HLNode_newAttribute("/scalar");
+  if (!HLNode_adoptScalarValue(node, sizeof(int), (unsigned char*)scalarData, NULL, "int", -1) ||
+      !HLNodeList_addNode(nodelist, node)) {
+    goto fail;
+  }
+  node = NULL;
+  HLNodeList_setFileName(nodelist, filename);
+  if (!HLNodeList_write(nodelist, NULL, NULL)) {
+    goto fail;
+  }
+  hasData = (HLNode_getData(borrowed) != NULL);
+  HLNodeList_free(nodelist);
+  nodelist = NULL;
+  retv = Py_BuildValue("(ii)", adoptedFreeCount, hasData);
+fail:
+  if (retv == NULL) {
+    setException(PyExc_IOError, "Could not write adopted and borrowed values");
+  }
+  HLNode_free(node);
+  HLNodeList_free(nodelist);
+  return retv;
+}
+
+/**
+ * Writes a node with borrowed data to a file that can not be created.
+ * Returns a tuple (the result of the write, if the node still has data).
+ */
+static PyObject* _varioustests_writeBorrowedAndFail(PyObject* self, PyObject* args)
+{
+  char* filename = NULL;
+  HL_NodeList* nodelist = NULL;
+  HL_Node* node = NULL;
+  hsize_t dims[1] = {100};
+  int borrowedData[100];
+  int i = 0, written = 0, hasData = 0;
+
+  if (!PyArg_ParseTuple(args, "s", &filename)) {
+    return NULL;
+  }
+  for (i = 0; i < 100; i++) {
+    borrowedData[i] = i;
+  }
+  nodelist = HLNodeList_new();
+  node = HLNode_newDataset("/borrowed");
+  if (!HLNode_borrowArrayValue(node, sizeof(int), 1, dims, (unsigned char*)borrowedData, "int", -1) ||
+      !HLNodeList_addNode(nodelist, node)) {
+    HLNode_free(node);
+    HLNodeList_free(nodelist);
+    setException(PyExc_IOError, "Could not create node with borrowed value");
+    return NULL;
+  }
+  HLNodeList_setFileName(nodelist, filename);
+  written = HLNodeList_write(nodelist, NULL, NULL);
+  hasData = (HLNode_getData(node) != NULL);
+  HLNodeList_free(nodelist);
+  return Py_BuildValue("(ii)", written, hasData);
+}
+
+/**
+ * Selection that terminates the worker process when the name of the file contains "crash".
+ */
+static int crashingSelection(HL_NodeList* nodelist)
+{
+  char* filename = HLNodeList_getFileName(nodelist);
+  if (filename != NULL && strstr(filename, "crash") != NULL) {
+    _exit(1);
+  }
+  HLHDF_FREE(filename);
+  return HLNodeList_selectAllNodes(nodelist);
+}
+
+static void readManyCallback(int index, const char* filename, HL_NodeList* nodelist, void* userdata)
+{
+  ((int*)userdata)[index] = (nodelist != NULL);
+  HLNodeList_free(nodelist);
+}
+
+/**
+ * Reads the files with @ref HLNodeList_readMany, the workers crash on the files with
+ * "crash" in their name.
+ * Returns a list with True for each file that was read.
+ */
+static PyObject* _varioustests_readManyWithCrashes(PyObject* self, PyObject* args)
+{
+  PyObject* inobj = NULL;
+  PyObject* result = NULL;
+  const char** filenames = NULL;
+  int* read = NULL;
+  int nworkers = 0, i = 0, n = 0;
+
+  if (!PyArg_ParseTuple(args, "Oi", &inobj, &nworkers)) {
+    return NULL;
+  }
+  n = (int)PyList_Size(inobj);
+  filenames = HLHDF_MALLOC(sizeof(char*) * n);
+  read = HLHDF_MALLOC(sizeof(int) * n);
+  for (i = 0; i < n; i++) {
+    filenames[i] = PyString_AsString(PyList_GetItem(inobj, i));
+    read[i] = 0;
+  }
+  Py_BEGIN_ALLOW_THREADS
+  HLNodeList_readMany(filenames, n, crashingSelection, nworkers, 0.0, readManyCallback, read);
+  Py_END_ALLOW_THREADS
+  result = PyList_New(n);
+  for (i = 0; i < n; i++) {
+    PyList_SetItem(result, i, PyBool_FromLong(read[i]));
+  }
+  HLHDF_FREE(filenames);
+  HLHDF_FREE(read);
+  return result;
+}
+
+static pthread_mutex_t asyncGateLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t asyncGateOpened = PTHREAD_COND_INITIALIZER;
+static int asyncGateOpen = 0;
+
+/**
+ * Keeps the I/O thread in the callback of the first operation until the gate is opened.
+ */
+static int asyncGateCallback(HL_AsyncOperation* op, HL_AsyncStatus status, void* userdata)
+{
+  if (status == HL_ASYNC_RUNNING) {
+    pthread_mutex_lock(&asyncGateLock);
+    while (!asyncGateOpen) {
+      pthread_cond_wait(&asyncGateOpened, &asyncGateLock);
+    }
+    pthread_mutex_unlock(&asyncGateLock);
+  }
+  return 1;
+}
+
+/**
+ * Fetches the file asynchronously with nops operations and forks while the first is
+ * running and the others are queued. The child waits for the inherited operations,
+ * which must fail, and then fetches the file asynchronously itself. The parent lets
+ * the operations finish.
+ * Returns a tuple (if the child succeeded, number of operations done in the parent).
+ */
+static PyObject* _varioustests_forkWhileFetchingAsync(PyObject* self, PyObject* args)
+{
+  char* filename = NULL;
+  HL_NodeList* nodelists[8];
+  HL_AsyncOperation* ops[8];
+  int nops = 0, i = 0, done = 0, childStatus = 0;
+  pid_t pid = 0;
+
+  if (!PyArg_ParseTuple(args, "si", &filename, &nops)) {
+    return NULL;
+  }
+  if (nops <= 0 || nops > 8) {
+    setException(PyExc_ValueError, "nops must be between 1 and 8");
+    return NULL;
+  }
+  asyncGateOpen = 0;
+  for (i = 0; i < nops; i++) {
+    nodelists[i] = HLNodeList_read(filename);
+    HLNodeList_selectAllNodes(nodelists[i]);
+    ops[i] = HLNodeList_fetchMarkedNodesAsync(nodelists[i], (i == 0) ? asyncGateCallback : NULL, NULL);
+  }
+  while (HLAsyncOperation_poll(ops[0]) != HL_ASYNC_RUNNING) {
+    usleep(1000);
+  }
+
+  if ((pid = fork()) == 0) {
+    HL_NodeList* nodelist = NULL;
+    HL_AsyncOperation* op = NULL;
+    int failed = 0;
+    alarm(10);
+    for (i = 0; i < nops; i++) {
+      failed += (HLAsyncOperation_wait(ops[i]) == HL_ASYNC_FAILED);
+    }
+    nodelist = HLNodeList_read(filename);
+    HLNodeList_selectAllNodes(nodelist);
+    op = HLNodeList_fetchMarkedNodesAsync(nodelist, NULL, NULL);
+    _exit((failed == nops && HLAsyncOperation_wait(op) == HL_ASYNC_DONE) ? 0 : 1);
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  pthread_mutex_lock(&asyncGateLock);
+  asyncGateOpen = 1;
+  pthread_cond_broadcast(&asyncGateOpened);
+  pthread_mutex_unlock(&asyncGateLock);
+  for (i = 0; i < nops; i++) {
+    done += (HLAsyncOperation_wait(ops[i]) == HL_ASYNC_DONE);
+    HLAsyncOperation_free(ops[i]);
+    HLNodeList_free(nodelists[i]);
+  }
+  if (pid > 0) {
+    waitpid(pid, &childStatus, 0);
+  }
+  Py_END_ALLOW_THREADS
+
+  return Py_BuildValue("(ii)", pid > 0 && WIFEXITED(childStatus) && WEXITSTATUS(childStatus) == 0, done);
+}
+
+/**
+ * Queues an asynchronous fetch while error reporting is disabled, enables error reporting
+ * before the fetch runs and then verifies that the calling thread still reports errors
+ * like HDF5 does.
+ * Returns a tuple (if error reporting is enabled, if HDF5 has an error handler installed).
+ */
+static PyObject* _varioustests_errorReportingAfterAsyncFetch(PyObject* self, PyObject* args)
+{
+  char* filename = NULL;
+  HL_NodeList* nodelists[2];
+  HL_AsyncOperation* ops[2];
+  H5E_auto2_t errorFunction = NULL;
+  void* edata = NULL;
+  int enabled = 0, i = 0;
+
+  if (!PyArg_ParseTuple(args, "s", &filename)) {
+    return NULL;
+  }
+  asyncGateOpen = 0;
+  HL_disableErrorReporting();
+  for (i = 0; i < 2; i++) {
+    nodelists[i] = HLNodeList_read(filename);
+    HLNodeList_selectAllNodes(nodelists[i]);
+    ops[i] = HLNodeList_fetchMarkedNodesAsync(nodelists[i], (i == 0) ? asyncGateCallback : NULL, NULL);
+  }
+  HL_enableErrorReporting();
+
+  Py_BEGIN_ALLOW_THREADS
+  pthread_mutex_lock(&asyncGateLock);
+  asyncGateOpen = 1;
+  pthread_cond_broadcast(&asyncGateOpened);
+  pthread_mutex_unlock(&asyncGateLock);
+  for (i = 0; i < 2; i++) {
+    HLAsyncOperation_wait(ops[i]);
+    HLAsyncOperation_free(ops[i]);
+    HLNodeList_free(nodelists[i]);
+  }
+  Py_END_ALLOW_THREADS
+
+  HL_lockHdf5();
+  enabled = HL_isErrorReportingEnabled();
+  H5Eget_auto2(H5E_DEFAULT, &errorFunction, &edata);
+  HL_unlockHdf5();
+  HL_disableErrorReporting();
+
+  return Py_BuildValue("(ii)", enabled, errorFunction != NULL);
+}
+
 static PyMethodDef functions[] = {
   {"sizeoflong", (PyCFunction)_varioustests_sizeoflong, 1},
   {"sizeoflonglong", (PyCFunction)_varioustests_sizeoflonglong, 1},
   {"translatePyFormatToHlhdf", (PyCFunction)_varioustests_translatePyFormatToHlHdf, 1},
+  {"logThroughAsyncSink", (PyCFunction)_varioustests_logThroughAsyncSink, 1},
+  {"readInThreads", (PyCFunction)_varioustests_readInThreads, 1},
+  {"writeAdoptedAndBorrowed", (PyCFunction)_varioustests_writeAdoptedAndBorrowed, 1},
+  {"writeBorrowedAndFail", (PyCFunction)_varioustests_writeBorrowedAndFail, 1},
+  {"forkWhileFetchingAsync", (PyCFunction)_varioustests_forkWhileFetchingAsync, 1},
+  {"errorReportingAfterAsyncFetch", (PyCFunction)_varioustests_errorReportingAfterAsyncFetch, 1},
+  {"readManyWithCrashes", (PyCFunction)_varioustests_readManyWithCrashes, 1},
   {NULL,NULL} /*Sentinel*/
 };
 